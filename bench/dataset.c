@@ -0,0 +1,145 @@
+#include <toke/train/dataset.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/**
+ * @brief Measures how fast archives can be walked, so that compressed archives can be compared with the raw tar.
+ *
+ * @details Each archive given on the command line is walked a few times with a walker that counts lines, which reads
+ *          every byte without doing much else, so the time is mostly spent reading (and decompressing) the archive.
+ *          Pass the number of threads first, then the archives, for example:
+ *
+ *              toke_bench_dataset 4 corpus.tar corpus.tar.gz corpus.tar.zst
+ *
+ *          With one thread, a compressed archive is walked no faster than it decompresses, so comparing against
+ *          "zstd -dc" or "gzip -dc" shows the overhead of the walk. How well the walk overlaps decompression with the
+ *          walkers only shows with several threads on as many cores.
+ * */
+
+#define MAX_THREADS 256
+
+#define CACHE_LINE_SIZE 64
+
+static double
+now()
+{
+  struct timespec ts;
+  timespec_get(&ts, TIME_UTC);
+  return (double)ts.tv_sec + ((double)ts.tv_nsec * 1e-9);
+}
+
+/**
+ * @brief The counts of one thread, on a cache line of their own so that threads never write to the same line.
+ * */
+struct thread_counts
+{
+  _Alignas(CACHE_LINE_SIZE) size_t bytes;
+
+  size_t lines;
+};
+
+struct counts
+{
+  struct thread_counts threads[MAX_THREADS];
+};
+
+static void
+count_lines(void* user_data,
+            const uint8_t* text,
+            const size_t text_size,
+            const size_t file_index,
+            const size_t offset,
+            const size_t thread_index)
+{
+  (void)file_index;
+  (void)offset;
+
+  struct counts* counts = user_data;
+
+  size_t lines = 0;
+
+  const uint8_t* ptr = text;
+
+  const uint8_t* end = text + text_size;
+
+  while ((ptr = memchr(ptr, '\n', (size_t)(end - ptr))) != NULL) {
+    lines++;
+    ptr++;
+  }
+
+  counts->threads[thread_index].bytes += text_size;
+  counts->threads[thread_index].lines += lines;
+}
+
+int
+main(int argc, char** argv)
+{
+  if (argc < 3) {
+    fprintf(stderr, "usage: %s <threads> <archive>...\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  const size_t threads = (size_t)atoi(argv[1]);
+  if ((threads == 0) || (threads > MAX_THREADS)) {
+    fprintf(stderr, "the number of threads must be from 1 to %d\n", MAX_THREADS);
+    return EXIT_FAILURE;
+  }
+
+  toke_dataset_z* dataset = toke_dataset_new();
+  if (!dataset) {
+    return EXIT_FAILURE;
+  }
+
+  printf("walking with %zu threads\n", threads);
+  printf("%-40s %12s %12s\n", "archive", "walked", "throughput");
+
+  for (int i = 2; i < argc; i++) {
+
+    const toke_error_z open_err = toke_dataset_open(dataset, argv[i]);
+    if (open_err != TOKE_ERROR_NONE) {
+      fprintf(stderr, "%s: %s\n", argv[i], toke_strerror(open_err));
+      continue;
+    }
+
+    const int repeats = 3;
+
+    double best = 0;
+
+    size_t bytes = 0;
+
+    for (int j = 0; j < repeats; j++) {
+
+      struct counts counts;
+      memset(&counts, 0, sizeof(counts));
+
+      const double start = now();
+
+      const toke_error_z err = toke_dataset_walk(dataset, threads, &counts, count_lines);
+
+      const double elapsed = now() - start;
+
+      if (err != TOKE_ERROR_NONE) {
+        fprintf(stderr, "%s: %s\n", argv[i], toke_strerror(err));
+        break;
+      }
+
+      bytes = 0;
+      for (size_t k = 0; k < threads; k++) {
+        bytes += counts.threads[k].bytes;
+      }
+
+      if ((j == 0) || (elapsed < best)) {
+        best = elapsed;
+      }
+    }
+
+    printf("%-40.40s %9.0f MB %7.0f MB/s\n", argv[i], (double)bytes * 1e-6, ((double)bytes / best) * 1e-6);
+  }
+
+  toke_dataset_delete(dataset);
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,157 @@
+#include <toke/cpu.h>
+#include <toke/normalizer.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/**
+ * @brief Measures the throughput of the normalizer for each filter option on its own and for all of them together.
+ *
+ * @details The text is mostly ASCII with a few percent of line endings, tabs, capitals and multi-byte sequences, so
+ *          that both the vectorized and the scalar paths are exercised. Pass a size in megabytes to change the amount
+ *          of text.
+ * */
+
+static double
+now()
+{
+  struct timespec ts;
+  timespec_get(&ts, TIME_UTC);
+  return (double)ts.tv_sec + ((double)ts.tv_nsec * 1e-9);
+}
+
+static char*
+make_text(const size_t size)
+{
+  const char* specials[] = { "\r\n", "\t", "Q", "\xc3\xa9", "\xc3\x89", "\xe2\x80\x94", "\xe2\x80\x99", "\x01" };
+
+  char* text = malloc(size);
+  if (!text) {
+    return NULL;
+  }
+
+  unsigned int state = 1;
+
+  size_t offset = 0;
+
+  while (offset < size) {
+
+    state = (state * 1103515245u) + 12345u;
+
+    const unsigned int r = (state >> 16) & 0x7fff;
+
+    const char* piece = NULL;
+
+    char c[2] = { 0, 0 };
+
+    if ((r % 100) < 3) {
+      piece = specials[(r / 100) % (sizeof(specials) / sizeof(specials[0]))];
+    } else {
+      c[0] = (char)('a' + (r % 26));
+      if ((r % 7) == 0) {
+        c[0] = ' ';
+      }
+      piece = c;
+    }
+
+    const size_t piece_size = strlen(piece);
+
+    if ((offset + piece_size) > size) {
+      break;
+    }
+
+    memcpy(text + offset, piece, piece_size);
+
+    offset += piece_size;
+  }
+
+  memset(text + offset, ' ', size - offset);
+
+  return text;
+}
+
+static double
+measure(toke_normalizer_z* normalizer, const char* text, const size_t size)
+{
+  const int repeats = 5;
+
+  double best = 0;
+
+  for (int i = 0; i < repeats; i++) {
+
+    const double start = now();
+
+    size_t out_length = 0;
+
+    char* output = toke_normalize(normalizer, text, size, &out_length);
+
+    const double elapsed = now() - start;
+
+    free(output);
+
+    if ((i == 0) || (elapsed < best)) {
+      best = elapsed;
+    }
+  }
+
+  return ((double)size / best) * 1e-6;
+}
+
+int
+main(int argc, char** argv)
+{
+  const size_t size = ((argc > 1) ? (size_t)atoi(argv[1]) : 64) << 20;
+
+  const char* configs[] = { "",
+                            "normalize_lines=true",
+                            "normalize_tabs=true",
+                            "restricted_ascii=true",
+                            "lowercase=true",
+                            "unicode_substitutes=true",
+                            "normalize_lines=true,normalize_tabs=true,restricted_ascii=true,lowercase=true,"
+                            "unicode_substitutes=true",
+                            "nfc=true",
+                            "nfkc=true" };
+
+  const toke_cpu_level_z levels[] = { TOKE_CPU_LEVEL_SCALAR, toke_cpu_level() };
+
+  const char* level_names[] = { "scalar", "sse2", "avx2", "avx512" };
+
+  char* text = make_text(size);
+  if (!text) {
+    fprintf(stderr, "failed to allocate %zu bytes\n", size);
+    return EXIT_FAILURE;
+  }
+
+  toke_normalizer_z* normalizer = toke_normalizer_new();
+  if (!normalizer) {
+    free(text);
+    return EXIT_FAILURE;
+  }
+
+  printf("%-32s %12s %12s\n", "config", level_names[levels[0]], level_names[levels[1]]);
+
+  for (size_t i = 0; i < (sizeof(configs) / sizeof(configs[0])); i++) {
+
+    toke_normalizer_parse_config(normalizer, configs[i], strlen(configs[i]));
+
+    double results[2];
+
+    for (int j = 0; j < 2; j++) {
+      toke_cpu_set_level(levels[j]);
+      results[j] = measure(normalizer, text, size);
+    }
+
+    toke_cpu_set_level(levels[1]);
+
+    printf("%-32.32s %7.0f MB/s %7.0f MB/s\n", (configs[i][0] != 0) ? configs[i] : "(none)", results[0], results[1]);
+  }
+
+  toke_normalizer_delete(normalizer);
+
+  free(text);
+
+  return EXIT_SUCCESS;
+}
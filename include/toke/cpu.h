@@ -0,0 +1,38 @@
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+  /**
+   * @brief The instruction sets the vectorized kernels are built for, in increasing order.
+   * */
+  enum toke_cpu_level
+  {
+    TOKE_CPU_LEVEL_SCALAR,
+    TOKE_CPU_LEVEL_SSE2,
+    TOKE_CPU_LEVEL_AVX2,
+    TOKE_CPU_LEVEL_AVX512
+  };
+
+  typedef enum toke_cpu_level toke_cpu_level_z;
+
+  /**
+   * @brief Gets the level the kernels are currently dispatched at.
+   *
+   * @details On first use, this is the best level supported by both the build and the CPU. The TOKE_CPU_LEVEL
+   *          environment variable ("scalar", "sse2", "avx2" or "avx512") can lower it, which is useful for testing.
+   * */
+  toke_cpu_level_z toke_cpu_level();
+
+  /**
+   * @brief Selects the kernels for a specific level.
+   *
+   * @return The level that was selected, which is lowered to what the build and the CPU support.
+   * */
+  toke_cpu_level_z toke_cpu_set_level(toke_cpu_level_z level);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <toke/error.h>
+#include <toke/model.h>
 
 #include <stddef.h>
 #include <stdint.h>
@@ -20,6 +21,17 @@ extern "C"
 
   toke_error_z toke_decoder_parse_vocab(toke_decoder_z* self, const char* vocab, size_t length);
 
+  /**
+   * @brief Replaces the vocab with the tokens of a model, without going through the text vocab format.
+   *
+   * @details As with @ref toke_encoder_from_model, only the tokens that get a 16-bit ID are taken, and the last ID is
+   *          left for unknown tokens.
+   *
+   * @return @ref TOKE_ERROR_MODEL_FORMAT if the definitions add up to more than a gigabyte, or if a token of a loaded
+   *         model is malformed. Nothing is allocated then, and the vocab is left empty.
+   * */
+  toke_error_z toke_decoder_from_model(toke_decoder_z* self, const toke_model_z* model);
+
   char* toke_decode(toke_decoder_z* self, const uint16_t* tokens, const size_t length, size_t* out_length_ptr);
 
 #ifdef __cplusplus
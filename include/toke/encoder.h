@@ -1,6 +1,7 @@
 #pragma once
 
 #include <toke/error.h>
+#include <toke/model.h>
 
 #include <stddef.h>
 #include <stdint.h>
@@ -20,8 +21,24 @@ extern "C"
 
   toke_error_z toke_encoder_parse_vocab(toke_encoder_z* self, const char* vocab, size_t length);
 
+  /**
+   * @brief Replaces the vocab with the tokens of a model, without going through the text vocab format.
+   *
+   * @details The ID of each token is its index in the model. The filter, if any, is left as it is.
+   *
+   * @return @ref TOKE_ERROR_MODEL_FORMAT if a token of a loaded model is malformed (see @ref toke_model_get_def).
+   * */
+  toke_error_z toke_encoder_from_model(toke_encoder_z* self, const toke_model_z* model);
+
   uint16_t* toke_encode(toke_encoder_z* self, const void* text, size_t length, size_t* out_length);
 
+  /**
+   * @brief Encodes text that the caller no longer needs, normalizing it in place rather than in a copy.
+   *
+   * @details The contents of the text are unspecified afterwards.
+   * */
+  uint16_t* toke_encode_inplace(toke_encoder_z* self, void* text, size_t length, size_t* out_length);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
@@ -13,7 +13,11 @@ extern "C"
     TOKE_ERROR_FILE_IO,
     TOKE_ERROR_VOCAB_SYNTAX,
     TOKE_ERROR_FILTER_SYNTAX,
-    TOKE_ERROR_INVALID_UNICODE
+    TOKE_ERROR_INVALID_UNICODE,
+    TOKE_ERROR_BUFFER_SIZE,
+    TOKE_ERROR_MODEL_FORMAT,
+    TOKE_ERROR_UNSUPPORTED_COMPRESSION,
+    TOKE_ERROR_SHARD_FORMAT
   };
 
   typedef enum toke_error toke_error_z;
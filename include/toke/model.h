@@ -1,6 +1,7 @@
 #pragma once
 
 #include <toke/error.h>
+#include <toke/unicode_blocks.h>
 
 #include <stddef.h>
 #include <stdint.h>
@@ -10,14 +11,6 @@ extern "C"
 {
 #endif
 
-  enum toke_unicode_block
-  {
-    TOKE_UNICODE_BLOCK_BASIC_LATIN,
-    TOKE_UNICODE_BLOCK_GENERAL_PUNCTUATION
-  };
-
-  typedef enum toke_unicode_block toke_unicode_block_z;
-
   typedef struct toke_model toke_model_z;
 
   toke_model_z* toke_model_new();
@@ -28,14 +21,74 @@ extern "C"
 
   toke_error_z toke_model_add_token(toke_model_z* self, const uint8_t* data, size_t size);
 
+  /**
+   * @brief Adds many tokens at once, which is much faster than adding them one at a time to a large model.
+   *
+   * @details Tokens that are already in the model, or repeated in the input, are only added once.
+   *
+   * @param data The bytes of each token.
+   *
+   * @param sizes The size of each token, in bytes.
+   * */
+  toke_error_z toke_model_add_tokens(toke_model_z* self, const uint8_t* const* data, const size_t* sizes, size_t count);
+
   toke_error_z toke_model_add_codepoint(toke_model_z* self, const uint32_t codepoint);
 
+  /**
+   * @brief Adds every codepoint from @p first to @p last, inclusive, in a single bulk insertion.
+   *
+   * @details Surrogates have no UTF-8 form, so they are skipped if the range covers them.
+   *
+   * @return @ref TOKE_ERROR_INVALID_UNICODE if the range is empty or goes past the last codepoint.
+   * */
+  toke_error_z toke_model_add_codepoint_range(toke_model_z* self, uint32_t first, uint32_t last);
+
   toke_error_z toke_model_add_unicode_block(toke_model_z* self, toke_unicode_block_z block);
 
+  /**
+   * @brief Gets the name of a block, in the form of its enumerator (such as "BASIC_LATIN").
+   *
+   * @return The name, or null if the block is out of range.
+   * */
+  const char* toke_unicode_block_name(toke_unicode_block_z block);
+
+  /**
+   * @brief Gets the bytes of a token, which are followed by a null terminator.
+   *
+   * @return The token, or null if the index is out of range, or if the model was loaded from a file where the token's
+   *         offsets are malformed.
+   * */
   const uint8_t* toke_model_get_def(const toke_model_z* self, const size_t index);
 
+  /**
+   * @brief Gets the size of a token, which is zero for a token that @ref toke_model_get_def returns null for.
+   * */
   size_t toke_model_get_size(const toke_model_z* self, const size_t index);
 
+  /**
+   * @brief Writes the model to a binary file, which holds an offset for each token followed by a pool of their bytes.
+   *
+   * @details The file is written next to the target and then renamed over it, so a model that was loaded from the
+   *          target (this one included) keeps reading the old file, and a failed save leaves the target as it was.
+   * */
+  toke_error_z toke_model_save(const toke_model_z* self, const char* filename);
+
+  /**
+   * @brief Replaces the model with one saved by @ref toke_model_save.
+   *
+   * @details The file is memory mapped and its tokens are read in place, so loading takes the same time whatever the
+   *          size of the model. The first change to the model builds an index of the tokens, but still doesn't copy
+   *          them. The file must not be modified while the model is open.
+   *
+   *          Loading only checks the header and the ends of the pool. Each token is checked as it is read, and one
+   *          with malformed offsets reads as null. The first change checks every token, and that they are sorted
+   *          without repeats, which insertions rely on. It fails with @ref TOKE_ERROR_MODEL_FORMAT if they aren't,
+   *          and so does saving the model or building an encoder or decoder from it.
+   *
+   * @return @ref TOKE_ERROR_MODEL_FORMAT if the header doesn't match the file.
+   * */
+  toke_error_z toke_model_load(toke_model_z* self, const char* filename);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
@@ -15,10 +15,74 @@ extern "C"
 
   void toke_normalizer_delete(toke_normalizer_z* self);
 
+  /**
+   * @brief Parses a comma separated list of options, as found on the "#filter:" line of a vocab.
+   *
+   * @details Besides the boolean options, "substitute=U+2026:U+002E U+002E U+002E" maps a non-ASCII codepoint to zero
+   *          or more codepoints, which may not be longer than it in UTF-8. It can be given any number of times, and
+   *          overrides the mappings enabled by "unicode_substitutes".
+   * */
   toke_error_z toke_normalizer_parse_config(toke_normalizer_z* self, const char* config, size_t length);
 
   char* toke_normalize(toke_normalizer_z* self, const char* input, size_t length, size_t* out_length_ptr);
 
+  /**
+   * @brief Normalizes the text in the caller's buffer, which saves allocating and copying a second one.
+   *
+   * @details The byte filters never make the text longer. NFC and NFKC can, and if the normalized text would not fit
+   *          in @p length bytes then @ref TOKE_ERROR_BUFFER_SIZE is returned and the text is left as it was. The
+   *          result is not null terminated.
+   *
+   * @param out_length_ptr Receives the length of the normalized text.
+   * */
+  toke_error_z toke_normalize_inplace(toke_normalizer_z* self, char* text, size_t length, size_t* out_length_ptr);
+
+  /**
+   * @brief Normalizes text that arrives in chunks, giving the same output as a single call to @ref toke_normalize.
+   *
+   * @details Bytes that depend on what comes next (a carriage return, part of a UTF-8 sequence, or the last segment
+   *          when NFC or NFKC is enabled) are held by the stream until the next chunk or the end of the text. The
+   *          normalizer must outlive the stream, and its config must not change while the stream is in use.
+   *
+   *          A segment is cut after 31 codepoints, as in the stream-safe format of UAX #15, so the stream never holds
+   *          more than a segment and a truncated codepoint between chunks. @ref toke_normalize cuts segments the same
+   *          way, so the two still agree. Only a run of more than 30 combining marks is affected, and its marks are
+   *          reordered and composed within each piece rather than across the whole run.
+   * */
+  typedef struct toke_normalizer_stream toke_normalizer_stream_z;
+
+  toke_normalizer_stream_z* toke_normalizer_stream_new(const toke_normalizer_z* normalizer);
+
+  void toke_normalizer_stream_delete(toke_normalizer_stream_z* self);
+
+  /**
+   * @brief Gets the output capacity needed to feed a chunk of the given length, or to finish the stream if the length
+   *        is zero.
+   * */
+  size_t toke_normalizer_stream_bound(const toke_normalizer_stream_z* self, size_t length);
+
+  /**
+   * @brief Normalizes a chunk of text, writing whatever is ready into the output buffer.
+   *
+   * @param output_capacity The size of the output buffer, which must be at least @ref toke_normalizer_stream_bound.
+   *
+   * @param out_length_ptr Receives the number of bytes written.
+   * */
+  toke_error_z toke_normalizer_stream_feed(toke_normalizer_stream_z* self,
+                                           const char* input,
+                                           size_t length,
+                                           char* output,
+                                           size_t output_capacity,
+                                           size_t* out_length_ptr);
+
+  /**
+   * @brief Writes out the bytes held back by the stream, which may then be used for a new text.
+   * */
+  toke_error_z toke_normalizer_stream_finish(toke_normalizer_stream_z* self,
+                                             char* output,
+                                             size_t output_capacity,
+                                             size_t* out_length_ptr);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
@@ -2,6 +2,7 @@
 
 #include <toke/error.h>
 #include <toke/model.h>
+#include <toke/train/dedup.h>
 
 #include <stddef.h>
 #include <stdint.h>
@@ -11,10 +12,25 @@ extern "C"
 {
 #endif
 
+  /**
+   * @brief Called on each file of a dataset, from several threads at once.
+   *
+   * @param file_index The position of the file among the regular files of the archive, as used by
+   *                   @ref toke_dataset_get. For a directory, it is the position of the file among the sorted paths
+   *                   of its files, and for JSON lines, it is the line number of the record (counting from zero).
+   *
+   * @param offset Where the text starts in the file, which is only non-zero if the file was split into chunks. It is
+   *               always zero for JSON lines.
+   *
+   * @param thread_index The thread calling the walker, which is less than the maximum number of threads passed to
+   *                     @ref toke_dataset_walk. A thread never runs two walkers at once, so this can index per-thread
+   *                     state without locking.
+   * */
   typedef void (*toke_dataset_walker)(void* user_data,
                                       const uint8_t* text,
                                       size_t text_size,
                                       size_t file_index,
+                                      size_t offset,
                                       size_t thread_index);
 
   typedef struct toke_dataset toke_dataset_z;
@@ -23,13 +39,225 @@ extern "C"
 
   void toke_dataset_delete(toke_dataset_z* self);
 
+  /**
+   * @brief Opens a tar archive, a file of JSON lines or a directory.
+   *
+   * @details A path to a directory opens every file below it, following links to files but not to directories.
+   *          A file whose first non-blank byte is an opening brace is read as JSON lines, where each line is an object
+   *          whose text field (see @ref toke_dataset_set_jsonl_field) is a record. Any other file is read as a tar
+   *          archive, and its regular files are indexed.
+   *
+   * @details The index is kept in a file next to the archive, named after it with an ".idx" suffix. It is built the
+   *          first time the archive is opened and read back after that, unless the size or modification time of the
+   *          archive has changed since. If the index can't be written, the archive is still opened. Only tar
+   *          archives are indexed.
+   *
+   *          Archives and JSON lines compressed with gzip or zstd are recognized by their magic number and
+   *          decompressed as they are walked. They can only be read in order, so they aren't indexed: their size reads
+   *          as zero, and their files can only be reached by walking them.
+   *
+   * @return @ref TOKE_ERROR_FILE_IO if the archive is malformed, or @ref TOKE_ERROR_UNSUPPORTED_COMPRESSION if it is
+   *         compressed in a format that this build can't read.
+   * */
   toke_error_z toke_dataset_open(toke_dataset_z* self, const char* filename);
 
+  /**
+   * @brief Gets the number of regular files in the archive, which is zero for anything other than an uncompressed tar
+   *        archive.
+   * */
+  size_t toke_dataset_size(const toke_dataset_z* self);
+
+  /**
+   * @brief Gets the contents of a file, which stay valid until the dataset is closed or reopened.
+   *
+   * @param index The position of the file among the regular files of the archive.
+   *
+   * @param size Set to the size of the file, in bytes.
+   *
+   * @return A pointer to the file's data, or null if the index is out of range.
+   * */
+  const uint8_t* toke_dataset_get(const toke_dataset_z* self, size_t index, size_t* size);
+
+  /**
+   * @brief Checks whether a text handed to a walker lies in the dataset's mapping of its file, in which case it stays
+   *        valid until the dataset is closed or reopened, like the contents from @ref toke_dataset_get, rather than
+   *        only until the walker returns.
+   *
+   * @details Every text of an uncompressed tar archive does, as do the records of uncompressed JSON lines that have no
+   *          escapes. Escaped records are unescaped into a buffer of the walking thread, the texts of a compressed file
+   *          are decompressed into buffers that are reused, and each file of a directory is unmapped once it has been
+   *          walked, so none of those do.
+   *
+   * @return Non-zero if the whole text lies in the mapping.
+   * */
+  int toke_dataset_contains(const toke_dataset_z* self, const uint8_t* text, size_t size);
+
+  /**
+   * @brief Sets the field of a JSON object that holds the text of a record, which is "text" by default.
+   *
+   * @details Lines without the field, or where it isn't a string, are skipped. Text without escapes is handed to the
+   *          walker straight from the file, and only text with escapes is copied to be unescaped.
+   * */
+  toke_error_z toke_dataset_set_jsonl_field(toke_dataset_z* self, const char* field);
+
+  /**
+   * @brief Makes the walk split files larger than the chunk size into chunks, which are walked in parallel.
+   *
+   * @details A chunk ends just after the first delimiter at or past the chunk size, so chunks are at least the chunk
+   *          size and only the last one of a file may end without the delimiter. A file with no delimiter after the
+   *          chunk size isn't split further.
+   *
+   * @param chunk_size The size to split files at, or zero (the default) to walk every file whole.
+   *
+   * @param delimiter The byte that chunks end with, which is usually a newline.
+   * */
+  void toke_dataset_set_chunking(toke_dataset_z* self, size_t chunk_size, uint8_t delimiter);
+
+  /**
+   * @brief Sets how far ahead of the walk the archive is read in, which is 64 MiB by default.
+   *
+   * @details The walk asks the kernel to read the archive in before the walkers reach it, and to drop the pages
+   *          behind them once every walker that reads them has returned. A pass over an archive much larger than
+   *          memory then keeps a few windows of it mapped, rather than all of it.
+   *
+   * @param readahead The size of the window, in bytes, or zero to leave paging to the kernel.
+   * */
+  void toke_dataset_set_readahead(toke_dataset_z* self, size_t readahead);
+
+  /**
+   * @brief Makes walks skip exact duplicates, by adding each text to the set before walking it.
+   *
+   * @details Only texts that weren't in the set yet are passed to the walker, and the set counts the rest. What is
+   *          compared is whatever the walker would get, so with chunking each chunk is compared on its own, and with
+   *          JSON lines each record is. Copies are walked in parallel, so which of them is passed on isn't defined,
+   *          only that one of them is. A shard writer that keeps the order of the dataset (see
+   *          @ref TOKE_SHARD_ORDERED) keeps the first copy instead, so that its shards are the same on every write.
+   *
+   *          The set lives on between walks, which lets one set skip the duplicates across several datasets. To walk a
+   *          dataset again with the same set, clear the set first, or every text will be skipped.
+   *
+   * @param dedup The set to use, which must outlive the walks, or null (the default) to walk every text.
+   * */
+  void toke_dataset_set_dedup(toke_dataset_z* self, toke_dedup_z* dedup);
+
+  /**
+   * @brief Makes walks visit a sample of the files (or records), for trying things out on part of a large dataset.
+   *
+   * @details Whether a file is picked depends only on its index and the seed, so the same seed always picks the same
+   *          files, however many threads walk them. The files keep their indices, so the walker can still tell where
+   *          each one came from. With a budget, the files are counted in the order of the dataset until the picked
+   *          ones add up to it, and the walk stops after the file that reaches it. To spread a budget over the whole
+   *          dataset rather than its start, pair it with a fraction of about the budget over the dataset's size.
+   *
+   *          Files that aren't picked are never read from an archive in memory or a directory, since their sizes are
+   *          in the index (or the directory). A compressed archive still has to be decompressed past them. Records of
+   *          JSON lines have no headers, so the ones that aren't picked are read and then dropped, and the size a
+   *          budget counts for each is that of its line. Only a budget saves reading the rest of the file.
+   *
+   * @param fraction The chance that each file is picked. One (the default) or more picks all of them.
+   *
+   * @param max_bytes The size that the picked files add up to before the walk stops, or zero (the default) for no
+   *                  limit.
+   *
+   * @param seed Picks a different sample for each value.
+   * */
+  void toke_dataset_set_sampling(toke_dataset_z* self, double fraction, size_t max_bytes, uint64_t seed);
+
+  /**
+   * @brief Calls the walker on each regular file of the archive, each file of the directory or each record of the JSON
+   *        lines.
+   *
+   * @details One thread hands each file to whichever thread is free, so the files are walked in no particular order.
+   *          The call returns once every file has been walked. For a compressed archive, the handing out thread is also
+   *          the one decompressing it, and each file is handed over as soon as it has been decompressed. With
+   *          chunking, each chunk is handed over as soon as it has been, so a file of any size only takes a few buffers
+   *          of memory. Without, a file is decompressed whole before it is walked.
+   *
+   *          The files of a directory are each walked like the files of an archive. The lines of a JSON lines file are
+   *          handed out in runs of about a megabyte (or the chunk size, if one is set), each of which is parsed by the
+   *          thread that walks it.
+   *
+   * @param max_threads The most threads to use. Zero is treated as one.
+   *
+   * @return @ref TOKE_ERROR_FILE_IO if a compressed archive turns out to be corrupt or malformed, if a file of a
+   *         directory can't be opened, or if a line of JSON isn't an object. The walk stops short of the problem, so
+   *         only some of the files (or records) have been walked. With JSON lines, the runs of lines that are being
+   *         walked when one fails still run to their end, while those that haven't started are skipped, so the records
+   *         walked are neither all of those before the bad line nor only those. What the walker gathered is then best
+   *         thrown away.
+   * */
   toke_error_z toke_dataset_walk(const toke_dataset_z* self,
                                  size_t max_threads,
                                  void* walker_data,
                                  toke_dataset_walker walker);
 
+  /**
+   * @brief Callbacks for a walk where each thread gathers into a state of its own, and the states are merged into one
+   *        once the walk is done, such as for counting something across the dataset.
+   *
+   * @details Each state is zeroed and then set up by the thread that will walk with it, which is then the only one to
+   *          touch it until the walk is done. The states are spaced out to whole cache lines, so threads never share
+   *          one while they write. They are merged in pairs, with each round merging the results of the last, which
+   *          takes a number of rounds that grows with the logarithm of the number of threads.
+   * */
+  struct toke_dataset_reducer
+  {
+    /**
+     * @brief The size of a state, in bytes.
+     * */
+    size_t state_size;
+
+    /**
+     * @brief Sets up a zeroed state, or null if zeroed is enough.
+     *
+     * @return An error that stops the walk before it starts, or @ref TOKE_ERROR_NONE.
+     * */
+    toke_error_z (*init)(void* user_data, void* state, size_t thread_index);
+
+    /**
+     * @brief Called on each file of the dataset, with the state of the calling thread. It takes the place of
+     *        @ref toke_dataset_walker, whose other parameters it shares.
+     * */
+    void (*walk)(void* user_data,
+                 void* state,
+                 const uint8_t* text,
+                 size_t text_size,
+                 size_t file_index,
+                 size_t offset);
+
+    /**
+     * @brief Merges the source state into the target one, or null to leave the states apart. Several pairs are merged
+     *        at once, but each state is only in one of them.
+     *
+     * @return An error that fails the walk, or @ref TOKE_ERROR_NONE.
+     * */
+    toke_error_z (*merge)(void* user_data, void* target, void* source);
+
+    /**
+     * @brief Releases whatever a state holds, or null if there's nothing to release. It is called on every state
+     *        that was set up, once the states have been merged or the walk has failed.
+     * */
+    void (*finalize)(void* user_data, void* state);
+  };
+
+  typedef struct toke_dataset_reducer toke_dataset_reducer_z;
+
+  /**
+   * @brief Walks the dataset like @ref toke_dataset_walk, but with a state for each thread, which are merged into
+   *        the result once the walk is done.
+   *
+   * @param result The state that everything is merged into last, which the caller sets up beforehand and owns after.
+   *               If null, the states are still merged, which only matters if merging has some effect of its own.
+   *
+   * @return @ref TOKE_ERROR_MEMORY_ALLOCATION if the states can't be allocated, the first error returned by a
+   *         callback, or an error from the walk.
+   * */
+  toke_error_z toke_dataset_walk_reduce(const toke_dataset_z* self,
+                                        size_t max_threads,
+                                        const toke_dataset_reducer_z* reducer,
+                                        void* user_data,
+                                        void* result);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
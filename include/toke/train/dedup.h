@@ -0,0 +1,57 @@
+#pragma once
+
+#include <toke/error.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+  /**
+   * @brief A set of the texts seen so far, kept as 128-bit hashes, for skipping exact duplicates.
+   *
+   * @details The set is safe to add to from several threads at once. It is split into stripes that each have their own
+   *          lock, so threads rarely wait on each other. Two different texts are only mistaken for each other if their
+   *          128-bit hashes collide, which is vanishingly unlikely even for billions of texts.
+   * */
+  typedef struct toke_dedup toke_dedup_z;
+
+  toke_dedup_z* toke_dedup_new();
+
+  void toke_dedup_delete(toke_dedup_z* self);
+
+  /**
+   * @brief Forgets every text and resets the statistics.
+   * */
+  void toke_dedup_clear(toke_dedup_z* self);
+
+  /**
+   * @brief Adds a text to the set.
+   *
+   * @param is_new Set to non-zero if the text wasn't in the set yet.
+   *
+   * @return @ref TOKE_ERROR_MEMORY_ALLOCATION if the set couldn't grow, in which case the text isn't added.
+   * */
+  toke_error_z toke_dedup_insert(toke_dedup_z* self, const uint8_t* text, size_t text_size, int* is_new);
+
+  /**
+   * @brief Gets the number of distinct texts in the set.
+   * */
+  size_t toke_dedup_num_unique(const toke_dedup_z* self);
+
+  /**
+   * @brief Gets the number of texts that were added while already in the set.
+   * */
+  size_t toke_dedup_num_duplicates(const toke_dedup_z* self);
+
+  /**
+   * @brief Gets the total size of the duplicates, in bytes.
+   * */
+  size_t toke_dedup_duplicate_bytes(const toke_dedup_z* self);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
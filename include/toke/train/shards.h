@@ -0,0 +1,183 @@
+#pragma once
+
+#include <toke/encoder.h>
+#include <toke/error.h>
+#include <toke/train/dataset.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+  /**
+   * @brief The order that a shard writer lays documents out in.
+   * */
+  enum toke_shard_order
+  {
+    /**
+     * @brief Documents are in the order of the dataset, whatever order they were encoded in, so that writing the same
+     *        dataset twice gives the same shards. The tokens are kept in a temporary file for each thread until the
+     *        walk is done, and copied to the shards in order after that.
+     *
+     *        If the dataset skips duplicates (see @ref toke_dataset_set_dedup), they are only skipped as the documents
+     *        are copied, so the copy of a text that is kept is always the first one in the dataset. Duplicates are
+     *        still encoded, which costs the time to encode them and the room to hold them until the copy.
+     * */
+    TOKE_SHARD_ORDERED,
+    /**
+     * @brief Documents are in the order they finish encoding, and are written to the shards straight away.
+     * */
+    TOKE_SHARD_UNORDERED
+  };
+
+  typedef enum toke_shard_order toke_shard_order_z;
+
+  /**
+   * @brief Encodes a dataset into shards of tokens, for a model trainer to read.
+   *
+   * @details A write produces shard files named "<prefix>-00000.bin", "<prefix>-00001.bin" and so on, which hold
+   *          nothing but the tokens as 16-bit integers in the byte order of the machine, and an index named
+   *          "<prefix>.idx". The index lists how many tokens each shard holds, and where each document starts, which
+   *          shard it is in and how many tokens it has. A document is whatever the dataset hands a walker: a file of
+   *          an archive or a directory, a record of JSON lines, or a chunk of one of these if the dataset is chunked.
+   * */
+  typedef struct toke_shard_writer toke_shard_writer_z;
+
+  toke_shard_writer_z* toke_shard_writer_new();
+
+  void toke_shard_writer_delete(toke_shard_writer_z* self);
+
+  /**
+   * @brief Sets how many tokens a shard holds at most, which is 2^27 (256 MiB of tokens) by default.
+   *
+   * @details Documents are never split across shards, so a document with more tokens than that gets a shard of its
+   *          own, which is the only way for a shard to go over the limit.
+   * */
+  void toke_shard_writer_set_max_tokens(toke_shard_writer_z* self, size_t max_tokens);
+
+  /**
+   * @brief Sets the order documents are laid out in, which is @ref TOKE_SHARD_ORDERED by default.
+   * */
+  void toke_shard_writer_set_order(toke_shard_writer_z* self, toke_shard_order_z order);
+
+  /**
+   * @brief Walks the dataset and encodes each document into shards, overwriting any written before with the same
+   *        prefix.
+   *
+   * @details Shards of an earlier write that went past the last shard of this one are removed, so that a directory
+   *          of shards never holds any that the index doesn't list.
+   *
+   * @param encoder The encoder to use, which is shared by the threads of the walk. Encoding doesn't modify it.
+   *
+   * @param prefix The path that the shard and index files are named after.
+   *
+   * @param max_threads The most threads to encode with. Zero is treated as one.
+   *
+   * @return @ref TOKE_ERROR_FILE_IO if a file couldn't be written or a leftover shard couldn't be removed, or an error
+   *         from the walk. The index is only written if everything else was, so a failed write never leaves an index
+   *         behind that reads as complete.
+   * */
+  toke_error_z toke_shard_writer_write(toke_shard_writer_z* self,
+                                       const toke_dataset_z* dataset,
+                                       toke_encoder_z* encoder,
+                                       const char* prefix,
+                                       size_t max_threads);
+
+  /**
+   * @brief Gets the number of shards written by the last write.
+   * */
+  size_t toke_shard_writer_num_shards(const toke_shard_writer_z* self);
+
+  /**
+   * @brief Gets the number of documents written by the last write.
+   * */
+  size_t toke_shard_writer_num_documents(const toke_shard_writer_z* self);
+
+  /**
+   * @brief Gets the number of tokens written by the last write, across every shard.
+   * */
+  size_t toke_shard_writer_num_tokens(const toke_shard_writer_z* self);
+
+  /**
+   * @brief Reads the shards written by a @ref toke_shard_writer_z, which are mapped rather than read into memory.
+   *
+   * @details The tokens handed out point into the mappings, so they stay valid until the shards are closed or
+   *          reopened.
+   * */
+  typedef struct toke_token_shards toke_token_shards_z;
+
+  toke_token_shards_z* toke_token_shards_new();
+
+  void toke_token_shards_delete(toke_token_shards_z* self);
+
+  /**
+   * @brief Opens the index named after the prefix, and the shards that it lists.
+   *
+   * @return @ref TOKE_ERROR_FILE_NOT_FOUND if a file is missing, or @ref TOKE_ERROR_SHARD_FORMAT if the index is
+   *         malformed, was written on a machine with another byte order or doesn't match the size of a shard.
+   * */
+  toke_error_z toke_token_shards_open(toke_token_shards_z* self, const char* prefix);
+
+  size_t toke_token_shards_num_shards(const toke_token_shards_z* self);
+
+  size_t toke_token_shards_num_documents(const toke_token_shards_z* self);
+
+  size_t toke_token_shards_num_tokens(const toke_token_shards_z* self);
+
+  /**
+   * @brief Gets the tokens of a shard.
+   *
+   * @return The shard's first token, or null if the index is out of range or the shard is empty.
+   * */
+  const uint16_t* toke_token_shards_get_shard(const toke_token_shards_z* self, size_t index, size_t* num_tokens);
+
+  /**
+   * @brief Gets the tokens of a document, and optionally where it came from in the dataset.
+   *
+   * @param file_index If not null, set to the index that the dataset walk gave the document.
+   *
+   * @param offset If not null, set to where the document starts in its file, which is only non-zero for a chunk.
+   *
+   * @return The document's first token, or null if the index is out of range or the document is empty.
+   * */
+  const uint16_t* toke_token_shards_get_document(const toke_token_shards_z* self,
+                                                 size_t index,
+                                                 size_t* num_tokens,
+                                                 size_t* file_index,
+                                                 size_t* offset);
+
+  /**
+   * @brief Counts the places a window of the given size fits, which is every start in a shard that leaves enough
+   *        tokens after it. Windows never span two shards.
+   * */
+  size_t toke_token_shards_num_windows(const toke_token_shards_z* self, size_t window_size);
+
+  /**
+   * @brief Draws windows uniformly from the places they fit, and copies their tokens out.
+   *
+   * @details For next token prediction, a window is usually one token longer than the sequence being trained on, so
+   *          that the inputs and targets are both slices of it. The same state always draws the same windows.
+   *
+   * @param rng_state The state of the random number generator, which is advanced by the draws. Any value makes a
+   *                  good seed.
+   *
+   * @param output Where the windows are copied to, one after the other, which must hold count * window_size tokens.
+   *               If null, the windows are only drawn, which together with the starts is enough to find them.
+   *
+   * @param starts If not null, set to the position of each window in the concatenation of the shards.
+   *
+   * @return @ref TOKE_ERROR_BUFFER_SIZE if no shard is as large as a window, or @ref TOKE_ERROR_MEMORY_ALLOCATION.
+   * */
+  toke_error_z toke_token_shards_sample(const toke_token_shards_z* self,
+                                        size_t window_size,
+                                        size_t count,
+                                        uint64_t* rng_state,
+                                        uint16_t* output,
+                                        uint64_t* starts);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
@@ -0,0 +1,341 @@
+/* Generated by scripts/generate_unicode_tables.py from Unicode 14.0.0. Do not edit. */
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+  /**
+   * @brief The blocks of the Unicode standard, in codepoint order. The surrogate blocks are left out, since their
+   *        codepoints can't be encoded.
+   * */
+  enum toke_unicode_block
+  {
+    TOKE_UNICODE_BLOCK_BASIC_LATIN,
+    TOKE_UNICODE_BLOCK_LATIN_1_SUPPLEMENT,
+    TOKE_UNICODE_BLOCK_LATIN_EXTENDED_A,
+    TOKE_UNICODE_BLOCK_LATIN_EXTENDED_B,
+    TOKE_UNICODE_BLOCK_IPA_EXTENSIONS,
+    TOKE_UNICODE_BLOCK_SPACING_MODIFIER_LETTERS,
+    TOKE_UNICODE_BLOCK_COMBINING_DIACRITICAL_MARKS,
+    TOKE_UNICODE_BLOCK_GREEK_AND_COPTIC,
+    TOKE_UNICODE_BLOCK_CYRILLIC,
+    TOKE_UNICODE_BLOCK_CYRILLIC_SUPPLEMENT,
+    TOKE_UNICODE_BLOCK_ARMENIAN,
+    TOKE_UNICODE_BLOCK_HEBREW,
+    TOKE_UNICODE_BLOCK_ARABIC,
+    TOKE_UNICODE_BLOCK_SYRIAC,
+    TOKE_UNICODE_BLOCK_ARABIC_SUPPLEMENT,
+    TOKE_UNICODE_BLOCK_THAANA,
+    TOKE_UNICODE_BLOCK_NKO,
+    TOKE_UNICODE_BLOCK_SAMARITAN,
+    TOKE_UNICODE_BLOCK_MANDAIC,
+    TOKE_UNICODE_BLOCK_SYRIAC_SUPPLEMENT,
+    TOKE_UNICODE_BLOCK_ARABIC_EXTENDED_B,
+    TOKE_UNICODE_BLOCK_ARABIC_EXTENDED_A,
+    TOKE_UNICODE_BLOCK_DEVANAGARI,
+    TOKE_UNICODE_BLOCK_BENGALI,
+    TOKE_UNICODE_BLOCK_GURMUKHI,
+    TOKE_UNICODE_BLOCK_GUJARATI,
+    TOKE_UNICODE_BLOCK_ORIYA,
+    TOKE_UNICODE_BLOCK_TAMIL,
+    TOKE_UNICODE_BLOCK_TELUGU,
+    TOKE_UNICODE_BLOCK_KANNADA,
+    TOKE_UNICODE_BLOCK_MALAYALAM,
+    TOKE_UNICODE_BLOCK_SINHALA,
+    TOKE_UNICODE_BLOCK_THAI,
+    TOKE_UNICODE_BLOCK_LAO,
+    TOKE_UNICODE_BLOCK_TIBETAN,
+    TOKE_UNICODE_BLOCK_MYANMAR,
+    TOKE_UNICODE_BLOCK_GEORGIAN,
+    TOKE_UNICODE_BLOCK_HANGUL_JAMO,
+    TOKE_UNICODE_BLOCK_ETHIOPIC,
+    TOKE_UNICODE_BLOCK_ETHIOPIC_SUPPLEMENT,
+    TOKE_UNICODE_BLOCK_CHEROKEE,
+    TOKE_UNICODE_BLOCK_UNIFIED_CANADIAN_ABORIGINAL_SYLLABICS,
+    TOKE_UNICODE_BLOCK_OGHAM,
+    TOKE_UNICODE_BLOCK_RUNIC,
+    TOKE_UNICODE_BLOCK_TAGALOG,
+    TOKE_UNICODE_BLOCK_HANUNOO,
+    TOKE_UNICODE_BLOCK_BUHID,
+    TOKE_UNICODE_BLOCK_TAGBANWA,
+    TOKE_UNICODE_BLOCK_KHMER,
+    TOKE_UNICODE_BLOCK_MONGOLIAN,
+    TOKE_UNICODE_BLOCK_UNIFIED_CANADIAN_ABORIGINAL_SYLLABICS_EXTENDED,
+    TOKE_UNICODE_BLOCK_LIMBU,
+    TOKE_UNICODE_BLOCK_TAI_LE,
+    TOKE_UNICODE_BLOCK_NEW_TAI_LUE,
+    TOKE_UNICODE_BLOCK_KHMER_SYMBOLS,
+    TOKE_UNICODE_BLOCK_BUGINESE,
+    TOKE_UNICODE_BLOCK_TAI_THAM,
+    TOKE_UNICODE_BLOCK_COMBINING_DIACRITICAL_MARKS_EXTENDED,
+    TOKE_UNICODE_BLOCK_BALINESE,
+    TOKE_UNICODE_BLOCK_SUNDANESE,
+    TOKE_UNICODE_BLOCK_BATAK,
+    TOKE_UNICODE_BLOCK_LEPCHA,
+    TOKE_UNICODE_BLOCK_OL_CHIKI,
+    TOKE_UNICODE_BLOCK_CYRILLIC_EXTENDED_C,
+    TOKE_UNICODE_BLOCK_GEORGIAN_EXTENDED,
+    TOKE_UNICODE_BLOCK_SUNDANESE_SUPPLEMENT,
+    TOKE_UNICODE_BLOCK_VEDIC_EXTENSIONS,
+    TOKE_UNICODE_BLOCK_PHONETIC_EXTENSIONS,
+    TOKE_UNICODE_BLOCK_PHONETIC_EXTENSIONS_SUPPLEMENT,
+    TOKE_UNICODE_BLOCK_COMBINING_DIACRITICAL_MARKS_SUPPLEMENT,
+    TOKE_UNICODE_BLOCK_LATIN_EXTENDED_ADDITIONAL,
+    TOKE_UNICODE_BLOCK_GREEK_EXTENDED,
+    TOKE_UNICODE_BLOCK_GENERAL_PUNCTUATION,
+    TOKE_UNICODE_BLOCK_SUPERSCRIPTS_AND_SUBSCRIPTS,
+    TOKE_UNICODE_BLOCK_CURRENCY_SYMBOLS,
+    TOKE_UNICODE_BLOCK_COMBINING_DIACRITICAL_MARKS_FOR_SYMBOLS,
+    TOKE_UNICODE_BLOCK_LETTERLIKE_SYMBOLS,
+    TOKE_UNICODE_BLOCK_NUMBER_FORMS,
+    TOKE_UNICODE_BLOCK_ARROWS,
+    TOKE_UNICODE_BLOCK_MATHEMATICAL_OPERATORS,
+    TOKE_UNICODE_BLOCK_MISCELLANEOUS_TECHNICAL,
+    TOKE_UNICODE_BLOCK_CONTROL_PICTURES,
+    TOKE_UNICODE_BLOCK_OPTICAL_CHARACTER_RECOGNITION,
+    TOKE_UNICODE_BLOCK_ENCLOSED_ALPHANUMERICS,
+    TOKE_UNICODE_BLOCK_BOX_DRAWING,
+    TOKE_UNICODE_BLOCK_BLOCK_ELEMENTS,
+    TOKE_UNICODE_BLOCK_GEOMETRIC_SHAPES,
+    TOKE_UNICODE_BLOCK_MISCELLANEOUS_SYMBOLS,
+    TOKE_UNICODE_BLOCK_DINGBATS,
+    TOKE_UNICODE_BLOCK_MISCELLANEOUS_MATHEMATICAL_SYMBOLS_A,
+    TOKE_UNICODE_BLOCK_SUPPLEMENTAL_ARROWS_A,
+    TOKE_UNICODE_BLOCK_BRAILLE_PATTERNS,
+    TOKE_UNICODE_BLOCK_SUPPLEMENTAL_ARROWS_B,
+    TOKE_UNICODE_BLOCK_MISCELLANEOUS_MATHEMATICAL_SYMBOLS_B,
+    TOKE_UNICODE_BLOCK_SUPPLEMENTAL_MATHEMATICAL_OPERATORS,
+    TOKE_UNICODE_BLOCK_MISCELLANEOUS_SYMBOLS_AND_ARROWS,
+    TOKE_UNICODE_BLOCK_GLAGOLITIC,
+    TOKE_UNICODE_BLOCK_LATIN_EXTENDED_C,
+    TOKE_UNICODE_BLOCK_COPTIC,
+    TOKE_UNICODE_BLOCK_GEORGIAN_SUPPLEMENT,
+    TOKE_UNICODE_BLOCK_TIFINAGH,
+    TOKE_UNICODE_BLOCK_ETHIOPIC_EXTENDED,
+    TOKE_UNICODE_BLOCK_CYRILLIC_EXTENDED_A,
+    TOKE_UNICODE_BLOCK_SUPPLEMENTAL_PUNCTUATION,
+    TOKE_UNICODE_BLOCK_CJK_RADICALS_SUPPLEMENT,
+    TOKE_UNICODE_BLOCK_KANGXI_RADICALS,
+    TOKE_UNICODE_BLOCK_IDEOGRAPHIC_DESCRIPTION_CHARACTERS,
+    TOKE_UNICODE_BLOCK_CJK_SYMBOLS_AND_PUNCTUATION,
+    TOKE_UNICODE_BLOCK_HIRAGANA,
+    TOKE_UNICODE_BLOCK_KATAKANA,
+    TOKE_UNICODE_BLOCK_BOPOMOFO,
+    TOKE_UNICODE_BLOCK_HANGUL_COMPATIBILITY_JAMO,
+    TOKE_UNICODE_BLOCK_KANBUN,
+    TOKE_UNICODE_BLOCK_BOPOMOFO_EXTENDED,
+    TOKE_UNICODE_BLOCK_CJK_STROKES,
+    TOKE_UNICODE_BLOCK_KATAKANA_PHONETIC_EXTENSIONS,
+    TOKE_UNICODE_BLOCK_ENCLOSED_CJK_LETTERS_AND_MONTHS,
+    TOKE_UNICODE_BLOCK_CJK_COMPATIBILITY,
+    TOKE_UNICODE_BLOCK_CJK_UNIFIED_IDEOGRAPHS_EXTENSION_A,
+    TOKE_UNICODE_BLOCK_YIJING_HEXAGRAM_SYMBOLS,
+    TOKE_UNICODE_BLOCK_CJK_UNIFIED_IDEOGRAPHS,
+    TOKE_UNICODE_BLOCK_YI_SYLLABLES,
+    TOKE_UNICODE_BLOCK_YI_RADICALS,
+    TOKE_UNICODE_BLOCK_LISU,
+    TOKE_UNICODE_BLOCK_VAI,
+    TOKE_UNICODE_BLOCK_CYRILLIC_EXTENDED_B,
+    TOKE_UNICODE_BLOCK_BAMUM,
+    TOKE_UNICODE_BLOCK_MODIFIER_TONE_LETTERS,
+    TOKE_UNICODE_BLOCK_LATIN_EXTENDED_D,
+    TOKE_UNICODE_BLOCK_SYLOTI_NAGRI,
+    TOKE_UNICODE_BLOCK_COMMON_INDIC_NUMBER_FORMS,
+    TOKE_UNICODE_BLOCK_PHAGS_PA,
+    TOKE_UNICODE_BLOCK_SAURASHTRA,
+    TOKE_UNICODE_BLOCK_DEVANAGARI_EXTENDED,
+    TOKE_UNICODE_BLOCK_KAYAH_LI,
+    TOKE_UNICODE_BLOCK_REJANG,
+    TOKE_UNICODE_BLOCK_HANGUL_JAMO_EXTENDED_A,
+    TOKE_UNICODE_BLOCK_JAVANESE,
+    TOKE_UNICODE_BLOCK_MYANMAR_EXTENDED_B,
+    TOKE_UNICODE_BLOCK_CHAM,
+    TOKE_UNICODE_BLOCK_MYANMAR_EXTENDED_A,
+    TOKE_UNICODE_BLOCK_TAI_VIET,
+    TOKE_UNICODE_BLOCK_MEETEI_MAYEK_EXTENSIONS,
+    TOKE_UNICODE_BLOCK_ETHIOPIC_EXTENDED_A,
+    TOKE_UNICODE_BLOCK_LATIN_EXTENDED_E,
+    TOKE_UNICODE_BLOCK_CHEROKEE_SUPPLEMENT,
+    TOKE_UNICODE_BLOCK_MEETEI_MAYEK,
+    TOKE_UNICODE_BLOCK_HANGUL_SYLLABLES,
+    TOKE_UNICODE_BLOCK_HANGUL_JAMO_EXTENDED_B,
+    TOKE_UNICODE_BLOCK_PRIVATE_USE_AREA,
+    TOKE_UNICODE_BLOCK_CJK_COMPATIBILITY_IDEOGRAPHS,
+    TOKE_UNICODE_BLOCK_ALPHABETIC_PRESENTATION_FORMS,
+    TOKE_UNICODE_BLOCK_ARABIC_PRESENTATION_FORMS_A,
+    TOKE_UNICODE_BLOCK_VARIATION_SELECTORS,
+    TOKE_UNICODE_BLOCK_VERTICAL_FORMS,
+    TOKE_UNICODE_BLOCK_COMBINING_HALF_MARKS,
+    TOKE_UNICODE_BLOCK_CJK_COMPATIBILITY_FORMS,
+    TOKE_UNICODE_BLOCK_SMALL_FORM_VARIANTS,
+    TOKE_UNICODE_BLOCK_ARABIC_PRESENTATION_FORMS_B,
+    TOKE_UNICODE_BLOCK_HALFWIDTH_AND_FULLWIDTH_FORMS,
+    TOKE_UNICODE_BLOCK_SPECIALS,
+    TOKE_UNICODE_BLOCK_LINEAR_B_SYLLABARY,
+    TOKE_UNICODE_BLOCK_LINEAR_B_IDEOGRAMS,
+    TOKE_UNICODE_BLOCK_AEGEAN_NUMBERS,
+    TOKE_UNICODE_BLOCK_ANCIENT_GREEK_NUMBERS,
+    TOKE_UNICODE_BLOCK_ANCIENT_SYMBOLS,
+    TOKE_UNICODE_BLOCK_PHAISTOS_DISC,
+    TOKE_UNICODE_BLOCK_LYCIAN,
+    TOKE_UNICODE_BLOCK_CARIAN,
+    TOKE_UNICODE_BLOCK_COPTIC_EPACT_NUMBERS,
+    TOKE_UNICODE_BLOCK_OLD_ITALIC,
+    TOKE_UNICODE_BLOCK_GOTHIC,
+    TOKE_UNICODE_BLOCK_OLD_PERMIC,
+    TOKE_UNICODE_BLOCK_UGARITIC,
+    TOKE_UNICODE_BLOCK_OLD_PERSIAN,
+    TOKE_UNICODE_BLOCK_DESERET,
+    TOKE_UNICODE_BLOCK_SHAVIAN,
+    TOKE_UNICODE_BLOCK_OSMANYA,
+    TOKE_UNICODE_BLOCK_OSAGE,
+    TOKE_UNICODE_BLOCK_ELBASAN,
+    TOKE_UNICODE_BLOCK_CAUCASIAN_ALBANIAN,
+    TOKE_UNICODE_BLOCK_VITHKUQI,
+    TOKE_UNICODE_BLOCK_LINEAR_A,
+    TOKE_UNICODE_BLOCK_LATIN_EXTENDED_F,
+    TOKE_UNICODE_BLOCK_CYPRIOT_SYLLABARY,
+    TOKE_UNICODE_BLOCK_IMPERIAL_ARAMAIC,
+    TOKE_UNICODE_BLOCK_PALMYRENE,
+    TOKE_UNICODE_BLOCK_NABATAEAN,
+    TOKE_UNICODE_BLOCK_HATRAN,
+    TOKE_UNICODE_BLOCK_PHOENICIAN,
+    TOKE_UNICODE_BLOCK_LYDIAN,
+    TOKE_UNICODE_BLOCK_MEROITIC_HIEROGLYPHS,
+    TOKE_UNICODE_BLOCK_MEROITIC_CURSIVE,
+    TOKE_UNICODE_BLOCK_KHAROSHTHI,
+    TOKE_UNICODE_BLOCK_OLD_SOUTH_ARABIAN,
+    TOKE_UNICODE_BLOCK_OLD_NORTH_ARABIAN,
+    TOKE_UNICODE_BLOCK_MANICHAEAN,
+    TOKE_UNICODE_BLOCK_AVESTAN,
+    TOKE_UNICODE_BLOCK_INSCRIPTIONAL_PARTHIAN,
+    TOKE_UNICODE_BLOCK_INSCRIPTIONAL_PAHLAVI,
+    TOKE_UNICODE_BLOCK_PSALTER_PAHLAVI,
+    TOKE_UNICODE_BLOCK_OLD_TURKIC,
+    TOKE_UNICODE_BLOCK_OLD_HUNGARIAN,
+    TOKE_UNICODE_BLOCK_HANIFI_ROHINGYA,
+    TOKE_UNICODE_BLOCK_RUMI_NUMERAL_SYMBOLS,
+    TOKE_UNICODE_BLOCK_YEZIDI,
+    TOKE_UNICODE_BLOCK_OLD_SOGDIAN,
+    TOKE_UNICODE_BLOCK_SOGDIAN,
+    TOKE_UNICODE_BLOCK_OLD_UYGHUR,
+    TOKE_UNICODE_BLOCK_CHORASMIAN,
+    TOKE_UNICODE_BLOCK_ELYMAIC,
+    TOKE_UNICODE_BLOCK_BRAHMI,
+    TOKE_UNICODE_BLOCK_KAITHI,
+    TOKE_UNICODE_BLOCK_SORA_SOMPENG,
+    TOKE_UNICODE_BLOCK_CHAKMA,
+    TOKE_UNICODE_BLOCK_MAHAJANI,
+    TOKE_UNICODE_BLOCK_SHARADA,
+    TOKE_UNICODE_BLOCK_SINHALA_ARCHAIC_NUMBERS,
+    TOKE_UNICODE_BLOCK_KHOJKI,
+    TOKE_UNICODE_BLOCK_MULTANI,
+    TOKE_UNICODE_BLOCK_KHUDAWADI,
+    TOKE_UNICODE_BLOCK_GRANTHA,
+    TOKE_UNICODE_BLOCK_NEWA,
+    TOKE_UNICODE_BLOCK_TIRHUTA,
+    TOKE_UNICODE_BLOCK_SIDDHAM,
+    TOKE_UNICODE_BLOCK_MODI,
+    TOKE_UNICODE_BLOCK_MONGOLIAN_SUPPLEMENT,
+    TOKE_UNICODE_BLOCK_TAKRI,
+    TOKE_UNICODE_BLOCK_AHOM,
+    TOKE_UNICODE_BLOCK_DOGRA,
+    TOKE_UNICODE_BLOCK_WARANG_CITI,
+    TOKE_UNICODE_BLOCK_DIVES_AKURU,
+    TOKE_UNICODE_BLOCK_NANDINAGARI,
+    TOKE_UNICODE_BLOCK_ZANABAZAR_SQUARE,
+    TOKE_UNICODE_BLOCK_SOYOMBO,
+    TOKE_UNICODE_BLOCK_UNIFIED_CANADIAN_ABORIGINAL_SYLLABICS_EXTENDED_A,
+    TOKE_UNICODE_BLOCK_PAU_CIN_HAU,
+    TOKE_UNICODE_BLOCK_BHAIKSUKI,
+    TOKE_UNICODE_BLOCK_MARCHEN,
+    TOKE_UNICODE_BLOCK_MASARAM_GONDI,
+    TOKE_UNICODE_BLOCK_GUNJALA_GONDI,
+    TOKE_UNICODE_BLOCK_MAKASAR,
+    TOKE_UNICODE_BLOCK_LISU_SUPPLEMENT,
+    TOKE_UNICODE_BLOCK_TAMIL_SUPPLEMENT,
+    TOKE_UNICODE_BLOCK_CUNEIFORM,
+    TOKE_UNICODE_BLOCK_CUNEIFORM_NUMBERS_AND_PUNCTUATION,
+    TOKE_UNICODE_BLOCK_EARLY_DYNASTIC_CUNEIFORM,
+    TOKE_UNICODE_BLOCK_CYPRO_MINOAN,
+    TOKE_UNICODE_BLOCK_EGYPTIAN_HIEROGLYPHS,
+    TOKE_UNICODE_BLOCK_EGYPTIAN_HIEROGLYPH_FORMAT_CONTROLS,
+    TOKE_UNICODE_BLOCK_ANATOLIAN_HIEROGLYPHS,
+    TOKE_UNICODE_BLOCK_BAMUM_SUPPLEMENT,
+    TOKE_UNICODE_BLOCK_MRO,
+    TOKE_UNICODE_BLOCK_TANGSA,
+    TOKE_UNICODE_BLOCK_BASSA_VAH,
+    TOKE_UNICODE_BLOCK_PAHAWH_HMONG,
+    TOKE_UNICODE_BLOCK_MEDEFAIDRIN,
+    TOKE_UNICODE_BLOCK_MIAO,
+    TOKE_UNICODE_BLOCK_IDEOGRAPHIC_SYMBOLS_AND_PUNCTUATION,
+    TOKE_UNICODE_BLOCK_TANGUT,
+    TOKE_UNICODE_BLOCK_TANGUT_COMPONENTS,
+    TOKE_UNICODE_BLOCK_KHITAN_SMALL_SCRIPT,
+    TOKE_UNICODE_BLOCK_TANGUT_SUPPLEMENT,
+    TOKE_UNICODE_BLOCK_KANA_EXTENDED_B,
+    TOKE_UNICODE_BLOCK_KANA_SUPPLEMENT,
+    TOKE_UNICODE_BLOCK_KANA_EXTENDED_A,
+    TOKE_UNICODE_BLOCK_SMALL_KANA_EXTENSION,
+    TOKE_UNICODE_BLOCK_NUSHU,
+    TOKE_UNICODE_BLOCK_DUPLOYAN,
+    TOKE_UNICODE_BLOCK_SHORTHAND_FORMAT_CONTROLS,
+    TOKE_UNICODE_BLOCK_ZNAMENNY_MUSICAL_NOTATION,
+    TOKE_UNICODE_BLOCK_BYZANTINE_MUSICAL_SYMBOLS,
+    TOKE_UNICODE_BLOCK_MUSICAL_SYMBOLS,
+    TOKE_UNICODE_BLOCK_ANCIENT_GREEK_MUSICAL_NOTATION,
+    TOKE_UNICODE_BLOCK_MAYAN_NUMERALS,
+    TOKE_UNICODE_BLOCK_TAI_XUAN_JING_SYMBOLS,
+    TOKE_UNICODE_BLOCK_COUNTING_ROD_NUMERALS,
+    TOKE_UNICODE_BLOCK_MATHEMATICAL_ALPHANUMERIC_SYMBOLS,
+    TOKE_UNICODE_BLOCK_SUTTON_SIGNWRITING,
+    TOKE_UNICODE_BLOCK_LATIN_EXTENDED_G,
+    TOKE_UNICODE_BLOCK_GLAGOLITIC_SUPPLEMENT,
+    TOKE_UNICODE_BLOCK_NYIAKENG_PUACHUE_HMONG,
+    TOKE_UNICODE_BLOCK_TOTO,
+    TOKE_UNICODE_BLOCK_WANCHO,
+    TOKE_UNICODE_BLOCK_ETHIOPIC_EXTENDED_B,
+    TOKE_UNICODE_BLOCK_MENDE_KIKAKUI,
+    TOKE_UNICODE_BLOCK_ADLAM,
+    TOKE_UNICODE_BLOCK_INDIC_SIYAQ_NUMBERS,
+    TOKE_UNICODE_BLOCK_OTTOMAN_SIYAQ_NUMBERS,
+    TOKE_UNICODE_BLOCK_ARABIC_MATHEMATICAL_ALPHABETIC_SYMBOLS,
+    TOKE_UNICODE_BLOCK_MAHJONG_TILES,
+    TOKE_UNICODE_BLOCK_DOMINO_TILES,
+    TOKE_UNICODE_BLOCK_PLAYING_CARDS,
+    TOKE_UNICODE_BLOCK_ENCLOSED_ALPHANUMERIC_SUPPLEMENT,
+    TOKE_UNICODE_BLOCK_ENCLOSED_IDEOGRAPHIC_SUPPLEMENT,
+    TOKE_UNICODE_BLOCK_MISCELLANEOUS_SYMBOLS_AND_PICTOGRAPHS,
+    TOKE_UNICODE_BLOCK_EMOTICONS,
+    TOKE_UNICODE_BLOCK_ORNAMENTAL_DINGBATS,
+    TOKE_UNICODE_BLOCK_TRANSPORT_AND_MAP_SYMBOLS,
+    TOKE_UNICODE_BLOCK_ALCHEMICAL_SYMBOLS,
+    TOKE_UNICODE_BLOCK_GEOMETRIC_SHAPES_EXTENDED,
+    TOKE_UNICODE_BLOCK_SUPPLEMENTAL_ARROWS_C,
+    TOKE_UNICODE_BLOCK_SUPPLEMENTAL_SYMBOLS_AND_PICTOGRAPHS,
+    TOKE_UNICODE_BLOCK_CHESS_SYMBOLS,
+    TOKE_UNICODE_BLOCK_SYMBOLS_AND_PICTOGRAPHS_EXTENDED_A,
+    TOKE_UNICODE_BLOCK_SYMBOLS_FOR_LEGACY_COMPUTING,
+    TOKE_UNICODE_BLOCK_CJK_UNIFIED_IDEOGRAPHS_EXTENSION_B,
+    TOKE_UNICODE_BLOCK_CJK_UNIFIED_IDEOGRAPHS_EXTENSION_C,
+    TOKE_UNICODE_BLOCK_CJK_UNIFIED_IDEOGRAPHS_EXTENSION_D,
+    TOKE_UNICODE_BLOCK_CJK_UNIFIED_IDEOGRAPHS_EXTENSION_E,
+    TOKE_UNICODE_BLOCK_CJK_UNIFIED_IDEOGRAPHS_EXTENSION_F,
+    TOKE_UNICODE_BLOCK_CJK_COMPATIBILITY_IDEOGRAPHS_SUPPLEMENT,
+    TOKE_UNICODE_BLOCK_CJK_UNIFIED_IDEOGRAPHS_EXTENSION_G,
+    TOKE_UNICODE_BLOCK_TAGS,
+    TOKE_UNICODE_BLOCK_VARIATION_SELECTORS_SUPPLEMENT,
+    TOKE_UNICODE_BLOCK_SUPPLEMENTARY_PRIVATE_USE_AREA_A,
+    TOKE_UNICODE_BLOCK_SUPPLEMENTARY_PRIVATE_USE_AREA_B
+  };
+
+  typedef enum toke_unicode_block toke_unicode_block_z;
+
+#define TOKE_UNICODE_BLOCK_COUNT 317
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
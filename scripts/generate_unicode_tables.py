@@ -0,0 +1,559 @@
+#!/usr/bin/env python3
+"""
+Generates the Unicode tables used by the normalizer (src/unicode_data.h and src/unicode_data.c), the list of
+Unicode blocks (include/toke/unicode_blocks.h) and the normalization cases the tests check the normalizer against
+(testing/data/normalization_test.txt).
+
+The tables are derived from the unicodedata module, whose Unicode version has to be the one pinned below (Python 3.11
+has it), so that the output only depends on the inputs in the repository. The unicodedata module has no block property,
+so the blocks are read from the copy of Blocks.txt of the same version in scripts/ucd. Run it from the root of the
+repository:
+
+    python3 scripts/generate_unicode_tables.py [--blocks path/to/Blocks.txt]
+"""
+
+import argparse
+import os
+import random
+import re
+import sys
+import unicodedata
+
+# the version of the Unicode Character Database that the tables are generated from, which scripts/ucd has the files of
+UCD_VERSION = '14.0.0'
+
+MAX_CODEPOINT = 0x10FFFF
+
+HANGUL_S_BASE = 0xAC00
+HANGUL_S_COUNT = 11172
+HANGUL_V_BASE = 0x1161
+HANGUL_V_COUNT = 21
+HANGUL_T_BASE = 0x11A7
+HANGUL_T_COUNT = 28
+
+CCC_MASK = 0x00FF
+NFC_QC_NO = 0x0100
+NFC_QC_MAYBE = 0x0200
+NFKC_QC_NO = 0x0400
+NFKC_QC_MAYBE = 0x0800
+HAS_CANONICAL = 0x1000
+HAS_COMPAT = 0x2000
+
+
+def is_hangul_syllable(cp):
+    return HANGUL_S_BASE <= cp < HANGUL_S_BASE + HANGUL_S_COUNT
+
+
+def primary_composites():
+    """Maps (first, second) to the composite, for every canonical pair that NFC recomposes."""
+    pairs = {}
+    for cp in range(MAX_CODEPOINT + 1):
+        if is_hangul_syllable(cp):
+            continue
+        c = chr(cp)
+        raw = unicodedata.decomposition(c)
+        if not raw or raw.startswith('<'):
+            continue
+        parts = [int(p, 16) for p in raw.split()]
+        if len(parts) != 2:
+            continue
+        # composition exclusions and non-starter decompositions don't survive NFC
+        if unicodedata.normalize('NFC', c) != c:
+            continue
+        pairs[(parts[0], parts[1])] = cp
+    return pairs
+
+
+def build_properties(pairs):
+    maybe = set(second for (_, second) in pairs)
+    maybe.update(range(HANGUL_V_BASE, HANGUL_V_BASE + HANGUL_V_COUNT))
+    maybe.update(range(HANGUL_T_BASE + 1, HANGUL_T_BASE + HANGUL_T_COUNT))
+
+    props = [0] * (MAX_CODEPOINT + 1)
+    decompositions = []
+
+    for cp in range(MAX_CODEPOINT + 1):
+        c = chr(cp)
+        value = unicodedata.combining(c)
+
+        if unicodedata.normalize('NFC', c) != c:
+            value |= NFC_QC_NO
+        elif cp in maybe:
+            value |= NFC_QC_MAYBE
+
+        if unicodedata.normalize('NFKC', c) != c:
+            value |= NFKC_QC_NO
+        elif cp in maybe:
+            value |= NFKC_QC_MAYBE
+
+        if not is_hangul_syllable(cp):
+            nfd = unicodedata.normalize('NFD', c)
+            nfkd = unicodedata.normalize('NFKD', c)
+            if nfd != c:
+                value |= HAS_CANONICAL
+            if nfkd != c:
+                value |= HAS_COMPAT
+            if (nfd != c) or (nfkd != c):
+                decompositions.append((cp, [ord(x) for x in nfd], [ord(x) for x in nfkd]))
+
+        props[cp] = value
+
+    return props, decompositions
+
+
+def build_case_folding():
+    """
+    Maps each codepoint to its simple case folding.
+
+    Full foldings that expand to several codepoints fall back to the single codepoint lower case mapping (which is
+    what the simple folding is in those cases), or to no folding at all. Foldings whose UTF-8 form is longer than
+    the original are left out, so that folding never makes text longer.
+    """
+    folds = {}
+    for cp in range(MAX_CODEPOINT + 1):
+        if 0xD800 <= cp <= 0xDFFF:
+            continue
+        c = chr(cp)
+        folded = c.casefold()
+        if len(folded) != 1:
+            folded = c.lower()
+            if len(folded) != 1:
+                continue
+        if folded == c:
+            continue
+        if len(folded.encode('utf-8')) > len(c.encode('utf-8')):
+            continue
+        folds[cp] = ord(folded)
+    return folds
+
+
+def read_blocks(path):
+    """
+    Reads the first codepoint, last codepoint and name of each block.
+
+    The surrogate blocks are left out, since their codepoints have no UTF-8 form.
+    """
+    with open(path, encoding='utf-8') as f:
+        text = f.read()
+
+    version = re.search(r'Blocks-([0-9.]+)\.txt', text)
+    if not version or version.group(1) != UCD_VERSION:
+        raise RuntimeError('%s is from Unicode %s, but the tables are pinned to Unicode %s' %
+                           (path, version.group(1) if version else 'an unknown version', UCD_VERSION))
+
+    blocks = []
+    for line in text.splitlines():
+        line = line.split('#')[0].strip()
+        if not line:
+            continue
+        codepoints, name = [part.strip() for part in line.split(';')]
+        first, last = [int(cp, 16) for cp in codepoints.split('..')]
+        if 'Surrogates' in name:
+            continue
+        identifier = re.sub(r'[^A-Z0-9]+', '_', name.upper()).strip('_')
+        blocks.append((first, last, identifier))
+    return blocks
+
+
+def build_two_level(values, shift):
+    block_size = 1 << shift
+    # pad to a whole number of blocks, so that every block in the second stage is complete
+    values = list(values) + [0] * (-len(values) % block_size)
+    blocks = {}
+    stage1 = []
+    stage2 = []
+    for start in range(0, len(values), block_size):
+        block = tuple(values[start:start + block_size])
+        if block not in blocks:
+            blocks[block] = len(blocks)
+            stage2.extend(block)
+        stage1.append(blocks[block])
+    # the lookups index stage2 with any offset into a block, so a short last block would be read past its end
+    assert len(stage2) % block_size == 0
+    return stage1, stage2
+
+
+def smallest_two_level(values, stage2_width=2):
+    best = None
+    for shift in range(4, 12):
+        stage1, stage2 = build_two_level(values, shift)
+        size = 2 * len(stage1) + stage2_width * len(stage2)
+        if (best is None) or (size < best[0]):
+            best = (size, shift, stage1, stage2)
+    return best[1], best[2], best[3]
+
+
+def format_sequence(cps):
+    return ' '.join('%04X' % cp for cp in cps)
+
+
+def conformance_line(cps, comment):
+    """Formats a line of NormalizationTest.txt, with the source and its NFC, NFD, NFKC and NFKD forms."""
+    source = ''.join(chr(cp) for cp in cps)
+    fields = [source] + [unicodedata.normalize(form, source) for form in ('NFC', 'NFD', 'NFKC', 'NFKD')]
+    return '%s; # %s' % (';'.join(format_sequence([ord(c) for c in field]) for field in fields), comment)
+
+
+def build_conformance(pairs):
+    """
+    Builds a table in the format of NormalizationTest.txt, for the tests to check the normalizer against.
+
+    The first part has every codepoint that some form changes, or that isn't a starter, with every 37th Hangul syllable
+    standing in for the rest. The second part has canonical pairs, and sequences drawn with a fixed seed from starters,
+    combining marks, composites and jamo, so that marks are reordered, blocked and composed across each other.
+    """
+    lines = [
+        '# Derived from the unicodedata module of Python, Unicode %s, in the format of NormalizationTest.txt:' %
+        unicodedata.unidata_version,
+        '# source; NFC; NFD; NFKC; NFKD; # comment',
+        '# Generated by scripts/generate_unicode_tables.py. Do not edit.',
+        '',
+        '@Part1 # Single characters',
+    ]
+
+    marks = []
+    composites = []
+    for cp in range(MAX_CODEPOINT + 1):
+        if 0xD800 <= cp < 0xE000:
+            continue
+        c = chr(cp)
+        changed = any(unicodedata.normalize(form, c) != c for form in ('NFC', 'NFD', 'NFKC', 'NFKD'))
+        if not changed and not unicodedata.combining(c):
+            continue
+        if unicodedata.combining(c):
+            marks.append(cp)
+        elif unicodedata.normalize('NFC', c) == c and unicodedata.normalize('NFD', c) != c:
+            composites.append(cp)
+        if is_hangul_syllable(cp) and (cp - HANGUL_S_BASE) % 37 != 0:
+            continue
+        lines.append(conformance_line([cp], 'U+%04X' % cp))
+
+    lines.append('@Part2 # Canonical pairs')
+    for (first, second) in sorted(pairs):
+        lines.append(conformance_line([first, second], 'U+%04X U+%04X' % (first, second)))
+
+    lines.append('@Part3 # Sequences')
+    rng = random.Random(29)
+    starters = [0x41, 0x61, 0x45, 0x65, 0x4F, 0x6F, 0x55, 0x3B1, 0x3C9, 0x438, 0x915, 0x1100, 0x1161, 0x11A8, 0xAC00]
+    jamo = list(range(0x1100, 0x1113)) + list(range(HANGUL_V_BASE, HANGUL_V_BASE + HANGUL_V_COUNT)) + \
+        list(range(HANGUL_T_BASE + 1, HANGUL_T_BASE + HANGUL_T_COUNT))
+    pool = [starters, marks, marks, composites, jamo]
+    for _ in range(4000):
+        cps = [rng.choice(rng.choice(pool)) for _ in range(rng.randint(2, 8))]
+        lines.append(conformance_line(cps, 'sequence'))
+
+    return '\n'.join(lines) + '\n'
+
+
+def format_array(values, per_line, width):
+    lines = []
+    for i in range(0, len(values), per_line):
+        chunk = values[i:i + per_line]
+        lines.append('  ' + ', '.join(('0x%0' + str(width) + 'x') % v for v in chunk))
+    return ',\n'.join(lines)
+
+
+def format_blocks_header(blocks):
+    enumerators = ',\n'.join('    TOKE_UNICODE_BLOCK_%s' % name for (_, _, name) in blocks)
+    return '''/* Generated by scripts/generate_unicode_tables.py from Unicode %(version)s. Do not edit. */
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+  /**
+   * @brief The blocks of the Unicode standard, in codepoint order. The surrogate blocks are left out, since their
+   *        codepoints can't be encoded.
+   * */
+  enum toke_unicode_block
+  {
+%(enumerators)s
+  };
+
+  typedef enum toke_unicode_block toke_unicode_block_z;
+
+#define TOKE_UNICODE_BLOCK_COUNT %(count)d
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+''' % {
+        'version': unicodedata.unidata_version,
+        'enumerators': enumerators,
+        'count': len(blocks),
+    }
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Generates the Unicode tables.')
+    parser.add_argument('--blocks', help='A copy of Blocks.txt to use instead of the one in scripts/ucd.')
+    args = parser.parse_args()
+
+    if unicodedata.unidata_version != UCD_VERSION:
+        sys.stderr.write('unicodedata is from Unicode %s, but the tables are pinned to Unicode %s. Run this with a '
+                         'Python whose unicodedata has that version, such as Python 3.11.\n' %
+                         (unicodedata.unidata_version, UCD_VERSION))
+        return 1
+
+    root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    src_dir = os.path.join(root, 'src')
+    include_dir = os.path.join(root, 'include', 'toke')
+
+    blocks = read_blocks(args.blocks or os.path.join(root, 'scripts', 'ucd', UCD_VERSION, 'Blocks.txt'))
+
+    pairs = primary_composites()
+    props, decompositions = build_properties(pairs)
+    # everything past the last codepoint with properties reads as zero, so the tables don't need to cover it
+    limit = max(cp for cp in range(MAX_CODEPOINT + 1) if props[cp] != 0) + 1
+    shift, stage1, stage2 = smallest_two_level(props[:limit])
+
+    pool = []
+    decomposition_entries = []
+    for cp, nfd, nfkd in decompositions:
+        canonical_offset = len(pool)
+        if nfd != [cp]:
+            pool.extend(nfd)
+        compat_offset = canonical_offset
+        if nfkd != nfd:
+            compat_offset = len(pool)
+            pool.extend(nfkd)
+        canonical_size = len(nfd) if nfd != [cp] else 0
+        decomposition_entries.append((cp, canonical_offset, canonical_size, compat_offset, len(nfkd) if nfkd != [cp] else 0))
+
+    # composition never lengthens UTF-8, so the longest decomposition relative to its codepoint bounds the growth of
+    # any text, and Hangul syllables decompose into at most three jamo of the same width
+    def utf8_size(cps):
+        return sum(len(chr(c).encode('utf-8')) for c in cps)
+
+    nfc_expansion = max([3] + [-(-utf8_size(nfd) // utf8_size([cp])) for cp, nfd, _ in decompositions])
+    nfkc_expansion = max([3] + [-(-utf8_size(nfkd) // utf8_size([cp])) for cp, _, nfkd in decompositions])
+
+    compositions = sorted((first, second, composite) for (first, second), composite in pairs.items())
+
+    folds = build_case_folding()
+    fold_deltas = [0] + sorted(set(folded - cp for cp, folded in folds.items()))
+    fold_values = [0] * (max(folds) + 1)
+    for cp, folded in folds.items():
+        fold_values[cp] = fold_deltas.index(folded - cp)
+    fold_shift, fold_stage1, fold_stage2 = smallest_two_level(fold_values, stage2_width=1)
+    fold_leads = [0] * 32
+    for cp in folds:
+        lead = chr(cp).encode('utf-8')[0]
+        fold_leads[lead // 8] |= 1 << (lead % 8)
+
+    header = '''/* Generated by scripts/generate_unicode_tables.py from Unicode %(version)s. Do not edit. */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define TOKE_UNICODE_VERSION "%(version)s"
+
+/**
+ * @brief Property bits of each codepoint, found with @ref toke_unicode_props.
+ * */
+#define TOKE_UNICODE_CCC_MASK 0x%(ccc_mask)04x
+#define TOKE_UNICODE_NFC_QC_NO 0x%(nfc_qc_no)04x
+#define TOKE_UNICODE_NFC_QC_MAYBE 0x%(nfc_qc_maybe)04x
+#define TOKE_UNICODE_NFKC_QC_NO 0x%(nfkc_qc_no)04x
+#define TOKE_UNICODE_NFKC_QC_MAYBE 0x%(nfkc_qc_maybe)04x
+#define TOKE_UNICODE_HAS_CANONICAL 0x%(has_canonical)04x
+#define TOKE_UNICODE_HAS_COMPAT 0x%(has_compat)04x
+
+#define TOKE_UNICODE_PROPS_SHIFT %(shift)d
+
+/**
+ * @brief The most that normalizing can multiply the UTF-8 length of a text by.
+ * */
+#define TOKE_UNICODE_NFC_MAX_EXPANSION %(nfc_expansion)d
+#define TOKE_UNICODE_NFKC_MAX_EXPANSION %(nfkc_expansion)d
+
+/**
+ * @brief Codepoints at and above this have no properties.
+ * */
+#define TOKE_UNICODE_PROPS_LIMIT 0x%(limit)x
+
+struct toke_decomposition
+{
+  uint32_t codepoint;
+
+  uint16_t canonical_offset;
+
+  uint8_t canonical_size;
+
+  uint8_t compat_size;
+
+  uint16_t compat_offset;
+};
+
+struct toke_unicode_block_range
+{
+  uint32_t first;
+
+  uint32_t last;
+
+  const char* name;
+};
+
+struct toke_composition
+{
+  uint32_t first;
+
+  uint32_t second;
+
+  uint32_t composite;
+};
+
+#define TOKE_UNICODE_FOLD_SHIFT %(fold_shift)d
+
+/**
+ * @brief Codepoints at and above this have no case folding.
+ * */
+#define TOKE_UNICODE_FOLD_LIMIT 0x%(fold_limit)x
+
+extern const uint16_t toke_unicode_props_stage1[%(stage1_size)d];
+
+extern const uint16_t toke_unicode_props_stage2[%(stage2_size)d];
+
+/**
+ * @brief Full canonical and compatibility decompositions, sorted by codepoint. Hangul syllables are decomposed
+ *        algorithmically and are not listed.
+ * */
+extern const struct toke_decomposition toke_unicode_decompositions[%(decomposition_count)d];
+
+#define TOKE_UNICODE_DECOMPOSITION_COUNT %(decomposition_count)d
+
+extern const uint32_t toke_unicode_decomposition_pool[%(pool_size)d];
+
+/**
+ * @brief Primary composites, sorted by their first and second codepoints.
+ * */
+extern const struct toke_composition toke_unicode_compositions[%(composition_count)d];
+
+#define TOKE_UNICODE_COMPOSITION_COUNT %(composition_count)d
+
+extern const uint16_t toke_unicode_fold_stage1[%(fold_stage1_size)d];
+
+/**
+ * @brief Indices into @ref toke_unicode_fold_deltas. Index zero is the empty delta.
+ * */
+extern const uint8_t toke_unicode_fold_stage2[%(fold_stage2_size)d];
+
+extern const int32_t toke_unicode_fold_deltas[%(fold_delta_count)d];
+
+/**
+ * @brief A bit for each byte that leads the UTF-8 form of a codepoint with a case folding.
+ * */
+extern const uint8_t toke_unicode_fold_leads[32];
+
+/**
+ * @brief The codepoints and name of each @ref toke_unicode_block, indexed by the block.
+ * */
+extern const struct toke_unicode_block_range toke_unicode_blocks[%(block_count)d];
+
+static inline uint16_t
+toke_unicode_props(const uint32_t codepoint)
+{
+  if (codepoint >= TOKE_UNICODE_PROPS_LIMIT) {
+    return 0;
+  }
+
+  const uint32_t block = toke_unicode_props_stage1[codepoint >> TOKE_UNICODE_PROPS_SHIFT];
+
+  return toke_unicode_props_stage2[(block << TOKE_UNICODE_PROPS_SHIFT) |
+                                   (codepoint & ((1u << TOKE_UNICODE_PROPS_SHIFT) - 1))];
+}
+
+/**
+ * @brief Gets the simple case folding of a codepoint, which is never longer in UTF-8 than the codepoint itself.
+ * */
+static inline uint32_t
+toke_unicode_fold(const uint32_t codepoint)
+{
+  if (codepoint >= TOKE_UNICODE_FOLD_LIMIT) {
+    return codepoint;
+  }
+
+  const uint32_t block = toke_unicode_fold_stage1[codepoint >> TOKE_UNICODE_FOLD_SHIFT];
+
+  const uint8_t index =
+    toke_unicode_fold_stage2[(block << TOKE_UNICODE_FOLD_SHIFT) | (codepoint & ((1u << TOKE_UNICODE_FOLD_SHIFT) - 1))];
+
+  return (uint32_t)((int32_t)codepoint + toke_unicode_fold_deltas[index]);
+}
+''' % {
+        'version': unicodedata.unidata_version,
+        'ccc_mask': CCC_MASK,
+        'nfc_qc_no': NFC_QC_NO,
+        'nfc_qc_maybe': NFC_QC_MAYBE,
+        'nfkc_qc_no': NFKC_QC_NO,
+        'nfkc_qc_maybe': NFKC_QC_MAYBE,
+        'has_canonical': HAS_CANONICAL,
+        'has_compat': HAS_COMPAT,
+        'shift': shift,
+        'nfc_expansion': nfc_expansion,
+        'nfkc_expansion': nfkc_expansion,
+        'limit': len(stage1) << shift,
+        'stage1_size': len(stage1),
+        'stage2_size': len(stage2),
+        'decomposition_count': len(decomposition_entries),
+        'pool_size': len(pool),
+        'composition_count': len(compositions),
+        'fold_shift': fold_shift,
+        'fold_limit': len(fold_stage1) << fold_shift,
+        'fold_stage1_size': len(fold_stage1),
+        'fold_stage2_size': len(fold_stage2),
+        'fold_delta_count': len(fold_deltas),
+        'block_count': len(blocks),
+    }
+
+    source = []
+    source.append('/* Generated by scripts/generate_unicode_tables.py from Unicode %s. Do not edit. */\n' %
+                  unicodedata.unidata_version)
+    source.append('#include "unicode_data.h"\n')
+    source.append('const uint16_t toke_unicode_props_stage1[%d] = {\n%s\n};\n' %
+                  (len(stage1), format_array(stage1, 12, 4)))
+    source.append('const uint16_t toke_unicode_props_stage2[%d] = {\n%s\n};\n' %
+                  (len(stage2), format_array(stage2, 12, 4)))
+    source.append('const struct toke_decomposition toke_unicode_decompositions[%d] = {\n%s\n};\n' % (
+        len(decomposition_entries),
+        ',\n'.join('  { 0x%05x, %d, %d, %d, %d }' % (cp, c_off, c_size, k_size, k_off)
+                   for (cp, c_off, c_size, k_off, k_size) in decomposition_entries)))
+    source.append('const uint32_t toke_unicode_decomposition_pool[%d] = {\n%s\n};\n' %
+                  (len(pool), format_array(pool, 10, 5)))
+    source.append('const struct toke_composition toke_unicode_compositions[%d] = {\n%s\n};\n' % (
+        len(compositions),
+        ',\n'.join('  { 0x%05x, 0x%05x, 0x%05x }' % entry for entry in compositions)))
+
+    source.append('const uint16_t toke_unicode_fold_stage1[%d] = {\n%s\n};\n' %
+                  (len(fold_stage1), format_array(fold_stage1, 12, 4)))
+    source.append('const uint8_t toke_unicode_fold_stage2[%d] = {\n%s\n};\n' %
+                  (len(fold_stage2), format_array(fold_stage2, 16, 2)))
+    source.append('const int32_t toke_unicode_fold_deltas[%d] = {\n%s\n};\n' % (
+        len(fold_deltas), ',\n'.join('  %d' % d for d in fold_deltas)))
+    source.append('const uint8_t toke_unicode_fold_leads[32] = {\n%s\n};\n' % format_array(fold_leads, 16, 2))
+    source.append('const struct toke_unicode_block_range toke_unicode_blocks[%d] = {\n%s\n};\n' % (
+        len(blocks),
+        ',\n'.join('  { 0x%05x, 0x%05x, "%s" }' % block for block in blocks)))
+
+    with open(os.path.join(src_dir, 'unicode_data.h'), 'w') as f:
+        f.write(header)
+
+    with open(os.path.join(src_dir, 'unicode_data.c'), 'w') as f:
+        f.write('\n'.join(source))
+
+    with open(os.path.join(include_dir, 'unicode_blocks.h'), 'w') as f:
+        f.write(format_blocks_header(blocks))
+
+    with open(os.path.join(root, 'testing', 'data', 'normalization_test.txt'), 'w') as f:
+        f.write(build_conformance(pairs))
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
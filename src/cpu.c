@@ -0,0 +1,116 @@
+#include <toke/cpu.h>
+
+#include "kernels.h"
+
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const struct toke_kernels scalar_kernels = { .normalize_ascii = NULL, .decode = toke_decode_copy_scalar };
+
+#ifdef TOKE_X86_KERNELS
+
+static const struct toke_kernels sse2_kernels = { .normalize_ascii = toke_normalize_ascii_sse2,
+                                                  .decode = toke_decode_copy_sse2 };
+
+static const struct toke_kernels avx2_kernels = { .normalize_ascii = toke_normalize_ascii_avx2,
+                                                  .decode = toke_decode_copy_avx2 };
+
+static const struct toke_kernels avx512_kernels = { .normalize_ascii = toke_normalize_ascii_avx512,
+                                                    .decode = toke_decode_copy_avx2 };
+
+#endif /* TOKE_X86_KERNELS */
+
+/**
+ * @brief The selected level, or -1 if it has not been detected yet.
+ * */
+static atomic_int current_level = -1;
+
+static toke_cpu_level_z
+detect_level()
+{
+#ifdef TOKE_X86_KERNELS
+  __builtin_cpu_init();
+
+  if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")) {
+    return TOKE_CPU_LEVEL_AVX512;
+  }
+
+  if (__builtin_cpu_supports("avx2")) {
+    return TOKE_CPU_LEVEL_AVX2;
+  }
+
+  if (__builtin_cpu_supports("sse2")) {
+    return TOKE_CPU_LEVEL_SSE2;
+  }
+#endif
+
+  return TOKE_CPU_LEVEL_SCALAR;
+}
+
+static toke_cpu_level_z
+env_level(const toke_cpu_level_z default_level)
+{
+  const char* value = getenv("TOKE_CPU_LEVEL");
+  if (!value) {
+    return default_level;
+  }
+
+  if (strcmp(value, "scalar") == 0) {
+    return TOKE_CPU_LEVEL_SCALAR;
+  } else if (strcmp(value, "sse2") == 0) {
+    return TOKE_CPU_LEVEL_SSE2;
+  } else if (strcmp(value, "avx2") == 0) {
+    return TOKE_CPU_LEVEL_AVX2;
+  } else if (strcmp(value, "avx512") == 0) {
+    return TOKE_CPU_LEVEL_AVX512;
+  }
+
+  return default_level;
+}
+
+toke_cpu_level_z
+toke_cpu_set_level(const toke_cpu_level_z level)
+{
+  const toke_cpu_level_z supported = detect_level();
+
+  const toke_cpu_level_z selected = (level < supported) ? level : supported;
+
+  atomic_store_explicit(&current_level, (int)selected, memory_order_relaxed);
+
+  return selected;
+}
+
+toke_cpu_level_z
+toke_cpu_level()
+{
+  const int level = atomic_load_explicit(&current_level, memory_order_relaxed);
+  if (level >= 0) {
+    return (toke_cpu_level_z)level;
+  }
+
+  // Detection always gives the same answer, so it doesn't matter if two threads race to do it.
+  return toke_cpu_set_level(env_level(TOKE_CPU_LEVEL_AVX512));
+}
+
+const struct toke_kernels*
+toke_get_kernels()
+{
+  switch (toke_cpu_level()) {
+    case TOKE_CPU_LEVEL_SCALAR:
+      break;
+#ifdef TOKE_X86_KERNELS
+    case TOKE_CPU_LEVEL_SSE2:
+      return &sse2_kernels;
+    case TOKE_CPU_LEVEL_AVX2:
+      return &avx2_kernels;
+    case TOKE_CPU_LEVEL_AVX512:
+      return &avx512_kernels;
+#else
+    default:
+      break;
+#endif
+  }
+
+  return &scalar_kernels;
+}
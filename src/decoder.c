@@ -5,18 +5,23 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "kernels.h"
 #include "vocab.h"
 
-struct vocab_entry
-{
-  uint8_t* def;
+/**
+ * @brief The most tokens the decoder takes from a model, which is as many as the encoder assigns IDs to.
+ * */
+#define MAX_MODEL_TOKENS 65534
 
-  size_t size;
-};
+/**
+ * @brief The most bytes that the definitions of a model can take up, which is far more than any vocab needs, but keeps
+ *        a corrupt model from asking for most of memory.
+ * */
+#define MAX_MODEL_POOL_SIZE ((size_t)1 << 30)
 
 struct toke_decoder
 {
-  struct vocab_entry* vocab;
+  struct toke_decode_entry* vocab;
 
   size_t vocab_size;
 };
@@ -35,19 +40,47 @@ toke_decoder_new()
   return self;
 }
 
+static void
+clear_vocab(toke_decoder_z* self)
+{
+  for (size_t i = 0; i < self->vocab_size; i++) {
+    free(self->vocab[i].def);
+  }
+
+  free(self->vocab);
+
+  self->vocab = NULL;
+  self->vocab_size = 0;
+}
+
 void
 toke_decoder_delete(toke_decoder_z* self)
 {
   if (self) {
-    for (size_t i = 0; i < self->vocab_size; i++) {
-      free(self->vocab[i].def);
-    }
-    free(self->vocab);
+    clear_vocab(self);
   }
 
   free(self);
 }
 
+/**
+ * @brief Copies a definition into a new buffer, padded so that the decode kernels can read past its end.
+ * */
+static uint8_t*
+copy_def(const uint8_t* data, const size_t size)
+{
+  uint8_t* def = malloc((size < TOKE_DECODE_PADDING) ? TOKE_DECODE_PADDING : (size + 1));
+  if (!def) {
+    return NULL;
+  }
+
+  memcpy(def, data, size);
+
+  def[size] = 0;
+
+  return def;
+}
+
 static toke_error_z
 add_token_def(toke_decoder_z* self, const char* word, const size_t word_len)
 {
@@ -63,7 +96,7 @@ add_token_def(toke_decoder_z* self, const char* word, const size_t word_len)
     return TOKE_ERROR_MEMORY_ALLOCATION;
   }
 
-  const size_t new_size = (self->vocab_size + 1) * sizeof(struct vocab_entry);
+  const size_t new_size = (self->vocab_size + 1) * sizeof(struct toke_decode_entry);
 
   void* ptr = realloc(self->vocab, new_size);
   if (!ptr) {
@@ -71,17 +104,15 @@ add_token_def(toke_decoder_z* self, const char* word, const size_t word_len)
     return TOKE_ERROR_MEMORY_ALLOCATION;
   }
 
-  self->vocab = (struct vocab_entry*)ptr;
+  self->vocab = (struct toke_decode_entry*)ptr;
 
-  struct vocab_entry* entry = &self->vocab[self->vocab_size];
-  entry->def = malloc(pp_word_len + 1);
+  struct toke_decode_entry* entry = &self->vocab[self->vocab_size];
+  entry->def = copy_def(pp_word, pp_word_len);
   if (!entry->def) {
     free(pp_word);
     return TOKE_ERROR_MEMORY_ALLOCATION;
   }
 
-  memcpy(entry->def, pp_word, pp_word_len);
-  entry->def[pp_word_len] = 0;
   entry->size = pp_word_len;
 
   self->vocab_size++;
@@ -127,6 +158,59 @@ toke_decoder_parse_vocab(toke_decoder_z* self, const char* vocab, const size_t l
   return TOKE_ERROR_NONE;
 }
 
+toke_error_z
+toke_decoder_from_model(toke_decoder_z* self, const toke_model_z* model)
+{
+  clear_vocab(self);
+
+  const size_t model_size = toke_model_size(model);
+
+  if (model_size == 0) {
+    return TOKE_ERROR_NONE;
+  }
+
+  // as with the encoder, tokens past the last ID can't be told apart, so they are left out
+  const size_t num_tokens = (model_size < MAX_MODEL_TOKENS) ? model_size : MAX_MODEL_TOKENS;
+
+  // add up the padded copies first, so that nothing is allocated for a model that is too large
+  size_t pool_size = 0;
+
+  for (size_t i = 0; i < num_tokens; i++) {
+    // a loaded model's tokens are only checked as they are read
+    if (!toke_model_get_def(model, i)) {
+      return TOKE_ERROR_MODEL_FORMAT;
+    }
+    const size_t size = toke_model_get_size(model, i);
+    const size_t padded_size = (size < TOKE_DECODE_PADDING) ? TOKE_DECODE_PADDING : (size + 1);
+    if ((size >= MAX_MODEL_POOL_SIZE) || (padded_size > (MAX_MODEL_POOL_SIZE - pool_size))) {
+      return TOKE_ERROR_MODEL_FORMAT;
+    }
+    pool_size += padded_size;
+  }
+
+  self->vocab = malloc(num_tokens * sizeof(struct toke_decode_entry));
+  if (!self->vocab) {
+    return TOKE_ERROR_MEMORY_ALLOCATION;
+  }
+
+  for (size_t i = 0; i < num_tokens; i++) {
+
+    const size_t size = toke_model_get_size(model, i);
+
+    struct toke_decode_entry* entry = &self->vocab[i];
+    entry->def = copy_def(toke_model_get_def(model, i), size);
+    if (!entry->def) {
+      return TOKE_ERROR_MEMORY_ALLOCATION;
+    }
+
+    entry->size = size;
+
+    self->vocab_size++;
+  }
+
+  return TOKE_ERROR_NONE;
+}
+
 toke_error_z
 toke_decoder_load_vocab(toke_decoder_z* self, const char* filename)
 {
@@ -184,24 +268,15 @@ toke_decode(toke_decoder_z* self, const uint16_t* tokens, const size_t length, s
     out_length += self->vocab[token].size;
   }
 
-  char* result = malloc(out_length + 1);
+  // the kernels may write past the end of the text
+  char* result = malloc(out_length + TOKE_DECODE_PADDING);
   if (!result) {
     return NULL;
   }
 
-  size_t offset = 0;
+  const toke_decode_kernel decode = toke_get_kernels()->decode;
 
-  for (size_t i = 0; i < length; i++) {
-    const uint16_t token = tokens[i];
-    if (token >= self->vocab_size) {
-      result[offset] = '\x7f';
-      offset++;
-      continue;
-    }
-    const struct vocab_entry* entry = &self->vocab[token];
-    memcpy(result + offset, entry->def, entry->size);
-    offset += entry->size;
-  }
+  decode(self->vocab, self->vocab_size, tokens, length, (uint8_t*)result);
 
   result[out_length] = 0;
 
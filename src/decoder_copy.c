@@ -0,0 +1,27 @@
+#include "decoder_copy.h"
+
+#include <string.h>
+
+size_t
+toke_decode_copy_scalar(const struct toke_decode_entry* vocab,
+                        const size_t vocab_size,
+                        const uint16_t* tokens,
+                        const size_t length,
+                        uint8_t* dst)
+{
+  size_t offset = 0;
+
+  for (size_t i = 0; i < length; i++) {
+    const uint16_t token = tokens[i];
+    if (token >= vocab_size) {
+      dst[offset] = '\x7f';
+      offset++;
+      continue;
+    }
+    const struct toke_decode_entry* entry = &vocab[token];
+    memcpy(dst + offset, entry->def, entry->size);
+    offset += entry->size;
+  }
+
+  return offset;
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Token definitions are allocated with at least this many readable bytes, so that short ones can be copied
+ *        with a single vector load and store.
+ * */
+#define TOKE_DECODE_PADDING 32
+
+struct toke_decode_entry
+{
+  uint8_t* def;
+
+  size_t size;
+};
+
+/**
+ * @brief Writes the definitions of the tokens to the destination, using \x7f for tokens outside of the vocab.
+ *
+ * @details The destination must have @ref TOKE_DECODE_PADDING bytes of slack past the end of the decoded text.
+ *
+ * @return The number of bytes written, not counting the slack.
+ * */
+typedef size_t (*toke_decode_kernel)(const struct toke_decode_entry* vocab,
+                                     size_t vocab_size,
+                                     const uint16_t* tokens,
+                                     size_t length,
+                                     uint8_t* dst);
+
+size_t
+toke_decode_copy_scalar(const struct toke_decode_entry* vocab,
+                        size_t vocab_size,
+                        const uint16_t* tokens,
+                        size_t length,
+                        uint8_t* dst);
+
+size_t
+toke_decode_copy_sse2(const struct toke_decode_entry* vocab,
+                      size_t vocab_size,
+                      const uint16_t* tokens,
+                      size_t length,
+                      uint8_t* dst);
+
+size_t
+toke_decode_copy_avx2(const struct toke_decode_entry* vocab,
+                      size_t vocab_size,
+                      const uint16_t* tokens,
+                      size_t length,
+                      uint8_t* dst);
@@ -0,0 +1,43 @@
+#include "decoder_copy.h"
+
+#ifdef __AVX2__
+
+#include <immintrin.h>
+
+#include <string.h>
+
+size_t
+toke_decode_copy_avx2(const struct toke_decode_entry* vocab,
+                      const size_t vocab_size,
+                      const uint16_t* tokens,
+                      const size_t length,
+                      uint8_t* dst)
+{
+  size_t offset = 0;
+
+  for (size_t i = 0; i < length; i++) {
+
+    const uint16_t token = tokens[i];
+    if (token >= vocab_size) {
+      dst[offset] = '\x7f';
+      offset++;
+      continue;
+    }
+
+    const struct toke_decode_entry* entry = &vocab[token];
+
+    if (entry->size <= 32) {
+      // Both the definition and the destination are padded, so this may copy past the end of the token. The next
+      // token overwrites those bytes.
+      _mm256_storeu_si256((__m256i*)(dst + offset), _mm256_loadu_si256((const __m256i*)entry->def));
+    } else {
+      memcpy(dst + offset, entry->def, entry->size);
+    }
+
+    offset += entry->size;
+  }
+
+  return offset;
+}
+
+#endif /* __AVX2__ */
@@ -0,0 +1,46 @@
+#include "decoder_copy.h"
+
+#ifdef __SSE2__
+
+#include <emmintrin.h>
+
+#include <string.h>
+
+size_t
+toke_decode_copy_sse2(const struct toke_decode_entry* vocab,
+                      const size_t vocab_size,
+                      const uint16_t* tokens,
+                      const size_t length,
+                      uint8_t* dst)
+{
+  size_t offset = 0;
+
+  for (size_t i = 0; i < length; i++) {
+
+    const uint16_t token = tokens[i];
+    if (token >= vocab_size) {
+      dst[offset] = '\x7f';
+      offset++;
+      continue;
+    }
+
+    const struct toke_decode_entry* entry = &vocab[token];
+
+    if (entry->size <= 32) {
+      // Both the definition and the destination are padded, so this may copy past the end of the token. The next
+      // token overwrites those bytes.
+      const __m128i lo = _mm_loadu_si128((const __m128i*)entry->def);
+      const __m128i hi = _mm_loadu_si128((const __m128i*)(entry->def + 16));
+      _mm_storeu_si128((__m128i*)(dst + offset), lo);
+      _mm_storeu_si128((__m128i*)(dst + offset + 16), hi);
+    } else {
+      memcpy(dst + offset, entry->def, entry->size);
+    }
+
+    offset += entry->size;
+  }
+
+  return offset;
+}
+
+#endif /* __SSE2__ */
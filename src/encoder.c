@@ -274,6 +274,44 @@ toke_encoder_parse_vocab(toke_encoder_z* self, const char* vocab, const size_t l
   return TOKE_ERROR_NONE;
 }
 
+toke_error_z
+toke_encoder_from_model(toke_encoder_z* self, const toke_model_z* model)
+{
+  free_trie(&self->root);
+
+  for (size_t i = 0; i < 256; i++) {
+    self->root.nodes[i] = NULL;
+  }
+
+  self->root.token_id = INVALID_TOKEN_ID;
+
+  self->unknown_token_id = 0;
+
+  const size_t model_size = toke_model_size(model);
+
+  // as with text vocabs, leave one ID for unknown tokens
+  const size_t num_tokens = (model_size < (MAX_TOKEN_ID - 1)) ? model_size : (MAX_TOKEN_ID - 1);
+
+  for (size_t i = 0; i < num_tokens; i++) {
+
+    // a loaded model's tokens are only checked as they are read
+    const uint8_t* def = toke_model_get_def(model, i);
+    if (!def) {
+      return TOKE_ERROR_MODEL_FORMAT;
+    }
+
+    const toke_error_z err = add_token_def(self, def, toke_model_get_size(model, i), (uint32_t)i);
+
+    if (err != TOKE_ERROR_NONE) {
+      return err;
+    }
+  }
+
+  self->unknown_token_id = (uint32_t)num_tokens;
+
+  return TOKE_ERROR_NONE;
+}
+
 static uint32_t
 tokenize_once(const toke_encoder_z* self,
               const uint8_t* ptr,
@@ -366,3 +404,24 @@ toke_encode(toke_encoder_z* self, const void* text, const size_t length, size_t*
 
   return encode(self, text, length, out_length);
 }
+
+uint16_t*
+toke_encode_inplace(toke_encoder_z* self, void* text, const size_t length, size_t* out_length)
+{
+  if (self->normalizer) {
+
+    size_t filtered_len = 0;
+
+    const toke_error_z err = toke_normalize_inplace(self->normalizer, (char*)text, length, &filtered_len);
+    if (err == TOKE_ERROR_BUFFER_SIZE) {
+      // NFC or NFKC made the text longer than its buffer
+      return toke_encode(self, text, length, out_length);
+    } else if (err != TOKE_ERROR_NONE) {
+      return NULL;
+    }
+
+    return encode(self, text, filtered_len, out_length);
+  }
+
+  return encode(self, text, length, out_length);
+}
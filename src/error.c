@@ -18,6 +18,14 @@ toke_strerror(const toke_error_z err)
       return "filter syntax error";
     case TOKE_ERROR_INVALID_UNICODE:
       return "invalid unicode";
+    case TOKE_ERROR_BUFFER_SIZE:
+      return "buffer too small";
+    case TOKE_ERROR_MODEL_FORMAT:
+      return "invalid model file";
+    case TOKE_ERROR_UNSUPPORTED_COMPRESSION:
+      return "compression format not supported by this build";
+    case TOKE_ERROR_SHARD_FORMAT:
+      return "invalid token shards";
   }
 
   return "unknown error";
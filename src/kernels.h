@@ -0,0 +1,22 @@
+#pragma once
+
+#include <toke/cpu.h>
+
+#include "decoder_copy.h"
+#include "normalizer_ascii.h"
+
+/**
+ * @brief The implementations selected for the current CPU level.
+ * */
+struct toke_kernels
+{
+  /**
+   * @brief The ASCII fast path of the normalizer, or null if the scalar loop handles everything.
+   * */
+  toke_ascii_kernel normalize_ascii;
+
+  toke_decode_kernel decode;
+};
+
+const struct toke_kernels*
+toke_get_kernels();
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <toke/error.h>
+
+#include <stddef.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+  typedef struct toke_memmap toke_memmap_z;
+
+  enum toke_memmap_advice
+  {
+    /**
+     * @brief The range will be read in order, so the kernel can read ahead of it more aggressively.
+     * */
+    TOKE_MEMMAP_SEQUENTIAL,
+    /**
+     * @brief The range will be read in no particular order, so the kernel shouldn't read ahead of it.
+     * */
+    TOKE_MEMMAP_RANDOM,
+    /**
+     * @brief The range will be read soon, so the kernel can start reading it in now.
+     * */
+    TOKE_MEMMAP_WILLNEED,
+    /**
+     * @brief The range won't be read again soon, so its pages can be dropped. Reading it again is still fine, it just
+     *        has to come from the file again.
+     * */
+    TOKE_MEMMAP_DONTNEED
+  };
+
+  /**
+   * @brief Passes a hint about how a range of the file will be used. It never changes what the mapping reads as.
+   *
+   * @details The range is widened to whole pages. Platforms without the hints ignore them.
+   * */
+  void toke_memmap_advise(toke_memmap_z* self, size_t offset, size_t size, enum toke_memmap_advice advice);
+
+  toke_memmap_z* toke_memmap_open(const char* filename);
+
+  void toke_memmap_close(toke_memmap_z* self);
+
+  void* toke_memmap_ptr(const toke_memmap_z* self);
+
+  size_t toke_memmap_size(const toke_memmap_z* self);
+
+  /**
+   * @brief Opens a file to write the new contents of another to, so that a mapping of the old file (even one held by
+   *        the caller) is never truncated under it.
+   *
+   * @details On platforms with mappings, this is a temporary file next to the target, which
+   *          @ref toke_memmap_replace renames over it. Mappings of the old file keep reading the old contents until
+   *          they are closed.
+   *
+   * @param tmp_filename Set to the path of the temporary file, or null if the target is written in place. It is
+   *                     passed on to @ref toke_memmap_replace, which frees it.
+   *
+   * @return The file to write to, or null if it couldn't be created.
+   * */
+  FILE* toke_memmap_create(const char* filename, char** tmp_filename);
+
+  /**
+   * @brief Closes a file opened by @ref toke_memmap_create, and if it was written in full, puts it in place of the
+   *        target. Otherwise, the temporary file is removed and the target is left as it was.
+   *
+   * @param ok Non-zero if everything was written.
+   *
+   * @return @ref TOKE_ERROR_FILE_IO if writing, closing or renaming failed.
+   * */
+  toke_error_z toke_memmap_replace(FILE* file, char* tmp_filename, const char* filename, int ok);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
@@ -0,0 +1,100 @@
+#include "memmap.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/**
+ * @brief Stands in for a memory map on platforms without one, by reading the whole file into memory.
+ * */
+struct toke_memmap
+{
+  void* ptr;
+
+  size_t size;
+};
+
+toke_memmap_z*
+toke_memmap_open(const char* filename)
+{
+  FILE* file = fopen(filename, "rb");
+  if (!file) {
+    return NULL;
+  }
+
+  fseek(file, 0, SEEK_END);
+
+  const long int file_size = ftell(file);
+
+  fseek(file, 0, SEEK_SET);
+
+  toke_memmap_z* self = malloc(sizeof(toke_memmap_z));
+
+  void* ptr = (file_size >= 0L) ? malloc((size_t)file_size + 1) : NULL;
+
+  if (!self || !ptr || (fread(ptr, 1, (size_t)file_size, file) != (size_t)file_size)) {
+    fclose(file);
+    free(ptr);
+    free(self);
+    return NULL;
+  }
+
+  fclose(file);
+
+  self->ptr = ptr;
+  self->size = (size_t)file_size;
+
+  return self;
+}
+
+void
+toke_memmap_close(toke_memmap_z* self)
+{
+  if (self) {
+    free(self->ptr);
+  }
+  free(self);
+}
+
+void*
+toke_memmap_ptr(const toke_memmap_z* self)
+{
+  return self->ptr;
+}
+
+size_t
+toke_memmap_size(const toke_memmap_z* self)
+{
+  return self->size;
+}
+
+void
+toke_memmap_advise(toke_memmap_z* self, size_t offset, size_t size, const enum toke_memmap_advice advice)
+{
+  // the whole file is already in memory
+  (void)self;
+  (void)offset;
+  (void)size;
+  (void)advice;
+}
+
+FILE*
+toke_memmap_create(const char* filename, char** tmp_filename)
+{
+  // a stand-in map holds a copy of the file, so the file can be written in place
+  *tmp_filename = NULL;
+
+  return fopen(filename, "wb");
+}
+
+toke_error_z
+toke_memmap_replace(FILE* file, char* tmp_filename, const char* filename, int ok)
+{
+  (void)tmp_filename;
+  (void)filename;
+
+  if (fclose(file) != 0) {
+    ok = 0;
+  }
+
+  return ok ? TOKE_ERROR_NONE : TOKE_ERROR_FILE_IO;
+}
@@ -0,0 +1,178 @@
+#include "memmap.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+struct toke_memmap
+{
+  int fd;
+
+  struct stat stbuf;
+
+  void* ptr;
+};
+
+toke_memmap_z*
+toke_memmap_open(const char* filename)
+{
+  toke_memmap_z* self = malloc(sizeof(toke_memmap_z));
+  if (!self) {
+    return NULL;
+  }
+
+  self->fd = open(filename, O_RDONLY);
+  if (self->fd == -1) {
+    free(self);
+    return NULL;
+  }
+
+  if (fstat(self->fd, &self->stbuf) == -1) {
+    close(self->fd);
+    free(self);
+    return NULL;
+  }
+
+  // an empty file can't be mapped, but there is nothing to read from it anyway
+  if (self->stbuf.st_size == 0) {
+    self->ptr = NULL;
+    return self;
+  }
+
+  self->ptr = mmap(NULL, self->stbuf.st_size, PROT_READ, MAP_PRIVATE, self->fd, 0);
+  if (self->ptr == MAP_FAILED) {
+    close(self->fd);
+    free(self);
+    return NULL;
+  }
+
+  return self;
+}
+
+void
+toke_memmap_close(toke_memmap_z* self)
+{
+  if (self) {
+    if (self->ptr) {
+      munmap(self->ptr, self->stbuf.st_size);
+    }
+    close(self->fd);
+  }
+  free(self);
+}
+
+void*
+toke_memmap_ptr(const toke_memmap_z* self)
+{
+  return self->ptr;
+}
+
+size_t
+toke_memmap_size(const toke_memmap_z* self)
+{
+  return self->stbuf.st_size;
+}
+
+void
+toke_memmap_advise(toke_memmap_z* self, size_t offset, size_t size, const enum toke_memmap_advice advice)
+{
+  const size_t file_size = (size_t)self->stbuf.st_size;
+
+  if (offset >= file_size) {
+    return;
+  }
+
+  if (size > (file_size - offset)) {
+    size = file_size - offset;
+  }
+
+  // madvise needs a page aligned address, and the mapping starts on a page
+  const size_t page_size = (size_t)sysconf(_SC_PAGESIZE);
+
+  const size_t aligned_offset = offset - (offset % page_size);
+
+  size += offset - aligned_offset;
+
+  int flag = MADV_NORMAL;
+
+  switch (advice) {
+    case TOKE_MEMMAP_SEQUENTIAL:
+      flag = MADV_SEQUENTIAL;
+      break;
+    case TOKE_MEMMAP_RANDOM:
+      flag = MADV_RANDOM;
+      break;
+    case TOKE_MEMMAP_WILLNEED:
+      flag = MADV_WILLNEED;
+      break;
+    case TOKE_MEMMAP_DONTNEED:
+      flag = MADV_DONTNEED;
+      break;
+  }
+
+  // these are only hints, so a failure is no reason to stop
+  (void)madvise((uint8_t*)self->ptr + aligned_offset, size, flag);
+}
+
+FILE*
+toke_memmap_create(const char* filename, char** tmp_filename)
+{
+  const size_t filename_size = strlen(filename);
+
+  static const char suffix[] = ".XXXXXX";
+
+  *tmp_filename = malloc(filename_size + sizeof(suffix));
+  if (!*tmp_filename) {
+    return NULL;
+  }
+
+  memcpy(*tmp_filename, filename, filename_size);
+  memcpy(*tmp_filename + filename_size, suffix, sizeof(suffix));
+
+  const int fd = mkstemp(*tmp_filename);
+  if (fd < 0) {
+    free(*tmp_filename);
+    *tmp_filename = NULL;
+    return NULL;
+  }
+
+  // mkstemp only lets the owner read the file, so it takes the mode of the file it replaces, or the usual mode of a
+  // new file if there's nothing to replace
+  struct stat stbuf;
+  const mode_t mode = (stat(filename, &stbuf) == 0) ? (stbuf.st_mode & 0777) : 0644;
+
+  FILE* file = (fchmod(fd, mode) == 0) ? fdopen(fd, "wb") : NULL;
+  if (!file) {
+    close(fd);
+    remove(*tmp_filename);
+    free(*tmp_filename);
+    *tmp_filename = NULL;
+  }
+
+  return file;
+}
+
+toke_error_z
+toke_memmap_replace(FILE* file, char* tmp_filename, const char* filename, int ok)
+{
+  if (fclose(file) != 0) {
+    ok = 0;
+  }
+
+  if (ok && (rename(tmp_filename, filename) != 0)) {
+    ok = 0;
+  }
+
+  if (!ok) {
+    remove(tmp_filename);
+  }
+
+  free(tmp_filename);
+
+  return ok ? TOKE_ERROR_NONE : TOKE_ERROR_FILE_IO;
+}
@@ -1,8 +1,39 @@
 #include <toke/model.h>
 
+#include <stdint.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
+#include "memmap.h"
+#include "unicode_data.h"
+
+#define MODEL_FILE_MAGIC "TOKEMODL"
+
+#define MODEL_FILE_VERSION 1
+
+#define MODEL_FILE_BYTE_ORDER 0x01020304u
+
+/**
+ * @brief The start of a binary model file.
+ *
+ * @details The header is followed by (count + 1) 64-bit offsets into the pool, and then the pool, which holds each
+ *          token followed by a null terminator. Integers are in the byte order of the machine that wrote the file,
+ *          which the byte order field checks.
+ * */
+struct model_file_header
+{
+  char magic[8];
+
+  uint32_t version;
+
+  uint32_t byte_order;
+
+  uint64_t count;
+
+  uint64_t pool_size;
+};
+
 struct token_def
 {
   uint8_t* data;
@@ -12,9 +43,28 @@ struct token_def
 
 struct toke_model
 {
+  /**
+   * @brief The token definitions, kept sorted so that lookups and insertions can use a binary search.
+   * */
   struct token_def* defs;
 
   size_t num_defs;
+
+  size_t capacity;
+
+  /**
+   * @brief The mapped model file, if the model was loaded from one.
+   *
+   * @details Until the model is first changed, the tokens are read straight from the file and @ref defs is null.
+   *          After that the definitions still point into the file's pool rather than owning copies.
+   * */
+  toke_memmap_z* file;
+
+  const uint64_t* file_offsets;
+
+  const uint8_t* file_pool;
+
+  size_t file_pool_size;
 };
 
 toke_model_z*
@@ -27,18 +77,50 @@ toke_model_new()
 
   self->defs = NULL;
   self->num_defs = 0;
+  self->capacity = 0;
+  self->file = NULL;
+  self->file_offsets = NULL;
+  self->file_pool = NULL;
+  self->file_pool_size = 0;
 
   return self;
 }
 
+static int
+is_in_file(const toke_model_z* self, const uint8_t* data)
+{
+  const uintptr_t address = (uintptr_t)data;
+  const uintptr_t pool = (uintptr_t)self->file_pool;
+  return self->file && (address >= pool) && (address < (pool + self->file_pool_size));
+}
+
+static void
+clear_model(toke_model_z* self)
+{
+  for (size_t i = 0; self->defs && (i < self->num_defs); i++) {
+    if (!is_in_file(self, self->defs[i].data)) {
+      free(self->defs[i].data);
+    }
+  }
+
+  free(self->defs);
+
+  toke_memmap_close(self->file);
+
+  self->defs = NULL;
+  self->num_defs = 0;
+  self->capacity = 0;
+  self->file = NULL;
+  self->file_offsets = NULL;
+  self->file_pool = NULL;
+  self->file_pool_size = 0;
+}
+
 void
 toke_model_delete(toke_model_z* self)
 {
   if (self) {
-    for (size_t i = 0; i < self->num_defs; i++) {
-      free(self->defs[i].data);
-    }
-    free(self->defs);
+    clear_model(self);
   }
 
   free(self);
@@ -50,40 +132,21 @@ toke_model_size(const toke_model_z* self)
   return self->num_defs;
 }
 
-struct token_def_key
-{
-  const uint8_t* data;
-
-  size_t size;
-};
-
 static int
-cmp_token_defs_const(const void* l, const void* r)
+cmp_token_data(const uint8_t* l_data, const size_t l_size, const uint8_t* r_data, const size_t r_size)
 {
-  const struct token_def* l_tok = (const struct token_def*)l;
-  const struct token_def_key* key = (const struct token_def_key*)r;
-
-  const size_t min_size = l_tok->size < key->size ? l_tok->size : key->size;
+  const size_t min_size = l_size < r_size ? l_size : r_size;
 
-  const int cmp = memcmp(l_tok->data, key->data, min_size);
+  const int cmp = memcmp(l_data, r_data, min_size);
   if (cmp != 0) {
     return cmp;
   }
 
-  if (l_tok->size == key->size) {
+  if (l_size == r_size) {
     return 0;
   }
 
-  return (l_tok->size < key->size) ? -1 : 1;
-}
-
-static const struct token_def*
-find_token(const toke_model_z* self, const uint8_t* data, const size_t size)
-{
-  struct token_def_key key = { .data = data, .size = size };
-
-  return (const struct token_def*)bsearch(
-    &key, self->defs, self->num_defs, sizeof(struct token_def), cmp_token_defs_const);
+  return (l_size < r_size) ? -1 : 1;
 }
 
 static int
@@ -92,51 +155,271 @@ cmp_token_defs(const void* l, const void* r)
   const struct token_def* l_tok = (const struct token_def*)l;
   const struct token_def* r_tok = (const struct token_def*)r;
 
-  const size_t min_size = l_tok->size < r_tok->size ? l_tok->size : r_tok->size;
+  return cmp_token_data(l_tok->data, l_tok->size, r_tok->data, r_tok->size);
+}
 
-  const int cmp = memcmp(l_tok->data, r_tok->data, min_size);
-  if (cmp != 0) {
-    return cmp;
+static int
+is_sorted(const struct token_def* defs, const size_t count)
+{
+  for (size_t i = 1; i < count; i++) {
+    if (cmp_token_defs(&defs[i - 1], &defs[i]) > 0) {
+      return 0;
+    }
   }
 
-  if (l_tok->size == r_tok->size) {
-    return 0;
+  return 1;
+}
+
+/**
+ * @brief Finds the index of the first token that is not less than the given one.
+ *
+ * @param found Set to non-zero if the token at that index is equal to the given one.
+ * */
+static size_t
+lower_bound(const toke_model_z* self, const uint8_t* data, const size_t size, int* found)
+{
+  size_t first = 0;
+  size_t count = self->num_defs;
+
+  while (count > 0) {
+    const size_t step = count / 2;
+    const struct token_def* def = &self->defs[first + step];
+    if (cmp_token_data(def->data, def->size, data, size) < 0) {
+      first += step + 1;
+      count -= step + 1;
+    } else {
+      count = step;
+    }
   }
 
-  return (l_tok->size < r_tok->size) ? -1 : 1;
+  *found = (first < self->num_defs) &&
+           (cmp_token_data(self->defs[first].data, self->defs[first].size, data, size) == 0);
+
+  return first;
 }
 
-toke_error_z
-toke_model_add_token(toke_model_z* self, const uint8_t* data, const size_t size)
+/**
+ * @brief Makes room for more token definitions, growing the capacity geometrically.
+ * */
+static toke_error_z
+reserve_defs(toke_model_z* self, const size_t extra)
 {
-  if (find_token(self, data, size) != NULL) {
+  if ((self->num_defs + extra) <= self->capacity) {
     return TOKE_ERROR_NONE;
   }
 
-  struct token_def* defs = realloc(self->defs, (self->num_defs + 1) * sizeof(struct token_def));
+  size_t capacity = self->capacity ? self->capacity : 64;
+  while (capacity < (self->num_defs + extra)) {
+    capacity *= 2;
+  }
+
+  struct token_def* defs = realloc(self->defs, capacity * sizeof(struct token_def));
   if (!defs) {
     return TOKE_ERROR_MEMORY_ALLOCATION;
   }
 
   self->defs = defs;
+  self->capacity = capacity;
+
+  return TOKE_ERROR_NONE;
+}
+
+/**
+ * @brief Finds a token of a model that is still being read from its file.
+ *
+ * @details Loading only checks the ends of the pool, so each token is checked here as it is read: it has to lie inside
+ *          the pool, and end with the terminator that its size leaves room for.
+ *
+ * @return The token, or null if its offsets are malformed.
+ * */
+static const uint8_t*
+file_token(const toke_model_z* self, const size_t index, size_t* size)
+{
+  const uint64_t first = self->file_offsets[index];
+  const uint64_t last = self->file_offsets[index + 1];
+
+  if ((first >= last) || (last > self->file_pool_size) || (self->file_pool[last - 1] != 0)) {
+    return NULL;
+  }
+
+  *size = (size_t)(last - first - 1);
+
+  return self->file_pool + first;
+}
+
+/**
+ * @brief Builds the array of definitions for a model that is still being read from its file, so that it can be changed.
+ *
+ * @details Insertions rely on the definitions being sorted without repeats, which is checked here along with the
+ *          offsets of every token, since this reads all of them anyway.
+ *
+ * @return @ref TOKE_ERROR_MODEL_FORMAT if a token is malformed or out of order, in which case the model is left being
+ *         read from its file.
+ * */
+static toke_error_z
+unpack_file(toke_model_z* self)
+{
+  if (!self->file || self->defs || (self->num_defs == 0)) {
+    return TOKE_ERROR_NONE;
+  }
+
+  const toke_error_z err = reserve_defs(self, 0);
+  if (err != TOKE_ERROR_NONE) {
+    return err;
+  }
+
+  for (size_t i = 0; i < self->num_defs; i++) {
+
+    size_t size = 0;
+
+    // the pool isn't changed, it just isn't owned by the definitions
+    uint8_t* data = (uint8_t*)file_token(self, i, &size);
+
+    if (!data || ((i > 0) && (cmp_token_data(self->defs[i - 1].data, self->defs[i - 1].size, data, size) >= 0))) {
+      free(self->defs);
+      self->defs = NULL;
+      self->capacity = 0;
+      return TOKE_ERROR_MODEL_FORMAT;
+    }
+
+    self->defs[i].data = data;
+    self->defs[i].size = size;
+  }
 
+  return TOKE_ERROR_NONE;
+}
+
+static uint8_t*
+copy_token(const uint8_t* data, const size_t size)
+{
   uint8_t* tmp = malloc(size + 1);
   if (!tmp) {
-    return TOKE_ERROR_MEMORY_ALLOCATION;
+    return NULL;
   }
 
   memcpy(tmp, data, size);
 
   tmp[size] = 0;
 
-  struct token_def* def = &self->defs[self->num_defs];
+  return tmp;
+}
+
+toke_error_z
+toke_model_add_token(toke_model_z* self, const uint8_t* data, const size_t size)
+{
+  const toke_error_z unpack_err = unpack_file(self);
+  if (unpack_err != TOKE_ERROR_NONE) {
+    return unpack_err;
+  }
+
+  int found = 0;
+
+  const size_t index = lower_bound(self, data, size, &found);
+  if (found) {
+    return TOKE_ERROR_NONE;
+  }
+
+  const toke_error_z err = reserve_defs(self, 1);
+  if (err != TOKE_ERROR_NONE) {
+    return err;
+  }
+
+  uint8_t* tmp = copy_token(data, size);
+  if (!tmp) {
+    return TOKE_ERROR_MEMORY_ALLOCATION;
+  }
+
+  memmove(&self->defs[index + 1], &self->defs[index], (self->num_defs - index) * sizeof(struct token_def));
 
-  def->data = tmp;
-  def->size = size;
+  self->defs[index].data = tmp;
+  self->defs[index].size = size;
 
   self->num_defs++;
 
-  qsort(self->defs, self->num_defs, sizeof(struct token_def), cmp_token_defs);
+  return TOKE_ERROR_NONE;
+}
+
+toke_error_z
+toke_model_add_tokens(toke_model_z* self, const uint8_t* const* data, const size_t* sizes, const size_t count)
+{
+  if (count == 0) {
+    return TOKE_ERROR_NONE;
+  }
+
+  const toke_error_z unpack_err = unpack_file(self);
+  if (unpack_err != TOKE_ERROR_NONE) {
+    return unpack_err;
+  }
+
+  struct token_def* added = malloc(count * sizeof(struct token_def));
+  if (!added) {
+    return TOKE_ERROR_MEMORY_ALLOCATION;
+  }
+
+  for (size_t i = 0; i < count; i++) {
+    added[i].data = (uint8_t*)data[i];
+    added[i].size = sizes[i];
+  }
+
+  // Sort the new tokens once and merge them in, rather than paying for a search and a move per token.
+  if (!is_sorted(added, count)) {
+    qsort(added, count, sizeof(struct token_def), cmp_token_defs);
+  }
+
+  size_t num_added = 0;
+
+  for (size_t i = 0; i < count; i++) {
+
+    if ((num_added > 0) && (cmp_token_defs(&added[num_added - 1], &added[i]) == 0)) {
+      continue;
+    }
+
+    int found = 0;
+    lower_bound(self, added[i].data, added[i].size, &found);
+    if (!found) {
+      added[num_added] = added[i];
+      num_added++;
+    }
+  }
+
+  toke_error_z err = reserve_defs(self, num_added);
+
+  for (size_t i = 0; (err == TOKE_ERROR_NONE) && (i < num_added); i++) {
+    uint8_t* tmp = copy_token(added[i].data, added[i].size);
+    if (!tmp) {
+      for (size_t j = 0; j < i; j++) {
+        free(added[j].data);
+      }
+      err = TOKE_ERROR_MEMORY_ALLOCATION;
+      break;
+    }
+    added[i].data = tmp;
+  }
+
+  if (err != TOKE_ERROR_NONE) {
+    free(added);
+    return err;
+  }
+
+  // merge from the back, so that nothing is overwritten before it has been moved
+  size_t l = self->num_defs;
+  size_t r = num_added;
+  size_t out = self->num_defs + num_added;
+
+  while (r > 0) {
+    out--;
+    if ((l > 0) && (cmp_token_defs(&self->defs[l - 1], &added[r - 1]) > 0)) {
+      self->defs[out] = self->defs[l - 1];
+      l--;
+    } else {
+      self->defs[out] = added[r - 1];
+      r--;
+    }
+  }
+
+  self->num_defs += num_added;
+
+  free(added);
 
   return TOKE_ERROR_NONE;
 }
@@ -180,40 +463,195 @@ toke_model_add_codepoint(toke_model_z* self, const uint32_t codepoint)
 }
 
 toke_error_z
-toke_model_add_unicode_block(toke_model_z* self, const toke_unicode_block_z block)
+toke_model_add_codepoint_range(toke_model_z* self, const uint32_t first, const uint32_t last)
 {
+  if ((first > last) || (last > 0x10FFFF)) {
+    return TOKE_ERROR_INVALID_UNICODE;
+  }
+
+  const size_t count = (size_t)(last - first) + 1;
+
+  uint8_t* utf8 = malloc(count * 4);
+  const uint8_t** data = malloc(count * sizeof(const uint8_t*));
+  size_t* sizes = malloc(count * sizeof(size_t));
+
   toke_error_z err = TOKE_ERROR_NONE;
 
-  switch (block) {
-    case TOKE_UNICODE_BLOCK_BASIC_LATIN:
-      for (uint32_t codepoint = 0; codepoint <= 0x007f; codepoint++) {
-        err = toke_model_add_codepoint(self, codepoint);
-        if (err != TOKE_ERROR_NONE) {
-          break;
-        }
-      }
-      break;
-    case TOKE_UNICODE_BLOCK_GENERAL_PUNCTUATION:
-      for (uint32_t codepoint = 0x2000; codepoint <= 0x206f; codepoint++) {
-        err = toke_model_add_codepoint(self, codepoint);
-        if (err != TOKE_ERROR_NONE) {
-          break;
-        }
-      }
-      break;
+  if (!utf8 || !data || !sizes) {
+    err = TOKE_ERROR_MEMORY_ALLOCATION;
+  }
+
+  size_t num_tokens = 0;
+
+  for (size_t i = 0; (err == TOKE_ERROR_NONE) && (i < count); i++) {
+    const uint32_t codepoint = first + (uint32_t)i;
+    if ((codepoint >= 0xD800) && (codepoint <= 0xDFFF)) {
+      continue;
+    }
+    data[num_tokens] = utf8 + (num_tokens * 4);
+    sizes[num_tokens] = to_utf8(codepoint, utf8 + (num_tokens * 4));
+    num_tokens++;
+  }
+
+  // UTF-8 sorts in codepoint order, so the tokens are already sorted and the bulk insertion won't need to sort them
+  if (err == TOKE_ERROR_NONE) {
+    err = toke_model_add_tokens(self, data, sizes, num_tokens);
   }
 
+  free(sizes);
+  free(data);
+  free(utf8);
+
   return err;
 }
 
+toke_error_z
+toke_model_add_unicode_block(toke_model_z* self, const toke_unicode_block_z block)
+{
+  if (((int)block < 0) || ((int)block >= TOKE_UNICODE_BLOCK_COUNT)) {
+    return TOKE_ERROR_INVALID_UNICODE;
+  }
+
+  return toke_model_add_codepoint_range(self, toke_unicode_blocks[block].first, toke_unicode_blocks[block].last);
+}
+
+const char*
+toke_unicode_block_name(const toke_unicode_block_z block)
+{
+  if (((int)block < 0) || ((int)block >= TOKE_UNICODE_BLOCK_COUNT)) {
+    return NULL;
+  }
+
+  return toke_unicode_blocks[block].name;
+}
+
 const uint8_t*
 toke_model_get_def(const toke_model_z* self, const size_t index)
 {
-  return (index < self->num_defs) ? self->defs[index].data : NULL;
+  if (index >= self->num_defs) {
+    return NULL;
+  }
+
+  if (!self->defs) {
+    size_t size = 0;
+    return file_token(self, index, &size);
+  }
+
+  return self->defs[index].data;
 }
 
 size_t
 toke_model_get_size(const toke_model_z* self, const size_t index)
 {
-  return (index < self->num_defs) ? self->defs[index].size : 0;
+  if (index >= self->num_defs) {
+    return 0;
+  }
+
+  if (!self->defs) {
+    size_t size = 0;
+    return file_token(self, index, &size) ? size : 0;
+  }
+
+  return self->defs[index].size;
+}
+
+toke_error_z
+toke_model_save(const toke_model_z* self, const char* filename)
+{
+  // a malformed token of a loaded model has nothing to write, which is found before the target is touched
+  for (size_t i = 0; i < self->num_defs; i++) {
+    if (!toke_model_get_def(self, i)) {
+      return TOKE_ERROR_MODEL_FORMAT;
+    }
+  }
+
+  // the model may have been loaded from the same file, and still be reading its tokens from it
+  char* tmp_filename = NULL;
+
+  FILE* file = toke_memmap_create(filename, &tmp_filename);
+  if (!file) {
+    return TOKE_ERROR_FILE_IO;
+  }
+
+  struct model_file_header header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, MODEL_FILE_MAGIC, sizeof(header.magic));
+  header.version = MODEL_FILE_VERSION;
+  header.byte_order = MODEL_FILE_BYTE_ORDER;
+  header.count = self->num_defs;
+  header.pool_size = 0;
+
+  for (size_t i = 0; i < self->num_defs; i++) {
+    header.pool_size += toke_model_get_size(self, i) + 1;
+  }
+
+  int ok = fwrite(&header, sizeof(header), 1, file) == 1;
+
+  uint64_t offset = 0;
+
+  for (size_t i = 0; ok && (i < self->num_defs); i++) {
+    ok = fwrite(&offset, sizeof(offset), 1, file) == 1;
+    offset += toke_model_get_size(self, i) + 1;
+  }
+
+  ok = ok && (fwrite(&offset, sizeof(offset), 1, file) == 1);
+
+  for (size_t i = 0; ok && (i < self->num_defs); i++) {
+    // the null terminator is written too, so that loaded definitions can be used as strings like the in-memory ones
+    ok = fwrite(toke_model_get_def(self, i), toke_model_get_size(self, i) + 1, 1, file) == 1;
+  }
+
+  return toke_memmap_replace(file, tmp_filename, filename, ok);
+}
+
+toke_error_z
+toke_model_load(toke_model_z* self, const char* filename)
+{
+  toke_memmap_z* file = toke_memmap_open(filename);
+  if (!file) {
+    return TOKE_ERROR_FILE_NOT_FOUND;
+  }
+
+  const uint8_t* ptr = toke_memmap_ptr(file);
+
+  const size_t file_size = toke_memmap_size(file);
+
+  struct model_file_header header;
+
+  if (file_size < sizeof(header)) {
+    toke_memmap_close(file);
+    return TOKE_ERROR_MODEL_FORMAT;
+  }
+
+  memcpy(&header, ptr, sizeof(header));
+
+  const uint64_t offsets_size = (header.count + 1) * sizeof(uint64_t);
+
+  const uint64_t* offsets = (const uint64_t*)(ptr + sizeof(header));
+
+  const uint8_t* pool = ptr + sizeof(header) + offsets_size;
+
+  // Only what can be checked without reading every token is checked here, so that loading takes the same time
+  // whatever the size of the model. Each token is checked as it is read, and all of them are on the first change.
+  const int valid = (memcmp(header.magic, MODEL_FILE_MAGIC, sizeof(header.magic)) == 0) &&
+                    (header.version == MODEL_FILE_VERSION) && (header.byte_order == MODEL_FILE_BYTE_ORDER) &&
+                    (header.count < (file_size / sizeof(uint64_t))) && (header.pool_size <= file_size) &&
+                    ((sizeof(header) + offsets_size + header.pool_size) == file_size) && (offsets[0] == 0) &&
+                    (offsets[header.count] == header.pool_size) &&
+                    ((header.pool_size == 0) || (pool[header.pool_size - 1] == 0));
+
+  if (!valid) {
+    toke_memmap_close(file);
+    return TOKE_ERROR_MODEL_FORMAT;
+  }
+
+  clear_model(self);
+
+  self->file = file;
+  self->file_offsets = offsets;
+  self->file_pool = pool;
+  self->file_pool_size = (size_t)header.pool_size;
+  self->num_defs = (size_t)header.count;
+
+  return TOKE_ERROR_NONE;
 }
@@ -6,15 +6,32 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "kernels.h"
+#include "unicode.h"
+#include "unicode_data.h"
+
 enum flag
 {
   NORMALIZE_NEWLINES = 0x01,
   NORMALIZE_TABS = 0x02,
   RESTRICTED_ASCII = 0x04,
   LOWERCASE = 0x08,
-  UNICODE_SUBSTITUTES = 0x10
+  UNICODE_SUBSTITUTES = 0x10,
+  NFC = 0x20,
+  NFKC = 0x40
 };
 
+/**
+ * @brief The flags handled by the byte filters, which index the specialized scalar loops.
+ * */
+#define BYTE_FILTER_FLAGS (NORMALIZE_NEWLINES | NORMALIZE_TABS | RESTRICTED_ASCII | LOWERCASE | UNICODE_SUBSTITUTES)
+
+#if defined(__GNUC__)
+#define ALWAYS_INLINE inline __attribute__((always_inline))
+#else
+#define ALWAYS_INLINE inline
+#endif
+
 struct config
 {
   int flags;
@@ -28,11 +45,344 @@ default_config()
   return cfg;
 }
 
+/**
+ * @brief What to do with a byte, stored in the low bits of a byte table entry.
+ * */
+enum byte_action
+{
+  /**
+   * @brief Copy the byte, along with the rest of the sequence it starts.
+   * */
+  ACTION_COPY = 0,
+
+  /**
+   * @brief Emit the byte from the substitution byte map.
+   * */
+  ACTION_MAP = 1,
+
+  /**
+   * @brief Emit a line feed, consuming a line feed that may follow.
+   * */
+  ACTION_NEWLINE = 2,
+
+  /**
+   * @brief Emit \x7f in place of the sequence the byte starts.
+   * */
+  ACTION_INVALID = 3
+};
+
+#define ACTION_MASK 0x07
+
+#define SEQUENCE_SHIFT 3
+
+#define SEQUENCE_MASK 0x07
+
+/**
+ * @brief Set on lead bytes that may start an entry in the substitution map.
+ * */
+#define SUBSTITUTE_BIT 0x80
+
+/**
+ * @brief Set on lead bytes of codepoints that may have a case folding.
+ * */
+#define FOLD_BIT 0x40
+
+#define MAKE_ENTRY(action, sequence_size) ((uint8_t)((action) | ((sequence_size) << SEQUENCE_SHIFT)))
+
+#define ENTRY_ACTION(entry) ((entry) & ACTION_MASK)
+
+#define ENTRY_SEQUENCE_SIZE(entry) (((entry) >> SEQUENCE_SHIFT) & SEQUENCE_MASK)
+
+/**
+ * @brief Checks for a single byte that is copied or mapped, with nothing else to look up.
+ * */
+#define ENTRY_IS_SINGLE_BYTE(entry) (((entry) & ~ACTION_MAP) == MAKE_ENTRY(ACTION_COPY, 1))
+
+/**
+ * @brief Replaces one UTF-8 sequence with another that is no longer than it.
+ * */
+struct substitution
+{
+  /**
+   * @brief The bytes of the source sequence, packed in order starting at the low byte. Zero marks an empty slot.
+   * */
+  uint32_t key;
+
+  uint8_t size;
+
+  char text[4];
+};
+
+struct default_substitution
+{
+  const char* from;
+
+  char to;
+};
+
+static const struct default_substitution default_substitutions[] = {
+  { "\xe2\x80\x94", '-' },  // em dash
+  { "\xe2\x80\x93", '-' },  // en dash
+  { "\xe2\x80\x90", '-' },  // hyphen
+  { "\xe2\x80\x91", '-' },  // hyphen (non-breaking)
+  { "\xe2\x80\x9c", '"' },  // double quote
+  { "\xe2\x80\x9d", '"' },  // double quote
+  { "\xe2\x80\xb3", '"' },  // double quote
+  { "\xe2\x80\x98", '\'' }, // single quote
+  { "\xe2\x80\x99", '\'' }, // single quote
+  { "\xe2\x80\xb2", '\'' }, // single quote
+  { "\xe2\x80\xa2", '*' },  // bullet
+  { "\xe2\x80\xa3", '*' }   // bullet
+};
+
+/**
+ * @brief A scalar loop specialized for one combination of the byte filters.
+ * */
+typedef int (*scalar_kernel)(const toke_normalizer_z* normalizer,
+                             const uint8_t* src,
+                             size_t length,
+                             size_t src_end,
+                             int final,
+                             size_t* src_offset_ptr,
+                             uint8_t* dst,
+                             size_t* dst_offset_ptr);
+
+static scalar_kernel
+select_scalar_kernel(int flags);
+
 struct toke_normalizer
 {
   struct config config;
+
+  /**
+   * @brief One entry per byte value, combining the action and the size of the sequence the byte starts.
+   * */
+  uint8_t byte_table[256];
+
+  /**
+   * @brief The replacement for each byte whose action is @ref ACTION_MAP.
+   * */
+  uint8_t byte_map[256];
+
+  /**
+   * @brief An open addressing hash table of multi-byte substitutions.
+   * */
+  struct substitution* substitutions;
+
+  /**
+   * @brief The number of slots in the substitution table, minus one. The slot count is a power of two.
+   * */
+  size_t substitution_mask;
+
+  /**
+   * @brief Substitutions declared in the config. They are added to the table after the default ones, so they take
+   *        precedence over them.
+   * */
+  struct substitution* custom_substitutions;
+
+  size_t custom_count;
+
+  size_t custom_capacity;
+
+  /**
+   * @brief The parameters of the vectorized ASCII fast path.
+   * */
+  struct toke_ascii_filter ascii;
+
+  /**
+   * @brief The scalar loop for the enabled filters, picked when the tables are built.
+   * */
+  scalar_kernel scalar;
 };
 
+static size_t
+utf8_length(const uint8_t lead)
+{
+  if ((lead >> 5) == 0x06) {
+    return 2; // 110xxxxx
+  }
+
+  if ((lead >> 4) == 0x0e) {
+    return 3; // 1110xxxx
+  }
+
+  if ((lead >> 3) == 0x1e) {
+    return 4; // 11110xxx
+  }
+
+  return 1; // invalid lead byte
+}
+
+static uint8_t
+is_restricted_ascii(const uint8_t c)
+{
+  uint8_t value = 0;
+  value |= (c >= ' ') && (c <= '~');
+  value |= (c == '\r');
+  value |= (c == '\n');
+  value |= (c == '\t');
+  return value;
+}
+
+static uint32_t
+pack_sequence(const uint8_t* data, const size_t size)
+{
+  uint32_t key = 0;
+  for (size_t i = 0; i < size; i++) {
+    key |= ((uint32_t)data[i]) << (i * 8);
+  }
+  return key;
+}
+
+static size_t
+hash_key(const uint32_t key)
+{
+  return (size_t)((key * 0x9e3779b1u) >> 7);
+}
+
+static const struct substitution*
+find_substitution(const toke_normalizer_z* self, const uint32_t key)
+{
+  size_t slot = hash_key(key) & self->substitution_mask;
+
+  while (1) {
+    const struct substitution* sub = &self->substitutions[slot];
+    if (sub->key == key) {
+      return sub;
+    }
+    if (sub->key == 0) {
+      return NULL;
+    }
+    slot = (slot + 1) & self->substitution_mask;
+  }
+}
+
+static void
+insert_substitution(toke_normalizer_z* self, const uint32_t key, const char* text, const size_t size)
+{
+  size_t slot = hash_key(key) & self->substitution_mask;
+
+  while ((self->substitutions[slot].key != 0) && (self->substitutions[slot].key != key)) {
+    slot = (slot + 1) & self->substitution_mask;
+  }
+
+  struct substitution* sub = &self->substitutions[slot];
+  sub->key = key;
+  sub->size = (uint8_t)size;
+  memcpy(sub->text, text, size);
+}
+
+static toke_error_z
+build_substitutions(toke_normalizer_z* self)
+{
+  free(self->substitutions);
+  self->substitutions = NULL;
+  self->substitution_mask = 0;
+
+  const size_t default_count =
+    (self->config.flags & UNICODE_SUBSTITUTES) ? (sizeof(default_substitutions) / sizeof(default_substitutions[0])) : 0;
+
+  const size_t count = default_count + self->custom_count;
+
+  // keep the load factor at or below one half, so that probe sequences stay short
+  size_t slots = 1;
+  while (slots < (count * 2)) {
+    slots *= 2;
+  }
+
+  self->substitutions = calloc(slots, sizeof(struct substitution));
+  if (!self->substitutions) {
+    return TOKE_ERROR_MEMORY_ALLOCATION;
+  }
+
+  self->substitution_mask = slots - 1;
+
+  for (size_t i = 0; i < default_count; i++) {
+    const uint8_t* from = (const uint8_t*)default_substitutions[i].from;
+    const uint32_t key = pack_sequence(from, utf8_length(from[0]));
+    insert_substitution(self, key, &default_substitutions[i].to, 1);
+  }
+
+  for (size_t i = 0; i < self->custom_count; i++) {
+    const struct substitution* sub = &self->custom_substitutions[i];
+    insert_substitution(self, sub->key, sub->text, sub->size);
+  }
+
+  return TOKE_ERROR_NONE;
+}
+
+static void
+build_byte_tables(toke_normalizer_z* self)
+{
+  int flags = self->config.flags & ~UNICODE_SUBSTITUTES;
+
+  // only lead bytes of sequences in the substitution table need to look it up
+  uint8_t substitute_leads[256];
+  memset(substitute_leads, 0, sizeof(substitute_leads));
+
+  for (size_t i = 0; self->substitutions && (i <= self->substitution_mask); i++) {
+    const uint32_t key = self->substitutions[i].key;
+    if (key != 0) {
+      substitute_leads[key & 0xff] = 1;
+      flags |= UNICODE_SUBSTITUTES;
+    }
+  }
+
+  for (size_t i = 0; i < 256; i++) {
+
+    const uint8_t c = (uint8_t)i;
+
+    const size_t sequence_size = utf8_length(c);
+
+    uint8_t entry = MAKE_ENTRY(ACTION_COPY, sequence_size);
+
+    self->byte_map[i] = c;
+
+    if ((flags & NORMALIZE_NEWLINES) && (c == '\r')) {
+      entry = MAKE_ENTRY(ACTION_NEWLINE, 1);
+    } else if ((flags & NORMALIZE_TABS) && (c == '\t')) {
+      entry = MAKE_ENTRY(ACTION_MAP, 1);
+      self->byte_map[i] = ' ';
+    } else if ((flags & RESTRICTED_ASCII) && !is_restricted_ascii(c)) {
+      entry = MAKE_ENTRY(ACTION_INVALID, sequence_size);
+    } else if ((flags & LOWERCASE) && (c >= 'A') && (c <= 'Z')) {
+      entry = MAKE_ENTRY(ACTION_MAP, 1);
+      self->byte_map[i] = (uint8_t)(c + 32);
+    }
+
+    // substitutions take priority over the restricted ASCII filter, so lead bytes check the map first
+    if (substitute_leads[i]) {
+      entry |= SUBSTITUTE_BIT;
+    }
+
+    const uint8_t has_fold = (toke_unicode_fold_leads[c / 8] >> (c % 8)) & 1;
+
+    if ((flags & LOWERCASE) && (sequence_size > 1) && (ENTRY_ACTION(entry) == ACTION_COPY) && has_fold) {
+      entry |= FOLD_BIT;
+    }
+
+    self->byte_table[i] = entry;
+  }
+
+  self->ascii.reject_char = (flags & NORMALIZE_NEWLINES) ? '\r' : 0xff;
+  self->ascii.tab_char = (flags & NORMALIZE_TABS) ? '\t' : 0xff;
+  self->ascii.lowercase_offset = (flags & LOWERCASE) ? 0x20 : 0x00;
+  self->ascii.restricted_mask = (flags & RESTRICTED_ASCII) ? 0xff : 0x00;
+
+  self->scalar = select_scalar_kernel(flags);
+}
+
+static toke_error_z
+build_tables(toke_normalizer_z* self)
+{
+  const toke_error_z err = build_substitutions(self);
+
+  // the byte table marks the lead bytes that are in the substitution table, so it is built second
+  build_byte_tables(self);
+
+  return err;
+}
+
 toke_normalizer_z*
 toke_normalizer_new()
 {
@@ -42,6 +392,16 @@ toke_normalizer_new()
   }
 
   self->config = default_config();
+  self->substitutions = NULL;
+  self->substitution_mask = 0;
+  self->custom_substitutions = NULL;
+  self->custom_count = 0;
+  self->custom_capacity = 0;
+
+  if (build_tables(self) != TOKE_ERROR_NONE) {
+    toke_normalizer_delete(self);
+    return NULL;
+  }
 
   return self;
 }
@@ -49,6 +409,11 @@ toke_normalizer_new()
 void
 toke_normalizer_delete(toke_normalizer_z* self)
 {
+  if (self) {
+    free(self->substitutions);
+    free(self->custom_substitutions);
+  }
+
   free(self);
 }
 
@@ -63,11 +428,141 @@ find_char(const char* config, const size_t length, const size_t offset, const ch
   return length;
 }
 
-toke_error_z
-toke_normalizer_parse_config(toke_normalizer_z* self, const char* config, const size_t length)
+static int
+parse_hex_digit(const char c, uint32_t* digit)
 {
-  self->config = default_config();
+  if ((c >= '0') && (c <= '9')) {
+    *digit = (uint32_t)(c - '0');
+  } else if ((c >= 'a') && (c <= 'f')) {
+    *digit = (uint32_t)(c - 'a' + 10);
+  } else if ((c >= 'A') && (c <= 'F')) {
+    *digit = (uint32_t)(c - 'A' + 10);
+  } else {
+    return 0;
+  }
+  return 1;
+}
+
+/**
+ * @brief Parses a codepoint written as "U+" and one to six hex digits, moving the offset past it.
+ *
+ * @return Zero if the text at the offset is not a valid codepoint.
+ * */
+static int
+parse_codepoint(const char* text, const size_t length, size_t* offset_ptr, uint32_t* codepoint)
+{
+  size_t offset = *offset_ptr;
+
+  if (((offset + 2) > length) || (text[offset] != 'U') || (text[offset + 1] != '+')) {
+    return 0;
+  }
+
+  offset += 2;
+
+  uint32_t value = 0;
+
+  size_t digits = 0;
+
+  uint32_t digit = 0;
+
+  while ((offset < length) && (digits < 6) && parse_hex_digit(text[offset], &digit)) {
+    value = (value << 4) | digit;
+    digits++;
+    offset++;
+  }
+
+  if ((digits == 0) || (value > 0x10ffff) || ((value >= 0xd800) && (value <= 0xdfff))) {
+    return 0;
+  }
+
+  *offset_ptr = offset;
+  *codepoint = value;
+
+  return 1;
+}
+
+/**
+ * @brief Parses a substitution of the form "U+2026:U+002E U+002E U+002E", which maps a non-ASCII codepoint to zero
+ *        or more codepoints separated by spaces.
+ *
+ * @details The replacement may not be longer than the codepoint in UTF-8, so that normalizing never makes the text
+ *          longer. The replacement is not filtered any further.
+ * */
+static toke_error_z
+parse_substitution(toke_normalizer_z* self, const char* value, const size_t length)
+{
+  size_t offset = 0;
+
+  uint32_t codepoint = 0;
+
+  if (!parse_codepoint(value, length, &offset, &codepoint) || (codepoint < 0x80)) {
+    return TOKE_ERROR_FILTER_SYNTAX;
+  }
+
+  if ((offset >= length) || (value[offset] != ':')) {
+    return TOKE_ERROR_FILTER_SYNTAX;
+  }
+
+  offset++;
+
+  uint8_t from[4];
 
+  const size_t from_size = toke_utf8_encode(codepoint, from);
+
+  struct substitution sub;
+  sub.key = pack_sequence(from, from_size);
+  sub.size = 0;
+
+  for (size_t count = 0; offset < length; count++) {
+
+    if (count > 0) {
+      if (value[offset] != ' ') {
+        return TOKE_ERROR_FILTER_SYNTAX;
+      }
+      offset++;
+    }
+
+    uint32_t replacement = 0;
+
+    if (!parse_codepoint(value, length, &offset, &replacement)) {
+      return TOKE_ERROR_FILTER_SYNTAX;
+    }
+
+    uint8_t utf8[4];
+
+    const size_t size = toke_utf8_encode(replacement, utf8);
+
+    if ((sub.size + size) > from_size) {
+      return TOKE_ERROR_FILTER_SYNTAX;
+    }
+
+    memcpy(sub.text + sub.size, utf8, size);
+
+    sub.size += (uint8_t)size;
+  }
+
+  if (self->custom_count == self->custom_capacity) {
+
+    const size_t capacity = self->custom_capacity ? (self->custom_capacity * 2) : 16;
+
+    struct substitution* subs = realloc(self->custom_substitutions, capacity * sizeof(struct substitution));
+    if (!subs) {
+      return TOKE_ERROR_MEMORY_ALLOCATION;
+    }
+
+    self->custom_substitutions = subs;
+    self->custom_capacity = capacity;
+  }
+
+  self->custom_substitutions[self->custom_count] = sub;
+  self->custom_count++;
+
+  return TOKE_ERROR_NONE;
+}
+
+static toke_error_z
+parse_flags(toke_normalizer_z* self, const char* config, const size_t length)
+{
   size_t prop_start = 0;
 
   while (prop_start < length) {
@@ -139,216 +634,602 @@ toke_normalizer_parse_config(toke_normalizer_z* self, const char* config, const
       }
     }
 
+    if (MATCH_KEY("nfc")) {
+      if (MATCH_VALUE("true")) {
+        self->config.flags |= NFC;
+      } else if (MATCH_VALUE("false")) {
+        self->config.flags &= ~NFC;
+      } else {
+        return TOKE_ERROR_FILTER_SYNTAX;
+      }
+    }
+
+    if (MATCH_KEY("nfkc")) {
+      if (MATCH_VALUE("true")) {
+        self->config.flags |= NFKC;
+      } else if (MATCH_VALUE("false")) {
+        self->config.flags &= ~NFKC;
+      } else {
+        return TOKE_ERROR_FILTER_SYNTAX;
+      }
+    }
+
+    if (MATCH_KEY("substitute")) {
+      if (key_end >= prop_end) {
+        return TOKE_ERROR_FILTER_SYNTAX;
+      }
+      const toke_error_z err = parse_substitution(self, value, value_len);
+      if (err != TOKE_ERROR_NONE) {
+        return err;
+      }
+    }
+
     prop_start = prop_end + 1;
   }
 
   return TOKE_ERROR_NONE;
 }
 
-static uint8_t
-is_restricted_ascii(const char c)
+toke_error_z
+toke_normalizer_parse_config(toke_normalizer_z* self, const char* config, const size_t length)
 {
-  uint8_t value = 0;
-  value |= (c >= ' ') && (c <= '~');
-  value |= (c == '\r');
-  value |= (c == '\n');
-  value |= (c == '\t');
-  return value;
+  self->config = default_config();
+
+  self->custom_count = 0;
+
+  const toke_error_z parse_err = parse_flags(self, config, length);
+
+  // the tables always follow the flags, even if only part of the config was understood
+  const toke_error_z build_err = build_tables(self);
+
+  return (parse_err != TOKE_ERROR_NONE) ? parse_err : build_err;
 }
 
-static size_t
-utf8_length(const char c)
+/**
+ * @brief Normalizes the input until at least @p src_end is reached.
+ *
+ * @details A carriage return right before @p src_end may consume the line feed after it. If more input may follow
+ *          (@p final is zero), a sequence cut off by the end of the input, or a carriage return at the very end, is
+ *          left for the next call.
+ *
+ *          This is always inlined with constant @p flags, so each combination of the byte filters gets a loop with
+ *          the checks for the other filters compiled out.
+ *
+ * @return Zero if it stopped early to wait for more input.
+ * */
+static ALWAYS_INLINE int
+normalize_scalar(const toke_normalizer_z* normalizer,
+                 const uint8_t* src,
+                 const size_t length,
+                 const size_t src_end,
+                 const int final,
+                 size_t* src_offset_ptr,
+                 uint8_t* dst,
+                 size_t* dst_offset_ptr,
+                 const int flags)
 {
-  const uint8_t lead = *(const uint8_t*)&c;
+  const uint8_t* byte_table = normalizer->byte_table;
 
-  if ((lead >> 5) == 0x06) {
-    return 2; // 110xxxxx
+  const uint8_t* byte_map = normalizer->byte_map;
+
+  size_t src_offset = *src_offset_ptr;
+  size_t dst_offset = *dst_offset_ptr;
+
+  while (src_offset < src_end) {
+
+    const uint8_t c = src[src_offset];
+    const uint8_t entry = byte_table[c];
+
+    if (ENTRY_IS_SINGLE_BYTE(entry)) {
+      // the map is the identity for bytes that are copied, so both actions are the same lookup
+      dst[dst_offset] = (flags & (NORMALIZE_TABS | LOWERCASE)) ? byte_map[c] : c;
+      dst_offset++;
+      src_offset++;
+      continue;
+    }
+
+    const size_t remaining = length - src_offset;
+
+    size_t code_len = ENTRY_SEQUENCE_SIZE(entry);
+
+    const int is_newline = (flags & NORMALIZE_NEWLINES) && (ENTRY_ACTION(entry) == ACTION_NEWLINE);
+
+    if (!final && ((code_len > remaining) || (is_newline && (remaining == 1)))) {
+      *src_offset_ptr = src_offset;
+      *dst_offset_ptr = dst_offset;
+      return 0;
+    }
+
+    if (code_len > remaining) {
+      // truncated sequence at the end of the input
+      code_len = remaining;
+    }
+
+    if ((flags & UNICODE_SUBSTITUTES) && (entry & SUBSTITUTE_BIT)) {
+      const uint32_t key = pack_sequence(src + src_offset, code_len);
+      const struct substitution* sub = find_substitution(normalizer, key);
+      if (sub) {
+        memcpy(dst + dst_offset, sub->text, sub->size);
+        dst_offset += sub->size;
+        src_offset += code_len;
+        continue;
+      }
+    }
+
+    if ((flags & LOWERCASE) && (entry & FOLD_BIT)) {
+      uint32_t codepoint = 0;
+      const size_t size = toke_utf8_decode(src + src_offset, remaining, &codepoint);
+      const uint32_t folded = toke_unicode_fold(codepoint);
+      if (size && (folded != codepoint)) {
+        // folding never makes a codepoint longer, so this stays within the input length
+        dst_offset += toke_utf8_encode(folded, dst + dst_offset);
+        src_offset += size;
+        continue;
+      }
+    }
+
+    if (is_newline) {
+      dst[dst_offset] = '\n';
+      dst_offset++;
+      src_offset++;
+      if ((remaining > 1) && (src[src_offset] == '\n')) {
+        src_offset++;
+      }
+    } else if ((flags & RESTRICTED_ASCII) && (ENTRY_ACTION(entry) == ACTION_INVALID)) {
+      dst[dst_offset] = '\x7f';
+      dst_offset++;
+      src_offset += code_len;
+    } else {
+      // normal condition
+      for (size_t i = 0; i < code_len; i++) {
+        dst[dst_offset + i] = src[src_offset + i];
+      }
+      dst_offset += code_len;
+      src_offset += code_len;
+    }
   }
 
-  if ((lead >> 4) == 0x0e) {
-    return 3; // 1110xxxx
+  *src_offset_ptr = src_offset;
+  *dst_offset_ptr = dst_offset;
+
+  return 1;
+}
+
+#define DEFINE_SCALAR_KERNEL(flags)                                                                                    \
+  static int normalize_scalar_##flags(const toke_normalizer_z* normalizer,                                             \
+                                      const uint8_t* src,                                                              \
+                                      const size_t length,                                                             \
+                                      const size_t src_end,                                                            \
+                                      const int final,                                                                 \
+                                      size_t* src_offset_ptr,                                                          \
+                                      uint8_t* dst,                                                                    \
+                                      size_t* dst_offset_ptr)                                                          \
+  {                                                                                                                    \
+    return normalize_scalar(                                                                                           \
+      normalizer, src, length, src_end, final, src_offset_ptr, dst, dst_offset_ptr, flags);                            \
   }
 
-  if ((lead >> 3) == 0x1e) {
-    return 4; // 11110xxx
+DEFINE_SCALAR_KERNEL(0)
+DEFINE_SCALAR_KERNEL(1)
+DEFINE_SCALAR_KERNEL(2)
+DEFINE_SCALAR_KERNEL(3)
+DEFINE_SCALAR_KERNEL(4)
+DEFINE_SCALAR_KERNEL(5)
+DEFINE_SCALAR_KERNEL(6)
+DEFINE_SCALAR_KERNEL(7)
+DEFINE_SCALAR_KERNEL(8)
+DEFINE_SCALAR_KERNEL(9)
+DEFINE_SCALAR_KERNEL(10)
+DEFINE_SCALAR_KERNEL(11)
+DEFINE_SCALAR_KERNEL(12)
+DEFINE_SCALAR_KERNEL(13)
+DEFINE_SCALAR_KERNEL(14)
+DEFINE_SCALAR_KERNEL(15)
+DEFINE_SCALAR_KERNEL(16)
+DEFINE_SCALAR_KERNEL(17)
+DEFINE_SCALAR_KERNEL(18)
+DEFINE_SCALAR_KERNEL(19)
+DEFINE_SCALAR_KERNEL(20)
+DEFINE_SCALAR_KERNEL(21)
+DEFINE_SCALAR_KERNEL(22)
+DEFINE_SCALAR_KERNEL(23)
+DEFINE_SCALAR_KERNEL(24)
+DEFINE_SCALAR_KERNEL(25)
+DEFINE_SCALAR_KERNEL(26)
+DEFINE_SCALAR_KERNEL(27)
+DEFINE_SCALAR_KERNEL(28)
+DEFINE_SCALAR_KERNEL(29)
+DEFINE_SCALAR_KERNEL(30)
+DEFINE_SCALAR_KERNEL(31)
+
+#undef DEFINE_SCALAR_KERNEL
+
+static scalar_kernel
+select_scalar_kernel(const int flags)
+{
+  static const scalar_kernel kernels[BYTE_FILTER_FLAGS + 1] = {
+    normalize_scalar_0,  normalize_scalar_1,  normalize_scalar_2,  normalize_scalar_3,  normalize_scalar_4,
+    normalize_scalar_5,  normalize_scalar_6,  normalize_scalar_7,  normalize_scalar_8,  normalize_scalar_9,
+    normalize_scalar_10, normalize_scalar_11, normalize_scalar_12, normalize_scalar_13, normalize_scalar_14,
+    normalize_scalar_15, normalize_scalar_16, normalize_scalar_17, normalize_scalar_18, normalize_scalar_19,
+    normalize_scalar_20, normalize_scalar_21, normalize_scalar_22, normalize_scalar_23, normalize_scalar_24,
+    normalize_scalar_25, normalize_scalar_26, normalize_scalar_27, normalize_scalar_28, normalize_scalar_29,
+    normalize_scalar_30, normalize_scalar_31
+  };
+
+  return kernels[flags & BYTE_FILTER_FLAGS];
+}
+
+/**
+ * @brief Runs the byte filters over the input, which may be the same buffer as the output.
+ *
+ * @param final Whether this is the end of the text. If it isn't, the normalization stops before any bytes that
+ *              depend on what comes next.
+ *
+ * @param consumed_ptr Receives how much of the input was normalized. Without @p final, this can be less than the
+ *                     length of the input.
+ *
+ * @return The number of bytes written to the output.
+ * */
+static size_t
+normalize_part(const toke_normalizer_z* normalizer,
+               const uint8_t* src,
+               const size_t length,
+               const int final,
+               uint8_t* dst,
+               size_t* consumed_ptr)
+{
+  const toke_ascii_kernel ascii_kernel = toke_get_kernels()->normalize_ascii;
+
+  size_t src_offset = 0;
+  size_t dst_offset = 0;
+
+  while (src_offset < length) {
+
+    if (ascii_kernel) {
+      const size_t fast_size =
+        ascii_kernel(&normalizer->ascii, src + src_offset, length - src_offset, dst + dst_offset);
+      src_offset += fast_size;
+      dst_offset += fast_size;
+    }
+
+    // The kernel stopped at a block it can't handle (or at the tail of the input), so step over it with the
+    // scalar loop before trying the kernel again.
+    const size_t remaining = length - src_offset;
+    const size_t src_end = src_offset + ((remaining < TOKE_ASCII_BLOCK_SIZE) ? remaining : TOKE_ASCII_BLOCK_SIZE);
+
+    if (!normalizer->scalar(normalizer, src, length, src_end, final, &src_offset, dst, &dst_offset)) {
+      break;
+    }
   }
 
-  return 1; // invalid lead byte
+  *consumed_ptr = src_offset;
+
+  return dst_offset;
+}
+
+static size_t
+normalize(const toke_normalizer_z* normalizer, const uint8_t* src, const size_t length, uint8_t* dst)
+{
+  size_t consumed = 0;
+
+  return normalize_part(normalizer, src, length, 1, dst, &consumed);
+}
+
+/**
+ * @brief Gets the Unicode normalization form to apply before the byte filters.
+ *
+ * @return Zero if neither NFC nor NFKC is enabled.
+ * */
+static int
+get_unicode_form(const toke_normalizer_z* normalizer, enum toke_unicode_form* form)
+{
+  const int flags = normalizer->config.flags;
+
+  // NFKC implies NFC, so it wins if both are enabled
+  *form = (flags & NFKC) ? TOKE_UNICODE_NFKC : TOKE_UNICODE_NFC;
+
+  return (flags & (NFC | NFKC)) != 0;
 }
 
 char*
 toke_normalize(toke_normalizer_z* normalizer, const char* input, const size_t length, size_t* out_length_ptr)
 {
+  enum toke_unicode_form form = TOKE_UNICODE_NFC;
+
+  if (get_unicode_form(normalizer, &form)) {
+
+    if (toke_unicode_quick_check((const uint8_t*)input, length, form) < length) {
+
+      size_t unicode_length = 0;
+
+      uint8_t* unicode = toke_unicode_normalize((const uint8_t*)input, length, form, &unicode_length);
+      if (!unicode) {
+        return NULL;
+      }
+
+      // the byte filters never make the text longer, so they can run over the normalized text in place
+      const size_t out_length = normalize(normalizer, unicode, unicode_length, unicode);
+
+      unicode[out_length] = 0;
+
+      if (out_length_ptr) {
+        *out_length_ptr = out_length;
+      }
+
+      return (char*)unicode;
+    }
+  }
+
   char* result = malloc(length + 1);
   if (!result) {
     return NULL;
   }
 
-  size_t src_offset = 0;
-  size_t dst_offset = 0;
+  const size_t out_length = normalize(normalizer, (const uint8_t*)input, length, (uint8_t*)result);
 
-  const uint8_t normalize_newlines = normalizer->config.flags & NORMALIZE_NEWLINES;
-  const uint8_t normalize_tabs = normalizer->config.flags & NORMALIZE_TABS;
-  const uint8_t restricted_ascii = normalizer->config.flags & RESTRICTED_ASCII;
-  const uint8_t lowercase = normalizer->config.flags & LOWERCASE;
-  const uint8_t unicode_subs = normalizer->config.flags & UNICODE_SUBSTITUTES;
+  result[out_length] = 0;
 
-  while (src_offset < length) {
+  if (out_length_ptr) {
+    *out_length_ptr = out_length;
+  }
 
-    const size_t remaining = length - src_offset;
-    const char c = input[src_offset];
-    const size_t code_len = utf8_length(c);
-
-    if (normalize_newlines && (c == '\r')) {
-      if ((remaining > 1) && (input[src_offset + 1] == '\n')) {
-        result[dst_offset] = '\n';
-        dst_offset++;
-        src_offset += 2;
-        continue;
-      } else {
-        result[dst_offset] = '\n';
-        dst_offset++;
-        src_offset++;
-        continue;
+  return result;
+}
+
+toke_error_z
+toke_normalize_inplace(toke_normalizer_z* normalizer, char* text, const size_t length, size_t* out_length_ptr)
+{
+  uint8_t* data = (uint8_t*)text;
+
+  size_t unicode_length = length;
+
+  enum toke_unicode_form form = TOKE_UNICODE_NFC;
+
+  if (get_unicode_form(normalizer, &form)) {
+
+    // the quick check stops at a segment boundary, so only the text after it has to be normalized
+    const size_t prefix_length = toke_unicode_quick_check(data, length, form);
+
+    if (prefix_length < length) {
+
+      size_t suffix_length = 0;
+
+      uint8_t* suffix = toke_unicode_normalize(data + prefix_length, length - prefix_length, form, &suffix_length);
+      if (!suffix) {
+        return TOKE_ERROR_MEMORY_ALLOCATION;
       }
+
+      if ((prefix_length + suffix_length) > length) {
+        free(suffix);
+        return TOKE_ERROR_BUFFER_SIZE;
+      }
+
+      memcpy(data + prefix_length, suffix, suffix_length);
+
+      free(suffix);
+
+      unicode_length = prefix_length + suffix_length;
     }
+  }
 
-    if (normalize_tabs && (c == '\t')) {
-      result[dst_offset] = ' ';
-      dst_offset++;
-      src_offset++;
-      continue;
+  const size_t out_length = normalize(normalizer, data, unicode_length, data);
+
+  if (out_length_ptr) {
+    *out_length_ptr = out_length;
+  }
+
+  return TOKE_ERROR_NONE;
+}
+
+struct toke_normalizer_stream
+{
+  const toke_normalizer_z* normalizer;
+
+  /**
+   * @brief Text that hasn't been through NFC or NFKC yet. It always starts at a segment boundary.
+   * */
+  uint8_t* pending;
+
+  size_t pending_size;
+
+  size_t pending_capacity;
+
+  /**
+   * @brief Text the byte filters are waiting to see more of, which is either a truncated UTF-8 sequence or a carriage
+   *        return.
+   * */
+  uint8_t held[4];
+
+  size_t held_size;
+};
+
+toke_normalizer_stream_z*
+toke_normalizer_stream_new(const toke_normalizer_z* normalizer)
+{
+  toke_normalizer_stream_z* self = malloc(sizeof(toke_normalizer_stream_z));
+  if (!self) {
+    return NULL;
+  }
+
+  self->normalizer = normalizer;
+  self->pending = NULL;
+  self->pending_size = 0;
+  self->pending_capacity = 0;
+  self->held_size = 0;
+
+  return self;
+}
+
+void
+toke_normalizer_stream_delete(toke_normalizer_stream_z* self)
+{
+  if (self) {
+    free(self->pending);
+  }
+
+  free(self);
+}
+
+size_t
+toke_normalizer_stream_bound(const toke_normalizer_stream_z* self, const size_t length)
+{
+  enum toke_unicode_form form = TOKE_UNICODE_NFC;
+
+  if (!get_unicode_form(self->normalizer, &form)) {
+    return self->held_size + length;
+  }
+
+  const size_t expansion =
+    (form == TOKE_UNICODE_NFKC) ? TOKE_UNICODE_NFKC_MAX_EXPANSION : TOKE_UNICODE_NFC_MAX_EXPANSION;
+
+  return self->held_size + ((self->pending_size + length) * expansion);
+}
+
+/**
+ * @brief Runs the byte filters over the held bytes followed by the text.
+ *
+ * @return The number of bytes written to the output.
+ * */
+static size_t
+filter_stream(toke_normalizer_stream_z* self, const uint8_t* text, const size_t length, const int final, uint8_t* dst)
+{
+  const toke_normalizer_z* normalizer = self->normalizer;
+
+  size_t dst_offset = 0;
+
+  size_t src_offset = 0;
+
+  if (self->held_size > 0) {
+
+    // Four more bytes always finish off the held bytes, so only that much of the text has to be joined to them.
+    const size_t extra = (length < 4) ? length : 4;
+
+    uint8_t joint[sizeof(self->held) + 4];
+    memcpy(joint, self->held, self->held_size);
+    memcpy(joint + self->held_size, text, extra);
+
+    const size_t joint_size = self->held_size + extra;
+
+    size_t consumed = 0;
+
+    dst_offset = normalize_part(normalizer, joint, joint_size, final && (extra == length), dst, &consumed);
+
+    if (consumed < self->held_size) {
+      // the text ran out before the held bytes could be finished
+      self->held_size = joint_size - consumed;
+      memcpy(self->held, joint + consumed, self->held_size);
+      return dst_offset;
     }
 
-    if (unicode_subs && (code_len > 1)) {
-
-      if (code_len == 3) {
-
-        // em dash
-        if (memcmp(input + src_offset, "\xe2\x80\x94", 3) == 0) {
-          result[dst_offset] = '-';
-          dst_offset++;
-          src_offset += code_len;
-          continue;
-        }
-
-        // en dash
-        if (memcmp(input + src_offset, "\xe2\x80\x93", 3) == 0) {
-          result[dst_offset] = '-';
-          dst_offset++;
-          src_offset += code_len;
-          continue;
-        }
-
-        // hyphen
-        if (memcmp(input + src_offset, "\xe2\x80\x90", 3) == 0) {
-          result[dst_offset] = '-';
-          dst_offset++;
-          src_offset += code_len;
-          continue;
-        }
-
-        // hyphen (non-breaking)
-        if (memcmp(input + src_offset, "\xe2\x80\x91", 3) == 0) {
-          result[dst_offset] = '-';
-          dst_offset++;
-          src_offset += code_len;
-          continue;
-        }
-
-        // double quote
-        if (memcmp(input + src_offset, "\xe2\x80\x9c", 3) == 0) {
-          result[dst_offset] = '"';
-          dst_offset++;
-          src_offset += code_len;
-          continue;
-        }
-
-        // double quote
-        if (memcmp(input + src_offset, "\xe2\x80\x9d", 3) == 0) {
-          result[dst_offset] = '"';
-          dst_offset++;
-          src_offset += code_len;
-          continue;
-        }
-
-        // double quote
-        if (memcmp(input + src_offset, "\xe2\x80\xb3", 3) == 0) {
-          result[dst_offset] = '"';
-          dst_offset++;
-          src_offset += code_len;
-          continue;
-        }
-
-        // single quote
-        if (memcmp(input + src_offset, "\xe2\x80\x98", 3) == 0) {
-          result[dst_offset] = '\'';
-          dst_offset++;
-          src_offset += code_len;
-          continue;
-        }
-
-        // single quote
-        if (memcmp(input + src_offset, "\xe2\x80\x99", 3) == 0) {
-          result[dst_offset] = '\'';
-          dst_offset++;
-          src_offset += code_len;
-          continue;
-        }
-
-        // single quote
-        if (memcmp(input + src_offset, "\xe2\x80\xb2", 3) == 0) {
-          result[dst_offset] = '\'';
-          dst_offset++;
-          src_offset += code_len;
-          continue;
-        }
-
-        // bullet
-        if (memcmp(input + src_offset, "\xe2\x80\xa2", 3) == 0) {
-          result[dst_offset] = '*';
-          dst_offset++;
-          src_offset += code_len;
-          continue;
-        }
-
-        // bullet
-        if (memcmp(input + src_offset, "\xe2\x80\xa3", 3) == 0) {
-          result[dst_offset] = '*';
-          dst_offset++;
-          src_offset += code_len;
-          continue;
-        }
-      }
+    src_offset = consumed - self->held_size;
+
+    self->held_size = 0;
+  }
+
+  size_t consumed = 0;
+
+  dst_offset += normalize_part(normalizer, text + src_offset, length - src_offset, final, dst + dst_offset, &consumed);
+
+  src_offset += consumed;
+
+  self->held_size = length - src_offset;
+
+  memcpy(self->held, text + src_offset, self->held_size);
+
+  return dst_offset;
+}
+
+static toke_error_z
+run_stream(toke_normalizer_stream_z* self,
+           const uint8_t* input,
+           const size_t length,
+           const int final,
+           uint8_t* output,
+           const size_t output_capacity,
+           size_t* out_length_ptr)
+{
+  if (output_capacity < toke_normalizer_stream_bound(self, length)) {
+    return TOKE_ERROR_BUFFER_SIZE;
+  }
+
+  enum toke_unicode_form form = TOKE_UNICODE_NFC;
+
+  if (!get_unicode_form(self->normalizer, &form)) {
+    const size_t out_length = filter_stream(self, input, length, final, output);
+    if (out_length_ptr) {
+      *out_length_ptr = out_length;
     }
+    return TOKE_ERROR_NONE;
+  }
 
-    if (restricted_ascii && !is_restricted_ascii(c)) {
-      result[dst_offset] = '\x7f';
-      dst_offset++;
-      src_offset += code_len;
-      continue;
+  if ((self->pending_size + length) > self->pending_capacity) {
+
+    size_t capacity = self->pending_capacity ? self->pending_capacity : 64;
+    while (capacity < (self->pending_size + length)) {
+      capacity *= 2;
     }
 
-    if (lowercase && ((c >= 'A') && (c <= 'Z'))) {
-      result[dst_offset] = (char)(c + 32);
-      dst_offset++;
-      src_offset++;
-      continue;
+    uint8_t* pending = realloc(self->pending, capacity);
+    if (!pending) {
+      return TOKE_ERROR_MEMORY_ALLOCATION;
     }
 
-    // normal condition
-    for (size_t i = 0; i < code_len; i++) {
-      result[dst_offset + i] = input[src_offset + i];
+    self->pending = pending;
+    self->pending_capacity = capacity;
+  }
+
+  memcpy(self->pending + self->pending_size, input, length);
+
+  // The last segment may still be extended by the next chunk, so it stays pending until the end of the text.
+  const size_t pending_size = self->pending_size + length;
+  const size_t ready_size = final ? pending_size : toke_unicode_last_boundary(self->pending, pending_size, form);
+
+  const uint8_t* text = self->pending;
+
+  size_t text_length = ready_size;
+
+  uint8_t* normalized = NULL;
+
+  if (toke_unicode_quick_check(self->pending, ready_size, form) < ready_size) {
+    normalized = toke_unicode_normalize(self->pending, ready_size, form, &text_length);
+    if (!normalized) {
+      return TOKE_ERROR_MEMORY_ALLOCATION;
     }
-    dst_offset += code_len;
-    src_offset += code_len;
+    text = normalized;
   }
 
-  result[dst_offset] = 0;
+  const size_t out_length = filter_stream(self, text, text_length, final, output);
+
+  free(normalized);
+
+  memmove(self->pending, self->pending + ready_size, pending_size - ready_size);
+
+  self->pending_size = pending_size - ready_size;
 
   if (out_length_ptr) {
-    *out_length_ptr = dst_offset;
+    *out_length_ptr = out_length;
   }
 
-  return result;
+  return TOKE_ERROR_NONE;
+}
+
+toke_error_z
+toke_normalizer_stream_feed(toke_normalizer_stream_z* self,
+                            const char* input,
+                            const size_t length,
+                            char* output,
+                            const size_t output_capacity,
+                            size_t* out_length_ptr)
+{
+  return run_stream(self, (const uint8_t*)input, length, 0, (uint8_t*)output, output_capacity, out_length_ptr);
+}
+
+toke_error_z
+toke_normalizer_stream_finish(toke_normalizer_stream_z* self,
+                              char* output,
+                              const size_t output_capacity,
+                              size_t* out_length_ptr)
+{
+  return run_stream(self, (const uint8_t*)"", 0, 1, (uint8_t*)output, output_capacity, out_length_ptr);
 }
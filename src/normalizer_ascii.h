@@ -0,0 +1,58 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief The number of bytes the scalar normalizer handles before trying the ASCII kernel again.
+ * */
+#define TOKE_ASCII_BLOCK_SIZE 64
+
+/**
+ * @brief The byte values the ASCII kernels compare against, derived from the normalizer flags.
+ *
+ * @details A value of 0xff disables its rule, since blocks containing bytes with the high bit set are never handled by
+ *          the vector kernels.
+ * */
+struct toke_ascii_filter
+{
+  /**
+   * @brief Blocks containing this byte are left to the scalar loop (a carriage return, when lines are normalized).
+   * */
+  uint8_t reject_char;
+
+  /**
+   * @brief This byte is replaced with a space (a tab, when tabs are normalized).
+   * */
+  uint8_t tab_char;
+
+  /**
+   * @brief Added to upper case letters (0x20 when lowercasing, otherwise zero).
+   * */
+  uint8_t lowercase_offset;
+
+  /**
+   * @brief 0xff if control characters are replaced with \x7f, otherwise zero.
+   * */
+  uint8_t restricted_mask;
+};
+
+/**
+ * @brief Normalizes whole blocks of plain ASCII text.
+ *
+ * @return The number of bytes consumed and written, which stops at the first block that needs the scalar loop.
+ *         The destination may alias the source, as long as it does not start after it.
+ * */
+typedef size_t (*toke_ascii_kernel)(const struct toke_ascii_filter* filter,
+                                    const uint8_t* src,
+                                    size_t length,
+                                    uint8_t* dst);
+
+size_t
+toke_normalize_ascii_sse2(const struct toke_ascii_filter* filter, const uint8_t* src, size_t length, uint8_t* dst);
+
+size_t
+toke_normalize_ascii_avx2(const struct toke_ascii_filter* filter, const uint8_t* src, size_t length, uint8_t* dst);
+
+size_t
+toke_normalize_ascii_avx512(const struct toke_ascii_filter* filter, const uint8_t* src, size_t length, uint8_t* dst);
@@ -0,0 +1,61 @@
+#include "normalizer_ascii.h"
+
+#ifdef __AVX2__
+
+#include <immintrin.h>
+
+size_t
+toke_normalize_ascii_avx2(const struct toke_ascii_filter* filter, const uint8_t* src, const size_t length, uint8_t* dst)
+{
+  const __m256i reject_char = _mm256_set1_epi8((char)filter->reject_char);
+  const __m256i tab_char = _mm256_set1_epi8((char)filter->tab_char);
+  const __m256i lowercase_offset = _mm256_set1_epi8((char)filter->lowercase_offset);
+  const __m256i restricted_mask = _mm256_set1_epi8((char)filter->restricted_mask);
+
+  const __m256i before_upper = _mm256_set1_epi8('A' - 1);
+  const __m256i after_upper = _mm256_set1_epi8('Z' + 1);
+  const __m256i space = _mm256_set1_epi8(' ');
+  const __m256i del = _mm256_set1_epi8('\x7f');
+  const __m256i tab = _mm256_set1_epi8('\t');
+  const __m256i cr = _mm256_set1_epi8('\r');
+  const __m256i lf = _mm256_set1_epi8('\n');
+
+  size_t offset = 0;
+
+  while ((length - offset) >= 32) {
+
+    const __m256i v = _mm256_loadu_si256((const __m256i*)(src + offset));
+
+    // bytes with the high bit set are negative, so both checks can share one mask
+    const __m256i special = _mm256_or_si256(v, _mm256_cmpeq_epi8(v, reject_char));
+    if (_mm256_movemask_epi8(special) != 0) {
+      break;
+    }
+
+    const __m256i is_upper = _mm256_and_si256(_mm256_cmpgt_epi8(v, before_upper), _mm256_cmpgt_epi8(after_upper, v));
+
+    const __m256i is_tab = _mm256_cmpeq_epi8(v, tab_char);
+
+    const __m256i is_allowed_control =
+      _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, tab), _mm256_cmpeq_epi8(v, cr)), _mm256_cmpeq_epi8(v, lf));
+
+    const __m256i is_control = _mm256_andnot_si256(is_allowed_control, _mm256_cmpgt_epi8(space, v));
+
+    const __m256i is_invalid =
+      _mm256_and_si256(_mm256_or_si256(is_control, _mm256_cmpeq_epi8(v, del)), restricted_mask);
+
+    __m256i out = _mm256_add_epi8(v, _mm256_and_si256(is_upper, lowercase_offset));
+
+    out = _mm256_blendv_epi8(out, space, is_tab);
+
+    out = _mm256_blendv_epi8(out, del, is_invalid);
+
+    _mm256_storeu_si256((__m256i*)(dst + offset), out);
+
+    offset += 32;
+  }
+
+  return offset;
+}
+
+#endif /* __AVX2__ */
@@ -0,0 +1,62 @@
+#include "normalizer_ascii.h"
+
+#if defined(__AVX512F__) && defined(__AVX512BW__)
+
+#include <immintrin.h>
+
+size_t
+toke_normalize_ascii_avx512(const struct toke_ascii_filter* filter,
+                            const uint8_t* src,
+                            const size_t length,
+                            uint8_t* dst)
+{
+  const __m512i reject_char = _mm512_set1_epi8((char)filter->reject_char);
+  const __m512i tab_char = _mm512_set1_epi8((char)filter->tab_char);
+  const __m512i lowercase_offset = _mm512_set1_epi8((char)filter->lowercase_offset);
+  const __mmask64 restricted_mask = filter->restricted_mask ? ~(__mmask64)0 : 0;
+
+  const __m512i before_upper = _mm512_set1_epi8('A' - 1);
+  const __m512i after_upper = _mm512_set1_epi8('Z' + 1);
+  const __m512i space = _mm512_set1_epi8(' ');
+  const __m512i del = _mm512_set1_epi8('\x7f');
+  const __m512i tab = _mm512_set1_epi8('\t');
+  const __m512i cr = _mm512_set1_epi8('\r');
+  const __m512i lf = _mm512_set1_epi8('\n');
+
+  size_t offset = 0;
+
+  while ((length - offset) >= 64) {
+
+    const __m512i v = _mm512_loadu_si512((const void*)(src + offset));
+
+    const __mmask64 special = _mm512_movepi8_mask(v) | _mm512_cmpeq_epi8_mask(v, reject_char);
+    if (special) {
+      break;
+    }
+
+    const __mmask64 is_upper = _mm512_cmpgt_epi8_mask(v, before_upper) & _mm512_cmplt_epi8_mask(v, after_upper);
+
+    const __mmask64 is_tab = _mm512_cmpeq_epi8_mask(v, tab_char);
+
+    const __mmask64 is_allowed_control =
+      _mm512_cmpeq_epi8_mask(v, tab) | _mm512_cmpeq_epi8_mask(v, cr) | _mm512_cmpeq_epi8_mask(v, lf);
+
+    const __mmask64 is_control = _mm512_cmplt_epi8_mask(v, space) & ~is_allowed_control;
+
+    const __mmask64 is_invalid = (is_control | _mm512_cmpeq_epi8_mask(v, del)) & restricted_mask;
+
+    __m512i out = _mm512_mask_add_epi8(v, is_upper, v, lowercase_offset);
+
+    out = _mm512_mask_mov_epi8(out, is_tab, space);
+
+    out = _mm512_mask_mov_epi8(out, is_invalid, del);
+
+    _mm512_storeu_si512((void*)(dst + offset), out);
+
+    offset += 64;
+  }
+
+  return offset;
+}
+
+#endif /* __AVX512F__ && __AVX512BW__ */
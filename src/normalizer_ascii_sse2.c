@@ -0,0 +1,60 @@
+#include "normalizer_ascii.h"
+
+#ifdef __SSE2__
+
+#include <emmintrin.h>
+
+size_t
+toke_normalize_ascii_sse2(const struct toke_ascii_filter* filter, const uint8_t* src, const size_t length, uint8_t* dst)
+{
+  const __m128i reject_char = _mm_set1_epi8((char)filter->reject_char);
+  const __m128i tab_char = _mm_set1_epi8((char)filter->tab_char);
+  const __m128i lowercase_offset = _mm_set1_epi8((char)filter->lowercase_offset);
+  const __m128i restricted_mask = _mm_set1_epi8((char)filter->restricted_mask);
+
+  const __m128i before_upper = _mm_set1_epi8('A' - 1);
+  const __m128i after_upper = _mm_set1_epi8('Z' + 1);
+  const __m128i space = _mm_set1_epi8(' ');
+  const __m128i del = _mm_set1_epi8('\x7f');
+  const __m128i tab = _mm_set1_epi8('\t');
+  const __m128i cr = _mm_set1_epi8('\r');
+  const __m128i lf = _mm_set1_epi8('\n');
+
+  size_t offset = 0;
+
+  while ((length - offset) >= 16) {
+
+    const __m128i v = _mm_loadu_si128((const __m128i*)(src + offset));
+
+    // bytes with the high bit set are negative, so both checks can share one mask
+    const __m128i special = _mm_or_si128(v, _mm_cmpeq_epi8(v, reject_char));
+    if (_mm_movemask_epi8(special) != 0) {
+      break;
+    }
+
+    const __m128i is_upper = _mm_and_si128(_mm_cmpgt_epi8(v, before_upper), _mm_cmplt_epi8(v, after_upper));
+
+    const __m128i is_tab = _mm_cmpeq_epi8(v, tab_char);
+
+    const __m128i is_allowed_control =
+      _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, tab), _mm_cmpeq_epi8(v, cr)), _mm_cmpeq_epi8(v, lf));
+
+    const __m128i is_control = _mm_andnot_si128(is_allowed_control, _mm_cmplt_epi8(v, space));
+
+    const __m128i is_invalid = _mm_and_si128(_mm_or_si128(is_control, _mm_cmpeq_epi8(v, del)), restricted_mask);
+
+    __m128i out = _mm_add_epi8(v, _mm_and_si128(is_upper, lowercase_offset));
+
+    out = _mm_or_si128(_mm_andnot_si128(is_tab, out), _mm_and_si128(is_tab, space));
+
+    out = _mm_or_si128(_mm_andnot_si128(is_invalid, out), _mm_and_si128(is_invalid, del));
+
+    _mm_storeu_si128((__m128i*)(dst + offset), out);
+
+    offset += 16;
+  }
+
+  return offset;
+}
+
+#endif /* __SSE2__ */
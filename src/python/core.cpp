@@ -2,6 +2,7 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
+#include <toke/cpu.h>
 #include <toke/decoder.h>
 #include <toke/encoder.h>
 #include <toke/model.h>
@@ -9,7 +10,9 @@
 #include "exceptions.h"
 #include "train.h"
 
+#include <memory>
 #include <string>
+#include <vector>
 
 #include <cstdint>
 #include <cstdlib>
@@ -52,12 +55,19 @@ public:
     throw_if_error(err);
   }
 
-  [[nodiscard]] auto encode(const std::string& txt) const
+  void load_model(const toke_model_z* model)
+  {
+    const auto err = toke_encoder_from_model(m_self, model);
+    throw_if_error(err);
+  }
+
+  [[nodiscard]] auto encode(std::string txt) const
     -> py::array_t<std::uint16_t, py::array::forcecast | py::array::c_style>
   {
     size_t out_size = 0;
 
-    auto* out_ptr = toke_encode(m_self, txt.data(), txt.size(), &out_size);
+    // the string is already a copy of the Python text, so it can be normalized in place
+    auto* out_ptr = toke_encode_inplace(m_self, txt.data(), txt.size(), &out_size);
     if (!out_ptr) {
       throw_out_of_memory();
     }
@@ -73,6 +83,8 @@ public:
     return result;
   }
 
+  [[nodiscard]] auto get() const -> toke_encoder_z* { return m_self; }
+
 private:
   toke_encoder_z* m_self{};
 };
@@ -102,12 +114,19 @@ public:
     throw_if_error(err);
   }
 
+  void load_model(const toke_model_z* model)
+  {
+    const auto err = toke_decoder_from_model(m_self, model);
+    throw_if_error(err);
+  }
+
   [[nodiscard]] auto decode(const py::array_t<std::uint16_t, py::array::forcecast | py::array::c_style>& tokens) const
     -> std::string
   {
     size_t out_size = 0;
 
-    char* data = toke_decode(m_self, tokens.data(0), tokens.size(), &out_size);
+    // data() rather than data(0), which would throw on an empty array
+    char* data = toke_decode(m_self, tokens.data(), tokens.size(), &out_size);
     if (!data) {
       throw_out_of_memory();
     }
@@ -142,6 +161,26 @@ public:
     throw_if_error(err);
   }
 
+  void add_tokens(const std::vector<std::string>& tokens)
+  {
+    std::vector<const uint8_t*> data(tokens.size());
+    std::vector<std::size_t> sizes(tokens.size());
+
+    for (std::size_t i = 0; i < tokens.size(); i++) {
+      data[i] = reinterpret_cast<const uint8_t*>(tokens[i].data());
+      sizes[i] = tokens[i].size();
+    }
+
+    const auto err = toke_model_add_tokens(m_self, data.data(), sizes.data(), tokens.size());
+    throw_if_error(err);
+  }
+
+  void add_codepoint_range(const std::uint32_t first, const std::uint32_t last)
+  {
+    const auto err = toke_model_add_codepoint_range(m_self, first, last);
+    throw_if_error(err);
+  }
+
   void add_unicode_block(const toke_unicode_block_z block)
   {
     const auto err = toke_model_add_unicode_block(m_self, block);
@@ -150,19 +189,46 @@ public:
 
   [[nodiscard]] auto at(std::size_t index) const -> std::string
   {
+    if (index >= toke_model_size(m_self)) {
+      throw py::index_error("model index out of range");
+    }
+    // a loaded model's tokens are only checked as they are read
     const uint8_t* data = toke_model_get_def(m_self, index);
+    if (!data) {
+      throw_if_error(TOKE_ERROR_MODEL_FORMAT);
+    }
     const std::size_t size = toke_model_get_size(m_self, index);
     return std::string(reinterpret_cast<const char*>(data), size);
   }
 
   [[nodiscard]] auto size() const -> size_t { return toke_model_size(m_self); }
 
+  [[nodiscard]] auto get() const -> const toke_model_z* { return m_self; }
+
+  void save(const std::string& filename) const
+  {
+    const auto err = toke_model_save(m_self, filename.c_str());
+    throw_if_error(err);
+  }
+
+  void load(const std::string& filename)
+  {
+    const auto err = toke_model_load(m_self, filename.c_str());
+    throw_if_error(err);
+  }
+
 private:
   toke_model_z* m_self{};
 };
 
 } // namespace
 
+auto
+get_encoder(const pybind11::handle& encoder) -> toke_encoder_z*
+{
+  return encoder.cast<const Encoder&>().get();
+}
+
 } // namespace toke
 
 PYBIND11_MODULE(toke, m)
@@ -171,24 +237,56 @@ PYBIND11_MODULE(toke, m)
     .def(py::init<>())
     .def("load_vocab", &toke::Encoder::load_vocab, py::arg("filename"))
     .def("parse_vocab", &toke::Encoder::parse_vocab, py::arg("vocab"))
-    .def("encode", &toke::Encoder::encode, py::arg("text"));
+    .def("encode", &toke::Encoder::encode, py::arg("text"))
+    .def_static(
+      "from_model",
+      [](const toke::Model& model) {
+        auto encoder = std::make_unique<toke::Encoder>();
+        encoder->load_model(model.get());
+        return encoder;
+      },
+      py::arg("model"));
 
   py::class_<toke::Decoder>(m, "Decoder")
     .def(py::init<>())
     .def("load_vocab", &toke::Decoder::load_vocab, py::arg("filename"))
     .def("parse_vocab", &toke::Decoder::parse_vocab, py::arg("vocab"))
-    .def("decode", &toke::Decoder::decode, py::arg("tokens"));
-
-  py::enum_<toke_unicode_block_z>(m, "UnicodeBlock")
-    .value("BASIC_LATIN", TOKE_UNICODE_BLOCK_BASIC_LATIN)
-    .value("GENERAL_PUNCTUATION", TOKE_UNICODE_BLOCK_GENERAL_PUNCTUATION);
+    .def("decode", &toke::Decoder::decode, py::arg("tokens"))
+    .def_static(
+      "from_model",
+      [](const toke::Model& model) {
+        auto decoder = std::make_unique<toke::Decoder>();
+        decoder->load_model(model.get());
+        return decoder;
+      },
+      py::arg("model"));
+
+  py::enum_<toke_cpu_level_z>(m, "CpuLevel")
+    .value("SCALAR", TOKE_CPU_LEVEL_SCALAR)
+    .value("SSE2", TOKE_CPU_LEVEL_SSE2)
+    .value("AVX2", TOKE_CPU_LEVEL_AVX2)
+    .value("AVX512", TOKE_CPU_LEVEL_AVX512);
+
+  m.def("cpu_level", &toke_cpu_level);
+
+  m.def("set_cpu_level", &toke_cpu_set_level, py::arg("level"));
+
+  py::enum_<toke_unicode_block_z> unicode_block(m, "UnicodeBlock");
+  for (int i = 0; i < TOKE_UNICODE_BLOCK_COUNT; i++) {
+    const auto block = static_cast<toke_unicode_block_z>(i);
+    unicode_block.value(toke_unicode_block_name(block), block);
+  }
 
   py::class_<toke::Model>(m, "Model")
     .def(py::init<>())
     .def("__len__", &toke::Model::size)
     .def("__getitem__", &toke::Model::at, py::arg("index"))
     .def("add", &toke::Model::add, py::arg("data"))
-    .def("add_unicode_block", &toke::Model::add_unicode_block, py::arg("block"));
+    .def("add_tokens", &toke::Model::add_tokens, py::arg("tokens"))
+    .def("add_unicode_block", &toke::Model::add_unicode_block, py::arg("block"))
+    .def("add_codepoint_range", &toke::Model::add_codepoint_range, py::arg("first"), py::arg("last"))
+    .def("save", &toke::Model::save, py::arg("filename"))
+    .def("load", &toke::Model::load, py::arg("filename"));
   ;
 
   toke::def_train_model(m);
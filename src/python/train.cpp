@@ -1,15 +1,416 @@
 #include "train.h"
 
+#include <pybind11/numpy.h>
+
 #include <toke/train/dataset.h>
+#include <toke/train/dedup.h>
+#include <toke/train/shards.h>
 
 #include "exceptions.h"
 
+// the internal headers are written for C, without guards of their own
+extern "C"
+{
+#include "unicode.h"
+}
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
 namespace toke {
 
 namespace {
 
 namespace py = pybind11;
 
+class Dedup final
+{
+public:
+  Dedup()
+    : m_self(toke_dedup_new())
+  {
+    if (!m_self) {
+      throw std::runtime_error("failed to allocate dedup set");
+    }
+  }
+
+  Dedup(const Dedup&) = delete;
+
+  auto operator=(const Dedup&) -> Dedup& = delete;
+
+  ~Dedup() { toke_dedup_delete(m_self); }
+
+  void clear() { toke_dedup_clear(m_self); }
+
+  [[nodiscard]] auto num_unique() const -> std::size_t { return toke_dedup_num_unique(m_self); }
+
+  [[nodiscard]] auto num_duplicates() const -> std::size_t { return toke_dedup_num_duplicates(m_self); }
+
+  [[nodiscard]] auto duplicate_bytes() const -> std::size_t { return toke_dedup_duplicate_bytes(m_self); }
+
+  [[nodiscard]] auto get() -> toke_dedup_z* { return m_self; }
+
+private:
+  toke_dedup_z* m_self{};
+};
+
+/**
+ * @brief Gets the number of threads to walk with, where zero means one for each core.
+ * */
+[[nodiscard]] auto
+walk_threads(const std::size_t max_threads) -> std::size_t
+{
+  return max_threads ? max_threads : std::max<std::size_t>(1, std::thread::hardware_concurrency());
+}
+
+/**
+ * @brief What a counting walk gathers, on each thread and then in total.
+ * */
+struct TextCounts final
+{
+  std::size_t documents;
+
+  std::size_t bytes;
+
+  std::size_t codepoints;
+};
+
+void
+count_text(void*, void* state, const uint8_t* text, const std::size_t text_size, std::size_t, std::size_t)
+{
+  auto* counts = static_cast<TextCounts*>(state);
+
+  // every byte but the continuation bytes of UTF-8 starts a codepoint, and the loop is simple enough to vectorize
+  std::size_t codepoints = 0;
+  for (std::size_t i = 0; i < text_size; i++) {
+    codepoints += (text[i] & 0xc0) != 0x80;
+  }
+
+  counts->documents++;
+  counts->bytes += text_size;
+  counts->codepoints += codepoints;
+}
+
+auto
+merge_counts(void*, void* target, void* source) -> toke_error_z
+{
+  auto* to = static_cast<TextCounts*>(target);
+  const auto* from = static_cast<const TextCounts*>(source);
+  to->documents += from->documents;
+  to->bytes += from->bytes;
+  to->codepoints += from->codepoints;
+  return TOKE_ERROR_NONE;
+}
+
+/**
+ * @brief Counts of each codepoint, in an array for the basic multilingual plane, where nearly all text is, and in a map
+ *        for the rest.
+ * */
+struct CodepointCounts final
+{
+  std::vector<std::uint64_t> basic = std::vector<std::uint64_t>(0x10000);
+
+  std::unordered_map<std::uint32_t, std::uint64_t> supplementary;
+};
+
+/**
+ * @brief The state of each thread of a histogram walk. The walk hands out zeroed memory rather than constructing
+ *        anything in it, so the counts are kept behind a pointer.
+ * */
+struct HistogramState final
+{
+  CodepointCounts* counts;
+
+  /**
+   * @brief Set if the map couldn't grow, which the merge reports since walkers can't.
+   * */
+  bool failed;
+};
+
+auto
+init_histogram(void*, void* state, std::size_t) -> toke_error_z
+{
+  try {
+    static_cast<HistogramState*>(state)->counts = new CodepointCounts();
+  } catch (const std::bad_alloc&) {
+    return TOKE_ERROR_MEMORY_ALLOCATION;
+  }
+
+  return TOKE_ERROR_NONE;
+}
+
+void
+count_codepoints(void*, void* state, const uint8_t* text, const std::size_t text_size, std::size_t, std::size_t)
+{
+  auto* histogram = static_cast<HistogramState*>(state);
+
+  auto& basic = histogram->counts->basic;
+
+  std::size_t i = 0;
+
+  while (i < text_size) {
+
+    if (text[i] < 0x80) {
+      basic[text[i]]++;
+      i++;
+      continue;
+    }
+
+    std::uint32_t codepoint = 0;
+
+    const std::size_t size = toke_utf8_decode(text + i, text_size - i, &codepoint);
+
+    // bytes that aren't valid UTF-8 are each counted as a replacement character, as decoding would make them
+    if (size == 0) {
+      basic[0xfffd]++;
+      i++;
+      continue;
+    }
+
+    if (codepoint < 0x10000) {
+      basic[codepoint]++;
+    } else {
+      try {
+        histogram->counts->supplementary[codepoint]++;
+      } catch (const std::bad_alloc&) {
+        histogram->failed = true;
+      }
+    }
+
+    i += size;
+  }
+}
+
+auto
+merge_histogram(void*, void* target, void* source) -> toke_error_z
+{
+  auto* to = static_cast<HistogramState*>(target);
+  const auto* from = static_cast<const HistogramState*>(source);
+
+  if (from->failed) {
+    return TOKE_ERROR_MEMORY_ALLOCATION;
+  }
+
+  for (std::size_t i = 0; i < from->counts->basic.size(); i++) {
+    to->counts->basic[i] += from->counts->basic[i];
+  }
+
+  try {
+    for (const auto& count : from->counts->supplementary) {
+      to->counts->supplementary[count.first] += count.second;
+    }
+  } catch (const std::bad_alloc&) {
+    return TOKE_ERROR_MEMORY_ALLOCATION;
+  }
+
+  return TOKE_ERROR_NONE;
+}
+
+void
+finalize_histogram(void*, void* state)
+{
+  delete static_cast<HistogramState*>(state)->counts;
+}
+
+/**
+ * @brief The most bytes of text that a thread copies before handing them to the callable of a walk.
+ * */
+constexpr std::size_t max_batch_bytes = 1024 * 1024;
+
+/**
+ * @brief The most texts that a thread gathers before handing them to the callable of a walk, which bounds how long
+ *        the GIL is held for when the texts are small.
+ * */
+constexpr std::size_t max_batch_texts = 256;
+
+struct BatchedText final
+{
+  /**
+   * @brief The text in the dataset's mapping, or null if it was copied into the bytes of its batch.
+   * */
+  const std::uint8_t* text;
+
+  /**
+   * @brief Where a copied text starts in the bytes of its batch.
+   * */
+  std::size_t start;
+
+  std::size_t size;
+
+  std::size_t file_index;
+
+  std::size_t offset;
+};
+
+/**
+ * @brief The texts that a thread has walked but not yet handed to the callable.
+ *
+ * @details A text that lies in the dataset's mapping stays there until the dataset is closed, so only where it is gets
+ *          kept. Any other text is only there until the walker returns, so it is copied. That covers compressed files,
+ *          escaped JSON records and the files of a directory, which are unmapped as soon as they have been walked.
+ * */
+struct TextBatch final
+{
+  std::vector<std::uint8_t> bytes;
+
+  std::vector<BatchedText> texts;
+};
+
+/**
+ * @brief The state of a walk that hands each text to a Python callable, which runs with the GIL held, one at a time.
+ *
+ * @details Taking the GIL costs more than a small text takes to walk, so each thread gathers texts into a batch and
+ *          takes the GIL once to hand over all of them.
+ * */
+struct CallbackWalk final
+{
+  const toke_dataset_z* dataset;
+
+  py::function callback;
+
+  /**
+   * @brief The batch of each thread, which only that thread touches until the walk is done.
+   * */
+  std::vector<TextBatch> batches;
+
+  /**
+   * @brief The first exception raised by the callable, after which the rest of the walk skips it. It is only touched
+   *        with the GIL held.
+   * */
+  std::exception_ptr error;
+
+  /**
+   * @brief Set along with the error, for the walking threads to read without the GIL, so that they stop gathering
+   *        texts that would never be handed over.
+   * */
+  std::atomic<bool> failed{ false };
+};
+
+/**
+ * @brief Hands a text to the callable, which must be called with the GIL held.
+ * */
+void
+call_callback(CallbackWalk* self,
+              const std::uint8_t* text,
+              const std::size_t text_size,
+              const std::size_t file_index,
+              const std::size_t offset)
+{
+  if (self->error) {
+    return;
+  }
+
+  // an empty text may have no bytes to point to, but a memoryview still wants an address
+  static const std::uint8_t empty{};
+
+  try {
+    auto view = py::memoryview::from_memory(text ? text : &empty, static_cast<py::ssize_t>(text_size));
+
+    self->callback(view, file_index, offset);
+
+    // a copied text is only there until the batch is reused, and even a text in the mapping is only there until the
+    // dataset is closed, so a view that outlives the call could read freed memory, and releasing it makes using it an
+    // error instead (or fails here, if the callable kept a buffer exported)
+    view.attr("release")();
+  } catch (...) {
+    self->error = std::current_exception();
+    self->failed = true;
+  }
+}
+
+/**
+ * @brief Hands the texts of a batch to the callable and empties it, which must be called with the GIL held.
+ * */
+void
+flush_batch(CallbackWalk* self, TextBatch& batch)
+{
+  for (const auto& text : batch.texts) {
+    const auto* data = text.text ? text.text : (batch.bytes.data() + text.start);
+    call_callback(self, data, text.size, text.file_index, text.offset);
+  }
+
+  batch.bytes.clear();
+  batch.texts.clear();
+}
+
+void
+call_walker(void* user_data,
+            const uint8_t* text,
+            const std::size_t text_size,
+            const std::size_t file_index,
+            const std::size_t offset,
+            const std::size_t thread_index)
+{
+  auto* self = static_cast<CallbackWalk*>(user_data);
+
+  // the walk itself can't be stopped, but nothing more is handed to the callable once it has raised
+  if (self->failed.load(std::memory_order_relaxed)) {
+    return;
+  }
+
+  auto& batch = self->batches[thread_index];
+
+  if (batch.texts.size() < max_batch_texts) {
+
+    const bool mapped = toke_dataset_contains(self->dataset, text, text_size) != 0;
+
+    if (mapped || (text_size <= (max_batch_bytes - batch.bytes.size()))) {
+      try {
+        if (mapped) {
+          batch.texts.push_back(BatchedText{ text, 0, text_size, file_index, offset });
+        } else {
+          batch.bytes.insert(batch.bytes.end(), text, text + text_size);
+          batch.texts.push_back(BatchedText{ nullptr, batch.bytes.size() - text_size, text_size, file_index, offset });
+        }
+        return;
+      } catch (const std::bad_alloc&) {
+        // handed over along with the batch instead, which leaves any bytes that were copied unused until then
+      }
+    }
+  }
+
+  // a full batch goes first, and the text that didn't fit goes straight after it, without being copied
+  py::gil_scoped_acquire acquire;
+
+  flush_batch(self, batch);
+
+  call_callback(self, text, text_size, file_index, offset);
+}
+
+/**
+ * @brief Marks a dataset as being walked for as long as it lives. It is made and dropped with the GIL held, which is
+ *        what guards the count.
+ * */
+class WalkScope final
+{
+public:
+  explicit WalkScope(std::size_t& walks)
+    : m_walks(walks)
+  {
+    m_walks++;
+  }
+
+  WalkScope(const WalkScope&) = delete;
+
+  auto operator=(const WalkScope&) -> WalkScope& = delete;
+
+  ~WalkScope() { m_walks--; }
+
+private:
+  std::size_t& m_walks;
+};
+
 class Dataset final
 {
 public:
@@ -25,13 +426,414 @@ public:
 
   void open(const char* filename)
   {
+    check_not_walking();
     const auto err = toke_dataset_open(m_self, filename);
     throw_if_error(err);
-    toke_dataset_walk(m_self, 1, nullptr, nullptr);
+  }
+
+  void set_chunking(const std::size_t chunk_size, const std::uint8_t delimiter)
+  {
+    check_not_walking();
+    toke_dataset_set_chunking(m_self, chunk_size, delimiter);
+  }
+
+  void set_readahead(const std::size_t readahead)
+  {
+    check_not_walking();
+    toke_dataset_set_readahead(m_self, readahead);
+  }
+
+  void set_jsonl_field(const std::string& field)
+  {
+    check_not_walking();
+    const auto err = toke_dataset_set_jsonl_field(m_self, field.c_str());
+    throw_if_error(err);
+  }
+
+  void set_sampling(const double fraction, const std::size_t max_bytes, const std::uint64_t seed)
+  {
+    check_not_walking();
+    toke_dataset_set_sampling(m_self, fraction, max_bytes, seed);
+  }
+
+  void set_dedup(Dedup* dedup)
+  {
+    check_not_walking();
+    toke_dataset_set_dedup(m_self, dedup ? dedup->get() : nullptr);
+  }
+
+  [[nodiscard]] auto count(const std::size_t max_threads) const -> py::dict
+  {
+    toke_dataset_reducer_z reducer{};
+    reducer.state_size = sizeof(TextCounts);
+    reducer.walk = count_text;
+    reducer.merge = merge_counts;
+
+    TextCounts counts{};
+
+    const WalkScope scope(m_walks);
+
+    toke_error_z err{};
+    {
+      py::gil_scoped_release release;
+      err = toke_dataset_walk_reduce(m_self, walk_threads(max_threads), &reducer, nullptr, &counts);
+    }
+    throw_if_error(err);
+
+    py::dict result;
+    result["documents"] = counts.documents;
+    result["bytes"] = counts.bytes;
+    result["codepoints"] = counts.codepoints;
+    return result;
+  }
+
+  [[nodiscard]] auto codepoint_histogram(const std::size_t max_threads) const -> py::dict
+  {
+    toke_dataset_reducer_z reducer{};
+    reducer.state_size = sizeof(HistogramState);
+    reducer.init = init_histogram;
+    reducer.walk = count_codepoints;
+    reducer.merge = merge_histogram;
+    reducer.finalize = finalize_histogram;
+
+    auto counts = std::make_unique<CodepointCounts>();
+
+    HistogramState histogram{ counts.get(), false };
+
+    const WalkScope scope(m_walks);
+
+    toke_error_z err{};
+    {
+      py::gil_scoped_release release;
+      err = toke_dataset_walk_reduce(m_self, walk_threads(max_threads), &reducer, nullptr, &histogram);
+    }
+    throw_if_error(err);
+
+    py::dict result;
+
+    for (std::size_t i = 0; i < counts->basic.size(); i++) {
+      if (counts->basic[i] > 0) {
+        result[py::int_(i)] = counts->basic[i];
+      }
+    }
+
+    for (const auto& count : counts->supplementary) {
+      result[py::int_(count.first)] = count.second;
+    }
+
+    return result;
+  }
+
+  void walk(py::function callback, const std::size_t max_threads) const
+  {
+    const auto num_threads = walk_threads(max_threads);
+
+    CallbackWalk state{ m_self, std::move(callback), std::vector<TextBatch>(num_threads), nullptr };
+
+    const WalkScope scope(m_walks);
+
+    toke_error_z err{};
+    {
+      py::gil_scoped_release release;
+      err = toke_dataset_walk(m_self, num_threads, &state, call_walker);
+    }
+
+    // what is left in the batches once the walk is done, which was walked even if the walk then failed
+    for (auto& batch : state.batches) {
+      flush_batch(&state, batch);
+    }
+
+    if (state.error) {
+      std::rethrow_exception(state.error);
+    }
+
+    throw_if_error(err);
+  }
+
+  [[nodiscard]] auto get() const -> const toke_dataset_z* { return m_self; }
+
+  /**
+   * @brief Gets the number of walks in flight, for whatever walks the dataset from outside.
+   * */
+  [[nodiscard]] auto walks() const -> std::size_t& { return m_walks; }
+
+  [[nodiscard]] auto size() const -> std::size_t { return toke_dataset_size(m_self); }
+
+  [[nodiscard]] auto at(const std::size_t index) const -> py::bytes
+  {
+    std::size_t size{};
+    const auto* data = toke_dataset_get(m_self, index, &size);
+    if (!data) {
+      throw py::index_error("dataset index out of range");
+    }
+    return py::bytes(reinterpret_cast<const char*>(data), size);
   }
 
 private:
+  /**
+   * @brief Walks read the dataset without the GIL, so changing it from another thread (or from the callable of a walk)
+   *        would change it under them.
+   * */
+  void check_not_walking() const
+  {
+    if (m_walks != 0) {
+      throw std::runtime_error("a dataset can't be changed while it is being walked");
+    }
+  }
+
   toke_dataset_z* m_self{};
+
+  /**
+   * @brief The number of walks in flight, which is only touched with the GIL held.
+   * */
+  mutable std::size_t m_walks{};
+};
+
+class ShardWriter final
+{
+public:
+  ShardWriter()
+    : m_self(toke_shard_writer_new())
+  {
+    if (!m_self) {
+      throw std::runtime_error("failed to allocate shard writer");
+    }
+  }
+
+  ShardWriter(const ShardWriter&) = delete;
+
+  auto operator=(const ShardWriter&) -> ShardWriter& = delete;
+
+  ~ShardWriter() { toke_shard_writer_delete(m_self); }
+
+  void set_max_tokens(const std::size_t max_tokens) { toke_shard_writer_set_max_tokens(m_self, max_tokens); }
+
+  void set_ordered(const bool ordered)
+  {
+    toke_shard_writer_set_order(m_self, ordered ? TOKE_SHARD_ORDERED : TOKE_SHARD_UNORDERED);
+  }
+
+  void write(const Dataset& dataset,
+             const py::handle& encoder,
+             const std::string& prefix,
+             const std::size_t max_threads)
+  {
+    auto* encoder_ptr = get_encoder(encoder);
+
+    const WalkScope scope(dataset.walks());
+
+    toke_error_z err{};
+    {
+      py::gil_scoped_release release;
+      err = toke_shard_writer_write(m_self, dataset.get(), encoder_ptr, prefix.c_str(), walk_threads(max_threads));
+    }
+    throw_if_error(err);
+  }
+
+  [[nodiscard]] auto num_shards() const -> std::size_t { return toke_shard_writer_num_shards(m_self); }
+
+  [[nodiscard]] auto num_documents() const -> std::size_t { return toke_shard_writer_num_documents(m_self); }
+
+  [[nodiscard]] auto num_tokens() const -> std::size_t { return toke_shard_writer_num_tokens(m_self); }
+
+private:
+  toke_shard_writer_z* m_self{};
+};
+
+using TokenArray = py::array_t<std::uint16_t, py::array::c_style>;
+
+class TokenShards final
+{
+public:
+  explicit TokenShards(const std::string& prefix)
+    : m_self(toke_token_shards_new())
+  {
+    if (!m_self) {
+      throw std::runtime_error("failed to allocate token shards");
+    }
+
+    const auto err = toke_token_shards_open(m_self, prefix.c_str());
+    if (err != TOKE_ERROR_NONE) {
+      toke_token_shards_delete(m_self);
+      throw_if_error(err);
+    }
+
+    // where each shard starts among all the tokens, for finding the shard of a drawn window
+    std::uint64_t start = 0;
+    for (std::size_t i = 0; i < num_shards(); i++) {
+      m_shard_starts.push_back(start);
+      std::size_t num_tokens{};
+      toke_token_shards_get_shard(m_self, i, &num_tokens);
+      start += num_tokens;
+    }
+  }
+
+  TokenShards(const TokenShards&) = delete;
+
+  auto operator=(const TokenShards&) -> TokenShards& = delete;
+
+  ~TokenShards() { toke_token_shards_delete(m_self); }
+
+  [[nodiscard]] auto num_shards() const -> std::size_t { return toke_token_shards_num_shards(m_self); }
+
+  [[nodiscard]] auto num_documents() const -> std::size_t { return toke_token_shards_num_documents(m_self); }
+
+  [[nodiscard]] auto num_tokens() const -> std::size_t { return toke_token_shards_num_tokens(m_self); }
+
+  [[nodiscard]] auto num_windows(const std::size_t window_size) const -> std::size_t
+  {
+    return toke_token_shards_num_windows(m_self, window_size);
+  }
+
+  [[nodiscard]] auto shard(const std::size_t index, std::size_t* num_tokens) const -> const std::uint16_t*
+  {
+    if (index >= num_shards()) {
+      throw py::index_error("shard index out of range");
+    }
+    return toke_token_shards_get_shard(m_self, index, num_tokens);
+  }
+
+  [[nodiscard]] auto document(const std::size_t index, std::size_t* num_tokens) const -> const std::uint16_t*
+  {
+    if (index >= num_documents()) {
+      throw py::index_error("document index out of range");
+    }
+    return toke_token_shards_get_document(m_self, index, num_tokens, nullptr, nullptr);
+  }
+
+  [[nodiscard]] auto window(const std::size_t shard_index, const std::size_t start, const std::size_t size) const
+    -> const std::uint16_t*
+  {
+    std::size_t num_tokens{};
+    const auto* tokens = shard(shard_index, &num_tokens);
+    if ((start > num_tokens) || (size > (num_tokens - start))) {
+      throw py::index_error("window out of range of the shard");
+    }
+    return tokens + start;
+  }
+
+  /**
+   * @brief Gets the tokens of a window drawn by the sampler, given its position among all the tokens.
+   * */
+  [[nodiscard]] auto drawn_window(const std::uint64_t start) const -> const std::uint16_t*
+  {
+    const auto it = std::upper_bound(m_shard_starts.begin(), m_shard_starts.end(), start);
+    const auto shard_index = static_cast<std::size_t>((it - m_shard_starts.begin()) - 1);
+    std::size_t num_tokens{};
+    return shard(shard_index, &num_tokens) + (start - m_shard_starts[shard_index]);
+  }
+
+  void sample(const std::size_t window_size,
+              const std::size_t count,
+              std::uint64_t* rng_state,
+              std::uint16_t* output,
+              std::uint64_t* starts) const
+  {
+    if (num_windows(window_size) == 0) {
+      throw py::value_error("no shard is large enough to hold a window");
+    }
+
+    toke_error_z err{};
+    {
+      py::gil_scoped_release release;
+      err = toke_token_shards_sample(m_self, window_size, count, rng_state, output, starts);
+    }
+    throw_if_error(err);
+  }
+
+private:
+  toke_token_shards_z* m_self{};
+
+  std::vector<std::uint64_t> m_shard_starts;
+};
+
+/**
+ * @brief Wraps tokens that point into the mappings of the shards as a read-only array, which keeps the shards open for
+ *        as long as it lives.
+ *
+ * @details The shards are the base object of the array, which holds a reference to them. The shards don't export a
+ *          buffer, so numpy won't let the array be made writeable again, which would fault on the read-only mapping.
+ * */
+[[nodiscard]] auto
+make_view(const std::uint16_t* tokens, const std::size_t num_tokens, const py::object& shards) -> TokenArray
+{
+  // empty documents have no tokens to point to, but numpy still wants an address
+  static const std::uint16_t empty{};
+
+  TokenArray result(std::array<py::ssize_t, 1>{ static_cast<py::ssize_t>(num_tokens) },
+                    std::array<py::ssize_t, 1>{ static_cast<py::ssize_t>(sizeof(std::uint16_t)) },
+                    tokens ? tokens : &empty,
+                    shards);
+
+  result.attr("flags").attr("writeable") = false;
+
+  return result;
+}
+
+/**
+ * @brief Draws batches of windows from token shards, for feeding a training loop.
+ * */
+class TokenSampler final
+{
+public:
+  TokenSampler(py::object shards, const std::size_t batch_size, const std::size_t window_size, const std::uint64_t seed)
+    : m_shards(std::move(shards))
+    , m_batch_size(batch_size)
+    , m_window_size(window_size)
+    , m_rng_state(seed)
+  {
+    if ((batch_size == 0) || (window_size == 0)) {
+      throw py::value_error("batch size and window size must be positive");
+    }
+  }
+
+  /**
+   * @brief Copies the next batch into an array of shape (batch size, window size).
+   * */
+  [[nodiscard]] auto next() -> TokenArray
+  {
+    TokenArray result(std::array<py::ssize_t, 2>{ static_cast<py::ssize_t>(m_batch_size),
+                                                  static_cast<py::ssize_t>(m_window_size) });
+
+    const auto& shards = m_shards.cast<const TokenShards&>();
+
+    shards.sample(m_window_size, m_batch_size, &m_rng_state, result.mutable_data(), nullptr);
+
+    return result;
+  }
+
+  /**
+   * @brief Draws the next batch as a list of views into the shards, rather than copying it.
+   * */
+  [[nodiscard]] auto next_views() -> py::list
+  {
+    const auto& shards = m_shards.cast<const TokenShards&>();
+
+    std::vector<std::uint64_t> starts(m_batch_size);
+
+    shards.sample(m_window_size, m_batch_size, &m_rng_state, nullptr, starts.data());
+
+    py::list result;
+
+    for (const auto start : starts) {
+      result.append(make_view(shards.drawn_window(start), m_window_size, m_shards));
+    }
+
+    return result;
+  }
+
+  [[nodiscard]] auto rng_state() const -> std::uint64_t { return m_rng_state; }
+
+  void set_rng_state(const std::uint64_t state) { m_rng_state = state; }
+
+private:
+  py::object m_shards;
+
+  std::size_t m_batch_size{};
+
+  std::size_t m_window_size{};
+
+  std::uint64_t m_rng_state{};
 };
 
 } // namespace
@@ -41,7 +843,101 @@ def_train_model(pybind11::module_& parent_m)
 {
   auto m = parent_m.def_submodule("train", "Used for training new tokenizers.");
 
-  py::class_<Dataset>(m, "Dataset").def(py::init<>()).def("open", &Dataset::open, py::arg("filename"));
+  py::class_<Dedup>(m, "Dedup")
+    .def(py::init<>())
+    .def("clear", &Dedup::clear)
+    .def_property_readonly("num_unique", &Dedup::num_unique)
+    .def_property_readonly("num_duplicates", &Dedup::num_duplicates)
+    .def_property_readonly("duplicate_bytes", &Dedup::duplicate_bytes);
+
+  py::class_<Dataset>(m, "Dataset")
+    .def(py::init<>())
+    .def("open", &Dataset::open, py::arg("filename"))
+    .def("set_chunking", &Dataset::set_chunking, py::arg("chunk_size"), py::arg("delimiter") = std::uint8_t('\n'))
+    .def("set_readahead", &Dataset::set_readahead, py::arg("readahead"))
+    .def("set_jsonl_field", &Dataset::set_jsonl_field, py::arg("field"))
+    // the dataset only points at the set, so the set is kept alive for as long as the dataset is
+    .def("set_dedup", &Dataset::set_dedup, py::arg("dedup").none(true), py::keep_alive<1, 2>())
+    .def("set_sampling",
+         &Dataset::set_sampling,
+         py::arg("fraction") = 1.0,
+         py::arg("max_bytes") = 0,
+         py::arg("seed") = 0)
+    // every walk runs without the GIL, which only walk() takes back, once for each batch of texts it hands over, and
+    // nothing that changes the dataset can be called until every walk of it is done
+    .def("count", &Dataset::count, py::arg("max_threads") = 0)
+    .def("codepoint_histogram", &Dataset::codepoint_histogram, py::arg("max_threads") = 0)
+    .def("walk", &Dataset::walk, py::arg("callback"), py::arg("max_threads") = 0)
+    .def("__len__", &Dataset::size)
+    .def("__getitem__", &Dataset::at, py::arg("index"));
+
+  py::class_<ShardWriter>(m, "ShardWriter")
+    .def(py::init<>())
+    .def("set_max_tokens", &ShardWriter::set_max_tokens, py::arg("max_tokens"))
+    .def("set_ordered", &ShardWriter::set_ordered, py::arg("ordered"))
+    .def("write",
+         &ShardWriter::write,
+         py::arg("dataset"),
+         py::arg("encoder"),
+         py::arg("prefix"),
+         py::arg("max_threads") = 0)
+    .def_property_readonly("num_shards", &ShardWriter::num_shards)
+    .def_property_readonly("num_documents", &ShardWriter::num_documents)
+    .def_property_readonly("num_tokens", &ShardWriter::num_tokens);
+
+  py::class_<TokenShards>(m, "TokenShards")
+    .def(py::init<const std::string&>(), py::arg("prefix"))
+    .def_property_readonly("num_shards", &TokenShards::num_shards)
+    .def_property_readonly("num_tokens", &TokenShards::num_tokens)
+    .def("__len__", &TokenShards::num_documents)
+    .def("num_windows", &TokenShards::num_windows, py::arg("window_size"))
+    .def(
+      "document",
+      [](const py::object& self, const std::size_t index) {
+        std::size_t num_tokens{};
+        const auto* tokens = self.cast<const TokenShards&>().document(index, &num_tokens);
+        return make_view(tokens, num_tokens, self);
+      },
+      py::arg("index"))
+    .def(
+      "__getitem__",
+      [](const py::object& self, const std::size_t index) {
+        std::size_t num_tokens{};
+        const auto* tokens = self.cast<const TokenShards&>().document(index, &num_tokens);
+        return make_view(tokens, num_tokens, self);
+      },
+      py::arg("index"))
+    .def(
+      "shard",
+      [](const py::object& self, const std::size_t index) {
+        std::size_t num_tokens{};
+        const auto* tokens = self.cast<const TokenShards&>().shard(index, &num_tokens);
+        return make_view(tokens, num_tokens, self);
+      },
+      py::arg("index"))
+    .def(
+      "window",
+      [](const py::object& self, const std::size_t shard, const std::size_t start, const std::size_t size) {
+        return make_view(self.cast<const TokenShards&>().window(shard, start, size), size, self);
+      },
+      py::arg("shard"),
+      py::arg("start"),
+      py::arg("size"))
+    .def(
+      "sampler",
+      // the sampler holds a reference to the shards, as do the views it draws, so neither outlives the mapping
+      [](const py::object& self, const std::size_t batch_size, const std::size_t window_size, std::uint64_t seed) {
+        return TokenSampler(self, batch_size, window_size, seed);
+      },
+      py::arg("batch_size"),
+      py::arg("window_size"),
+      py::arg("seed") = 0);
+
+  py::class_<TokenSampler>(m, "TokenSampler")
+    .def("__iter__", [](py::object self) { return self; })
+    .def("__next__", &TokenSampler::next)
+    .def("next_views", &TokenSampler::next_views)
+    .def_property("rng_state", &TokenSampler::rng_state, &TokenSampler::set_rng_state);
 }
 
 } // namespace toke
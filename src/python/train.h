@@ -2,9 +2,17 @@
 
 #include <pybind11/pybind11.h>
 
+#include <toke/encoder.h>
+
 namespace toke {
 
 void
 def_train_model(pybind11::module_& m);
 
+/**
+ * @brief Gets the encoder wrapped by a Python encoder, which stays owned by the Python object.
+ * */
+auto
+get_encoder(const pybind11::handle& encoder) -> toke_encoder_z*;
+
 } // namespace toke
@@ -1,23 +1,20 @@
-#include <toke/train/dataset.h>
+#include "dataset_internal.h"
+#include "directory.h"
 
-#include "memmap.h"
+#include <omp.h>
+
+#include <sys/stat.h>
 
-#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 
-#include <stdio.h>
-
-#define TAR_MAGIC "ustar\0"
+#define DEFAULT_READAHEAD (64 * 1024 * 1024)
 
-#define BLOCK_SIZE 512
-
-#define MAX_UNICODE_CODEPOINTS 0x10FFFF
-
-struct toke_dataset
-{
-  toke_memmap_z* file;
-};
+/**
+ * @brief The size that the state of each thread of a reducing walk is rounded up to, so that no two threads write to
+ *        the same cache line.
+ * */
+#define CACHE_LINE_SIZE 64
 
 toke_dataset_z*
 toke_dataset_new()
@@ -26,164 +23,608 @@ toke_dataset_new()
   if (!self) {
     return NULL;
   }
+  self->format = DATASET_FORMAT_TAR;
   self->file = NULL;
+  self->compression = TOKE_COMPRESSION_NONE;
+  self->members = NULL;
+  self->num_members = 0;
+  self->paths = NULL;
+  self->num_paths = 0;
+  self->jsonl_field = NULL;
+  self->chunk_size = 0;
+  self->chunk_delimiter = '\n';
+  self->readahead = DEFAULT_READAHEAD;
+  self->dedup = NULL;
+  self->sample_fraction = 1.0;
+  self->sample_bytes = 0;
+  self->sample_seed = 0;
   return self;
 }
 
+/**
+ * @brief Closes whatever the dataset has open, leaving it as a new one would be.
+ * */
+static void
+close_dataset(toke_dataset_z* self)
+{
+  if (self->file) {
+    toke_memmap_close(self->file);
+  }
+
+  free(self->members);
+
+  toke_directory_free(self->paths, self->num_paths);
+
+  self->format = DATASET_FORMAT_TAR;
+  self->file = NULL;
+  self->compression = TOKE_COMPRESSION_NONE;
+  self->members = NULL;
+  self->num_members = 0;
+  self->paths = NULL;
+  self->num_paths = 0;
+}
+
 void
 toke_dataset_delete(toke_dataset_z* self)
 {
   if (self) {
+    close_dataset(self);
+    free(self->jsonl_field);
+  }
+
+  free(self);
+}
+
+/**
+ * @brief Finds whether a file holds a tar archive or JSON lines, by looking at its start once decompressed.
+ *
+ * @details JSON lines start with an object, which a tar archive can't, since it starts with a file name. Anything else
+ *          is taken to be an archive, so that a malformed one is reported as such.
+ * */
+static toke_error_z
+detect_format(const uint8_t* data,
+              const size_t size,
+              const enum toke_compression compression,
+              enum dataset_format* format)
+{
+  uint8_t head[TOKE_TAR_BLOCK_SIZE];
+
+  size_t head_size = (size < TOKE_TAR_BLOCK_SIZE) ? size : TOKE_TAR_BLOCK_SIZE;
+
+  if (compression == TOKE_COMPRESSION_NONE) {
+    if (head_size > 0) {
+      memcpy(head, data, head_size);
+    }
+  } else {
+
+    toke_decompressor_z* decompressor = toke_decompressor_new(compression, data, size);
+    if (!decompressor) {
+      return TOKE_ERROR_MEMORY_ALLOCATION;
+    }
+
+    const toke_error_z err = toke_decompressor_read(decompressor, head, TOKE_TAR_BLOCK_SIZE, &head_size);
 
-    if (self->file) {
-      toke_memmap_close(self->file);
+    toke_decompressor_delete(decompressor);
+
+    if (err != TOKE_ERROR_NONE) {
+      return err;
     }
   }
 
-  free(self);
+  size_t i = 0;
+
+  while ((i < head_size) && ((head[i] == ' ') || (head[i] == '\t') || (head[i] == '\r') || (head[i] == '\n'))) {
+    i++;
+  }
+
+  *format = ((i < head_size) && (head[i] == '{')) ? DATASET_FORMAT_JSONL : DATASET_FORMAT_TAR;
+
+  return TOKE_ERROR_NONE;
+}
+
+static toke_error_z
+open_directory(toke_dataset_z* self, const char* path)
+{
+  char** paths = NULL;
+
+  size_t num_paths = 0;
+
+  const toke_error_z err = toke_directory_list(path, &paths, &num_paths);
+  if (err != TOKE_ERROR_NONE) {
+    return err;
+  }
+
+  close_dataset(self);
+
+  self->format = DATASET_FORMAT_DIRECTORY;
+  self->paths = paths;
+  self->num_paths = num_paths;
+
+  return TOKE_ERROR_NONE;
 }
 
 toke_error_z
 toke_dataset_open(toke_dataset_z* self, const char* filename)
 {
+  struct stat archive_stat;
+  if (stat(filename, &archive_stat) != 0) {
+    return TOKE_ERROR_FILE_NOT_FOUND;
+  }
+
+  if (S_ISDIR(archive_stat.st_mode)) {
+    return open_directory(self, filename);
+  }
+
   toke_memmap_z* file = toke_memmap_open(filename);
   if (!file) {
     return TOKE_ERROR_FILE_NOT_FOUND;
   }
 
-  if (self->file) {
-    toke_memmap_close(self->file);
+  const uint8_t* ptr = toke_memmap_ptr(file);
+
+  const size_t file_size = toke_memmap_size(file);
+
+  const enum toke_compression compression = toke_compression_detect(ptr, file_size);
+
+  if (!toke_compression_supported(compression)) {
+    toke_memmap_close(file);
+    return TOKE_ERROR_UNSUPPORTED_COMPRESSION;
+  }
+
+  enum dataset_format format = DATASET_FORMAT_TAR;
+
+  toke_error_z err = detect_format(ptr, file_size, compression, &format);
+  if (err != TOKE_ERROR_NONE) {
+    toke_memmap_close(file);
+    return err;
+  }
+
+  if ((compression != TOKE_COMPRESSION_NONE) || (format == DATASET_FORMAT_JSONL)) {
+
+    // the file is read once per walk, from start to end, and isn't indexed
+    toke_memmap_advise(file, 0, file_size, TOKE_MEMMAP_SEQUENTIAL);
+
+    close_dataset(self);
+
+    self->format = format;
+    self->file = file;
+    self->compression = compression;
+
+    return TOKE_ERROR_NONE;
   }
 
+  struct tar_member* members = NULL;
+
+  size_t num_members = 0;
+
+  err = toke_tar_index(filename, &archive_stat, ptr, file_size, &members, &num_members);
+
+  if (err != TOKE_ERROR_NONE) {
+    toke_memmap_close(file);
+    return err;
+  }
+
+  close_dataset(self);
+
   self->file = file;
+  self->members = members;
+  self->num_members = num_members;
 
   return TOKE_ERROR_NONE;
 }
 
-static size_t
-parse_size(const char* octets)
+toke_error_z
+toke_dataset_set_jsonl_field(toke_dataset_z* self, const char* field)
 {
-  size_t result = 0;
+  const size_t size = strlen(field);
 
-  for (size_t i = 0; i < 11; i++) {
+  char* copy = malloc(size + 1);
+  if (!copy) {
+    return TOKE_ERROR_MEMORY_ALLOCATION;
+  }
 
-    const char value = octets[i] - '0';
+  memcpy(copy, field, size + 1);
 
-    printf("%d (%d)\n", (int)value, (int)result);
+  free(self->jsonl_field);
 
-    if ((value < 0) || (value > 7)) {
-      return 0;
-    }
+  self->jsonl_field = copy;
+
+  return TOKE_ERROR_NONE;
+}
+
+size_t
+toke_dataset_size(const toke_dataset_z* self)
+{
+  return self->num_members;
+}
 
-    result *= 8;
-    result += (size_t)value;
+const uint8_t*
+toke_dataset_get(const toke_dataset_z* self, const size_t index, size_t* size)
+{
+  if (index >= self->num_members) {
+    return NULL;
   }
 
-  return result;
+  const uint8_t* ptr = toke_memmap_ptr(self->file);
+
+  *size = (size_t)self->members[index].size;
+
+  return ptr + self->members[index].offset;
 }
 
-struct job
+int
+toke_dataset_contains(const toke_dataset_z* self, const uint8_t* text, const size_t size)
 {
-  const uint8_t* text;
+  if (!self->file || !text) {
+    return 0;
+  }
 
-  size_t text_size;
+  // compared as addresses, since a text that isn't in the mapping is in some other object
+  const uintptr_t begin = (uintptr_t)toke_memmap_ptr(self->file);
+  const uintptr_t end = begin + toke_memmap_size(self->file);
+  const uintptr_t start = (uintptr_t)text;
 
-  size_t file_index;
-};
+  return (start >= begin) && (start <= end) && (size <= (end - start));
+}
 
-typedef struct job job_z;
+void
+toke_dataset_set_chunking(toke_dataset_z* self, const size_t chunk_size, const uint8_t delimiter)
+{
+  self->chunk_size = chunk_size;
+  self->chunk_delimiter = delimiter;
+}
 
-static void
-run_jobs(const job_z* jobs, const size_t num_jobs, void* walker_data, toke_dataset_walker walker)
+size_t
+toke_dataset_chunk_end(const uint8_t* text,
+                       const size_t size,
+                       const size_t offset,
+                       const size_t chunk_size,
+                       const uint8_t delimiter)
+{
+  if ((chunk_size == 0) || ((size - offset) <= chunk_size)) {
+    return size;
+  }
+
+  const uint8_t* next = memchr(text + offset + chunk_size, delimiter, size - (offset + chunk_size));
+
+  return next ? (size_t)(next - text) + 1 : size;
+}
+
+void
+toke_dataset_set_readahead(toke_dataset_z* self, const size_t readahead)
 {
-#pragma omp parallel for
+  self->readahead = readahead;
+}
 
-  for (int i = 0; i < (int)num_jobs; i++) {
+void
+toke_dataset_set_dedup(toke_dataset_z* self, toke_dedup_z* dedup)
+{
+  self->dedup = dedup;
+}
 
-    const job_z* job = jobs + i;
+void
+toke_dataset_set_sampling(toke_dataset_z* self, const double fraction, const size_t max_bytes, const uint64_t seed)
+{
+  self->sample_fraction = fraction;
+  self->sample_bytes = max_bytes;
+  self->sample_seed = seed;
+}
 
-    walker(walker_data, job->text, job->text_size, job->file_index, /*thread_index=*/i);
+void
+toke_sampler_init(struct sampler* self, const toke_dataset_z* dataset)
+{
+  const double fraction = dataset->sample_fraction;
+
+  self->all = fraction >= 1.0;
+  // 2^64, which scales the fraction to the range of the hash
+  self->threshold = (fraction > 0.0) && !self->all ? (uint64_t)(fraction * 18446744073709551616.0) : 0;
+  self->seed = dataset->sample_seed;
+  self->max_bytes = dataset->sample_bytes;
+  self->picked_bytes = 0;
+}
+
+int
+toke_sampler_picks(const struct sampler* self, const size_t index)
+{
+  if (self->all) {
+    return 1;
   }
+
+  uint64_t z = self->seed + (((uint64_t)index + 1) * 0x9e3779b97f4a7c15ull);
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+  z = z ^ (z >> 31);
+
+  return z < self->threshold;
+}
+
+int
+toke_sampler_done(const struct sampler* self)
+{
+  return (self->max_bytes != 0) && (self->picked_bytes >= self->max_bytes);
+}
+
+int
+toke_sampler_take(struct sampler* self, const size_t index, const size_t size)
+{
+  if (!toke_sampler_picks(self, index)) {
+    return 0;
+  }
+
+  self->picked_bytes += size;
+
+  return 1;
 }
 
 toke_error_z
-toke_dataset_walk(const toke_dataset_z* self, const size_t max_threads, void* walker_data, toke_dataset_walker walker)
+toke_dataset_walk_all(const toke_dataset_z* self,
+                      const size_t max_threads,
+                      void* walker_data,
+                      toke_dataset_walker walker)
 {
+  struct sampler sampler;
+  toke_sampler_init(&sampler, self);
+
+  if (self->format == DATASET_FORMAT_DIRECTORY) {
+    return toke_directory_walk(self, max_threads, &sampler, walker_data, walker);
+  }
+
   if (!self->file) {
     return TOKE_ERROR_FILE_NOT_FOUND;
   }
 
-  job_z* jobs = malloc(max_threads * sizeof(job_z));
-  if (!jobs) {
-    return TOKE_ERROR_MEMORY_ALLOCATION;
+  if (self->format == DATASET_FORMAT_JSONL) {
+
+    struct jsonl_walk jsonl;
+
+    toke_error_z err = toke_jsonl_walk_init(&jsonl, self, &sampler, max_threads);
+
+    if (err == TOKE_ERROR_NONE) {
+
+      if (self->compression != TOKE_COMPRESSION_NONE) {
+        err = toke_compressed_walk(self, max_threads, &sampler, &jsonl, walker_data, walker);
+      } else {
+        toke_jsonl_walk_mapped(self, max_threads, &sampler, &jsonl, walker_data, walker);
+      }
+
+      if (err == TOKE_ERROR_NONE) {
+        err = jsonl.err;
+      }
+    }
+
+    toke_jsonl_walk_free(&jsonl, max_threads);
+
+    return err;
   }
 
-  size_t num_jobs = 0;
+  if (self->compression != TOKE_COMPRESSION_NONE) {
+    return toke_compressed_walk(self, max_threads, &sampler, NULL, walker_data, walker);
+  }
 
-  size_t offset = 0;
+  toke_tar_walk(self, max_threads, &sampler, walker_data, walker);
 
-  const size_t file_size = toke_memmap_size(self->file);
+  return TOKE_ERROR_NONE;
+}
 
-  const uint8_t* ptr = toke_memmap_ptr(self->file);
-  if (!ptr) {
-    free(jobs);
-    return TOKE_ERROR_FILE_NOT_FOUND;
+/**
+ * @brief Stands in for the walker when the walk skips duplicates, passing on only the texts that are new to the set.
+ * */
+struct dedup_walk
+{
+  toke_dedup_z* dedup;
+
+  void* walker_data;
+
+  toke_dataset_walker walker;
+
+  toke_error_z err;
+};
+
+static void
+walk_unique(void* user_data,
+            const uint8_t* text,
+            const size_t text_size,
+            const size_t file_index,
+            const size_t offset,
+            const size_t thread_index)
+{
+  struct dedup_walk* self = user_data;
+
+  int is_new = 0;
+
+  const toke_error_z err = toke_dedup_insert(self->dedup, text, text_size, &is_new);
+
+  if (err != TOKE_ERROR_NONE) {
+#pragma omp atomic write
+    self->err = err;
   }
 
-  size_t file_index = 0;
+  if (is_new) {
+    self->walker(self->walker_data, text, text_size, file_index, offset, thread_index);
+  }
+}
 
-  while (offset < file_size) {
+toke_error_z
+toke_dataset_walk(const toke_dataset_z* self, size_t max_threads, void* walker_data, toke_dataset_walker walker)
+{
+  if (max_threads == 0) {
+    max_threads = 1;
+  }
 
-    const size_t remaining = file_size - offset;
-    if (remaining < BLOCK_SIZE) {
-      break;
-    }
+  if (!self->dedup) {
+    return toke_dataset_walk_all(self, max_threads, walker_data, walker);
+  }
 
-    const uint8_t* header = ptr + offset;
+  struct dedup_walk dedup;
+  dedup.dedup = self->dedup;
+  dedup.walker_data = walker_data;
+  dedup.walker = walker;
+  dedup.err = TOKE_ERROR_NONE;
 
-    const char* magic = (const char*)(header + 257);
-    if (memcmp("ustar\0", magic, 6) != 0) {
-      free(jobs);
-      return TOKE_ERROR_FILE_IO;
-    }
+  const toke_error_z err = toke_dataset_walk_all(self, max_threads, &dedup, walk_unique);
 
-    const size_t size = parse_size((const char*)(header + 124));
-    if (!size) {
-      free(jobs);
-      return TOKE_ERROR_FILE_IO;
-    }
+  return (err != TOKE_ERROR_NONE) ? err : dedup.err;
+}
+
+/**
+ * @brief Stands in for the walker of a reducing walk, passing each text on with the state of the calling thread.
+ * */
+struct reduce_walk
+{
+  const toke_dataset_reducer_z* reducer;
+
+  void* user_data;
+
+  uint8_t* states;
 
-    const size_t num_blocks = (size + (BLOCK_SIZE - 1)) / BLOCK_SIZE;
+  size_t stride;
+};
+
+static void
+walk_reduced(void* user_data,
+             const uint8_t* text,
+             const size_t text_size,
+             const size_t file_index,
+             const size_t offset,
+             const size_t thread_index)
+{
+  const struct reduce_walk* self = user_data;
 
-    const uint8_t type = header[156];
+  void* state = self->states + (thread_index * self->stride);
 
-    if ((type == 0) || (type == '0')) {
+  self->reducer->walk(self->user_data, state, text, text_size, file_index, offset);
+}
+
+/**
+ * @brief Zeroes a state and sets it up, marking it as ready to be finalized if that worked.
+ * */
+static toke_error_z
+init_state(const struct reduce_walk* self, const size_t index, int* ready)
+{
+  void* state = self->states + (index * self->stride);
 
-      // this is a regular file, add it to the queue
+  memset(state, 0, self->stride);
 
-      job_z* next_job = &jobs[num_jobs];
-      next_job->file_index = file_index;
-      next_job->text = ptr + offset + BLOCK_SIZE;
-      next_job->text_size = size;
+  const toke_error_z err = self->reducer->init ? self->reducer->init(self->user_data, state, index) : TOKE_ERROR_NONE;
 
-      num_jobs++;
+  *ready = err == TOKE_ERROR_NONE;
 
-      if (num_jobs == max_threads) {
-        run_jobs(jobs, num_jobs, walker_data, walker);
-        num_jobs = 0;
+  return err;
+}
+
+/**
+ * @brief Merges the states in pairs, round by round, until the first one holds all of them.
+ * */
+static toke_error_z
+merge_states(const struct reduce_walk* self, const size_t num_states)
+{
+  toke_error_z err = TOKE_ERROR_NONE;
+
+#pragma omp parallel num_threads((int)num_states)
+  {
+#pragma omp single
+    {
+      for (size_t step = 1; (step < num_states) && (err == TOKE_ERROR_NONE); step *= 2) {
+
+        for (size_t i = 0; (i + step) < num_states; i += step * 2) {
+
+#pragma omp task firstprivate(i, step)
+          {
+            void* target = self->states + (i * self->stride);
+
+            void* source = self->states + ((i + step) * self->stride);
+
+            const toke_error_z merge_err = self->reducer->merge(self->user_data, target, source);
+
+            if (merge_err != TOKE_ERROR_NONE) {
+#pragma omp atomic write
+              err = merge_err;
+            }
+          }
+        }
+
+        // the next round merges what this one produced
+#pragma omp taskwait
       }
     }
+  }
 
-    offset += /* header_block + file_data_blocks */ (1 + num_blocks) * BLOCK_SIZE;
+  return err;
+}
 
-    printf("%.*s (size_str=%.*s) (size=%d)\n", (int)6, magic, (int)12, (const char*)(header + 124), (int)size);
+toke_error_z
+toke_dataset_walk_reduce(const toke_dataset_z* self,
+                         size_t max_threads,
+                         const toke_dataset_reducer_z* reducer,
+                         void* user_data,
+                         void* result)
+{
+  if (max_threads == 0) {
+    max_threads = 1;
   }
 
-  if (num_jobs > 0) {
-    run_jobs(jobs, num_jobs, walker_data, walker);
+  // at least one line, so that even an empty state has an address of its own
+  const size_t stride = ((reducer->state_size / CACHE_LINE_SIZE) + 1) * CACHE_LINE_SIZE;
+
+  struct reduce_walk walk_state;
+  walk_state.reducer = reducer;
+  walk_state.user_data = user_data;
+  walk_state.states = aligned_alloc(CACHE_LINE_SIZE, max_threads * stride);
+  walk_state.stride = stride;
+
+  int* ready = calloc(max_threads, sizeof(int));
+
+  if (!walk_state.states || !ready) {
+    free(walk_state.states);
+    free(ready);
+    return TOKE_ERROR_MEMORY_ALLOCATION;
   }
 
-  free(jobs);
+  toke_error_z err = TOKE_ERROR_NONE;
 
-  return TOKE_ERROR_NONE;
+  // each thread sets up its own state, so that it is first touched by the thread that writes to it
+#pragma omp parallel num_threads((int)max_threads)
+  {
+    const size_t thread_index = (size_t)omp_get_thread_num();
+
+    const toke_error_z init_err = init_state(&walk_state, thread_index, &ready[thread_index]);
+
+    if (init_err != TOKE_ERROR_NONE) {
+#pragma omp atomic write
+      err = init_err;
+    }
+  }
+
+  // the runtime may have handed out fewer threads than were asked for, but the walk could still get them all
+  for (size_t i = 0; (i < max_threads) && (err == TOKE_ERROR_NONE); i++) {
+    if (!ready[i]) {
+      err = init_state(&walk_state, i, &ready[i]);
+    }
+  }
+
+  if (err == TOKE_ERROR_NONE) {
+    err = toke_dataset_walk(self, max_threads, &walk_state, walk_reduced);
+  }
+
+  if ((err == TOKE_ERROR_NONE) && reducer->merge) {
+
+    err = merge_states(&walk_state, max_threads);
+
+    if ((err == TOKE_ERROR_NONE) && result) {
+      err = reducer->merge(user_data, result, walk_state.states);
+    }
+  }
+
+  if (reducer->finalize) {
+    for (size_t i = 0; i < max_threads; i++) {
+      if (ready[i]) {
+        reducer->finalize(user_data, walk_state.states + (i * stride));
+      }
+    }
+  }
+
+  free(walk_state.states);
+  free(ready);
+
+  return err;
 }
@@ -0,0 +1,573 @@
+#include "dataset_internal.h"
+
+#include <omp.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief The size of the buffers that files are decompressed into. Files larger than this get a buffer of their own.
+ * */
+#define DECOMPRESSED_BLOCK_SIZE (8 * 1024 * 1024)
+
+/**
+ * @brief A buffer of decompressed files, which is freed once every task walking them has finished.
+ * */
+struct decompressed_block
+{
+  uint8_t* data;
+
+  size_t size;
+
+  size_t capacity;
+
+  /**
+   * @brief The number of tasks using the block, plus one while files are still being added to it.
+   * */
+  size_t refs;
+};
+
+/**
+ * @brief The state shared by the thread decompressing an archive and the tasks walking its files.
+ * */
+struct decompression_pipeline
+{
+  /**
+   * @brief The number of blocks that haven't been freed, which the decompressing thread keeps within a limit.
+   * */
+  size_t blocks_in_flight;
+
+  /**
+   * @brief Blocks of the usual size that have been released, kept to be reused rather than allocated again.
+   * */
+  struct decompressed_block** spare;
+
+  size_t num_spare;
+
+  omp_lock_t spare_lock;
+};
+
+static struct decompressed_block*
+acquire_block(struct decompression_pipeline* pipeline, const size_t min_capacity)
+{
+  struct decompressed_block* block = NULL;
+
+  if (min_capacity <= DECOMPRESSED_BLOCK_SIZE) {
+    omp_set_lock(&pipeline->spare_lock);
+    if (pipeline->num_spare > 0) {
+      pipeline->num_spare--;
+      block = pipeline->spare[pipeline->num_spare];
+    }
+    omp_unset_lock(&pipeline->spare_lock);
+  }
+
+  if (!block) {
+
+    block = malloc(sizeof(struct decompressed_block));
+    if (!block) {
+      return NULL;
+    }
+
+    block->capacity = (min_capacity > DECOMPRESSED_BLOCK_SIZE) ? min_capacity : DECOMPRESSED_BLOCK_SIZE;
+
+    // one more byte, so that an empty block never asks for zero bytes
+    block->data = malloc(block->capacity + 1);
+    if (!block->data) {
+      free(block);
+      return NULL;
+    }
+  }
+
+  block->size = 0;
+  block->refs = 1;
+
+#pragma omp atomic
+  pipeline->blocks_in_flight++;
+
+  return block;
+}
+
+static void
+release_block(struct decompression_pipeline* pipeline, struct decompressed_block* block, const size_t max_spare)
+{
+  size_t refs = 0;
+
+#pragma omp atomic capture
+  refs = --block->refs;
+
+  if (refs > 0) {
+    return;
+  }
+
+  int kept = 0;
+
+  if (block->capacity == DECOMPRESSED_BLOCK_SIZE) {
+    omp_set_lock(&pipeline->spare_lock);
+    if (pipeline->num_spare < max_spare) {
+      pipeline->spare[pipeline->num_spare] = block;
+      pipeline->num_spare++;
+      kept = 1;
+    }
+    omp_unset_lock(&pipeline->spare_lock);
+  }
+
+  if (!kept) {
+    free(block->data);
+    free(block);
+  }
+
+#pragma omp atomic
+  pipeline->blocks_in_flight--;
+}
+
+/**
+ * @brief Decompresses and throws away the given number of bytes.
+ * */
+static toke_error_z
+skip_decompressed(toke_decompressor_z* decompressor, size_t size)
+{
+  uint8_t scratch[4096];
+
+  while (size > 0) {
+
+    const size_t piece = (size < sizeof(scratch)) ? size : sizeof(scratch);
+
+    size_t read_size = 0;
+
+    const toke_error_z err = toke_decompressor_read(decompressor, scratch, piece, &read_size);
+    if (err != TOKE_ERROR_NONE) {
+      return err;
+    }
+
+    if (read_size != piece) {
+      return TOKE_ERROR_FILE_IO;
+    }
+
+    size -= piece;
+  }
+
+  return TOKE_ERROR_NONE;
+}
+
+/**
+ * @brief Queues a task walking text that is in a block, which holds the block until the task has finished.
+ * */
+static void
+queue_decompressed(struct decompression_pipeline* pipeline,
+                   const size_t max_blocks,
+                   struct decompressed_block* block,
+                   const uint8_t* text,
+                   const size_t text_size,
+                   const size_t file_index,
+                   const size_t offset,
+                   void* walker_data,
+                   toke_dataset_walker walker)
+{
+  size_t blocks_in_flight = 0;
+
+#pragma omp atomic read
+  blocks_in_flight = pipeline->blocks_in_flight;
+
+  const int deferred = blocks_in_flight <= max_blocks;
+
+#pragma omp atomic
+  block->refs++;
+
+#pragma omp task if (deferred) firstprivate(block, text, text_size, file_index, offset)
+  {
+    walker(walker_data, text, text_size, file_index, offset, (size_t)omp_get_thread_num());
+
+    release_block(pipeline, block, max_blocks);
+  }
+}
+
+/**
+ * @brief Decompresses a file of a tar archive into blocks, queuing a task for each chunk of it as soon as the chunk is
+ *        whole.
+ *
+ * @details The file is read a block at a time, and the part of it that hasn't been queued yet is carried over to the
+ *          next block, so that with chunking, a file of any size only takes a few blocks at once. Without chunking, the
+ *          file is walked whole, so the block it is read into grows until it fits, but only as the data arrives: a
+ *          size in the header that runs past the end of the stream fails with @ref TOKE_ERROR_FILE_IO once the stream
+ *          ends, rather than being allocated up front.
+ *
+ * @param block_ptr The block to read into, which is replaced by the one that the end of the file was read into.
+ * */
+static toke_error_z
+produce_tar_file(const toke_dataset_z* self,
+                 toke_decompressor_z* decompressor,
+                 struct decompression_pipeline* pipeline,
+                 const size_t max_blocks,
+                 struct decompressed_block** block_ptr,
+                 const size_t size,
+                 const size_t file_index,
+                 void* walker_data,
+                 toke_dataset_walker walker)
+{
+  struct decompressed_block* block = *block_ptr;
+
+  // where the part of the file that hasn't been queued starts, in the block and in the file
+  size_t start = block->size;
+
+  size_t file_offset = 0;
+
+  size_t remaining = size;
+
+  toke_error_z err = TOKE_ERROR_NONE;
+
+  for (;;) {
+
+    if (block->size == block->capacity) {
+
+      const size_t pending = block->size - start;
+
+      // twice the pending part, so that a file walked whole is copied a number of times that grows with the
+      // logarithm of its size, but no more than what is left of the file
+      size_t capacity = 2 * pending;
+      if (capacity > (pending + remaining)) {
+        capacity = pending + remaining;
+      }
+
+      struct decompressed_block* next = acquire_block(pipeline, capacity);
+      if (!next) {
+        err = TOKE_ERROR_MEMORY_ALLOCATION;
+        break;
+      }
+
+      memcpy(next->data, block->data + start, pending);
+      next->size = pending;
+
+      release_block(pipeline, block, max_blocks);
+
+      block = next;
+      start = 0;
+    }
+
+    const size_t space = block->capacity - block->size;
+
+    const size_t piece = (remaining < space) ? remaining : space;
+
+    size_t read_size = 0;
+
+    err = toke_decompressor_read(decompressor, block->data + block->size, piece, &read_size);
+    if ((err == TOKE_ERROR_NONE) && (read_size != piece)) {
+      err = TOKE_ERROR_FILE_IO;
+    }
+
+    if (err != TOKE_ERROR_NONE) {
+      break;
+    }
+
+    block->size += piece;
+    remaining -= piece;
+
+    const uint8_t* text = block->data + start;
+
+    const size_t available = block->size - start;
+
+    size_t offset = 0;
+
+    for (;;) {
+
+      const size_t end = toke_dataset_chunk_end(text, available, offset, self->chunk_size, self->chunk_delimiter);
+
+      // until the file is all read, a chunk that runs to the end of what is there might go on past it
+      if ((remaining > 0) && (end == available)) {
+        break;
+      }
+
+      const size_t chunk_offset = file_offset + offset;
+
+      queue_decompressed(
+        pipeline, max_blocks, block, text + offset, end - offset, file_index, chunk_offset, walker_data, walker);
+
+      offset = end;
+
+      if (offset >= available) {
+        break;
+      }
+    }
+
+    start += offset;
+    file_offset += offset;
+
+    if (remaining == 0) {
+      break;
+    }
+  }
+
+  *block_ptr = block;
+
+  return err;
+}
+
+/**
+ * @brief Decompresses a tar archive file by file, queuing a task for each file (or chunk of one) once it is in a block.
+ * */
+static toke_error_z
+produce_tar_files(const toke_dataset_z* self,
+                  toke_decompressor_z* decompressor,
+                  struct decompression_pipeline* pipeline,
+                  const size_t max_blocks,
+                  struct sampler* sampler,
+                  void* walker_data,
+                  toke_dataset_walker walker)
+{
+  struct decompressed_block* block = NULL;
+
+  uint8_t header[TOKE_TAR_BLOCK_SIZE];
+
+  toke_error_z err = TOKE_ERROR_NONE;
+
+  for (size_t file_index = 0; !toke_sampler_done(sampler);) {
+
+    size_t read_size = 0;
+
+    err = toke_decompressor_read(decompressor, header, TOKE_TAR_BLOCK_SIZE, &read_size);
+    if (err != TOKE_ERROR_NONE) {
+      break;
+    }
+
+    // some writers leave out the zero blocks at the end
+    if ((read_size == 0) || ((read_size == TOKE_TAR_BLOCK_SIZE) && toke_tar_is_zero_block(header))) {
+      break;
+    }
+
+    if (read_size != TOKE_TAR_BLOCK_SIZE) {
+      err = TOKE_ERROR_FILE_IO;
+      break;
+    }
+
+    size_t size = 0;
+
+    size_t num_blocks = 0;
+
+    int is_regular = 0;
+
+    err = toke_tar_read_header(header, &size, &num_blocks, &is_regular);
+    if (err != TOKE_ERROR_NONE) {
+      break;
+    }
+
+    // a stream can't be seeked, so a file that isn't picked is still decompressed, just never copied or walked
+    const int skipped = is_regular && !toke_sampler_take(sampler, file_index, size);
+
+    if (!is_regular || skipped) {
+      err = skip_decompressed(decompressor, num_blocks * TOKE_TAR_BLOCK_SIZE);
+      if (err != TOKE_ERROR_NONE) {
+        break;
+      }
+      file_index += (size_t)skipped;
+      continue;
+    }
+
+    // a file that fits in a block starts a new one rather than straddling two
+    const size_t first_piece = (size < DECOMPRESSED_BLOCK_SIZE) ? size : DECOMPRESSED_BLOCK_SIZE;
+
+    if (!block || ((block->capacity - block->size) < first_piece)) {
+
+      if (block) {
+        release_block(pipeline, block, max_blocks);
+      }
+
+      block = acquire_block(pipeline, first_piece);
+      if (!block) {
+        err = TOKE_ERROR_MEMORY_ALLOCATION;
+        break;
+      }
+    }
+
+    err = produce_tar_file(self, decompressor, pipeline, max_blocks, &block, size, file_index, walker_data, walker);
+
+    if (err == TOKE_ERROR_NONE) {
+      err = skip_decompressed(decompressor, (num_blocks * TOKE_TAR_BLOCK_SIZE) - size);
+    }
+
+    if (err != TOKE_ERROR_NONE) {
+      break;
+    }
+
+    file_index++;
+  }
+
+  if (block) {
+    release_block(pipeline, block, max_blocks);
+  }
+
+  return err;
+}
+
+/**
+ * @brief Decompresses JSON lines a block at a time, queuing a task for the whole lines in each block.
+ *
+ * @details The partial line at the end of a block is carried over to the start of the next one. A line longer than a
+ *          block is given a larger one.
+ * */
+static toke_error_z
+produce_jsonl_lines(toke_decompressor_z* decompressor,
+                    struct decompression_pipeline* pipeline,
+                    const size_t max_blocks,
+                    struct sampler* sampler,
+                    struct jsonl_walk* jsonl,
+                    void* walker_data,
+                    toke_dataset_walker walker)
+{
+  struct decompressed_block* block = acquire_block(pipeline, 0);
+  if (!block) {
+    return TOKE_ERROR_MEMORY_ALLOCATION;
+  }
+
+  toke_error_z err = TOKE_ERROR_NONE;
+
+  size_t first_record = 0;
+
+  while (!toke_jsonl_walk_failed(jsonl)) {
+
+    size_t read_size = 0;
+
+    err = toke_decompressor_read(decompressor, block->data + block->size, block->capacity - block->size, &read_size);
+    if (err != TOKE_ERROR_NONE) {
+      break;
+    }
+
+    block->size += read_size;
+
+    const int finished = block->size < block->capacity;
+
+    size_t lines_size = block->size;
+
+    if (!finished) {
+
+      const uint8_t* last_newline = block->data + block->size;
+
+      while ((last_newline > block->data) && (last_newline[-1] != '\n')) {
+        last_newline--;
+      }
+
+      lines_size = (size_t)(last_newline - block->data);
+    }
+
+    if ((lines_size == 0) && !finished) {
+
+      // the block holds part of a single line, so move it to a larger one and read on
+      struct decompressed_block* larger = acquire_block(pipeline, block->capacity * 2);
+      if (!larger) {
+        err = TOKE_ERROR_MEMORY_ALLOCATION;
+        break;
+      }
+
+      memcpy(larger->data, block->data, block->size);
+      larger->size = block->size;
+
+      release_block(pipeline, block, max_blocks);
+
+      block = larger;
+
+      continue;
+    }
+
+    const uint8_t* text = block->data;
+
+    const size_t record = first_record;
+
+    size_t num_lines = 0;
+
+    const size_t walk_size = toke_jsonl_sample_lines(sampler, text, lines_size, record, &num_lines);
+
+    first_record += num_lines;
+
+    size_t blocks_in_flight = 0;
+
+#pragma omp atomic read
+    blocks_in_flight = pipeline->blocks_in_flight;
+
+    const int deferred = blocks_in_flight <= max_blocks;
+
+#pragma omp atomic
+    block->refs++;
+
+#pragma omp task if (deferred) firstprivate(block, text, walk_size, record)
+    {
+      toke_jsonl_walk_range(jsonl, text, walk_size, record, walker_data, walker);
+
+      release_block(pipeline, block, max_blocks);
+    }
+
+    if (finished || toke_sampler_done(sampler)) {
+      break;
+    }
+
+    struct decompressed_block* next = acquire_block(pipeline, block->size - lines_size);
+    if (!next) {
+      err = TOKE_ERROR_MEMORY_ALLOCATION;
+      break;
+    }
+
+    next->size = block->size - lines_size;
+    memcpy(next->data, block->data + lines_size, next->size);
+
+    release_block(pipeline, block, max_blocks);
+
+    block = next;
+  }
+
+  release_block(pipeline, block, max_blocks);
+
+  return err;
+}
+
+toke_error_z
+toke_compressed_walk(const toke_dataset_z* self,
+                     const size_t max_threads,
+                     struct sampler* sampler,
+                     struct jsonl_walk* jsonl,
+                     void* walker_data,
+                     toke_dataset_walker walker)
+{
+  toke_decompressor_z* decompressor =
+    toke_decompressor_new(self->compression, toke_memmap_ptr(self->file), toke_memmap_size(self->file));
+  if (!decompressor) {
+    return TOKE_ERROR_MEMORY_ALLOCATION;
+  }
+
+  const size_t max_blocks = max_threads + 2;
+
+  struct decompression_pipeline pipeline;
+  pipeline.blocks_in_flight = 0;
+  pipeline.num_spare = 0;
+  pipeline.spare = malloc(max_blocks * sizeof(struct decompressed_block*));
+  if (!pipeline.spare) {
+    toke_decompressor_delete(decompressor);
+    return TOKE_ERROR_MEMORY_ALLOCATION;
+  }
+
+  omp_init_lock(&pipeline.spare_lock);
+
+  toke_error_z err = TOKE_ERROR_NONE;
+
+#pragma omp parallel num_threads((int)max_threads)
+  {
+#pragma omp single
+    {
+      if (self->format == DATASET_FORMAT_JSONL) {
+        err = produce_jsonl_lines(decompressor, &pipeline, max_blocks, sampler, jsonl, walker_data, walker);
+      } else {
+        err = produce_tar_files(self, decompressor, &pipeline, max_blocks, sampler, walker_data, walker);
+      }
+    }
+  }
+
+  for (size_t i = 0; i < pipeline.num_spare; i++) {
+    free(pipeline.spare[i]->data);
+    free(pipeline.spare[i]);
+  }
+
+  free(pipeline.spare);
+
+  omp_destroy_lock(&pipeline.spare_lock);
+
+  toke_decompressor_delete(decompressor);
+
+  return err;
+}
+
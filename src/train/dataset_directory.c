@@ -0,0 +1,121 @@
+#include "dataset_internal.h"
+
+#include <omp.h>
+
+#include <stdlib.h>
+
+/**
+ * @brief A file of a directory, which is unmapped once every task walking it has finished.
+ * */
+struct mapped_file
+{
+  toke_memmap_z* file;
+
+  size_t refs;
+};
+
+static void
+release_mapped_file(struct mapped_file* self, size_t* files_in_flight)
+{
+  size_t refs = 0;
+
+#pragma omp atomic capture
+  refs = --self->refs;
+
+  if (refs > 0) {
+    return;
+  }
+
+  toke_memmap_close(self->file);
+
+  free(self);
+
+#pragma omp atomic
+  (*files_in_flight)--;
+}
+
+toke_error_z
+toke_directory_walk(const toke_dataset_z* self,
+                    const size_t max_threads,
+                    struct sampler* sampler,
+                    void* walker_data,
+                    toke_dataset_walker walker)
+{
+  // open files take up descriptors, so only a few for each thread are kept open
+  const size_t max_files = max_threads * 4;
+
+  size_t files_in_flight = 0;
+
+  size_t* files_in_flight_ptr = &files_in_flight;
+
+  toke_error_z err = TOKE_ERROR_NONE;
+
+#pragma omp parallel num_threads((int)max_threads)
+  {
+#pragma omp single
+    {
+      for (size_t i = 0; (i < self->num_paths) && !toke_sampler_done(sampler); i++) {
+
+        // decided before the file is opened, so that a file that isn't picked is never touched
+        if (!toke_sampler_picks(sampler, i)) {
+          continue;
+        }
+
+        struct mapped_file* mapped = malloc(sizeof(struct mapped_file));
+        if (!mapped) {
+          err = TOKE_ERROR_MEMORY_ALLOCATION;
+          break;
+        }
+
+        mapped->file = toke_memmap_open(self->paths[i]);
+        if (!mapped->file) {
+          free(mapped);
+          err = TOKE_ERROR_FILE_IO;
+          break;
+        }
+
+        mapped->refs = 1;
+
+        const size_t size = toke_memmap_size(mapped->file);
+
+        toke_sampler_take(sampler, i, size);
+
+        // empty files aren't mapped, but are still handed to the walker
+        const uint8_t* text = size ? toke_memmap_ptr(mapped->file) : (const uint8_t*)"";
+
+        toke_memmap_advise(mapped->file, 0, size, TOKE_MEMMAP_SEQUENTIAL);
+
+        size_t in_flight = 0;
+
+#pragma omp atomic capture
+        in_flight = ++files_in_flight;
+
+        const int deferred = in_flight <= max_files;
+
+        size_t offset = 0;
+
+        do {
+          const size_t end = toke_dataset_chunk_end(text, size, offset, self->chunk_size, self->chunk_delimiter);
+
+#pragma omp atomic
+          mapped->refs++;
+
+#pragma omp task if (deferred) firstprivate(mapped, text, offset, end, i)
+          {
+            walker(walker_data, text + offset, end - offset, i, offset, (size_t)omp_get_thread_num());
+
+            release_mapped_file(mapped, files_in_flight_ptr);
+          }
+
+          offset = end;
+
+        } while (offset < size);
+
+        release_mapped_file(mapped, files_in_flight_ptr);
+      }
+    }
+  }
+
+  return err;
+}
+
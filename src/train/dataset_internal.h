@@ -0,0 +1,297 @@
+#pragma once
+
+#include <toke/train/dataset.h>
+
+#include "decompressor.h"
+#include "jsonl.h"
+#include "memmap.h"
+
+#include <sys/stat.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#define TOKE_TAR_BLOCK_SIZE 512
+
+  struct tar_member
+  {
+    /**
+     * @brief The offset of the file's data (not its header) from the start of the archive.
+     * */
+    uint64_t offset;
+
+    uint64_t size;
+  };
+
+  enum dataset_format
+  {
+    DATASET_FORMAT_TAR,
+    DATASET_FORMAT_JSONL,
+    DATASET_FORMAT_DIRECTORY
+  };
+
+  struct toke_dataset
+  {
+    enum dataset_format format;
+
+    /**
+     * @brief The archive or JSON lines file, which is null for a directory.
+     * */
+    toke_memmap_z* file;
+
+    /**
+     * @brief How the archive is compressed. Compressed archives can only be read in order, so they aren't indexed.
+     * */
+    enum toke_compression compression;
+
+    /**
+     * @brief The regular files of the archive, in the order they appear in it.
+     * */
+    struct tar_member* members;
+
+    size_t num_members;
+
+    /**
+     * @brief The files of a directory, sorted by path.
+     * */
+    char** paths;
+
+    size_t num_paths;
+
+    /**
+     * @brief The field of each JSON record that holds its text.
+     * */
+    char* jsonl_field;
+
+    /**
+     * @brief The size above which a walk splits a file into chunks, or zero to never split them.
+     * */
+    size_t chunk_size;
+
+    uint8_t chunk_delimiter;
+
+    /**
+     * @brief How far ahead of the walk the archive is prefetched, which is also the granularity that pages behind it
+     *        are released at. Zero turns the hints off.
+     * */
+    size_t readahead;
+
+    /**
+     * @brief The set that walks skip anything already in, or null to walk everything. It is owned by the caller.
+     * */
+    toke_dedup_z* dedup;
+
+    /**
+     * @brief The chance that a walk picks each file (or record), which is one to pick all of them.
+     * */
+    double sample_fraction;
+
+    /**
+     * @brief The size that the picked files add up to before a walk stops, or zero for no limit.
+     * */
+    size_t sample_bytes;
+
+    uint64_t sample_seed;
+  };
+
+  /**
+   * @brief Finds where the chunk starting at @p offset ends.
+   * */
+  size_t toke_dataset_chunk_end(const uint8_t* text, size_t size, size_t offset, size_t chunk_size, uint8_t delimiter);
+
+  /**
+   * @brief Hands the walk to the kind of source that the dataset was opened on, each of which is in a file of its own.
+   *
+   * @details Unlike @ref toke_dataset_walk, this walks every text even if the dataset has a set of duplicates to skip,
+   *          for callers that skip them themselves.
+   *
+   * @param max_threads The most threads to use, which must not be zero.
+   * */
+  toke_error_z toke_dataset_walk_all(const toke_dataset_z* self,
+                                     size_t max_threads,
+                                     void* walker_data,
+                                     toke_dataset_walker walker);
+
+  /**
+   * @brief Decides which files (or records) a walk visits, from nothing but their index and size, so that the ones it
+   *        skips are never read.
+   * */
+  struct sampler
+  {
+    /**
+     * @brief Non-zero if every file is picked, in which case the threshold isn't used.
+     * */
+    int all;
+
+    /**
+     * @brief A file is picked if the hash of its index is below this.
+     * */
+    uint64_t threshold;
+
+    uint64_t seed;
+
+    size_t max_bytes;
+
+    /**
+     * @brief The size of the files picked so far, which only the queuing thread updates.
+     * */
+    size_t picked_bytes;
+  };
+
+  void toke_sampler_init(struct sampler* self, const toke_dataset_z* dataset);
+
+  /**
+   * @brief Hashes the index with the SplitMix64 finalizer, so that the files picked are spread evenly over the dataset
+   *        and don't depend on the order (or the threads) they are walked in.
+   * */
+  int toke_sampler_picks(const struct sampler* self, size_t index);
+
+  /**
+   * @brief Checks whether the files picked so far have used up the budget, after which the walk stops.
+   * */
+  int toke_sampler_done(const struct sampler* self);
+
+  /**
+   * @brief Called by the queuing thread for each file in order, which counts the file against the budget if it is
+   *        picked.
+   *
+   * @return Non-zero if the file is to be walked.
+   * */
+  int toke_sampler_take(struct sampler* self, size_t index, size_t size);
+
+  /**
+   * @brief Checks whether a block is all zeros, which is how a tar archive ends.
+   * */
+  int toke_tar_is_zero_block(const uint8_t* block);
+
+  /**
+   * @brief Reads the size and type of a file from its tar header, which must not be a zero block.
+   * */
+  toke_error_z toke_tar_read_header(const uint8_t* header, size_t* size, size_t* num_blocks, int* is_regular);
+
+  /**
+   * @brief Finds the regular files of an uncompressed archive, from its index if there is one that is up to date, or
+   *        else by reading every header, in which case the index is written for next time.
+   *
+   * @param members Set to the files, which the caller frees.
+   * */
+  toke_error_z toke_tar_index(const char* filename,
+                              const struct stat* archive_stat,
+                              const uint8_t* ptr,
+                              size_t file_size,
+                              struct tar_member** members,
+                              size_t* num_members);
+
+  /**
+   * @brief Walks the files of an uncompressed archive, straight from the mapping.
+   * */
+  void toke_tar_walk(const toke_dataset_z* self,
+                     size_t max_threads,
+                     struct sampler* sampler,
+                     void* walker_data,
+                     toke_dataset_walker walker);
+
+  /**
+   * @brief The state shared by the tasks walking JSON lines.
+   * */
+  struct jsonl_walk
+  {
+    const char* field;
+
+    /**
+     * @brief A buffer for each thread to unescape text into.
+     * */
+    struct toke_jsonl_buffer* buffers;
+
+    /**
+     * @brief Picks the records to walk, or null if every record is walked.
+     * */
+    const struct sampler* sampler;
+
+    /**
+     * @brief The last error that a task ran into, since tasks can't return one. Once it is set, the runs of lines
+     *        that haven't been started are skipped, and no more are handed out.
+     * */
+    toke_error_z err;
+  };
+
+  toke_error_z toke_jsonl_walk_init(struct jsonl_walk* self,
+                                    const toke_dataset_z* dataset,
+                                    const struct sampler* sampler,
+                                    size_t max_threads);
+
+  void toke_jsonl_walk_free(struct jsonl_walk* self, size_t max_threads);
+
+  /**
+   * @brief Checks whether a task of the walk has failed.
+   * */
+  int toke_jsonl_walk_failed(struct jsonl_walk* self);
+
+  /**
+   * @brief The body of a task that walks a run of whole lines.
+   * */
+  void toke_jsonl_walk_range(struct jsonl_walk* self,
+                             const uint8_t* text,
+                             size_t size,
+                             size_t first_record,
+                             void* walker_data,
+                             toke_dataset_walker walker);
+
+  /**
+   * @brief Counts the lines that a run of whole lines starts, and if the walk has a budget, counts the picked ones
+   *        against it. The size of a record is that of its line.
+   *
+   * @return The size of the run up to the end of the line that used up the budget, or all of it.
+   * */
+  size_t toke_jsonl_sample_lines(struct sampler* sampler,
+                                 const uint8_t* text,
+                                 size_t size,
+                                 size_t first_record,
+                                 size_t* num_lines);
+
+  /**
+   * @brief Walks a file of JSON lines in place, handing out runs of whole lines.
+   * */
+  void toke_jsonl_walk_mapped(const toke_dataset_z* self,
+                              size_t max_threads,
+                              struct sampler* sampler,
+                              struct jsonl_walk* jsonl,
+                              void* walker_data,
+                              toke_dataset_walker walker);
+
+  /**
+   * @brief Walks a compressed archive or JSON lines file, which one thread decompresses while the others walk the
+   *        parts that are done.
+   *
+   * @details The data is decompressed into a set of blocks. The decompressing thread queues a task for each file (or
+   *          run of lines) as soon as it is in a block. Once as many blocks are in use as there are threads (plus a
+   *          couple, so that nobody waits on the next block), the decompressing thread walks the next files itself,
+   *          which keeps memory bounded while the others catch up.
+   *
+   * @param jsonl The state of the walk over JSON lines, or null for an archive.
+   * */
+  toke_error_z toke_compressed_walk(const toke_dataset_z* self,
+                                    size_t max_threads,
+                                    struct sampler* sampler,
+                                    struct jsonl_walk* jsonl,
+                                    void* walker_data,
+                                    toke_dataset_walker walker);
+
+  /**
+   * @brief Walks the files of a directory, which are each mapped by the queuing thread and unmapped by the last task to
+   *        walk them.
+   * */
+  toke_error_z toke_directory_walk(const toke_dataset_z* self,
+                                   size_t max_threads,
+                                   struct sampler* sampler,
+                                   void* walker_data,
+                                   toke_dataset_walker walker);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
@@ -0,0 +1,203 @@
+#include "dataset_internal.h"
+#include "readahead.h"
+
+#include <omp.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief The size of the runs of lines that a walk over JSON lines hands out, unless a chunk size is set.
+ * */
+#define DEFAULT_JSONL_RANGE_SIZE (1024 * 1024)
+
+/**
+ * @brief Stands in for the walker of JSON lines when only some records are picked. Records have no header to decide
+ *        from, so unlike files they are dropped after they are read.
+ * */
+struct sampled_walk
+{
+  const struct sampler* sampler;
+
+  void* walker_data;
+
+  toke_dataset_walker walker;
+};
+
+static void
+walk_sampled(void* user_data,
+             const uint8_t* text,
+             const size_t text_size,
+             const size_t file_index,
+             const size_t offset,
+             const size_t thread_index)
+{
+  const struct sampled_walk* self = user_data;
+
+  if (toke_sampler_picks(self->sampler, file_index)) {
+    self->walker(self->walker_data, text, text_size, file_index, offset, thread_index);
+  }
+}
+
+int
+toke_jsonl_walk_failed(struct jsonl_walk* self)
+{
+  toke_error_z err = TOKE_ERROR_NONE;
+
+#pragma omp atomic read
+  err = self->err;
+
+  return err != TOKE_ERROR_NONE;
+}
+
+toke_error_z
+toke_jsonl_walk_init(struct jsonl_walk* self,
+                     const toke_dataset_z* dataset,
+                     const struct sampler* sampler,
+                     const size_t max_threads)
+{
+  self->field = dataset->jsonl_field ? dataset->jsonl_field : "text";
+  self->buffers = calloc(max_threads, sizeof(struct toke_jsonl_buffer));
+  self->sampler = sampler->all ? NULL : sampler;
+  self->err = TOKE_ERROR_NONE;
+  return self->buffers ? TOKE_ERROR_NONE : TOKE_ERROR_MEMORY_ALLOCATION;
+}
+
+void
+toke_jsonl_walk_free(struct jsonl_walk* self, const size_t max_threads)
+{
+  for (size_t i = 0; i < max_threads; i++) {
+    free(self->buffers[i].data);
+  }
+
+  free(self->buffers);
+}
+
+void
+toke_jsonl_walk_range(struct jsonl_walk* self,
+                      const uint8_t* text,
+                      const size_t size,
+                      const size_t first_record,
+                      void* walker_data,
+                      toke_dataset_walker walker)
+{
+  if (toke_jsonl_walk_failed(self)) {
+    return;
+  }
+
+  const size_t thread_index = (size_t)omp_get_thread_num();
+
+  struct sampled_walk sampled;
+
+  if (self->sampler) {
+    sampled.sampler = self->sampler;
+    sampled.walker_data = walker_data;
+    sampled.walker = walker;
+    walker_data = &sampled;
+    walker = walk_sampled;
+  }
+
+  const toke_error_z err = toke_jsonl_walk_lines(
+    text, size, first_record, self->field, &self->buffers[thread_index], walker_data, walker, thread_index);
+
+  if (err != TOKE_ERROR_NONE) {
+#pragma omp atomic write
+    self->err = err;
+  }
+}
+
+size_t
+toke_jsonl_sample_lines(struct sampler* sampler,
+                        const uint8_t* text,
+                        const size_t size,
+                        const size_t first_record,
+                        size_t* num_lines)
+{
+  if (sampler->max_bytes == 0) {
+    *num_lines = toke_jsonl_count_lines(text, size);
+    return size;
+  }
+
+  size_t record = first_record;
+
+  size_t offset = 0;
+
+  while ((offset < size) && !toke_sampler_done(sampler)) {
+
+    const uint8_t* newline = memchr(text + offset, '\n', size - offset);
+
+    const size_t end = newline ? (size_t)(newline - text) + 1 : size;
+
+    toke_sampler_take(sampler, record, end - offset);
+
+    record++;
+
+    offset = end;
+  }
+
+  *num_lines = record - first_record;
+
+  return offset;
+}
+
+void
+toke_jsonl_walk_mapped(const toke_dataset_z* self,
+                       const size_t max_threads,
+                       struct sampler* sampler,
+                       struct jsonl_walk* jsonl,
+                       void* walker_data,
+                       toke_dataset_walker walker)
+{
+  const uint8_t* ptr = toke_memmap_ptr(self->file);
+
+  const size_t size = toke_memmap_size(self->file);
+
+  const size_t range_size = self->chunk_size ? self->chunk_size : DEFAULT_JSONL_RANGE_SIZE;
+
+  // lines have no headers, so the records a sample skips are still read, and only a budget leaves part of the file
+  struct readahead readahead;
+  toke_readahead_init(&readahead, self->file, self->readahead, 0);
+
+  struct readahead* readahead_ptr = &readahead;
+
+#pragma omp parallel num_threads((int)max_threads)
+  {
+#pragma omp single
+    {
+      size_t first_record = 0;
+
+      size_t offset = 0;
+
+      while ((offset < size) && !toke_sampler_done(sampler) && !toke_jsonl_walk_failed(jsonl)) {
+
+        const size_t record = first_record;
+
+        size_t num_lines = 0;
+
+        // counting the lines reads the range ahead of the task, which is then likely to find it in the cache
+        const size_t range_end = toke_dataset_chunk_end(ptr, size, offset, range_size, '\n');
+
+        const size_t end =
+          offset + toke_jsonl_sample_lines(sampler, ptr + offset, range_end - offset, record, &num_lines);
+
+        first_record += num_lines;
+
+        const int deferred = toke_readahead_queue(readahead_ptr, offset, end);
+
+#pragma omp task if (deferred) firstprivate(offset, end, record)
+        {
+          toke_readahead_start(readahead_ptr, offset, end);
+
+          toke_jsonl_walk_range(jsonl, ptr + offset, end - offset, record, walker_data, walker);
+
+          toke_readahead_done(readahead_ptr, offset, end);
+        }
+
+        offset = end;
+      }
+    }
+  }
+
+  toke_readahead_finish(&readahead);
+}
+
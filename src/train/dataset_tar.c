@@ -0,0 +1,448 @@
+#include "dataset_internal.h"
+#include "readahead.h"
+
+#include <omp.h>
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define INDEX_FILE_SUFFIX ".idx"
+
+#define INDEX_FILE_MAGIC "TOKEIDX\0"
+
+#define INDEX_FILE_VERSION 2
+
+#define INDEX_FILE_BYTE_ORDER 0x01020304u
+
+/**
+ * @brief The start of an index file, which sits next to the archive it indexes.
+ *
+ * @details The header is followed by a @ref tar_member for each regular file of the archive. The size, modification
+ *          time (to the nanosecond, where the file system keeps it), inode and device of the archive are kept so that
+ *          an index left over from an older archive is rebuilt instead of used, even if the archive was rewritten
+ *          within the same second or replaced by another file of the same size. Integers are in the byte order of the
+ *          machine that wrote the file, which the byte order field checks.
+ * */
+struct index_file_header
+{
+  char magic[8];
+
+  uint32_t version;
+
+  uint32_t byte_order;
+
+  uint64_t archive_size;
+
+  int64_t archive_mtime;
+
+  int64_t archive_mtime_nsec;
+
+  uint64_t archive_inode;
+
+  uint64_t archive_device;
+
+  uint64_t count;
+};
+
+/**
+ * @brief Parses the size field of a tar header.
+ *
+ * @details The field is normally octal, ended by a space or a null. GNU tar stores sizes that don't fit in base-256
+ *          instead, which is flagged by the high bit of the first byte.
+ *
+ * @return Non-zero on success, zero if the field is malformed.
+ * */
+static int
+parse_size(const uint8_t* field, size_t* size)
+{
+  size_t result = 0;
+
+  if (field[0] & 0x80) {
+    for (size_t i = 1; i < 12; i++) {
+      if (result > (SIZE_MAX >> 8)) {
+        return 0;
+      }
+      result = (result << 8) | field[i];
+    }
+    *size = result;
+    return 1;
+  }
+
+  size_t i = 0;
+
+  // leading spaces are allowed by some writers
+  while ((i < 12) && (field[i] == ' ')) {
+    i++;
+  }
+
+  for (; i < 12; i++) {
+
+    if ((field[i] == 0) || (field[i] == ' ')) {
+      break;
+    }
+
+    if ((field[i] < '0') || (field[i] > '7')) {
+      return 0;
+    }
+
+    result = (result * 8) + (size_t)(field[i] - '0');
+  }
+
+  *size = result;
+
+  return 1;
+}
+
+int
+toke_tar_is_zero_block(const uint8_t* block)
+{
+  for (size_t i = 0; i < TOKE_TAR_BLOCK_SIZE; i++) {
+    if (block[i] != 0) {
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
+static int
+is_regular_file(const uint8_t type)
+{
+  // '7' is a contiguous file, which readers treat as a regular one
+  return (type == 0) || (type == '0') || (type == '7');
+}
+
+toke_error_z
+toke_tar_read_header(const uint8_t* header, size_t* size, size_t* num_blocks, int* is_regular)
+{
+  // both the POSIX ("ustar\0") and GNU ("ustar ") magic start the same way
+  if (memcmp(header + 257, "ustar", 5) != 0) {
+    return TOKE_ERROR_FILE_IO;
+  }
+
+  if (!parse_size(header + 124, size)) {
+    return TOKE_ERROR_FILE_IO;
+  }
+
+  // a size this large can't be in any archive, and would overflow once rounded up to whole blocks
+  if (*size > (SIZE_MAX - TOKE_TAR_BLOCK_SIZE)) {
+    return TOKE_ERROR_FILE_IO;
+  }
+
+  *num_blocks = (*size / TOKE_TAR_BLOCK_SIZE) + (((*size % TOKE_TAR_BLOCK_SIZE) != 0) ? 1 : 0);
+
+  *is_regular = is_regular_file(header[156]);
+
+  return TOKE_ERROR_NONE;
+}
+
+/**
+ * @brief Reads every header of the archive to find its regular files.
+ * */
+static toke_error_z
+scan_archive(const uint8_t* ptr, const size_t file_size, struct tar_member** members_ptr, size_t* num_members_ptr)
+{
+  struct tar_member* members = NULL;
+
+  size_t num_members = 0;
+
+  size_t capacity = 0;
+
+  size_t offset = 0;
+
+  toke_error_z err = TOKE_ERROR_NONE;
+
+  while ((file_size - offset) >= TOKE_TAR_BLOCK_SIZE) {
+
+    const uint8_t* header = ptr + offset;
+
+    // the archive ends with two zero blocks, but a single one is enough to know there are no more files
+    if (toke_tar_is_zero_block(header)) {
+      break;
+    }
+
+    size_t size = 0;
+
+    size_t num_blocks = 0;
+
+    int is_regular = 0;
+
+    err = toke_tar_read_header(header, &size, &num_blocks, &is_regular);
+    if (err != TOKE_ERROR_NONE) {
+      break;
+    }
+
+    if (num_blocks >= ((file_size - offset) / TOKE_TAR_BLOCK_SIZE)) {
+      // the data is cut off, or the size is so large that the block count would overflow
+      err = TOKE_ERROR_FILE_IO;
+      break;
+    }
+
+    if (is_regular) {
+
+      if (num_members == capacity) {
+        capacity = capacity ? (capacity * 2) : 64;
+        struct tar_member* tmp = realloc(members, capacity * sizeof(struct tar_member));
+        if (!tmp) {
+          err = TOKE_ERROR_MEMORY_ALLOCATION;
+          break;
+        }
+        members = tmp;
+      }
+
+      members[num_members].offset = offset + TOKE_TAR_BLOCK_SIZE;
+      members[num_members].size = size;
+      num_members++;
+    }
+
+    offset += /* header_block + file_data_blocks */ (1 + num_blocks) * TOKE_TAR_BLOCK_SIZE;
+  }
+
+  if (err != TOKE_ERROR_NONE) {
+    free(members);
+    return err;
+  }
+
+  *members_ptr = members;
+  *num_members_ptr = num_members;
+
+  return TOKE_ERROR_NONE;
+}
+
+static char*
+make_index_filename(const char* filename, const char* suffix)
+{
+  const size_t filename_size = strlen(filename);
+  const size_t suffix_size = strlen(suffix);
+
+  char* result = malloc(filename_size + suffix_size + 1);
+  if (!result) {
+    return NULL;
+  }
+
+  memcpy(result, filename, filename_size);
+  memcpy(result + filename_size, suffix, suffix_size + 1);
+
+  return result;
+}
+
+/**
+ * @brief Fills in the fields of an index header that tell which archive it was made from.
+ * */
+static void
+describe_archive(const struct stat* archive_stat, struct index_file_header* header)
+{
+  header->archive_size = (uint64_t)archive_stat->st_size;
+  header->archive_mtime = (int64_t)archive_stat->st_mtime;
+#ifdef __APPLE__
+  header->archive_mtime_nsec = (int64_t)archive_stat->st_mtimespec.tv_nsec;
+#else
+  header->archive_mtime_nsec = (int64_t)archive_stat->st_mtim.tv_nsec;
+#endif
+  header->archive_inode = (uint64_t)archive_stat->st_ino;
+  header->archive_device = (uint64_t)archive_stat->st_dev;
+}
+
+/**
+ * @brief Reads the index of the archive, if there is one that is up to date.
+ *
+ * @return Non-zero if the index was read.
+ * */
+static int
+load_index(const char* index_filename,
+           const struct stat* archive_stat,
+           struct tar_member** members_ptr,
+           size_t* num_members_ptr)
+{
+  FILE* file = fopen(index_filename, "rb");
+  if (!file) {
+    return 0;
+  }
+
+  struct index_file_header header;
+
+  struct index_file_header expected;
+  memset(&expected, 0, sizeof(expected));
+  describe_archive(archive_stat, &expected);
+
+  int ok = (fread(&header, sizeof(header), 1, file) == 1) &&
+           (memcmp(header.magic, INDEX_FILE_MAGIC, sizeof(header.magic)) == 0) &&
+           (header.version == INDEX_FILE_VERSION) && (header.byte_order == INDEX_FILE_BYTE_ORDER) &&
+           (header.archive_size == expected.archive_size) && (header.archive_mtime == expected.archive_mtime) &&
+           (header.archive_mtime_nsec == expected.archive_mtime_nsec) &&
+           (header.archive_inode == expected.archive_inode) && (header.archive_device == expected.archive_device) &&
+           (header.count <= (header.archive_size / TOKE_TAR_BLOCK_SIZE));
+
+  struct tar_member* members = NULL;
+
+  if (ok && (header.count > 0)) {
+    members = malloc((size_t)header.count * sizeof(struct tar_member));
+    ok = members && (fread(members, sizeof(struct tar_member), (size_t)header.count, file) == (size_t)header.count);
+  }
+
+  // the walk trusts the index, so check that every member is inside the archive
+  for (uint64_t i = 0; ok && (i < header.count); i++) {
+    ok = (members[i].offset <= header.archive_size) && (members[i].size <= (header.archive_size - members[i].offset));
+  }
+
+  fclose(file);
+
+  if (!ok) {
+    free(members);
+    return 0;
+  }
+
+  *members_ptr = members;
+  *num_members_ptr = (size_t)header.count;
+
+  return 1;
+}
+
+/**
+ * @brief Writes the index next to the archive, through a temporary file so that a reader never sees half of it.
+ *
+ * @details The temporary file gets a name of its own, so that processes opening the same archive at once each write
+ *          their own and the last rename wins, rather than writing over each other's. It is made as readable as the
+ *          archive, since whoever can read the archive can use the index.
+ * */
+static void
+save_index(const char* index_filename,
+           const struct stat* archive_stat,
+           const struct tar_member* members,
+           const size_t num_members)
+{
+  char* tmp_filename = make_index_filename(index_filename, ".XXXXXX");
+  if (!tmp_filename) {
+    return;
+  }
+
+  const int fd = mkstemp(tmp_filename);
+  if (fd < 0) {
+    free(tmp_filename);
+    return;
+  }
+
+  FILE* file = (fchmod(fd, archive_stat->st_mode & 0666) == 0) ? fdopen(fd, "wb") : NULL;
+  if (!file) {
+    close(fd);
+    remove(tmp_filename);
+    free(tmp_filename);
+    return;
+  }
+
+  struct index_file_header header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, INDEX_FILE_MAGIC, sizeof(header.magic));
+  header.version = INDEX_FILE_VERSION;
+  header.byte_order = INDEX_FILE_BYTE_ORDER;
+  describe_archive(archive_stat, &header);
+  header.count = num_members;
+
+  int ok = fwrite(&header, sizeof(header), 1, file) == 1;
+
+  ok = ok && (fwrite(members, sizeof(struct tar_member), num_members, file) == num_members);
+
+  if (fclose(file) != 0) {
+    ok = 0;
+  }
+
+  if (!ok || (rename(tmp_filename, index_filename) != 0)) {
+    remove(tmp_filename);
+  }
+
+  free(tmp_filename);
+}
+
+toke_error_z
+toke_tar_index(const char* filename,
+               const struct stat* archive_stat,
+               const uint8_t* ptr,
+               const size_t file_size,
+               struct tar_member** members,
+               size_t* num_members)
+{
+  char* index_filename = make_index_filename(filename, INDEX_FILE_SUFFIX);
+  if (!index_filename) {
+    return TOKE_ERROR_MEMORY_ALLOCATION;
+  }
+
+  toke_error_z err = TOKE_ERROR_NONE;
+
+  if (!load_index(index_filename, archive_stat, members, num_members)) {
+
+    err = scan_archive(ptr, file_size, members, num_members);
+
+    // the index only saves time, so an archive in a read-only directory can still be opened without one
+    if (err == TOKE_ERROR_NONE) {
+      save_index(index_filename, archive_stat, *members, *num_members);
+    }
+  }
+
+  free(index_filename);
+
+  return err;
+}
+
+void
+toke_tar_walk(const toke_dataset_z* self,
+              const size_t max_threads,
+              struct sampler* sampler,
+              void* walker_data,
+              toke_dataset_walker walker)
+{
+  const uint8_t* ptr = toke_memmap_ptr(self->file);
+
+  struct readahead readahead;
+  toke_readahead_init(&readahead, self->file, self->readahead, !sampler->all);
+
+  struct readahead* readahead_ptr = &readahead;
+
+  // One thread queues a task for each file (or chunk of one), which the rest of the team (and the queuing thread, once
+  // it's done) picks up as soon as it is free, so a large file only holds up the thread that is walking it.
+
+#pragma omp parallel num_threads((int)max_threads)
+  {
+#pragma omp single
+    {
+      for (size_t i = 0; (i < self->num_members) && !toke_sampler_done(sampler); i++) {
+
+        const size_t base = (size_t)self->members[i].offset;
+
+        const uint8_t* text = ptr + base;
+
+        const size_t size = (size_t)self->members[i].size;
+
+        // the index holds every size, so a member that isn't picked is skipped without touching its pages
+        if (!toke_sampler_take(sampler, i, size)) {
+          continue;
+        }
+
+        size_t offset = 0;
+
+        do {
+          const size_t end = toke_dataset_chunk_end(text, size, offset, self->chunk_size, self->chunk_delimiter);
+
+          const int deferred = toke_readahead_queue(readahead_ptr, base + offset, base + end);
+
+#pragma omp task if (deferred) firstprivate(text, base, offset, end, i)
+          {
+            toke_readahead_start(readahead_ptr, base + offset, base + end);
+
+            walker(walker_data, text + offset, end - offset, i, offset, (size_t)omp_get_thread_num());
+
+            toke_readahead_done(readahead_ptr, base + offset, base + end);
+          }
+
+          offset = end;
+
+        } while (offset < size);
+      }
+    }
+  }
+
+  toke_readahead_finish(&readahead);
+}
@@ -0,0 +1,281 @@
+#include "decompressor.h"
+
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if TOKE_HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+#if TOKE_HAVE_ZSTD
+#include <zstd.h>
+#endif
+
+struct toke_decompressor
+{
+  enum toke_compression compression;
+
+  const uint8_t* input;
+
+  size_t input_size;
+
+  /**
+   * @brief How much of the input has been handed to the decompression library.
+   * */
+  size_t input_offset;
+
+  int finished;
+
+#if TOKE_HAVE_ZLIB
+  z_stream gzip;
+#endif
+
+#if TOKE_HAVE_ZSTD
+  ZSTD_DCtx* zstd;
+
+  ZSTD_inBuffer zstd_input;
+
+  /**
+   * @brief The value returned by the last call to the decoder that made progress, which is zero only where a frame
+   *        ends.
+   * */
+  size_t zstd_hint;
+#endif
+};
+
+enum toke_compression
+toke_compression_detect(const uint8_t* data, const size_t size)
+{
+  if ((size >= 2) && (data[0] == 0x1f) && (data[1] == 0x8b)) {
+    return TOKE_COMPRESSION_GZIP;
+  }
+
+  if ((size >= 4) && (memcmp(data, "\x28\xb5\x2f\xfd", 4) == 0)) {
+    return TOKE_COMPRESSION_ZSTD;
+  }
+
+  return TOKE_COMPRESSION_NONE;
+}
+
+int
+toke_compression_supported(const enum toke_compression compression)
+{
+  switch (compression) {
+    case TOKE_COMPRESSION_NONE:
+      return 1;
+    case TOKE_COMPRESSION_GZIP:
+#if TOKE_HAVE_ZLIB
+      return 1;
+#else
+      return 0;
+#endif
+    case TOKE_COMPRESSION_ZSTD:
+#if TOKE_HAVE_ZSTD
+      return 1;
+#else
+      return 0;
+#endif
+  }
+
+  return 0;
+}
+
+toke_decompressor_z*
+toke_decompressor_new(const enum toke_compression compression, const uint8_t* data, const size_t size)
+{
+  if ((compression == TOKE_COMPRESSION_NONE) || !toke_compression_supported(compression)) {
+    return NULL;
+  }
+
+  toke_decompressor_z* self = calloc(1, sizeof(toke_decompressor_z));
+  if (!self) {
+    return NULL;
+  }
+
+  self->compression = compression;
+  self->input = data;
+  self->input_size = size;
+
+#if TOKE_HAVE_ZLIB
+  if (compression == TOKE_COMPRESSION_GZIP) {
+    // a window of 15 bits, plus 16 to expect a gzip header instead of a zlib one
+    if (inflateInit2(&self->gzip, 15 + 16) != Z_OK) {
+      free(self);
+      return NULL;
+    }
+  }
+#endif
+
+#if TOKE_HAVE_ZSTD
+  if (compression == TOKE_COMPRESSION_ZSTD) {
+    self->zstd = ZSTD_createDCtx();
+    if (!self->zstd) {
+      free(self);
+      return NULL;
+    }
+    self->zstd_input.src = data;
+    self->zstd_input.size = size;
+    self->zstd_input.pos = 0;
+  }
+#endif
+
+  return self;
+}
+
+void
+toke_decompressor_delete(toke_decompressor_z* self)
+{
+  if (self) {
+#if TOKE_HAVE_ZLIB
+    if (self->compression == TOKE_COMPRESSION_GZIP) {
+      inflateEnd(&self->gzip);
+    }
+#endif
+#if TOKE_HAVE_ZSTD
+    if (self->compression == TOKE_COMPRESSION_ZSTD) {
+      ZSTD_freeDCtx(self->zstd);
+    }
+#endif
+  }
+
+  free(self);
+}
+
+#if TOKE_HAVE_ZLIB
+
+/**
+ * @brief Checks whether the rest of the input is only zeros, which some tools pad a gzip file with (tape blocks, or
+ *        a file that was preallocated), and which gzip itself ignores.
+ * */
+static int
+is_zero_padding(const uint8_t* data, const size_t size)
+{
+  for (size_t i = 0; i < size; i++) {
+    if (data[i] != 0) {
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
+static toke_error_z
+read_gzip(toke_decompressor_z* self, uint8_t* output, const size_t size, size_t* read_size)
+{
+  z_stream* stream = &self->gzip;
+
+  size_t produced = 0;
+
+  while ((produced < size) && !self->finished) {
+
+    // zlib counts in 32-bit integers, so large inputs and outputs are handed over in pieces
+    if ((stream->avail_in == 0) && (self->input_offset < self->input_size)) {
+      const size_t piece = self->input_size - self->input_offset;
+      stream->next_in = (Bytef*)(self->input + self->input_offset);
+      stream->avail_in = (uInt)((piece > UINT_MAX) ? UINT_MAX : piece);
+      self->input_offset += stream->avail_in;
+    }
+
+    const size_t space = size - produced;
+    stream->next_out = output + produced;
+    stream->avail_out = (uInt)((space > UINT_MAX) ? UINT_MAX : space);
+
+    const uInt avail_out = stream->avail_out;
+
+    const int ret = inflate(stream, Z_NO_FLUSH);
+
+    produced += avail_out - stream->avail_out;
+
+    if (ret == Z_STREAM_END) {
+      const uint8_t* rest = stream->next_in;
+      const size_t rest_size = (size_t)((self->input + self->input_size) - rest);
+      // tools like pigz write several gzip members one after the other, which decompress to one stream
+      if (!is_zero_padding(rest, rest_size)) {
+        if (inflateReset(stream) != Z_OK) {
+          return TOKE_ERROR_FILE_IO;
+        }
+      } else {
+        self->finished = 1;
+      }
+    } else if (ret == Z_BUF_ERROR) {
+      // no progress could be made, which with output space left means the input ran out in the middle of a member
+      if ((stream->avail_in == 0) && (self->input_offset == self->input_size)) {
+        return TOKE_ERROR_FILE_IO;
+      }
+    } else if (ret != Z_OK) {
+      return TOKE_ERROR_FILE_IO;
+    }
+  }
+
+  *read_size = produced;
+
+  return TOKE_ERROR_NONE;
+}
+
+#endif
+
+#if TOKE_HAVE_ZSTD
+
+static toke_error_z
+read_zstd(toke_decompressor_z* self, uint8_t* output, const size_t size, size_t* read_size)
+{
+  size_t produced = 0;
+
+  while ((produced < size) && !self->finished) {
+
+    ZSTD_outBuffer out = { output + produced, size - produced, 0 };
+
+    const size_t input_pos = self->zstd_input.pos;
+
+    const size_t ret = ZSTD_decompressStream(self->zstd, &out, &self->zstd_input);
+    if (ZSTD_isError(ret)) {
+      return TOKE_ERROR_FILE_IO;
+    }
+
+    produced += out.pos;
+
+    // frames that follow each other are decoded as one stream, so the end is when the input has run out
+    if ((out.pos == 0) && (self->zstd_input.pos == input_pos) && (self->zstd_input.pos == self->zstd_input.size)) {
+      if (self->zstd_hint != 0) {
+        // the last frame was cut off
+        return TOKE_ERROR_FILE_IO;
+      }
+      self->finished = 1;
+    } else {
+      // a call without input returns the size of the next frame's header, so only calls that made progress count
+      self->zstd_hint = ret;
+    }
+  }
+
+  *read_size = produced;
+
+  return TOKE_ERROR_NONE;
+}
+
+#endif
+
+toke_error_z
+toke_decompressor_read(toke_decompressor_z* self, uint8_t* output, const size_t size, size_t* read_size)
+{
+  *read_size = 0;
+
+  switch (self->compression) {
+    case TOKE_COMPRESSION_NONE:
+      break;
+    case TOKE_COMPRESSION_GZIP:
+#if TOKE_HAVE_ZLIB
+      return read_gzip(self, output, size, read_size);
+#else
+      break;
+#endif
+    case TOKE_COMPRESSION_ZSTD:
+#if TOKE_HAVE_ZSTD
+      return read_zstd(self, output, size, read_size);
+#else
+      break;
+#endif
+  }
+
+  return TOKE_ERROR_UNSUPPORTED_COMPRESSION;
+}
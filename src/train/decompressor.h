@@ -0,0 +1,50 @@
+#pragma once
+
+#include <toke/error.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+  enum toke_compression
+  {
+    TOKE_COMPRESSION_NONE,
+    TOKE_COMPRESSION_GZIP,
+    TOKE_COMPRESSION_ZSTD
+  };
+
+  /**
+   * @brief Finds the compression format from the magic number at the start of the data.
+   * */
+  enum toke_compression toke_compression_detect(const uint8_t* data, size_t size);
+
+  /**
+   * @brief Checks whether this build can decompress the format.
+   * */
+  int toke_compression_supported(enum toke_compression compression);
+
+  /**
+   * @brief Streams the decompressed form of a buffer, which must stay valid while the decompressor is in use.
+   * */
+  typedef struct toke_decompressor toke_decompressor_z;
+
+  toke_decompressor_z* toke_decompressor_new(enum toke_compression compression, const uint8_t* data, size_t size);
+
+  void toke_decompressor_delete(toke_decompressor_z* self);
+
+  /**
+   * @brief Decompresses the next @p size bytes into @p output.
+   *
+   * @param read_size Set to the number of bytes decompressed, which is less than @p size only at the end of the data.
+   *
+   * @return @ref TOKE_ERROR_FILE_IO if the compressed data is corrupt or cut off.
+   * */
+  toke_error_z toke_decompressor_read(toke_decompressor_z* self, uint8_t* output, size_t size, size_t* read_size);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
@@ -0,0 +1,325 @@
+#include "dedup_internal.h"
+
+#include <omp.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief The number of high bits of a hash that pick its stripe.
+ * */
+#define STRIPE_BITS 8
+
+/**
+ * @brief The number of independently locked parts of the set.
+ * */
+#define NUM_STRIPES (1 << STRIPE_BITS)
+
+#define INITIAL_STRIPE_CAPACITY 1024
+
+/**
+ * @brief An open addressing table of hashes, with linear probing.
+ * */
+struct stripe
+{
+  omp_lock_t lock;
+
+  struct dedup_hash* entries;
+
+  /**
+   * @brief The number of slots, which is a power of two.
+   * */
+  size_t capacity;
+
+  size_t count;
+};
+
+struct toke_dedup
+{
+  struct stripe stripes[NUM_STRIPES];
+
+  size_t num_duplicates;
+
+  size_t duplicate_bytes;
+};
+
+static uint64_t
+rotl64(const uint64_t x, const int r)
+{
+  return (x << r) | (x >> (64 - r));
+}
+
+static uint64_t
+fmix64(uint64_t k)
+{
+  k ^= k >> 33;
+  k *= 0xff51afd7ed558ccdull;
+  k ^= k >> 33;
+  k *= 0xc4ceb9fe1a85ec53ull;
+  k ^= k >> 33;
+  return k;
+}
+
+static uint64_t
+read64(const uint8_t* ptr)
+{
+  uint64_t value = 0;
+  memcpy(&value, ptr, sizeof(value));
+  return value;
+}
+
+struct dedup_hash
+toke_dedup_hash(const uint8_t* data, const size_t size)
+{
+  const uint64_t c1 = 0x87c37b91114253d5ull;
+  const uint64_t c2 = 0x4cf5ad432745937full;
+
+  uint64_t h1 = 0;
+  uint64_t h2 = 0;
+
+  const size_t num_blocks = size / 16;
+
+  for (size_t i = 0; i < num_blocks; i++) {
+
+    uint64_t k1 = read64(data + (i * 16));
+    uint64_t k2 = read64(data + (i * 16) + 8);
+
+    k1 *= c1;
+    k1 = rotl64(k1, 31);
+    k1 *= c2;
+    h1 ^= k1;
+
+    h1 = rotl64(h1, 27);
+    h1 += h2;
+    h1 = (h1 * 5) + 0x52dce729;
+
+    k2 *= c2;
+    k2 = rotl64(k2, 33);
+    k2 *= c1;
+    h2 ^= k2;
+
+    h2 = rotl64(h2, 31);
+    h2 += h1;
+    h2 = (h2 * 5) + 0x38495ab5;
+  }
+
+  const uint8_t* tail = data + (num_blocks * 16);
+
+  const size_t tail_size = size & 15;
+
+  uint64_t k1 = 0;
+  uint64_t k2 = 0;
+
+  for (size_t i = tail_size; i > 8; i--) {
+    k2 ^= ((uint64_t)tail[i - 1]) << ((i - 9) * 8);
+  }
+
+  if (tail_size > 8) {
+    k2 *= c2;
+    k2 = rotl64(k2, 33);
+    k2 *= c1;
+    h2 ^= k2;
+  }
+
+  for (size_t i = (tail_size < 8) ? tail_size : 8; i > 0; i--) {
+    k1 ^= ((uint64_t)tail[i - 1]) << ((i - 1) * 8);
+  }
+
+  if (tail_size > 0) {
+    k1 *= c1;
+    k1 = rotl64(k1, 31);
+    k1 *= c2;
+    h1 ^= k1;
+  }
+
+  h1 ^= (uint64_t)size;
+  h2 ^= (uint64_t)size;
+
+  h1 += h2;
+  h2 += h1;
+
+  h1 = fmix64(h1);
+  h2 = fmix64(h2);
+
+  h1 += h2;
+  h2 += h1;
+
+  struct dedup_hash result = { h1, h2 };
+
+  // all zeros marks an empty slot, so that one hash is moved aside
+  if ((result.lo == 0) && (result.hi == 0)) {
+    result.lo = 1;
+  }
+
+  return result;
+}
+
+toke_dedup_z*
+toke_dedup_new()
+{
+  toke_dedup_z* self = malloc(sizeof(toke_dedup_z));
+  if (!self) {
+    return NULL;
+  }
+
+  for (size_t i = 0; i < NUM_STRIPES; i++) {
+    omp_init_lock(&self->stripes[i].lock);
+    self->stripes[i].entries = NULL;
+    self->stripes[i].capacity = 0;
+    self->stripes[i].count = 0;
+  }
+
+  self->num_duplicates = 0;
+  self->duplicate_bytes = 0;
+
+  return self;
+}
+
+void
+toke_dedup_delete(toke_dedup_z* self)
+{
+  if (self) {
+    for (size_t i = 0; i < NUM_STRIPES; i++) {
+      omp_destroy_lock(&self->stripes[i].lock);
+      free(self->stripes[i].entries);
+    }
+  }
+
+  free(self);
+}
+
+void
+toke_dedup_clear(toke_dedup_z* self)
+{
+  for (size_t i = 0; i < NUM_STRIPES; i++) {
+    free(self->stripes[i].entries);
+    self->stripes[i].entries = NULL;
+    self->stripes[i].capacity = 0;
+    self->stripes[i].count = 0;
+  }
+
+  self->num_duplicates = 0;
+  self->duplicate_bytes = 0;
+}
+
+/**
+ * @brief Finds the slot holding the hash, or the empty slot where it belongs.
+ * */
+static struct dedup_hash*
+find_slot(struct dedup_hash* entries, const size_t capacity, const struct dedup_hash hash)
+{
+  const size_t mask = capacity - 1;
+
+  // the stripe was picked with the high bits, so the table uses the low ones
+  size_t i = (size_t)hash.lo & mask;
+
+  for (;;) {
+
+    struct dedup_hash* slot = &entries[i];
+
+    if (((slot->lo == hash.lo) && (slot->hi == hash.hi)) || ((slot->lo == 0) && (slot->hi == 0))) {
+      return slot;
+    }
+
+    i = (i + 1) & mask;
+  }
+}
+
+static int
+grow_stripe(struct stripe* stripe)
+{
+  const size_t capacity = stripe->capacity ? (stripe->capacity * 2) : INITIAL_STRIPE_CAPACITY;
+
+  struct dedup_hash* entries = calloc(capacity, sizeof(struct dedup_hash));
+  if (!entries) {
+    return 0;
+  }
+
+  for (size_t i = 0; i < stripe->capacity; i++) {
+
+    const struct dedup_hash* entry = &stripe->entries[i];
+
+    if ((entry->lo != 0) || (entry->hi != 0)) {
+      *find_slot(entries, capacity, *entry) = *entry;
+    }
+  }
+
+  free(stripe->entries);
+
+  stripe->entries = entries;
+  stripe->capacity = capacity;
+
+  return 1;
+}
+
+toke_error_z
+toke_dedup_insert(toke_dedup_z* self, const uint8_t* text, const size_t text_size, int* is_new)
+{
+  // hashing is the expensive part, and happens before taking the lock
+  return toke_dedup_insert_hash(self, toke_dedup_hash(text, text_size), text_size, is_new);
+}
+
+toke_error_z
+toke_dedup_insert_hash(toke_dedup_z* self, const struct dedup_hash hash, const size_t text_size, int* is_new)
+{
+  *is_new = 0;
+
+  struct stripe* stripe = &self->stripes[hash.hi >> (64 - STRIPE_BITS)];
+
+  toke_error_z err = TOKE_ERROR_NONE;
+
+  omp_set_lock(&stripe->lock);
+
+  // kept at most three quarters full, so that probes stay short
+  if (((stripe->count + 1) * 4) > (stripe->capacity * 3)) {
+    if (!grow_stripe(stripe)) {
+      err = TOKE_ERROR_MEMORY_ALLOCATION;
+    }
+  }
+
+  if (err == TOKE_ERROR_NONE) {
+
+    struct dedup_hash* slot = find_slot(stripe->entries, stripe->capacity, hash);
+
+    if ((slot->lo == 0) && (slot->hi == 0)) {
+      *slot = hash;
+      stripe->count++;
+      *is_new = 1;
+    }
+  }
+
+  omp_unset_lock(&stripe->lock);
+
+  if ((err == TOKE_ERROR_NONE) && !*is_new) {
+#pragma omp atomic
+    self->num_duplicates++;
+#pragma omp atomic
+    self->duplicate_bytes += text_size;
+  }
+
+  return err;
+}
+
+size_t
+toke_dedup_num_unique(const toke_dedup_z* self)
+{
+  size_t count = 0;
+
+  for (size_t i = 0; i < NUM_STRIPES; i++) {
+    count += self->stripes[i].count;
+  }
+
+  return count;
+}
+
+size_t
+toke_dedup_num_duplicates(const toke_dedup_z* self)
+{
+  return self->num_duplicates;
+}
+
+size_t
+toke_dedup_duplicate_bytes(const toke_dedup_z* self)
+{
+  return self->duplicate_bytes;
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <toke/train/dedup.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+  /**
+   * @brief A 128-bit hash of a text, which is what the set keeps in place of the text. All zeros marks an empty slot,
+   *        so no text hashes to that.
+   * */
+  struct dedup_hash
+  {
+    uint64_t lo;
+
+    uint64_t hi;
+  };
+
+  /**
+   * @brief Hashes a text with MurmurHash3 (the x64 128-bit variant, with a seed of zero), which runs at several
+   *        gigabytes per second, so that it can be added later with @ref toke_dedup_insert_hash.
+   *
+   * @details Blocks are read in the byte order of the machine, so the hashes differ between machines. They never leave
+   *          memory, so that doesn't matter.
+   * */
+  struct dedup_hash toke_dedup_hash(const uint8_t* text, size_t text_size);
+
+  /**
+   * @brief Adds the hash of a text to the set, like @ref toke_dedup_insert does with the text itself.
+   *
+   * @details This splits hashing from inserting, for callers that hash texts in parallel but have to insert them in an
+   *          order of their own, which then decides which copy of a text is the one that is new to the set.
+   *
+   * @param text_size The size of the text that was hashed, which the statistics count if it is a duplicate.
+   * */
+  toke_error_z toke_dedup_insert_hash(toke_dedup_z* self, struct dedup_hash hash, size_t text_size, int* is_new);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
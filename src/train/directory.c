@@ -0,0 +1,147 @@
+#include "directory.h"
+
+#include <dirent.h>
+#include <sys/stat.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+struct path_list
+{
+  char** paths;
+
+  size_t count;
+
+  size_t capacity;
+};
+
+static toke_error_z
+push_path(struct path_list* list, const char* path)
+{
+  if (list->count == list->capacity) {
+    const size_t capacity = list->capacity ? (list->capacity * 2) : 64;
+    char** tmp = realloc(list->paths, capacity * sizeof(char*));
+    if (!tmp) {
+      return TOKE_ERROR_MEMORY_ALLOCATION;
+    }
+    list->paths = tmp;
+    list->capacity = capacity;
+  }
+
+  const size_t size = strlen(path);
+
+  char* copy = malloc(size + 1);
+  if (!copy) {
+    return TOKE_ERROR_MEMORY_ALLOCATION;
+  }
+
+  memcpy(copy, path, size + 1);
+
+  list->paths[list->count] = copy;
+  list->count++;
+
+  return TOKE_ERROR_NONE;
+}
+
+static char*
+join_path(const char* dir, const char* name)
+{
+  const size_t dir_size = strlen(dir);
+  const size_t name_size = strlen(name);
+
+  const int needs_separator = (dir_size > 0) && (dir[dir_size - 1] != '/');
+
+  char* result = malloc(dir_size + (size_t)needs_separator + name_size + 1);
+  if (!result) {
+    return NULL;
+  }
+
+  memcpy(result, dir, dir_size);
+  if (needs_separator) {
+    result[dir_size] = '/';
+  }
+  memcpy(result + dir_size + needs_separator, name, name_size + 1);
+
+  return result;
+}
+
+static toke_error_z
+list_files(const char* dir_path, struct path_list* list)
+{
+  DIR* dir = opendir(dir_path);
+  if (!dir) {
+    return TOKE_ERROR_FILE_IO;
+  }
+
+  toke_error_z err = TOKE_ERROR_NONE;
+
+  struct dirent* entry = NULL;
+
+  while ((err == TOKE_ERROR_NONE) && ((entry = readdir(dir)) != NULL)) {
+
+    if ((strcmp(entry->d_name, ".") == 0) || (strcmp(entry->d_name, "..") == 0)) {
+      continue;
+    }
+
+    char* path = join_path(dir_path, entry->d_name);
+    if (!path) {
+      err = TOKE_ERROR_MEMORY_ALLOCATION;
+      break;
+    }
+
+    struct stat stbuf;
+
+    if (lstat(path, &stbuf) == 0) {
+      if (S_ISDIR(stbuf.st_mode)) {
+        err = list_files(path, list);
+      } else if (S_ISREG(stbuf.st_mode)) {
+        err = push_path(list, path);
+      } else if (S_ISLNK(stbuf.st_mode) && (stat(path, &stbuf) == 0) && S_ISREG(stbuf.st_mode)) {
+        // links to files are followed, but not links to directories, which could form a cycle
+        err = push_path(list, path);
+      }
+    }
+
+    free(path);
+  }
+
+  closedir(dir);
+
+  return err;
+}
+
+static int
+cmp_paths(const void* l, const void* r)
+{
+  return strcmp(*(const char* const*)l, *(const char* const*)r);
+}
+
+toke_error_z
+toke_directory_list(const char* root, char*** paths, size_t* count)
+{
+  struct path_list list = { NULL, 0, 0 };
+
+  const toke_error_z err = list_files(root, &list);
+  if (err != TOKE_ERROR_NONE) {
+    toke_directory_free(list.paths, list.count);
+    return err;
+  }
+
+  // the order that directories are read in depends on the file system, so sort it to number the files the same way
+  qsort(list.paths, list.count, sizeof(char*), cmp_paths);
+
+  *paths = list.paths;
+  *count = list.count;
+
+  return TOKE_ERROR_NONE;
+}
+
+void
+toke_directory_free(char** paths, const size_t count)
+{
+  for (size_t i = 0; i < count; i++) {
+    free(paths[i]);
+  }
+
+  free(paths);
+}
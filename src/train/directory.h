@@ -0,0 +1,23 @@
+#pragma once
+
+#include <toke/error.h>
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+  /**
+   * @brief Lists the regular files under a directory, including those in its subdirectories, sorted by path.
+   *
+   * @param paths Set to an array of paths, which the caller frees with @ref toke_directory_free.
+   * */
+  toke_error_z toke_directory_list(const char* root, char*** paths, size_t* count);
+
+  void toke_directory_free(char** paths, size_t count);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
@@ -0,0 +1,473 @@
+#include "jsonl.h"
+
+#include "unicode.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+/**
+ * @brief Finds the next quote or backslash, which are the only bytes that end a plain run of a JSON string.
+ *
+ * @details SSE2 is part of x86-64, so there's no need to pick the kernel at runtime like the normalizer does.
+ * */
+static const uint8_t*
+find_string_special(const uint8_t* ptr, const uint8_t* end)
+{
+#ifdef __SSE2__
+  const __m128i quote = _mm_set1_epi8('"');
+  const __m128i backslash = _mm_set1_epi8('\\');
+
+  while ((end - ptr) >= 16) {
+
+    const __m128i v = _mm_loadu_si128((const __m128i*)ptr);
+
+    const __m128i special = _mm_or_si128(_mm_cmpeq_epi8(v, quote), _mm_cmpeq_epi8(v, backslash));
+
+    if (_mm_movemask_epi8(special) != 0) {
+      break;
+    }
+
+    ptr += 16;
+  }
+#endif
+
+  while ((ptr < end) && (*ptr != '"') && (*ptr != '\\')) {
+    ptr++;
+  }
+
+  return ptr;
+}
+
+static const uint8_t*
+skip_space(const uint8_t* ptr, const uint8_t* end)
+{
+  while ((ptr < end) && ((*ptr == ' ') || (*ptr == '\t') || (*ptr == '\r') || (*ptr == '\n'))) {
+    ptr++;
+  }
+
+  return ptr;
+}
+
+/**
+ * @brief Finds the end of a string, given the byte after its opening quote.
+ *
+ * @param has_escapes Set to non-zero if the string contains a backslash.
+ *
+ * @return The closing quote, or null if the string isn't closed.
+ * */
+static const uint8_t*
+find_string_end(const uint8_t* ptr, const uint8_t* end, int* has_escapes)
+{
+  *has_escapes = 0;
+
+  for (;;) {
+
+    ptr = find_string_special(ptr, end);
+
+    if (ptr == end) {
+      return NULL;
+    }
+
+    if (*ptr == '"') {
+      return ptr;
+    }
+
+    // a backslash, which escapes the byte after it
+    *has_escapes = 1;
+
+    if ((end - ptr) < 2) {
+      return NULL;
+    }
+
+    ptr += 2;
+  }
+}
+
+/**
+ * @brief Skips over a value of any type.
+ *
+ * @return The byte after the value, or null if it is malformed.
+ * */
+static const uint8_t*
+skip_value(const uint8_t* ptr, const uint8_t* end)
+{
+  if (ptr == end) {
+    return NULL;
+  }
+
+  if (*ptr == '"') {
+    int has_escapes = 0;
+    const uint8_t* string_end = find_string_end(ptr + 1, end, &has_escapes);
+    return string_end ? (string_end + 1) : NULL;
+  }
+
+  if ((*ptr == '{') || (*ptr == '[')) {
+
+    size_t depth = 0;
+
+    while (ptr < end) {
+
+      const uint8_t c = *ptr;
+
+      if (c == '"') {
+        int has_escapes = 0;
+        ptr = find_string_end(ptr + 1, end, &has_escapes);
+        if (!ptr) {
+          return NULL;
+        }
+      } else if ((c == '{') || (c == '[')) {
+        depth++;
+      } else if ((c == '}') || (c == ']')) {
+        depth--;
+        if (depth == 0) {
+          return ptr + 1;
+        }
+      }
+
+      ptr++;
+    }
+
+    return NULL;
+  }
+
+  // a number, true, false or null
+  const uint8_t* start = ptr;
+
+  while ((ptr < end) && (*ptr != ',') && (*ptr != '}') && (*ptr != ']') && (*ptr != ' ') && (*ptr != '\t') &&
+         (*ptr != '\r') && (*ptr != '\n')) {
+    ptr++;
+  }
+
+  return (ptr != start) ? ptr : NULL;
+}
+
+static int
+parse_hex4(const uint8_t* ptr, uint32_t* value)
+{
+  uint32_t result = 0;
+
+  for (int i = 0; i < 4; i++) {
+
+    const uint8_t c = ptr[i];
+
+    uint32_t digit = 0;
+
+    if ((c >= '0') && (c <= '9')) {
+      digit = (uint32_t)(c - '0');
+    } else if ((c >= 'a') && (c <= 'f')) {
+      digit = (uint32_t)(c - 'a') + 10;
+    } else if ((c >= 'A') && (c <= 'F')) {
+      digit = (uint32_t)(c - 'A') + 10;
+    } else {
+      return 0;
+    }
+
+    result = (result << 4) | digit;
+  }
+
+  *value = result;
+
+  return 1;
+}
+
+static int
+reserve_buffer(struct toke_jsonl_buffer* buffer, const size_t size)
+{
+  if (buffer->capacity >= size) {
+    return 1;
+  }
+
+  const size_t capacity = (size > (buffer->capacity * 2)) ? size : (buffer->capacity * 2);
+
+  uint8_t* data = realloc(buffer->data, capacity);
+  if (!data) {
+    return 0;
+  }
+
+  buffer->data = data;
+  buffer->capacity = capacity;
+
+  return 1;
+}
+
+/**
+ * @brief Unescapes the contents of a string into the buffer.
+ *
+ * @details An escape never takes fewer bytes than what it stands for, so the buffer never needs to be larger than the
+ *          escaped string. Lone surrogates have no UTF-8 form and are replaced by U+FFFD.
+ *
+ * @return The size of the unescaped string, or (size_t)-1 if an escape is malformed or memory couldn't be allocated.
+ * */
+static size_t
+unescape(const uint8_t* ptr, const uint8_t* end, struct toke_jsonl_buffer* buffer)
+{
+  if (!reserve_buffer(buffer, (size_t)(end - ptr))) {
+    return (size_t)-1;
+  }
+
+  uint8_t* out = buffer->data;
+
+  while (ptr < end) {
+
+    const uint8_t* special = find_string_special(ptr, end);
+
+    memcpy(out, ptr, (size_t)(special - ptr));
+    out += special - ptr;
+    ptr = special;
+
+    if (ptr == end) {
+      break;
+    }
+
+    // the string's end was found before, so this is always a backslash with a byte after it
+    const uint8_t c = ptr[1];
+
+    ptr += 2;
+
+    switch (c) {
+      case '"':
+      case '\\':
+      case '/':
+        *out++ = c;
+        break;
+      case 'b':
+        *out++ = '\b';
+        break;
+      case 'f':
+        *out++ = '\f';
+        break;
+      case 'n':
+        *out++ = '\n';
+        break;
+      case 'r':
+        *out++ = '\r';
+        break;
+      case 't':
+        *out++ = '\t';
+        break;
+      case 'u': {
+        uint32_t codepoint = 0;
+        if (((end - ptr) < 4) || !parse_hex4(ptr, &codepoint)) {
+          return (size_t)-1;
+        }
+        ptr += 4;
+
+        if ((codepoint >= 0xD800) && (codepoint <= 0xDBFF)) {
+          uint32_t low = 0;
+          if (((end - ptr) >= 6) && (ptr[0] == '\\') && (ptr[1] == 'u') && parse_hex4(ptr + 2, &low) &&
+              (low >= 0xDC00) && (low <= 0xDFFF)) {
+            codepoint = 0x10000 + ((codepoint - 0xD800) << 10) + (low - 0xDC00);
+            ptr += 6;
+          } else {
+            codepoint = 0xFFFD;
+          }
+        } else if ((codepoint >= 0xDC00) && (codepoint <= 0xDFFF)) {
+          codepoint = 0xFFFD;
+        }
+
+        out += toke_utf8_encode(codepoint, out);
+        break;
+      }
+      default:
+        return (size_t)-1;
+    }
+  }
+
+  return (size_t)(out - buffer->data);
+}
+
+/**
+ * @brief Finds the text field of a record.
+ *
+ * @return @ref TOKE_ERROR_NONE with @p text set to null if the record has no text field.
+ * */
+static toke_error_z
+parse_record(const uint8_t* ptr,
+             const uint8_t* end,
+             const char* field,
+             const size_t field_size,
+             struct toke_jsonl_buffer* buffer,
+             const uint8_t** text,
+             size_t* text_size)
+{
+  *text = NULL;
+  *text_size = 0;
+
+  ptr = skip_space(ptr, end);
+
+  if ((ptr == end) || (*ptr != '{')) {
+    return TOKE_ERROR_FILE_IO;
+  }
+
+  ptr = skip_space(ptr + 1, end);
+
+  if ((ptr < end) && (*ptr == '}')) {
+    return TOKE_ERROR_NONE;
+  }
+
+  for (;;) {
+
+    if ((ptr == end) || (*ptr != '"')) {
+      return TOKE_ERROR_FILE_IO;
+    }
+
+    int key_has_escapes = 0;
+
+    const uint8_t* key = ptr + 1;
+
+    const uint8_t* key_end = find_string_end(key, end, &key_has_escapes);
+    if (!key_end) {
+      return TOKE_ERROR_FILE_IO;
+    }
+
+    int is_field = 0;
+
+    if (!key_has_escapes) {
+      is_field = (((size_t)(key_end - key)) == field_size) && (memcmp(key, field, field_size) == 0);
+    } else {
+      const size_t key_size = unescape(key, key_end, buffer);
+      if (key_size == (size_t)-1) {
+        return TOKE_ERROR_FILE_IO;
+      }
+      is_field = (key_size == field_size) && (memcmp(buffer->data, field, field_size) == 0);
+    }
+
+    ptr = skip_space(key_end + 1, end);
+
+    if ((ptr == end) || (*ptr != ':')) {
+      return TOKE_ERROR_FILE_IO;
+    }
+
+    ptr = skip_space(ptr + 1, end);
+
+    if (is_field && (ptr < end) && (*ptr == '"')) {
+
+      int has_escapes = 0;
+
+      const uint8_t* value = ptr + 1;
+
+      const uint8_t* value_end = find_string_end(value, end, &has_escapes);
+      if (!value_end) {
+        return TOKE_ERROR_FILE_IO;
+      }
+
+      if (!has_escapes) {
+        *text = value;
+        *text_size = (size_t)(value_end - value);
+        return TOKE_ERROR_NONE;
+      }
+
+      const size_t size = unescape(value, value_end, buffer);
+      if (size == (size_t)-1) {
+        return TOKE_ERROR_FILE_IO;
+      }
+
+      *text = buffer->data;
+      *text_size = size;
+
+      // the rest of the record isn't needed, so it isn't checked
+      return TOKE_ERROR_NONE;
+    }
+
+    ptr = skip_value(ptr, end);
+    if (!ptr) {
+      return TOKE_ERROR_FILE_IO;
+    }
+
+    ptr = skip_space(ptr, end);
+
+    if ((ptr < end) && (*ptr == ',')) {
+      ptr = skip_space(ptr + 1, end);
+      continue;
+    }
+
+    if ((ptr < end) && (*ptr == '}')) {
+      return TOKE_ERROR_NONE;
+    }
+
+    return TOKE_ERROR_FILE_IO;
+  }
+}
+
+static int
+is_blank(const uint8_t* ptr, const uint8_t* end)
+{
+  return skip_space(ptr, end) == end;
+}
+
+toke_error_z
+toke_jsonl_walk_lines(const uint8_t* text,
+                      const size_t size,
+                      const size_t first_record,
+                      const char* field,
+                      struct toke_jsonl_buffer* buffer,
+                      void* walker_data,
+                      toke_dataset_walker walker,
+                      const size_t thread_index)
+{
+  const size_t field_size = strlen(field);
+
+  const uint8_t* ptr = text;
+
+  const uint8_t* end = text + size;
+
+  size_t record = first_record;
+
+  while (ptr < end) {
+
+    const uint8_t* newline = memchr(ptr, '\n', (size_t)(end - ptr));
+
+    const uint8_t* line_end = newline ? newline : end;
+
+    if (!is_blank(ptr, line_end)) {
+
+      const uint8_t* record_text = NULL;
+
+      size_t record_size = 0;
+
+      const toke_error_z err = parse_record(ptr, line_end, field, field_size, buffer, &record_text, &record_size);
+      if (err != TOKE_ERROR_NONE) {
+        return err;
+      }
+
+      if (record_text) {
+        walker(walker_data, record_text, record_size, record, /*offset=*/0, thread_index);
+      }
+    }
+
+    record++;
+
+    ptr = newline ? (newline + 1) : end;
+  }
+
+  return TOKE_ERROR_NONE;
+}
+
+size_t
+toke_jsonl_count_lines(const uint8_t* text, const size_t size)
+{
+  size_t count = 0;
+
+  const uint8_t* ptr = text;
+
+  const uint8_t* end = text + size;
+
+  while (ptr < end) {
+
+    const uint8_t* newline = memchr(ptr, '\n', (size_t)(end - ptr));
+
+    count++;
+
+    if (!newline) {
+      break;
+    }
+
+    ptr = newline + 1;
+  }
+
+  return count;
+}
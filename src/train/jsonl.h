@@ -0,0 +1,50 @@
+#pragma once
+
+#include <toke/train/dataset.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+  /**
+   * @brief Holds the unescaped text of a record, reused from one record to the next by the thread that owns it.
+   * */
+  struct toke_jsonl_buffer
+  {
+    uint8_t* data;
+
+    size_t capacity;
+  };
+
+  /**
+   * @brief Calls the walker on the text field of each record in a run of whole JSON lines.
+   *
+   * @details Text without escapes is passed straight from the input, otherwise it is unescaped into @p buffer. Blank
+   *          lines, and records without the field (or where it isn't a string), are skipped, but still count towards
+   *          the record index so that every line has the same index whichever way the input was divided.
+   *
+   * @param first_record The index of the first line, which is passed to the walker as the file index.
+   *
+   * @return @ref TOKE_ERROR_FILE_IO if a line isn't a JSON object.
+   * */
+  toke_error_z toke_jsonl_walk_lines(const uint8_t* text,
+                                     size_t size,
+                                     size_t first_record,
+                                     const char* field,
+                                     struct toke_jsonl_buffer* buffer,
+                                     void* walker_data,
+                                     toke_dataset_walker walker,
+                                     size_t thread_index);
+
+  /**
+   * @brief Counts the lines that a run of text starts, which is its newlines plus one if the last line isn't ended.
+   * */
+  size_t toke_jsonl_count_lines(const uint8_t* text, size_t size);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
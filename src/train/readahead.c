@@ -0,0 +1,178 @@
+#include "readahead.h"
+
+#include <omp.h>
+
+#include <sched.h>
+
+#include <stdlib.h>
+
+/**
+ * @brief How many readahead windows' worth of tasks can be queued before a thread starts on them, which bounds how far
+ *        ahead of the walk the archive is read in.
+ * */
+#define MAX_SEGMENTS_AHEAD 2
+
+void
+toke_readahead_init(struct readahead* self, toke_memmap_z* file, const size_t window, const int sparse)
+{
+  self->file = file;
+  self->window = window;
+  self->pending = NULL;
+  self->num_segments = 0;
+  self->held = 0;
+  self->holding = 0;
+  self->prefetched = 0;
+  self->ahead = 0;
+  self->sparse = sparse;
+
+  if (window == 0) {
+    return;
+  }
+
+  self->num_segments = (toke_memmap_size(file) / window) + 1;
+
+  // without the counts the walk still works, it just goes without the hints
+  self->pending = calloc(self->num_segments, sizeof(size_t));
+  if (self->pending) {
+    toke_memmap_advise(file, 0, toke_memmap_size(file), sparse ? TOKE_MEMMAP_RANDOM : TOKE_MEMMAP_SEQUENTIAL);
+  }
+}
+
+static size_t
+last_segment(const struct readahead* self, const size_t begin, const size_t end)
+{
+  return ((end > begin) ? (end - 1) : begin) / self->window;
+}
+
+/**
+ * @brief Drops a count on a segment, releasing its pages if it was the last one.
+ * */
+static void
+readahead_unref(struct readahead* self, const size_t segment)
+{
+  size_t pending = 0;
+
+#pragma omp atomic capture
+  pending = --self->pending[segment];
+
+  if (pending == 0) {
+    toke_memmap_advise(self->file, segment * self->window, self->window, TOKE_MEMMAP_DONTNEED);
+  }
+}
+
+/**
+ * @brief Releases the prefetched part of the archive between two offsets, which no task reads.
+ * */
+static void
+readahead_skip(struct readahead* self, const size_t begin, const size_t end)
+{
+  const size_t skipped_end = (end < self->prefetched) ? end : self->prefetched;
+
+  if (begin < skipped_end) {
+    toke_memmap_advise(self->file, begin, skipped_end - begin, TOKE_MEMMAP_DONTNEED);
+  }
+}
+
+int
+toke_readahead_queue(struct readahead* self, const size_t begin, const size_t end)
+{
+  if (!self->pending) {
+    return 1;
+  }
+
+  const int alone = omp_get_num_threads() == 1;
+
+  const size_t max_ahead = MAX_SEGMENTS_AHEAD * self->window;
+
+  for (;;) {
+
+    size_t ahead = 0;
+
+#pragma omp atomic read
+    ahead = self->ahead;
+
+    if (alone || (ahead < max_ahead)) {
+      break;
+    }
+
+#pragma omp taskyield
+    // not every runtime runs a task on a yield, so give the core to the threads that do run them
+    sched_yield();
+  }
+
+#pragma omp atomic
+  self->ahead += end - begin;
+
+  const size_t first = begin / self->window;
+
+  const size_t last = last_segment(self, begin, end);
+
+  for (size_t i = first; i <= last; i++) {
+#pragma omp atomic
+    self->pending[i]++;
+  }
+
+  if (!self->holding || (last > self->held)) {
+
+#pragma omp atomic
+    self->pending[last]++;
+
+    if (self->holding) {
+      readahead_skip(self, (self->held + 1) * self->window, first * self->window);
+      readahead_unref(self, self->held);
+    }
+
+    self->held = last;
+    self->holding = 1;
+  }
+
+  // The queue runs ahead of the tasks, so prefetching just what is queued still reads it before it is needed. A task
+  // larger than the window only gets its first window prefetched, and the kernel reads in the rest as it is walked.
+  const size_t queued_end = self->sparse ? end : (end + self->window);
+  const size_t target = (queued_end < (begin + self->window)) ? queued_end : (begin + self->window);
+  if (target > self->prefetched) {
+    const size_t from = (self->prefetched > begin) ? self->prefetched : begin;
+    toke_memmap_advise(self->file, from, target - from, TOKE_MEMMAP_WILLNEED);
+    self->prefetched = target;
+  }
+
+  return !alone;
+}
+
+void
+toke_readahead_start(struct readahead* self, const size_t begin, const size_t end)
+{
+  if (!self->pending) {
+    return;
+  }
+
+#pragma omp atomic
+  self->ahead -= end - begin;
+}
+
+void
+toke_readahead_done(struct readahead* self, const size_t begin, const size_t end)
+{
+  if (!self->pending) {
+    return;
+  }
+
+  for (size_t i = begin / self->window; i <= last_segment(self, begin, end); i++) {
+    readahead_unref(self, i);
+  }
+}
+
+void
+toke_readahead_finish(struct readahead* self)
+{
+  if (!self->pending) {
+    return;
+  }
+
+  if (self->holding) {
+    readahead_skip(self, (self->held + 1) * self->window, toke_memmap_size(self->file));
+    readahead_unref(self, self->held);
+  }
+
+  free(self->pending);
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include "memmap.h"
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+  /**
+   * @brief Tracks which parts of the archive the walk still needs, so that it can prefetch ahead of them and release
+   *        the pages behind them.
+   *
+   * @details The archive is divided into segments the size of the readahead window, each with a count of the tasks
+   *          that read it. Tasks are queued in archive order, so the queue also holds a count on the segment it is in,
+   *          which it drops once it moves on. Whoever drops a count to zero releases the segment, so each one is
+   *          released as soon as its own tasks are done, however long a task elsewhere takes.
+   * */
+  struct readahead
+  {
+    toke_memmap_z* file;
+
+    size_t window;
+
+    /**
+     * @brief The number of unfinished tasks in each segment, plus one for the segment the queue is in, or null if the
+     *        hints are off.
+     * */
+    size_t* pending;
+
+    size_t num_segments;
+
+    /**
+     * @brief The segment the queue holds a count on, which is only valid once something has been queued.
+     * */
+    size_t held;
+
+    int holding;
+
+    /**
+     * @brief The end of the prefetched part of the archive.
+     * */
+    size_t prefetched;
+
+    /**
+     * @brief The bytes of the tasks that are queued but haven't started, which the queue waits on to keep from
+     *        running too far ahead of the walk.
+     * */
+    size_t ahead;
+
+    /**
+     * @brief Non-zero if the walk skips parts of the archive, in which case only what is queued is prefetched, so that
+     *        the skipped parts are never read.
+     * */
+    int sparse;
+  };
+
+  /**
+   * @param window The size of the segments, or zero to turn the hints off.
+   * */
+  void toke_readahead_init(struct readahead* self, toke_memmap_z* file, size_t window, int sparse);
+
+  /**
+   * @brief Called by the queuing thread before it queues a task that reads from @p begin to @p end.
+   *
+   * @details Once a couple of windows' worth of queued tasks are waiting for a thread, this waits for the team to
+   *          start on them, rather than having the queuing thread walk the task itself, which would leave the queue
+   *          empty for as long as the task takes.
+   *
+   * @return Non-zero if the task should be deferred, or zero if the queuing thread is the whole team, in which case it
+   *         might as well walk the task now.
+   * */
+  int toke_readahead_queue(struct readahead* self, size_t begin, size_t end);
+
+  /**
+   * @brief Called by a task as it starts reading from @p begin to @p end.
+   * */
+  void toke_readahead_start(struct readahead* self, size_t begin, size_t end);
+
+  /**
+   * @brief Called by a task once it is done reading from @p begin to @p end.
+   * */
+  void toke_readahead_done(struct readahead* self, size_t begin, size_t end);
+
+  /**
+   * @brief Releases whatever is left once every task has finished.
+   * */
+  void toke_readahead_finish(struct readahead* self);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * @brief The name of a shard, given the prefix and the shard's position.
+ * */
+#define SHARD_FILENAME_FORMAT "%s-%05zu.bin"
+
+#define SHARD_INDEX_SUFFIX ".idx"
+
+#define SHARD_INDEX_MAGIC "TOKESHRD"
+
+#define SHARD_INDEX_VERSION 1
+
+#define SHARD_INDEX_BYTE_ORDER 0x01020304u
+
+/**
+ * @brief The start of a shard index.
+ *
+ * @details The header is followed by the number of tokens in each shard, as 64-bit integers, and then by a
+ *          @ref shard_document for each document. Integers are in the byte order of the machine that wrote the file,
+ *          which the byte order field checks, and so are the tokens in the shards.
+ * */
+struct shard_index_header
+{
+  char magic[8];
+
+  uint32_t version;
+
+  uint32_t byte_order;
+
+  uint64_t num_shards;
+
+  uint64_t num_documents;
+
+  uint64_t num_tokens;
+};
+
+struct shard_document
+{
+  /**
+   * @brief The index that the dataset walk gave the document.
+   * */
+  uint64_t file_index;
+
+  /**
+   * @brief Where the document starts in the file, which is only non-zero for a chunk of one.
+   * */
+  uint64_t offset;
+
+  uint64_t shard;
+
+  /**
+   * @brief The position of the document's first token in its shard.
+   * */
+  uint64_t start;
+
+  uint64_t num_tokens;
+};
@@ -0,0 +1,407 @@
+#include <toke/train/shards.h>
+
+#include "memmap.h"
+#include "shard_format.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+struct toke_token_shards
+{
+  toke_memmap_z* index;
+
+  const struct shard_index_header* header;
+
+  /**
+   * @brief The number of tokens in each shard, which points into the index.
+   * */
+  const uint64_t* shard_tokens;
+
+  const struct shard_document* documents;
+
+  toke_memmap_z** shards;
+
+  size_t num_shards;
+};
+
+toke_token_shards_z*
+toke_token_shards_new()
+{
+  toke_token_shards_z* self = calloc(1, sizeof(toke_token_shards_z));
+  if (!self) {
+    return NULL;
+  }
+
+  return self;
+}
+
+static void
+close_shards(toke_token_shards_z* self)
+{
+  if (self->shards) {
+    for (size_t i = 0; i < self->num_shards; i++) {
+      toke_memmap_close(self->shards[i]);
+    }
+  }
+
+  free(self->shards);
+
+  toke_memmap_close(self->index);
+
+  memset(self, 0, sizeof(*self));
+}
+
+void
+toke_token_shards_delete(toke_token_shards_z* self)
+{
+  if (self) {
+    close_shards(self);
+  }
+
+  free(self);
+}
+
+static int
+file_exists(const char* filename)
+{
+  FILE* file = fopen(filename, "rb");
+  if (file) {
+    fclose(file);
+  }
+
+  return file != NULL;
+}
+
+/**
+ * @brief Opens a file, telling apart one that is missing from one that can't be mapped.
+ * */
+static toke_error_z
+map_file(const char* filename, toke_memmap_z** map)
+{
+  *map = toke_memmap_open(filename);
+  if (*map) {
+    return TOKE_ERROR_NONE;
+  }
+
+  return file_exists(filename) ? TOKE_ERROR_FILE_IO : TOKE_ERROR_FILE_NOT_FOUND;
+}
+
+/**
+ * @brief Checks that the index is whole and that every document lies within its shard.
+ * */
+static toke_error_z
+check_index(toke_token_shards_z* self)
+{
+  const uint8_t* data = toke_memmap_ptr(self->index);
+
+  const size_t size = toke_memmap_size(self->index);
+
+  if (size < sizeof(struct shard_index_header)) {
+    return TOKE_ERROR_SHARD_FORMAT;
+  }
+
+  const struct shard_index_header* header = (const struct shard_index_header*)data;
+
+  if ((memcmp(header->magic, SHARD_INDEX_MAGIC, sizeof(header->magic)) != 0) ||
+      (header->version != SHARD_INDEX_VERSION) || (header->byte_order != SHARD_INDEX_BYTE_ORDER)) {
+    return TOKE_ERROR_SHARD_FORMAT;
+  }
+
+  const uint64_t remaining = size - sizeof(struct shard_index_header);
+
+  // checked one at a time, so that a huge count can't overflow the expected size
+  if (header->num_shards > (remaining / sizeof(uint64_t))) {
+    return TOKE_ERROR_SHARD_FORMAT;
+  }
+
+  const uint64_t documents_size = remaining - (header->num_shards * sizeof(uint64_t));
+
+  if ((header->num_documents > (documents_size / sizeof(struct shard_document))) ||
+      (documents_size != (header->num_documents * sizeof(struct shard_document)))) {
+    return TOKE_ERROR_SHARD_FORMAT;
+  }
+
+  const uint64_t* shard_tokens = (const uint64_t*)(data + sizeof(struct shard_index_header));
+
+  const struct shard_document* documents = (const struct shard_document*)(shard_tokens + header->num_shards);
+
+  uint64_t num_tokens = 0;
+
+  for (uint64_t i = 0; i < header->num_shards; i++) {
+    num_tokens += shard_tokens[i];
+  }
+
+  if (num_tokens != header->num_tokens) {
+    return TOKE_ERROR_SHARD_FORMAT;
+  }
+
+  for (uint64_t i = 0; i < header->num_documents; i++) {
+
+    const struct shard_document* document = &documents[i];
+
+    if ((document->shard >= header->num_shards) || (document->start > shard_tokens[document->shard]) ||
+        (document->num_tokens > (shard_tokens[document->shard] - document->start))) {
+      return TOKE_ERROR_SHARD_FORMAT;
+    }
+  }
+
+  self->header = header;
+  self->shard_tokens = shard_tokens;
+  self->documents = documents;
+
+  return TOKE_ERROR_NONE;
+}
+
+static toke_error_z
+open_shards(toke_token_shards_z* self, const char* prefix)
+{
+  const size_t prefix_size = strlen(prefix);
+
+  char* index_filename = malloc(prefix_size + sizeof(SHARD_INDEX_SUFFIX));
+  if (!index_filename) {
+    return TOKE_ERROR_MEMORY_ALLOCATION;
+  }
+
+  memcpy(index_filename, prefix, prefix_size);
+  memcpy(index_filename + prefix_size, SHARD_INDEX_SUFFIX, sizeof(SHARD_INDEX_SUFFIX));
+
+  toke_error_z err = map_file(index_filename, &self->index);
+
+  free(index_filename);
+
+  if (err != TOKE_ERROR_NONE) {
+    return err;
+  }
+
+  err = check_index(self);
+  if (err != TOKE_ERROR_NONE) {
+    return err;
+  }
+
+  const size_t num_shards = (size_t)self->header->num_shards;
+
+  self->shards = calloc(num_shards + 1, sizeof(toke_memmap_z*));
+  if (!self->shards) {
+    return TOKE_ERROR_MEMORY_ALLOCATION;
+  }
+
+  const int filename_size = snprintf(NULL, 0, SHARD_FILENAME_FORMAT, prefix, num_shards);
+
+  char* filename = malloc((size_t)filename_size + 1);
+  if (!filename) {
+    return TOKE_ERROR_MEMORY_ALLOCATION;
+  }
+
+  for (size_t i = 0; i < num_shards; i++) {
+
+    snprintf(filename, (size_t)filename_size + 1, SHARD_FILENAME_FORMAT, prefix, i);
+
+    err = map_file(filename, &self->shards[i]);
+    if (err != TOKE_ERROR_NONE) {
+      break;
+    }
+
+    self->num_shards++;
+
+    if (toke_memmap_size(self->shards[i]) != (self->shard_tokens[i] * sizeof(uint16_t))) {
+      err = TOKE_ERROR_SHARD_FORMAT;
+      break;
+    }
+  }
+
+  free(filename);
+
+  return err;
+}
+
+toke_error_z
+toke_token_shards_open(toke_token_shards_z* self, const char* prefix)
+{
+  close_shards(self);
+
+  const toke_error_z err = open_shards(self, prefix);
+  if (err != TOKE_ERROR_NONE) {
+    close_shards(self);
+  }
+
+  return err;
+}
+
+size_t
+toke_token_shards_num_shards(const toke_token_shards_z* self)
+{
+  return self->header ? (size_t)self->header->num_shards : 0;
+}
+
+size_t
+toke_token_shards_num_documents(const toke_token_shards_z* self)
+{
+  return self->header ? (size_t)self->header->num_documents : 0;
+}
+
+size_t
+toke_token_shards_num_tokens(const toke_token_shards_z* self)
+{
+  return self->header ? (size_t)self->header->num_tokens : 0;
+}
+
+const uint16_t*
+toke_token_shards_get_shard(const toke_token_shards_z* self, const size_t index, size_t* num_tokens)
+{
+  *num_tokens = 0;
+
+  if (index >= toke_token_shards_num_shards(self)) {
+    return NULL;
+  }
+
+  *num_tokens = (size_t)self->shard_tokens[index];
+
+  return toke_memmap_ptr(self->shards[index]);
+}
+
+const uint16_t*
+toke_token_shards_get_document(const toke_token_shards_z* self,
+                               const size_t index,
+                               size_t* num_tokens,
+                               size_t* file_index,
+                               size_t* offset)
+{
+  *num_tokens = 0;
+
+  if (index >= toke_token_shards_num_documents(self)) {
+    return NULL;
+  }
+
+  const struct shard_document* document = &self->documents[index];
+
+  if (file_index) {
+    *file_index = (size_t)document->file_index;
+  }
+
+  if (offset) {
+    *offset = (size_t)document->offset;
+  }
+
+  *num_tokens = (size_t)document->num_tokens;
+
+  if (document->num_tokens == 0) {
+    return NULL;
+  }
+
+  return (const uint16_t*)toke_memmap_ptr(self->shards[document->shard]) + document->start;
+}
+
+size_t
+toke_token_shards_num_windows(const toke_token_shards_z* self, const size_t window_size)
+{
+  size_t count = 0;
+
+  for (size_t i = 0; i < toke_token_shards_num_shards(self); i++) {
+    if (self->shard_tokens[i] >= window_size) {
+      count += (size_t)(self->shard_tokens[i] - window_size) + 1;
+    }
+  }
+
+  return count;
+}
+
+/**
+ * @brief The SplitMix64 generator, which is fast, has a state of one integer and accepts any value as a seed.
+ * */
+static uint64_t
+next_random(uint64_t* state)
+{
+  uint64_t z = (*state += 0x9e3779b97f4a7c15ull);
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+  return z ^ (z >> 31);
+}
+
+/**
+ * @brief Draws an integer below the bound, rejecting the few draws that would make low values more likely.
+ * */
+static uint64_t
+next_random_below(uint64_t* state, const uint64_t bound)
+{
+  const uint64_t threshold = (0 - bound) % bound;
+
+  for (;;) {
+    const uint64_t r = next_random(state);
+    if (r >= threshold) {
+      return r % bound;
+    }
+  }
+}
+
+toke_error_z
+toke_token_shards_sample(const toke_token_shards_z* self,
+                         const size_t window_size,
+                         const size_t count,
+                         uint64_t* rng_state,
+                         uint16_t* output,
+                         uint64_t* starts)
+{
+  const size_t num_shards = toke_token_shards_num_shards(self);
+
+  const size_t num_windows = toke_token_shards_num_windows(self, window_size);
+
+  if ((window_size == 0) || (num_windows == 0)) {
+    return TOKE_ERROR_BUFFER_SIZE;
+  }
+
+  // the number of windows that start in the shards before each one, for finding the shard of a draw, and the number
+  // of tokens, for finding where the draw starts
+  uint64_t* windows_before = malloc(num_shards * 2 * sizeof(uint64_t));
+  if (!windows_before) {
+    return TOKE_ERROR_MEMORY_ALLOCATION;
+  }
+
+  uint64_t* tokens_before = windows_before + num_shards;
+
+  uint64_t windows = 0;
+
+  uint64_t tokens = 0;
+
+  for (size_t i = 0; i < num_shards; i++) {
+    windows_before[i] = windows;
+    tokens_before[i] = tokens;
+    if (self->shard_tokens[i] >= window_size) {
+      windows += (self->shard_tokens[i] - window_size) + 1;
+    }
+    tokens += self->shard_tokens[i];
+  }
+
+  for (size_t i = 0; i < count; i++) {
+
+    const uint64_t window = next_random_below(rng_state, num_windows);
+
+    // the last shard with no more windows before it than the draw, which skips any shard too small to hold one
+    size_t lo = 0;
+    size_t hi = num_shards;
+
+    while ((hi - lo) > 1) {
+      const size_t mid = lo + ((hi - lo) / 2);
+      if (windows_before[mid] <= window) {
+        lo = mid;
+      } else {
+        hi = mid;
+      }
+    }
+
+    const uint64_t start = window - windows_before[lo];
+
+    if (output) {
+      const uint16_t* shard = toke_memmap_ptr(self->shards[lo]);
+      memcpy(output + (i * window_size), shard + start, window_size * sizeof(uint16_t));
+    }
+
+    if (starts) {
+      starts[i] = tokens_before[lo] + start;
+    }
+  }
+
+  free(windows_before);
+
+  return TOKE_ERROR_NONE;
+}
@@ -0,0 +1,869 @@
+#include <toke/train/shards.h>
+
+#include "dataset_internal.h"
+#include "dedup_internal.h"
+#include "memmap.h"
+#include "shard_format.h"
+
+#include <omp.h>
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define DEFAULT_MAX_SHARD_TOKENS (128 * 1024 * 1024)
+
+/**
+ * @brief The buffer size of the shards and temporary files, which are written a document at a time.
+ * */
+#define WRITE_BUFFER_SIZE (1024 * 1024)
+
+struct toke_shard_writer
+{
+  size_t max_tokens;
+
+  enum toke_shard_order order;
+
+  size_t num_shards;
+
+  size_t num_documents;
+
+  size_t num_tokens;
+};
+
+toke_shard_writer_z*
+toke_shard_writer_new()
+{
+  toke_shard_writer_z* self = malloc(sizeof(toke_shard_writer_z));
+  if (!self) {
+    return NULL;
+  }
+
+  self->max_tokens = DEFAULT_MAX_SHARD_TOKENS;
+  self->order = TOKE_SHARD_ORDERED;
+  self->num_shards = 0;
+  self->num_documents = 0;
+  self->num_tokens = 0;
+
+  return self;
+}
+
+void
+toke_shard_writer_delete(toke_shard_writer_z* self)
+{
+  free(self);
+}
+
+void
+toke_shard_writer_set_max_tokens(toke_shard_writer_z* self, const size_t max_tokens)
+{
+  self->max_tokens = max_tokens;
+}
+
+void
+toke_shard_writer_set_order(toke_shard_writer_z* self, const toke_shard_order_z order)
+{
+  self->order = order;
+}
+
+size_t
+toke_shard_writer_num_shards(const toke_shard_writer_z* self)
+{
+  return self->num_shards;
+}
+
+size_t
+toke_shard_writer_num_documents(const toke_shard_writer_z* self)
+{
+  return self->num_documents;
+}
+
+size_t
+toke_shard_writer_num_tokens(const toke_shard_writer_z* self)
+{
+  return self->num_tokens;
+}
+
+static char*
+make_filename(const char* prefix, const char* suffix)
+{
+  const size_t prefix_size = strlen(prefix);
+  const size_t suffix_size = strlen(suffix);
+
+  char* result = malloc(prefix_size + suffix_size + 1);
+  if (!result) {
+    return NULL;
+  }
+
+  memcpy(result, prefix, prefix_size);
+  memcpy(result + prefix_size, suffix, suffix_size + 1);
+
+  return result;
+}
+
+static char*
+make_numbered_filename(const char* format, const char* prefix, const size_t number)
+{
+  const int size = snprintf(NULL, 0, format, prefix, number);
+  if (size < 0) {
+    return NULL;
+  }
+
+  char* result = malloc((size_t)size + 1);
+  if (!result) {
+    return NULL;
+  }
+
+  snprintf(result, (size_t)size + 1, format, prefix, number);
+
+  return result;
+}
+
+/**
+ * @brief The shards being written, and the index of what they hold.
+ * */
+struct shard_output
+{
+  const char* prefix;
+
+  size_t max_tokens;
+
+  /**
+   * @brief The shard being written to, or null if the next document starts a new one.
+   * */
+  FILE* file;
+
+  uint64_t* shard_tokens;
+
+  size_t num_shards;
+
+  size_t shards_capacity;
+
+  struct shard_document* documents;
+
+  size_t num_documents;
+
+  size_t documents_capacity;
+
+  uint64_t num_tokens;
+};
+
+static void
+output_init(struct shard_output* self, const char* prefix, const size_t max_tokens)
+{
+  memset(self, 0, sizeof(*self));
+  self->prefix = prefix;
+  self->max_tokens = max_tokens;
+}
+
+static void
+output_free(struct shard_output* self)
+{
+  if (self->file) {
+    fclose(self->file);
+  }
+
+  free(self->shard_tokens);
+  free(self->documents);
+}
+
+static toke_error_z
+output_start_shard(struct shard_output* self)
+{
+  if (self->num_shards == self->shards_capacity) {
+    const size_t capacity = self->shards_capacity ? (self->shards_capacity * 2) : 16;
+    uint64_t* tmp = realloc(self->shard_tokens, capacity * sizeof(uint64_t));
+    if (!tmp) {
+      return TOKE_ERROR_MEMORY_ALLOCATION;
+    }
+    self->shard_tokens = tmp;
+    self->shards_capacity = capacity;
+  }
+
+  char* filename = make_numbered_filename(SHARD_FILENAME_FORMAT, self->prefix, self->num_shards);
+  if (!filename) {
+    return TOKE_ERROR_MEMORY_ALLOCATION;
+  }
+
+  self->file = fopen(filename, "wb");
+
+  free(filename);
+
+  if (!self->file) {
+    return TOKE_ERROR_FILE_IO;
+  }
+
+  setvbuf(self->file, NULL, _IOFBF, WRITE_BUFFER_SIZE);
+
+  self->shard_tokens[self->num_shards] = 0;
+  self->num_shards++;
+
+  return TOKE_ERROR_NONE;
+}
+
+static toke_error_z
+output_close_shard(struct shard_output* self)
+{
+  FILE* file = self->file;
+
+  self->file = NULL;
+
+  return (fclose(file) == 0) ? TOKE_ERROR_NONE : TOKE_ERROR_FILE_IO;
+}
+
+/**
+ * @brief Adds a document to the end of the current shard, or to a new one if it would go over the limit.
+ * */
+static toke_error_z
+output_append(struct shard_output* self,
+              const uint64_t file_index,
+              const uint64_t offset,
+              const uint16_t* tokens,
+              const size_t num_tokens)
+{
+  toke_error_z err = TOKE_ERROR_NONE;
+
+  if (self->file && ((self->shard_tokens[self->num_shards - 1] + num_tokens) > self->max_tokens)) {
+    err = output_close_shard(self);
+    if (err != TOKE_ERROR_NONE) {
+      return err;
+    }
+  }
+
+  if (!self->file) {
+    err = output_start_shard(self);
+    if (err != TOKE_ERROR_NONE) {
+      return err;
+    }
+  }
+
+  if (self->num_documents == self->documents_capacity) {
+    const size_t capacity = self->documents_capacity ? (self->documents_capacity * 2) : 1024;
+    struct shard_document* tmp = realloc(self->documents, capacity * sizeof(struct shard_document));
+    if (!tmp) {
+      return TOKE_ERROR_MEMORY_ALLOCATION;
+    }
+    self->documents = tmp;
+    self->documents_capacity = capacity;
+  }
+
+  if ((num_tokens > 0) && (fwrite(tokens, sizeof(uint16_t), num_tokens, self->file) != num_tokens)) {
+    return TOKE_ERROR_FILE_IO;
+  }
+
+  uint64_t* shard_tokens = &self->shard_tokens[self->num_shards - 1];
+
+  struct shard_document* document = &self->documents[self->num_documents];
+  document->file_index = file_index;
+  document->offset = offset;
+  document->shard = self->num_shards - 1;
+  document->start = *shard_tokens;
+  document->num_tokens = num_tokens;
+
+  self->num_documents++;
+
+  *shard_tokens += num_tokens;
+
+  self->num_tokens += num_tokens;
+
+  return TOKE_ERROR_NONE;
+}
+
+/**
+ * @brief Removes the shards that an earlier write with the same prefix left past the last one of this write, so that
+ *        every shard with the prefix is one that the index lists.
+ *
+ * @details Shards are numbered without gaps, so the leftovers end at the first number without a file.
+ * */
+static toke_error_z
+remove_stale_shards(const struct shard_output* self)
+{
+  for (size_t i = self->num_shards;; i++) {
+
+    char* filename = make_numbered_filename(SHARD_FILENAME_FORMAT, self->prefix, i);
+    if (!filename) {
+      return TOKE_ERROR_MEMORY_ALLOCATION;
+    }
+
+    const int removed = remove(filename) == 0;
+
+    const int missing = !removed && (errno == ENOENT);
+
+    free(filename);
+
+    if (missing) {
+      return TOKE_ERROR_NONE;
+    }
+
+    if (!removed) {
+      return TOKE_ERROR_FILE_IO;
+    }
+  }
+}
+
+/**
+ * @brief Closes the last shard and writes the index, which goes through a temporary file so that it only ever appears
+ *        whole.
+ * */
+static toke_error_z
+output_finish(struct shard_output* self)
+{
+  if (self->file) {
+    const toke_error_z err = output_close_shard(self);
+    if (err != TOKE_ERROR_NONE) {
+      return err;
+    }
+  }
+
+  // before the index, so that the index is only there if the leftovers are gone
+  const toke_error_z err = remove_stale_shards(self);
+  if (err != TOKE_ERROR_NONE) {
+    return err;
+  }
+
+  char* index_filename = make_filename(self->prefix, SHARD_INDEX_SUFFIX);
+  char* tmp_filename = make_filename(self->prefix, SHARD_INDEX_SUFFIX ".tmp");
+
+  if (!index_filename || !tmp_filename) {
+    free(index_filename);
+    free(tmp_filename);
+    return TOKE_ERROR_MEMORY_ALLOCATION;
+  }
+
+  FILE* file = fopen(tmp_filename, "wb");
+  if (!file) {
+    free(index_filename);
+    free(tmp_filename);
+    return TOKE_ERROR_FILE_IO;
+  }
+
+  struct shard_index_header header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, SHARD_INDEX_MAGIC, sizeof(header.magic));
+  header.version = SHARD_INDEX_VERSION;
+  header.byte_order = SHARD_INDEX_BYTE_ORDER;
+  header.num_shards = self->num_shards;
+  header.num_documents = self->num_documents;
+  header.num_tokens = self->num_tokens;
+
+  int ok = fwrite(&header, sizeof(header), 1, file) == 1;
+
+  ok = ok && (fwrite(self->shard_tokens, sizeof(uint64_t), self->num_shards, file) == self->num_shards);
+
+  ok = ok &&
+       (fwrite(self->documents, sizeof(struct shard_document), self->num_documents, file) == self->num_documents);
+
+  if (fclose(file) != 0) {
+    ok = 0;
+  }
+
+  if (!ok || (rename(tmp_filename, index_filename) != 0)) {
+    remove(tmp_filename);
+    ok = 0;
+  }
+
+  free(index_filename);
+  free(tmp_filename);
+
+  return ok ? TOKE_ERROR_NONE : TOKE_ERROR_FILE_IO;
+}
+
+/**
+ * @brief Encodes a document, which may be empty (where the encoder has nothing to allocate).
+ * */
+static toke_error_z
+encode_document(toke_encoder_z* encoder,
+                const uint8_t* text,
+                const size_t text_size,
+                uint16_t** tokens,
+                size_t* num_tokens)
+{
+  *tokens = NULL;
+  *num_tokens = 0;
+
+  if (text_size == 0) {
+    return TOKE_ERROR_NONE;
+  }
+
+  *tokens = toke_encode(encoder, text, text_size, num_tokens);
+
+  return *tokens ? TOKE_ERROR_NONE : TOKE_ERROR_MEMORY_ALLOCATION;
+}
+
+static void
+record_error(toke_error_z* err_ptr, const toke_error_z err)
+{
+  if (err != TOKE_ERROR_NONE) {
+#pragma omp atomic write
+    *err_ptr = err;
+  }
+}
+
+static int
+has_error(const toke_error_z* err_ptr)
+{
+  toke_error_z err = TOKE_ERROR_NONE;
+
+#pragma omp atomic read
+  err = *err_ptr;
+
+  return err != TOKE_ERROR_NONE;
+}
+
+/**
+ * @brief The state of an unordered write, where each walker appends its document to the shards under a lock.
+ * */
+struct unordered_write
+{
+  toke_encoder_z* encoder;
+
+  struct shard_output* output;
+
+  omp_lock_t lock;
+
+  toke_error_z err;
+};
+
+static void
+write_unordered(void* user_data,
+                const uint8_t* text,
+                const size_t text_size,
+                const size_t file_index,
+                const size_t offset,
+                const size_t thread_index)
+{
+  (void)thread_index;
+
+  struct unordered_write* self = user_data;
+
+  // the walk can't be stopped, so once something failed the rest of it is skipped
+  if (has_error(&self->err)) {
+    return;
+  }
+
+  uint16_t* tokens = NULL;
+
+  size_t num_tokens = 0;
+
+  toke_error_z err = encode_document(self->encoder, text, text_size, &tokens, &num_tokens);
+
+  if (err == TOKE_ERROR_NONE) {
+    omp_set_lock(&self->lock);
+    err = output_append(self->output, file_index, offset, tokens, num_tokens);
+    omp_unset_lock(&self->lock);
+  }
+
+  free(tokens);
+
+  record_error(&self->err, err);
+}
+
+/**
+ * @brief A document that was encoded into a thread's temporary file, waiting to be copied to a shard.
+ * */
+struct spilled_document
+{
+  uint64_t file_index;
+
+  uint64_t offset;
+
+  /**
+   * @brief The position of the document's first token in the temporary file.
+   * */
+  uint64_t start;
+
+  uint64_t num_tokens;
+
+  size_t thread_index;
+
+  /**
+   * @brief The hash of the document's text, which is only set if the dataset skips duplicates.
+   * */
+  struct dedup_hash hash;
+
+  size_t text_size;
+};
+
+/**
+ * @brief The temporary file of a thread, which only that thread writes to during the walk.
+ * */
+struct spill
+{
+  FILE* file;
+
+  uint64_t num_tokens;
+
+  struct spilled_document* documents;
+
+  size_t num_documents;
+
+  size_t capacity;
+};
+
+/**
+ * @brief The state of an ordered write, where each walker appends its document to its thread's temporary file.
+ * */
+struct ordered_write
+{
+  toke_encoder_z* encoder;
+
+  /**
+   * @brief The dataset's set of duplicates, or null. The walk doesn't skip any, since which copy of a text reaches
+   *        the set first would then depend on the threads. The documents are added to the set when they are merged
+   *        instead, in the order of the dataset, so the copy that is kept is always the first.
+   * */
+  toke_dedup_z* dedup;
+
+  const char* prefix;
+
+  struct spill* spills;
+
+  toke_error_z err;
+};
+
+#define SPILL_FILENAME_FORMAT "%s-%05zu.tmp"
+
+static toke_error_z
+spill_append(struct spill* self,
+             const char* prefix,
+             const size_t thread_index,
+             const uint64_t file_index,
+             const uint64_t offset,
+             const struct dedup_hash hash,
+             const size_t text_size,
+             const uint16_t* tokens,
+             const size_t num_tokens)
+{
+  if (!self->file) {
+
+    char* filename = make_numbered_filename(SPILL_FILENAME_FORMAT, prefix, thread_index);
+    if (!filename) {
+      return TOKE_ERROR_MEMORY_ALLOCATION;
+    }
+
+    // read back as a mapping once the walk is done
+    self->file = fopen(filename, "w+b");
+
+    free(filename);
+
+    if (!self->file) {
+      return TOKE_ERROR_FILE_IO;
+    }
+
+    setvbuf(self->file, NULL, _IOFBF, WRITE_BUFFER_SIZE);
+  }
+
+  if (self->num_documents == self->capacity) {
+    const size_t capacity = self->capacity ? (self->capacity * 2) : 1024;
+    struct spilled_document* tmp = realloc(self->documents, capacity * sizeof(struct spilled_document));
+    if (!tmp) {
+      return TOKE_ERROR_MEMORY_ALLOCATION;
+    }
+    self->documents = tmp;
+    self->capacity = capacity;
+  }
+
+  if ((num_tokens > 0) && (fwrite(tokens, sizeof(uint16_t), num_tokens, self->file) != num_tokens)) {
+    return TOKE_ERROR_FILE_IO;
+  }
+
+  struct spilled_document* document = &self->documents[self->num_documents];
+  document->file_index = file_index;
+  document->offset = offset;
+  document->start = self->num_tokens;
+  document->num_tokens = num_tokens;
+  document->thread_index = thread_index;
+  document->hash = hash;
+  document->text_size = text_size;
+
+  self->num_documents++;
+
+  self->num_tokens += num_tokens;
+
+  return TOKE_ERROR_NONE;
+}
+
+static void
+write_ordered(void* user_data,
+              const uint8_t* text,
+              const size_t text_size,
+              const size_t file_index,
+              const size_t offset,
+              const size_t thread_index)
+{
+  struct ordered_write* self = user_data;
+
+  if (has_error(&self->err)) {
+    return;
+  }
+
+  uint16_t* tokens = NULL;
+
+  size_t num_tokens = 0;
+
+  toke_error_z err = encode_document(self->encoder, text, text_size, &tokens, &num_tokens);
+
+  // hashed here, so that the merge only has to look the hashes up
+  struct dedup_hash hash = { 0, 0 };
+
+  if (self->dedup) {
+    hash = toke_dedup_hash(text, text_size);
+  }
+
+  struct spill* spill = &self->spills[thread_index];
+
+  if (err == TOKE_ERROR_NONE) {
+    err = spill_append(spill, self->prefix, thread_index, file_index, offset, hash, text_size, tokens, num_tokens);
+  }
+
+  free(tokens);
+
+  record_error(&self->err, err);
+}
+
+static int
+cmp_spilled_documents(const void* l, const void* r)
+{
+  const struct spilled_document* a = l;
+  const struct spilled_document* b = r;
+
+  if (a->file_index != b->file_index) {
+    return (a->file_index < b->file_index) ? -1 : 1;
+  }
+
+  if (a->offset != b->offset) {
+    return (a->offset < b->offset) ? -1 : 1;
+  }
+
+  return 0;
+}
+
+/**
+ * @brief Copies the documents of the temporary files to the shards, in the order of the dataset.
+ *
+ * @param dedup The set that each document is added to before it is copied, skipping those already in it, or null to
+ *              copy every document.
+ * */
+static toke_error_z
+merge_spills(struct spill* spills,
+             const size_t num_spills,
+             const char* prefix,
+             toke_dedup_z* dedup,
+             struct shard_output* output)
+{
+  size_t num_documents = 0;
+
+  for (size_t i = 0; i < num_spills; i++) {
+    num_documents += spills[i].num_documents;
+  }
+
+  toke_memmap_z** maps = calloc(num_spills, sizeof(toke_memmap_z*));
+
+  // one more, so that an empty dataset never asks for zero bytes
+  struct spilled_document* documents = malloc((num_documents + 1) * sizeof(struct spilled_document));
+
+  toke_error_z err = (maps && documents) ? TOKE_ERROR_NONE : TOKE_ERROR_MEMORY_ALLOCATION;
+
+  size_t offset = 0;
+
+  for (size_t i = 0; (i < num_spills) && (err == TOKE_ERROR_NONE); i++) {
+
+    if (!spills[i].file) {
+      continue;
+    }
+
+    memcpy(documents + offset, spills[i].documents, spills[i].num_documents * sizeof(struct spilled_document));
+
+    offset += spills[i].num_documents;
+
+    FILE* file = spills[i].file;
+
+    spills[i].file = NULL;
+
+    if (fclose(file) != 0) {
+      err = TOKE_ERROR_FILE_IO;
+      break;
+    }
+
+    if (spills[i].num_tokens == 0) {
+      continue;
+    }
+
+    char* filename = make_numbered_filename(SPILL_FILENAME_FORMAT, prefix, i);
+    if (!filename) {
+      err = TOKE_ERROR_MEMORY_ALLOCATION;
+      break;
+    }
+
+    maps[i] = toke_memmap_open(filename);
+
+    free(filename);
+
+    if (!maps[i]) {
+      err = TOKE_ERROR_FILE_IO;
+      break;
+    }
+
+    toke_memmap_advise(maps[i], 0, toke_memmap_size(maps[i]), TOKE_MEMMAP_SEQUENTIAL);
+  }
+
+  if (err == TOKE_ERROR_NONE) {
+    qsort(documents, num_documents, sizeof(struct spilled_document), cmp_spilled_documents);
+  }
+
+  for (size_t i = 0; (i < num_documents) && (err == TOKE_ERROR_NONE); i++) {
+
+    const struct spilled_document* document = &documents[i];
+
+    if (dedup) {
+
+      int is_new = 0;
+
+      err = toke_dedup_insert_hash(dedup, document->hash, document->text_size, &is_new);
+
+      if (!is_new) {
+        continue;
+      }
+    }
+
+    const uint16_t* tokens = NULL;
+
+    if (document->num_tokens > 0) {
+      tokens = (const uint16_t*)toke_memmap_ptr(maps[document->thread_index]) + document->start;
+    }
+
+    err = output_append(output, document->file_index, document->offset, tokens, (size_t)document->num_tokens);
+  }
+
+  if (maps) {
+    for (size_t i = 0; i < num_spills; i++) {
+      toke_memmap_close(maps[i]);
+    }
+  }
+
+  free(maps);
+  free(documents);
+
+  return err;
+}
+
+/**
+ * @brief Closes and removes the temporary files, which are of no use once merged or after a failure.
+ * */
+static void
+free_spills(struct spill* spills, const size_t num_spills, const char* prefix)
+{
+  for (size_t i = 0; i < num_spills; i++) {
+
+    if (spills[i].file) {
+      fclose(spills[i].file);
+    }
+
+    if (spills[i].file || spills[i].documents) {
+      char* filename = make_numbered_filename(SPILL_FILENAME_FORMAT, prefix, i);
+      if (filename) {
+        remove(filename);
+        free(filename);
+      }
+    }
+
+    free(spills[i].documents);
+  }
+
+  free(spills);
+}
+
+static toke_error_z
+write_shards(const toke_shard_writer_z* self,
+             const toke_dataset_z* dataset,
+             toke_encoder_z* encoder,
+             const size_t max_threads,
+             struct shard_output* output)
+{
+  if (self->order == TOKE_SHARD_UNORDERED) {
+
+    struct unordered_write state;
+    state.encoder = encoder;
+    state.output = output;
+    state.err = TOKE_ERROR_NONE;
+
+    omp_init_lock(&state.lock);
+
+    const toke_error_z err = toke_dataset_walk(dataset, max_threads, &state, write_unordered);
+
+    omp_destroy_lock(&state.lock);
+
+    return (err != TOKE_ERROR_NONE) ? err : state.err;
+  }
+
+  struct ordered_write state;
+  state.encoder = encoder;
+  state.dedup = dataset->dedup;
+  state.prefix = output->prefix;
+  state.spills = calloc(max_threads, sizeof(struct spill));
+  state.err = TOKE_ERROR_NONE;
+
+  if (!state.spills) {
+    return TOKE_ERROR_MEMORY_ALLOCATION;
+  }
+
+  toke_error_z err = toke_dataset_walk_all(dataset, max_threads, &state, write_ordered);
+
+  if (err == TOKE_ERROR_NONE) {
+    err = state.err;
+  }
+
+  if (err == TOKE_ERROR_NONE) {
+    err = merge_spills(state.spills, max_threads, output->prefix, state.dedup, output);
+  }
+
+  free_spills(state.spills, max_threads, output->prefix);
+
+  return err;
+}
+
+toke_error_z
+toke_shard_writer_write(toke_shard_writer_z* self,
+                        const toke_dataset_z* dataset,
+                        toke_encoder_z* encoder,
+                        const char* prefix,
+                        size_t max_threads)
+{
+  if (max_threads == 0) {
+    max_threads = 1;
+  }
+
+  self->num_shards = 0;
+  self->num_documents = 0;
+  self->num_tokens = 0;
+
+  // the shards are about to be overwritten, so an index left over from before would no longer describe them
+  char* index_filename = make_filename(prefix, SHARD_INDEX_SUFFIX);
+  if (!index_filename) {
+    return TOKE_ERROR_MEMORY_ALLOCATION;
+  }
+
+  remove(index_filename);
+
+  free(index_filename);
+
+  struct shard_output output;
+  output_init(&output, prefix, self->max_tokens);
+
+  toke_error_z err = write_shards(self, dataset, encoder, max_threads, &output);
+
+  if (err == TOKE_ERROR_NONE) {
+    err = output_finish(&output);
+  }
+
+  if (err == TOKE_ERROR_NONE) {
+    self->num_shards = output.num_shards;
+    self->num_documents = output.num_documents;
+    self->num_tokens = (size_t)output.num_tokens;
+  }
+
+  output_free(&output);
+
+  return err;
+}
@@ -0,0 +1,622 @@
+#include "unicode.h"
+
+#include "unicode_data.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define HANGUL_S_BASE 0xac00
+#define HANGUL_L_BASE 0x1100
+#define HANGUL_V_BASE 0x1161
+#define HANGUL_T_BASE 0x11a7
+#define HANGUL_L_COUNT 19
+#define HANGUL_V_COUNT 21
+#define HANGUL_T_COUNT 28
+#define HANGUL_N_COUNT (HANGUL_V_COUNT * HANGUL_T_COUNT)
+#define HANGUL_S_COUNT (HANGUL_L_COUNT * HANGUL_N_COUNT)
+
+size_t
+toke_utf8_decode(const uint8_t* text, const size_t remaining, uint32_t* codepoint)
+{
+  const uint8_t lead = text[0];
+
+  if (lead < 0x80) {
+    *codepoint = lead;
+    return 1;
+  }
+
+  size_t size = 0;
+  uint32_t value = 0;
+  uint32_t min_value = 0;
+
+  if ((lead >= 0xc2) && (lead <= 0xdf)) {
+    size = 2;
+    value = lead & 0x1f;
+    min_value = 0x80;
+  } else if ((lead >= 0xe0) && (lead <= 0xef)) {
+    size = 3;
+    value = lead & 0x0f;
+    min_value = 0x800;
+  } else if ((lead >= 0xf0) && (lead <= 0xf4)) {
+    size = 4;
+    value = lead & 0x07;
+    min_value = 0x10000;
+  } else {
+    return 0;
+  }
+
+  if (size > remaining) {
+    return 0;
+  }
+
+  for (size_t i = 1; i < size; i++) {
+    const uint8_t c = text[i];
+    if ((c & 0xc0) != 0x80) {
+      return 0;
+    }
+    value = (value << 6) | (c & 0x3f);
+  }
+
+  if ((value < min_value) || (value > 0x10ffff) || ((value >= 0xd800) && (value <= 0xdfff))) {
+    return 0;
+  }
+
+  *codepoint = value;
+
+  return size;
+}
+
+size_t
+toke_utf8_encode(const uint32_t codepoint, uint8_t* utf8)
+{
+  if (codepoint <= 0x7f) {
+    utf8[0] = (uint8_t)codepoint;
+    return 1;
+  } else if (codepoint <= 0x7ff) {
+    utf8[0] = (uint8_t)((codepoint >> 6) | 0xc0);
+    utf8[1] = (uint8_t)((codepoint & 0x3f) | 0x80);
+    return 2;
+  } else if (codepoint <= 0xffff) {
+    utf8[0] = (uint8_t)((codepoint >> 12) | 0xe0);
+    utf8[1] = (uint8_t)(((codepoint >> 6) & 0x3f) | 0x80);
+    utf8[2] = (uint8_t)((codepoint & 0x3f) | 0x80);
+    return 3;
+  }
+  utf8[0] = (uint8_t)((codepoint >> 18) | 0xf0);
+  utf8[1] = (uint8_t)(((codepoint >> 12) & 0x3f) | 0x80);
+  utf8[2] = (uint8_t)(((codepoint >> 6) & 0x3f) | 0x80);
+  utf8[3] = (uint8_t)((codepoint & 0x3f) | 0x80);
+  return 4;
+}
+
+static uint16_t
+quick_check_mask(const enum toke_unicode_form form)
+{
+  if (form == TOKE_UNICODE_NFKC) {
+    return TOKE_UNICODE_NFKC_QC_NO | TOKE_UNICODE_NFKC_QC_MAYBE;
+  }
+  return TOKE_UNICODE_NFC_QC_NO | TOKE_UNICODE_NFC_QC_MAYBE;
+}
+
+/**
+ * @brief Scans forward from a boundary for the first codepoint that may change under normalization.
+ *
+ * @param boundary Receives the offset of the last boundary before that codepoint, which is where the segment to
+ *                 normalize starts.
+ *
+ * @return The offset of the codepoint, or the length of the text if there isn't one.
+ * */
+static size_t
+find_unnormalized(const uint8_t* text,
+                  const size_t length,
+                  const size_t offset,
+                  const enum toke_unicode_form form,
+                  size_t* boundary)
+{
+  const uint16_t qc_mask = quick_check_mask(form);
+
+  size_t pos = offset;
+
+  size_t last_boundary = offset;
+
+  uint16_t last_ccc = 0;
+
+  // the codepoints since the last boundary, so that overly long segments are cut where the other scans cut them
+  size_t count = 0;
+
+  while (pos < length) {
+
+    if (text[pos] < 0x80) {
+      last_boundary = pos;
+      last_ccc = 0;
+      count = 1;
+      pos++;
+      continue;
+    }
+
+    uint32_t codepoint = 0;
+
+    const size_t size = toke_utf8_decode(text + pos, length - pos, &codepoint);
+    if (size == 0) {
+      // invalid bytes are passed through, so nothing before them can interact with anything after them
+      pos++;
+      last_boundary = pos;
+      last_ccc = 0;
+      count = 0;
+      continue;
+    }
+
+    const uint16_t props = toke_unicode_props(codepoint);
+
+    const uint16_t ccc = props & TOKE_UNICODE_CCC_MASK;
+
+    if (count == TOKE_UNICODE_MAX_SEGMENT) {
+      last_boundary = pos;
+      last_ccc = 0;
+      count = 0;
+    }
+
+    if (props & qc_mask) {
+      break;
+    }
+
+    if (ccc == 0) {
+      last_boundary = pos;
+      count = 0;
+    } else if (ccc < last_ccc) {
+      // out of canonical order
+      break;
+    }
+
+    last_ccc = ccc;
+
+    count++;
+
+    pos += size;
+  }
+
+  *boundary = last_boundary;
+
+  return pos;
+}
+
+/**
+ * @brief Finds the end of the segment that starts at the offset.
+ *
+ * @return The offset of the next codepoint that starts a new segment, or the length of the text.
+ * */
+static size_t
+find_next_boundary(const uint8_t* text, const size_t length, const size_t offset, const enum toke_unicode_form form)
+{
+  const uint16_t qc_mask = quick_check_mask(form);
+
+  uint32_t codepoint = 0;
+
+  size_t pos = offset + toke_utf8_decode(text + offset, length - offset, &codepoint);
+
+  size_t count = 1;
+
+  while (pos < length) {
+
+    if (text[pos] < 0x80) {
+      return pos;
+    }
+
+    const size_t size = toke_utf8_decode(text + pos, length - pos, &codepoint);
+    if (size == 0) {
+      return pos;
+    }
+
+    const uint16_t props = toke_unicode_props(codepoint);
+
+    if ((((props & TOKE_UNICODE_CCC_MASK) == 0) && !(props & qc_mask)) || (count == TOKE_UNICODE_MAX_SEGMENT)) {
+      return pos;
+    }
+
+    count++;
+
+    pos += size;
+  }
+
+  return length;
+}
+
+size_t
+toke_unicode_quick_check(const uint8_t* text, const size_t length, const enum toke_unicode_form form)
+{
+  size_t boundary = 0;
+
+  const size_t pos = find_unnormalized(text, length, 0, form, &boundary);
+
+  return (pos < length) ? boundary : length;
+}
+
+/**
+ * @brief Checks whether the bytes are the start of a UTF-8 sequence that the text ends before.
+ * */
+static int
+is_truncated(const uint8_t* text, const size_t remaining)
+{
+  const uint8_t lead = text[0];
+
+  size_t size = 0;
+
+  if ((lead >= 0xc2) && (lead <= 0xdf)) {
+    size = 2;
+  } else if ((lead >= 0xe0) && (lead <= 0xef)) {
+    size = 3;
+  } else if ((lead >= 0xf0) && (lead <= 0xf4)) {
+    size = 4;
+  }
+
+  if (size <= remaining) {
+    return 0;
+  }
+
+  for (size_t i = 1; i < remaining; i++) {
+    if ((text[i] & 0xc0) != 0x80) {
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
+size_t
+toke_unicode_last_boundary(const uint8_t* text, const size_t length, const enum toke_unicode_form form)
+{
+  const uint16_t qc_mask = quick_check_mask(form);
+
+  size_t pos = 0;
+
+  size_t last_boundary = 0;
+
+  size_t count = 0;
+
+  while (pos < length) {
+
+    if (text[pos] < 0x80) {
+      last_boundary = pos;
+      count = 1;
+      pos++;
+      continue;
+    }
+
+    uint32_t codepoint = 0;
+
+    const size_t size = toke_utf8_decode(text + pos, length - pos, &codepoint);
+    if (size == 0) {
+      if (is_truncated(text + pos, length - pos)) {
+        // the rest of the sequence may still arrive
+        break;
+      }
+      pos++;
+      last_boundary = pos;
+      count = 0;
+      continue;
+    }
+
+    const uint16_t props = toke_unicode_props(codepoint);
+
+    if ((((props & TOKE_UNICODE_CCC_MASK) == 0) && !(props & qc_mask)) || (count == TOKE_UNICODE_MAX_SEGMENT)) {
+      last_boundary = pos;
+      count = 0;
+    }
+
+    count++;
+
+    pos += size;
+  }
+
+  return last_boundary;
+}
+
+struct buffer
+{
+  uint8_t* data;
+
+  size_t size;
+
+  size_t capacity;
+};
+
+static int
+reserve(struct buffer* buf, const size_t extra)
+{
+  if ((buf->size + extra) <= buf->capacity) {
+    return 1;
+  }
+
+  size_t capacity = buf->capacity ? buf->capacity : 64;
+  while (capacity < (buf->size + extra)) {
+    capacity *= 2;
+  }
+
+  uint8_t* data = realloc(buf->data, capacity);
+  if (!data) {
+    return 0;
+  }
+
+  buf->data = data;
+  buf->capacity = capacity;
+
+  return 1;
+}
+
+struct codepoints
+{
+  uint32_t* data;
+
+  size_t size;
+
+  size_t capacity;
+};
+
+static int
+push_codepoint(struct codepoints* cps, const uint32_t codepoint)
+{
+  if (cps->size == cps->capacity) {
+    const size_t capacity = cps->capacity ? (cps->capacity * 2) : 32;
+    uint32_t* data = realloc(cps->data, capacity * sizeof(uint32_t));
+    if (!data) {
+      return 0;
+    }
+    cps->data = data;
+    cps->capacity = capacity;
+  }
+
+  cps->data[cps->size] = codepoint;
+  cps->size++;
+
+  return 1;
+}
+
+static int
+cmp_decomposition(const void* key, const void* element)
+{
+  const uint32_t codepoint = *(const uint32_t*)key;
+  const struct toke_decomposition* d = (const struct toke_decomposition*)element;
+  return (codepoint < d->codepoint) ? -1 : ((codepoint > d->codepoint) ? 1 : 0);
+}
+
+static int
+decompose(struct codepoints* cps, const uint32_t codepoint, const enum toke_unicode_form form)
+{
+  if ((codepoint >= HANGUL_S_BASE) && (codepoint < (HANGUL_S_BASE + HANGUL_S_COUNT))) {
+    const uint32_t index = codepoint - HANGUL_S_BASE;
+    const uint32_t t = index % HANGUL_T_COUNT;
+    int ok = push_codepoint(cps, HANGUL_L_BASE + (index / HANGUL_N_COUNT));
+    ok = ok && push_codepoint(cps, HANGUL_V_BASE + ((index % HANGUL_N_COUNT) / HANGUL_T_COUNT));
+    if (t != 0) {
+      ok = ok && push_codepoint(cps, HANGUL_T_BASE + t);
+    }
+    return ok;
+  }
+
+  const uint16_t props = toke_unicode_props(codepoint);
+
+  const uint16_t flag = (form == TOKE_UNICODE_NFKC) ? TOKE_UNICODE_HAS_COMPAT : TOKE_UNICODE_HAS_CANONICAL;
+
+  if (!(props & flag)) {
+    return push_codepoint(cps, codepoint);
+  }
+
+  const struct toke_decomposition* d = bsearch(&codepoint,
+                                               toke_unicode_decompositions,
+                                               TOKE_UNICODE_DECOMPOSITION_COUNT,
+                                               sizeof(struct toke_decomposition),
+                                               cmp_decomposition);
+  if (!d) {
+    return push_codepoint(cps, codepoint);
+  }
+
+  const size_t offset = (form == TOKE_UNICODE_NFKC) ? d->compat_offset : d->canonical_offset;
+  const size_t size = (form == TOKE_UNICODE_NFKC) ? d->compat_size : d->canonical_size;
+
+  for (size_t i = 0; i < size; i++) {
+    if (!push_codepoint(cps, toke_unicode_decomposition_pool[offset + i])) {
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
+static uint16_t
+get_ccc(const uint32_t codepoint)
+{
+  return toke_unicode_props(codepoint) & TOKE_UNICODE_CCC_MASK;
+}
+
+static void
+canonical_order(uint32_t* cps, const size_t size)
+{
+  // insertion sort keeps marks with equal classes in their original order, as required
+  for (size_t i = 1; i < size; i++) {
+
+    const uint32_t codepoint = cps[i];
+    const uint16_t ccc = get_ccc(codepoint);
+    if (ccc == 0) {
+      continue;
+    }
+
+    size_t j = i;
+    while ((j > 0) && (get_ccc(cps[j - 1]) > ccc)) {
+      cps[j] = cps[j - 1];
+      j--;
+    }
+    cps[j] = codepoint;
+  }
+}
+
+static uint32_t
+compose_pair(const uint32_t first, const uint32_t second)
+{
+  if ((first >= HANGUL_L_BASE) && (first < (HANGUL_L_BASE + HANGUL_L_COUNT)) && (second >= HANGUL_V_BASE) &&
+      (second < (HANGUL_V_BASE + HANGUL_V_COUNT))) {
+    return HANGUL_S_BASE + ((first - HANGUL_L_BASE) * HANGUL_N_COUNT) + ((second - HANGUL_V_BASE) * HANGUL_T_COUNT);
+  }
+
+  if ((first >= HANGUL_S_BASE) && (first < (HANGUL_S_BASE + HANGUL_S_COUNT)) &&
+      (((first - HANGUL_S_BASE) % HANGUL_T_COUNT) == 0) && (second > HANGUL_T_BASE) &&
+      (second < (HANGUL_T_BASE + HANGUL_T_COUNT))) {
+    return first + (second - HANGUL_T_BASE);
+  }
+
+  size_t lo = 0;
+  size_t hi = TOKE_UNICODE_COMPOSITION_COUNT;
+
+  while (lo < hi) {
+    const size_t mid = lo + ((hi - lo) / 2);
+    const struct toke_composition* c = &toke_unicode_compositions[mid];
+    if ((c->first < first) || ((c->first == first) && (c->second < second))) {
+      lo = mid + 1;
+    } else if ((c->first == first) && (c->second == second)) {
+      return c->composite;
+    } else {
+      hi = mid;
+    }
+  }
+
+  return 0;
+}
+
+static size_t
+compose(uint32_t* cps, const size_t size)
+{
+  if (size == 0) {
+    return 0;
+  }
+
+  size_t starter_index = 0;
+
+  uint32_t starter = cps[0];
+
+  // a leading non-starter has nothing to compose with
+  uint16_t last_ccc = get_ccc(starter) ? 256 : 0;
+
+  size_t out = 1;
+
+  for (size_t i = 1; i < size; i++) {
+
+    const uint32_t codepoint = cps[i];
+    const uint16_t ccc = get_ccc(codepoint);
+
+    if ((last_ccc < ccc) || (last_ccc == 0)) {
+      const uint32_t composite = compose_pair(starter, codepoint);
+      if (composite != 0) {
+        cps[starter_index] = composite;
+        starter = composite;
+        continue;
+      }
+    }
+
+    if (ccc == 0) {
+      starter_index = out;
+      starter = codepoint;
+    }
+
+    last_ccc = ccc;
+
+    cps[out] = codepoint;
+    out++;
+  }
+
+  return out;
+}
+
+static int
+normalize_segment(const uint8_t* text,
+                  const size_t length,
+                  const enum toke_unicode_form form,
+                  struct codepoints* cps,
+                  struct buffer* out)
+{
+  cps->size = 0;
+
+  size_t pos = 0;
+
+  while (pos < length) {
+    uint32_t codepoint = 0;
+    // segments never contain invalid bytes
+    pos += toke_utf8_decode(text + pos, length - pos, &codepoint);
+    if (!decompose(cps, codepoint, form)) {
+      return 0;
+    }
+  }
+
+  canonical_order(cps->data, cps->size);
+
+  const size_t size = compose(cps->data, cps->size);
+
+  if (!reserve(out, size * 4)) {
+    return 0;
+  }
+
+  for (size_t i = 0; i < size; i++) {
+    out->size += toke_utf8_encode(cps->data[i], out->data + out->size);
+  }
+
+  return 1;
+}
+
+static int
+append(struct buffer* out, const uint8_t* text, const size_t size)
+{
+  if (!reserve(out, size)) {
+    return 0;
+  }
+  memcpy(out->data + out->size, text, size);
+  out->size += size;
+  return 1;
+}
+
+uint8_t*
+toke_unicode_normalize(const uint8_t* text,
+                       const size_t length,
+                       const enum toke_unicode_form form,
+                       size_t* out_length)
+{
+  struct buffer out = { NULL, 0, 0 };
+
+  struct codepoints cps = { NULL, 0, 0 };
+
+  int ok = reserve(&out, length + 1);
+
+  size_t copied = 0;
+
+  while (ok && (copied < length)) {
+
+    size_t segment_start = 0;
+
+    const size_t pos = find_unnormalized(text, length, copied, form, &segment_start);
+    if (pos == length) {
+      break;
+    }
+
+    const size_t segment_end = find_next_boundary(text, length, segment_start, form);
+
+    ok = append(&out, text + copied, segment_start - copied);
+
+    ok = ok && normalize_segment(text + segment_start, segment_end - segment_start, form, &cps, &out);
+
+    copied = segment_end;
+  }
+
+  ok = ok && append(&out, text + copied, length - copied);
+
+  ok = ok && reserve(&out, 1);
+
+  free(cps.data);
+
+  if (!ok) {
+    free(out.data);
+    return NULL;
+  }
+
+  out.data[out.size] = 0;
+
+  *out_length = out.size;
+
+  return out.data;
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+enum toke_unicode_form
+{
+  TOKE_UNICODE_NFC,
+  TOKE_UNICODE_NFKC
+};
+
+/**
+ * @brief The most codepoints in a segment, which is a starter and the thirty non-starters that UAX #15 allows in
+ *        stream-safe text. A longer run is cut into segments of this many codepoints, each normalized on its own, so
+ *        that no run of combining marks has to be buffered (or sorted) whole.
+ * */
+#define TOKE_UNICODE_MAX_SEGMENT 31
+
+/**
+ * @brief Decodes one UTF-8 sequence, rejecting overlong forms and surrogates.
+ *
+ * @return The size of the sequence, or zero if the bytes do not start a valid one.
+ * */
+size_t
+toke_utf8_decode(const uint8_t* text, size_t remaining, uint32_t* codepoint);
+
+/**
+ * @brief Encodes a valid codepoint as UTF-8.
+ *
+ * @return The number of bytes written, which is at most four.
+ * */
+size_t
+toke_utf8_encode(uint32_t codepoint, uint8_t* utf8);
+
+/**
+ * @brief Finds how much of the text is known to already be in the normalization form.
+ *
+ * @details Only the properties of each codepoint are looked up, so this is much cheaper than normalizing. Bytes that
+ *          are not valid UTF-8 are left as they are by normalization, so they never fail the check.
+ *
+ * @return The length of the text if it is normalized, otherwise the offset of the segment that needs normalizing.
+ * */
+size_t
+toke_unicode_quick_check(const uint8_t* text, size_t length, enum toke_unicode_form form);
+
+/**
+ * @brief Finds the start of the last segment, which text appended later could still change.
+ *
+ * @details The text must start at a segment boundary. Normalizing the text up to the returned offset gives the same
+ *          result whatever follows it, so a stream can emit that much and carry the rest over to the next chunk. What
+ *          is carried over is never more than one segment, of at most @ref TOKE_UNICODE_MAX_SEGMENT codepoints.
+ *
+ * @return The offset of the last boundary, which is zero if there isn't one after the start.
+ * */
+size_t
+toke_unicode_last_boundary(const uint8_t* text, size_t length, enum toke_unicode_form form);
+
+/**
+ * @brief Normalizes UTF-8 text to NFC or NFKC.
+ *
+ * @details Runs of text that pass the quick check are copied as they are, so only the segments around codepoints
+ *          that may change are decomposed and recomposed.
+ *
+ * @return A new, null terminated buffer, or null if memory could not be allocated.
+ * */
+uint8_t*
+toke_unicode_normalize(const uint8_t* text, size_t length, enum toke_unicode_form form, size_t* out_length);
@@ -0,0 +1,9732 @@
+/* Generated by scripts/generate_unicode_tables.py from Unicode 14.0.0. Do not edit. */
+
+#include "unicode_data.h"
+
+const uint16_t toke_unicode_props_stage1[6097] = {
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+  0x0000, 0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x0000, 0x0000, 0x0000, 0x000d, 0x000e, 0x000f,
+  0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001a, 0x001b,
+  0x001c, 0x0000, 0x001d, 0x001e, 0x0000, 0x0000, 0x0000, 0x0000, 0x001f, 0x0020, 0x0021, 0x0000,
+  0x0022, 0x0023, 0x0024, 0x0025, 0x0000, 0x0000, 0x0026, 0x0027, 0x0028, 0x0029, 0x002a, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x002b, 0x002c, 0x002d, 0x002e, 0x0000, 0x002f, 0x0000, 0x0030, 0x0031,
+  0x0000, 0x0032, 0x0033, 0x0000, 0x0000, 0x0034, 0x0035, 0x0036, 0x0000, 0x0037, 0x0038, 0x0000,
+  0x0000, 0x0039, 0x003a, 0x0000, 0x0000, 0x0034, 0x003b, 0x0000, 0x003c, 0x003d, 0x003e, 0x0000,
+  0x0000, 0x0039, 0x003f, 0x0000, 0x0000, 0x0039, 0x0040, 0x0000, 0x0000, 0x0041, 0x003e, 0x0000,
+  0x0000, 0x0000, 0x0042, 0x0000, 0x0000, 0x0043, 0x0044, 0x0000, 0x0000, 0x0045, 0x0046, 0x0000,
+  0x0047, 0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x0000, 0x0000, 0x004e, 0x0000, 0x0000,
+  0x004f, 0x0000, 0x0000, 0x0050, 0x0000, 0x0000, 0x0000, 0x0051, 0x0000, 0x0052, 0x0053, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0055, 0x0056, 0x0000, 0x0000, 0x0000, 0x0000, 0x0057, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0058, 0x0000, 0x0000, 0x0000, 0x0059, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x005a, 0x0000, 0x0000, 0x005b, 0x0000, 0x005c, 0x005d, 0x0000,
+  0x005e, 0x005f, 0x0060, 0x0061, 0x0000, 0x0062, 0x0000, 0x0063, 0x0000, 0x0064, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0065, 0x0066, 0x0000, 0x0067, 0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d,
+  0x006e, 0x006e, 0x006e, 0x006e, 0x006f, 0x006e, 0x006e, 0x0070, 0x0071, 0x006e, 0x0072, 0x0073,
+  0x006e, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007a, 0x007b, 0x007c, 0x007d, 0x007e,
+  0x007f, 0x0080, 0x0081, 0x006b, 0x0082, 0x0083, 0x0084, 0x0000, 0x0085, 0x0086, 0x0087, 0x0088,
+  0x0089, 0x008a, 0x0000, 0x008b, 0x0000, 0x008c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x006b, 0x006b, 0x006b, 0x006b, 0x008d, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x008e, 0x0000, 0x0000, 0x008f, 0x0000, 0x0000, 0x0090, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0091, 0x0000, 0x0000, 0x0000, 0x0092,
+  0x0000, 0x0000, 0x0000, 0x0093, 0x0000, 0x0000, 0x0000, 0x0094, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0095, 0x0000, 0x0000, 0x0096, 0x006b, 0x006b, 0x006b, 0x006b, 0x006b, 0x006b, 0x0097, 0x0000,
+  0x0098, 0x0099, 0x009a, 0x009b, 0x009c, 0x009a, 0x009b, 0x009d, 0x0000, 0x009e, 0x006b, 0x006b,
+  0x009f, 0x0000, 0x0000, 0x0000, 0x00a0, 0x006b, 0x00a1, 0x00a0, 0x006b, 0x006b, 0x006b, 0x006b,
+  0x006b, 0x006b, 0x006b, 0x006b, 0x006b, 0x006b, 0x006b, 0x006b, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00a2,
+  0x00a3, 0x0000, 0x0000, 0x00a4, 0x0000, 0x0000, 0x0000, 0x00a5, 0x0000, 0x0000, 0x0000, 0x00a6,
+  0x00a7, 0x00a8, 0x0000, 0x0000, 0x0000, 0x0000, 0x00a9, 0x00aa, 0x0000, 0x00ab, 0x00ac, 0x0000,
+  0x0000, 0x00ad, 0x00ae, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00af, 0x00b0, 0x00b1,
+  0x0000, 0x0000, 0x00b2, 0x00b3, 0x0000, 0x0000, 0x0000, 0x003a, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x00b4, 0x00b4, 0x00b4, 0x00b4, 0x00b4, 0x00b4, 0x00b4, 0x00b4, 0x00b5, 0x00b6, 0x00b4, 0x00b7,
+  0x00b4, 0x00b4, 0x00b8, 0x0000, 0x00b9, 0x00ba, 0x00bb, 0x006b, 0x006b, 0x00bc, 0x00bd, 0x006b,
+  0x006b, 0x006b, 0x006b, 0x006b, 0x006b, 0x006b, 0x006b, 0x006b, 0x006b, 0x00be, 0x00bf, 0x006b,
+  0x00c0, 0x006b, 0x00c1, 0x00c2, 0x00c3, 0x00c4, 0x00c5, 0x00c6, 0x006b, 0x006b, 0x006b, 0x00c7,
+  0x00c8, 0x006b, 0x006b, 0x006b, 0x006b, 0x00a0, 0x00c9, 0x00ca, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00cb,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00cc, 0x0000, 0x0000, 0x0000, 0x00cd,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00ce, 0x00cf, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x00d0, 0x00d1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00d2,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00d3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00d4, 0x0000, 0x0000, 0x0000, 0x0000, 0x00d5, 0x0000,
+  0x00d6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00a7, 0x00d7, 0x00d8, 0x00d9, 0x0000, 0x0000,
+  0x00da, 0x00db, 0x0000, 0x00ad, 0x0000, 0x0000, 0x00dc, 0x0000, 0x0000, 0x00dd, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x00de, 0x0000, 0x00df, 0x00e0, 0x00e1, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x00e2, 0x0000, 0x0000, 0x00e3, 0x00e4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x00e5, 0x00e6, 0x0000, 0x0000, 0x00e7, 0x0000, 0x0000, 0x0000, 0x00e8, 0x0000, 0x0000,
+  0x0000, 0x00e9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00ea, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00eb, 0x00ec, 0x0000, 0x0000, 0x0000, 0x0000, 0x00ae,
+  0x0000, 0x0056, 0x00ed, 0x0000, 0x00ee, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x00ef, 0x0000, 0x00f0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00f1,
+  0x0000, 0x00f2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x00f3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x00f4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x00f5, 0x00f6, 0x00f7, 0x00f8, 0x00f9, 0x0000, 0x0000, 0x0000, 0x00fa, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x006b, 0x006b, 0x00fb, 0x006b, 0x00fc, 0x00fd, 0x00fe, 0x006b, 0x00ff, 0x0100, 0x0101, 0x006b,
+  0x006b, 0x006b, 0x006b, 0x006b, 0x006b, 0x006b, 0x006b, 0x006b, 0x006b, 0x0102, 0x006b, 0x006b,
+  0x006b, 0x006b, 0x006b, 0x006b, 0x006b, 0x006b, 0x0103, 0x006b, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0104, 0x0105, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0106, 0x0000, 0x0107,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0108, 0x0000,
+  0x0000, 0x0000, 0x0109, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x00fe, 0x010a, 0x010b, 0x010c, 0x010d, 0x010e, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x010f, 0x0110, 0x0111, 0x0112, 0x00a5, 0x0000, 0x0000, 0x0000,
+  0x0113, 0x0114, 0x0115, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00c3, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00b4, 0x00b4, 0x00b4, 0x00b4,
+  0x00b4, 0x00b4, 0x00b4, 0x00b4, 0x00b4, 0x00b4, 0x00b4, 0x00b4, 0x00b4, 0x00b4, 0x00b4, 0x00b4,
+  0x0116
+};
+
+const uint16_t toke_unicode_props_stage2[8928] = {
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2400, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x2400, 0x0000, 0x2400, 0x0000, 0x0000, 0x0000, 0x0000, 0x2400,
+  0x0000, 0x0000, 0x2400, 0x2400, 0x2400, 0x2400, 0x0000, 0x0000, 0x2400, 0x2400, 0x2400, 0x0000,
+  0x2400, 0x2400, 0x2400, 0x0000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x0000, 0x3000,
+  0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x0000, 0x3000, 0x3000, 0x3000,
+  0x3000, 0x3000, 0x3000, 0x0000, 0x0000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x0000, 0x0000,
+  0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x0000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+  0x3000, 0x3000, 0x3000, 0x3000, 0x0000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x0000,
+  0x0000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x0000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+  0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+  0x0000, 0x0000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+  0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x0000, 0x0000,
+  0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x0000, 0x2400, 0x2400,
+  0x3000, 0x3000, 0x3000, 0x3000, 0x0000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x2400,
+  0x2400, 0x0000, 0x0000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x2400, 0x0000, 0x0000,
+  0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x0000, 0x0000, 0x3000, 0x3000, 0x3000, 0x3000,
+  0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+  0x3000, 0x3000, 0x0000, 0x0000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+  0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+  0x3000, 0x3000, 0x3000, 0x2400, 0x3000, 0x3000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3000, 0x3000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+  0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x0000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+  0x0000, 0x0000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+  0x3000, 0x2400, 0x2400, 0x2400, 0x3000, 0x3000, 0x0000, 0x0000, 0x3000, 0x3000, 0x3000, 0x3000,
+  0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+  0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+  0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x0000, 0x0000, 0x3000, 0x3000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+  0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x0000, 0x0000,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0ae6, 0x0ae6, 0x0ae6, 0x0ae6,
+  0x0ae6, 0x00e6, 0x0ae6, 0x0ae6, 0x0ae6, 0x0ae6, 0x0ae6, 0x0ae6, 0x0ae6, 0x00e6, 0x00e6, 0x0ae6,
+  0x00e6, 0x0ae6, 0x00e6, 0x0ae6, 0x0ae6, 0x00e8, 0x00dc, 0x00dc, 0x00dc, 0x00dc, 0x00e8, 0x0ad8,
+  0x00dc, 0x00dc, 0x00dc, 0x00dc, 0x00dc, 0x00ca, 0x00ca, 0x0adc, 0x0adc, 0x0adc, 0x0adc, 0x0aca,
+  0x0aca, 0x00dc, 0x00dc, 0x00dc, 0x00dc, 0x0adc, 0x0adc, 0x00dc, 0x0adc, 0x0adc, 0x00dc, 0x00dc,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0a01, 0x00dc, 0x00dc, 0x00dc, 0x00dc, 0x00e6, 0x00e6, 0x00e6,
+  0x35e6, 0x35e6, 0x0ae6, 0x35e6, 0x35e6, 0x0af0, 0x00e6, 0x00dc, 0x00dc, 0x00dc, 0x00e6, 0x00e6,
+  0x00e6, 0x00dc, 0x00dc, 0x0000, 0x00e6, 0x00e6, 0x00e6, 0x00dc, 0x00dc, 0x00dc, 0x00dc, 0x00e6,
+  0x00e8, 0x00dc, 0x00dc, 0x00e6, 0x00e9, 0x00ea, 0x00ea, 0x00e9, 0x00ea, 0x00ea, 0x00e9, 0x00e6,
+  0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x3500, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2400, 0x0000,
+  0x0000, 0x0000, 0x3500, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2400, 0x3400, 0x3000, 0x3500,
+  0x3000, 0x3000, 0x3000, 0x0000, 0x3000, 0x0000, 0x3000, 0x3000, 0x3000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3000, 0x3000,
+  0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x0000,
+  0x2400, 0x2400, 0x2400, 0x3400, 0x3400, 0x2400, 0x2400, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2400, 0x2400, 0x2400, 0x0000,
+  0x2400, 0x2400, 0x0000, 0x0000, 0x0000, 0x2400, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x3000, 0x3000, 0x0000, 0x3000, 0x0000, 0x0000, 0x0000, 0x3000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x3000, 0x3000, 0x3000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x3000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3000, 0x3000, 0x0000, 0x3000,
+  0x0000, 0x0000, 0x0000, 0x3000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3000, 0x3000, 0x3000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3000, 0x3000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e6,
+  0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3000, 0x3000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3000, 0x3000, 0x3000, 0x3000,
+  0x0000, 0x0000, 0x3000, 0x3000, 0x0000, 0x0000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+  0x0000, 0x0000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x0000, 0x0000, 0x3000, 0x3000,
+  0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x0000, 0x0000,
+  0x3000, 0x3000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x2400, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x00dc, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00dc, 0x00e6, 0x00e6, 0x00e6, 0x00de, 0x00dc,
+  0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00dc, 0x00dc, 0x00dc, 0x00dc, 0x00dc, 0x00dc,
+  0x00e6, 0x00e6, 0x00dc, 0x00e6, 0x00e6, 0x00de, 0x00e4, 0x00e6, 0x000a, 0x000b, 0x000c, 0x000d,
+  0x000e, 0x000f, 0x0010, 0x0011, 0x0012, 0x0013, 0x0013, 0x0014, 0x0015, 0x0016, 0x0000, 0x0017,
+  0x0000, 0x0018, 0x0019, 0x0000, 0x00e6, 0x00dc, 0x0000, 0x0012, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x001e, 0x001f, 0x0020, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x001b,
+  0x001c, 0x001d, 0x001e, 0x001f, 0x0020, 0x0021, 0x0022, 0x0ae6, 0x0ae6, 0x0adc, 0x00dc, 0x00e6,
+  0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00dc, 0x00e6, 0x00e6, 0x00dc, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0023, 0x0000, 0x0000, 0x0000, 0x0000, 0x2400, 0x2400, 0x2400, 0x2400, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x3000, 0x0000, 0x3000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3000,
+  0x0000, 0x0000, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x0000, 0x0000, 0x00e6,
+  0x00e6, 0x00e6, 0x00e6, 0x00dc, 0x00e6, 0x0000, 0x0000, 0x00e6, 0x00e6, 0x0000, 0x00dc, 0x00e6,
+  0x00e6, 0x00dc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0024, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e6, 0x00dc, 0x00e6, 0x00e6,
+  0x00dc, 0x00e6, 0x00e6, 0x00dc, 0x00dc, 0x00dc, 0x00e6, 0x00dc, 0x00dc, 0x00e6, 0x00dc, 0x00e6,
+  0x00e6, 0x00e6, 0x00dc, 0x00e6, 0x00dc, 0x00e6, 0x00dc, 0x00e6, 0x00dc, 0x00e6, 0x00e6, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6,
+  0x00e6, 0x00e6, 0x00dc, 0x00e6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x00dc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x0000, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6,
+  0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x0000, 0x00e6, 0x00e6, 0x00e6, 0x0000, 0x00e6, 0x00e6, 0x00e6,
+  0x00e6, 0x00e6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00dc, 0x00dc, 0x00dc,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x00e6, 0x00dc, 0x00dc, 0x00dc, 0x00e6, 0x00e6, 0x00e6, 0x00e6,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e6, 0x00e6,
+  0x00e6, 0x00e6, 0x00e6, 0x00dc, 0x00dc, 0x00dc, 0x00dc, 0x00dc, 0x00e6, 0x00e6, 0x00e6, 0x00e6,
+  0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x0000, 0x00dc,
+  0x00e6, 0x00e6, 0x00dc, 0x00e6, 0x00e6, 0x00dc, 0x00e6, 0x00e6, 0x00e6, 0x00dc, 0x00dc, 0x00dc,
+  0x001b, 0x001c, 0x001d, 0x00e6, 0x00e6, 0x00e6, 0x00dc, 0x00e6, 0x00e6, 0x00dc, 0x00dc, 0x00e6,
+  0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x3000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3000, 0x0000, 0x0000,
+  0x3000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0a07, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0009, 0x0000, 0x0000, 0x0000, 0x00e6, 0x00dc, 0x00e6, 0x00e6, 0x0000, 0x0000, 0x0000,
+  0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0007, 0x0000, 0x0a00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x3000, 0x3000, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0a00, 0x0000, 0x0000, 0x0000, 0x0000, 0x3500, 0x3500, 0x0000, 0x3500,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x3500, 0x0000, 0x0000, 0x3500, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0007, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3500, 0x3500, 0x3500, 0x0000, 0x0000, 0x3500, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0007, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x3000, 0x0000, 0x0000, 0x3000, 0x3000, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0a00, 0x0a00, 0x0000, 0x0000, 0x0000, 0x0000, 0x3500, 0x3500, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0a00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x3000, 0x3000, 0x3000, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0a00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0054, 0x0a5b, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3000, 0x0000, 0x0a00, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x3000, 0x3000, 0x0000, 0x3000, 0x3000, 0x0000, 0x0009, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0a00, 0x0a00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0009, 0x0000, 0x0a00, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0a09, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0a00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x3000, 0x0000, 0x3000, 0x3000, 0x3000, 0x0a00, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x2400, 0x0000, 0x0000, 0x0000, 0x0000, 0x0067, 0x0067, 0x0009, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x006b, 0x006b, 0x006b, 0x006b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2400, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0076, 0x0076, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x007a, 0x007a, 0x007a, 0x007a, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x2400, 0x2400, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x2400, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x00dc, 0x00dc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00dc, 0x0000, 0x00dc,
+  0x0000, 0x00d8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3500,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3500, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x3500, 0x0000, 0x0000, 0x0000, 0x0000, 0x3500, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x3500, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x3500, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0081, 0x0082, 0x3500,
+  0x0084, 0x3500, 0x3500, 0x2400, 0x3500, 0x2400, 0x0082, 0x0082, 0x0082, 0x0082, 0x0000, 0x0000,
+  0x0082, 0x3500, 0x00e6, 0x00e6, 0x0009, 0x0000, 0x00e6, 0x00e6, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3500, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3500, 0x0000, 0x0000, 0x0000, 0x0000, 0x3500, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x3500, 0x0000, 0x0000, 0x0000, 0x0000, 0x3500, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3500, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00dc, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0a00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0007,
+  0x0000, 0x0009, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00dc, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2400, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0a00, 0x0a00, 0x0a00, 0x0a00, 0x0a00, 0x0a00, 0x0a00, 0x0a00, 0x0a00, 0x0a00, 0x0a00,
+  0x0a00, 0x0a00, 0x0a00, 0x0a00, 0x0a00, 0x0a00, 0x0a00, 0x0a00, 0x0a00, 0x0a00, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0a00, 0x0a00, 0x0a00, 0x0a00, 0x0a00, 0x0a00, 0x0a00, 0x0a00,
+  0x0a00, 0x0a00, 0x0a00, 0x0a00, 0x0a00, 0x0a00, 0x0a00, 0x0a00, 0x0a00, 0x0a00, 0x0a00, 0x0a00,
+  0x0a00, 0x0a00, 0x0a00, 0x0a00, 0x0a00, 0x0a00, 0x0a00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e6, 0x00e6, 0x00e6, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00de, 0x00e6, 0x00dc, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e6,
+  0x00dc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6,
+  0x00e6, 0x0000, 0x0000, 0x00dc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e6, 0x00e6, 0x00e6, 0x00e6,
+  0x00e6, 0x00dc, 0x00dc, 0x00dc, 0x00dc, 0x00dc, 0x00dc, 0x00e6, 0x00e6, 0x00dc, 0x0000, 0x00dc,
+  0x00dc, 0x00e6, 0x00e6, 0x00dc, 0x00dc, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00dc, 0x00e6,
+  0x00e6, 0x00e6, 0x00e6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x3000, 0x0000, 0x3000, 0x0000, 0x3000, 0x0000, 0x3000, 0x0000, 0x3000, 0x0000,
+  0x0000, 0x0000, 0x3000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0007, 0x0a00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3000, 0x0000, 0x3000, 0x0000, 0x0000,
+  0x3000, 0x3000, 0x0000, 0x3000, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e6, 0x00dc, 0x00e6, 0x00e6, 0x00e6,
+  0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0009, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0007, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0007, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e6, 0x00e6, 0x00e6, 0x0000,
+  0x0001, 0x00dc, 0x00dc, 0x00dc, 0x00dc, 0x00dc, 0x00e6, 0x00e6, 0x00dc, 0x00dc, 0x00dc, 0x00dc,
+  0x00e6, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x00dc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e6, 0x0000, 0x0000, 0x0000,
+  0x00e6, 0x00e6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2400, 0x2400, 0x2400, 0x0000,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x0000,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x0000, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x2400, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x00e6, 0x00e6, 0x00dc, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00dc, 0x00e6,
+  0x00e6, 0x00ea, 0x00d6, 0x00dc, 0x00ca, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6,
+  0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6,
+  0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6,
+  0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e8, 0x00e4, 0x00e4, 0x00dc, 0x00da, 0x00e6,
+  0x00e9, 0x00dc, 0x00e6, 0x00dc, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+  0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+  0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+  0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+  0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+  0x3000, 0x3000, 0x2400, 0x3400, 0x0000, 0x0000, 0x0000, 0x0000, 0x3000, 0x3000, 0x3000, 0x3000,
+  0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+  0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+  0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+  0x3000, 0x3000, 0x0000, 0x0000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x0000, 0x0000,
+  0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x0000, 0x0000, 0x3000, 0x3000, 0x3000, 0x3000,
+  0x3000, 0x3000, 0x0000, 0x0000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+  0x0000, 0x3000, 0x0000, 0x3000, 0x0000, 0x3000, 0x0000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+  0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+  0x3000, 0x3500, 0x3000, 0x3500, 0x3000, 0x3500, 0x3000, 0x3500, 0x3000, 0x3500, 0x3000, 0x3500,
+  0x3000, 0x3500, 0x0000, 0x0000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+  0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+  0x3000, 0x0000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3500, 0x3000, 0x2400, 0x3500, 0x2400,
+  0x2400, 0x3400, 0x3000, 0x3000, 0x3000, 0x0000, 0x3000, 0x3000, 0x3000, 0x3500, 0x3000, 0x3500,
+  0x3000, 0x3400, 0x3400, 0x3400, 0x3000, 0x3000, 0x3000, 0x3500, 0x0000, 0x0000, 0x3000, 0x3000,
+  0x3000, 0x3000, 0x3000, 0x3500, 0x0000, 0x3400, 0x3400, 0x3400, 0x3000, 0x3000, 0x3000, 0x3500,
+  0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3500, 0x3000, 0x3400, 0x3500, 0x3500,
+  0x0000, 0x0000, 0x3000, 0x3000, 0x3000, 0x0000, 0x3000, 0x3000, 0x3000, 0x3500, 0x3000, 0x3500,
+  0x3000, 0x3500, 0x2400, 0x0000, 0x3500, 0x3500, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2400, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x2400, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x2400, 0x2400, 0x2400, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x2400, 0x0000, 0x0000, 0x0000, 0x2400, 0x2400, 0x0000, 0x2400, 0x2400,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x2400, 0x0000, 0x2400, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x2400, 0x2400, 0x2400, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2400, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x2400, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2400, 0x2400, 0x0000, 0x0000,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x0000, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x2400, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e6, 0x00e6, 0x0001, 0x0001,
+  0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x0001, 0x0001, 0x0001, 0x00e6, 0x00e6, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x00e6, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x00e6, 0x00dc, 0x00e6, 0x0001, 0x0001,
+  0x00dc, 0x00dc, 0x00dc, 0x00dc, 0x00e6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x0000, 0x2400, 0x2400, 0x2400, 0x0000, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x0000, 0x2400, 0x2400, 0x0000, 0x0000, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x0000, 0x0000, 0x2400, 0x2400, 0x2400, 0x0000, 0x2400, 0x0000, 0x3500, 0x0000,
+  0x2400, 0x0000, 0x3500, 0x3500, 0x2400, 0x2400, 0x0000, 0x2400, 0x2400, 0x2400, 0x0000, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x0000, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x0000, 0x0000, 0x0000, 0x0000, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2400, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3000, 0x3000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x3000, 0x3000, 0x3000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x3000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3000, 0x0000, 0x0000, 0x3000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3000, 0x0000, 0x3000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x2400, 0x2400, 0x0000, 0x2400, 0x2400, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x3000, 0x0000, 0x0000, 0x3000, 0x0000, 0x0000, 0x3000, 0x0000, 0x3000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3000, 0x0000, 0x3000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3000, 0x3000, 0x3000,
+  0x3000, 0x3000, 0x0000, 0x0000, 0x3000, 0x3000, 0x0000, 0x0000, 0x3000, 0x3000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x3000, 0x3000, 0x0000, 0x0000, 0x3000, 0x3000, 0x0000, 0x0000,
+  0x3000, 0x3000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x3000, 0x3000, 0x3000, 0x3000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3000, 0x3000, 0x3000, 0x3000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3000, 0x3000, 0x3000, 0x3000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x3500, 0x3500, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2400, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x2400, 0x2400, 0x2400, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x3500, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x2400, 0x2400, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e6, 0x00e6, 0x00e6, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x2400, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x00e6, 0x00e6, 0x00e6, 0x00e6,
+  0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6,
+  0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6,
+  0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2400,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2400, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x2400, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00da, 0x00e4,
+  0x00e8, 0x00de, 0x00e0, 0x00e0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2400, 0x0000,
+  0x2400, 0x2400, 0x2400, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3000, 0x0000, 0x3000, 0x0000,
+  0x3000, 0x0000, 0x3000, 0x0000, 0x3000, 0x0000, 0x3000, 0x0000, 0x3000, 0x0000, 0x3000, 0x0000,
+  0x3000, 0x0000, 0x3000, 0x0000, 0x3000, 0x0000, 0x3000, 0x0000, 0x0000, 0x3000, 0x0000, 0x3000,
+  0x0000, 0x3000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3000, 0x3000, 0x0000, 0x3000,
+  0x3000, 0x0000, 0x3000, 0x3000, 0x0000, 0x3000, 0x3000, 0x0000, 0x3000, 0x3000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0a08, 0x0a08, 0x2400, 0x2400, 0x0000, 0x3000, 0x2400, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x3000, 0x0000, 0x0000, 0x3000, 0x3000, 0x3000, 0x3000, 0x0000,
+  0x0000, 0x0000, 0x3000, 0x2400, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x0000, 0x0000, 0x0000, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x0000, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x00e6, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e6, 0x00e6, 0x00e6, 0x00e6,
+  0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x2400, 0x2400, 0x00e6, 0x00e6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e6, 0x00e6, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x2400, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x2400, 0x2400, 0x2400, 0x0000, 0x0000, 0x0000, 0x2400, 0x2400, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6,
+  0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00dc,
+  0x00dc, 0x00dc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0007,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x00e6, 0x0000, 0x00e6, 0x00e6, 0x00dc, 0x0000, 0x0000, 0x00e6, 0x00e6, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x00e6, 0x00e6, 0x0000, 0x00e6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x2400, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500,
+  0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500,
+  0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500,
+  0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x0000, 0x0000,
+  0x3500, 0x0000, 0x3500, 0x0000, 0x0000, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500,
+  0x3500, 0x3500, 0x3500, 0x0000, 0x3500, 0x0000, 0x3500, 0x0000, 0x0000, 0x3500, 0x3500, 0x0000,
+  0x0000, 0x0000, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500,
+  0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500,
+  0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500,
+  0x3500, 0x3500, 0x0000, 0x0000, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500,
+  0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500,
+  0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500,
+  0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3500, 0x001a, 0x3500,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x3500, 0x3500,
+  0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x0000,
+  0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x0000, 0x3500, 0x0000, 0x3500, 0x3500, 0x0000, 0x3500,
+  0x3500, 0x0000, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x0000, 0x0000, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e6, 0x00e6, 0x00e6, 0x00e6,
+  0x00e6, 0x00e6, 0x00e6, 0x00dc, 0x00dc, 0x00dc, 0x00dc, 0x00dc, 0x00dc, 0x00dc, 0x00e6, 0x00e6,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x0000, 0x0000, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x0000,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x0000, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x2400, 0x2400, 0x2400, 0x0000, 0x2400, 0x0000, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x0000, 0x0000, 0x0000, 0x0000, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x0000, 0x0000, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x0000, 0x0000, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x0000, 0x0000, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x0000, 0x0000, 0x2400, 0x2400, 0x2400, 0x0000, 0x0000, 0x0000, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x0000, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00dc, 0x0000, 0x0000,
+  0x00dc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x0000, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x0000, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00dc, 0x0000, 0x00e6,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x00e6, 0x0001, 0x00dc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e6, 0x00dc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x00e6, 0x00e6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00dc, 0x00dc, 0x00e6, 0x00e6, 0x00e6, 0x00dc,
+  0x00e6, 0x00dc, 0x00dc, 0x00dc, 0x00dc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e6, 0x00dc,
+  0x00e6, 0x00dc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x3000, 0x0000, 0x3000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0a07, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x00e6, 0x00e6, 0x00e6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0a00, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x3000, 0x3000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0009, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0007, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0009, 0x0007, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0007, 0x0009, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0007,
+  0x0007, 0x0000, 0x0a00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x3000, 0x3000, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0a00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6,
+  0x00e6, 0x0000, 0x0000, 0x0000, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000,
+  0x0000, 0x0000, 0x0007, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x00e6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0a00, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0a00, 0x3000, 0x3000, 0x0a00, 0x3000, 0x0000,
+  0x0000, 0x0000, 0x0009, 0x0007, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0a00,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3000, 0x3000,
+  0x0000, 0x0000, 0x0000, 0x0009, 0x0007, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0007, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0009, 0x0007, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0a00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0009, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0007, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0007, 0x0000, 0x0009, 0x0009, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e6, 0x00e6, 0x00e6, 0x00e6,
+  0x00e6, 0x00e6, 0x00e6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0006, 0x0006, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3500, 0x3500,
+  0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x00d8, 0x00d8, 0x0001, 0x0001, 0x0001, 0x0000, 0x0000,
+  0x0000, 0x00e2, 0x00d8, 0x00d8, 0x00d8, 0x00d8, 0x00d8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x00dc, 0x00dc, 0x00dc, 0x00dc, 0x00dc, 0x00dc, 0x00dc, 0x00dc, 0x0000,
+  0x0000, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00dc, 0x00dc, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500,
+  0x3500, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e6, 0x00e6,
+  0x00e6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x0000, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x0000, 0x2400, 0x2400, 0x0000, 0x0000, 0x2400, 0x0000,
+  0x0000, 0x2400, 0x2400, 0x0000, 0x0000, 0x2400, 0x2400, 0x2400, 0x2400, 0x0000, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x0000, 0x2400,
+  0x0000, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x0000, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x0000, 0x2400, 0x2400, 0x2400, 0x2400, 0x0000,
+  0x0000, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x0000, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x0000, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x0000, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x0000, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x0000, 0x2400, 0x0000,
+  0x0000, 0x0000, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x0000, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x0000, 0x0000, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x0000, 0x0000, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x0000,
+  0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6,
+  0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x0000, 0x0000, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6,
+  0x00e6, 0x00e6, 0x0000, 0x00e6, 0x00e6, 0x0000, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e6, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x00dc, 0x00dc, 0x00dc, 0x00dc, 0x00dc, 0x00dc, 0x00dc, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x0007, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2400, 0x2400, 0x0000, 0x2400, 0x0000, 0x0000, 0x2400,
+  0x0000, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x0000,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x0000, 0x2400, 0x0000, 0x2400, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x2400, 0x0000, 0x0000, 0x0000, 0x0000, 0x2400, 0x0000, 0x2400, 0x0000, 0x2400,
+  0x0000, 0x2400, 0x2400, 0x2400, 0x0000, 0x2400, 0x2400, 0x0000, 0x2400, 0x0000, 0x0000, 0x2400,
+  0x0000, 0x2400, 0x0000, 0x2400, 0x0000, 0x2400, 0x0000, 0x2400, 0x0000, 0x2400, 0x2400, 0x0000,
+  0x2400, 0x0000, 0x0000, 0x2400, 0x2400, 0x2400, 0x2400, 0x0000, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x0000, 0x2400, 0x2400, 0x2400, 0x2400, 0x0000, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x0000, 0x2400, 0x0000, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x0000, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x2400, 0x2400, 0x2400, 0x0000, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x0000, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x0000, 0x0000, 0x0000, 0x0000, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x0000, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2400, 0x2400, 0x2400, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x2400, 0x2400, 0x2400, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x0000, 0x0000, 0x0000, 0x0000, 0x2400, 0x2400, 0x2400, 0x2400,
+  0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x2400, 0x2400, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500,
+  0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500,
+  0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x0000, 0x0000
+};
+
+const struct toke_decomposition toke_unicode_decompositions[5795] = {
+  { 0x000a0, 0, 0, 1, 0 },
+  { 0x000a8, 1, 0, 2, 1 },
+  { 0x000aa, 3, 0, 1, 3 },
+  { 0x000af, 4, 0, 2, 4 },
+  { 0x000b2, 6, 0, 1, 6 },
+  { 0x000b3, 7, 0, 1, 7 },
+  { 0x000b4, 8, 0, 2, 8 },
+  { 0x000b5, 10, 0, 1, 10 },
+  { 0x000b8, 11, 0, 2, 11 },
+  { 0x000b9, 13, 0, 1, 13 },
+  { 0x000ba, 14, 0, 1, 14 },
+  { 0x000bc, 15, 0, 3, 15 },
+  { 0x000bd, 18, 0, 3, 18 },
+  { 0x000be, 21, 0, 3, 21 },
+  { 0x000c0, 24, 2, 2, 24 },
+  { 0x000c1, 26, 2, 2, 26 },
+  { 0x000c2, 28, 2, 2, 28 },
+  { 0x000c3, 30, 2, 2, 30 },
+  { 0x000c4, 32, 2, 2, 32 },
+  { 0x000c5, 34, 2, 2, 34 },
+  { 0x000c7, 36, 2, 2, 36 },
+  { 0x000c8, 38, 2, 2, 38 },
+  { 0x000c9, 40, 2, 2, 40 },
+  { 0x000ca, 42, 2, 2, 42 },
+  { 0x000cb, 44, 2, 2, 44 },
+  { 0x000cc, 46, 2, 2, 46 },
+  { 0x000cd, 48, 2, 2, 48 },
+  { 0x000ce, 50, 2, 2, 50 },
+  { 0x000cf, 52, 2, 2, 52 },
+  { 0x000d1, 54, 2, 2, 54 },
+  { 0x000d2, 56, 2, 2, 56 },
+  { 0x000d3, 58, 2, 2, 58 },
+  { 0x000d4, 60, 2, 2, 60 },
+  { 0x000d5, 62, 2, 2, 62 },
+  { 0x000d6, 64, 2, 2, 64 },
+  { 0x000d9, 66, 2, 2, 66 },
+  { 0x000da, 68, 2, 2, 68 },
+  { 0x000db, 70, 2, 2, 70 },
+  { 0x000dc, 72, 2, 2, 72 },
+  { 0x000dd, 74, 2, 2, 74 },
+  { 0x000e0, 76, 2, 2, 76 },
+  { 0x000e1, 78, 2, 2, 78 },
+  { 0x000e2, 80, 2, 2, 80 },
+  { 0x000e3, 82, 2, 2, 82 },
+  { 0x000e4, 84, 2, 2, 84 },
+  { 0x000e5, 86, 2, 2, 86 },
+  { 0x000e7, 88, 2, 2, 88 },
+  { 0x000e8, 90, 2, 2, 90 },
+  { 0x000e9, 92, 2, 2, 92 },
+  { 0x000ea, 94, 2, 2, 94 },
+  { 0x000eb, 96, 2, 2, 96 },
+  { 0x000ec, 98, 2, 2, 98 },
+  { 0x000ed, 100, 2, 2, 100 },
+  { 0x000ee, 102, 2, 2, 102 },
+  { 0x000ef, 104, 2, 2, 104 },
+  { 0x000f1, 106, 2, 2, 106 },
+  { 0x000f2, 108, 2, 2, 108 },
+  { 0x000f3, 110, 2, 2, 110 },
+  { 0x000f4, 112, 2, 2, 112 },
+  { 0x000f5, 114, 2, 2, 114 },
+  { 0x000f6, 116, 2, 2, 116 },
+  { 0x000f9, 118, 2, 2, 118 },
+  { 0x000fa, 120, 2, 2, 120 },
+  { 0x000fb, 122, 2, 2, 122 },
+  { 0x000fc, 124, 2, 2, 124 },
+  { 0x000fd, 126, 2, 2, 126 },
+  { 0x000ff, 128, 2, 2, 128 },
+  { 0x00100, 130, 2, 2, 130 },
+  { 0x00101, 132, 2, 2, 132 },
+  { 0x00102, 134, 2, 2, 134 },
+  { 0x00103, 136, 2, 2, 136 },
+  { 0x00104, 138, 2, 2, 138 },
+  { 0x00105, 140, 2, 2, 140 },
+  { 0x00106, 142, 2, 2, 142 },
+  { 0x00107, 144, 2, 2, 144 },
+  { 0x00108, 146, 2, 2, 146 },
+  { 0x00109, 148, 2, 2, 148 },
+  { 0x0010a, 150, 2, 2, 150 },
+  { 0x0010b, 152, 2, 2, 152 },
+  { 0x0010c, 154, 2, 2, 154 },
+  { 0x0010d, 156, 2, 2, 156 },
+  { 0x0010e, 158, 2, 2, 158 },
+  { 0x0010f, 160, 2, 2, 160 },
+  { 0x00112, 162, 2, 2, 162 },
+  { 0x00113, 164, 2, 2, 164 },
+  { 0x00114, 166, 2, 2, 166 },
+  { 0x00115, 168, 2, 2, 168 },
+  { 0x00116, 170, 2, 2, 170 },
+  { 0x00117, 172, 2, 2, 172 },
+  { 0x00118, 174, 2, 2, 174 },
+  { 0x00119, 176, 2, 2, 176 },
+  { 0x0011a, 178, 2, 2, 178 },
+  { 0x0011b, 180, 2, 2, 180 },
+  { 0x0011c, 182, 2, 2, 182 },
+  { 0x0011d, 184, 2, 2, 184 },
+  { 0x0011e, 186, 2, 2, 186 },
+  { 0x0011f, 188, 2, 2, 188 },
+  { 0x00120, 190, 2, 2, 190 },
+  { 0x00121, 192, 2, 2, 192 },
+  { 0x00122, 194, 2, 2, 194 },
+  { 0x00123, 196, 2, 2, 196 },
+  { 0x00124, 198, 2, 2, 198 },
+  { 0x00125, 200, 2, 2, 200 },
+  { 0x00128, 202, 2, 2, 202 },
+  { 0x00129, 204, 2, 2, 204 },
+  { 0x0012a, 206, 2, 2, 206 },
+  { 0x0012b, 208, 2, 2, 208 },
+  { 0x0012c, 210, 2, 2, 210 },
+  { 0x0012d, 212, 2, 2, 212 },
+  { 0x0012e, 214, 2, 2, 214 },
+  { 0x0012f, 216, 2, 2, 216 },
+  { 0x00130, 218, 2, 2, 218 },
+  { 0x00132, 220, 0, 2, 220 },
+  { 0x00133, 222, 0, 2, 222 },
+  { 0x00134, 224, 2, 2, 224 },
+  { 0x00135, 226, 2, 2, 226 },
+  { 0x00136, 228, 2, 2, 228 },
+  { 0x00137, 230, 2, 2, 230 },
+  { 0x00139, 232, 2, 2, 232 },
+  { 0x0013a, 234, 2, 2, 234 },
+  { 0x0013b, 236, 2, 2, 236 },
+  { 0x0013c, 238, 2, 2, 238 },
+  { 0x0013d, 240, 2, 2, 240 },
+  { 0x0013e, 242, 2, 2, 242 },
+  { 0x0013f, 244, 0, 2, 244 },
+  { 0x00140, 246, 0, 2, 246 },
+  { 0x00143, 248, 2, 2, 248 },
+  { 0x00144, 250, 2, 2, 250 },
+  { 0x00145, 252, 2, 2, 252 },
+  { 0x00146, 254, 2, 2, 254 },
+  { 0x00147, 256, 2, 2, 256 },
+  { 0x00148, 258, 2, 2, 258 },
+  { 0x00149, 260, 0, 2, 260 },
+  { 0x0014c, 262, 2, 2, 262 },
+  { 0x0014d, 264, 2, 2, 264 },
+  { 0x0014e, 266, 2, 2, 266 },
+  { 0x0014f, 268, 2, 2, 268 },
+  { 0x00150, 270, 2, 2, 270 },
+  { 0x00151, 272, 2, 2, 272 },
+  { 0x00154, 274, 2, 2, 274 },
+  { 0x00155, 276, 2, 2, 276 },
+  { 0x00156, 278, 2, 2, 278 },
+  { 0x00157, 280, 2, 2, 280 },
+  { 0x00158, 282, 2, 2, 282 },
+  { 0x00159, 284, 2, 2, 284 },
+  { 0x0015a, 286, 2, 2, 286 },
+  { 0x0015b, 288, 2, 2, 288 },
+  { 0x0015c, 290, 2, 2, 290 },
+  { 0x0015d, 292, 2, 2, 292 },
+  { 0x0015e, 294, 2, 2, 294 },
+  { 0x0015f, 296, 2, 2, 296 },
+  { 0x00160, 298, 2, 2, 298 },
+  { 0x00161, 300, 2, 2, 300 },
+  { 0x00162, 302, 2, 2, 302 },
+  { 0x00163, 304, 2, 2, 304 },
+  { 0x00164, 306, 2, 2, 306 },
+  { 0x00165, 308, 2, 2, 308 },
+  { 0x00168, 310, 2, 2, 310 },
+  { 0x00169, 312, 2, 2, 312 },
+  { 0x0016a, 314, 2, 2, 314 },
+  { 0x0016b, 316, 2, 2, 316 },
+  { 0x0016c, 318, 2, 2, 318 },
+  { 0x0016d, 320, 2, 2, 320 },
+  { 0x0016e, 322, 2, 2, 322 },
+  { 0x0016f, 324, 2, 2, 324 },
+  { 0x00170, 326, 2, 2, 326 },
+  { 0x00171, 328, 2, 2, 328 },
+  { 0x00172, 330, 2, 2, 330 },
+  { 0x00173, 332, 2, 2, 332 },
+  { 0x00174, 334, 2, 2, 334 },
+  { 0x00175, 336, 2, 2, 336 },
+  { 0x00176, 338, 2, 2, 338 },
+  { 0x00177, 340, 2, 2, 340 },
+  { 0x00178, 342, 2, 2, 342 },
+  { 0x00179, 344, 2, 2, 344 },
+  { 0x0017a, 346, 2, 2, 346 },
+  { 0x0017b, 348, 2, 2, 348 },
+  { 0x0017c, 350, 2, 2, 350 },
+  { 0x0017d, 352, 2, 2, 352 },
+  { 0x0017e, 354, 2, 2, 354 },
+  { 0x0017f, 356, 0, 1, 356 },
+  { 0x001a0, 357, 2, 2, 357 },
+  { 0x001a1, 359, 2, 2, 359 },
+  { 0x001af, 361, 2, 2, 361 },
+  { 0x001b0, 363, 2, 2, 363 },
+  { 0x001c4, 365, 0, 3, 365 },
+  { 0x001c5, 368, 0, 3, 368 },
+  { 0x001c6, 371, 0, 3, 371 },
+  { 0x001c7, 374, 0, 2, 374 },
+  { 0x001c8, 376, 0, 2, 376 },
+  { 0x001c9, 378, 0, 2, 378 },
+  { 0x001ca, 380, 0, 2, 380 },
+  { 0x001cb, 382, 0, 2, 382 },
+  { 0x001cc, 384, 0, 2, 384 },
+  { 0x001cd, 386, 2, 2, 386 },
+  { 0x001ce, 388, 2, 2, 388 },
+  { 0x001cf, 390, 2, 2, 390 },
+  { 0x001d0, 392, 2, 2, 392 },
+  { 0x001d1, 394, 2, 2, 394 },
+  { 0x001d2, 396, 2, 2, 396 },
+  { 0x001d3, 398, 2, 2, 398 },
+  { 0x001d4, 400, 2, 2, 400 },
+  { 0x001d5, 402, 3, 3, 402 },
+  { 0x001d6, 405, 3, 3, 405 },
+  { 0x001d7, 408, 3, 3, 408 },
+  { 0x001d8, 411, 3, 3, 411 },
+  { 0x001d9, 414, 3, 3, 414 },
+  { 0x001da, 417, 3, 3, 417 },
+  { 0x001db, 420, 3, 3, 420 },
+  { 0x001dc, 423, 3, 3, 423 },
+  { 0x001de, 426, 3, 3, 426 },
+  { 0x001df, 429, 3, 3, 429 },
+  { 0x001e0, 432, 3, 3, 432 },
+  { 0x001e1, 435, 3, 3, 435 },
+  { 0x001e2, 438, 2, 2, 438 },
+  { 0x001e3, 440, 2, 2, 440 },
+  { 0x001e6, 442, 2, 2, 442 },
+  { 0x001e7, 444, 2, 2, 444 },
+  { 0x001e8, 446, 2, 2, 446 },
+  { 0x001e9, 448, 2, 2, 448 },
+  { 0x001ea, 450, 2, 2, 450 },
+  { 0x001eb, 452, 2, 2, 452 },
+  { 0x001ec, 454, 3, 3, 454 },
+  { 0x001ed, 457, 3, 3, 457 },
+  { 0x001ee, 460, 2, 2, 460 },
+  { 0x001ef, 462, 2, 2, 462 },
+  { 0x001f0, 464, 2, 2, 464 },
+  { 0x001f1, 466, 0, 2, 466 },
+  { 0x001f2, 468, 0, 2, 468 },
+  { 0x001f3, 470, 0, 2, 470 },
+  { 0x001f4, 472, 2, 2, 472 },
+  { 0x001f5, 474, 2, 2, 474 },
+  { 0x001f8, 476, 2, 2, 476 },
+  { 0x001f9, 478, 2, 2, 478 },
+  { 0x001fa, 480, 3, 3, 480 },
+  { 0x001fb, 483, 3, 3, 483 },
+  { 0x001fc, 486, 2, 2, 486 },
+  { 0x001fd, 488, 2, 2, 488 },
+  { 0x001fe, 490, 2, 2, 490 },
+  { 0x001ff, 492, 2, 2, 492 },
+  { 0x00200, 494, 2, 2, 494 },
+  { 0x00201, 496, 2, 2, 496 },
+  { 0x00202, 498, 2, 2, 498 },
+  { 0x00203, 500, 2, 2, 500 },
+  { 0x00204, 502, 2, 2, 502 },
+  { 0x00205, 504, 2, 2, 504 },
+  { 0x00206, 506, 2, 2, 506 },
+  { 0x00207, 508, 2, 2, 508 },
+  { 0x00208, 510, 2, 2, 510 },
+  { 0x00209, 512, 2, 2, 512 },
+  { 0x0020a, 514, 2, 2, 514 },
+  { 0x0020b, 516, 2, 2, 516 },
+  { 0x0020c, 518, 2, 2, 518 },
+  { 0x0020d, 520, 2, 2, 520 },
+  { 0x0020e, 522, 2, 2, 522 },
+  { 0x0020f, 524, 2, 2, 524 },
+  { 0x00210, 526, 2, 2, 526 },
+  { 0x00211, 528, 2, 2, 528 },
+  { 0x00212, 530, 2, 2, 530 },
+  { 0x00213, 532, 2, 2, 532 },
+  { 0x00214, 534, 2, 2, 534 },
+  { 0x00215, 536, 2, 2, 536 },
+  { 0x00216, 538, 2, 2, 538 },
+  { 0x00217, 540, 2, 2, 540 },
+  { 0x00218, 542, 2, 2, 542 },
+  { 0x00219, 544, 2, 2, 544 },
+  { 0x0021a, 546, 2, 2, 546 },
+  { 0x0021b, 548, 2, 2, 548 },
+  { 0x0021e, 550, 2, 2, 550 },
+  { 0x0021f, 552, 2, 2, 552 },
+  { 0x00226, 554, 2, 2, 554 },
+  { 0x00227, 556, 2, 2, 556 },
+  { 0x00228, 558, 2, 2, 558 },
+  { 0x00229, 560, 2, 2, 560 },
+  { 0x0022a, 562, 3, 3, 562 },
+  { 0x0022b, 565, 3, 3, 565 },
+  { 0x0022c, 568, 3, 3, 568 },
+  { 0x0022d, 571, 3, 3, 571 },
+  { 0x0022e, 574, 2, 2, 574 },
+  { 0x0022f, 576, 2, 2, 576 },
+  { 0x00230, 578, 3, 3, 578 },
+  { 0x00231, 581, 3, 3, 581 },
+  { 0x00232, 584, 2, 2, 584 },
+  { 0x00233, 586, 2, 2, 586 },
+  { 0x002b0, 588, 0, 1, 588 },
+  { 0x002b1, 589, 0, 1, 589 },
+  { 0x002b2, 590, 0, 1, 590 },
+  { 0x002b3, 591, 0, 1, 591 },
+  { 0x002b4, 592, 0, 1, 592 },
+  { 0x002b5, 593, 0, 1, 593 },
+  { 0x002b6, 594, 0, 1, 594 },
+  { 0x002b7, 595, 0, 1, 595 },
+  { 0x002b8, 596, 0, 1, 596 },
+  { 0x002d8, 597, 0, 2, 597 },
+  { 0x002d9, 599, 0, 2, 599 },
+  { 0x002da, 601, 0, 2, 601 },
+  { 0x002db, 603, 0, 2, 603 },
+  { 0x002dc, 605, 0, 2, 605 },
+  { 0x002dd, 607, 0, 2, 607 },
+  { 0x002e0, 609, 0, 1, 609 },
+  { 0x002e1, 610, 0, 1, 610 },
+  { 0x002e2, 611, 0, 1, 611 },
+  { 0x002e3, 612, 0, 1, 612 },
+  { 0x002e4, 613, 0, 1, 613 },
+  { 0x00340, 614, 1, 1, 614 },
+  { 0x00341, 615, 1, 1, 615 },
+  { 0x00343, 616, 1, 1, 616 },
+  { 0x00344, 617, 2, 2, 617 },
+  { 0x00374, 619, 1, 1, 619 },
+  { 0x0037a, 620, 0, 2, 620 },
+  { 0x0037e, 622, 1, 1, 622 },
+  { 0x00384, 623, 0, 2, 623 },
+  { 0x00385, 625, 2, 3, 627 },
+  { 0x00386, 630, 2, 2, 630 },
+  { 0x00387, 632, 1, 1, 632 },
+  { 0x00388, 633, 2, 2, 633 },
+  { 0x00389, 635, 2, 2, 635 },
+  { 0x0038a, 637, 2, 2, 637 },
+  { 0x0038c, 639, 2, 2, 639 },
+  { 0x0038e, 641, 2, 2, 641 },
+  { 0x0038f, 643, 2, 2, 643 },
+  { 0x00390, 645, 3, 3, 645 },
+  { 0x003aa, 648, 2, 2, 648 },
+  { 0x003ab, 650, 2, 2, 650 },
+  { 0x003ac, 652, 2, 2, 652 },
+  { 0x003ad, 654, 2, 2, 654 },
+  { 0x003ae, 656, 2, 2, 656 },
+  { 0x003af, 658, 2, 2, 658 },
+  { 0x003b0, 660, 3, 3, 660 },
+  { 0x003ca, 663, 2, 2, 663 },
+  { 0x003cb, 665, 2, 2, 665 },
+  { 0x003cc, 667, 2, 2, 667 },
+  { 0x003cd, 669, 2, 2, 669 },
+  { 0x003ce, 671, 2, 2, 671 },
+  { 0x003d0, 673, 0, 1, 673 },
+  { 0x003d1, 674, 0, 1, 674 },
+  { 0x003d2, 675, 0, 1, 675 },
+  { 0x003d3, 676, 2, 2, 678 },
+  { 0x003d4, 680, 2, 2, 682 },
+  { 0x003d5, 684, 0, 1, 684 },
+  { 0x003d6, 685, 0, 1, 685 },
+  { 0x003f0, 686, 0, 1, 686 },
+  { 0x003f1, 687, 0, 1, 687 },
+  { 0x003f2, 688, 0, 1, 688 },
+  { 0x003f4, 689, 0, 1, 689 },
+  { 0x003f5, 690, 0, 1, 690 },
+  { 0x003f9, 691, 0, 1, 691 },
+  { 0x00400, 692, 2, 2, 692 },
+  { 0x00401, 694, 2, 2, 694 },
+  { 0x00403, 696, 2, 2, 696 },
+  { 0x00407, 698, 2, 2, 698 },
+  { 0x0040c, 700, 2, 2, 700 },
+  { 0x0040d, 702, 2, 2, 702 },
+  { 0x0040e, 704, 2, 2, 704 },
+  { 0x00419, 706, 2, 2, 706 },
+  { 0x00439, 708, 2, 2, 708 },
+  { 0x00450, 710, 2, 2, 710 },
+  { 0x00451, 712, 2, 2, 712 },
+  { 0x00453, 714, 2, 2, 714 },
+  { 0x00457, 716, 2, 2, 716 },
+  { 0x0045c, 718, 2, 2, 718 },
+  { 0x0045d, 720, 2, 2, 720 },
+  { 0x0045e, 722, 2, 2, 722 },
+  { 0x00476, 724, 2, 2, 724 },
+  { 0x00477, 726, 2, 2, 726 },
+  { 0x004c1, 728, 2, 2, 728 },
+  { 0x004c2, 730, 2, 2, 730 },
+  { 0x004d0, 732, 2, 2, 732 },
+  { 0x004d1, 734, 2, 2, 734 },
+  { 0x004d2, 736, 2, 2, 736 },
+  { 0x004d3, 738, 2, 2, 738 },
+  { 0x004d6, 740, 2, 2, 740 },
+  { 0x004d7, 742, 2, 2, 742 },
+  { 0x004da, 744, 2, 2, 744 },
+  { 0x004db, 746, 2, 2, 746 },
+  { 0x004dc, 748, 2, 2, 748 },
+  { 0x004dd, 750, 2, 2, 750 },
+  { 0x004de, 752, 2, 2, 752 },
+  { 0x004df, 754, 2, 2, 754 },
+  { 0x004e2, 756, 2, 2, 756 },
+  { 0x004e3, 758, 2, 2, 758 },
+  { 0x004e4, 760, 2, 2, 760 },
+  { 0x004e5, 762, 2, 2, 762 },
+  { 0x004e6, 764, 2, 2, 764 },
+  { 0x004e7, 766, 2, 2, 766 },
+  { 0x004ea, 768, 2, 2, 768 },
+  { 0x004eb, 770, 2, 2, 770 },
+  { 0x004ec, 772, 2, 2, 772 },
+  { 0x004ed, 774, 2, 2, 774 },
+  { 0x004ee, 776, 2, 2, 776 },
+  { 0x004ef, 778, 2, 2, 778 },
+  { 0x004f0, 780, 2, 2, 780 },
+  { 0x004f1, 782, 2, 2, 782 },
+  { 0x004f2, 784, 2, 2, 784 },
+  { 0x004f3, 786, 2, 2, 786 },
+  { 0x004f4, 788, 2, 2, 788 },
+  { 0x004f5, 790, 2, 2, 790 },
+  { 0x004f8, 792, 2, 2, 792 },
+  { 0x004f9, 794, 2, 2, 794 },
+  { 0x00587, 796, 0, 2, 796 },
+  { 0x00622, 798, 2, 2, 798 },
+  { 0x00623, 800, 2, 2, 800 },
+  { 0x00624, 802, 2, 2, 802 },
+  { 0x00625, 804, 2, 2, 804 },
+  { 0x00626, 806, 2, 2, 806 },
+  { 0x00675, 808, 0, 2, 808 },
+  { 0x00676, 810, 0, 2, 810 },
+  { 0x00677, 812, 0, 2, 812 },
+  { 0x00678, 814, 0, 2, 814 },
+  { 0x006c0, 816, 2, 2, 816 },
+  { 0x006c2, 818, 2, 2, 818 },
+  { 0x006d3, 820, 2, 2, 820 },
+  { 0x00929, 822, 2, 2, 822 },
+  { 0x00931, 824, 2, 2, 824 },
+  { 0x00934, 826, 2, 2, 826 },
+  { 0x00958, 828, 2, 2, 828 },
+  { 0x00959, 830, 2, 2, 830 },
+  { 0x0095a, 832, 2, 2, 832 },
+  { 0x0095b, 834, 2, 2, 834 },
+  { 0x0095c, 836, 2, 2, 836 },
+  { 0x0095d, 838, 2, 2, 838 },
+  { 0x0095e, 840, 2, 2, 840 },
+  { 0x0095f, 842, 2, 2, 842 },
+  { 0x009cb, 844, 2, 2, 844 },
+  { 0x009cc, 846, 2, 2, 846 },
+  { 0x009dc, 848, 2, 2, 848 },
+  { 0x009dd, 850, 2, 2, 850 },
+  { 0x009df, 852, 2, 2, 852 },
+  { 0x00a33, 854, 2, 2, 854 },
+  { 0x00a36, 856, 2, 2, 856 },
+  { 0x00a59, 858, 2, 2, 858 },
+  { 0x00a5a, 860, 2, 2, 860 },
+  { 0x00a5b, 862, 2, 2, 862 },
+  { 0x00a5e, 864, 2, 2, 864 },
+  { 0x00b48, 866, 2, 2, 866 },
+  { 0x00b4b, 868, 2, 2, 868 },
+  { 0x00b4c, 870, 2, 2, 870 },
+  { 0x00b5c, 872, 2, 2, 872 },
+  { 0x00b5d, 874, 2, 2, 874 },
+  { 0x00b94, 876, 2, 2, 876 },
+  { 0x00bca, 878, 2, 2, 878 },
+  { 0x00bcb, 880, 2, 2, 880 },
+  { 0x00bcc, 882, 2, 2, 882 },
+  { 0x00c48, 884, 2, 2, 884 },
+  { 0x00cc0, 886, 2, 2, 886 },
+  { 0x00cc7, 888, 2, 2, 888 },
+  { 0x00cc8, 890, 2, 2, 890 },
+  { 0x00cca, 892, 2, 2, 892 },
+  { 0x00ccb, 894, 3, 3, 894 },
+  { 0x00d4a, 897, 2, 2, 897 },
+  { 0x00d4b, 899, 2, 2, 899 },
+  { 0x00d4c, 901, 2, 2, 901 },
+  { 0x00dda, 903, 2, 2, 903 },
+  { 0x00ddc, 905, 2, 2, 905 },
+  { 0x00ddd, 907, 3, 3, 907 },
+  { 0x00dde, 910, 2, 2, 910 },
+  { 0x00e33, 912, 0, 2, 912 },
+  { 0x00eb3, 914, 0, 2, 914 },
+  { 0x00edc, 916, 0, 2, 916 },
+  { 0x00edd, 918, 0, 2, 918 },
+  { 0x00f0c, 920, 0, 1, 920 },
+  { 0x00f43, 921, 2, 2, 921 },
+  { 0x00f4d, 923, 2, 2, 923 },
+  { 0x00f52, 925, 2, 2, 925 },
+  { 0x00f57, 927, 2, 2, 927 },
+  { 0x00f5c, 929, 2, 2, 929 },
+  { 0x00f69, 931, 2, 2, 931 },
+  { 0x00f73, 933, 2, 2, 933 },
+  { 0x00f75, 935, 2, 2, 935 },
+  { 0x00f76, 937, 2, 2, 937 },
+  { 0x00f77, 939, 0, 3, 939 },
+  { 0x00f78, 942, 2, 2, 942 },
+  { 0x00f79, 944, 0, 3, 944 },
+  { 0x00f81, 947, 2, 2, 947 },
+  { 0x00f93, 949, 2, 2, 949 },
+  { 0x00f9d, 951, 2, 2, 951 },
+  { 0x00fa2, 953, 2, 2, 953 },
+  { 0x00fa7, 955, 2, 2, 955 },
+  { 0x00fac, 957, 2, 2, 957 },
+  { 0x00fb9, 959, 2, 2, 959 },
+  { 0x01026, 961, 2, 2, 961 },
+  { 0x010fc, 963, 0, 1, 963 },
+  { 0x01b06, 964, 2, 2, 964 },
+  { 0x01b08, 966, 2, 2, 966 },
+  { 0x01b0a, 968, 2, 2, 968 },
+  { 0x01b0c, 970, 2, 2, 970 },
+  { 0x01b0e, 972, 2, 2, 972 },
+  { 0x01b12, 974, 2, 2, 974 },
+  { 0x01b3b, 976, 2, 2, 976 },
+  { 0x01b3d, 978, 2, 2, 978 },
+  { 0x01b40, 980, 2, 2, 980 },
+  { 0x01b41, 982, 2, 2, 982 },
+  { 0x01b43, 984, 2, 2, 984 },
+  { 0x01d2c, 986, 0, 1, 986 },
+  { 0x01d2d, 987, 0, 1, 987 },
+  { 0x01d2e, 988, 0, 1, 988 },
+  { 0x01d30, 989, 0, 1, 989 },
+  { 0x01d31, 990, 0, 1, 990 },
+  { 0x01d32, 991, 0, 1, 991 },
+  { 0x01d33, 992, 0, 1, 992 },
+  { 0x01d34, 993, 0, 1, 993 },
+  { 0x01d35, 994, 0, 1, 994 },
+  { 0x01d36, 995, 0, 1, 995 },
+  { 0x01d37, 996, 0, 1, 996 },
+  { 0x01d38, 997, 0, 1, 997 },
+  { 0x01d39, 998, 0, 1, 998 },
+  { 0x01d3a, 999, 0, 1, 999 },
+  { 0x01d3c, 1000, 0, 1, 1000 },
+  { 0x01d3d, 1001, 0, 1, 1001 },
+  { 0x01d3e, 1002, 0, 1, 1002 },
+  { 0x01d3f, 1003, 0, 1, 1003 },
+  { 0x01d40, 1004, 0, 1, 1004 },
+  { 0x01d41, 1005, 0, 1, 1005 },
+  { 0x01d42, 1006, 0, 1, 1006 },
+  { 0x01d43, 1007, 0, 1, 1007 },
+  { 0x01d44, 1008, 0, 1, 1008 },
+  { 0x01d45, 1009, 0, 1, 1009 },
+  { 0x01d46, 1010, 0, 1, 1010 },
+  { 0x01d47, 1011, 0, 1, 1011 },
+  { 0x01d48, 1012, 0, 1, 1012 },
+  { 0x01d49, 1013, 0, 1, 1013 },
+  { 0x01d4a, 1014, 0, 1, 1014 },
+  { 0x01d4b, 1015, 0, 1, 1015 },
+  { 0x01d4c, 1016, 0, 1, 1016 },
+  { 0x01d4d, 1017, 0, 1, 1017 },
+  { 0x01d4f, 1018, 0, 1, 1018 },
+  { 0x01d50, 1019, 0, 1, 1019 },
+  { 0x01d51, 1020, 0, 1, 1020 },
+  { 0x01d52, 1021, 0, 1, 1021 },
+  { 0x01d53, 1022, 0, 1, 1022 },
+  { 0x01d54, 1023, 0, 1, 1023 },
+  { 0x01d55, 1024, 0, 1, 1024 },
+  { 0x01d56, 1025, 0, 1, 1025 },
+  { 0x01d57, 1026, 0, 1, 1026 },
+  { 0x01d58, 1027, 0, 1, 1027 },
+  { 0x01d59, 1028, 0, 1, 1028 },
+  { 0x01d5a, 1029, 0, 1, 1029 },
+  { 0x01d5b, 1030, 0, 1, 1030 },
+  { 0x01d5c, 1031, 0, 1, 1031 },
+  { 0x01d5d, 1032, 0, 1, 1032 },
+  { 0x01d5e, 1033, 0, 1, 1033 },
+  { 0x01d5f, 1034, 0, 1, 1034 },
+  { 0x01d60, 1035, 0, 1, 1035 },
+  { 0x01d61, 1036, 0, 1, 1036 },
+  { 0x01d62, 1037, 0, 1, 1037 },
+  { 0x01d63, 1038, 0, 1, 1038 },
+  { 0x01d64, 1039, 0, 1, 1039 },
+  { 0x01d65, 1040, 0, 1, 1040 },
+  { 0x01d66, 1041, 0, 1, 1041 },
+  { 0x01d67, 1042, 0, 1, 1042 },
+  { 0x01d68, 1043, 0, 1, 1043 },
+  { 0x01d69, 1044, 0, 1, 1044 },
+  { 0x01d6a, 1045, 0, 1, 1045 },
+  { 0x01d78, 1046, 0, 1, 1046 },
+  { 0x01d9b, 1047, 0, 1, 1047 },
+  { 0x01d9c, 1048, 0, 1, 1048 },
+  { 0x01d9d, 1049, 0, 1, 1049 },
+  { 0x01d9e, 1050, 0, 1, 1050 },
+  { 0x01d9f, 1051, 0, 1, 1051 },
+  { 0x01da0, 1052, 0, 1, 1052 },
+  { 0x01da1, 1053, 0, 1, 1053 },
+  { 0x01da2, 1054, 0, 1, 1054 },
+  { 0x01da3, 1055, 0, 1, 1055 },
+  { 0x01da4, 1056, 0, 1, 1056 },
+  { 0x01da5, 1057, 0, 1, 1057 },
+  { 0x01da6, 1058, 0, 1, 1058 },
+  { 0x01da7, 1059, 0, 1, 1059 },
+  { 0x01da8, 1060, 0, 1, 1060 },
+  { 0x01da9, 1061, 0, 1, 1061 },
+  { 0x01daa, 1062, 0, 1, 1062 },
+  { 0x01dab, 1063, 0, 1, 1063 },
+  { 0x01dac, 1064, 0, 1, 1064 },
+  { 0x01dad, 1065, 0, 1, 1065 },
+  { 0x01dae, 1066, 0, 1, 1066 },
+  { 0x01daf, 1067, 0, 1, 1067 },
+  { 0x01db0, 1068, 0, 1, 1068 },
+  { 0x01db1, 1069, 0, 1, 1069 },
+  { 0x01db2, 1070, 0, 1, 1070 },
+  { 0x01db3, 1071, 0, 1, 1071 },
+  { 0x01db4, 1072, 0, 1, 1072 },
+  { 0x01db5, 1073, 0, 1, 1073 },
+  { 0x01db6, 1074, 0, 1, 1074 },
+  { 0x01db7, 1075, 0, 1, 1075 },
+  { 0x01db8, 1076, 0, 1, 1076 },
+  { 0x01db9, 1077, 0, 1, 1077 },
+  { 0x01dba, 1078, 0, 1, 1078 },
+  { 0x01dbb, 1079, 0, 1, 1079 },
+  { 0x01dbc, 1080, 0, 1, 1080 },
+  { 0x01dbd, 1081, 0, 1, 1081 },
+  { 0x01dbe, 1082, 0, 1, 1082 },
+  { 0x01dbf, 1083, 0, 1, 1083 },
+  { 0x01e00, 1084, 2, 2, 1084 },
+  { 0x01e01, 1086, 2, 2, 1086 },
+  { 0x01e02, 1088, 2, 2, 1088 },
+  { 0x01e03, 1090, 2, 2, 1090 },
+  { 0x01e04, 1092, 2, 2, 1092 },
+  { 0x01e05, 1094, 2, 2, 1094 },
+  { 0x01e06, 1096, 2, 2, 1096 },
+  { 0x01e07, 1098, 2, 2, 1098 },
+  { 0x01e08, 1100, 3, 3, 1100 },
+  { 0x01e09, 1103, 3, 3, 1103 },
+  { 0x01e0a, 1106, 2, 2, 1106 },
+  { 0x01e0b, 1108, 2, 2, 1108 },
+  { 0x01e0c, 1110, 2, 2, 1110 },
+  { 0x01e0d, 1112, 2, 2, 1112 },
+  { 0x01e0e, 1114, 2, 2, 1114 },
+  { 0x01e0f, 1116, 2, 2, 1116 },
+  { 0x01e10, 1118, 2, 2, 1118 },
+  { 0x01e11, 1120, 2, 2, 1120 },
+  { 0x01e12, 1122, 2, 2, 1122 },
+  { 0x01e13, 1124, 2, 2, 1124 },
+  { 0x01e14, 1126, 3, 3, 1126 },
+  { 0x01e15, 1129, 3, 3, 1129 },
+  { 0x01e16, 1132, 3, 3, 1132 },
+  { 0x01e17, 1135, 3, 3, 1135 },
+  { 0x01e18, 1138, 2, 2, 1138 },
+  { 0x01e19, 1140, 2, 2, 1140 },
+  { 0x01e1a, 1142, 2, 2, 1142 },
+  { 0x01e1b, 1144, 2, 2, 1144 },
+  { 0x01e1c, 1146, 3, 3, 1146 },
+  { 0x01e1d, 1149, 3, 3, 1149 },
+  { 0x01e1e, 1152, 2, 2, 1152 },
+  { 0x01e1f, 1154, 2, 2, 1154 },
+  { 0x01e20, 1156, 2, 2, 1156 },
+  { 0x01e21, 1158, 2, 2, 1158 },
+  { 0x01e22, 1160, 2, 2, 1160 },
+  { 0x01e23, 1162, 2, 2, 1162 },
+  { 0x01e24, 1164, 2, 2, 1164 },
+  { 0x01e25, 1166, 2, 2, 1166 },
+  { 0x01e26, 1168, 2, 2, 1168 },
+  { 0x01e27, 1170, 2, 2, 1170 },
+  { 0x01e28, 1172, 2, 2, 1172 },
+  { 0x01e29, 1174, 2, 2, 1174 },
+  { 0x01e2a, 1176, 2, 2, 1176 },
+  { 0x01e2b, 1178, 2, 2, 1178 },
+  { 0x01e2c, 1180, 2, 2, 1180 },
+  { 0x01e2d, 1182, 2, 2, 1182 },
+  { 0x01e2e, 1184, 3, 3, 1184 },
+  { 0x01e2f, 1187, 3, 3, 1187 },
+  { 0x01e30, 1190, 2, 2, 1190 },
+  { 0x01e31, 1192, 2, 2, 1192 },
+  { 0x01e32, 1194, 2, 2, 1194 },
+  { 0x01e33, 1196, 2, 2, 1196 },
+  { 0x01e34, 1198, 2, 2, 1198 },
+  { 0x01e35, 1200, 2, 2, 1200 },
+  { 0x01e36, 1202, 2, 2, 1202 },
+  { 0x01e37, 1204, 2, 2, 1204 },
+  { 0x01e38, 1206, 3, 3, 1206 },
+  { 0x01e39, 1209, 3, 3, 1209 },
+  { 0x01e3a, 1212, 2, 2, 1212 },
+  { 0x01e3b, 1214, 2, 2, 1214 },
+  { 0x01e3c, 1216, 2, 2, 1216 },
+  { 0x01e3d, 1218, 2, 2, 1218 },
+  { 0x01e3e, 1220, 2, 2, 1220 },
+  { 0x01e3f, 1222, 2, 2, 1222 },
+  { 0x01e40, 1224, 2, 2, 1224 },
+  { 0x01e41, 1226, 2, 2, 1226 },
+  { 0x01e42, 1228, 2, 2, 1228 },
+  { 0x01e43, 1230, 2, 2, 1230 },
+  { 0x01e44, 1232, 2, 2, 1232 },
+  { 0x01e45, 1234, 2, 2, 1234 },
+  { 0x01e46, 1236, 2, 2, 1236 },
+  { 0x01e47, 1238, 2, 2, 1238 },
+  { 0x01e48, 1240, 2, 2, 1240 },
+  { 0x01e49, 1242, 2, 2, 1242 },
+  { 0x01e4a, 1244, 2, 2, 1244 },
+  { 0x01e4b, 1246, 2, 2, 1246 },
+  { 0x01e4c, 1248, 3, 3, 1248 },
+  { 0x01e4d, 1251, 3, 3, 1251 },
+  { 0x01e4e, 1254, 3, 3, 1254 },
+  { 0x01e4f, 1257, 3, 3, 1257 },
+  { 0x01e50, 1260, 3, 3, 1260 },
+  { 0x01e51, 1263, 3, 3, 1263 },
+  { 0x01e52, 1266, 3, 3, 1266 },
+  { 0x01e53, 1269, 3, 3, 1269 },
+  { 0x01e54, 1272, 2, 2, 1272 },
+  { 0x01e55, 1274, 2, 2, 1274 },
+  { 0x01e56, 1276, 2, 2, 1276 },
+  { 0x01e57, 1278, 2, 2, 1278 },
+  { 0x01e58, 1280, 2, 2, 1280 },
+  { 0x01e59, 1282, 2, 2, 1282 },
+  { 0x01e5a, 1284, 2, 2, 1284 },
+  { 0x01e5b, 1286, 2, 2, 1286 },
+  { 0x01e5c, 1288, 3, 3, 1288 },
+  { 0x01e5d, 1291, 3, 3, 1291 },
+  { 0x01e5e, 1294, 2, 2, 1294 },
+  { 0x01e5f, 1296, 2, 2, 1296 },
+  { 0x01e60, 1298, 2, 2, 1298 },
+  { 0x01e61, 1300, 2, 2, 1300 },
+  { 0x01e62, 1302, 2, 2, 1302 },
+  { 0x01e63, 1304, 2, 2, 1304 },
+  { 0x01e64, 1306, 3, 3, 1306 },
+  { 0x01e65, 1309, 3, 3, 1309 },
+  { 0x01e66, 1312, 3, 3, 1312 },
+  { 0x01e67, 1315, 3, 3, 1315 },
+  { 0x01e68, 1318, 3, 3, 1318 },
+  { 0x01e69, 1321, 3, 3, 1321 },
+  { 0x01e6a, 1324, 2, 2, 1324 },
+  { 0x01e6b, 1326, 2, 2, 1326 },
+  { 0x01e6c, 1328, 2, 2, 1328 },
+  { 0x01e6d, 1330, 2, 2, 1330 },
+  { 0x01e6e, 1332, 2, 2, 1332 },
+  { 0x01e6f, 1334, 2, 2, 1334 },
+  { 0x01e70, 1336, 2, 2, 1336 },
+  { 0x01e71, 1338, 2, 2, 1338 },
+  { 0x01e72, 1340, 2, 2, 1340 },
+  { 0x01e73, 1342, 2, 2, 1342 },
+  { 0x01e74, 1344, 2, 2, 1344 },
+  { 0x01e75, 1346, 2, 2, 1346 },
+  { 0x01e76, 1348, 2, 2, 1348 },
+  { 0x01e77, 1350, 2, 2, 1350 },
+  { 0x01e78, 1352, 3, 3, 1352 },
+  { 0x01e79, 1355, 3, 3, 1355 },
+  { 0x01e7a, 1358, 3, 3, 1358 },
+  { 0x01e7b, 1361, 3, 3, 1361 },
+  { 0x01e7c, 1364, 2, 2, 1364 },
+  { 0x01e7d, 1366, 2, 2, 1366 },
+  { 0x01e7e, 1368, 2, 2, 1368 },
+  { 0x01e7f, 1370, 2, 2, 1370 },
+  { 0x01e80, 1372, 2, 2, 1372 },
+  { 0x01e81, 1374, 2, 2, 1374 },
+  { 0x01e82, 1376, 2, 2, 1376 },
+  { 0x01e83, 1378, 2, 2, 1378 },
+  { 0x01e84, 1380, 2, 2, 1380 },
+  { 0x01e85, 1382, 2, 2, 1382 },
+  { 0x01e86, 1384, 2, 2, 1384 },
+  { 0x01e87, 1386, 2, 2, 1386 },
+  { 0x01e88, 1388, 2, 2, 1388 },
+  { 0x01e89, 1390, 2, 2, 1390 },
+  { 0x01e8a, 1392, 2, 2, 1392 },
+  { 0x01e8b, 1394, 2, 2, 1394 },
+  { 0x01e8c, 1396, 2, 2, 1396 },
+  { 0x01e8d, 1398, 2, 2, 1398 },
+  { 0x01e8e, 1400, 2, 2, 1400 },
+  { 0x01e8f, 1402, 2, 2, 1402 },
+  { 0x01e90, 1404, 2, 2, 1404 },
+  { 0x01e91, 1406, 2, 2, 1406 },
+  { 0x01e92, 1408, 2, 2, 1408 },
+  { 0x01e93, 1410, 2, 2, 1410 },
+  { 0x01e94, 1412, 2, 2, 1412 },
+  { 0x01e95, 1414, 2, 2, 1414 },
+  { 0x01e96, 1416, 2, 2, 1416 },
+  { 0x01e97, 1418, 2, 2, 1418 },
+  { 0x01e98, 1420, 2, 2, 1420 },
+  { 0x01e99, 1422, 2, 2, 1422 },
+  { 0x01e9a, 1424, 0, 2, 1424 },
+  { 0x01e9b, 1426, 2, 2, 1428 },
+  { 0x01ea0, 1430, 2, 2, 1430 },
+  { 0x01ea1, 1432, 2, 2, 1432 },
+  { 0x01ea2, 1434, 2, 2, 1434 },
+  { 0x01ea3, 1436, 2, 2, 1436 },
+  { 0x01ea4, 1438, 3, 3, 1438 },
+  { 0x01ea5, 1441, 3, 3, 1441 },
+  { 0x01ea6, 1444, 3, 3, 1444 },
+  { 0x01ea7, 1447, 3, 3, 1447 },
+  { 0x01ea8, 1450, 3, 3, 1450 },
+  { 0x01ea9, 1453, 3, 3, 1453 },
+  { 0x01eaa, 1456, 3, 3, 1456 },
+  { 0x01eab, 1459, 3, 3, 1459 },
+  { 0x01eac, 1462, 3, 3, 1462 },
+  { 0x01ead, 1465, 3, 3, 1465 },
+  { 0x01eae, 1468, 3, 3, 1468 },
+  { 0x01eaf, 1471, 3, 3, 1471 },
+  { 0x01eb0, 1474, 3, 3, 1474 },
+  { 0x01eb1, 1477, 3, 3, 1477 },
+  { 0x01eb2, 1480, 3, 3, 1480 },
+  { 0x01eb3, 1483, 3, 3, 1483 },
+  { 0x01eb4, 1486, 3, 3, 1486 },
+  { 0x01eb5, 1489, 3, 3, 1489 },
+  { 0x01eb6, 1492, 3, 3, 1492 },
+  { 0x01eb7, 1495, 3, 3, 1495 },
+  { 0x01eb8, 1498, 2, 2, 1498 },
+  { 0x01eb9, 1500, 2, 2, 1500 },
+  { 0x01eba, 1502, 2, 2, 1502 },
+  { 0x01ebb, 1504, 2, 2, 1504 },
+  { 0x01ebc, 1506, 2, 2, 1506 },
+  { 0x01ebd, 1508, 2, 2, 1508 },
+  { 0x01ebe, 1510, 3, 3, 1510 },
+  { 0x01ebf, 1513, 3, 3, 1513 },
+  { 0x01ec0, 1516, 3, 3, 1516 },
+  { 0x01ec1, 1519, 3, 3, 1519 },
+  { 0x01ec2, 1522, 3, 3, 1522 },
+  { 0x01ec3, 1525, 3, 3, 1525 },
+  { 0x01ec4, 1528, 3, 3, 1528 },
+  { 0x01ec5, 1531, 3, 3, 1531 },
+  { 0x01ec6, 1534, 3, 3, 1534 },
+  { 0x01ec7, 1537, 3, 3, 1537 },
+  { 0x01ec8, 1540, 2, 2, 1540 },
+  { 0x01ec9, 1542, 2, 2, 1542 },
+  { 0x01eca, 1544, 2, 2, 1544 },
+  { 0x01ecb, 1546, 2, 2, 1546 },
+  { 0x01ecc, 1548, 2, 2, 1548 },
+  { 0x01ecd, 1550, 2, 2, 1550 },
+  { 0x01ece, 1552, 2, 2, 1552 },
+  { 0x01ecf, 1554, 2, 2, 1554 },
+  { 0x01ed0, 1556, 3, 3, 1556 },
+  { 0x01ed1, 1559, 3, 3, 1559 },
+  { 0x01ed2, 1562, 3, 3, 1562 },
+  { 0x01ed3, 1565, 3, 3, 1565 },
+  { 0x01ed4, 1568, 3, 3, 1568 },
+  { 0x01ed5, 1571, 3, 3, 1571 },
+  { 0x01ed6, 1574, 3, 3, 1574 },
+  { 0x01ed7, 1577, 3, 3, 1577 },
+  { 0x01ed8, 1580, 3, 3, 1580 },
+  { 0x01ed9, 1583, 3, 3, 1583 },
+  { 0x01eda, 1586, 3, 3, 1586 },
+  { 0x01edb, 1589, 3, 3, 1589 },
+  { 0x01edc, 1592, 3, 3, 1592 },
+  { 0x01edd, 1595, 3, 3, 1595 },
+  { 0x01ede, 1598, 3, 3, 1598 },
+  { 0x01edf, 1601, 3, 3, 1601 },
+  { 0x01ee0, 1604, 3, 3, 1604 },
+  { 0x01ee1, 1607, 3, 3, 1607 },
+  { 0x01ee2, 1610, 3, 3, 1610 },
+  { 0x01ee3, 1613, 3, 3, 1613 },
+  { 0x01ee4, 1616, 2, 2, 1616 },
+  { 0x01ee5, 1618, 2, 2, 1618 },
+  { 0x01ee6, 1620, 2, 2, 1620 },
+  { 0x01ee7, 1622, 2, 2, 1622 },
+  { 0x01ee8, 1624, 3, 3, 1624 },
+  { 0x01ee9, 1627, 3, 3, 1627 },
+  { 0x01eea, 1630, 3, 3, 1630 },
+  { 0x01eeb, 1633, 3, 3, 1633 },
+  { 0x01eec, 1636, 3, 3, 1636 },
+  { 0x01eed, 1639, 3, 3, 1639 },
+  { 0x01eee, 1642, 3, 3, 1642 },
+  { 0x01eef, 1645, 3, 3, 1645 },
+  { 0x01ef0, 1648, 3, 3, 1648 },
+  { 0x01ef1, 1651, 3, 3, 1651 },
+  { 0x01ef2, 1654, 2, 2, 1654 },
+  { 0x01ef3, 1656, 2, 2, 1656 },
+  { 0x01ef4, 1658, 2, 2, 1658 },
+  { 0x01ef5, 1660, 2, 2, 1660 },
+  { 0x01ef6, 1662, 2, 2, 1662 },
+  { 0x01ef7, 1664, 2, 2, 1664 },
+  { 0x01ef8, 1666, 2, 2, 1666 },
+  { 0x01ef9, 1668, 2, 2, 1668 },
+  { 0x01f00, 1670, 2, 2, 1670 },
+  { 0x01f01, 1672, 2, 2, 1672 },
+  { 0x01f02, 1674, 3, 3, 1674 },
+  { 0x01f03, 1677, 3, 3, 1677 },
+  { 0x01f04, 1680, 3, 3, 1680 },
+  { 0x01f05, 1683, 3, 3, 1683 },
+  { 0x01f06, 1686, 3, 3, 1686 },
+  { 0x01f07, 1689, 3, 3, 1689 },
+  { 0x01f08, 1692, 2, 2, 1692 },
+  { 0x01f09, 1694, 2, 2, 1694 },
+  { 0x01f0a, 1696, 3, 3, 1696 },
+  { 0x01f0b, 1699, 3, 3, 1699 },
+  { 0x01f0c, 1702, 3, 3, 1702 },
+  { 0x01f0d, 1705, 3, 3, 1705 },
+  { 0x01f0e, 1708, 3, 3, 1708 },
+  { 0x01f0f, 1711, 3, 3, 1711 },
+  { 0x01f10, 1714, 2, 2, 1714 },
+  { 0x01f11, 1716, 2, 2, 1716 },
+  { 0x01f12, 1718, 3, 3, 1718 },
+  { 0x01f13, 1721, 3, 3, 1721 },
+  { 0x01f14, 1724, 3, 3, 1724 },
+  { 0x01f15, 1727, 3, 3, 1727 },
+  { 0x01f18, 1730, 2, 2, 1730 },
+  { 0x01f19, 1732, 2, 2, 1732 },
+  { 0x01f1a, 1734, 3, 3, 1734 },
+  { 0x01f1b, 1737, 3, 3, 1737 },
+  { 0x01f1c, 1740, 3, 3, 1740 },
+  { 0x01f1d, 1743, 3, 3, 1743 },
+  { 0x01f20, 1746, 2, 2, 1746 },
+  { 0x01f21, 1748, 2, 2, 1748 },
+  { 0x01f22, 1750, 3, 3, 1750 },
+  { 0x01f23, 1753, 3, 3, 1753 },
+  { 0x01f24, 1756, 3, 3, 1756 },
+  { 0x01f25, 1759, 3, 3, 1759 },
+  { 0x01f26, 1762, 3, 3, 1762 },
+  { 0x01f27, 1765, 3, 3, 1765 },
+  { 0x01f28, 1768, 2, 2, 1768 },
+  { 0x01f29, 1770, 2, 2, 1770 },
+  { 0x01f2a, 1772, 3, 3, 1772 },
+  { 0x01f2b, 1775, 3, 3, 1775 },
+  { 0x01f2c, 1778, 3, 3, 1778 },
+  { 0x01f2d, 1781, 3, 3, 1781 },
+  { 0x01f2e, 1784, 3, 3, 1784 },
+  { 0x01f2f, 1787, 3, 3, 1787 },
+  { 0x01f30, 1790, 2, 2, 1790 },
+  { 0x01f31, 1792, 2, 2, 1792 },
+  { 0x01f32, 1794, 3, 3, 1794 },
+  { 0x01f33, 1797, 3, 3, 1797 },
+  { 0x01f34, 1800, 3, 3, 1800 },
+  { 0x01f35, 1803, 3, 3, 1803 },
+  { 0x01f36, 1806, 3, 3, 1806 },
+  { 0x01f37, 1809, 3, 3, 1809 },
+  { 0x01f38, 1812, 2, 2, 1812 },
+  { 0x01f39, 1814, 2, 2, 1814 },
+  { 0x01f3a, 1816, 3, 3, 1816 },
+  { 0x01f3b, 1819, 3, 3, 1819 },
+  { 0x01f3c, 1822, 3, 3, 1822 },
+  { 0x01f3d, 1825, 3, 3, 1825 },
+  { 0x01f3e, 1828, 3, 3, 1828 },
+  { 0x01f3f, 1831, 3, 3, 1831 },
+  { 0x01f40, 1834, 2, 2, 1834 },
+  { 0x01f41, 1836, 2, 2, 1836 },
+  { 0x01f42, 1838, 3, 3, 1838 },
+  { 0x01f43, 1841, 3, 3, 1841 },
+  { 0x01f44, 1844, 3, 3, 1844 },
+  { 0x01f45, 1847, 3, 3, 1847 },
+  { 0x01f48, 1850, 2, 2, 1850 },
+  { 0x01f49, 1852, 2, 2, 1852 },
+  { 0x01f4a, 1854, 3, 3, 1854 },
+  { 0x01f4b, 1857, 3, 3, 1857 },
+  { 0x01f4c, 1860, 3, 3, 1860 },
+  { 0x01f4d, 1863, 3, 3, 1863 },
+  { 0x01f50, 1866, 2, 2, 1866 },
+  { 0x01f51, 1868, 2, 2, 1868 },
+  { 0x01f52, 1870, 3, 3, 1870 },
+  { 0x01f53, 1873, 3, 3, 1873 },
+  { 0x01f54, 1876, 3, 3, 1876 },
+  { 0x01f55, 1879, 3, 3, 1879 },
+  { 0x01f56, 1882, 3, 3, 1882 },
+  { 0x01f57, 1885, 3, 3, 1885 },
+  { 0x01f59, 1888, 2, 2, 1888 },
+  { 0x01f5b, 1890, 3, 3, 1890 },
+  { 0x01f5d, 1893, 3, 3, 1893 },
+  { 0x01f5f, 1896, 3, 3, 1896 },
+  { 0x01f60, 1899, 2, 2, 1899 },
+  { 0x01f61, 1901, 2, 2, 1901 },
+  { 0x01f62, 1903, 3, 3, 1903 },
+  { 0x01f63, 1906, 3, 3, 1906 },
+  { 0x01f64, 1909, 3, 3, 1909 },
+  { 0x01f65, 1912, 3, 3, 1912 },
+  { 0x01f66, 1915, 3, 3, 1915 },
+  { 0x01f67, 1918, 3, 3, 1918 },
+  { 0x01f68, 1921, 2, 2, 1921 },
+  { 0x01f69, 1923, 2, 2, 1923 },
+  { 0x01f6a, 1925, 3, 3, 1925 },
+  { 0x01f6b, 1928, 3, 3, 1928 },
+  { 0x01f6c, 1931, 3, 3, 1931 },
+  { 0x01f6d, 1934, 3, 3, 1934 },
+  { 0x01f6e, 1937, 3, 3, 1937 },
+  { 0x01f6f, 1940, 3, 3, 1940 },
+  { 0x01f70, 1943, 2, 2, 1943 },
+  { 0x01f71, 1945, 2, 2, 1945 },
+  { 0x01f72, 1947, 2, 2, 1947 },
+  { 0x01f73, 1949, 2, 2, 1949 },
+  { 0x01f74, 1951, 2, 2, 1951 },
+  { 0x01f75, 1953, 2, 2, 1953 },
+  { 0x01f76, 1955, 2, 2, 1955 },
+  { 0x01f77, 1957, 2, 2, 1957 },
+  { 0x01f78, 1959, 2, 2, 1959 },
+  { 0x01f79, 1961, 2, 2, 1961 },
+  { 0x01f7a, 1963, 2, 2, 1963 },
+  { 0x01f7b, 1965, 2, 2, 1965 },
+  { 0x01f7c, 1967, 2, 2, 1967 },
+  { 0x01f7d, 1969, 2, 2, 1969 },
+  { 0x01f80, 1971, 3, 3, 1971 },
+  { 0x01f81, 1974, 3, 3, 1974 },
+  { 0x01f82, 1977, 4, 4, 1977 },
+  { 0x01f83, 1981, 4, 4, 1981 },
+  { 0x01f84, 1985, 4, 4, 1985 },
+  { 0x01f85, 1989, 4, 4, 1989 },
+  { 0x01f86, 1993, 4, 4, 1993 },
+  { 0x01f87, 1997, 4, 4, 1997 },
+  { 0x01f88, 2001, 3, 3, 2001 },
+  { 0x01f89, 2004, 3, 3, 2004 },
+  { 0x01f8a, 2007, 4, 4, 2007 },
+  { 0x01f8b, 2011, 4, 4, 2011 },
+  { 0x01f8c, 2015, 4, 4, 2015 },
+  { 0x01f8d, 2019, 4, 4, 2019 },
+  { 0x01f8e, 2023, 4, 4, 2023 },
+  { 0x01f8f, 2027, 4, 4, 2027 },
+  { 0x01f90, 2031, 3, 3, 2031 },
+  { 0x01f91, 2034, 3, 3, 2034 },
+  { 0x01f92, 2037, 4, 4, 2037 },
+  { 0x01f93, 2041, 4, 4, 2041 },
+  { 0x01f94, 2045, 4, 4, 2045 },
+  { 0x01f95, 2049, 4, 4, 2049 },
+  { 0x01f96, 2053, 4, 4, 2053 },
+  { 0x01f97, 2057, 4, 4, 2057 },
+  { 0x01f98, 2061, 3, 3, 2061 },
+  { 0x01f99, 2064, 3, 3, 2064 },
+  { 0x01f9a, 2067, 4, 4, 2067 },
+  { 0x01f9b, 2071, 4, 4, 2071 },
+  { 0x01f9c, 2075, 4, 4, 2075 },
+  { 0x01f9d, 2079, 4, 4, 2079 },
+  { 0x01f9e, 2083, 4, 4, 2083 },
+  { 0x01f9f, 2087, 4, 4, 2087 },
+  { 0x01fa0, 2091, 3, 3, 2091 },
+  { 0x01fa1, 2094, 3, 3, 2094 },
+  { 0x01fa2, 2097, 4, 4, 2097 },
+  { 0x01fa3, 2101, 4, 4, 2101 },
+  { 0x01fa4, 2105, 4, 4, 2105 },
+  { 0x01fa5, 2109, 4, 4, 2109 },
+  { 0x01fa6, 2113, 4, 4, 2113 },
+  { 0x01fa7, 2117, 4, 4, 2117 },
+  { 0x01fa8, 2121, 3, 3, 2121 },
+  { 0x01fa9, 2124, 3, 3, 2124 },
+  { 0x01faa, 2127, 4, 4, 2127 },
+  { 0x01fab, 2131, 4, 4, 2131 },
+  { 0x01fac, 2135, 4, 4, 2135 },
+  { 0x01fad, 2139, 4, 4, 2139 },
+  { 0x01fae, 2143, 4, 4, 2143 },
+  { 0x01faf, 2147, 4, 4, 2147 },
+  { 0x01fb0, 2151, 2, 2, 2151 },
+  { 0x01fb1, 2153, 2, 2, 2153 },
+  { 0x01fb2, 2155, 3, 3, 2155 },
+  { 0x01fb3, 2158, 2, 2, 2158 },
+  { 0x01fb4, 2160, 3, 3, 2160 },
+  { 0x01fb6, 2163, 2, 2, 2163 },
+  { 0x01fb7, 2165, 3, 3, 2165 },
+  { 0x01fb8, 2168, 2, 2, 2168 },
+  { 0x01fb9, 2170, 2, 2, 2170 },
+  { 0x01fba, 2172, 2, 2, 2172 },
+  { 0x01fbb, 2174, 2, 2, 2174 },
+  { 0x01fbc, 2176, 2, 2, 2176 },
+  { 0x01fbd, 2178, 0, 2, 2178 },
+  { 0x01fbe, 2180, 1, 1, 2180 },
+  { 0x01fbf, 2181, 0, 2, 2181 },
+  { 0x01fc0, 2183, 0, 2, 2183 },
+  { 0x01fc1, 2185, 2, 3, 2187 },
+  { 0x01fc2, 2190, 3, 3, 2190 },
+  { 0x01fc3, 2193, 2, 2, 2193 },
+  { 0x01fc4, 2195, 3, 3, 2195 },
+  { 0x01fc6, 2198, 2, 2, 2198 },
+  { 0x01fc7, 2200, 3, 3, 2200 },
+  { 0x01fc8, 2203, 2, 2, 2203 },
+  { 0x01fc9, 2205, 2, 2, 2205 },
+  { 0x01fca, 2207, 2, 2, 2207 },
+  { 0x01fcb, 2209, 2, 2, 2209 },
+  { 0x01fcc, 2211, 2, 2, 2211 },
+  { 0x01fcd, 2213, 2, 3, 2215 },
+  { 0x01fce, 2218, 2, 3, 2220 },
+  { 0x01fcf, 2223, 2, 3, 2225 },
+  { 0x01fd0, 2228, 2, 2, 2228 },
+  { 0x01fd1, 2230, 2, 2, 2230 },
+  { 0x01fd2, 2232, 3, 3, 2232 },
+  { 0x01fd3, 2235, 3, 3, 2235 },
+  { 0x01fd6, 2238, 2, 2, 2238 },
+  { 0x01fd7, 2240, 3, 3, 2240 },
+  { 0x01fd8, 2243, 2, 2, 2243 },
+  { 0x01fd9, 2245, 2, 2, 2245 },
+  { 0x01fda, 2247, 2, 2, 2247 },
+  { 0x01fdb, 2249, 2, 2, 2249 },
+  { 0x01fdd, 2251, 2, 3, 2253 },
+  { 0x01fde, 2256, 2, 3, 2258 },
+  { 0x01fdf, 2261, 2, 3, 2263 },
+  { 0x01fe0, 2266, 2, 2, 2266 },
+  { 0x01fe1, 2268, 2, 2, 2268 },
+  { 0x01fe2, 2270, 3, 3, 2270 },
+  { 0x01fe3, 2273, 3, 3, 2273 },
+  { 0x01fe4, 2276, 2, 2, 2276 },
+  { 0x01fe5, 2278, 2, 2, 2278 },
+  { 0x01fe6, 2280, 2, 2, 2280 },
+  { 0x01fe7, 2282, 3, 3, 2282 },
+  { 0x01fe8, 2285, 2, 2, 2285 },
+  { 0x01fe9, 2287, 2, 2, 2287 },
+  { 0x01fea, 2289, 2, 2, 2289 },
+  { 0x01feb, 2291, 2, 2, 2291 },
+  { 0x01fec, 2293, 2, 2, 2293 },
+  { 0x01fed, 2295, 2, 3, 2297 },
+  { 0x01fee, 2300, 2, 3, 2302 },
+  { 0x01fef, 2305, 1, 1, 2305 },
+  { 0x01ff2, 2306, 3, 3, 2306 },
+  { 0x01ff3, 2309, 2, 2, 2309 },
+  { 0x01ff4, 2311, 3, 3, 2311 },
+  { 0x01ff6, 2314, 2, 2, 2314 },
+  { 0x01ff7, 2316, 3, 3, 2316 },
+  { 0x01ff8, 2319, 2, 2, 2319 },
+  { 0x01ff9, 2321, 2, 2, 2321 },
+  { 0x01ffa, 2323, 2, 2, 2323 },
+  { 0x01ffb, 2325, 2, 2, 2325 },
+  { 0x01ffc, 2327, 2, 2, 2327 },
+  { 0x01ffd, 2329, 1, 2, 2330 },
+  { 0x01ffe, 2332, 0, 2, 2332 },
+  { 0x02000, 2334, 1, 1, 2335 },
+  { 0x02001, 2336, 1, 1, 2337 },
+  { 0x02002, 2338, 0, 1, 2338 },
+  { 0x02003, 2339, 0, 1, 2339 },
+  { 0x02004, 2340, 0, 1, 2340 },
+  { 0x02005, 2341, 0, 1, 2341 },
+  { 0x02006, 2342, 0, 1, 2342 },
+  { 0x02007, 2343, 0, 1, 2343 },
+  { 0x02008, 2344, 0, 1, 2344 },
+  { 0x02009, 2345, 0, 1, 2345 },
+  { 0x0200a, 2346, 0, 1, 2346 },
+  { 0x02011, 2347, 0, 1, 2347 },
+  { 0x02017, 2348, 0, 2, 2348 },
+  { 0x02024, 2350, 0, 1, 2350 },
+  { 0x02025, 2351, 0, 2, 2351 },
+  { 0x02026, 2353, 0, 3, 2353 },
+  { 0x0202f, 2356, 0, 1, 2356 },
+  { 0x02033, 2357, 0, 2, 2357 },
+  { 0x02034, 2359, 0, 3, 2359 },
+  { 0x02036, 2362, 0, 2, 2362 },
+  { 0x02037, 2364, 0, 3, 2364 },
+  { 0x0203c, 2367, 0, 2, 2367 },
+  { 0x0203e, 2369, 0, 2, 2369 },
+  { 0x02047, 2371, 0, 2, 2371 },
+  { 0x02048, 2373, 0, 2, 2373 },
+  { 0x02049, 2375, 0, 2, 2375 },
+  { 0x02057, 2377, 0, 4, 2377 },
+  { 0x0205f, 2381, 0, 1, 2381 },
+  { 0x02070, 2382, 0, 1, 2382 },
+  { 0x02071, 2383, 0, 1, 2383 },
+  { 0x02074, 2384, 0, 1, 2384 },
+  { 0x02075, 2385, 0, 1, 2385 },
+  { 0x02076, 2386, 0, 1, 2386 },
+  { 0x02077, 2387, 0, 1, 2387 },
+  { 0x02078, 2388, 0, 1, 2388 },
+  { 0x02079, 2389, 0, 1, 2389 },
+  { 0x0207a, 2390, 0, 1, 2390 },
+  { 0x0207b, 2391, 0, 1, 2391 },
+  { 0x0207c, 2392, 0, 1, 2392 },
+  { 0x0207d, 2393, 0, 1, 2393 },
+  { 0x0207e, 2394, 0, 1, 2394 },
+  { 0x0207f, 2395, 0, 1, 2395 },
+  { 0x02080, 2396, 0, 1, 2396 },
+  { 0x02081, 2397, 0, 1, 2397 },
+  { 0x02082, 2398, 0, 1, 2398 },
+  { 0x02083, 2399, 0, 1, 2399 },
+  { 0x02084, 2400, 0, 1, 2400 },
+  { 0x02085, 2401, 0, 1, 2401 },
+  { 0x02086, 2402, 0, 1, 2402 },
+  { 0x02087, 2403, 0, 1, 2403 },
+  { 0x02088, 2404, 0, 1, 2404 },
+  { 0x02089, 2405, 0, 1, 2405 },
+  { 0x0208a, 2406, 0, 1, 2406 },
+  { 0x0208b, 2407, 0, 1, 2407 },
+  { 0x0208c, 2408, 0, 1, 2408 },
+  { 0x0208d, 2409, 0, 1, 2409 },
+  { 0x0208e, 2410, 0, 1, 2410 },
+  { 0x02090, 2411, 0, 1, 2411 },
+  { 0x02091, 2412, 0, 1, 2412 },
+  { 0x02092, 2413, 0, 1, 2413 },
+  { 0x02093, 2414, 0, 1, 2414 },
+  { 0x02094, 2415, 0, 1, 2415 },
+  { 0x02095, 2416, 0, 1, 2416 },
+  { 0x02096, 2417, 0, 1, 2417 },
+  { 0x02097, 2418, 0, 1, 2418 },
+  { 0x02098, 2419, 0, 1, 2419 },
+  { 0x02099, 2420, 0, 1, 2420 },
+  { 0x0209a, 2421, 0, 1, 2421 },
+  { 0x0209b, 2422, 0, 1, 2422 },
+  { 0x0209c, 2423, 0, 1, 2423 },
+  { 0x020a8, 2424, 0, 2, 2424 },
+  { 0x02100, 2426, 0, 3, 2426 },
+  { 0x02101, 2429, 0, 3, 2429 },
+  { 0x02102, 2432, 0, 1, 2432 },
+  { 0x02103, 2433, 0, 2, 2433 },
+  { 0x02105, 2435, 0, 3, 2435 },
+  { 0x02106, 2438, 0, 3, 2438 },
+  { 0x02107, 2441, 0, 1, 2441 },
+  { 0x02109, 2442, 0, 2, 2442 },
+  { 0x0210a, 2444, 0, 1, 2444 },
+  { 0x0210b, 2445, 0, 1, 2445 },
+  { 0x0210c, 2446, 0, 1, 2446 },
+  { 0x0210d, 2447, 0, 1, 2447 },
+  { 0x0210e, 2448, 0, 1, 2448 },
+  { 0x0210f, 2449, 0, 1, 2449 },
+  { 0x02110, 2450, 0, 1, 2450 },
+  { 0x02111, 2451, 0, 1, 2451 },
+  { 0x02112, 2452, 0, 1, 2452 },
+  { 0x02113, 2453, 0, 1, 2453 },
+  { 0x02115, 2454, 0, 1, 2454 },
+  { 0x02116, 2455, 0, 2, 2455 },
+  { 0x02119, 2457, 0, 1, 2457 },
+  { 0x0211a, 2458, 0, 1, 2458 },
+  { 0x0211b, 2459, 0, 1, 2459 },
+  { 0x0211c, 2460, 0, 1, 2460 },
+  { 0x0211d, 2461, 0, 1, 2461 },
+  { 0x02120, 2462, 0, 2, 2462 },
+  { 0x02121, 2464, 0, 3, 2464 },
+  { 0x02122, 2467, 0, 2, 2467 },
+  { 0x02124, 2469, 0, 1, 2469 },
+  { 0x02126, 2470, 1, 1, 2470 },
+  { 0x02128, 2471, 0, 1, 2471 },
+  { 0x0212a, 2472, 1, 1, 2472 },
+  { 0x0212b, 2473, 2, 2, 2473 },
+  { 0x0212c, 2475, 0, 1, 2475 },
+  { 0x0212d, 2476, 0, 1, 2476 },
+  { 0x0212f, 2477, 0, 1, 2477 },
+  { 0x02130, 2478, 0, 1, 2478 },
+  { 0x02131, 2479, 0, 1, 2479 },
+  { 0x02133, 2480, 0, 1, 2480 },
+  { 0x02134, 2481, 0, 1, 2481 },
+  { 0x02135, 2482, 0, 1, 2482 },
+  { 0x02136, 2483, 0, 1, 2483 },
+  { 0x02137, 2484, 0, 1, 2484 },
+  { 0x02138, 2485, 0, 1, 2485 },
+  { 0x02139, 2486, 0, 1, 2486 },
+  { 0x0213b, 2487, 0, 3, 2487 },
+  { 0x0213c, 2490, 0, 1, 2490 },
+  { 0x0213d, 2491, 0, 1, 2491 },
+  { 0x0213e, 2492, 0, 1, 2492 },
+  { 0x0213f, 2493, 0, 1, 2493 },
+  { 0x02140, 2494, 0, 1, 2494 },
+  { 0x02145, 2495, 0, 1, 2495 },
+  { 0x02146, 2496, 0, 1, 2496 },
+  { 0x02147, 2497, 0, 1, 2497 },
+  { 0x02148, 2498, 0, 1, 2498 },
+  { 0x02149, 2499, 0, 1, 2499 },
+  { 0x02150, 2500, 0, 3, 2500 },
+  { 0x02151, 2503, 0, 3, 2503 },
+  { 0x02152, 2506, 0, 4, 2506 },
+  { 0x02153, 2510, 0, 3, 2510 },
+  { 0x02154, 2513, 0, 3, 2513 },
+  { 0x02155, 2516, 0, 3, 2516 },
+  { 0x02156, 2519, 0, 3, 2519 },
+  { 0x02157, 2522, 0, 3, 2522 },
+  { 0x02158, 2525, 0, 3, 2525 },
+  { 0x02159, 2528, 0, 3, 2528 },
+  { 0x0215a, 2531, 0, 3, 2531 },
+  { 0x0215b, 2534, 0, 3, 2534 },
+  { 0x0215c, 2537, 0, 3, 2537 },
+  { 0x0215d, 2540, 0, 3, 2540 },
+  { 0x0215e, 2543, 0, 3, 2543 },
+  { 0x0215f, 2546, 0, 2, 2546 },
+  { 0x02160, 2548, 0, 1, 2548 },
+  { 0x02161, 2549, 0, 2, 2549 },
+  { 0x02162, 2551, 0, 3, 2551 },
+  { 0x02163, 2554, 0, 2, 2554 },
+  { 0x02164, 2556, 0, 1, 2556 },
+  { 0x02165, 2557, 0, 2, 2557 },
+  { 0x02166, 2559, 0, 3, 2559 },
+  { 0x02167, 2562, 0, 4, 2562 },
+  { 0x02168, 2566, 0, 2, 2566 },
+  { 0x02169, 2568, 0, 1, 2568 },
+  { 0x0216a, 2569, 0, 2, 2569 },
+  { 0x0216b, 2571, 0, 3, 2571 },
+  { 0x0216c, 2574, 0, 1, 2574 },
+  { 0x0216d, 2575, 0, 1, 2575 },
+  { 0x0216e, 2576, 0, 1, 2576 },
+  { 0x0216f, 2577, 0, 1, 2577 },
+  { 0x02170, 2578, 0, 1, 2578 },
+  { 0x02171, 2579, 0, 2, 2579 },
+  { 0x02172, 2581, 0, 3, 2581 },
+  { 0x02173, 2584, 0, 2, 2584 },
+  { 0x02174, 2586, 0, 1, 2586 },
+  { 0x02175, 2587, 0, 2, 2587 },
+  { 0x02176, 2589, 0, 3, 2589 },
+  { 0x02177, 2592, 0, 4, 2592 },
+  { 0x02178, 2596, 0, 2, 2596 },
+  { 0x02179, 2598, 0, 1, 2598 },
+  { 0x0217a, 2599, 0, 2, 2599 },
+  { 0x0217b, 2601, 0, 3, 2601 },
+  { 0x0217c, 2604, 0, 1, 2604 },
+  { 0x0217d, 2605, 0, 1, 2605 },
+  { 0x0217e, 2606, 0, 1, 2606 },
+  { 0x0217f, 2607, 0, 1, 2607 },
+  { 0x02189, 2608, 0, 3, 2608 },
+  { 0x0219a, 2611, 2, 2, 2611 },
+  { 0x0219b, 2613, 2, 2, 2613 },
+  { 0x021ae, 2615, 2, 2, 2615 },
+  { 0x021cd, 2617, 2, 2, 2617 },
+  { 0x021ce, 2619, 2, 2, 2619 },
+  { 0x021cf, 2621, 2, 2, 2621 },
+  { 0x02204, 2623, 2, 2, 2623 },
+  { 0x02209, 2625, 2, 2, 2625 },
+  { 0x0220c, 2627, 2, 2, 2627 },
+  { 0x02224, 2629, 2, 2, 2629 },
+  { 0x02226, 2631, 2, 2, 2631 },
+  { 0x0222c, 2633, 0, 2, 2633 },
+  { 0x0222d, 2635, 0, 3, 2635 },
+  { 0x0222f, 2638, 0, 2, 2638 },
+  { 0x02230, 2640, 0, 3, 2640 },
+  { 0x02241, 2643, 2, 2, 2643 },
+  { 0x02244, 2645, 2, 2, 2645 },
+  { 0x02247, 2647, 2, 2, 2647 },
+  { 0x02249, 2649, 2, 2, 2649 },
+  { 0x02260, 2651, 2, 2, 2651 },
+  { 0x02262, 2653, 2, 2, 2653 },
+  { 0x0226d, 2655, 2, 2, 2655 },
+  { 0x0226e, 2657, 2, 2, 2657 },
+  { 0x0226f, 2659, 2, 2, 2659 },
+  { 0x02270, 2661, 2, 2, 2661 },
+  { 0x02271, 2663, 2, 2, 2663 },
+  { 0x02274, 2665, 2, 2, 2665 },
+  { 0x02275, 2667, 2, 2, 2667 },
+  { 0x02278, 2669, 2, 2, 2669 },
+  { 0x02279, 2671, 2, 2, 2671 },
+  { 0x02280, 2673, 2, 2, 2673 },
+  { 0x02281, 2675, 2, 2, 2675 },
+  { 0x02284, 2677, 2, 2, 2677 },
+  { 0x02285, 2679, 2, 2, 2679 },
+  { 0x02288, 2681, 2, 2, 2681 },
+  { 0x02289, 2683, 2, 2, 2683 },
+  { 0x022ac, 2685, 2, 2, 2685 },
+  { 0x022ad, 2687, 2, 2, 2687 },
+  { 0x022ae, 2689, 2, 2, 2689 },
+  { 0x022af, 2691, 2, 2, 2691 },
+  { 0x022e0, 2693, 2, 2, 2693 },
+  { 0x022e1, 2695, 2, 2, 2695 },
+  { 0x022e2, 2697, 2, 2, 2697 },
+  { 0x022e3, 2699, 2, 2, 2699 },
+  { 0x022ea, 2701, 2, 2, 2701 },
+  { 0x022eb, 2703, 2, 2, 2703 },
+  { 0x022ec, 2705, 2, 2, 2705 },
+  { 0x022ed, 2707, 2, 2, 2707 },
+  { 0x02329, 2709, 1, 1, 2709 },
+  { 0x0232a, 2710, 1, 1, 2710 },
+  { 0x02460, 2711, 0, 1, 2711 },
+  { 0x02461, 2712, 0, 1, 2712 },
+  { 0x02462, 2713, 0, 1, 2713 },
+  { 0x02463, 2714, 0, 1, 2714 },
+  { 0x02464, 2715, 0, 1, 2715 },
+  { 0x02465, 2716, 0, 1, 2716 },
+  { 0x02466, 2717, 0, 1, 2717 },
+  { 0x02467, 2718, 0, 1, 2718 },
+  { 0x02468, 2719, 0, 1, 2719 },
+  { 0x02469, 2720, 0, 2, 2720 },
+  { 0x0246a, 2722, 0, 2, 2722 },
+  { 0x0246b, 2724, 0, 2, 2724 },
+  { 0x0246c, 2726, 0, 2, 2726 },
+  { 0x0246d, 2728, 0, 2, 2728 },
+  { 0x0246e, 2730, 0, 2, 2730 },
+  { 0x0246f, 2732, 0, 2, 2732 },
+  { 0x02470, 2734, 0, 2, 2734 },
+  { 0x02471, 2736, 0, 2, 2736 },
+  { 0x02472, 2738, 0, 2, 2738 },
+  { 0x02473, 2740, 0, 2, 2740 },
+  { 0x02474, 2742, 0, 3, 2742 },
+  { 0x02475, 2745, 0, 3, 2745 },
+  { 0x02476, 2748, 0, 3, 2748 },
+  { 0x02477, 2751, 0, 3, 2751 },
+  { 0x02478, 2754, 0, 3, 2754 },
+  { 0x02479, 2757, 0, 3, 2757 },
+  { 0x0247a, 2760, 0, 3, 2760 },
+  { 0x0247b, 2763, 0, 3, 2763 },
+  { 0x0247c, 2766, 0, 3, 2766 },
+  { 0x0247d, 2769, 0, 4, 2769 },
+  { 0x0247e, 2773, 0, 4, 2773 },
+  { 0x0247f, 2777, 0, 4, 2777 },
+  { 0x02480, 2781, 0, 4, 2781 },
+  { 0x02481, 2785, 0, 4, 2785 },
+  { 0x02482, 2789, 0, 4, 2789 },
+  { 0x02483, 2793, 0, 4, 2793 },
+  { 0x02484, 2797, 0, 4, 2797 },
+  { 0x02485, 2801, 0, 4, 2801 },
+  { 0x02486, 2805, 0, 4, 2805 },
+  { 0x02487, 2809, 0, 4, 2809 },
+  { 0x02488, 2813, 0, 2, 2813 },
+  { 0x02489, 2815, 0, 2, 2815 },
+  { 0x0248a, 2817, 0, 2, 2817 },
+  { 0x0248b, 2819, 0, 2, 2819 },
+  { 0x0248c, 2821, 0, 2, 2821 },
+  { 0x0248d, 2823, 0, 2, 2823 },
+  { 0x0248e, 2825, 0, 2, 2825 },
+  { 0x0248f, 2827, 0, 2, 2827 },
+  { 0x02490, 2829, 0, 2, 2829 },
+  { 0x02491, 2831, 0, 3, 2831 },
+  { 0x02492, 2834, 0, 3, 2834 },
+  { 0x02493, 2837, 0, 3, 2837 },
+  { 0x02494, 2840, 0, 3, 2840 },
+  { 0x02495, 2843, 0, 3, 2843 },
+  { 0x02496, 2846, 0, 3, 2846 },
+  { 0x02497, 2849, 0, 3, 2849 },
+  { 0x02498, 2852, 0, 3, 2852 },
+  { 0x02499, 2855, 0, 3, 2855 },
+  { 0x0249a, 2858, 0, 3, 2858 },
+  { 0x0249b, 2861, 0, 3, 2861 },
+  { 0x0249c, 2864, 0, 3, 2864 },
+  { 0x0249d, 2867, 0, 3, 2867 },
+  { 0x0249e, 2870, 0, 3, 2870 },
+  { 0x0249f, 2873, 0, 3, 2873 },
+  { 0x024a0, 2876, 0, 3, 2876 },
+  { 0x024a1, 2879, 0, 3, 2879 },
+  { 0x024a2, 2882, 0, 3, 2882 },
+  { 0x024a3, 2885, 0, 3, 2885 },
+  { 0x024a4, 2888, 0, 3, 2888 },
+  { 0x024a5, 2891, 0, 3, 2891 },
+  { 0x024a6, 2894, 0, 3, 2894 },
+  { 0x024a7, 2897, 0, 3, 2897 },
+  { 0x024a8, 2900, 0, 3, 2900 },
+  { 0x024a9, 2903, 0, 3, 2903 },
+  { 0x024aa, 2906, 0, 3, 2906 },
+  { 0x024ab, 2909, 0, 3, 2909 },
+  { 0x024ac, 2912, 0, 3, 2912 },
+  { 0x024ad, 2915, 0, 3, 2915 },
+  { 0x024ae, 2918, 0, 3, 2918 },
+  { 0x024af, 2921, 0, 3, 2921 },
+  { 0x024b0, 2924, 0, 3, 2924 },
+  { 0x024b1, 2927, 0, 3, 2927 },
+  { 0x024b2, 2930, 0, 3, 2930 },
+  { 0x024b3, 2933, 0, 3, 2933 },
+  { 0x024b4, 2936, 0, 3, 2936 },
+  { 0x024b5, 2939, 0, 3, 2939 },
+  { 0x024b6, 2942, 0, 1, 2942 },
+  { 0x024b7, 2943, 0, 1, 2943 },
+  { 0x024b8, 2944, 0, 1, 2944 },
+  { 0x024b9, 2945, 0, 1, 2945 },
+  { 0x024ba, 2946, 0, 1, 2946 },
+  { 0x024bb, 2947, 0, 1, 2947 },
+  { 0x024bc, 2948, 0, 1, 2948 },
+  { 0x024bd, 2949, 0, 1, 2949 },
+  { 0x024be, 2950, 0, 1, 2950 },
+  { 0x024bf, 2951, 0, 1, 2951 },
+  { 0x024c0, 2952, 0, 1, 2952 },
+  { 0x024c1, 2953, 0, 1, 2953 },
+  { 0x024c2, 2954, 0, 1, 2954 },
+  { 0x024c3, 2955, 0, 1, 2955 },
+  { 0x024c4, 2956, 0, 1, 2956 },
+  { 0x024c5, 2957, 0, 1, 2957 },
+  { 0x024c6, 2958, 0, 1, 2958 },
+  { 0x024c7, 2959, 0, 1, 2959 },
+  { 0x024c8, 2960, 0, 1, 2960 },
+  { 0x024c9, 2961, 0, 1, 2961 },
+  { 0x024ca, 2962, 0, 1, 2962 },
+  { 0x024cb, 2963, 0, 1, 2963 },
+  { 0x024cc, 2964, 0, 1, 2964 },
+  { 0x024cd, 2965, 0, 1, 2965 },
+  { 0x024ce, 2966, 0, 1, 2966 },
+  { 0x024cf, 2967, 0, 1, 2967 },
+  { 0x024d0, 2968, 0, 1, 2968 },
+  { 0x024d1, 2969, 0, 1, 2969 },
+  { 0x024d2, 2970, 0, 1, 2970 },
+  { 0x024d3, 2971, 0, 1, 2971 },
+  { 0x024d4, 2972, 0, 1, 2972 },
+  { 0x024d5, 2973, 0, 1, 2973 },
+  { 0x024d6, 2974, 0, 1, 2974 },
+  { 0x024d7, 2975, 0, 1, 2975 },
+  { 0x024d8, 2976, 0, 1, 2976 },
+  { 0x024d9, 2977, 0, 1, 2977 },
+  { 0x024da, 2978, 0, 1, 2978 },
+  { 0x024db, 2979, 0, 1, 2979 },
+  { 0x024dc, 2980, 0, 1, 2980 },
+  { 0x024dd, 2981, 0, 1, 2981 },
+  { 0x024de, 2982, 0, 1, 2982 },
+  { 0x024df, 2983, 0, 1, 2983 },
+  { 0x024e0, 2984, 0, 1, 2984 },
+  { 0x024e1, 2985, 0, 1, 2985 },
+  { 0x024e2, 2986, 0, 1, 2986 },
+  { 0x024e3, 2987, 0, 1, 2987 },
+  { 0x024e4, 2988, 0, 1, 2988 },
+  { 0x024e5, 2989, 0, 1, 2989 },
+  { 0x024e6, 2990, 0, 1, 2990 },
+  { 0x024e7, 2991, 0, 1, 2991 },
+  { 0x024e8, 2992, 0, 1, 2992 },
+  { 0x024e9, 2993, 0, 1, 2993 },
+  { 0x024ea, 2994, 0, 1, 2994 },
+  { 0x02a0c, 2995, 0, 4, 2995 },
+  { 0x02a74, 2999, 0, 3, 2999 },
+  { 0x02a75, 3002, 0, 2, 3002 },
+  { 0x02a76, 3004, 0, 3, 3004 },
+  { 0x02adc, 3007, 2, 2, 3007 },
+  { 0x02c7c, 3009, 0, 1, 3009 },
+  { 0x02c7d, 3010, 0, 1, 3010 },
+  { 0x02d6f, 3011, 0, 1, 3011 },
+  { 0x02e9f, 3012, 0, 1, 3012 },
+  { 0x02ef3, 3013, 0, 1, 3013 },
+  { 0x02f00, 3014, 0, 1, 3014 },
+  { 0x02f01, 3015, 0, 1, 3015 },
+  { 0x02f02, 3016, 0, 1, 3016 },
+  { 0x02f03, 3017, 0, 1, 3017 },
+  { 0x02f04, 3018, 0, 1, 3018 },
+  { 0x02f05, 3019, 0, 1, 3019 },
+  { 0x02f06, 3020, 0, 1, 3020 },
+  { 0x02f07, 3021, 0, 1, 3021 },
+  { 0x02f08, 3022, 0, 1, 3022 },
+  { 0x02f09, 3023, 0, 1, 3023 },
+  { 0x02f0a, 3024, 0, 1, 3024 },
+  { 0x02f0b, 3025, 0, 1, 3025 },
+  { 0x02f0c, 3026, 0, 1, 3026 },
+  { 0x02f0d, 3027, 0, 1, 3027 },
+  { 0x02f0e, 3028, 0, 1, 3028 },
+  { 0x02f0f, 3029, 0, 1, 3029 },
+  { 0x02f10, 3030, 0, 1, 3030 },
+  { 0x02f11, 3031, 0, 1, 3031 },
+  { 0x02f12, 3032, 0, 1, 3032 },
+  { 0x02f13, 3033, 0, 1, 3033 },
+  { 0x02f14, 3034, 0, 1, 3034 },
+  { 0x02f15, 3035, 0, 1, 3035 },
+  { 0x02f16, 3036, 0, 1, 3036 },
+  { 0x02f17, 3037, 0, 1, 3037 },
+  { 0x02f18, 3038, 0, 1, 3038 },
+  { 0x02f19, 3039, 0, 1, 3039 },
+  { 0x02f1a, 3040, 0, 1, 3040 },
+  { 0x02f1b, 3041, 0, 1, 3041 },
+  { 0x02f1c, 3042, 0, 1, 3042 },
+  { 0x02f1d, 3043, 0, 1, 3043 },
+  { 0x02f1e, 3044, 0, 1, 3044 },
+  { 0x02f1f, 3045, 0, 1, 3045 },
+  { 0x02f20, 3046, 0, 1, 3046 },
+  { 0x02f21, 3047, 0, 1, 3047 },
+  { 0x02f22, 3048, 0, 1, 3048 },
+  { 0x02f23, 3049, 0, 1, 3049 },
+  { 0x02f24, 3050, 0, 1, 3050 },
+  { 0x02f25, 3051, 0, 1, 3051 },
+  { 0x02f26, 3052, 0, 1, 3052 },
+  { 0x02f27, 3053, 0, 1, 3053 },
+  { 0x02f28, 3054, 0, 1, 3054 },
+  { 0x02f29, 3055, 0, 1, 3055 },
+  { 0x02f2a, 3056, 0, 1, 3056 },
+  { 0x02f2b, 3057, 0, 1, 3057 },
+  { 0x02f2c, 3058, 0, 1, 3058 },
+  { 0x02f2d, 3059, 0, 1, 3059 },
+  { 0x02f2e, 3060, 0, 1, 3060 },
+  { 0x02f2f, 3061, 0, 1, 3061 },
+  { 0x02f30, 3062, 0, 1, 3062 },
+  { 0x02f31, 3063, 0, 1, 3063 },
+  { 0x02f32, 3064, 0, 1, 3064 },
+  { 0x02f33, 3065, 0, 1, 3065 },
+  { 0x02f34, 3066, 0, 1, 3066 },
+  { 0x02f35, 3067, 0, 1, 3067 },
+  { 0x02f36, 3068, 0, 1, 3068 },
+  { 0x02f37, 3069, 0, 1, 3069 },
+  { 0x02f38, 3070, 0, 1, 3070 },
+  { 0x02f39, 3071, 0, 1, 3071 },
+  { 0x02f3a, 3072, 0, 1, 3072 },
+  { 0x02f3b, 3073, 0, 1, 3073 },
+  { 0x02f3c, 3074, 0, 1, 3074 },
+  { 0x02f3d, 3075, 0, 1, 3075 },
+  { 0x02f3e, 3076, 0, 1, 3076 },
+  { 0x02f3f, 3077, 0, 1, 3077 },
+  { 0x02f40, 3078, 0, 1, 3078 },
+  { 0x02f41, 3079, 0, 1, 3079 },
+  { 0x02f42, 3080, 0, 1, 3080 },
+  { 0x02f43, 3081, 0, 1, 3081 },
+  { 0x02f44, 3082, 0, 1, 3082 },
+  { 0x02f45, 3083, 0, 1, 3083 },
+  { 0x02f46, 3084, 0, 1, 3084 },
+  { 0x02f47, 3085, 0, 1, 3085 },
+  { 0x02f48, 3086, 0, 1, 3086 },
+  { 0x02f49, 3087, 0, 1, 3087 },
+  { 0x02f4a, 3088, 0, 1, 3088 },
+  { 0x02f4b, 3089, 0, 1, 3089 },
+  { 0x02f4c, 3090, 0, 1, 3090 },
+  { 0x02f4d, 3091, 0, 1, 3091 },
+  { 0x02f4e, 3092, 0, 1, 3092 },
+  { 0x02f4f, 3093, 0, 1, 3093 },
+  { 0x02f50, 3094, 0, 1, 3094 },
+  { 0x02f51, 3095, 0, 1, 3095 },
+  { 0x02f52, 3096, 0, 1, 3096 },
+  { 0x02f53, 3097, 0, 1, 3097 },
+  { 0x02f54, 3098, 0, 1, 3098 },
+  { 0x02f55, 3099, 0, 1, 3099 },
+  { 0x02f56, 3100, 0, 1, 3100 },
+  { 0x02f57, 3101, 0, 1, 3101 },
+  { 0x02f58, 3102, 0, 1, 3102 },
+  { 0x02f59, 3103, 0, 1, 3103 },
+  { 0x02f5a, 3104, 0, 1, 3104 },
+  { 0x02f5b, 3105, 0, 1, 3105 },
+  { 0x02f5c, 3106, 0, 1, 3106 },
+  { 0x02f5d, 3107, 0, 1, 3107 },
+  { 0x02f5e, 3108, 0, 1, 3108 },
+  { 0x02f5f, 3109, 0, 1, 3109 },
+  { 0x02f60, 3110, 0, 1, 3110 },
+  { 0x02f61, 3111, 0, 1, 3111 },
+  { 0x02f62, 3112, 0, 1, 3112 },
+  { 0x02f63, 3113, 0, 1, 3113 },
+  { 0x02f64, 3114, 0, 1, 3114 },
+  { 0x02f65, 3115, 0, 1, 3115 },
+  { 0x02f66, 3116, 0, 1, 3116 },
+  { 0x02f67, 3117, 0, 1, 3117 },
+  { 0x02f68, 3118, 0, 1, 3118 },
+  { 0x02f69, 3119, 0, 1, 3119 },
+  { 0x02f6a, 3120, 0, 1, 3120 },
+  { 0x02f6b, 3121, 0, 1, 3121 },
+  { 0x02f6c, 3122, 0, 1, 3122 },
+  { 0x02f6d, 3123, 0, 1, 3123 },
+  { 0x02f6e, 3124, 0, 1, 3124 },
+  { 0x02f6f, 3125, 0, 1, 3125 },
+  { 0x02f70, 3126, 0, 1, 3126 },
+  { 0x02f71, 3127, 0, 1, 3127 },
+  { 0x02f72, 3128, 0, 1, 3128 },
+  { 0x02f73, 3129, 0, 1, 3129 },
+  { 0x02f74, 3130, 0, 1, 3130 },
+  { 0x02f75, 3131, 0, 1, 3131 },
+  { 0x02f76, 3132, 0, 1, 3132 },
+  { 0x02f77, 3133, 0, 1, 3133 },
+  { 0x02f78, 3134, 0, 1, 3134 },
+  { 0x02f79, 3135, 0, 1, 3135 },
+  { 0x02f7a, 3136, 0, 1, 3136 },
+  { 0x02f7b, 3137, 0, 1, 3137 },
+  { 0x02f7c, 3138, 0, 1, 3138 },
+  { 0x02f7d, 3139, 0, 1, 3139 },
+  { 0x02f7e, 3140, 0, 1, 3140 },
+  { 0x02f7f, 3141, 0, 1, 3141 },
+  { 0x02f80, 3142, 0, 1, 3142 },
+  { 0x02f81, 3143, 0, 1, 3143 },
+  { 0x02f82, 3144, 0, 1, 3144 },
+  { 0x02f83, 3145, 0, 1, 3145 },
+  { 0x02f84, 3146, 0, 1, 3146 },
+  { 0x02f85, 3147, 0, 1, 3147 },
+  { 0x02f86, 3148, 0, 1, 3148 },
+  { 0x02f87, 3149, 0, 1, 3149 },
+  { 0x02f88, 3150, 0, 1, 3150 },
+  { 0x02f89, 3151, 0, 1, 3151 },
+  { 0x02f8a, 3152, 0, 1, 3152 },
+  { 0x02f8b, 3153, 0, 1, 3153 },
+  { 0x02f8c, 3154, 0, 1, 3154 },
+  { 0x02f8d, 3155, 0, 1, 3155 },
+  { 0x02f8e, 3156, 0, 1, 3156 },
+  { 0x02f8f, 3157, 0, 1, 3157 },
+  { 0x02f90, 3158, 0, 1, 3158 },
+  { 0x02f91, 3159, 0, 1, 3159 },
+  { 0x02f92, 3160, 0, 1, 3160 },
+  { 0x02f93, 3161, 0, 1, 3161 },
+  { 0x02f94, 3162, 0, 1, 3162 },
+  { 0x02f95, 3163, 0, 1, 3163 },
+  { 0x02f96, 3164, 0, 1, 3164 },
+  { 0x02f97, 3165, 0, 1, 3165 },
+  { 0x02f98, 3166, 0, 1, 3166 },
+  { 0x02f99, 3167, 0, 1, 3167 },
+  { 0x02f9a, 3168, 0, 1, 3168 },
+  { 0x02f9b, 3169, 0, 1, 3169 },
+  { 0x02f9c, 3170, 0, 1, 3170 },
+  { 0x02f9d, 3171, 0, 1, 3171 },
+  { 0x02f9e, 3172, 0, 1, 3172 },
+  { 0x02f9f, 3173, 0, 1, 3173 },
+  { 0x02fa0, 3174, 0, 1, 3174 },
+  { 0x02fa1, 3175, 0, 1, 3175 },
+  { 0x02fa2, 3176, 0, 1, 3176 },
+  { 0x02fa3, 3177, 0, 1, 3177 },
+  { 0x02fa4, 3178, 0, 1, 3178 },
+  { 0x02fa5, 3179, 0, 1, 3179 },
+  { 0x02fa6, 3180, 0, 1, 3180 },
+  { 0x02fa7, 3181, 0, 1, 3181 },
+  { 0x02fa8, 3182, 0, 1, 3182 },
+  { 0x02fa9, 3183, 0, 1, 3183 },
+  { 0x02faa, 3184, 0, 1, 3184 },
+  { 0x02fab, 3185, 0, 1, 3185 },
+  { 0x02fac, 3186, 0, 1, 3186 },
+  { 0x02fad, 3187, 0, 1, 3187 },
+  { 0x02fae, 3188, 0, 1, 3188 },
+  { 0x02faf, 3189, 0, 1, 3189 },
+  { 0x02fb0, 3190, 0, 1, 3190 },
+  { 0x02fb1, 3191, 0, 1, 3191 },
+  { 0x02fb2, 3192, 0, 1, 3192 },
+  { 0x02fb3, 3193, 0, 1, 3193 },
+  { 0x02fb4, 3194, 0, 1, 3194 },
+  { 0x02fb5, 3195, 0, 1, 3195 },
+  { 0x02fb6, 3196, 0, 1, 3196 },
+  { 0x02fb7, 3197, 0, 1, 3197 },
+  { 0x02fb8, 3198, 0, 1, 3198 },
+  { 0x02fb9, 3199, 0, 1, 3199 },
+  { 0x02fba, 3200, 0, 1, 3200 },
+  { 0x02fbb, 3201, 0, 1, 3201 },
+  { 0x02fbc, 3202, 0, 1, 3202 },
+  { 0x02fbd, 3203, 0, 1, 3203 },
+  { 0x02fbe, 3204, 0, 1, 3204 },
+  { 0x02fbf, 3205, 0, 1, 3205 },
+  { 0x02fc0, 3206, 0, 1, 3206 },
+  { 0x02fc1, 3207, 0, 1, 3207 },
+  { 0x02fc2, 3208, 0, 1, 3208 },
+  { 0x02fc3, 3209, 0, 1, 3209 },
+  { 0x02fc4, 3210, 0, 1, 3210 },
+  { 0x02fc5, 3211, 0, 1, 3211 },
+  { 0x02fc6, 3212, 0, 1, 3212 },
+  { 0x02fc7, 3213, 0, 1, 3213 },
+  { 0x02fc8, 3214, 0, 1, 3214 },
+  { 0x02fc9, 3215, 0, 1, 3215 },
+  { 0x02fca, 3216, 0, 1, 3216 },
+  { 0x02fcb, 3217, 0, 1, 3217 },
+  { 0x02fcc, 3218, 0, 1, 3218 },
+  { 0x02fcd, 3219, 0, 1, 3219 },
+  { 0x02fce, 3220, 0, 1, 3220 },
+  { 0x02fcf, 3221, 0, 1, 3221 },
+  { 0x02fd0, 3222, 0, 1, 3222 },
+  { 0x02fd1, 3223, 0, 1, 3223 },
+  { 0x02fd2, 3224, 0, 1, 3224 },
+  { 0x02fd3, 3225, 0, 1, 3225 },
+  { 0x02fd4, 3226, 0, 1, 3226 },
+  { 0x02fd5, 3227, 0, 1, 3227 },
+  { 0x03000, 3228, 0, 1, 3228 },
+  { 0x03036, 3229, 0, 1, 3229 },
+  { 0x03038, 3230, 0, 1, 3230 },
+  { 0x03039, 3231, 0, 1, 3231 },
+  { 0x0303a, 3232, 0, 1, 3232 },
+  { 0x0304c, 3233, 2, 2, 3233 },
+  { 0x0304e, 3235, 2, 2, 3235 },
+  { 0x03050, 3237, 2, 2, 3237 },
+  { 0x03052, 3239, 2, 2, 3239 },
+  { 0x03054, 3241, 2, 2, 3241 },
+  { 0x03056, 3243, 2, 2, 3243 },
+  { 0x03058, 3245, 2, 2, 3245 },
+  { 0x0305a, 3247, 2, 2, 3247 },
+  { 0x0305c, 3249, 2, 2, 3249 },
+  { 0x0305e, 3251, 2, 2, 3251 },
+  { 0x03060, 3253, 2, 2, 3253 },
+  { 0x03062, 3255, 2, 2, 3255 },
+  { 0x03065, 3257, 2, 2, 3257 },
+  { 0x03067, 3259, 2, 2, 3259 },
+  { 0x03069, 3261, 2, 2, 3261 },
+  { 0x03070, 3263, 2, 2, 3263 },
+  { 0x03071, 3265, 2, 2, 3265 },
+  { 0x03073, 3267, 2, 2, 3267 },
+  { 0x03074, 3269, 2, 2, 3269 },
+  { 0x03076, 3271, 2, 2, 3271 },
+  { 0x03077, 3273, 2, 2, 3273 },
+  { 0x03079, 3275, 2, 2, 3275 },
+  { 0x0307a, 3277, 2, 2, 3277 },
+  { 0x0307c, 3279, 2, 2, 3279 },
+  { 0x0307d, 3281, 2, 2, 3281 },
+  { 0x03094, 3283, 2, 2, 3283 },
+  { 0x0309b, 3285, 0, 2, 3285 },
+  { 0x0309c, 3287, 0, 2, 3287 },
+  { 0x0309e, 3289, 2, 2, 3289 },
+  { 0x0309f, 3291, 0, 2, 3291 },
+  { 0x030ac, 3293, 2, 2, 3293 },
+  { 0x030ae, 3295, 2, 2, 3295 },
+  { 0x030b0, 3297, 2, 2, 3297 },
+  { 0x030b2, 3299, 2, 2, 3299 },
+  { 0x030b4, 3301, 2, 2, 3301 },
+  { 0x030b6, 3303, 2, 2, 3303 },
+  { 0x030b8, 3305, 2, 2, 3305 },
+  { 0x030ba, 3307, 2, 2, 3307 },
+  { 0x030bc, 3309, 2, 2, 3309 },
+  { 0x030be, 3311, 2, 2, 3311 },
+  { 0x030c0, 3313, 2, 2, 3313 },
+  { 0x030c2, 3315, 2, 2, 3315 },
+  { 0x030c5, 3317, 2, 2, 3317 },
+  { 0x030c7, 3319, 2, 2, 3319 },
+  { 0x030c9, 3321, 2, 2, 3321 },
+  { 0x030d0, 3323, 2, 2, 3323 },
+  { 0x030d1, 3325, 2, 2, 3325 },
+  { 0x030d3, 3327, 2, 2, 3327 },
+  { 0x030d4, 3329, 2, 2, 3329 },
+  { 0x030d6, 3331, 2, 2, 3331 },
+  { 0x030d7, 3333, 2, 2, 3333 },
+  { 0x030d9, 3335, 2, 2, 3335 },
+  { 0x030da, 3337, 2, 2, 3337 },
+  { 0x030dc, 3339, 2, 2, 3339 },
+  { 0x030dd, 3341, 2, 2, 3341 },
+  { 0x030f4, 3343, 2, 2, 3343 },
+  { 0x030f7, 3345, 2, 2, 3345 },
+  { 0x030f8, 3347, 2, 2, 3347 },
+  { 0x030f9, 3349, 2, 2, 3349 },
+  { 0x030fa, 3351, 2, 2, 3351 },
+  { 0x030fe, 3353, 2, 2, 3353 },
+  { 0x030ff, 3355, 0, 2, 3355 },
+  { 0x03131, 3357, 0, 1, 3357 },
+  { 0x03132, 3358, 0, 1, 3358 },
+  { 0x03133, 3359, 0, 1, 3359 },
+  { 0x03134, 3360, 0, 1, 3360 },
+  { 0x03135, 3361, 0, 1, 3361 },
+  { 0x03136, 3362, 0, 1, 3362 },
+  { 0x03137, 3363, 0, 1, 3363 },
+  { 0x03138, 3364, 0, 1, 3364 },
+  { 0x03139, 3365, 0, 1, 3365 },
+  { 0x0313a, 3366, 0, 1, 3366 },
+  { 0x0313b, 3367, 0, 1, 3367 },
+  { 0x0313c, 3368, 0, 1, 3368 },
+  { 0x0313d, 3369, 0, 1, 3369 },
+  { 0x0313e, 3370, 0, 1, 3370 },
+  { 0x0313f, 3371, 0, 1, 3371 },
+  { 0x03140, 3372, 0, 1, 3372 },
+  { 0x03141, 3373, 0, 1, 3373 },
+  { 0x03142, 3374, 0, 1, 3374 },
+  { 0x03143, 3375, 0, 1, 3375 },
+  { 0x03144, 3376, 0, 1, 3376 },
+  { 0x03145, 3377, 0, 1, 3377 },
+  { 0x03146, 3378, 0, 1, 3378 },
+  { 0x03147, 3379, 0, 1, 3379 },
+  { 0x03148, 3380, 0, 1, 3380 },
+  { 0x03149, 3381, 0, 1, 3381 },
+  { 0x0314a, 3382, 0, 1, 3382 },
+  { 0x0314b, 3383, 0, 1, 3383 },
+  { 0x0314c, 3384, 0, 1, 3384 },
+  { 0x0314d, 3385, 0, 1, 3385 },
+  { 0x0314e, 3386, 0, 1, 3386 },
+  { 0x0314f, 3387, 0, 1, 3387 },
+  { 0x03150, 3388, 0, 1, 3388 },
+  { 0x03151, 3389, 0, 1, 3389 },
+  { 0x03152, 3390, 0, 1, 3390 },
+  { 0x03153, 3391, 0, 1, 3391 },
+  { 0x03154, 3392, 0, 1, 3392 },
+  { 0x03155, 3393, 0, 1, 3393 },
+  { 0x03156, 3394, 0, 1, 3394 },
+  { 0x03157, 3395, 0, 1, 3395 },
+  { 0x03158, 3396, 0, 1, 3396 },
+  { 0x03159, 3397, 0, 1, 3397 },
+  { 0x0315a, 3398, 0, 1, 3398 },
+  { 0x0315b, 3399, 0, 1, 3399 },
+  { 0x0315c, 3400, 0, 1, 3400 },
+  { 0x0315d, 3401, 0, 1, 3401 },
+  { 0x0315e, 3402, 0, 1, 3402 },
+  { 0x0315f, 3403, 0, 1, 3403 },
+  { 0x03160, 3404, 0, 1, 3404 },
+  { 0x03161, 3405, 0, 1, 3405 },
+  { 0x03162, 3406, 0, 1, 3406 },
+  { 0x03163, 3407, 0, 1, 3407 },
+  { 0x03164, 3408, 0, 1, 3408 },
+  { 0x03165, 3409, 0, 1, 3409 },
+  { 0x03166, 3410, 0, 1, 3410 },
+  { 0x03167, 3411, 0, 1, 3411 },
+  { 0x03168, 3412, 0, 1, 3412 },
+  { 0x03169, 3413, 0, 1, 3413 },
+  { 0x0316a, 3414, 0, 1, 3414 },
+  { 0x0316b, 3415, 0, 1, 3415 },
+  { 0x0316c, 3416, 0, 1, 3416 },
+  { 0x0316d, 3417, 0, 1, 3417 },
+  { 0x0316e, 3418, 0, 1, 3418 },
+  { 0x0316f, 3419, 0, 1, 3419 },
+  { 0x03170, 3420, 0, 1, 3420 },
+  { 0x03171, 3421, 0, 1, 3421 },
+  { 0x03172, 3422, 0, 1, 3422 },
+  { 0x03173, 3423, 0, 1, 3423 },
+  { 0x03174, 3424, 0, 1, 3424 },
+  { 0x03175, 3425, 0, 1, 3425 },
+  { 0x03176, 3426, 0, 1, 3426 },
+  { 0x03177, 3427, 0, 1, 3427 },
+  { 0x03178, 3428, 0, 1, 3428 },
+  { 0x03179, 3429, 0, 1, 3429 },
+  { 0x0317a, 3430, 0, 1, 3430 },
+  { 0x0317b, 3431, 0, 1, 3431 },
+  { 0x0317c, 3432, 0, 1, 3432 },
+  { 0x0317d, 3433, 0, 1, 3433 },
+  { 0x0317e, 3434, 0, 1, 3434 },
+  { 0x0317f, 3435, 0, 1, 3435 },
+  { 0x03180, 3436, 0, 1, 3436 },
+  { 0x03181, 3437, 0, 1, 3437 },
+  { 0x03182, 3438, 0, 1, 3438 },
+  { 0x03183, 3439, 0, 1, 3439 },
+  { 0x03184, 3440, 0, 1, 3440 },
+  { 0x03185, 3441, 0, 1, 3441 },
+  { 0x03186, 3442, 0, 1, 3442 },
+  { 0x03187, 3443, 0, 1, 3443 },
+  { 0x03188, 3444, 0, 1, 3444 },
+  { 0x03189, 3445, 0, 1, 3445 },
+  { 0x0318a, 3446, 0, 1, 3446 },
+  { 0x0318b, 3447, 0, 1, 3447 },
+  { 0x0318c, 3448, 0, 1, 3448 },
+  { 0x0318d, 3449, 0, 1, 3449 },
+  { 0x0318e, 3450, 0, 1, 3450 },
+  { 0x03192, 3451, 0, 1, 3451 },
+  { 0x03193, 3452, 0, 1, 3452 },
+  { 0x03194, 3453, 0, 1, 3453 },
+  { 0x03195, 3454, 0, 1, 3454 },
+  { 0x03196, 3455, 0, 1, 3455 },
+  { 0x03197, 3456, 0, 1, 3456 },
+  { 0x03198, 3457, 0, 1, 3457 },
+  { 0x03199, 3458, 0, 1, 3458 },
+  { 0x0319a, 3459, 0, 1, 3459 },
+  { 0x0319b, 3460, 0, 1, 3460 },
+  { 0x0319c, 3461, 0, 1, 3461 },
+  { 0x0319d, 3462, 0, 1, 3462 },
+  { 0x0319e, 3463, 0, 1, 3463 },
+  { 0x0319f, 3464, 0, 1, 3464 },
+  { 0x03200, 3465, 0, 3, 3465 },
+  { 0x03201, 3468, 0, 3, 3468 },
+  { 0x03202, 3471, 0, 3, 3471 },
+  { 0x03203, 3474, 0, 3, 3474 },
+  { 0x03204, 3477, 0, 3, 3477 },
+  { 0x03205, 3480, 0, 3, 3480 },
+  { 0x03206, 3483, 0, 3, 3483 },
+  { 0x03207, 3486, 0, 3, 3486 },
+  { 0x03208, 3489, 0, 3, 3489 },
+  { 0x03209, 3492, 0, 3, 3492 },
+  { 0x0320a, 3495, 0, 3, 3495 },
+  { 0x0320b, 3498, 0, 3, 3498 },
+  { 0x0320c, 3501, 0, 3, 3501 },
+  { 0x0320d, 3504, 0, 3, 3504 },
+  { 0x0320e, 3507, 0, 4, 3507 },
+  { 0x0320f, 3511, 0, 4, 3511 },
+  { 0x03210, 3515, 0, 4, 3515 },
+  { 0x03211, 3519, 0, 4, 3519 },
+  { 0x03212, 3523, 0, 4, 3523 },
+  { 0x03213, 3527, 0, 4, 3527 },
+  { 0x03214, 3531, 0, 4, 3531 },
+  { 0x03215, 3535, 0, 4, 3535 },
+  { 0x03216, 3539, 0, 4, 3539 },
+  { 0x03217, 3543, 0, 4, 3543 },
+  { 0x03218, 3547, 0, 4, 3547 },
+  { 0x03219, 3551, 0, 4, 3551 },
+  { 0x0321a, 3555, 0, 4, 3555 },
+  { 0x0321b, 3559, 0, 4, 3559 },
+  { 0x0321c, 3563, 0, 4, 3563 },
+  { 0x0321d, 3567, 0, 7, 3567 },
+  { 0x0321e, 3574, 0, 6, 3574 },
+  { 0x03220, 3580, 0, 3, 3580 },
+  { 0x03221, 3583, 0, 3, 3583 },
+  { 0x03222, 3586, 0, 3, 3586 },
+  { 0x03223, 3589, 0, 3, 3589 },
+  { 0x03224, 3592, 0, 3, 3592 },
+  { 0x03225, 3595, 0, 3, 3595 },
+  { 0x03226, 3598, 0, 3, 3598 },
+  { 0x03227, 3601, 0, 3, 3601 },
+  { 0x03228, 3604, 0, 3, 3604 },
+  { 0x03229, 3607, 0, 3, 3607 },
+  { 0x0322a, 3610, 0, 3, 3610 },
+  { 0x0322b, 3613, 0, 3, 3613 },
+  { 0x0322c, 3616, 0, 3, 3616 },
+  { 0x0322d, 3619, 0, 3, 3619 },
+  { 0x0322e, 3622, 0, 3, 3622 },
+  { 0x0322f, 3625, 0, 3, 3625 },
+  { 0x03230, 3628, 0, 3, 3628 },
+  { 0x03231, 3631, 0, 3, 3631 },
+  { 0x03232, 3634, 0, 3, 3634 },
+  { 0x03233, 3637, 0, 3, 3637 },
+  { 0x03234, 3640, 0, 3, 3640 },
+  { 0x03235, 3643, 0, 3, 3643 },
+  { 0x03236, 3646, 0, 3, 3646 },
+  { 0x03237, 3649, 0, 3, 3649 },
+  { 0x03238, 3652, 0, 3, 3652 },
+  { 0x03239, 3655, 0, 3, 3655 },
+  { 0x0323a, 3658, 0, 3, 3658 },
+  { 0x0323b, 3661, 0, 3, 3661 },
+  { 0x0323c, 3664, 0, 3, 3664 },
+  { 0x0323d, 3667, 0, 3, 3667 },
+  { 0x0323e, 3670, 0, 3, 3670 },
+  { 0x0323f, 3673, 0, 3, 3673 },
+  { 0x03240, 3676, 0, 3, 3676 },
+  { 0x03241, 3679, 0, 3, 3679 },
+  { 0x03242, 3682, 0, 3, 3682 },
+  { 0x03243, 3685, 0, 3, 3685 },
+  { 0x03244, 3688, 0, 1, 3688 },
+  { 0x03245, 3689, 0, 1, 3689 },
+  { 0x03246, 3690, 0, 1, 3690 },
+  { 0x03247, 3691, 0, 1, 3691 },
+  { 0x03250, 3692, 0, 3, 3692 },
+  { 0x03251, 3695, 0, 2, 3695 },
+  { 0x03252, 3697, 0, 2, 3697 },
+  { 0x03253, 3699, 0, 2, 3699 },
+  { 0x03254, 3701, 0, 2, 3701 },
+  { 0x03255, 3703, 0, 2, 3703 },
+  { 0x03256, 3705, 0, 2, 3705 },
+  { 0x03257, 3707, 0, 2, 3707 },
+  { 0x03258, 3709, 0, 2, 3709 },
+  { 0x03259, 3711, 0, 2, 3711 },
+  { 0x0325a, 3713, 0, 2, 3713 },
+  { 0x0325b, 3715, 0, 2, 3715 },
+  { 0x0325c, 3717, 0, 2, 3717 },
+  { 0x0325d, 3719, 0, 2, 3719 },
+  { 0x0325e, 3721, 0, 2, 3721 },
+  { 0x0325f, 3723, 0, 2, 3723 },
+  { 0x03260, 3725, 0, 1, 3725 },
+  { 0x03261, 3726, 0, 1, 3726 },
+  { 0x03262, 3727, 0, 1, 3727 },
+  { 0x03263, 3728, 0, 1, 3728 },
+  { 0x03264, 3729, 0, 1, 3729 },
+  { 0x03265, 3730, 0, 1, 3730 },
+  { 0x03266, 3731, 0, 1, 3731 },
+  { 0x03267, 3732, 0, 1, 3732 },
+  { 0x03268, 3733, 0, 1, 3733 },
+  { 0x03269, 3734, 0, 1, 3734 },
+  { 0x0326a, 3735, 0, 1, 3735 },
+  { 0x0326b, 3736, 0, 1, 3736 },
+  { 0x0326c, 3737, 0, 1, 3737 },
+  { 0x0326d, 3738, 0, 1, 3738 },
+  { 0x0326e, 3739, 0, 2, 3739 },
+  { 0x0326f, 3741, 0, 2, 3741 },
+  { 0x03270, 3743, 0, 2, 3743 },
+  { 0x03271, 3745, 0, 2, 3745 },
+  { 0x03272, 3747, 0, 2, 3747 },
+  { 0x03273, 3749, 0, 2, 3749 },
+  { 0x03274, 3751, 0, 2, 3751 },
+  { 0x03275, 3753, 0, 2, 3753 },
+  { 0x03276, 3755, 0, 2, 3755 },
+  { 0x03277, 3757, 0, 2, 3757 },
+  { 0x03278, 3759, 0, 2, 3759 },
+  { 0x03279, 3761, 0, 2, 3761 },
+  { 0x0327a, 3763, 0, 2, 3763 },
+  { 0x0327b, 3765, 0, 2, 3765 },
+  { 0x0327c, 3767, 0, 5, 3767 },
+  { 0x0327d, 3772, 0, 4, 3772 },
+  { 0x0327e, 3776, 0, 2, 3776 },
+  { 0x03280, 3778, 0, 1, 3778 },
+  { 0x03281, 3779, 0, 1, 3779 },
+  { 0x03282, 3780, 0, 1, 3780 },
+  { 0x03283, 3781, 0, 1, 3781 },
+  { 0x03284, 3782, 0, 1, 3782 },
+  { 0x03285, 3783, 0, 1, 3783 },
+  { 0x03286, 3784, 0, 1, 3784 },
+  { 0x03287, 3785, 0, 1, 3785 },
+  { 0x03288, 3786, 0, 1, 3786 },
+  { 0x03289, 3787, 0, 1, 3787 },
+  { 0x0328a, 3788, 0, 1, 3788 },
+  { 0x0328b, 3789, 0, 1, 3789 },
+  { 0x0328c, 3790, 0, 1, 3790 },
+  { 0x0328d, 3791, 0, 1, 3791 },
+  { 0x0328e, 3792, 0, 1, 3792 },
+  { 0x0328f, 3793, 0, 1, 3793 },
+  { 0x03290, 3794, 0, 1, 3794 },
+  { 0x03291, 3795, 0, 1, 3795 },
+  { 0x03292, 3796, 0, 1, 3796 },
+  { 0x03293, 3797, 0, 1, 3797 },
+  { 0x03294, 3798, 0, 1, 3798 },
+  { 0x03295, 3799, 0, 1, 3799 },
+  { 0x03296, 3800, 0, 1, 3800 },
+  { 0x03297, 3801, 0, 1, 3801 },
+  { 0x03298, 3802, 0, 1, 3802 },
+  { 0x03299, 3803, 0, 1, 3803 },
+  { 0x0329a, 3804, 0, 1, 3804 },
+  { 0x0329b, 3805, 0, 1, 3805 },
+  { 0x0329c, 3806, 0, 1, 3806 },
+  { 0x0329d, 3807, 0, 1, 3807 },
+  { 0x0329e, 3808, 0, 1, 3808 },
+  { 0x0329f, 3809, 0, 1, 3809 },
+  { 0x032a0, 3810, 0, 1, 3810 },
+  { 0x032a1, 3811, 0, 1, 3811 },
+  { 0x032a2, 3812, 0, 1, 3812 },
+  { 0x032a3, 3813, 0, 1, 3813 },
+  { 0x032a4, 3814, 0, 1, 3814 },
+  { 0x032a5, 3815, 0, 1, 3815 },
+  { 0x032a6, 3816, 0, 1, 3816 },
+  { 0x032a7, 3817, 0, 1, 3817 },
+  { 0x032a8, 3818, 0, 1, 3818 },
+  { 0x032a9, 3819, 0, 1, 3819 },
+  { 0x032aa, 3820, 0, 1, 3820 },
+  { 0x032ab, 3821, 0, 1, 3821 },
+  { 0x032ac, 3822, 0, 1, 3822 },
+  { 0x032ad, 3823, 0, 1, 3823 },
+  { 0x032ae, 3824, 0, 1, 3824 },
+  { 0x032af, 3825, 0, 1, 3825 },
+  { 0x032b0, 3826, 0, 1, 3826 },
+  { 0x032b1, 3827, 0, 2, 3827 },
+  { 0x032b2, 3829, 0, 2, 3829 },
+  { 0x032b3, 3831, 0, 2, 3831 },
+  { 0x032b4, 3833, 0, 2, 3833 },
+  { 0x032b5, 3835, 0, 2, 3835 },
+  { 0x032b6, 3837, 0, 2, 3837 },
+  { 0x032b7, 3839, 0, 2, 3839 },
+  { 0x032b8, 3841, 0, 2, 3841 },
+  { 0x032b9, 3843, 0, 2, 3843 },
+  { 0x032ba, 3845, 0, 2, 3845 },
+  { 0x032bb, 3847, 0, 2, 3847 },
+  { 0x032bc, 3849, 0, 2, 3849 },
+  { 0x032bd, 3851, 0, 2, 3851 },
+  { 0x032be, 3853, 0, 2, 3853 },
+  { 0x032bf, 3855, 0, 2, 3855 },
+  { 0x032c0, 3857, 0, 2, 3857 },
+  { 0x032c1, 3859, 0, 2, 3859 },
+  { 0x032c2, 3861, 0, 2, 3861 },
+  { 0x032c3, 3863, 0, 2, 3863 },
+  { 0x032c4, 3865, 0, 2, 3865 },
+  { 0x032c5, 3867, 0, 2, 3867 },
+  { 0x032c6, 3869, 0, 2, 3869 },
+  { 0x032c7, 3871, 0, 2, 3871 },
+  { 0x032c8, 3873, 0, 2, 3873 },
+  { 0x032c9, 3875, 0, 3, 3875 },
+  { 0x032ca, 3878, 0, 3, 3878 },
+  { 0x032cb, 3881, 0, 3, 3881 },
+  { 0x032cc, 3884, 0, 2, 3884 },
+  { 0x032cd, 3886, 0, 3, 3886 },
+  { 0x032ce, 3889, 0, 2, 3889 },
+  { 0x032cf, 3891, 0, 3, 3891 },
+  { 0x032d0, 3894, 0, 1, 3894 },
+  { 0x032d1, 3895, 0, 1, 3895 },
+  { 0x032d2, 3896, 0, 1, 3896 },
+  { 0x032d3, 3897, 0, 1, 3897 },
+  { 0x032d4, 3898, 0, 1, 3898 },
+  { 0x032d5, 3899, 0, 1, 3899 },
+  { 0x032d6, 3900, 0, 1, 3900 },
+  { 0x032d7, 3901, 0, 1, 3901 },
+  { 0x032d8, 3902, 0, 1, 3902 },
+  { 0x032d9, 3903, 0, 1, 3903 },
+  { 0x032da, 3904, 0, 1, 3904 },
+  { 0x032db, 3905, 0, 1, 3905 },
+  { 0x032dc, 3906, 0, 1, 3906 },
+  { 0x032dd, 3907, 0, 1, 3907 },
+  { 0x032de, 3908, 0, 1, 3908 },
+  { 0x032df, 3909, 0, 1, 3909 },
+  { 0x032e0, 3910, 0, 1, 3910 },
+  { 0x032e1, 3911, 0, 1, 3911 },
+  { 0x032e2, 3912, 0, 1, 3912 },
+  { 0x032e3, 3913, 0, 1, 3913 },
+  { 0x032e4, 3914, 0, 1, 3914 },
+  { 0x032e5, 3915, 0, 1, 3915 },
+  { 0x032e6, 3916, 0, 1, 3916 },
+  { 0x032e7, 3917, 0, 1, 3917 },
+  { 0x032e8, 3918, 0, 1, 3918 },
+  { 0x032e9, 3919, 0, 1, 3919 },
+  { 0x032ea, 3920, 0, 1, 3920 },
+  { 0x032eb, 3921, 0, 1, 3921 },
+  { 0x032ec, 3922, 0, 1, 3922 },
+  { 0x032ed, 3923, 0, 1, 3923 },
+  { 0x032ee, 3924, 0, 1, 3924 },
+  { 0x032ef, 3925, 0, 1, 3925 },
+  { 0x032f0, 3926, 0, 1, 3926 },
+  { 0x032f1, 3927, 0, 1, 3927 },
+  { 0x032f2, 3928, 0, 1, 3928 },
+  { 0x032f3, 3929, 0, 1, 3929 },
+  { 0x032f4, 3930, 0, 1, 3930 },
+  { 0x032f5, 3931, 0, 1, 3931 },
+  { 0x032f6, 3932, 0, 1, 3932 },
+  { 0x032f7, 3933, 0, 1, 3933 },
+  { 0x032f8, 3934, 0, 1, 3934 },
+  { 0x032f9, 3935, 0, 1, 3935 },
+  { 0x032fa, 3936, 0, 1, 3936 },
+  { 0x032fb, 3937, 0, 1, 3937 },
+  { 0x032fc, 3938, 0, 1, 3938 },
+  { 0x032fd, 3939, 0, 1, 3939 },
+  { 0x032fe, 3940, 0, 1, 3940 },
+  { 0x032ff, 3941, 0, 2, 3941 },
+  { 0x03300, 3943, 0, 5, 3943 },
+  { 0x03301, 3948, 0, 4, 3948 },
+  { 0x03302, 3952, 0, 5, 3952 },
+  { 0x03303, 3957, 0, 3, 3957 },
+  { 0x03304, 3960, 0, 5, 3960 },
+  { 0x03305, 3965, 0, 3, 3965 },
+  { 0x03306, 3968, 0, 3, 3968 },
+  { 0x03307, 3971, 0, 6, 3971 },
+  { 0x03308, 3977, 0, 4, 3977 },
+  { 0x03309, 3981, 0, 3, 3981 },
+  { 0x0330a, 3984, 0, 3, 3984 },
+  { 0x0330b, 3987, 0, 3, 3987 },
+  { 0x0330c, 3990, 0, 4, 3990 },
+  { 0x0330d, 3994, 0, 4, 3994 },
+  { 0x0330e, 3998, 0, 4, 3998 },
+  { 0x0330f, 4002, 0, 4, 4002 },
+  { 0x03310, 4006, 0, 4, 4006 },
+  { 0x03311, 4010, 0, 4, 4010 },
+  { 0x03312, 4014, 0, 4, 4014 },
+  { 0x03313, 4018, 0, 6, 4018 },
+  { 0x03314, 4024, 0, 2, 4024 },
+  { 0x03315, 4026, 0, 6, 4026 },
+  { 0x03316, 4032, 0, 6, 4032 },
+  { 0x03317, 4038, 0, 5, 4038 },
+  { 0x03318, 4043, 0, 4, 4043 },
+  { 0x03319, 4047, 0, 6, 4047 },
+  { 0x0331a, 4053, 0, 6, 4053 },
+  { 0x0331b, 4059, 0, 4, 4059 },
+  { 0x0331c, 4063, 0, 3, 4063 },
+  { 0x0331d, 4066, 0, 3, 4066 },
+  { 0x0331e, 4069, 0, 4, 4069 },
+  { 0x0331f, 4073, 0, 4, 4073 },
+  { 0x03320, 4077, 0, 5, 4077 },
+  { 0x03321, 4082, 0, 5, 4082 },
+  { 0x03322, 4087, 0, 3, 4087 },
+  { 0x03323, 4090, 0, 3, 4090 },
+  { 0x03324, 4093, 0, 4, 4093 },
+  { 0x03325, 4097, 0, 3, 4097 },
+  { 0x03326, 4100, 0, 3, 4100 },
+  { 0x03327, 4103, 0, 2, 4103 },
+  { 0x03328, 4105, 0, 2, 4105 },
+  { 0x03329, 4107, 0, 3, 4107 },
+  { 0x0332a, 4110, 0, 3, 4110 },
+  { 0x0332b, 4113, 0, 6, 4113 },
+  { 0x0332c, 4119, 0, 4, 4119 },
+  { 0x0332d, 4123, 0, 5, 4123 },
+  { 0x0332e, 4128, 0, 6, 4128 },
+  { 0x0332f, 4134, 0, 4, 4134 },
+  { 0x03330, 4138, 0, 3, 4138 },
+  { 0x03331, 4141, 0, 3, 4141 },
+  { 0x03332, 4144, 0, 6, 4144 },
+  { 0x03333, 4150, 0, 4, 4150 },
+  { 0x03334, 4154, 0, 6, 4154 },
+  { 0x03335, 4160, 0, 3, 4160 },
+  { 0x03336, 4163, 0, 5, 4163 },
+  { 0x03337, 4168, 0, 3, 4168 },
+  { 0x03338, 4171, 0, 4, 4171 },
+  { 0x03339, 4175, 0, 3, 4175 },
+  { 0x0333a, 4178, 0, 4, 4178 },
+  { 0x0333b, 4182, 0, 5, 4182 },
+  { 0x0333c, 4187, 0, 4, 4187 },
+  { 0x0333d, 4191, 0, 5, 4191 },
+  { 0x0333e, 4196, 0, 4, 4196 },
+  { 0x0333f, 4200, 0, 2, 4200 },
+  { 0x03340, 4202, 0, 5, 4202 },
+  { 0x03341, 4207, 0, 3, 4207 },
+  { 0x03342, 4210, 0, 3, 4210 },
+  { 0x03343, 4213, 0, 4, 4213 },
+  { 0x03344, 4217, 0, 3, 4217 },
+  { 0x03345, 4220, 0, 3, 4220 },
+  { 0x03346, 4223, 0, 3, 4223 },
+  { 0x03347, 4226, 0, 5, 4226 },
+  { 0x03348, 4231, 0, 4, 4231 },
+  { 0x03349, 4235, 0, 2, 4235 },
+  { 0x0334a, 4237, 0, 6, 4237 },
+  { 0x0334b, 4243, 0, 3, 4243 },
+  { 0x0334c, 4246, 0, 5, 4246 },
+  { 0x0334d, 4251, 0, 4, 4251 },
+  { 0x0334e, 4255, 0, 4, 4255 },
+  { 0x0334f, 4259, 0, 3, 4259 },
+  { 0x03350, 4262, 0, 3, 4262 },
+  { 0x03351, 4265, 0, 4, 4265 },
+  { 0x03352, 4269, 0, 2, 4269 },
+  { 0x03353, 4271, 0, 4, 4271 },
+  { 0x03354, 4275, 0, 5, 4275 },
+  { 0x03355, 4280, 0, 2, 4280 },
+  { 0x03356, 4282, 0, 6, 4282 },
+  { 0x03357, 4288, 0, 3, 4288 },
+  { 0x03358, 4291, 0, 2, 4291 },
+  { 0x03359, 4293, 0, 2, 4293 },
+  { 0x0335a, 4295, 0, 2, 4295 },
+  { 0x0335b, 4297, 0, 2, 4297 },
+  { 0x0335c, 4299, 0, 2, 4299 },
+  { 0x0335d, 4301, 0, 2, 4301 },
+  { 0x0335e, 4303, 0, 2, 4303 },
+  { 0x0335f, 4305, 0, 2, 4305 },
+  { 0x03360, 4307, 0, 2, 4307 },
+  { 0x03361, 4309, 0, 2, 4309 },
+  { 0x03362, 4311, 0, 3, 4311 },
+  { 0x03363, 4314, 0, 3, 4314 },
+  { 0x03364, 4317, 0, 3, 4317 },
+  { 0x03365, 4320, 0, 3, 4320 },
+  { 0x03366, 4323, 0, 3, 4323 },
+  { 0x03367, 4326, 0, 3, 4326 },
+  { 0x03368, 4329, 0, 3, 4329 },
+  { 0x03369, 4332, 0, 3, 4332 },
+  { 0x0336a, 4335, 0, 3, 4335 },
+  { 0x0336b, 4338, 0, 3, 4338 },
+  { 0x0336c, 4341, 0, 3, 4341 },
+  { 0x0336d, 4344, 0, 3, 4344 },
+  { 0x0336e, 4347, 0, 3, 4347 },
+  { 0x0336f, 4350, 0, 3, 4350 },
+  { 0x03370, 4353, 0, 3, 4353 },
+  { 0x03371, 4356, 0, 3, 4356 },
+  { 0x03372, 4359, 0, 2, 4359 },
+  { 0x03373, 4361, 0, 2, 4361 },
+  { 0x03374, 4363, 0, 3, 4363 },
+  { 0x03375, 4366, 0, 2, 4366 },
+  { 0x03376, 4368, 0, 2, 4368 },
+  { 0x03377, 4370, 0, 2, 4370 },
+  { 0x03378, 4372, 0, 3, 4372 },
+  { 0x03379, 4375, 0, 3, 4375 },
+  { 0x0337a, 4378, 0, 2, 4378 },
+  { 0x0337b, 4380, 0, 2, 4380 },
+  { 0x0337c, 4382, 0, 2, 4382 },
+  { 0x0337d, 4384, 0, 2, 4384 },
+  { 0x0337e, 4386, 0, 2, 4386 },
+  { 0x0337f, 4388, 0, 4, 4388 },
+  { 0x03380, 4392, 0, 2, 4392 },
+  { 0x03381, 4394, 0, 2, 4394 },
+  { 0x03382, 4396, 0, 2, 4396 },
+  { 0x03383, 4398, 0, 2, 4398 },
+  { 0x03384, 4400, 0, 2, 4400 },
+  { 0x03385, 4402, 0, 2, 4402 },
+  { 0x03386, 4404, 0, 2, 4404 },
+  { 0x03387, 4406, 0, 2, 4406 },
+  { 0x03388, 4408, 0, 3, 4408 },
+  { 0x03389, 4411, 0, 4, 4411 },
+  { 0x0338a, 4415, 0, 2, 4415 },
+  { 0x0338b, 4417, 0, 2, 4417 },
+  { 0x0338c, 4419, 0, 2, 4419 },
+  { 0x0338d, 4421, 0, 2, 4421 },
+  { 0x0338e, 4423, 0, 2, 4423 },
+  { 0x0338f, 4425, 0, 2, 4425 },
+  { 0x03390, 4427, 0, 2, 4427 },
+  { 0x03391, 4429, 0, 3, 4429 },
+  { 0x03392, 4432, 0, 3, 4432 },
+  { 0x03393, 4435, 0, 3, 4435 },
+  { 0x03394, 4438, 0, 3, 4438 },
+  { 0x03395, 4441, 0, 2, 4441 },
+  { 0x03396, 4443, 0, 2, 4443 },
+  { 0x03397, 4445, 0, 2, 4445 },
+  { 0x03398, 4447, 0, 2, 4447 },
+  { 0x03399, 4449, 0, 2, 4449 },
+  { 0x0339a, 4451, 0, 2, 4451 },
+  { 0x0339b, 4453, 0, 2, 4453 },
+  { 0x0339c, 4455, 0, 2, 4455 },
+  { 0x0339d, 4457, 0, 2, 4457 },
+  { 0x0339e, 4459, 0, 2, 4459 },
+  { 0x0339f, 4461, 0, 3, 4461 },
+  { 0x033a0, 4464, 0, 3, 4464 },
+  { 0x033a1, 4467, 0, 2, 4467 },
+  { 0x033a2, 4469, 0, 3, 4469 },
+  { 0x033a3, 4472, 0, 3, 4472 },
+  { 0x033a4, 4475, 0, 3, 4475 },
+  { 0x033a5, 4478, 0, 2, 4478 },
+  { 0x033a6, 4480, 0, 3, 4480 },
+  { 0x033a7, 4483, 0, 3, 4483 },
+  { 0x033a8, 4486, 0, 4, 4486 },
+  { 0x033a9, 4490, 0, 2, 4490 },
+  { 0x033aa, 4492, 0, 3, 4492 },
+  { 0x033ab, 4495, 0, 3, 4495 },
+  { 0x033ac, 4498, 0, 3, 4498 },
+  { 0x033ad, 4501, 0, 3, 4501 },
+  { 0x033ae, 4504, 0, 5, 4504 },
+  { 0x033af, 4509, 0, 6, 4509 },
+  { 0x033b0, 4515, 0, 2, 4515 },
+  { 0x033b1, 4517, 0, 2, 4517 },
+  { 0x033b2, 4519, 0, 2, 4519 },
+  { 0x033b3, 4521, 0, 2, 4521 },
+  { 0x033b4, 4523, 0, 2, 4523 },
+  { 0x033b5, 4525, 0, 2, 4525 },
+  { 0x033b6, 4527, 0, 2, 4527 },
+  { 0x033b7, 4529, 0, 2, 4529 },
+  { 0x033b8, 4531, 0, 2, 4531 },
+  { 0x033b9, 4533, 0, 2, 4533 },
+  { 0x033ba, 4535, 0, 2, 4535 },
+  { 0x033bb, 4537, 0, 2, 4537 },
+  { 0x033bc, 4539, 0, 2, 4539 },
+  { 0x033bd, 4541, 0, 2, 4541 },
+  { 0x033be, 4543, 0, 2, 4543 },
+  { 0x033bf, 4545, 0, 2, 4545 },
+  { 0x033c0, 4547, 0, 2, 4547 },
+  { 0x033c1, 4549, 0, 2, 4549 },
+  { 0x033c2, 4551, 0, 4, 4551 },
+  { 0x033c3, 4555, 0, 2, 4555 },
+  { 0x033c4, 4557, 0, 2, 4557 },
+  { 0x033c5, 4559, 0, 2, 4559 },
+  { 0x033c6, 4561, 0, 4, 4561 },
+  { 0x033c7, 4565, 0, 3, 4565 },
+  { 0x033c8, 4568, 0, 2, 4568 },
+  { 0x033c9, 4570, 0, 2, 4570 },
+  { 0x033ca, 4572, 0, 2, 4572 },
+  { 0x033cb, 4574, 0, 2, 4574 },
+  { 0x033cc, 4576, 0, 2, 4576 },
+  { 0x033cd, 4578, 0, 2, 4578 },
+  { 0x033ce, 4580, 0, 2, 4580 },
+  { 0x033cf, 4582, 0, 2, 4582 },
+  { 0x033d0, 4584, 0, 2, 4584 },
+  { 0x033d1, 4586, 0, 2, 4586 },
+  { 0x033d2, 4588, 0, 3, 4588 },
+  { 0x033d3, 4591, 0, 2, 4591 },
+  { 0x033d4, 4593, 0, 2, 4593 },
+  { 0x033d5, 4595, 0, 3, 4595 },
+  { 0x033d6, 4598, 0, 3, 4598 },
+  { 0x033d7, 4601, 0, 2, 4601 },
+  { 0x033d8, 4603, 0, 4, 4603 },
+  { 0x033d9, 4607, 0, 3, 4607 },
+  { 0x033da, 4610, 0, 2, 4610 },
+  { 0x033db, 4612, 0, 2, 4612 },
+  { 0x033dc, 4614, 0, 2, 4614 },
+  { 0x033dd, 4616, 0, 2, 4616 },
+  { 0x033de, 4618, 0, 3, 4618 },
+  { 0x033df, 4621, 0, 3, 4621 },
+  { 0x033e0, 4624, 0, 2, 4624 },
+  { 0x033e1, 4626, 0, 2, 4626 },
+  { 0x033e2, 4628, 0, 2, 4628 },
+  { 0x033e3, 4630, 0, 2, 4630 },
+  { 0x033e4, 4632, 0, 2, 4632 },
+  { 0x033e5, 4634, 0, 2, 4634 },
+  { 0x033e6, 4636, 0, 2, 4636 },
+  { 0x033e7, 4638, 0, 2, 4638 },
+  { 0x033e8, 4640, 0, 2, 4640 },
+  { 0x033e9, 4642, 0, 3, 4642 },
+  { 0x033ea, 4645, 0, 3, 4645 },
+  { 0x033eb, 4648, 0, 3, 4648 },
+  { 0x033ec, 4651, 0, 3, 4651 },
+  { 0x033ed, 4654, 0, 3, 4654 },
+  { 0x033ee, 4657, 0, 3, 4657 },
+  { 0x033ef, 4660, 0, 3, 4660 },
+  { 0x033f0, 4663, 0, 3, 4663 },
+  { 0x033f1, 4666, 0, 3, 4666 },
+  { 0x033f2, 4669, 0, 3, 4669 },
+  { 0x033f3, 4672, 0, 3, 4672 },
+  { 0x033f4, 4675, 0, 3, 4675 },
+  { 0x033f5, 4678, 0, 3, 4678 },
+  { 0x033f6, 4681, 0, 3, 4681 },
+  { 0x033f7, 4684, 0, 3, 4684 },
+  { 0x033f8, 4687, 0, 3, 4687 },
+  { 0x033f9, 4690, 0, 3, 4690 },
+  { 0x033fa, 4693, 0, 3, 4693 },
+  { 0x033fb, 4696, 0, 3, 4696 },
+  { 0x033fc, 4699, 0, 3, 4699 },
+  { 0x033fd, 4702, 0, 3, 4702 },
+  { 0x033fe, 4705, 0, 3, 4705 },
+  { 0x033ff, 4708, 0, 3, 4708 },
+  { 0x0a69c, 4711, 0, 1, 4711 },
+  { 0x0a69d, 4712, 0, 1, 4712 },
+  { 0x0a770, 4713, 0, 1, 4713 },
+  { 0x0a7f2, 4714, 0, 1, 4714 },
+  { 0x0a7f3, 4715, 0, 1, 4715 },
+  { 0x0a7f4, 4716, 0, 1, 4716 },
+  { 0x0a7f8, 4717, 0, 1, 4717 },
+  { 0x0a7f9, 4718, 0, 1, 4718 },
+  { 0x0ab5c, 4719, 0, 1, 4719 },
+  { 0x0ab5d, 4720, 0, 1, 4720 },
+  { 0x0ab5e, 4721, 0, 1, 4721 },
+  { 0x0ab5f, 4722, 0, 1, 4722 },
+  { 0x0ab69, 4723, 0, 1, 4723 },
+  { 0x0f900, 4724, 1, 1, 4724 },
+  { 0x0f901, 4725, 1, 1, 4725 },
+  { 0x0f902, 4726, 1, 1, 4726 },
+  { 0x0f903, 4727, 1, 1, 4727 },
+  { 0x0f904, 4728, 1, 1, 4728 },
+  { 0x0f905, 4729, 1, 1, 4729 },
+  { 0x0f906, 4730, 1, 1, 4730 },
+  { 0x0f907, 4731, 1, 1, 4731 },
+  { 0x0f908, 4732, 1, 1, 4732 },
+  { 0x0f909, 4733, 1, 1, 4733 },
+  { 0x0f90a, 4734, 1, 1, 4734 },
+  { 0x0f90b, 4735, 1, 1, 4735 },
+  { 0x0f90c, 4736, 1, 1, 4736 },
+  { 0x0f90d, 4737, 1, 1, 4737 },
+  { 0x0f90e, 4738, 1, 1, 4738 },
+  { 0x0f90f, 4739, 1, 1, 4739 },
+  { 0x0f910, 4740, 1, 1, 4740 },
+  { 0x0f911, 4741, 1, 1, 4741 },
+  { 0x0f912, 4742, 1, 1, 4742 },
+  { 0x0f913, 4743, 1, 1, 4743 },
+  { 0x0f914, 4744, 1, 1, 4744 },
+  { 0x0f915, 4745, 1, 1, 4745 },
+  { 0x0f916, 4746, 1, 1, 4746 },
+  { 0x0f917, 4747, 1, 1, 4747 },
+  { 0x0f918, 4748, 1, 1, 4748 },
+  { 0x0f919, 4749, 1, 1, 4749 },
+  { 0x0f91a, 4750, 1, 1, 4750 },
+  { 0x0f91b, 4751, 1, 1, 4751 },
+  { 0x0f91c, 4752, 1, 1, 4752 },
+  { 0x0f91d, 4753, 1, 1, 4753 },
+  { 0x0f91e, 4754, 1, 1, 4754 },
+  { 0x0f91f, 4755, 1, 1, 4755 },
+  { 0x0f920, 4756, 1, 1, 4756 },
+  { 0x0f921, 4757, 1, 1, 4757 },
+  { 0x0f922, 4758, 1, 1, 4758 },
+  { 0x0f923, 4759, 1, 1, 4759 },
+  { 0x0f924, 4760, 1, 1, 4760 },
+  { 0x0f925, 4761, 1, 1, 4761 },
+  { 0x0f926, 4762, 1, 1, 4762 },
+  { 0x0f927, 4763, 1, 1, 4763 },
+  { 0x0f928, 4764, 1, 1, 4764 },
+  { 0x0f929, 4765, 1, 1, 4765 },
+  { 0x0f92a, 4766, 1, 1, 4766 },
+  { 0x0f92b, 4767, 1, 1, 4767 },
+  { 0x0f92c, 4768, 1, 1, 4768 },
+  { 0x0f92d, 4769, 1, 1, 4769 },
+  { 0x0f92e, 4770, 1, 1, 4770 },
+  { 0x0f92f, 4771, 1, 1, 4771 },
+  { 0x0f930, 4772, 1, 1, 4772 },
+  { 0x0f931, 4773, 1, 1, 4773 },
+  { 0x0f932, 4774, 1, 1, 4774 },
+  { 0x0f933, 4775, 1, 1, 4775 },
+  { 0x0f934, 4776, 1, 1, 4776 },
+  { 0x0f935, 4777, 1, 1, 4777 },
+  { 0x0f936, 4778, 1, 1, 4778 },
+  { 0x0f937, 4779, 1, 1, 4779 },
+  { 0x0f938, 4780, 1, 1, 4780 },
+  { 0x0f939, 4781, 1, 1, 4781 },
+  { 0x0f93a, 4782, 1, 1, 4782 },
+  { 0x0f93b, 4783, 1, 1, 4783 },
+  { 0x0f93c, 4784, 1, 1, 4784 },
+  { 0x0f93d, 4785, 1, 1, 4785 },
+  { 0x0f93e, 4786, 1, 1, 4786 },
+  { 0x0f93f, 4787, 1, 1, 4787 },
+  { 0x0f940, 4788, 1, 1, 4788 },
+  { 0x0f941, 4789, 1, 1, 4789 },
+  { 0x0f942, 4790, 1, 1, 4790 },
+  { 0x0f943, 4791, 1, 1, 4791 },
+  { 0x0f944, 4792, 1, 1, 4792 },
+  { 0x0f945, 4793, 1, 1, 4793 },
+  { 0x0f946, 4794, 1, 1, 4794 },
+  { 0x0f947, 4795, 1, 1, 4795 },
+  { 0x0f948, 4796, 1, 1, 4796 },
+  { 0x0f949, 4797, 1, 1, 4797 },
+  { 0x0f94a, 4798, 1, 1, 4798 },
+  { 0x0f94b, 4799, 1, 1, 4799 },
+  { 0x0f94c, 4800, 1, 1, 4800 },
+  { 0x0f94d, 4801, 1, 1, 4801 },
+  { 0x0f94e, 4802, 1, 1, 4802 },
+  { 0x0f94f, 4803, 1, 1, 4803 },
+  { 0x0f950, 4804, 1, 1, 4804 },
+  { 0x0f951, 4805, 1, 1, 4805 },
+  { 0x0f952, 4806, 1, 1, 4806 },
+  { 0x0f953, 4807, 1, 1, 4807 },
+  { 0x0f954, 4808, 1, 1, 4808 },
+  { 0x0f955, 4809, 1, 1, 4809 },
+  { 0x0f956, 4810, 1, 1, 4810 },
+  { 0x0f957, 4811, 1, 1, 4811 },
+  { 0x0f958, 4812, 1, 1, 4812 },
+  { 0x0f959, 4813, 1, 1, 4813 },
+  { 0x0f95a, 4814, 1, 1, 4814 },
+  { 0x0f95b, 4815, 1, 1, 4815 },
+  { 0x0f95c, 4816, 1, 1, 4816 },
+  { 0x0f95d, 4817, 1, 1, 4817 },
+  { 0x0f95e, 4818, 1, 1, 4818 },
+  { 0x0f95f, 4819, 1, 1, 4819 },
+  { 0x0f960, 4820, 1, 1, 4820 },
+  { 0x0f961, 4821, 1, 1, 4821 },
+  { 0x0f962, 4822, 1, 1, 4822 },
+  { 0x0f963, 4823, 1, 1, 4823 },
+  { 0x0f964, 4824, 1, 1, 4824 },
+  { 0x0f965, 4825, 1, 1, 4825 },
+  { 0x0f966, 4826, 1, 1, 4826 },
+  { 0x0f967, 4827, 1, 1, 4827 },
+  { 0x0f968, 4828, 1, 1, 4828 },
+  { 0x0f969, 4829, 1, 1, 4829 },
+  { 0x0f96a, 4830, 1, 1, 4830 },
+  { 0x0f96b, 4831, 1, 1, 4831 },
+  { 0x0f96c, 4832, 1, 1, 4832 },
+  { 0x0f96d, 4833, 1, 1, 4833 },
+  { 0x0f96e, 4834, 1, 1, 4834 },
+  { 0x0f96f, 4835, 1, 1, 4835 },
+  { 0x0f970, 4836, 1, 1, 4836 },
+  { 0x0f971, 4837, 1, 1, 4837 },
+  { 0x0f972, 4838, 1, 1, 4838 },
+  { 0x0f973, 4839, 1, 1, 4839 },
+  { 0x0f974, 4840, 1, 1, 4840 },
+  { 0x0f975, 4841, 1, 1, 4841 },
+  { 0x0f976, 4842, 1, 1, 4842 },
+  { 0x0f977, 4843, 1, 1, 4843 },
+  { 0x0f978, 4844, 1, 1, 4844 },
+  { 0x0f979, 4845, 1, 1, 4845 },
+  { 0x0f97a, 4846, 1, 1, 4846 },
+  { 0x0f97b, 4847, 1, 1, 4847 },
+  { 0x0f97c, 4848, 1, 1, 4848 },
+  { 0x0f97d, 4849, 1, 1, 4849 },
+  { 0x0f97e, 4850, 1, 1, 4850 },
+  { 0x0f97f, 4851, 1, 1, 4851 },
+  { 0x0f980, 4852, 1, 1, 4852 },
+  { 0x0f981, 4853, 1, 1, 4853 },
+  { 0x0f982, 4854, 1, 1, 4854 },
+  { 0x0f983, 4855, 1, 1, 4855 },
+  { 0x0f984, 4856, 1, 1, 4856 },
+  { 0x0f985, 4857, 1, 1, 4857 },
+  { 0x0f986, 4858, 1, 1, 4858 },
+  { 0x0f987, 4859, 1, 1, 4859 },
+  { 0x0f988, 4860, 1, 1, 4860 },
+  { 0x0f989, 4861, 1, 1, 4861 },
+  { 0x0f98a, 4862, 1, 1, 4862 },
+  { 0x0f98b, 4863, 1, 1, 4863 },
+  { 0x0f98c, 4864, 1, 1, 4864 },
+  { 0x0f98d, 4865, 1, 1, 4865 },
+  { 0x0f98e, 4866, 1, 1, 4866 },
+  { 0x0f98f, 4867, 1, 1, 4867 },
+  { 0x0f990, 4868, 1, 1, 4868 },
+  { 0x0f991, 4869, 1, 1, 4869 },
+  { 0x0f992, 4870, 1, 1, 4870 },
+  { 0x0f993, 4871, 1, 1, 4871 },
+  { 0x0f994, 4872, 1, 1, 4872 },
+  { 0x0f995, 4873, 1, 1, 4873 },
+  { 0x0f996, 4874, 1, 1, 4874 },
+  { 0x0f997, 4875, 1, 1, 4875 },
+  { 0x0f998, 4876, 1, 1, 4876 },
+  { 0x0f999, 4877, 1, 1, 4877 },
+  { 0x0f99a, 4878, 1, 1, 4878 },
+  { 0x0f99b, 4879, 1, 1, 4879 },
+  { 0x0f99c, 4880, 1, 1, 4880 },
+  { 0x0f99d, 4881, 1, 1, 4881 },
+  { 0x0f99e, 4882, 1, 1, 4882 },
+  { 0x0f99f, 4883, 1, 1, 4883 },
+  { 0x0f9a0, 4884, 1, 1, 4884 },
+  { 0x0f9a1, 4885, 1, 1, 4885 },
+  { 0x0f9a2, 4886, 1, 1, 4886 },
+  { 0x0f9a3, 4887, 1, 1, 4887 },
+  { 0x0f9a4, 4888, 1, 1, 4888 },
+  { 0x0f9a5, 4889, 1, 1, 4889 },
+  { 0x0f9a6, 4890, 1, 1, 4890 },
+  { 0x0f9a7, 4891, 1, 1, 4891 },
+  { 0x0f9a8, 4892, 1, 1, 4892 },
+  { 0x0f9a9, 4893, 1, 1, 4893 },
+  { 0x0f9aa, 4894, 1, 1, 4894 },
+  { 0x0f9ab, 4895, 1, 1, 4895 },
+  { 0x0f9ac, 4896, 1, 1, 4896 },
+  { 0x0f9ad, 4897, 1, 1, 4897 },
+  { 0x0f9ae, 4898, 1, 1, 4898 },
+  { 0x0f9af, 4899, 1, 1, 4899 },
+  { 0x0f9b0, 4900, 1, 1, 4900 },
+  { 0x0f9b1, 4901, 1, 1, 4901 },
+  { 0x0f9b2, 4902, 1, 1, 4902 },
+  { 0x0f9b3, 4903, 1, 1, 4903 },
+  { 0x0f9b4, 4904, 1, 1, 4904 },
+  { 0x0f9b5, 4905, 1, 1, 4905 },
+  { 0x0f9b6, 4906, 1, 1, 4906 },
+  { 0x0f9b7, 4907, 1, 1, 4907 },
+  { 0x0f9b8, 4908, 1, 1, 4908 },
+  { 0x0f9b9, 4909, 1, 1, 4909 },
+  { 0x0f9ba, 4910, 1, 1, 4910 },
+  { 0x0f9bb, 4911, 1, 1, 4911 },
+  { 0x0f9bc, 4912, 1, 1, 4912 },
+  { 0x0f9bd, 4913, 1, 1, 4913 },
+  { 0x0f9be, 4914, 1, 1, 4914 },
+  { 0x0f9bf, 4915, 1, 1, 4915 },
+  { 0x0f9c0, 4916, 1, 1, 4916 },
+  { 0x0f9c1, 4917, 1, 1, 4917 },
+  { 0x0f9c2, 4918, 1, 1, 4918 },
+  { 0x0f9c3, 4919, 1, 1, 4919 },
+  { 0x0f9c4, 4920, 1, 1, 4920 },
+  { 0x0f9c5, 4921, 1, 1, 4921 },
+  { 0x0f9c6, 4922, 1, 1, 4922 },
+  { 0x0f9c7, 4923, 1, 1, 4923 },
+  { 0x0f9c8, 4924, 1, 1, 4924 },
+  { 0x0f9c9, 4925, 1, 1, 4925 },
+  { 0x0f9ca, 4926, 1, 1, 4926 },
+  { 0x0f9cb, 4927, 1, 1, 4927 },
+  { 0x0f9cc, 4928, 1, 1, 4928 },
+  { 0x0f9cd, 4929, 1, 1, 4929 },
+  { 0x0f9ce, 4930, 1, 1, 4930 },
+  { 0x0f9cf, 4931, 1, 1, 4931 },
+  { 0x0f9d0, 4932, 1, 1, 4932 },
+  { 0x0f9d1, 4933, 1, 1, 4933 },
+  { 0x0f9d2, 4934, 1, 1, 4934 },
+  { 0x0f9d3, 4935, 1, 1, 4935 },
+  { 0x0f9d4, 4936, 1, 1, 4936 },
+  { 0x0f9d5, 4937, 1, 1, 4937 },
+  { 0x0f9d6, 4938, 1, 1, 4938 },
+  { 0x0f9d7, 4939, 1, 1, 4939 },
+  { 0x0f9d8, 4940, 1, 1, 4940 },
+  { 0x0f9d9, 4941, 1, 1, 4941 },
+  { 0x0f9da, 4942, 1, 1, 4942 },
+  { 0x0f9db, 4943, 1, 1, 4943 },
+  { 0x0f9dc, 4944, 1, 1, 4944 },
+  { 0x0f9dd, 4945, 1, 1, 4945 },
+  { 0x0f9de, 4946, 1, 1, 4946 },
+  { 0x0f9df, 4947, 1, 1, 4947 },
+  { 0x0f9e0, 4948, 1, 1, 4948 },
+  { 0x0f9e1, 4949, 1, 1, 4949 },
+  { 0x0f9e2, 4950, 1, 1, 4950 },
+  { 0x0f9e3, 4951, 1, 1, 4951 },
+  { 0x0f9e4, 4952, 1, 1, 4952 },
+  { 0x0f9e5, 4953, 1, 1, 4953 },
+  { 0x0f9e6, 4954, 1, 1, 4954 },
+  { 0x0f9e7, 4955, 1, 1, 4955 },
+  { 0x0f9e8, 4956, 1, 1, 4956 },
+  { 0x0f9e9, 4957, 1, 1, 4957 },
+  { 0x0f9ea, 4958, 1, 1, 4958 },
+  { 0x0f9eb, 4959, 1, 1, 4959 },
+  { 0x0f9ec, 4960, 1, 1, 4960 },
+  { 0x0f9ed, 4961, 1, 1, 4961 },
+  { 0x0f9ee, 4962, 1, 1, 4962 },
+  { 0x0f9ef, 4963, 1, 1, 4963 },
+  { 0x0f9f0, 4964, 1, 1, 4964 },
+  { 0x0f9f1, 4965, 1, 1, 4965 },
+  { 0x0f9f2, 4966, 1, 1, 4966 },
+  { 0x0f9f3, 4967, 1, 1, 4967 },
+  { 0x0f9f4, 4968, 1, 1, 4968 },
+  { 0x0f9f5, 4969, 1, 1, 4969 },
+  { 0x0f9f6, 4970, 1, 1, 4970 },
+  { 0x0f9f7, 4971, 1, 1, 4971 },
+  { 0x0f9f8, 4972, 1, 1, 4972 },
+  { 0x0f9f9, 4973, 1, 1, 4973 },
+  { 0x0f9fa, 4974, 1, 1, 4974 },
+  { 0x0f9fb, 4975, 1, 1, 4975 },
+  { 0x0f9fc, 4976, 1, 1, 4976 },
+  { 0x0f9fd, 4977, 1, 1, 4977 },
+  { 0x0f9fe, 4978, 1, 1, 4978 },
+  { 0x0f9ff, 4979, 1, 1, 4979 },
+  { 0x0fa00, 4980, 1, 1, 4980 },
+  { 0x0fa01, 4981, 1, 1, 4981 },
+  { 0x0fa02, 4982, 1, 1, 4982 },
+  { 0x0fa03, 4983, 1, 1, 4983 },
+  { 0x0fa04, 4984, 1, 1, 4984 },
+  { 0x0fa05, 4985, 1, 1, 4985 },
+  { 0x0fa06, 4986, 1, 1, 4986 },
+  { 0x0fa07, 4987, 1, 1, 4987 },
+  { 0x0fa08, 4988, 1, 1, 4988 },
+  { 0x0fa09, 4989, 1, 1, 4989 },
+  { 0x0fa0a, 4990, 1, 1, 4990 },
+  { 0x0fa0b, 4991, 1, 1, 4991 },
+  { 0x0fa0c, 4992, 1, 1, 4992 },
+  { 0x0fa0d, 4993, 1, 1, 4993 },
+  { 0x0fa10, 4994, 1, 1, 4994 },
+  { 0x0fa12, 4995, 1, 1, 4995 },
+  { 0x0fa15, 4996, 1, 1, 4996 },
+  { 0x0fa16, 4997, 1, 1, 4997 },
+  { 0x0fa17, 4998, 1, 1, 4998 },
+  { 0x0fa18, 4999, 1, 1, 4999 },
+  { 0x0fa19, 5000, 1, 1, 5000 },
+  { 0x0fa1a, 5001, 1, 1, 5001 },
+  { 0x0fa1b, 5002, 1, 1, 5002 },
+  { 0x0fa1c, 5003, 1, 1, 5003 },
+  { 0x0fa1d, 5004, 1, 1, 5004 },
+  { 0x0fa1e, 5005, 1, 1, 5005 },
+  { 0x0fa20, 5006, 1, 1, 5006 },
+  { 0x0fa22, 5007, 1, 1, 5007 },
+  { 0x0fa25, 5008, 1, 1, 5008 },
+  { 0x0fa26, 5009, 1, 1, 5009 },
+  { 0x0fa2a, 5010, 1, 1, 5010 },
+  { 0x0fa2b, 5011, 1, 1, 5011 },
+  { 0x0fa2c, 5012, 1, 1, 5012 },
+  { 0x0fa2d, 5013, 1, 1, 5013 },
+  { 0x0fa2e, 5014, 1, 1, 5014 },
+  { 0x0fa2f, 5015, 1, 1, 5015 },
+  { 0x0fa30, 5016, 1, 1, 5016 },
+  { 0x0fa31, 5017, 1, 1, 5017 },
+  { 0x0fa32, 5018, 1, 1, 5018 },
+  { 0x0fa33, 5019, 1, 1, 5019 },
+  { 0x0fa34, 5020, 1, 1, 5020 },
+  { 0x0fa35, 5021, 1, 1, 5021 },
+  { 0x0fa36, 5022, 1, 1, 5022 },
+  { 0x0fa37, 5023, 1, 1, 5023 },
+  { 0x0fa38, 5024, 1, 1, 5024 },
+  { 0x0fa39, 5025, 1, 1, 5025 },
+  { 0x0fa3a, 5026, 1, 1, 5026 },
+  { 0x0fa3b, 5027, 1, 1, 5027 },
+  { 0x0fa3c, 5028, 1, 1, 5028 },
+  { 0x0fa3d, 5029, 1, 1, 5029 },
+  { 0x0fa3e, 5030, 1, 1, 5030 },
+  { 0x0fa3f, 5031, 1, 1, 5031 },
+  { 0x0fa40, 5032, 1, 1, 5032 },
+  { 0x0fa41, 5033, 1, 1, 5033 },
+  { 0x0fa42, 5034, 1, 1, 5034 },
+  { 0x0fa43, 5035, 1, 1, 5035 },
+  { 0x0fa44, 5036, 1, 1, 5036 },
+  { 0x0fa45, 5037, 1, 1, 5037 },
+  { 0x0fa46, 5038, 1, 1, 5038 },
+  { 0x0fa47, 5039, 1, 1, 5039 },
+  { 0x0fa48, 5040, 1, 1, 5040 },
+  { 0x0fa49, 5041, 1, 1, 5041 },
+  { 0x0fa4a, 5042, 1, 1, 5042 },
+  { 0x0fa4b, 5043, 1, 1, 5043 },
+  { 0x0fa4c, 5044, 1, 1, 5044 },
+  { 0x0fa4d, 5045, 1, 1, 5045 },
+  { 0x0fa4e, 5046, 1, 1, 5046 },
+  { 0x0fa4f, 5047, 1, 1, 5047 },
+  { 0x0fa50, 5048, 1, 1, 5048 },
+  { 0x0fa51, 5049, 1, 1, 5049 },
+  { 0x0fa52, 5050, 1, 1, 5050 },
+  { 0x0fa53, 5051, 1, 1, 5051 },
+  { 0x0fa54, 5052, 1, 1, 5052 },
+  { 0x0fa55, 5053, 1, 1, 5053 },
+  { 0x0fa56, 5054, 1, 1, 5054 },
+  { 0x0fa57, 5055, 1, 1, 5055 },
+  { 0x0fa58, 5056, 1, 1, 5056 },
+  { 0x0fa59, 5057, 1, 1, 5057 },
+  { 0x0fa5a, 5058, 1, 1, 5058 },
+  { 0x0fa5b, 5059, 1, 1, 5059 },
+  { 0x0fa5c, 5060, 1, 1, 5060 },
+  { 0x0fa5d, 5061, 1, 1, 5061 },
+  { 0x0fa5e, 5062, 1, 1, 5062 },
+  { 0x0fa5f, 5063, 1, 1, 5063 },
+  { 0x0fa60, 5064, 1, 1, 5064 },
+  { 0x0fa61, 5065, 1, 1, 5065 },
+  { 0x0fa62, 5066, 1, 1, 5066 },
+  { 0x0fa63, 5067, 1, 1, 5067 },
+  { 0x0fa64, 5068, 1, 1, 5068 },
+  { 0x0fa65, 5069, 1, 1, 5069 },
+  { 0x0fa66, 5070, 1, 1, 5070 },
+  { 0x0fa67, 5071, 1, 1, 5071 },
+  { 0x0fa68, 5072, 1, 1, 5072 },
+  { 0x0fa69, 5073, 1, 1, 5073 },
+  { 0x0fa6a, 5074, 1, 1, 5074 },
+  { 0x0fa6b, 5075, 1, 1, 5075 },
+  { 0x0fa6c, 5076, 1, 1, 5076 },
+  { 0x0fa6d, 5077, 1, 1, 5077 },
+  { 0x0fa70, 5078, 1, 1, 5078 },
+  { 0x0fa71, 5079, 1, 1, 5079 },
+  { 0x0fa72, 5080, 1, 1, 5080 },
+  { 0x0fa73, 5081, 1, 1, 5081 },
+  { 0x0fa74, 5082, 1, 1, 5082 },
+  { 0x0fa75, 5083, 1, 1, 5083 },
+  { 0x0fa76, 5084, 1, 1, 5084 },
+  { 0x0fa77, 5085, 1, 1, 5085 },
+  { 0x0fa78, 5086, 1, 1, 5086 },
+  { 0x0fa79, 5087, 1, 1, 5087 },
+  { 0x0fa7a, 5088, 1, 1, 5088 },
+  { 0x0fa7b, 5089, 1, 1, 5089 },
+  { 0x0fa7c, 5090, 1, 1, 5090 },
+  { 0x0fa7d, 5091, 1, 1, 5091 },
+  { 0x0fa7e, 5092, 1, 1, 5092 },
+  { 0x0fa7f, 5093, 1, 1, 5093 },
+  { 0x0fa80, 5094, 1, 1, 5094 },
+  { 0x0fa81, 5095, 1, 1, 5095 },
+  { 0x0fa82, 5096, 1, 1, 5096 },
+  { 0x0fa83, 5097, 1, 1, 5097 },
+  { 0x0fa84, 5098, 1, 1, 5098 },
+  { 0x0fa85, 5099, 1, 1, 5099 },
+  { 0x0fa86, 5100, 1, 1, 5100 },
+  { 0x0fa87, 5101, 1, 1, 5101 },
+  { 0x0fa88, 5102, 1, 1, 5102 },
+  { 0x0fa89, 5103, 1, 1, 5103 },
+  { 0x0fa8a, 5104, 1, 1, 5104 },
+  { 0x0fa8b, 5105, 1, 1, 5105 },
+  { 0x0fa8c, 5106, 1, 1, 5106 },
+  { 0x0fa8d, 5107, 1, 1, 5107 },
+  { 0x0fa8e, 5108, 1, 1, 5108 },
+  { 0x0fa8f, 5109, 1, 1, 5109 },
+  { 0x0fa90, 5110, 1, 1, 5110 },
+  { 0x0fa91, 5111, 1, 1, 5111 },
+  { 0x0fa92, 5112, 1, 1, 5112 },
+  { 0x0fa93, 5113, 1, 1, 5113 },
+  { 0x0fa94, 5114, 1, 1, 5114 },
+  { 0x0fa95, 5115, 1, 1, 5115 },
+  { 0x0fa96, 5116, 1, 1, 5116 },
+  { 0x0fa97, 5117, 1, 1, 5117 },
+  { 0x0fa98, 5118, 1, 1, 5118 },
+  { 0x0fa99, 5119, 1, 1, 5119 },
+  { 0x0fa9a, 5120, 1, 1, 5120 },
+  { 0x0fa9b, 5121, 1, 1, 5121 },
+  { 0x0fa9c, 5122, 1, 1, 5122 },
+  { 0x0fa9d, 5123, 1, 1, 5123 },
+  { 0x0fa9e, 5124, 1, 1, 5124 },
+  { 0x0fa9f, 5125, 1, 1, 5125 },
+  { 0x0faa0, 5126, 1, 1, 5126 },
+  { 0x0faa1, 5127, 1, 1, 5127 },
+  { 0x0faa2, 5128, 1, 1, 5128 },
+  { 0x0faa3, 5129, 1, 1, 5129 },
+  { 0x0faa4, 5130, 1, 1, 5130 },
+  { 0x0faa5, 5131, 1, 1, 5131 },
+  { 0x0faa6, 5132, 1, 1, 5132 },
+  { 0x0faa7, 5133, 1, 1, 5133 },
+  { 0x0faa8, 5134, 1, 1, 5134 },
+  { 0x0faa9, 5135, 1, 1, 5135 },
+  { 0x0faaa, 5136, 1, 1, 5136 },
+  { 0x0faab, 5137, 1, 1, 5137 },
+  { 0x0faac, 5138, 1, 1, 5138 },
+  { 0x0faad, 5139, 1, 1, 5139 },
+  { 0x0faae, 5140, 1, 1, 5140 },
+  { 0x0faaf, 5141, 1, 1, 5141 },
+  { 0x0fab0, 5142, 1, 1, 5142 },
+  { 0x0fab1, 5143, 1, 1, 5143 },
+  { 0x0fab2, 5144, 1, 1, 5144 },
+  { 0x0fab3, 5145, 1, 1, 5145 },
+  { 0x0fab4, 5146, 1, 1, 5146 },
+  { 0x0fab5, 5147, 1, 1, 5147 },
+  { 0x0fab6, 5148, 1, 1, 5148 },
+  { 0x0fab7, 5149, 1, 1, 5149 },
+  { 0x0fab8, 5150, 1, 1, 5150 },
+  { 0x0fab9, 5151, 1, 1, 5151 },
+  { 0x0faba, 5152, 1, 1, 5152 },
+  { 0x0fabb, 5153, 1, 1, 5153 },
+  { 0x0fabc, 5154, 1, 1, 5154 },
+  { 0x0fabd, 5155, 1, 1, 5155 },
+  { 0x0fabe, 5156, 1, 1, 5156 },
+  { 0x0fabf, 5157, 1, 1, 5157 },
+  { 0x0fac0, 5158, 1, 1, 5158 },
+  { 0x0fac1, 5159, 1, 1, 5159 },
+  { 0x0fac2, 5160, 1, 1, 5160 },
+  { 0x0fac3, 5161, 1, 1, 5161 },
+  { 0x0fac4, 5162, 1, 1, 5162 },
+  { 0x0fac5, 5163, 1, 1, 5163 },
+  { 0x0fac6, 5164, 1, 1, 5164 },
+  { 0x0fac7, 5165, 1, 1, 5165 },
+  { 0x0fac8, 5166, 1, 1, 5166 },
+  { 0x0fac9, 5167, 1, 1, 5167 },
+  { 0x0faca, 5168, 1, 1, 5168 },
+  { 0x0facb, 5169, 1, 1, 5169 },
+  { 0x0facc, 5170, 1, 1, 5170 },
+  { 0x0facd, 5171, 1, 1, 5171 },
+  { 0x0face, 5172, 1, 1, 5172 },
+  { 0x0facf, 5173, 1, 1, 5173 },
+  { 0x0fad0, 5174, 1, 1, 5174 },
+  { 0x0fad1, 5175, 1, 1, 5175 },
+  { 0x0fad2, 5176, 1, 1, 5176 },
+  { 0x0fad3, 5177, 1, 1, 5177 },
+  { 0x0fad4, 5178, 1, 1, 5178 },
+  { 0x0fad5, 5179, 1, 1, 5179 },
+  { 0x0fad6, 5180, 1, 1, 5180 },
+  { 0x0fad7, 5181, 1, 1, 5181 },
+  { 0x0fad8, 5182, 1, 1, 5182 },
+  { 0x0fad9, 5183, 1, 1, 5183 },
+  { 0x0fb00, 5184, 0, 2, 5184 },
+  { 0x0fb01, 5186, 0, 2, 5186 },
+  { 0x0fb02, 5188, 0, 2, 5188 },
+  { 0x0fb03, 5190, 0, 3, 5190 },
+  { 0x0fb04, 5193, 0, 3, 5193 },
+  { 0x0fb05, 5196, 0, 2, 5196 },
+  { 0x0fb06, 5198, 0, 2, 5198 },
+  { 0x0fb13, 5200, 0, 2, 5200 },
+  { 0x0fb14, 5202, 0, 2, 5202 },
+  { 0x0fb15, 5204, 0, 2, 5204 },
+  { 0x0fb16, 5206, 0, 2, 5206 },
+  { 0x0fb17, 5208, 0, 2, 5208 },
+  { 0x0fb1d, 5210, 2, 2, 5210 },
+  { 0x0fb1f, 5212, 2, 2, 5212 },
+  { 0x0fb20, 5214, 0, 1, 5214 },
+  { 0x0fb21, 5215, 0, 1, 5215 },
+  { 0x0fb22, 5216, 0, 1, 5216 },
+  { 0x0fb23, 5217, 0, 1, 5217 },
+  { 0x0fb24, 5218, 0, 1, 5218 },
+  { 0x0fb25, 5219, 0, 1, 5219 },
+  { 0x0fb26, 5220, 0, 1, 5220 },
+  { 0x0fb27, 5221, 0, 1, 5221 },
+  { 0x0fb28, 5222, 0, 1, 5222 },
+  { 0x0fb29, 5223, 0, 1, 5223 },
+  { 0x0fb2a, 5224, 2, 2, 5224 },
+  { 0x0fb2b, 5226, 2, 2, 5226 },
+  { 0x0fb2c, 5228, 3, 3, 5228 },
+  { 0x0fb2d, 5231, 3, 3, 5231 },
+  { 0x0fb2e, 5234, 2, 2, 5234 },
+  { 0x0fb2f, 5236, 2, 2, 5236 },
+  { 0x0fb30, 5238, 2, 2, 5238 },
+  { 0x0fb31, 5240, 2, 2, 5240 },
+  { 0x0fb32, 5242, 2, 2, 5242 },
+  { 0x0fb33, 5244, 2, 2, 5244 },
+  { 0x0fb34, 5246, 2, 2, 5246 },
+  { 0x0fb35, 5248, 2, 2, 5248 },
+  { 0x0fb36, 5250, 2, 2, 5250 },
+  { 0x0fb38, 5252, 2, 2, 5252 },
+  { 0x0fb39, 5254, 2, 2, 5254 },
+  { 0x0fb3a, 5256, 2, 2, 5256 },
+  { 0x0fb3b, 5258, 2, 2, 5258 },
+  { 0x0fb3c, 5260, 2, 2, 5260 },
+  { 0x0fb3e, 5262, 2, 2, 5262 },
+  { 0x0fb40, 5264, 2, 2, 5264 },
+  { 0x0fb41, 5266, 2, 2, 5266 },
+  { 0x0fb43, 5268, 2, 2, 5268 },
+  { 0x0fb44, 5270, 2, 2, 5270 },
+  { 0x0fb46, 5272, 2, 2, 5272 },
+  { 0x0fb47, 5274, 2, 2, 5274 },
+  { 0x0fb48, 5276, 2, 2, 5276 },
+  { 0x0fb49, 5278, 2, 2, 5278 },
+  { 0x0fb4a, 5280, 2, 2, 5280 },
+  { 0x0fb4b, 5282, 2, 2, 5282 },
+  { 0x0fb4c, 5284, 2, 2, 5284 },
+  { 0x0fb4d, 5286, 2, 2, 5286 },
+  { 0x0fb4e, 5288, 2, 2, 5288 },
+  { 0x0fb4f, 5290, 0, 2, 5290 },
+  { 0x0fb50, 5292, 0, 1, 5292 },
+  { 0x0fb51, 5293, 0, 1, 5293 },
+  { 0x0fb52, 5294, 0, 1, 5294 },
+  { 0x0fb53, 5295, 0, 1, 5295 },
+  { 0x0fb54, 5296, 0, 1, 5296 },
+  { 0x0fb55, 5297, 0, 1, 5297 },
+  { 0x0fb56, 5298, 0, 1, 5298 },
+  { 0x0fb57, 5299, 0, 1, 5299 },
+  { 0x0fb58, 5300, 0, 1, 5300 },
+  { 0x0fb59, 5301, 0, 1, 5301 },
+  { 0x0fb5a, 5302, 0, 1, 5302 },
+  { 0x0fb5b, 5303, 0, 1, 5303 },
+  { 0x0fb5c, 5304, 0, 1, 5304 },
+  { 0x0fb5d, 5305, 0, 1, 5305 },
+  { 0x0fb5e, 5306, 0, 1, 5306 },
+  { 0x0fb5f, 5307, 0, 1, 5307 },
+  { 0x0fb60, 5308, 0, 1, 5308 },
+  { 0x0fb61, 5309, 0, 1, 5309 },
+  { 0x0fb62, 5310, 0, 1, 5310 },
+  { 0x0fb63, 5311, 0, 1, 5311 },
+  { 0x0fb64, 5312, 0, 1, 5312 },
+  { 0x0fb65, 5313, 0, 1, 5313 },
+  { 0x0fb66, 5314, 0, 1, 5314 },
+  { 0x0fb67, 5315, 0, 1, 5315 },
+  { 0x0fb68, 5316, 0, 1, 5316 },
+  { 0x0fb69, 5317, 0, 1, 5317 },
+  { 0x0fb6a, 5318, 0, 1, 5318 },
+  { 0x0fb6b, 5319, 0, 1, 5319 },
+  { 0x0fb6c, 5320, 0, 1, 5320 },
+  { 0x0fb6d, 5321, 0, 1, 5321 },
+  { 0x0fb6e, 5322, 0, 1, 5322 },
+  { 0x0fb6f, 5323, 0, 1, 5323 },
+  { 0x0fb70, 5324, 0, 1, 5324 },
+  { 0x0fb71, 5325, 0, 1, 5325 },
+  { 0x0fb72, 5326, 0, 1, 5326 },
+  { 0x0fb73, 5327, 0, 1, 5327 },
+  { 0x0fb74, 5328, 0, 1, 5328 },
+  { 0x0fb75, 5329, 0, 1, 5329 },
+  { 0x0fb76, 5330, 0, 1, 5330 },
+  { 0x0fb77, 5331, 0, 1, 5331 },
+  { 0x0fb78, 5332, 0, 1, 5332 },
+  { 0x0fb79, 5333, 0, 1, 5333 },
+  { 0x0fb7a, 5334, 0, 1, 5334 },
+  { 0x0fb7b, 5335, 0, 1, 5335 },
+  { 0x0fb7c, 5336, 0, 1, 5336 },
+  { 0x0fb7d, 5337, 0, 1, 5337 },
+  { 0x0fb7e, 5338, 0, 1, 5338 },
+  { 0x0fb7f, 5339, 0, 1, 5339 },
+  { 0x0fb80, 5340, 0, 1, 5340 },
+  { 0x0fb81, 5341, 0, 1, 5341 },
+  { 0x0fb82, 5342, 0, 1, 5342 },
+  { 0x0fb83, 5343, 0, 1, 5343 },
+  { 0x0fb84, 5344, 0, 1, 5344 },
+  { 0x0fb85, 5345, 0, 1, 5345 },
+  { 0x0fb86, 5346, 0, 1, 5346 },
+  { 0x0fb87, 5347, 0, 1, 5347 },
+  { 0x0fb88, 5348, 0, 1, 5348 },
+  { 0x0fb89, 5349, 0, 1, 5349 },
+  { 0x0fb8a, 5350, 0, 1, 5350 },
+  { 0x0fb8b, 5351, 0, 1, 5351 },
+  { 0x0fb8c, 5352, 0, 1, 5352 },
+  { 0x0fb8d, 5353, 0, 1, 5353 },
+  { 0x0fb8e, 5354, 0, 1, 5354 },
+  { 0x0fb8f, 5355, 0, 1, 5355 },
+  { 0x0fb90, 5356, 0, 1, 5356 },
+  { 0x0fb91, 5357, 0, 1, 5357 },
+  { 0x0fb92, 5358, 0, 1, 5358 },
+  { 0x0fb93, 5359, 0, 1, 5359 },
+  { 0x0fb94, 5360, 0, 1, 5360 },
+  { 0x0fb95, 5361, 0, 1, 5361 },
+  { 0x0fb96, 5362, 0, 1, 5362 },
+  { 0x0fb97, 5363, 0, 1, 5363 },
+  { 0x0fb98, 5364, 0, 1, 5364 },
+  { 0x0fb99, 5365, 0, 1, 5365 },
+  { 0x0fb9a, 5366, 0, 1, 5366 },
+  { 0x0fb9b, 5367, 0, 1, 5367 },
+  { 0x0fb9c, 5368, 0, 1, 5368 },
+  { 0x0fb9d, 5369, 0, 1, 5369 },
+  { 0x0fb9e, 5370, 0, 1, 5370 },
+  { 0x0fb9f, 5371, 0, 1, 5371 },
+  { 0x0fba0, 5372, 0, 1, 5372 },
+  { 0x0fba1, 5373, 0, 1, 5373 },
+  { 0x0fba2, 5374, 0, 1, 5374 },
+  { 0x0fba3, 5375, 0, 1, 5375 },
+  { 0x0fba4, 5376, 0, 2, 5376 },
+  { 0x0fba5, 5378, 0, 2, 5378 },
+  { 0x0fba6, 5380, 0, 1, 5380 },
+  { 0x0fba7, 5381, 0, 1, 5381 },
+  { 0x0fba8, 5382, 0, 1, 5382 },
+  { 0x0fba9, 5383, 0, 1, 5383 },
+  { 0x0fbaa, 5384, 0, 1, 5384 },
+  { 0x0fbab, 5385, 0, 1, 5385 },
+  { 0x0fbac, 5386, 0, 1, 5386 },
+  { 0x0fbad, 5387, 0, 1, 5387 },
+  { 0x0fbae, 5388, 0, 1, 5388 },
+  { 0x0fbaf, 5389, 0, 1, 5389 },
+  { 0x0fbb0, 5390, 0, 2, 5390 },
+  { 0x0fbb1, 5392, 0, 2, 5392 },
+  { 0x0fbd3, 5394, 0, 1, 5394 },
+  { 0x0fbd4, 5395, 0, 1, 5395 },
+  { 0x0fbd5, 5396, 0, 1, 5396 },
+  { 0x0fbd6, 5397, 0, 1, 5397 },
+  { 0x0fbd7, 5398, 0, 1, 5398 },
+  { 0x0fbd8, 5399, 0, 1, 5399 },
+  { 0x0fbd9, 5400, 0, 1, 5400 },
+  { 0x0fbda, 5401, 0, 1, 5401 },
+  { 0x0fbdb, 5402, 0, 1, 5402 },
+  { 0x0fbdc, 5403, 0, 1, 5403 },
+  { 0x0fbdd, 5404, 0, 2, 5404 },
+  { 0x0fbde, 5406, 0, 1, 5406 },
+  { 0x0fbdf, 5407, 0, 1, 5407 },
+  { 0x0fbe0, 5408, 0, 1, 5408 },
+  { 0x0fbe1, 5409, 0, 1, 5409 },
+  { 0x0fbe2, 5410, 0, 1, 5410 },
+  { 0x0fbe3, 5411, 0, 1, 5411 },
+  { 0x0fbe4, 5412, 0, 1, 5412 },
+  { 0x0fbe5, 5413, 0, 1, 5413 },
+  { 0x0fbe6, 5414, 0, 1, 5414 },
+  { 0x0fbe7, 5415, 0, 1, 5415 },
+  { 0x0fbe8, 5416, 0, 1, 5416 },
+  { 0x0fbe9, 5417, 0, 1, 5417 },
+  { 0x0fbea, 5418, 0, 3, 5418 },
+  { 0x0fbeb, 5421, 0, 3, 5421 },
+  { 0x0fbec, 5424, 0, 3, 5424 },
+  { 0x0fbed, 5427, 0, 3, 5427 },
+  { 0x0fbee, 5430, 0, 3, 5430 },
+  { 0x0fbef, 5433, 0, 3, 5433 },
+  { 0x0fbf0, 5436, 0, 3, 5436 },
+  { 0x0fbf1, 5439, 0, 3, 5439 },
+  { 0x0fbf2, 5442, 0, 3, 5442 },
+  { 0x0fbf3, 5445, 0, 3, 5445 },
+  { 0x0fbf4, 5448, 0, 3, 5448 },
+  { 0x0fbf5, 5451, 0, 3, 5451 },
+  { 0x0fbf6, 5454, 0, 3, 5454 },
+  { 0x0fbf7, 5457, 0, 3, 5457 },
+  { 0x0fbf8, 5460, 0, 3, 5460 },
+  { 0x0fbf9, 5463, 0, 3, 5463 },
+  { 0x0fbfa, 5466, 0, 3, 5466 },
+  { 0x0fbfb, 5469, 0, 3, 5469 },
+  { 0x0fbfc, 5472, 0, 1, 5472 },
+  { 0x0fbfd, 5473, 0, 1, 5473 },
+  { 0x0fbfe, 5474, 0, 1, 5474 },
+  { 0x0fbff, 5475, 0, 1, 5475 },
+  { 0x0fc00, 5476, 0, 3, 5476 },
+  { 0x0fc01, 5479, 0, 3, 5479 },
+  { 0x0fc02, 5482, 0, 3, 5482 },
+  { 0x0fc03, 5485, 0, 3, 5485 },
+  { 0x0fc04, 5488, 0, 3, 5488 },
+  { 0x0fc05, 5491, 0, 2, 5491 },
+  { 0x0fc06, 5493, 0, 2, 5493 },
+  { 0x0fc07, 5495, 0, 2, 5495 },
+  { 0x0fc08, 5497, 0, 2, 5497 },
+  { 0x0fc09, 5499, 0, 2, 5499 },
+  { 0x0fc0a, 5501, 0, 2, 5501 },
+  { 0x0fc0b, 5503, 0, 2, 5503 },
+  { 0x0fc0c, 5505, 0, 2, 5505 },
+  { 0x0fc0d, 5507, 0, 2, 5507 },
+  { 0x0fc0e, 5509, 0, 2, 5509 },
+  { 0x0fc0f, 5511, 0, 2, 5511 },
+  { 0x0fc10, 5513, 0, 2, 5513 },
+  { 0x0fc11, 5515, 0, 2, 5515 },
+  { 0x0fc12, 5517, 0, 2, 5517 },
+  { 0x0fc13, 5519, 0, 2, 5519 },
+  { 0x0fc14, 5521, 0, 2, 5521 },
+  { 0x0fc15, 5523, 0, 2, 5523 },
+  { 0x0fc16, 5525, 0, 2, 5525 },
+  { 0x0fc17, 5527, 0, 2, 5527 },
+  { 0x0fc18, 5529, 0, 2, 5529 },
+  { 0x0fc19, 5531, 0, 2, 5531 },
+  { 0x0fc1a, 5533, 0, 2, 5533 },
+  { 0x0fc1b, 5535, 0, 2, 5535 },
+  { 0x0fc1c, 5537, 0, 2, 5537 },
+  { 0x0fc1d, 5539, 0, 2, 5539 },
+  { 0x0fc1e, 5541, 0, 2, 5541 },
+  { 0x0fc1f, 5543, 0, 2, 5543 },
+  { 0x0fc20, 5545, 0, 2, 5545 },
+  { 0x0fc21, 5547, 0, 2, 5547 },
+  { 0x0fc22, 5549, 0, 2, 5549 },
+  { 0x0fc23, 5551, 0, 2, 5551 },
+  { 0x0fc24, 5553, 0, 2, 5553 },
+  { 0x0fc25, 5555, 0, 2, 5555 },
+  { 0x0fc26, 5557, 0, 2, 5557 },
+  { 0x0fc27, 5559, 0, 2, 5559 },
+  { 0x0fc28, 5561, 0, 2, 5561 },
+  { 0x0fc29, 5563, 0, 2, 5563 },
+  { 0x0fc2a, 5565, 0, 2, 5565 },
+  { 0x0fc2b, 5567, 0, 2, 5567 },
+  { 0x0fc2c, 5569, 0, 2, 5569 },
+  { 0x0fc2d, 5571, 0, 2, 5571 },
+  { 0x0fc2e, 5573, 0, 2, 5573 },
+  { 0x0fc2f, 5575, 0, 2, 5575 },
+  { 0x0fc30, 5577, 0, 2, 5577 },
+  { 0x0fc31, 5579, 0, 2, 5579 },
+  { 0x0fc32, 5581, 0, 2, 5581 },
+  { 0x0fc33, 5583, 0, 2, 5583 },
+  { 0x0fc34, 5585, 0, 2, 5585 },
+  { 0x0fc35, 5587, 0, 2, 5587 },
+  { 0x0fc36, 5589, 0, 2, 5589 },
+  { 0x0fc37, 5591, 0, 2, 5591 },
+  { 0x0fc38, 5593, 0, 2, 5593 },
+  { 0x0fc39, 5595, 0, 2, 5595 },
+  { 0x0fc3a, 5597, 0, 2, 5597 },
+  { 0x0fc3b, 5599, 0, 2, 5599 },
+  { 0x0fc3c, 5601, 0, 2, 5601 },
+  { 0x0fc3d, 5603, 0, 2, 5603 },
+  { 0x0fc3e, 5605, 0, 2, 5605 },
+  { 0x0fc3f, 5607, 0, 2, 5607 },
+  { 0x0fc40, 5609, 0, 2, 5609 },
+  { 0x0fc41, 5611, 0, 2, 5611 },
+  { 0x0fc42, 5613, 0, 2, 5613 },
+  { 0x0fc43, 5615, 0, 2, 5615 },
+  { 0x0fc44, 5617, 0, 2, 5617 },
+  { 0x0fc45, 5619, 0, 2, 5619 },
+  { 0x0fc46, 5621, 0, 2, 5621 },
+  { 0x0fc47, 5623, 0, 2, 5623 },
+  { 0x0fc48, 5625, 0, 2, 5625 },
+  { 0x0fc49, 5627, 0, 2, 5627 },
+  { 0x0fc4a, 5629, 0, 2, 5629 },
+  { 0x0fc4b, 5631, 0, 2, 5631 },
+  { 0x0fc4c, 5633, 0, 2, 5633 },
+  { 0x0fc4d, 5635, 0, 2, 5635 },
+  { 0x0fc4e, 5637, 0, 2, 5637 },
+  { 0x0fc4f, 5639, 0, 2, 5639 },
+  { 0x0fc50, 5641, 0, 2, 5641 },
+  { 0x0fc51, 5643, 0, 2, 5643 },
+  { 0x0fc52, 5645, 0, 2, 5645 },
+  { 0x0fc53, 5647, 0, 2, 5647 },
+  { 0x0fc54, 5649, 0, 2, 5649 },
+  { 0x0fc55, 5651, 0, 2, 5651 },
+  { 0x0fc56, 5653, 0, 2, 5653 },
+  { 0x0fc57, 5655, 0, 2, 5655 },
+  { 0x0fc58, 5657, 0, 2, 5657 },
+  { 0x0fc59, 5659, 0, 2, 5659 },
+  { 0x0fc5a, 5661, 0, 2, 5661 },
+  { 0x0fc5b, 5663, 0, 2, 5663 },
+  { 0x0fc5c, 5665, 0, 2, 5665 },
+  { 0x0fc5d, 5667, 0, 2, 5667 },
+  { 0x0fc5e, 5669, 0, 3, 5669 },
+  { 0x0fc5f, 5672, 0, 3, 5672 },
+  { 0x0fc60, 5675, 0, 3, 5675 },
+  { 0x0fc61, 5678, 0, 3, 5678 },
+  { 0x0fc62, 5681, 0, 3, 5681 },
+  { 0x0fc63, 5684, 0, 3, 5684 },
+  { 0x0fc64, 5687, 0, 3, 5687 },
+  { 0x0fc65, 5690, 0, 3, 5690 },
+  { 0x0fc66, 5693, 0, 3, 5693 },
+  { 0x0fc67, 5696, 0, 3, 5696 },
+  { 0x0fc68, 5699, 0, 3, 5699 },
+  { 0x0fc69, 5702, 0, 3, 5702 },
+  { 0x0fc6a, 5705, 0, 2, 5705 },
+  { 0x0fc6b, 5707, 0, 2, 5707 },
+  { 0x0fc6c, 5709, 0, 2, 5709 },
+  { 0x0fc6d, 5711, 0, 2, 5711 },
+  { 0x0fc6e, 5713, 0, 2, 5713 },
+  { 0x0fc6f, 5715, 0, 2, 5715 },
+  { 0x0fc70, 5717, 0, 2, 5717 },
+  { 0x0fc71, 5719, 0, 2, 5719 },
+  { 0x0fc72, 5721, 0, 2, 5721 },
+  { 0x0fc73, 5723, 0, 2, 5723 },
+  { 0x0fc74, 5725, 0, 2, 5725 },
+  { 0x0fc75, 5727, 0, 2, 5727 },
+  { 0x0fc76, 5729, 0, 2, 5729 },
+  { 0x0fc77, 5731, 0, 2, 5731 },
+  { 0x0fc78, 5733, 0, 2, 5733 },
+  { 0x0fc79, 5735, 0, 2, 5735 },
+  { 0x0fc7a, 5737, 0, 2, 5737 },
+  { 0x0fc7b, 5739, 0, 2, 5739 },
+  { 0x0fc7c, 5741, 0, 2, 5741 },
+  { 0x0fc7d, 5743, 0, 2, 5743 },
+  { 0x0fc7e, 5745, 0, 2, 5745 },
+  { 0x0fc7f, 5747, 0, 2, 5747 },
+  { 0x0fc80, 5749, 0, 2, 5749 },
+  { 0x0fc81, 5751, 0, 2, 5751 },
+  { 0x0fc82, 5753, 0, 2, 5753 },
+  { 0x0fc83, 5755, 0, 2, 5755 },
+  { 0x0fc84, 5757, 0, 2, 5757 },
+  { 0x0fc85, 5759, 0, 2, 5759 },
+  { 0x0fc86, 5761, 0, 2, 5761 },
+  { 0x0fc87, 5763, 0, 2, 5763 },
+  { 0x0fc88, 5765, 0, 2, 5765 },
+  { 0x0fc89, 5767, 0, 2, 5767 },
+  { 0x0fc8a, 5769, 0, 2, 5769 },
+  { 0x0fc8b, 5771, 0, 2, 5771 },
+  { 0x0fc8c, 5773, 0, 2, 5773 },
+  { 0x0fc8d, 5775, 0, 2, 5775 },
+  { 0x0fc8e, 5777, 0, 2, 5777 },
+  { 0x0fc8f, 5779, 0, 2, 5779 },
+  { 0x0fc90, 5781, 0, 2, 5781 },
+  { 0x0fc91, 5783, 0, 2, 5783 },
+  { 0x0fc92, 5785, 0, 2, 5785 },
+  { 0x0fc93, 5787, 0, 2, 5787 },
+  { 0x0fc94, 5789, 0, 2, 5789 },
+  { 0x0fc95, 5791, 0, 2, 5791 },
+  { 0x0fc96, 5793, 0, 2, 5793 },
+  { 0x0fc97, 5795, 0, 3, 5795 },
+  { 0x0fc98, 5798, 0, 3, 5798 },
+  { 0x0fc99, 5801, 0, 3, 5801 },
+  { 0x0fc9a, 5804, 0, 3, 5804 },
+  { 0x0fc9b, 5807, 0, 3, 5807 },
+  { 0x0fc9c, 5810, 0, 2, 5810 },
+  { 0x0fc9d, 5812, 0, 2, 5812 },
+  { 0x0fc9e, 5814, 0, 2, 5814 },
+  { 0x0fc9f, 5816, 0, 2, 5816 },
+  { 0x0fca0, 5818, 0, 2, 5818 },
+  { 0x0fca1, 5820, 0, 2, 5820 },
+  { 0x0fca2, 5822, 0, 2, 5822 },
+  { 0x0fca3, 5824, 0, 2, 5824 },
+  { 0x0fca4, 5826, 0, 2, 5826 },
+  { 0x0fca5, 5828, 0, 2, 5828 },
+  { 0x0fca6, 5830, 0, 2, 5830 },
+  { 0x0fca7, 5832, 0, 2, 5832 },
+  { 0x0fca8, 5834, 0, 2, 5834 },
+  { 0x0fca9, 5836, 0, 2, 5836 },
+  { 0x0fcaa, 5838, 0, 2, 5838 },
+  { 0x0fcab, 5840, 0, 2, 5840 },
+  { 0x0fcac, 5842, 0, 2, 5842 },
+  { 0x0fcad, 5844, 0, 2, 5844 },
+  { 0x0fcae, 5846, 0, 2, 5846 },
+  { 0x0fcaf, 5848, 0, 2, 5848 },
+  { 0x0fcb0, 5850, 0, 2, 5850 },
+  { 0x0fcb1, 5852, 0, 2, 5852 },
+  { 0x0fcb2, 5854, 0, 2, 5854 },
+  { 0x0fcb3, 5856, 0, 2, 5856 },
+  { 0x0fcb4, 5858, 0, 2, 5858 },
+  { 0x0fcb5, 5860, 0, 2, 5860 },
+  { 0x0fcb6, 5862, 0, 2, 5862 },
+  { 0x0fcb7, 5864, 0, 2, 5864 },
+  { 0x0fcb8, 5866, 0, 2, 5866 },
+  { 0x0fcb9, 5868, 0, 2, 5868 },
+  { 0x0fcba, 5870, 0, 2, 5870 },
+  { 0x0fcbb, 5872, 0, 2, 5872 },
+  { 0x0fcbc, 5874, 0, 2, 5874 },
+  { 0x0fcbd, 5876, 0, 2, 5876 },
+  { 0x0fcbe, 5878, 0, 2, 5878 },
+  { 0x0fcbf, 5880, 0, 2, 5880 },
+  { 0x0fcc0, 5882, 0, 2, 5882 },
+  { 0x0fcc1, 5884, 0, 2, 5884 },
+  { 0x0fcc2, 5886, 0, 2, 5886 },
+  { 0x0fcc3, 5888, 0, 2, 5888 },
+  { 0x0fcc4, 5890, 0, 2, 5890 },
+  { 0x0fcc5, 5892, 0, 2, 5892 },
+  { 0x0fcc6, 5894, 0, 2, 5894 },
+  { 0x0fcc7, 5896, 0, 2, 5896 },
+  { 0x0fcc8, 5898, 0, 2, 5898 },
+  { 0x0fcc9, 5900, 0, 2, 5900 },
+  { 0x0fcca, 5902, 0, 2, 5902 },
+  { 0x0fccb, 5904, 0, 2, 5904 },
+  { 0x0fccc, 5906, 0, 2, 5906 },
+  { 0x0fccd, 5908, 0, 2, 5908 },
+  { 0x0fcce, 5910, 0, 2, 5910 },
+  { 0x0fccf, 5912, 0, 2, 5912 },
+  { 0x0fcd0, 5914, 0, 2, 5914 },
+  { 0x0fcd1, 5916, 0, 2, 5916 },
+  { 0x0fcd2, 5918, 0, 2, 5918 },
+  { 0x0fcd3, 5920, 0, 2, 5920 },
+  { 0x0fcd4, 5922, 0, 2, 5922 },
+  { 0x0fcd5, 5924, 0, 2, 5924 },
+  { 0x0fcd6, 5926, 0, 2, 5926 },
+  { 0x0fcd7, 5928, 0, 2, 5928 },
+  { 0x0fcd8, 5930, 0, 2, 5930 },
+  { 0x0fcd9, 5932, 0, 2, 5932 },
+  { 0x0fcda, 5934, 0, 2, 5934 },
+  { 0x0fcdb, 5936, 0, 2, 5936 },
+  { 0x0fcdc, 5938, 0, 2, 5938 },
+  { 0x0fcdd, 5940, 0, 2, 5940 },
+  { 0x0fcde, 5942, 0, 2, 5942 },
+  { 0x0fcdf, 5944, 0, 3, 5944 },
+  { 0x0fce0, 5947, 0, 3, 5947 },
+  { 0x0fce1, 5950, 0, 2, 5950 },
+  { 0x0fce2, 5952, 0, 2, 5952 },
+  { 0x0fce3, 5954, 0, 2, 5954 },
+  { 0x0fce4, 5956, 0, 2, 5956 },
+  { 0x0fce5, 5958, 0, 2, 5958 },
+  { 0x0fce6, 5960, 0, 2, 5960 },
+  { 0x0fce7, 5962, 0, 2, 5962 },
+  { 0x0fce8, 5964, 0, 2, 5964 },
+  { 0x0fce9, 5966, 0, 2, 5966 },
+  { 0x0fcea, 5968, 0, 2, 5968 },
+  { 0x0fceb, 5970, 0, 2, 5970 },
+  { 0x0fcec, 5972, 0, 2, 5972 },
+  { 0x0fced, 5974, 0, 2, 5974 },
+  { 0x0fcee, 5976, 0, 2, 5976 },
+  { 0x0fcef, 5978, 0, 2, 5978 },
+  { 0x0fcf0, 5980, 0, 2, 5980 },
+  { 0x0fcf1, 5982, 0, 2, 5982 },
+  { 0x0fcf2, 5984, 0, 3, 5984 },
+  { 0x0fcf3, 5987, 0, 3, 5987 },
+  { 0x0fcf4, 5990, 0, 3, 5990 },
+  { 0x0fcf5, 5993, 0, 2, 5993 },
+  { 0x0fcf6, 5995, 0, 2, 5995 },
+  { 0x0fcf7, 5997, 0, 2, 5997 },
+  { 0x0fcf8, 5999, 0, 2, 5999 },
+  { 0x0fcf9, 6001, 0, 2, 6001 },
+  { 0x0fcfa, 6003, 0, 2, 6003 },
+  { 0x0fcfb, 6005, 0, 2, 6005 },
+  { 0x0fcfc, 6007, 0, 2, 6007 },
+  { 0x0fcfd, 6009, 0, 2, 6009 },
+  { 0x0fcfe, 6011, 0, 2, 6011 },
+  { 0x0fcff, 6013, 0, 2, 6013 },
+  { 0x0fd00, 6015, 0, 2, 6015 },
+  { 0x0fd01, 6017, 0, 2, 6017 },
+  { 0x0fd02, 6019, 0, 2, 6019 },
+  { 0x0fd03, 6021, 0, 2, 6021 },
+  { 0x0fd04, 6023, 0, 2, 6023 },
+  { 0x0fd05, 6025, 0, 2, 6025 },
+  { 0x0fd06, 6027, 0, 2, 6027 },
+  { 0x0fd07, 6029, 0, 2, 6029 },
+  { 0x0fd08, 6031, 0, 2, 6031 },
+  { 0x0fd09, 6033, 0, 2, 6033 },
+  { 0x0fd0a, 6035, 0, 2, 6035 },
+  { 0x0fd0b, 6037, 0, 2, 6037 },
+  { 0x0fd0c, 6039, 0, 2, 6039 },
+  { 0x0fd0d, 6041, 0, 2, 6041 },
+  { 0x0fd0e, 6043, 0, 2, 6043 },
+  { 0x0fd0f, 6045, 0, 2, 6045 },
+  { 0x0fd10, 6047, 0, 2, 6047 },
+  { 0x0fd11, 6049, 0, 2, 6049 },
+  { 0x0fd12, 6051, 0, 2, 6051 },
+  { 0x0fd13, 6053, 0, 2, 6053 },
+  { 0x0fd14, 6055, 0, 2, 6055 },
+  { 0x0fd15, 6057, 0, 2, 6057 },
+  { 0x0fd16, 6059, 0, 2, 6059 },
+  { 0x0fd17, 6061, 0, 2, 6061 },
+  { 0x0fd18, 6063, 0, 2, 6063 },
+  { 0x0fd19, 6065, 0, 2, 6065 },
+  { 0x0fd1a, 6067, 0, 2, 6067 },
+  { 0x0fd1b, 6069, 0, 2, 6069 },
+  { 0x0fd1c, 6071, 0, 2, 6071 },
+  { 0x0fd1d, 6073, 0, 2, 6073 },
+  { 0x0fd1e, 6075, 0, 2, 6075 },
+  { 0x0fd1f, 6077, 0, 2, 6077 },
+  { 0x0fd20, 6079, 0, 2, 6079 },
+  { 0x0fd21, 6081, 0, 2, 6081 },
+  { 0x0fd22, 6083, 0, 2, 6083 },
+  { 0x0fd23, 6085, 0, 2, 6085 },
+  { 0x0fd24, 6087, 0, 2, 6087 },
+  { 0x0fd25, 6089, 0, 2, 6089 },
+  { 0x0fd26, 6091, 0, 2, 6091 },
+  { 0x0fd27, 6093, 0, 2, 6093 },
+  { 0x0fd28, 6095, 0, 2, 6095 },
+  { 0x0fd29, 6097, 0, 2, 6097 },
+  { 0x0fd2a, 6099, 0, 2, 6099 },
+  { 0x0fd2b, 6101, 0, 2, 6101 },
+  { 0x0fd2c, 6103, 0, 2, 6103 },
+  { 0x0fd2d, 6105, 0, 2, 6105 },
+  { 0x0fd2e, 6107, 0, 2, 6107 },
+  { 0x0fd2f, 6109, 0, 2, 6109 },
+  { 0x0fd30, 6111, 0, 2, 6111 },
+  { 0x0fd31, 6113, 0, 2, 6113 },
+  { 0x0fd32, 6115, 0, 2, 6115 },
+  { 0x0fd33, 6117, 0, 2, 6117 },
+  { 0x0fd34, 6119, 0, 2, 6119 },
+  { 0x0fd35, 6121, 0, 2, 6121 },
+  { 0x0fd36, 6123, 0, 2, 6123 },
+  { 0x0fd37, 6125, 0, 2, 6125 },
+  { 0x0fd38, 6127, 0, 2, 6127 },
+  { 0x0fd39, 6129, 0, 2, 6129 },
+  { 0x0fd3a, 6131, 0, 2, 6131 },
+  { 0x0fd3b, 6133, 0, 2, 6133 },
+  { 0x0fd3c, 6135, 0, 2, 6135 },
+  { 0x0fd3d, 6137, 0, 2, 6137 },
+  { 0x0fd50, 6139, 0, 3, 6139 },
+  { 0x0fd51, 6142, 0, 3, 6142 },
+  { 0x0fd52, 6145, 0, 3, 6145 },
+  { 0x0fd53, 6148, 0, 3, 6148 },
+  { 0x0fd54, 6151, 0, 3, 6151 },
+  { 0x0fd55, 6154, 0, 3, 6154 },
+  { 0x0fd56, 6157, 0, 3, 6157 },
+  { 0x0fd57, 6160, 0, 3, 6160 },
+  { 0x0fd58, 6163, 0, 3, 6163 },
+  { 0x0fd59, 6166, 0, 3, 6166 },
+  { 0x0fd5a, 6169, 0, 3, 6169 },
+  { 0x0fd5b, 6172, 0, 3, 6172 },
+  { 0x0fd5c, 6175, 0, 3, 6175 },
+  { 0x0fd5d, 6178, 0, 3, 6178 },
+  { 0x0fd5e, 6181, 0, 3, 6181 },
+  { 0x0fd5f, 6184, 0, 3, 6184 },
+  { 0x0fd60, 6187, 0, 3, 6187 },
+  { 0x0fd61, 6190, 0, 3, 6190 },
+  { 0x0fd62, 6193, 0, 3, 6193 },
+  { 0x0fd63, 6196, 0, 3, 6196 },
+  { 0x0fd64, 6199, 0, 3, 6199 },
+  { 0x0fd65, 6202, 0, 3, 6202 },
+  { 0x0fd66, 6205, 0, 3, 6205 },
+  { 0x0fd67, 6208, 0, 3, 6208 },
+  { 0x0fd68, 6211, 0, 3, 6211 },
+  { 0x0fd69, 6214, 0, 3, 6214 },
+  { 0x0fd6a, 6217, 0, 3, 6217 },
+  { 0x0fd6b, 6220, 0, 3, 6220 },
+  { 0x0fd6c, 6223, 0, 3, 6223 },
+  { 0x0fd6d, 6226, 0, 3, 6226 },
+  { 0x0fd6e, 6229, 0, 3, 6229 },
+  { 0x0fd6f, 6232, 0, 3, 6232 },
+  { 0x0fd70, 6235, 0, 3, 6235 },
+  { 0x0fd71, 6238, 0, 3, 6238 },
+  { 0x0fd72, 6241, 0, 3, 6241 },
+  { 0x0fd73, 6244, 0, 3, 6244 },
+  { 0x0fd74, 6247, 0, 3, 6247 },
+  { 0x0fd75, 6250, 0, 3, 6250 },
+  { 0x0fd76, 6253, 0, 3, 6253 },
+  { 0x0fd77, 6256, 0, 3, 6256 },
+  { 0x0fd78, 6259, 0, 3, 6259 },
+  { 0x0fd79, 6262, 0, 3, 6262 },
+  { 0x0fd7a, 6265, 0, 3, 6265 },
+  { 0x0fd7b, 6268, 0, 3, 6268 },
+  { 0x0fd7c, 6271, 0, 3, 6271 },
+  { 0x0fd7d, 6274, 0, 3, 6274 },
+  { 0x0fd7e, 6277, 0, 3, 6277 },
+  { 0x0fd7f, 6280, 0, 3, 6280 },
+  { 0x0fd80, 6283, 0, 3, 6283 },
+  { 0x0fd81, 6286, 0, 3, 6286 },
+  { 0x0fd82, 6289, 0, 3, 6289 },
+  { 0x0fd83, 6292, 0, 3, 6292 },
+  { 0x0fd84, 6295, 0, 3, 6295 },
+  { 0x0fd85, 6298, 0, 3, 6298 },
+  { 0x0fd86, 6301, 0, 3, 6301 },
+  { 0x0fd87, 6304, 0, 3, 6304 },
+  { 0x0fd88, 6307, 0, 3, 6307 },
+  { 0x0fd89, 6310, 0, 3, 6310 },
+  { 0x0fd8a, 6313, 0, 3, 6313 },
+  { 0x0fd8b, 6316, 0, 3, 6316 },
+  { 0x0fd8c, 6319, 0, 3, 6319 },
+  { 0x0fd8d, 6322, 0, 3, 6322 },
+  { 0x0fd8e, 6325, 0, 3, 6325 },
+  { 0x0fd8f, 6328, 0, 3, 6328 },
+  { 0x0fd92, 6331, 0, 3, 6331 },
+  { 0x0fd93, 6334, 0, 3, 6334 },
+  { 0x0fd94, 6337, 0, 3, 6337 },
+  { 0x0fd95, 6340, 0, 3, 6340 },
+  { 0x0fd96, 6343, 0, 3, 6343 },
+  { 0x0fd97, 6346, 0, 3, 6346 },
+  { 0x0fd98, 6349, 0, 3, 6349 },
+  { 0x0fd99, 6352, 0, 3, 6352 },
+  { 0x0fd9a, 6355, 0, 3, 6355 },
+  { 0x0fd9b, 6358, 0, 3, 6358 },
+  { 0x0fd9c, 6361, 0, 3, 6361 },
+  { 0x0fd9d, 6364, 0, 3, 6364 },
+  { 0x0fd9e, 6367, 0, 3, 6367 },
+  { 0x0fd9f, 6370, 0, 3, 6370 },
+  { 0x0fda0, 6373, 0, 3, 6373 },
+  { 0x0fda1, 6376, 0, 3, 6376 },
+  { 0x0fda2, 6379, 0, 3, 6379 },
+  { 0x0fda3, 6382, 0, 3, 6382 },
+  { 0x0fda4, 6385, 0, 3, 6385 },
+  { 0x0fda5, 6388, 0, 3, 6388 },
+  { 0x0fda6, 6391, 0, 3, 6391 },
+  { 0x0fda7, 6394, 0, 3, 6394 },
+  { 0x0fda8, 6397, 0, 3, 6397 },
+  { 0x0fda9, 6400, 0, 3, 6400 },
+  { 0x0fdaa, 6403, 0, 3, 6403 },
+  { 0x0fdab, 6406, 0, 3, 6406 },
+  { 0x0fdac, 6409, 0, 3, 6409 },
+  { 0x0fdad, 6412, 0, 3, 6412 },
+  { 0x0fdae, 6415, 0, 3, 6415 },
+  { 0x0fdaf, 6418, 0, 3, 6418 },
+  { 0x0fdb0, 6421, 0, 3, 6421 },
+  { 0x0fdb1, 6424, 0, 3, 6424 },
+  { 0x0fdb2, 6427, 0, 3, 6427 },
+  { 0x0fdb3, 6430, 0, 3, 6430 },
+  { 0x0fdb4, 6433, 0, 3, 6433 },
+  { 0x0fdb5, 6436, 0, 3, 6436 },
+  { 0x0fdb6, 6439, 0, 3, 6439 },
+  { 0x0fdb7, 6442, 0, 3, 6442 },
+  { 0x0fdb8, 6445, 0, 3, 6445 },
+  { 0x0fdb9, 6448, 0, 3, 6448 },
+  { 0x0fdba, 6451, 0, 3, 6451 },
+  { 0x0fdbb, 6454, 0, 3, 6454 },
+  { 0x0fdbc, 6457, 0, 3, 6457 },
+  { 0x0fdbd, 6460, 0, 3, 6460 },
+  { 0x0fdbe, 6463, 0, 3, 6463 },
+  { 0x0fdbf, 6466, 0, 3, 6466 },
+  { 0x0fdc0, 6469, 0, 3, 6469 },
+  { 0x0fdc1, 6472, 0, 3, 6472 },
+  { 0x0fdc2, 6475, 0, 3, 6475 },
+  { 0x0fdc3, 6478, 0, 3, 6478 },
+  { 0x0fdc4, 6481, 0, 3, 6481 },
+  { 0x0fdc5, 6484, 0, 3, 6484 },
+  { 0x0fdc6, 6487, 0, 3, 6487 },
+  { 0x0fdc7, 6490, 0, 3, 6490 },
+  { 0x0fdf0, 6493, 0, 3, 6493 },
+  { 0x0fdf1, 6496, 0, 3, 6496 },
+  { 0x0fdf2, 6499, 0, 4, 6499 },
+  { 0x0fdf3, 6503, 0, 4, 6503 },
+  { 0x0fdf4, 6507, 0, 4, 6507 },
+  { 0x0fdf5, 6511, 0, 4, 6511 },
+  { 0x0fdf6, 6515, 0, 4, 6515 },
+  { 0x0fdf7, 6519, 0, 4, 6519 },
+  { 0x0fdf8, 6523, 0, 4, 6523 },
+  { 0x0fdf9, 6527, 0, 3, 6527 },
+  { 0x0fdfa, 6530, 0, 18, 6530 },
+  { 0x0fdfb, 6548, 0, 8, 6548 },
+  { 0x0fdfc, 6556, 0, 4, 6556 },
+  { 0x0fe10, 6560, 0, 1, 6560 },
+  { 0x0fe11, 6561, 0, 1, 6561 },
+  { 0x0fe12, 6562, 0, 1, 6562 },
+  { 0x0fe13, 6563, 0, 1, 6563 },
+  { 0x0fe14, 6564, 0, 1, 6564 },
+  { 0x0fe15, 6565, 0, 1, 6565 },
+  { 0x0fe16, 6566, 0, 1, 6566 },
+  { 0x0fe17, 6567, 0, 1, 6567 },
+  { 0x0fe18, 6568, 0, 1, 6568 },
+  { 0x0fe19, 6569, 0, 3, 6569 },
+  { 0x0fe30, 6572, 0, 2, 6572 },
+  { 0x0fe31, 6574, 0, 1, 6574 },
+  { 0x0fe32, 6575, 0, 1, 6575 },
+  { 0x0fe33, 6576, 0, 1, 6576 },
+  { 0x0fe34, 6577, 0, 1, 6577 },
+  { 0x0fe35, 6578, 0, 1, 6578 },
+  { 0x0fe36, 6579, 0, 1, 6579 },
+  { 0x0fe37, 6580, 0, 1, 6580 },
+  { 0x0fe38, 6581, 0, 1, 6581 },
+  { 0x0fe39, 6582, 0, 1, 6582 },
+  { 0x0fe3a, 6583, 0, 1, 6583 },
+  { 0x0fe3b, 6584, 0, 1, 6584 },
+  { 0x0fe3c, 6585, 0, 1, 6585 },
+  { 0x0fe3d, 6586, 0, 1, 6586 },
+  { 0x0fe3e, 6587, 0, 1, 6587 },
+  { 0x0fe3f, 6588, 0, 1, 6588 },
+  { 0x0fe40, 6589, 0, 1, 6589 },
+  { 0x0fe41, 6590, 0, 1, 6590 },
+  { 0x0fe42, 6591, 0, 1, 6591 },
+  { 0x0fe43, 6592, 0, 1, 6592 },
+  { 0x0fe44, 6593, 0, 1, 6593 },
+  { 0x0fe47, 6594, 0, 1, 6594 },
+  { 0x0fe48, 6595, 0, 1, 6595 },
+  { 0x0fe49, 6596, 0, 2, 6596 },
+  { 0x0fe4a, 6598, 0, 2, 6598 },
+  { 0x0fe4b, 6600, 0, 2, 6600 },
+  { 0x0fe4c, 6602, 0, 2, 6602 },
+  { 0x0fe4d, 6604, 0, 1, 6604 },
+  { 0x0fe4e, 6605, 0, 1, 6605 },
+  { 0x0fe4f, 6606, 0, 1, 6606 },
+  { 0x0fe50, 6607, 0, 1, 6607 },
+  { 0x0fe51, 6608, 0, 1, 6608 },
+  { 0x0fe52, 6609, 0, 1, 6609 },
+  { 0x0fe54, 6610, 0, 1, 6610 },
+  { 0x0fe55, 6611, 0, 1, 6611 },
+  { 0x0fe56, 6612, 0, 1, 6612 },
+  { 0x0fe57, 6613, 0, 1, 6613 },
+  { 0x0fe58, 6614, 0, 1, 6614 },
+  { 0x0fe59, 6615, 0, 1, 6615 },
+  { 0x0fe5a, 6616, 0, 1, 6616 },
+  { 0x0fe5b, 6617, 0, 1, 6617 },
+  { 0x0fe5c, 6618, 0, 1, 6618 },
+  { 0x0fe5d, 6619, 0, 1, 6619 },
+  { 0x0fe5e, 6620, 0, 1, 6620 },
+  { 0x0fe5f, 6621, 0, 1, 6621 },
+  { 0x0fe60, 6622, 0, 1, 6622 },
+  { 0x0fe61, 6623, 0, 1, 6623 },
+  { 0x0fe62, 6624, 0, 1, 6624 },
+  { 0x0fe63, 6625, 0, 1, 6625 },
+  { 0x0fe64, 6626, 0, 1, 6626 },
+  { 0x0fe65, 6627, 0, 1, 6627 },
+  { 0x0fe66, 6628, 0, 1, 6628 },
+  { 0x0fe68, 6629, 0, 1, 6629 },
+  { 0x0fe69, 6630, 0, 1, 6630 },
+  { 0x0fe6a, 6631, 0, 1, 6631 },
+  { 0x0fe6b, 6632, 0, 1, 6632 },
+  { 0x0fe70, 6633, 0, 2, 6633 },
+  { 0x0fe71, 6635, 0, 2, 6635 },
+  { 0x0fe72, 6637, 0, 2, 6637 },
+  { 0x0fe74, 6639, 0, 2, 6639 },
+  { 0x0fe76, 6641, 0, 2, 6641 },
+  { 0x0fe77, 6643, 0, 2, 6643 },
+  { 0x0fe78, 6645, 0, 2, 6645 },
+  { 0x0fe79, 6647, 0, 2, 6647 },
+  { 0x0fe7a, 6649, 0, 2, 6649 },
+  { 0x0fe7b, 6651, 0, 2, 6651 },
+  { 0x0fe7c, 6653, 0, 2, 6653 },
+  { 0x0fe7d, 6655, 0, 2, 6655 },
+  { 0x0fe7e, 6657, 0, 2, 6657 },
+  { 0x0fe7f, 6659, 0, 2, 6659 },
+  { 0x0fe80, 6661, 0, 1, 6661 },
+  { 0x0fe81, 6662, 0, 2, 6662 },
+  { 0x0fe82, 6664, 0, 2, 6664 },
+  { 0x0fe83, 6666, 0, 2, 6666 },
+  { 0x0fe84, 6668, 0, 2, 6668 },
+  { 0x0fe85, 6670, 0, 2, 6670 },
+  { 0x0fe86, 6672, 0, 2, 6672 },
+  { 0x0fe87, 6674, 0, 2, 6674 },
+  { 0x0fe88, 6676, 0, 2, 6676 },
+  { 0x0fe89, 6678, 0, 2, 6678 },
+  { 0x0fe8a, 6680, 0, 2, 6680 },
+  { 0x0fe8b, 6682, 0, 2, 6682 },
+  { 0x0fe8c, 6684, 0, 2, 6684 },
+  { 0x0fe8d, 6686, 0, 1, 6686 },
+  { 0x0fe8e, 6687, 0, 1, 6687 },
+  { 0x0fe8f, 6688, 0, 1, 6688 },
+  { 0x0fe90, 6689, 0, 1, 6689 },
+  { 0x0fe91, 6690, 0, 1, 6690 },
+  { 0x0fe92, 6691, 0, 1, 6691 },
+  { 0x0fe93, 6692, 0, 1, 6692 },
+  { 0x0fe94, 6693, 0, 1, 6693 },
+  { 0x0fe95, 6694, 0, 1, 6694 },
+  { 0x0fe96, 6695, 0, 1, 6695 },
+  { 0x0fe97, 6696, 0, 1, 6696 },
+  { 0x0fe98, 6697, 0, 1, 6697 },
+  { 0x0fe99, 6698, 0, 1, 6698 },
+  { 0x0fe9a, 6699, 0, 1, 6699 },
+  { 0x0fe9b, 6700, 0, 1, 6700 },
+  { 0x0fe9c, 6701, 0, 1, 6701 },
+  { 0x0fe9d, 6702, 0, 1, 6702 },
+  { 0x0fe9e, 6703, 0, 1, 6703 },
+  { 0x0fe9f, 6704, 0, 1, 6704 },
+  { 0x0fea0, 6705, 0, 1, 6705 },
+  { 0x0fea1, 6706, 0, 1, 6706 },
+  { 0x0fea2, 6707, 0, 1, 6707 },
+  { 0x0fea3, 6708, 0, 1, 6708 },
+  { 0x0fea4, 6709, 0, 1, 6709 },
+  { 0x0fea5, 6710, 0, 1, 6710 },
+  { 0x0fea6, 6711, 0, 1, 6711 },
+  { 0x0fea7, 6712, 0, 1, 6712 },
+  { 0x0fea8, 6713, 0, 1, 6713 },
+  { 0x0fea9, 6714, 0, 1, 6714 },
+  { 0x0feaa, 6715, 0, 1, 6715 },
+  { 0x0feab, 6716, 0, 1, 6716 },
+  { 0x0feac, 6717, 0, 1, 6717 },
+  { 0x0fead, 6718, 0, 1, 6718 },
+  { 0x0feae, 6719, 0, 1, 6719 },
+  { 0x0feaf, 6720, 0, 1, 6720 },
+  { 0x0feb0, 6721, 0, 1, 6721 },
+  { 0x0feb1, 6722, 0, 1, 6722 },
+  { 0x0feb2, 6723, 0, 1, 6723 },
+  { 0x0feb3, 6724, 0, 1, 6724 },
+  { 0x0feb4, 6725, 0, 1, 6725 },
+  { 0x0feb5, 6726, 0, 1, 6726 },
+  { 0x0feb6, 6727, 0, 1, 6727 },
+  { 0x0feb7, 6728, 0, 1, 6728 },
+  { 0x0feb8, 6729, 0, 1, 6729 },
+  { 0x0feb9, 6730, 0, 1, 6730 },
+  { 0x0feba, 6731, 0, 1, 6731 },
+  { 0x0febb, 6732, 0, 1, 6732 },
+  { 0x0febc, 6733, 0, 1, 6733 },
+  { 0x0febd, 6734, 0, 1, 6734 },
+  { 0x0febe, 6735, 0, 1, 6735 },
+  { 0x0febf, 6736, 0, 1, 6736 },
+  { 0x0fec0, 6737, 0, 1, 6737 },
+  { 0x0fec1, 6738, 0, 1, 6738 },
+  { 0x0fec2, 6739, 0, 1, 6739 },
+  { 0x0fec3, 6740, 0, 1, 6740 },
+  { 0x0fec4, 6741, 0, 1, 6741 },
+  { 0x0fec5, 6742, 0, 1, 6742 },
+  { 0x0fec6, 6743, 0, 1, 6743 },
+  { 0x0fec7, 6744, 0, 1, 6744 },
+  { 0x0fec8, 6745, 0, 1, 6745 },
+  { 0x0fec9, 6746, 0, 1, 6746 },
+  { 0x0feca, 6747, 0, 1, 6747 },
+  { 0x0fecb, 6748, 0, 1, 6748 },
+  { 0x0fecc, 6749, 0, 1, 6749 },
+  { 0x0fecd, 6750, 0, 1, 6750 },
+  { 0x0fece, 6751, 0, 1, 6751 },
+  { 0x0fecf, 6752, 0, 1, 6752 },
+  { 0x0fed0, 6753, 0, 1, 6753 },
+  { 0x0fed1, 6754, 0, 1, 6754 },
+  { 0x0fed2, 6755, 0, 1, 6755 },
+  { 0x0fed3, 6756, 0, 1, 6756 },
+  { 0x0fed4, 6757, 0, 1, 6757 },
+  { 0x0fed5, 6758, 0, 1, 6758 },
+  { 0x0fed6, 6759, 0, 1, 6759 },
+  { 0x0fed7, 6760, 0, 1, 6760 },
+  { 0x0fed8, 6761, 0, 1, 6761 },
+  { 0x0fed9, 6762, 0, 1, 6762 },
+  { 0x0feda, 6763, 0, 1, 6763 },
+  { 0x0fedb, 6764, 0, 1, 6764 },
+  { 0x0fedc, 6765, 0, 1, 6765 },
+  { 0x0fedd, 6766, 0, 1, 6766 },
+  { 0x0fede, 6767, 0, 1, 6767 },
+  { 0x0fedf, 6768, 0, 1, 6768 },
+  { 0x0fee0, 6769, 0, 1, 6769 },
+  { 0x0fee1, 6770, 0, 1, 6770 },
+  { 0x0fee2, 6771, 0, 1, 6771 },
+  { 0x0fee3, 6772, 0, 1, 6772 },
+  { 0x0fee4, 6773, 0, 1, 6773 },
+  { 0x0fee5, 6774, 0, 1, 6774 },
+  { 0x0fee6, 6775, 0, 1, 6775 },
+  { 0x0fee7, 6776, 0, 1, 6776 },
+  { 0x0fee8, 6777, 0, 1, 6777 },
+  { 0x0fee9, 6778, 0, 1, 6778 },
+  { 0x0feea, 6779, 0, 1, 6779 },
+  { 0x0feeb, 6780, 0, 1, 6780 },
+  { 0x0feec, 6781, 0, 1, 6781 },
+  { 0x0feed, 6782, 0, 1, 6782 },
+  { 0x0feee, 6783, 0, 1, 6783 },
+  { 0x0feef, 6784, 0, 1, 6784 },
+  { 0x0fef0, 6785, 0, 1, 6785 },
+  { 0x0fef1, 6786, 0, 1, 6786 },
+  { 0x0fef2, 6787, 0, 1, 6787 },
+  { 0x0fef3, 6788, 0, 1, 6788 },
+  { 0x0fef4, 6789, 0, 1, 6789 },
+  { 0x0fef5, 6790, 0, 3, 6790 },
+  { 0x0fef6, 6793, 0, 3, 6793 },
+  { 0x0fef7, 6796, 0, 3, 6796 },
+  { 0x0fef8, 6799, 0, 3, 6799 },
+  { 0x0fef9, 6802, 0, 3, 6802 },
+  { 0x0fefa, 6805, 0, 3, 6805 },
+  { 0x0fefb, 6808, 0, 2, 6808 },
+  { 0x0fefc, 6810, 0, 2, 6810 },
+  { 0x0ff01, 6812, 0, 1, 6812 },
+  { 0x0ff02, 6813, 0, 1, 6813 },
+  { 0x0ff03, 6814, 0, 1, 6814 },
+  { 0x0ff04, 6815, 0, 1, 6815 },
+  { 0x0ff05, 6816, 0, 1, 6816 },
+  { 0x0ff06, 6817, 0, 1, 6817 },
+  { 0x0ff07, 6818, 0, 1, 6818 },
+  { 0x0ff08, 6819, 0, 1, 6819 },
+  { 0x0ff09, 6820, 0, 1, 6820 },
+  { 0x0ff0a, 6821, 0, 1, 6821 },
+  { 0x0ff0b, 6822, 0, 1, 6822 },
+  { 0x0ff0c, 6823, 0, 1, 6823 },
+  { 0x0ff0d, 6824, 0, 1, 6824 },
+  { 0x0ff0e, 6825, 0, 1, 6825 },
+  { 0x0ff0f, 6826, 0, 1, 6826 },
+  { 0x0ff10, 6827, 0, 1, 6827 },
+  { 0x0ff11, 6828, 0, 1, 6828 },
+  { 0x0ff12, 6829, 0, 1, 6829 },
+  { 0x0ff13, 6830, 0, 1, 6830 },
+  { 0x0ff14, 6831, 0, 1, 6831 },
+  { 0x0ff15, 6832, 0, 1, 6832 },
+  { 0x0ff16, 6833, 0, 1, 6833 },
+  { 0x0ff17, 6834, 0, 1, 6834 },
+  { 0x0ff18, 6835, 0, 1, 6835 },
+  { 0x0ff19, 6836, 0, 1, 6836 },
+  { 0x0ff1a, 6837, 0, 1, 6837 },
+  { 0x0ff1b, 6838, 0, 1, 6838 },
+  { 0x0ff1c, 6839, 0, 1, 6839 },
+  { 0x0ff1d, 6840, 0, 1, 6840 },
+  { 0x0ff1e, 6841, 0, 1, 6841 },
+  { 0x0ff1f, 6842, 0, 1, 6842 },
+  { 0x0ff20, 6843, 0, 1, 6843 },
+  { 0x0ff21, 6844, 0, 1, 6844 },
+  { 0x0ff22, 6845, 0, 1, 6845 },
+  { 0x0ff23, 6846, 0, 1, 6846 },
+  { 0x0ff24, 6847, 0, 1, 6847 },
+  { 0x0ff25, 6848, 0, 1, 6848 },
+  { 0x0ff26, 6849, 0, 1, 6849 },
+  { 0x0ff27, 6850, 0, 1, 6850 },
+  { 0x0ff28, 6851, 0, 1, 6851 },
+  { 0x0ff29, 6852, 0, 1, 6852 },
+  { 0x0ff2a, 6853, 0, 1, 6853 },
+  { 0x0ff2b, 6854, 0, 1, 6854 },
+  { 0x0ff2c, 6855, 0, 1, 6855 },
+  { 0x0ff2d, 6856, 0, 1, 6856 },
+  { 0x0ff2e, 6857, 0, 1, 6857 },
+  { 0x0ff2f, 6858, 0, 1, 6858 },
+  { 0x0ff30, 6859, 0, 1, 6859 },
+  { 0x0ff31, 6860, 0, 1, 6860 },
+  { 0x0ff32, 6861, 0, 1, 6861 },
+  { 0x0ff33, 6862, 0, 1, 6862 },
+  { 0x0ff34, 6863, 0, 1, 6863 },
+  { 0x0ff35, 6864, 0, 1, 6864 },
+  { 0x0ff36, 6865, 0, 1, 6865 },
+  { 0x0ff37, 6866, 0, 1, 6866 },
+  { 0x0ff38, 6867, 0, 1, 6867 },
+  { 0x0ff39, 6868, 0, 1, 6868 },
+  { 0x0ff3a, 6869, 0, 1, 6869 },
+  { 0x0ff3b, 6870, 0, 1, 6870 },
+  { 0x0ff3c, 6871, 0, 1, 6871 },
+  { 0x0ff3d, 6872, 0, 1, 6872 },
+  { 0x0ff3e, 6873, 0, 1, 6873 },
+  { 0x0ff3f, 6874, 0, 1, 6874 },
+  { 0x0ff40, 6875, 0, 1, 6875 },
+  { 0x0ff41, 6876, 0, 1, 6876 },
+  { 0x0ff42, 6877, 0, 1, 6877 },
+  { 0x0ff43, 6878, 0, 1, 6878 },
+  { 0x0ff44, 6879, 0, 1, 6879 },
+  { 0x0ff45, 6880, 0, 1, 6880 },
+  { 0x0ff46, 6881, 0, 1, 6881 },
+  { 0x0ff47, 6882, 0, 1, 6882 },
+  { 0x0ff48, 6883, 0, 1, 6883 },
+  { 0x0ff49, 6884, 0, 1, 6884 },
+  { 0x0ff4a, 6885, 0, 1, 6885 },
+  { 0x0ff4b, 6886, 0, 1, 6886 },
+  { 0x0ff4c, 6887, 0, 1, 6887 },
+  { 0x0ff4d, 6888, 0, 1, 6888 },
+  { 0x0ff4e, 6889, 0, 1, 6889 },
+  { 0x0ff4f, 6890, 0, 1, 6890 },
+  { 0x0ff50, 6891, 0, 1, 6891 },
+  { 0x0ff51, 6892, 0, 1, 6892 },
+  { 0x0ff52, 6893, 0, 1, 6893 },
+  { 0x0ff53, 6894, 0, 1, 6894 },
+  { 0x0ff54, 6895, 0, 1, 6895 },
+  { 0x0ff55, 6896, 0, 1, 6896 },
+  { 0x0ff56, 6897, 0, 1, 6897 },
+  { 0x0ff57, 6898, 0, 1, 6898 },
+  { 0x0ff58, 6899, 0, 1, 6899 },
+  { 0x0ff59, 6900, 0, 1, 6900 },
+  { 0x0ff5a, 6901, 0, 1, 6901 },
+  { 0x0ff5b, 6902, 0, 1, 6902 },
+  { 0x0ff5c, 6903, 0, 1, 6903 },
+  { 0x0ff5d, 6904, 0, 1, 6904 },
+  { 0x0ff5e, 6905, 0, 1, 6905 },
+  { 0x0ff5f, 6906, 0, 1, 6906 },
+  { 0x0ff60, 6907, 0, 1, 6907 },
+  { 0x0ff61, 6908, 0, 1, 6908 },
+  { 0x0ff62, 6909, 0, 1, 6909 },
+  { 0x0ff63, 6910, 0, 1, 6910 },
+  { 0x0ff64, 6911, 0, 1, 6911 },
+  { 0x0ff65, 6912, 0, 1, 6912 },
+  { 0x0ff66, 6913, 0, 1, 6913 },
+  { 0x0ff67, 6914, 0, 1, 6914 },
+  { 0x0ff68, 6915, 0, 1, 6915 },
+  { 0x0ff69, 6916, 0, 1, 6916 },
+  { 0x0ff6a, 6917, 0, 1, 6917 },
+  { 0x0ff6b, 6918, 0, 1, 6918 },
+  { 0x0ff6c, 6919, 0, 1, 6919 },
+  { 0x0ff6d, 6920, 0, 1, 6920 },
+  { 0x0ff6e, 6921, 0, 1, 6921 },
+  { 0x0ff6f, 6922, 0, 1, 6922 },
+  { 0x0ff70, 6923, 0, 1, 6923 },
+  { 0x0ff71, 6924, 0, 1, 6924 },
+  { 0x0ff72, 6925, 0, 1, 6925 },
+  { 0x0ff73, 6926, 0, 1, 6926 },
+  { 0x0ff74, 6927, 0, 1, 6927 },
+  { 0x0ff75, 6928, 0, 1, 6928 },
+  { 0x0ff76, 6929, 0, 1, 6929 },
+  { 0x0ff77, 6930, 0, 1, 6930 },
+  { 0x0ff78, 6931, 0, 1, 6931 },
+  { 0x0ff79, 6932, 0, 1, 6932 },
+  { 0x0ff7a, 6933, 0, 1, 6933 },
+  { 0x0ff7b, 6934, 0, 1, 6934 },
+  { 0x0ff7c, 6935, 0, 1, 6935 },
+  { 0x0ff7d, 6936, 0, 1, 6936 },
+  { 0x0ff7e, 6937, 0, 1, 6937 },
+  { 0x0ff7f, 6938, 0, 1, 6938 },
+  { 0x0ff80, 6939, 0, 1, 6939 },
+  { 0x0ff81, 6940, 0, 1, 6940 },
+  { 0x0ff82, 6941, 0, 1, 6941 },
+  { 0x0ff83, 6942, 0, 1, 6942 },
+  { 0x0ff84, 6943, 0, 1, 6943 },
+  { 0x0ff85, 6944, 0, 1, 6944 },
+  { 0x0ff86, 6945, 0, 1, 6945 },
+  { 0x0ff87, 6946, 0, 1, 6946 },
+  { 0x0ff88, 6947, 0, 1, 6947 },
+  { 0x0ff89, 6948, 0, 1, 6948 },
+  { 0x0ff8a, 6949, 0, 1, 6949 },
+  { 0x0ff8b, 6950, 0, 1, 6950 },
+  { 0x0ff8c, 6951, 0, 1, 6951 },
+  { 0x0ff8d, 6952, 0, 1, 6952 },
+  { 0x0ff8e, 6953, 0, 1, 6953 },
+  { 0x0ff8f, 6954, 0, 1, 6954 },
+  { 0x0ff90, 6955, 0, 1, 6955 },
+  { 0x0ff91, 6956, 0, 1, 6956 },
+  { 0x0ff92, 6957, 0, 1, 6957 },
+  { 0x0ff93, 6958, 0, 1, 6958 },
+  { 0x0ff94, 6959, 0, 1, 6959 },
+  { 0x0ff95, 6960, 0, 1, 6960 },
+  { 0x0ff96, 6961, 0, 1, 6961 },
+  { 0x0ff97, 6962, 0, 1, 6962 },
+  { 0x0ff98, 6963, 0, 1, 6963 },
+  { 0x0ff99, 6964, 0, 1, 6964 },
+  { 0x0ff9a, 6965, 0, 1, 6965 },
+  { 0x0ff9b, 6966, 0, 1, 6966 },
+  { 0x0ff9c, 6967, 0, 1, 6967 },
+  { 0x0ff9d, 6968, 0, 1, 6968 },
+  { 0x0ff9e, 6969, 0, 1, 6969 },
+  { 0x0ff9f, 6970, 0, 1, 6970 },
+  { 0x0ffa0, 6971, 0, 1, 6971 },
+  { 0x0ffa1, 6972, 0, 1, 6972 },
+  { 0x0ffa2, 6973, 0, 1, 6973 },
+  { 0x0ffa3, 6974, 0, 1, 6974 },
+  { 0x0ffa4, 6975, 0, 1, 6975 },
+  { 0x0ffa5, 6976, 0, 1, 6976 },
+  { 0x0ffa6, 6977, 0, 1, 6977 },
+  { 0x0ffa7, 6978, 0, 1, 6978 },
+  { 0x0ffa8, 6979, 0, 1, 6979 },
+  { 0x0ffa9, 6980, 0, 1, 6980 },
+  { 0x0ffaa, 6981, 0, 1, 6981 },
+  { 0x0ffab, 6982, 0, 1, 6982 },
+  { 0x0ffac, 6983, 0, 1, 6983 },
+  { 0x0ffad, 6984, 0, 1, 6984 },
+  { 0x0ffae, 6985, 0, 1, 6985 },
+  { 0x0ffaf, 6986, 0, 1, 6986 },
+  { 0x0ffb0, 6987, 0, 1, 6987 },
+  { 0x0ffb1, 6988, 0, 1, 6988 },
+  { 0x0ffb2, 6989, 0, 1, 6989 },
+  { 0x0ffb3, 6990, 0, 1, 6990 },
+  { 0x0ffb4, 6991, 0, 1, 6991 },
+  { 0x0ffb5, 6992, 0, 1, 6992 },
+  { 0x0ffb6, 6993, 0, 1, 6993 },
+  { 0x0ffb7, 6994, 0, 1, 6994 },
+  { 0x0ffb8, 6995, 0, 1, 6995 },
+  { 0x0ffb9, 6996, 0, 1, 6996 },
+  { 0x0ffba, 6997, 0, 1, 6997 },
+  { 0x0ffbb, 6998, 0, 1, 6998 },
+  { 0x0ffbc, 6999, 0, 1, 6999 },
+  { 0x0ffbd, 7000, 0, 1, 7000 },
+  { 0x0ffbe, 7001, 0, 1, 7001 },
+  { 0x0ffc2, 7002, 0, 1, 7002 },
+  { 0x0ffc3, 7003, 0, 1, 7003 },
+  { 0x0ffc4, 7004, 0, 1, 7004 },
+  { 0x0ffc5, 7005, 0, 1, 7005 },
+  { 0x0ffc6, 7006, 0, 1, 7006 },
+  { 0x0ffc7, 7007, 0, 1, 7007 },
+  { 0x0ffca, 7008, 0, 1, 7008 },
+  { 0x0ffcb, 7009, 0, 1, 7009 },
+  { 0x0ffcc, 7010, 0, 1, 7010 },
+  { 0x0ffcd, 7011, 0, 1, 7011 },
+  { 0x0ffce, 7012, 0, 1, 7012 },
+  { 0x0ffcf, 7013, 0, 1, 7013 },
+  { 0x0ffd2, 7014, 0, 1, 7014 },
+  { 0x0ffd3, 7015, 0, 1, 7015 },
+  { 0x0ffd4, 7016, 0, 1, 7016 },
+  { 0x0ffd5, 7017, 0, 1, 7017 },
+  { 0x0ffd6, 7018, 0, 1, 7018 },
+  { 0x0ffd7, 7019, 0, 1, 7019 },
+  { 0x0ffda, 7020, 0, 1, 7020 },
+  { 0x0ffdb, 7021, 0, 1, 7021 },
+  { 0x0ffdc, 7022, 0, 1, 7022 },
+  { 0x0ffe0, 7023, 0, 1, 7023 },
+  { 0x0ffe1, 7024, 0, 1, 7024 },
+  { 0x0ffe2, 7025, 0, 1, 7025 },
+  { 0x0ffe3, 7026, 0, 2, 7026 },
+  { 0x0ffe4, 7028, 0, 1, 7028 },
+  { 0x0ffe5, 7029, 0, 1, 7029 },
+  { 0x0ffe6, 7030, 0, 1, 7030 },
+  { 0x0ffe8, 7031, 0, 1, 7031 },
+  { 0x0ffe9, 7032, 0, 1, 7032 },
+  { 0x0ffea, 7033, 0, 1, 7033 },
+  { 0x0ffeb, 7034, 0, 1, 7034 },
+  { 0x0ffec, 7035, 0, 1, 7035 },
+  { 0x0ffed, 7036, 0, 1, 7036 },
+  { 0x0ffee, 7037, 0, 1, 7037 },
+  { 0x10781, 7038, 0, 1, 7038 },
+  { 0x10782, 7039, 0, 1, 7039 },
+  { 0x10783, 7040, 0, 1, 7040 },
+  { 0x10784, 7041, 0, 1, 7041 },
+  { 0x10785, 7042, 0, 1, 7042 },
+  { 0x10787, 7043, 0, 1, 7043 },
+  { 0x10788, 7044, 0, 1, 7044 },
+  { 0x10789, 7045, 0, 1, 7045 },
+  { 0x1078a, 7046, 0, 1, 7046 },
+  { 0x1078b, 7047, 0, 1, 7047 },
+  { 0x1078c, 7048, 0, 1, 7048 },
+  { 0x1078d, 7049, 0, 1, 7049 },
+  { 0x1078e, 7050, 0, 1, 7050 },
+  { 0x1078f, 7051, 0, 1, 7051 },
+  { 0x10790, 7052, 0, 1, 7052 },
+  { 0x10791, 7053, 0, 1, 7053 },
+  { 0x10792, 7054, 0, 1, 7054 },
+  { 0x10793, 7055, 0, 1, 7055 },
+  { 0x10794, 7056, 0, 1, 7056 },
+  { 0x10795, 7057, 0, 1, 7057 },
+  { 0x10796, 7058, 0, 1, 7058 },
+  { 0x10797, 7059, 0, 1, 7059 },
+  { 0x10798, 7060, 0, 1, 7060 },
+  { 0x10799, 7061, 0, 1, 7061 },
+  { 0x1079a, 7062, 0, 1, 7062 },
+  { 0x1079b, 7063, 0, 1, 7063 },
+  { 0x1079c, 7064, 0, 1, 7064 },
+  { 0x1079d, 7065, 0, 1, 7065 },
+  { 0x1079e, 7066, 0, 1, 7066 },
+  { 0x1079f, 7067, 0, 1, 7067 },
+  { 0x107a0, 7068, 0, 1, 7068 },
+  { 0x107a1, 7069, 0, 1, 7069 },
+  { 0x107a2, 7070, 0, 1, 7070 },
+  { 0x107a3, 7071, 0, 1, 7071 },
+  { 0x107a4, 7072, 0, 1, 7072 },
+  { 0x107a5, 7073, 0, 1, 7073 },
+  { 0x107a6, 7074, 0, 1, 7074 },
+  { 0x107a7, 7075, 0, 1, 7075 },
+  { 0x107a8, 7076, 0, 1, 7076 },
+  { 0x107a9, 7077, 0, 1, 7077 },
+  { 0x107aa, 7078, 0, 1, 7078 },
+  { 0x107ab, 7079, 0, 1, 7079 },
+  { 0x107ac, 7080, 0, 1, 7080 },
+  { 0x107ad, 7081, 0, 1, 7081 },
+  { 0x107ae, 7082, 0, 1, 7082 },
+  { 0x107af, 7083, 0, 1, 7083 },
+  { 0x107b0, 7084, 0, 1, 7084 },
+  { 0x107b2, 7085, 0, 1, 7085 },
+  { 0x107b3, 7086, 0, 1, 7086 },
+  { 0x107b4, 7087, 0, 1, 7087 },
+  { 0x107b5, 7088, 0, 1, 7088 },
+  { 0x107b6, 7089, 0, 1, 7089 },
+  { 0x107b7, 7090, 0, 1, 7090 },
+  { 0x107b8, 7091, 0, 1, 7091 },
+  { 0x107b9, 7092, 0, 1, 7092 },
+  { 0x107ba, 7093, 0, 1, 7093 },
+  { 0x1109a, 7094, 2, 2, 7094 },
+  { 0x1109c, 7096, 2, 2, 7096 },
+  { 0x110ab, 7098, 2, 2, 7098 },
+  { 0x1112e, 7100, 2, 2, 7100 },
+  { 0x1112f, 7102, 2, 2, 7102 },
+  { 0x1134b, 7104, 2, 2, 7104 },
+  { 0x1134c, 7106, 2, 2, 7106 },
+  { 0x114bb, 7108, 2, 2, 7108 },
+  { 0x114bc, 7110, 2, 2, 7110 },
+  { 0x114be, 7112, 2, 2, 7112 },
+  { 0x115ba, 7114, 2, 2, 7114 },
+  { 0x115bb, 7116, 2, 2, 7116 },
+  { 0x11938, 7118, 2, 2, 7118 },
+  { 0x1d15e, 7120, 2, 2, 7120 },
+  { 0x1d15f, 7122, 2, 2, 7122 },
+  { 0x1d160, 7124, 3, 3, 7124 },
+  { 0x1d161, 7127, 3, 3, 7127 },
+  { 0x1d162, 7130, 3, 3, 7130 },
+  { 0x1d163, 7133, 3, 3, 7133 },
+  { 0x1d164, 7136, 3, 3, 7136 },
+  { 0x1d1bb, 7139, 2, 2, 7139 },
+  { 0x1d1bc, 7141, 2, 2, 7141 },
+  { 0x1d1bd, 7143, 3, 3, 7143 },
+  { 0x1d1be, 7146, 3, 3, 7146 },
+  { 0x1d1bf, 7149, 3, 3, 7149 },
+  { 0x1d1c0, 7152, 3, 3, 7152 },
+  { 0x1d400, 7155, 0, 1, 7155 },
+  { 0x1d401, 7156, 0, 1, 7156 },
+  { 0x1d402, 7157, 0, 1, 7157 },
+  { 0x1d403, 7158, 0, 1, 7158 },
+  { 0x1d404, 7159, 0, 1, 7159 },
+  { 0x1d405, 7160, 0, 1, 7160 },
+  { 0x1d406, 7161, 0, 1, 7161 },
+  { 0x1d407, 7162, 0, 1, 7162 },
+  { 0x1d408, 7163, 0, 1, 7163 },
+  { 0x1d409, 7164, 0, 1, 7164 },
+  { 0x1d40a, 7165, 0, 1, 7165 },
+  { 0x1d40b, 7166, 0, 1, 7166 },
+  { 0x1d40c, 7167, 0, 1, 7167 },
+  { 0x1d40d, 7168, 0, 1, 7168 },
+  { 0x1d40e, 7169, 0, 1, 7169 },
+  { 0x1d40f, 7170, 0, 1, 7170 },
+  { 0x1d410, 7171, 0, 1, 7171 },
+  { 0x1d411, 7172, 0, 1, 7172 },
+  { 0x1d412, 7173, 0, 1, 7173 },
+  { 0x1d413, 7174, 0, 1, 7174 },
+  { 0x1d414, 7175, 0, 1, 7175 },
+  { 0x1d415, 7176, 0, 1, 7176 },
+  { 0x1d416, 7177, 0, 1, 7177 },
+  { 0x1d417, 7178, 0, 1, 7178 },
+  { 0x1d418, 7179, 0, 1, 7179 },
+  { 0x1d419, 7180, 0, 1, 7180 },
+  { 0x1d41a, 7181, 0, 1, 7181 },
+  { 0x1d41b, 7182, 0, 1, 7182 },
+  { 0x1d41c, 7183, 0, 1, 7183 },
+  { 0x1d41d, 7184, 0, 1, 7184 },
+  { 0x1d41e, 7185, 0, 1, 7185 },
+  { 0x1d41f, 7186, 0, 1, 7186 },
+  { 0x1d420, 7187, 0, 1, 7187 },
+  { 0x1d421, 7188, 0, 1, 7188 },
+  { 0x1d422, 7189, 0, 1, 7189 },
+  { 0x1d423, 7190, 0, 1, 7190 },
+  { 0x1d424, 7191, 0, 1, 7191 },
+  { 0x1d425, 7192, 0, 1, 7192 },
+  { 0x1d426, 7193, 0, 1, 7193 },
+  { 0x1d427, 7194, 0, 1, 7194 },
+  { 0x1d428, 7195, 0, 1, 7195 },
+  { 0x1d429, 7196, 0, 1, 7196 },
+  { 0x1d42a, 7197, 0, 1, 7197 },
+  { 0x1d42b, 7198, 0, 1, 7198 },
+  { 0x1d42c, 7199, 0, 1, 7199 },
+  { 0x1d42d, 7200, 0, 1, 7200 },
+  { 0x1d42e, 7201, 0, 1, 7201 },
+  { 0x1d42f, 7202, 0, 1, 7202 },
+  { 0x1d430, 7203, 0, 1, 7203 },
+  { 0x1d431, 7204, 0, 1, 7204 },
+  { 0x1d432, 7205, 0, 1, 7205 },
+  { 0x1d433, 7206, 0, 1, 7206 },
+  { 0x1d434, 7207, 0, 1, 7207 },
+  { 0x1d435, 7208, 0, 1, 7208 },
+  { 0x1d436, 7209, 0, 1, 7209 },
+  { 0x1d437, 7210, 0, 1, 7210 },
+  { 0x1d438, 7211, 0, 1, 7211 },
+  { 0x1d439, 7212, 0, 1, 7212 },
+  { 0x1d43a, 7213, 0, 1, 7213 },
+  { 0x1d43b, 7214, 0, 1, 7214 },
+  { 0x1d43c, 7215, 0, 1, 7215 },
+  { 0x1d43d, 7216, 0, 1, 7216 },
+  { 0x1d43e, 7217, 0, 1, 7217 },
+  { 0x1d43f, 7218, 0, 1, 7218 },
+  { 0x1d440, 7219, 0, 1, 7219 },
+  { 0x1d441, 7220, 0, 1, 7220 },
+  { 0x1d442, 7221, 0, 1, 7221 },
+  { 0x1d443, 7222, 0, 1, 7222 },
+  { 0x1d444, 7223, 0, 1, 7223 },
+  { 0x1d445, 7224, 0, 1, 7224 },
+  { 0x1d446, 7225, 0, 1, 7225 },
+  { 0x1d447, 7226, 0, 1, 7226 },
+  { 0x1d448, 7227, 0, 1, 7227 },
+  { 0x1d449, 7228, 0, 1, 7228 },
+  { 0x1d44a, 7229, 0, 1, 7229 },
+  { 0x1d44b, 7230, 0, 1, 7230 },
+  { 0x1d44c, 7231, 0, 1, 7231 },
+  { 0x1d44d, 7232, 0, 1, 7232 },
+  { 0x1d44e, 7233, 0, 1, 7233 },
+  { 0x1d44f, 7234, 0, 1, 7234 },
+  { 0x1d450, 7235, 0, 1, 7235 },
+  { 0x1d451, 7236, 0, 1, 7236 },
+  { 0x1d452, 7237, 0, 1, 7237 },
+  { 0x1d453, 7238, 0, 1, 7238 },
+  { 0x1d454, 7239, 0, 1, 7239 },
+  { 0x1d456, 7240, 0, 1, 7240 },
+  { 0x1d457, 7241, 0, 1, 7241 },
+  { 0x1d458, 7242, 0, 1, 7242 },
+  { 0x1d459, 7243, 0, 1, 7243 },
+  { 0x1d45a, 7244, 0, 1, 7244 },
+  { 0x1d45b, 7245, 0, 1, 7245 },
+  { 0x1d45c, 7246, 0, 1, 7246 },
+  { 0x1d45d, 7247, 0, 1, 7247 },
+  { 0x1d45e, 7248, 0, 1, 7248 },
+  { 0x1d45f, 7249, 0, 1, 7249 },
+  { 0x1d460, 7250, 0, 1, 7250 },
+  { 0x1d461, 7251, 0, 1, 7251 },
+  { 0x1d462, 7252, 0, 1, 7252 },
+  { 0x1d463, 7253, 0, 1, 7253 },
+  { 0x1d464, 7254, 0, 1, 7254 },
+  { 0x1d465, 7255, 0, 1, 7255 },
+  { 0x1d466, 7256, 0, 1, 7256 },
+  { 0x1d467, 7257, 0, 1, 7257 },
+  { 0x1d468, 7258, 0, 1, 7258 },
+  { 0x1d469, 7259, 0, 1, 7259 },
+  { 0x1d46a, 7260, 0, 1, 7260 },
+  { 0x1d46b, 7261, 0, 1, 7261 },
+  { 0x1d46c, 7262, 0, 1, 7262 },
+  { 0x1d46d, 7263, 0, 1, 7263 },
+  { 0x1d46e, 7264, 0, 1, 7264 },
+  { 0x1d46f, 7265, 0, 1, 7265 },
+  { 0x1d470, 7266, 0, 1, 7266 },
+  { 0x1d471, 7267, 0, 1, 7267 },
+  { 0x1d472, 7268, 0, 1, 7268 },
+  { 0x1d473, 7269, 0, 1, 7269 },
+  { 0x1d474, 7270, 0, 1, 7270 },
+  { 0x1d475, 7271, 0, 1, 7271 },
+  { 0x1d476, 7272, 0, 1, 7272 },
+  { 0x1d477, 7273, 0, 1, 7273 },
+  { 0x1d478, 7274, 0, 1, 7274 },
+  { 0x1d479, 7275, 0, 1, 7275 },
+  { 0x1d47a, 7276, 0, 1, 7276 },
+  { 0x1d47b, 7277, 0, 1, 7277 },
+  { 0x1d47c, 7278, 0, 1, 7278 },
+  { 0x1d47d, 7279, 0, 1, 7279 },
+  { 0x1d47e, 7280, 0, 1, 7280 },
+  { 0x1d47f, 7281, 0, 1, 7281 },
+  { 0x1d480, 7282, 0, 1, 7282 },
+  { 0x1d481, 7283, 0, 1, 7283 },
+  { 0x1d482, 7284, 0, 1, 7284 },
+  { 0x1d483, 7285, 0, 1, 7285 },
+  { 0x1d484, 7286, 0, 1, 7286 },
+  { 0x1d485, 7287, 0, 1, 7287 },
+  { 0x1d486, 7288, 0, 1, 7288 },
+  { 0x1d487, 7289, 0, 1, 7289 },
+  { 0x1d488, 7290, 0, 1, 7290 },
+  { 0x1d489, 7291, 0, 1, 7291 },
+  { 0x1d48a, 7292, 0, 1, 7292 },
+  { 0x1d48b, 7293, 0, 1, 7293 },
+  { 0x1d48c, 7294, 0, 1, 7294 },
+  { 0x1d48d, 7295, 0, 1, 7295 },
+  { 0x1d48e, 7296, 0, 1, 7296 },
+  { 0x1d48f, 7297, 0, 1, 7297 },
+  { 0x1d490, 7298, 0, 1, 7298 },
+  { 0x1d491, 7299, 0, 1, 7299 },
+  { 0x1d492, 7300, 0, 1, 7300 },
+  { 0x1d493, 7301, 0, 1, 7301 },
+  { 0x1d494, 7302, 0, 1, 7302 },
+  { 0x1d495, 7303, 0, 1, 7303 },
+  { 0x1d496, 7304, 0, 1, 7304 },
+  { 0x1d497, 7305, 0, 1, 7305 },
+  { 0x1d498, 7306, 0, 1, 7306 },
+  { 0x1d499, 7307, 0, 1, 7307 },
+  { 0x1d49a, 7308, 0, 1, 7308 },
+  { 0x1d49b, 7309, 0, 1, 7309 },
+  { 0x1d49c, 7310, 0, 1, 7310 },
+  { 0x1d49e, 7311, 0, 1, 7311 },
+  { 0x1d49f, 7312, 0, 1, 7312 },
+  { 0x1d4a2, 7313, 0, 1, 7313 },
+  { 0x1d4a5, 7314, 0, 1, 7314 },
+  { 0x1d4a6, 7315, 0, 1, 7315 },
+  { 0x1d4a9, 7316, 0, 1, 7316 },
+  { 0x1d4aa, 7317, 0, 1, 7317 },
+  { 0x1d4ab, 7318, 0, 1, 7318 },
+  { 0x1d4ac, 7319, 0, 1, 7319 },
+  { 0x1d4ae, 7320, 0, 1, 7320 },
+  { 0x1d4af, 7321, 0, 1, 7321 },
+  { 0x1d4b0, 7322, 0, 1, 7322 },
+  { 0x1d4b1, 7323, 0, 1, 7323 },
+  { 0x1d4b2, 7324, 0, 1, 7324 },
+  { 0x1d4b3, 7325, 0, 1, 7325 },
+  { 0x1d4b4, 7326, 0, 1, 7326 },
+  { 0x1d4b5, 7327, 0, 1, 7327 },
+  { 0x1d4b6, 7328, 0, 1, 7328 },
+  { 0x1d4b7, 7329, 0, 1, 7329 },
+  { 0x1d4b8, 7330, 0, 1, 7330 },
+  { 0x1d4b9, 7331, 0, 1, 7331 },
+  { 0x1d4bb, 7332, 0, 1, 7332 },
+  { 0x1d4bd, 7333, 0, 1, 7333 },
+  { 0x1d4be, 7334, 0, 1, 7334 },
+  { 0x1d4bf, 7335, 0, 1, 7335 },
+  { 0x1d4c0, 7336, 0, 1, 7336 },
+  { 0x1d4c1, 7337, 0, 1, 7337 },
+  { 0x1d4c2, 7338, 0, 1, 7338 },
+  { 0x1d4c3, 7339, 0, 1, 7339 },
+  { 0x1d4c5, 7340, 0, 1, 7340 },
+  { 0x1d4c6, 7341, 0, 1, 7341 },
+  { 0x1d4c7, 7342, 0, 1, 7342 },
+  { 0x1d4c8, 7343, 0, 1, 7343 },
+  { 0x1d4c9, 7344, 0, 1, 7344 },
+  { 0x1d4ca, 7345, 0, 1, 7345 },
+  { 0x1d4cb, 7346, 0, 1, 7346 },
+  { 0x1d4cc, 7347, 0, 1, 7347 },
+  { 0x1d4cd, 7348, 0, 1, 7348 },
+  { 0x1d4ce, 7349, 0, 1, 7349 },
+  { 0x1d4cf, 7350, 0, 1, 7350 },
+  { 0x1d4d0, 7351, 0, 1, 7351 },
+  { 0x1d4d1, 7352, 0, 1, 7352 },
+  { 0x1d4d2, 7353, 0, 1, 7353 },
+  { 0x1d4d3, 7354, 0, 1, 7354 },
+  { 0x1d4d4, 7355, 0, 1, 7355 },
+  { 0x1d4d5, 7356, 0, 1, 7356 },
+  { 0x1d4d6, 7357, 0, 1, 7357 },
+  { 0x1d4d7, 7358, 0, 1, 7358 },
+  { 0x1d4d8, 7359, 0, 1, 7359 },
+  { 0x1d4d9, 7360, 0, 1, 7360 },
+  { 0x1d4da, 7361, 0, 1, 7361 },
+  { 0x1d4db, 7362, 0, 1, 7362 },
+  { 0x1d4dc, 7363, 0, 1, 7363 },
+  { 0x1d4dd, 7364, 0, 1, 7364 },
+  { 0x1d4de, 7365, 0, 1, 7365 },
+  { 0x1d4df, 7366, 0, 1, 7366 },
+  { 0x1d4e0, 7367, 0, 1, 7367 },
+  { 0x1d4e1, 7368, 0, 1, 7368 },
+  { 0x1d4e2, 7369, 0, 1, 7369 },
+  { 0x1d4e3, 7370, 0, 1, 7370 },
+  { 0x1d4e4, 7371, 0, 1, 7371 },
+  { 0x1d4e5, 7372, 0, 1, 7372 },
+  { 0x1d4e6, 7373, 0, 1, 7373 },
+  { 0x1d4e7, 7374, 0, 1, 7374 },
+  { 0x1d4e8, 7375, 0, 1, 7375 },
+  { 0x1d4e9, 7376, 0, 1, 7376 },
+  { 0x1d4ea, 7377, 0, 1, 7377 },
+  { 0x1d4eb, 7378, 0, 1, 7378 },
+  { 0x1d4ec, 7379, 0, 1, 7379 },
+  { 0x1d4ed, 7380, 0, 1, 7380 },
+  { 0x1d4ee, 7381, 0, 1, 7381 },
+  { 0x1d4ef, 7382, 0, 1, 7382 },
+  { 0x1d4f0, 7383, 0, 1, 7383 },
+  { 0x1d4f1, 7384, 0, 1, 7384 },
+  { 0x1d4f2, 7385, 0, 1, 7385 },
+  { 0x1d4f3, 7386, 0, 1, 7386 },
+  { 0x1d4f4, 7387, 0, 1, 7387 },
+  { 0x1d4f5, 7388, 0, 1, 7388 },
+  { 0x1d4f6, 7389, 0, 1, 7389 },
+  { 0x1d4f7, 7390, 0, 1, 7390 },
+  { 0x1d4f8, 7391, 0, 1, 7391 },
+  { 0x1d4f9, 7392, 0, 1, 7392 },
+  { 0x1d4fa, 7393, 0, 1, 7393 },
+  { 0x1d4fb, 7394, 0, 1, 7394 },
+  { 0x1d4fc, 7395, 0, 1, 7395 },
+  { 0x1d4fd, 7396, 0, 1, 7396 },
+  { 0x1d4fe, 7397, 0, 1, 7397 },
+  { 0x1d4ff, 7398, 0, 1, 7398 },
+  { 0x1d500, 7399, 0, 1, 7399 },
+  { 0x1d501, 7400, 0, 1, 7400 },
+  { 0x1d502, 7401, 0, 1, 7401 },
+  { 0x1d503, 7402, 0, 1, 7402 },
+  { 0x1d504, 7403, 0, 1, 7403 },
+  { 0x1d505, 7404, 0, 1, 7404 },
+  { 0x1d507, 7405, 0, 1, 7405 },
+  { 0x1d508, 7406, 0, 1, 7406 },
+  { 0x1d509, 7407, 0, 1, 7407 },
+  { 0x1d50a, 7408, 0, 1, 7408 },
+  { 0x1d50d, 7409, 0, 1, 7409 },
+  { 0x1d50e, 7410, 0, 1, 7410 },
+  { 0x1d50f, 7411, 0, 1, 7411 },
+  { 0x1d510, 7412, 0, 1, 7412 },
+  { 0x1d511, 7413, 0, 1, 7413 },
+  { 0x1d512, 7414, 0, 1, 7414 },
+  { 0x1d513, 7415, 0, 1, 7415 },
+  { 0x1d514, 7416, 0, 1, 7416 },
+  { 0x1d516, 7417, 0, 1, 7417 },
+  { 0x1d517, 7418, 0, 1, 7418 },
+  { 0x1d518, 7419, 0, 1, 7419 },
+  { 0x1d519, 7420, 0, 1, 7420 },
+  { 0x1d51a, 7421, 0, 1, 7421 },
+  { 0x1d51b, 7422, 0, 1, 7422 },
+  { 0x1d51c, 7423, 0, 1, 7423 },
+  { 0x1d51e, 7424, 0, 1, 7424 },
+  { 0x1d51f, 7425, 0, 1, 7425 },
+  { 0x1d520, 7426, 0, 1, 7426 },
+  { 0x1d521, 7427, 0, 1, 7427 },
+  { 0x1d522, 7428, 0, 1, 7428 },
+  { 0x1d523, 7429, 0, 1, 7429 },
+  { 0x1d524, 7430, 0, 1, 7430 },
+  { 0x1d525, 7431, 0, 1, 7431 },
+  { 0x1d526, 7432, 0, 1, 7432 },
+  { 0x1d527, 7433, 0, 1, 7433 },
+  { 0x1d528, 7434, 0, 1, 7434 },
+  { 0x1d529, 7435, 0, 1, 7435 },
+  { 0x1d52a, 7436, 0, 1, 7436 },
+  { 0x1d52b, 7437, 0, 1, 7437 },
+  { 0x1d52c, 7438, 0, 1, 7438 },
+  { 0x1d52d, 7439, 0, 1, 7439 },
+  { 0x1d52e, 7440, 0, 1, 7440 },
+  { 0x1d52f, 7441, 0, 1, 7441 },
+  { 0x1d530, 7442, 0, 1, 7442 },
+  { 0x1d531, 7443, 0, 1, 7443 },
+  { 0x1d532, 7444, 0, 1, 7444 },
+  { 0x1d533, 7445, 0, 1, 7445 },
+  { 0x1d534, 7446, 0, 1, 7446 },
+  { 0x1d535, 7447, 0, 1, 7447 },
+  { 0x1d536, 7448, 0, 1, 7448 },
+  { 0x1d537, 7449, 0, 1, 7449 },
+  { 0x1d538, 7450, 0, 1, 7450 },
+  { 0x1d539, 7451, 0, 1, 7451 },
+  { 0x1d53b, 7452, 0, 1, 7452 },
+  { 0x1d53c, 7453, 0, 1, 7453 },
+  { 0x1d53d, 7454, 0, 1, 7454 },
+  { 0x1d53e, 7455, 0, 1, 7455 },
+  { 0x1d540, 7456, 0, 1, 7456 },
+  { 0x1d541, 7457, 0, 1, 7457 },
+  { 0x1d542, 7458, 0, 1, 7458 },
+  { 0x1d543, 7459, 0, 1, 7459 },
+  { 0x1d544, 7460, 0, 1, 7460 },
+  { 0x1d546, 7461, 0, 1, 7461 },
+  { 0x1d54a, 7462, 0, 1, 7462 },
+  { 0x1d54b, 7463, 0, 1, 7463 },
+  { 0x1d54c, 7464, 0, 1, 7464 },
+  { 0x1d54d, 7465, 0, 1, 7465 },
+  { 0x1d54e, 7466, 0, 1, 7466 },
+  { 0x1d54f, 7467, 0, 1, 7467 },
+  { 0x1d550, 7468, 0, 1, 7468 },
+  { 0x1d552, 7469, 0, 1, 7469 },
+  { 0x1d553, 7470, 0, 1, 7470 },
+  { 0x1d554, 7471, 0, 1, 7471 },
+  { 0x1d555, 7472, 0, 1, 7472 },
+  { 0x1d556, 7473, 0, 1, 7473 },
+  { 0x1d557, 7474, 0, 1, 7474 },
+  { 0x1d558, 7475, 0, 1, 7475 },
+  { 0x1d559, 7476, 0, 1, 7476 },
+  { 0x1d55a, 7477, 0, 1, 7477 },
+  { 0x1d55b, 7478, 0, 1, 7478 },
+  { 0x1d55c, 7479, 0, 1, 7479 },
+  { 0x1d55d, 7480, 0, 1, 7480 },
+  { 0x1d55e, 7481, 0, 1, 7481 },
+  { 0x1d55f, 7482, 0, 1, 7482 },
+  { 0x1d560, 7483, 0, 1, 7483 },
+  { 0x1d561, 7484, 0, 1, 7484 },
+  { 0x1d562, 7485, 0, 1, 7485 },
+  { 0x1d563, 7486, 0, 1, 7486 },
+  { 0x1d564, 7487, 0, 1, 7487 },
+  { 0x1d565, 7488, 0, 1, 7488 },
+  { 0x1d566, 7489, 0, 1, 7489 },
+  { 0x1d567, 7490, 0, 1, 7490 },
+  { 0x1d568, 7491, 0, 1, 7491 },
+  { 0x1d569, 7492, 0, 1, 7492 },
+  { 0x1d56a, 7493, 0, 1, 7493 },
+  { 0x1d56b, 7494, 0, 1, 7494 },
+  { 0x1d56c, 7495, 0, 1, 7495 },
+  { 0x1d56d, 7496, 0, 1, 7496 },
+  { 0x1d56e, 7497, 0, 1, 7497 },
+  { 0x1d56f, 7498, 0, 1, 7498 },
+  { 0x1d570, 7499, 0, 1, 7499 },
+  { 0x1d571, 7500, 0, 1, 7500 },
+  { 0x1d572, 7501, 0, 1, 7501 },
+  { 0x1d573, 7502, 0, 1, 7502 },
+  { 0x1d574, 7503, 0, 1, 7503 },
+  { 0x1d575, 7504, 0, 1, 7504 },
+  { 0x1d576, 7505, 0, 1, 7505 },
+  { 0x1d577, 7506, 0, 1, 7506 },
+  { 0x1d578, 7507, 0, 1, 7507 },
+  { 0x1d579, 7508, 0, 1, 7508 },
+  { 0x1d57a, 7509, 0, 1, 7509 },
+  { 0x1d57b, 7510, 0, 1, 7510 },
+  { 0x1d57c, 7511, 0, 1, 7511 },
+  { 0x1d57d, 7512, 0, 1, 7512 },
+  { 0x1d57e, 7513, 0, 1, 7513 },
+  { 0x1d57f, 7514, 0, 1, 7514 },
+  { 0x1d580, 7515, 0, 1, 7515 },
+  { 0x1d581, 7516, 0, 1, 7516 },
+  { 0x1d582, 7517, 0, 1, 7517 },
+  { 0x1d583, 7518, 0, 1, 7518 },
+  { 0x1d584, 7519, 0, 1, 7519 },
+  { 0x1d585, 7520, 0, 1, 7520 },
+  { 0x1d586, 7521, 0, 1, 7521 },
+  { 0x1d587, 7522, 0, 1, 7522 },
+  { 0x1d588, 7523, 0, 1, 7523 },
+  { 0x1d589, 7524, 0, 1, 7524 },
+  { 0x1d58a, 7525, 0, 1, 7525 },
+  { 0x1d58b, 7526, 0, 1, 7526 },
+  { 0x1d58c, 7527, 0, 1, 7527 },
+  { 0x1d58d, 7528, 0, 1, 7528 },
+  { 0x1d58e, 7529, 0, 1, 7529 },
+  { 0x1d58f, 7530, 0, 1, 7530 },
+  { 0x1d590, 7531, 0, 1, 7531 },
+  { 0x1d591, 7532, 0, 1, 7532 },
+  { 0x1d592, 7533, 0, 1, 7533 },
+  { 0x1d593, 7534, 0, 1, 7534 },
+  { 0x1d594, 7535, 0, 1, 7535 },
+  { 0x1d595, 7536, 0, 1, 7536 },
+  { 0x1d596, 7537, 0, 1, 7537 },
+  { 0x1d597, 7538, 0, 1, 7538 },
+  { 0x1d598, 7539, 0, 1, 7539 },
+  { 0x1d599, 7540, 0, 1, 7540 },
+  { 0x1d59a, 7541, 0, 1, 7541 },
+  { 0x1d59b, 7542, 0, 1, 7542 },
+  { 0x1d59c, 7543, 0, 1, 7543 },
+  { 0x1d59d, 7544, 0, 1, 7544 },
+  { 0x1d59e, 7545, 0, 1, 7545 },
+  { 0x1d59f, 7546, 0, 1, 7546 },
+  { 0x1d5a0, 7547, 0, 1, 7547 },
+  { 0x1d5a1, 7548, 0, 1, 7548 },
+  { 0x1d5a2, 7549, 0, 1, 7549 },
+  { 0x1d5a3, 7550, 0, 1, 7550 },
+  { 0x1d5a4, 7551, 0, 1, 7551 },
+  { 0x1d5a5, 7552, 0, 1, 7552 },
+  { 0x1d5a6, 7553, 0, 1, 7553 },
+  { 0x1d5a7, 7554, 0, 1, 7554 },
+  { 0x1d5a8, 7555, 0, 1, 7555 },
+  { 0x1d5a9, 7556, 0, 1, 7556 },
+  { 0x1d5aa, 7557, 0, 1, 7557 },
+  { 0x1d5ab, 7558, 0, 1, 7558 },
+  { 0x1d5ac, 7559, 0, 1, 7559 },
+  { 0x1d5ad, 7560, 0, 1, 7560 },
+  { 0x1d5ae, 7561, 0, 1, 7561 },
+  { 0x1d5af, 7562, 0, 1, 7562 },
+  { 0x1d5b0, 7563, 0, 1, 7563 },
+  { 0x1d5b1, 7564, 0, 1, 7564 },
+  { 0x1d5b2, 7565, 0, 1, 7565 },
+  { 0x1d5b3, 7566, 0, 1, 7566 },
+  { 0x1d5b4, 7567, 0, 1, 7567 },
+  { 0x1d5b5, 7568, 0, 1, 7568 },
+  { 0x1d5b6, 7569, 0, 1, 7569 },
+  { 0x1d5b7, 7570, 0, 1, 7570 },
+  { 0x1d5b8, 7571, 0, 1, 7571 },
+  { 0x1d5b9, 7572, 0, 1, 7572 },
+  { 0x1d5ba, 7573, 0, 1, 7573 },
+  { 0x1d5bb, 7574, 0, 1, 7574 },
+  { 0x1d5bc, 7575, 0, 1, 7575 },
+  { 0x1d5bd, 7576, 0, 1, 7576 },
+  { 0x1d5be, 7577, 0, 1, 7577 },
+  { 0x1d5bf, 7578, 0, 1, 7578 },
+  { 0x1d5c0, 7579, 0, 1, 7579 },
+  { 0x1d5c1, 7580, 0, 1, 7580 },
+  { 0x1d5c2, 7581, 0, 1, 7581 },
+  { 0x1d5c3, 7582, 0, 1, 7582 },
+  { 0x1d5c4, 7583, 0, 1, 7583 },
+  { 0x1d5c5, 7584, 0, 1, 7584 },
+  { 0x1d5c6, 7585, 0, 1, 7585 },
+  { 0x1d5c7, 7586, 0, 1, 7586 },
+  { 0x1d5c8, 7587, 0, 1, 7587 },
+  { 0x1d5c9, 7588, 0, 1, 7588 },
+  { 0x1d5ca, 7589, 0, 1, 7589 },
+  { 0x1d5cb, 7590, 0, 1, 7590 },
+  { 0x1d5cc, 7591, 0, 1, 7591 },
+  { 0x1d5cd, 7592, 0, 1, 7592 },
+  { 0x1d5ce, 7593, 0, 1, 7593 },
+  { 0x1d5cf, 7594, 0, 1, 7594 },
+  { 0x1d5d0, 7595, 0, 1, 7595 },
+  { 0x1d5d1, 7596, 0, 1, 7596 },
+  { 0x1d5d2, 7597, 0, 1, 7597 },
+  { 0x1d5d3, 7598, 0, 1, 7598 },
+  { 0x1d5d4, 7599, 0, 1, 7599 },
+  { 0x1d5d5, 7600, 0, 1, 7600 },
+  { 0x1d5d6, 7601, 0, 1, 7601 },
+  { 0x1d5d7, 7602, 0, 1, 7602 },
+  { 0x1d5d8, 7603, 0, 1, 7603 },
+  { 0x1d5d9, 7604, 0, 1, 7604 },
+  { 0x1d5da, 7605, 0, 1, 7605 },
+  { 0x1d5db, 7606, 0, 1, 7606 },
+  { 0x1d5dc, 7607, 0, 1, 7607 },
+  { 0x1d5dd, 7608, 0, 1, 7608 },
+  { 0x1d5de, 7609, 0, 1, 7609 },
+  { 0x1d5df, 7610, 0, 1, 7610 },
+  { 0x1d5e0, 7611, 0, 1, 7611 },
+  { 0x1d5e1, 7612, 0, 1, 7612 },
+  { 0x1d5e2, 7613, 0, 1, 7613 },
+  { 0x1d5e3, 7614, 0, 1, 7614 },
+  { 0x1d5e4, 7615, 0, 1, 7615 },
+  { 0x1d5e5, 7616, 0, 1, 7616 },
+  { 0x1d5e6, 7617, 0, 1, 7617 },
+  { 0x1d5e7, 7618, 0, 1, 7618 },
+  { 0x1d5e8, 7619, 0, 1, 7619 },
+  { 0x1d5e9, 7620, 0, 1, 7620 },
+  { 0x1d5ea, 7621, 0, 1, 7621 },
+  { 0x1d5eb, 7622, 0, 1, 7622 },
+  { 0x1d5ec, 7623, 0, 1, 7623 },
+  { 0x1d5ed, 7624, 0, 1, 7624 },
+  { 0x1d5ee, 7625, 0, 1, 7625 },
+  { 0x1d5ef, 7626, 0, 1, 7626 },
+  { 0x1d5f0, 7627, 0, 1, 7627 },
+  { 0x1d5f1, 7628, 0, 1, 7628 },
+  { 0x1d5f2, 7629, 0, 1, 7629 },
+  { 0x1d5f3, 7630, 0, 1, 7630 },
+  { 0x1d5f4, 7631, 0, 1, 7631 },
+  { 0x1d5f5, 7632, 0, 1, 7632 },
+  { 0x1d5f6, 7633, 0, 1, 7633 },
+  { 0x1d5f7, 7634, 0, 1, 7634 },
+  { 0x1d5f8, 7635, 0, 1, 7635 },
+  { 0x1d5f9, 7636, 0, 1, 7636 },
+  { 0x1d5fa, 7637, 0, 1, 7637 },
+  { 0x1d5fb, 7638, 0, 1, 7638 },
+  { 0x1d5fc, 7639, 0, 1, 7639 },
+  { 0x1d5fd, 7640, 0, 1, 7640 },
+  { 0x1d5fe, 7641, 0, 1, 7641 },
+  { 0x1d5ff, 7642, 0, 1, 7642 },
+  { 0x1d600, 7643, 0, 1, 7643 },
+  { 0x1d601, 7644, 0, 1, 7644 },
+  { 0x1d602, 7645, 0, 1, 7645 },
+  { 0x1d603, 7646, 0, 1, 7646 },
+  { 0x1d604, 7647, 0, 1, 7647 },
+  { 0x1d605, 7648, 0, 1, 7648 },
+  { 0x1d606, 7649, 0, 1, 7649 },
+  { 0x1d607, 7650, 0, 1, 7650 },
+  { 0x1d608, 7651, 0, 1, 7651 },
+  { 0x1d609, 7652, 0, 1, 7652 },
+  { 0x1d60a, 7653, 0, 1, 7653 },
+  { 0x1d60b, 7654, 0, 1, 7654 },
+  { 0x1d60c, 7655, 0, 1, 7655 },
+  { 0x1d60d, 7656, 0, 1, 7656 },
+  { 0x1d60e, 7657, 0, 1, 7657 },
+  { 0x1d60f, 7658, 0, 1, 7658 },
+  { 0x1d610, 7659, 0, 1, 7659 },
+  { 0x1d611, 7660, 0, 1, 7660 },
+  { 0x1d612, 7661, 0, 1, 7661 },
+  { 0x1d613, 7662, 0, 1, 7662 },
+  { 0x1d614, 7663, 0, 1, 7663 },
+  { 0x1d615, 7664, 0, 1, 7664 },
+  { 0x1d616, 7665, 0, 1, 7665 },
+  { 0x1d617, 7666, 0, 1, 7666 },
+  { 0x1d618, 7667, 0, 1, 7667 },
+  { 0x1d619, 7668, 0, 1, 7668 },
+  { 0x1d61a, 7669, 0, 1, 7669 },
+  { 0x1d61b, 7670, 0, 1, 7670 },
+  { 0x1d61c, 7671, 0, 1, 7671 },
+  { 0x1d61d, 7672, 0, 1, 7672 },
+  { 0x1d61e, 7673, 0, 1, 7673 },
+  { 0x1d61f, 7674, 0, 1, 7674 },
+  { 0x1d620, 7675, 0, 1, 7675 },
+  { 0x1d621, 7676, 0, 1, 7676 },
+  { 0x1d622, 7677, 0, 1, 7677 },
+  { 0x1d623, 7678, 0, 1, 7678 },
+  { 0x1d624, 7679, 0, 1, 7679 },
+  { 0x1d625, 7680, 0, 1, 7680 },
+  { 0x1d626, 7681, 0, 1, 7681 },
+  { 0x1d627, 7682, 0, 1, 7682 },
+  { 0x1d628, 7683, 0, 1, 7683 },
+  { 0x1d629, 7684, 0, 1, 7684 },
+  { 0x1d62a, 7685, 0, 1, 7685 },
+  { 0x1d62b, 7686, 0, 1, 7686 },
+  { 0x1d62c, 7687, 0, 1, 7687 },
+  { 0x1d62d, 7688, 0, 1, 7688 },
+  { 0x1d62e, 7689, 0, 1, 7689 },
+  { 0x1d62f, 7690, 0, 1, 7690 },
+  { 0x1d630, 7691, 0, 1, 7691 },
+  { 0x1d631, 7692, 0, 1, 7692 },
+  { 0x1d632, 7693, 0, 1, 7693 },
+  { 0x1d633, 7694, 0, 1, 7694 },
+  { 0x1d634, 7695, 0, 1, 7695 },
+  { 0x1d635, 7696, 0, 1, 7696 },
+  { 0x1d636, 7697, 0, 1, 7697 },
+  { 0x1d637, 7698, 0, 1, 7698 },
+  { 0x1d638, 7699, 0, 1, 7699 },
+  { 0x1d639, 7700, 0, 1, 7700 },
+  { 0x1d63a, 7701, 0, 1, 7701 },
+  { 0x1d63b, 7702, 0, 1, 7702 },
+  { 0x1d63c, 7703, 0, 1, 7703 },
+  { 0x1d63d, 7704, 0, 1, 7704 },
+  { 0x1d63e, 7705, 0, 1, 7705 },
+  { 0x1d63f, 7706, 0, 1, 7706 },
+  { 0x1d640, 7707, 0, 1, 7707 },
+  { 0x1d641, 7708, 0, 1, 7708 },
+  { 0x1d642, 7709, 0, 1, 7709 },
+  { 0x1d643, 7710, 0, 1, 7710 },
+  { 0x1d644, 7711, 0, 1, 7711 },
+  { 0x1d645, 7712, 0, 1, 7712 },
+  { 0x1d646, 7713, 0, 1, 7713 },
+  { 0x1d647, 7714, 0, 1, 7714 },
+  { 0x1d648, 7715, 0, 1, 7715 },
+  { 0x1d649, 7716, 0, 1, 7716 },
+  { 0x1d64a, 7717, 0, 1, 7717 },
+  { 0x1d64b, 7718, 0, 1, 7718 },
+  { 0x1d64c, 7719, 0, 1, 7719 },
+  { 0x1d64d, 7720, 0, 1, 7720 },
+  { 0x1d64e, 7721, 0, 1, 7721 },
+  { 0x1d64f, 7722, 0, 1, 7722 },
+  { 0x1d650, 7723, 0, 1, 7723 },
+  { 0x1d651, 7724, 0, 1, 7724 },
+  { 0x1d652, 7725, 0, 1, 7725 },
+  { 0x1d653, 7726, 0, 1, 7726 },
+  { 0x1d654, 7727, 0, 1, 7727 },
+  { 0x1d655, 7728, 0, 1, 7728 },
+  { 0x1d656, 7729, 0, 1, 7729 },
+  { 0x1d657, 7730, 0, 1, 7730 },
+  { 0x1d658, 7731, 0, 1, 7731 },
+  { 0x1d659, 7732, 0, 1, 7732 },
+  { 0x1d65a, 7733, 0, 1, 7733 },
+  { 0x1d65b, 7734, 0, 1, 7734 },
+  { 0x1d65c, 7735, 0, 1, 7735 },
+  { 0x1d65d, 7736, 0, 1, 7736 },
+  { 0x1d65e, 7737, 0, 1, 7737 },
+  { 0x1d65f, 7738, 0, 1, 7738 },
+  { 0x1d660, 7739, 0, 1, 7739 },
+  { 0x1d661, 7740, 0, 1, 7740 },
+  { 0x1d662, 7741, 0, 1, 7741 },
+  { 0x1d663, 7742, 0, 1, 7742 },
+  { 0x1d664, 7743, 0, 1, 7743 },
+  { 0x1d665, 7744, 0, 1, 7744 },
+  { 0x1d666, 7745, 0, 1, 7745 },
+  { 0x1d667, 7746, 0, 1, 7746 },
+  { 0x1d668, 7747, 0, 1, 7747 },
+  { 0x1d669, 7748, 0, 1, 7748 },
+  { 0x1d66a, 7749, 0, 1, 7749 },
+  { 0x1d66b, 7750, 0, 1, 7750 },
+  { 0x1d66c, 7751, 0, 1, 7751 },
+  { 0x1d66d, 7752, 0, 1, 7752 },
+  { 0x1d66e, 7753, 0, 1, 7753 },
+  { 0x1d66f, 7754, 0, 1, 7754 },
+  { 0x1d670, 7755, 0, 1, 7755 },
+  { 0x1d671, 7756, 0, 1, 7756 },
+  { 0x1d672, 7757, 0, 1, 7757 },
+  { 0x1d673, 7758, 0, 1, 7758 },
+  { 0x1d674, 7759, 0, 1, 7759 },
+  { 0x1d675, 7760, 0, 1, 7760 },
+  { 0x1d676, 7761, 0, 1, 7761 },
+  { 0x1d677, 7762, 0, 1, 7762 },
+  { 0x1d678, 7763, 0, 1, 7763 },
+  { 0x1d679, 7764, 0, 1, 7764 },
+  { 0x1d67a, 7765, 0, 1, 7765 },
+  { 0x1d67b, 7766, 0, 1, 7766 },
+  { 0x1d67c, 7767, 0, 1, 7767 },
+  { 0x1d67d, 7768, 0, 1, 7768 },
+  { 0x1d67e, 7769, 0, 1, 7769 },
+  { 0x1d67f, 7770, 0, 1, 7770 },
+  { 0x1d680, 7771, 0, 1, 7771 },
+  { 0x1d681, 7772, 0, 1, 7772 },
+  { 0x1d682, 7773, 0, 1, 7773 },
+  { 0x1d683, 7774, 0, 1, 7774 },
+  { 0x1d684, 7775, 0, 1, 7775 },
+  { 0x1d685, 7776, 0, 1, 7776 },
+  { 0x1d686, 7777, 0, 1, 7777 },
+  { 0x1d687, 7778, 0, 1, 7778 },
+  { 0x1d688, 7779, 0, 1, 7779 },
+  { 0x1d689, 7780, 0, 1, 7780 },
+  { 0x1d68a, 7781, 0, 1, 7781 },
+  { 0x1d68b, 7782, 0, 1, 7782 },
+  { 0x1d68c, 7783, 0, 1, 7783 },
+  { 0x1d68d, 7784, 0, 1, 7784 },
+  { 0x1d68e, 7785, 0, 1, 7785 },
+  { 0x1d68f, 7786, 0, 1, 7786 },
+  { 0x1d690, 7787, 0, 1, 7787 },
+  { 0x1d691, 7788, 0, 1, 7788 },
+  { 0x1d692, 7789, 0, 1, 7789 },
+  { 0x1d693, 7790, 0, 1, 7790 },
+  { 0x1d694, 7791, 0, 1, 7791 },
+  { 0x1d695, 7792, 0, 1, 7792 },
+  { 0x1d696, 7793, 0, 1, 7793 },
+  { 0x1d697, 7794, 0, 1, 7794 },
+  { 0x1d698, 7795, 0, 1, 7795 },
+  { 0x1d699, 7796, 0, 1, 7796 },
+  { 0x1d69a, 7797, 0, 1, 7797 },
+  { 0x1d69b, 7798, 0, 1, 7798 },
+  { 0x1d69c, 7799, 0, 1, 7799 },
+  { 0x1d69d, 7800, 0, 1, 7800 },
+  { 0x1d69e, 7801, 0, 1, 7801 },
+  { 0x1d69f, 7802, 0, 1, 7802 },
+  { 0x1d6a0, 7803, 0, 1, 7803 },
+  { 0x1d6a1, 7804, 0, 1, 7804 },
+  { 0x1d6a2, 7805, 0, 1, 7805 },
+  { 0x1d6a3, 7806, 0, 1, 7806 },
+  { 0x1d6a4, 7807, 0, 1, 7807 },
+  { 0x1d6a5, 7808, 0, 1, 7808 },
+  { 0x1d6a8, 7809, 0, 1, 7809 },
+  { 0x1d6a9, 7810, 0, 1, 7810 },
+  { 0x1d6aa, 7811, 0, 1, 7811 },
+  { 0x1d6ab, 7812, 0, 1, 7812 },
+  { 0x1d6ac, 7813, 0, 1, 7813 },
+  { 0x1d6ad, 7814, 0, 1, 7814 },
+  { 0x1d6ae, 7815, 0, 1, 7815 },
+  { 0x1d6af, 7816, 0, 1, 7816 },
+  { 0x1d6b0, 7817, 0, 1, 7817 },
+  { 0x1d6b1, 7818, 0, 1, 7818 },
+  { 0x1d6b2, 7819, 0, 1, 7819 },
+  { 0x1d6b3, 7820, 0, 1, 7820 },
+  { 0x1d6b4, 7821, 0, 1, 7821 },
+  { 0x1d6b5, 7822, 0, 1, 7822 },
+  { 0x1d6b6, 7823, 0, 1, 7823 },
+  { 0x1d6b7, 7824, 0, 1, 7824 },
+  { 0x1d6b8, 7825, 0, 1, 7825 },
+  { 0x1d6b9, 7826, 0, 1, 7826 },
+  { 0x1d6ba, 7827, 0, 1, 7827 },
+  { 0x1d6bb, 7828, 0, 1, 7828 },
+  { 0x1d6bc, 7829, 0, 1, 7829 },
+  { 0x1d6bd, 7830, 0, 1, 7830 },
+  { 0x1d6be, 7831, 0, 1, 7831 },
+  { 0x1d6bf, 7832, 0, 1, 7832 },
+  { 0x1d6c0, 7833, 0, 1, 7833 },
+  { 0x1d6c1, 7834, 0, 1, 7834 },
+  { 0x1d6c2, 7835, 0, 1, 7835 },
+  { 0x1d6c3, 7836, 0, 1, 7836 },
+  { 0x1d6c4, 7837, 0, 1, 7837 },
+  { 0x1d6c5, 7838, 0, 1, 7838 },
+  { 0x1d6c6, 7839, 0, 1, 7839 },
+  { 0x1d6c7, 7840, 0, 1, 7840 },
+  { 0x1d6c8, 7841, 0, 1, 7841 },
+  { 0x1d6c9, 7842, 0, 1, 7842 },
+  { 0x1d6ca, 7843, 0, 1, 7843 },
+  { 0x1d6cb, 7844, 0, 1, 7844 },
+  { 0x1d6cc, 7845, 0, 1, 7845 },
+  { 0x1d6cd, 7846, 0, 1, 7846 },
+  { 0x1d6ce, 7847, 0, 1, 7847 },
+  { 0x1d6cf, 7848, 0, 1, 7848 },
+  { 0x1d6d0, 7849, 0, 1, 7849 },
+  { 0x1d6d1, 7850, 0, 1, 7850 },
+  { 0x1d6d2, 7851, 0, 1, 7851 },
+  { 0x1d6d3, 7852, 0, 1, 7852 },
+  { 0x1d6d4, 7853, 0, 1, 7853 },
+  { 0x1d6d5, 7854, 0, 1, 7854 },
+  { 0x1d6d6, 7855, 0, 1, 7855 },
+  { 0x1d6d7, 7856, 0, 1, 7856 },
+  { 0x1d6d8, 7857, 0, 1, 7857 },
+  { 0x1d6d9, 7858, 0, 1, 7858 },
+  { 0x1d6da, 7859, 0, 1, 7859 },
+  { 0x1d6db, 7860, 0, 1, 7860 },
+  { 0x1d6dc, 7861, 0, 1, 7861 },
+  { 0x1d6dd, 7862, 0, 1, 7862 },
+  { 0x1d6de, 7863, 0, 1, 7863 },
+  { 0x1d6df, 7864, 0, 1, 7864 },
+  { 0x1d6e0, 7865, 0, 1, 7865 },
+  { 0x1d6e1, 7866, 0, 1, 7866 },
+  { 0x1d6e2, 7867, 0, 1, 7867 },
+  { 0x1d6e3, 7868, 0, 1, 7868 },
+  { 0x1d6e4, 7869, 0, 1, 7869 },
+  { 0x1d6e5, 7870, 0, 1, 7870 },
+  { 0x1d6e6, 7871, 0, 1, 7871 },
+  { 0x1d6e7, 7872, 0, 1, 7872 },
+  { 0x1d6e8, 7873, 0, 1, 7873 },
+  { 0x1d6e9, 7874, 0, 1, 7874 },
+  { 0x1d6ea, 7875, 0, 1, 7875 },
+  { 0x1d6eb, 7876, 0, 1, 7876 },
+  { 0x1d6ec, 7877, 0, 1, 7877 },
+  { 0x1d6ed, 7878, 0, 1, 7878 },
+  { 0x1d6ee, 7879, 0, 1, 7879 },
+  { 0x1d6ef, 7880, 0, 1, 7880 },
+  { 0x1d6f0, 7881, 0, 1, 7881 },
+  { 0x1d6f1, 7882, 0, 1, 7882 },
+  { 0x1d6f2, 7883, 0, 1, 7883 },
+  { 0x1d6f3, 7884, 0, 1, 7884 },
+  { 0x1d6f4, 7885, 0, 1, 7885 },
+  { 0x1d6f5, 7886, 0, 1, 7886 },
+  { 0x1d6f6, 7887, 0, 1, 7887 },
+  { 0x1d6f7, 7888, 0, 1, 7888 },
+  { 0x1d6f8, 7889, 0, 1, 7889 },
+  { 0x1d6f9, 7890, 0, 1, 7890 },
+  { 0x1d6fa, 7891, 0, 1, 7891 },
+  { 0x1d6fb, 7892, 0, 1, 7892 },
+  { 0x1d6fc, 7893, 0, 1, 7893 },
+  { 0x1d6fd, 7894, 0, 1, 7894 },
+  { 0x1d6fe, 7895, 0, 1, 7895 },
+  { 0x1d6ff, 7896, 0, 1, 7896 },
+  { 0x1d700, 7897, 0, 1, 7897 },
+  { 0x1d701, 7898, 0, 1, 7898 },
+  { 0x1d702, 7899, 0, 1, 7899 },
+  { 0x1d703, 7900, 0, 1, 7900 },
+  { 0x1d704, 7901, 0, 1, 7901 },
+  { 0x1d705, 7902, 0, 1, 7902 },
+  { 0x1d706, 7903, 0, 1, 7903 },
+  { 0x1d707, 7904, 0, 1, 7904 },
+  { 0x1d708, 7905, 0, 1, 7905 },
+  { 0x1d709, 7906, 0, 1, 7906 },
+  { 0x1d70a, 7907, 0, 1, 7907 },
+  { 0x1d70b, 7908, 0, 1, 7908 },
+  { 0x1d70c, 7909, 0, 1, 7909 },
+  { 0x1d70d, 7910, 0, 1, 7910 },
+  { 0x1d70e, 7911, 0, 1, 7911 },
+  { 0x1d70f, 7912, 0, 1, 7912 },
+  { 0x1d710, 7913, 0, 1, 7913 },
+  { 0x1d711, 7914, 0, 1, 7914 },
+  { 0x1d712, 7915, 0, 1, 7915 },
+  { 0x1d713, 7916, 0, 1, 7916 },
+  { 0x1d714, 7917, 0, 1, 7917 },
+  { 0x1d715, 7918, 0, 1, 7918 },
+  { 0x1d716, 7919, 0, 1, 7919 },
+  { 0x1d717, 7920, 0, 1, 7920 },
+  { 0x1d718, 7921, 0, 1, 7921 },
+  { 0x1d719, 7922, 0, 1, 7922 },
+  { 0x1d71a, 7923, 0, 1, 7923 },
+  { 0x1d71b, 7924, 0, 1, 7924 },
+  { 0x1d71c, 7925, 0, 1, 7925 },
+  { 0x1d71d, 7926, 0, 1, 7926 },
+  { 0x1d71e, 7927, 0, 1, 7927 },
+  { 0x1d71f, 7928, 0, 1, 7928 },
+  { 0x1d720, 7929, 0, 1, 7929 },
+  { 0x1d721, 7930, 0, 1, 7930 },
+  { 0x1d722, 7931, 0, 1, 7931 },
+  { 0x1d723, 7932, 0, 1, 7932 },
+  { 0x1d724, 7933, 0, 1, 7933 },
+  { 0x1d725, 7934, 0, 1, 7934 },
+  { 0x1d726, 7935, 0, 1, 7935 },
+  { 0x1d727, 7936, 0, 1, 7936 },
+  { 0x1d728, 7937, 0, 1, 7937 },
+  { 0x1d729, 7938, 0, 1, 7938 },
+  { 0x1d72a, 7939, 0, 1, 7939 },
+  { 0x1d72b, 7940, 0, 1, 7940 },
+  { 0x1d72c, 7941, 0, 1, 7941 },
+  { 0x1d72d, 7942, 0, 1, 7942 },
+  { 0x1d72e, 7943, 0, 1, 7943 },
+  { 0x1d72f, 7944, 0, 1, 7944 },
+  { 0x1d730, 7945, 0, 1, 7945 },
+  { 0x1d731, 7946, 0, 1, 7946 },
+  { 0x1d732, 7947, 0, 1, 7947 },
+  { 0x1d733, 7948, 0, 1, 7948 },
+  { 0x1d734, 7949, 0, 1, 7949 },
+  { 0x1d735, 7950, 0, 1, 7950 },
+  { 0x1d736, 7951, 0, 1, 7951 },
+  { 0x1d737, 7952, 0, 1, 7952 },
+  { 0x1d738, 7953, 0, 1, 7953 },
+  { 0x1d739, 7954, 0, 1, 7954 },
+  { 0x1d73a, 7955, 0, 1, 7955 },
+  { 0x1d73b, 7956, 0, 1, 7956 },
+  { 0x1d73c, 7957, 0, 1, 7957 },
+  { 0x1d73d, 7958, 0, 1, 7958 },
+  { 0x1d73e, 7959, 0, 1, 7959 },
+  { 0x1d73f, 7960, 0, 1, 7960 },
+  { 0x1d740, 7961, 0, 1, 7961 },
+  { 0x1d741, 7962, 0, 1, 7962 },
+  { 0x1d742, 7963, 0, 1, 7963 },
+  { 0x1d743, 7964, 0, 1, 7964 },
+  { 0x1d744, 7965, 0, 1, 7965 },
+  { 0x1d745, 7966, 0, 1, 7966 },
+  { 0x1d746, 7967, 0, 1, 7967 },
+  { 0x1d747, 7968, 0, 1, 7968 },
+  { 0x1d748, 7969, 0, 1, 7969 },
+  { 0x1d749, 7970, 0, 1, 7970 },
+  { 0x1d74a, 7971, 0, 1, 7971 },
+  { 0x1d74b, 7972, 0, 1, 7972 },
+  { 0x1d74c, 7973, 0, 1, 7973 },
+  { 0x1d74d, 7974, 0, 1, 7974 },
+  { 0x1d74e, 7975, 0, 1, 7975 },
+  { 0x1d74f, 7976, 0, 1, 7976 },
+  { 0x1d750, 7977, 0, 1, 7977 },
+  { 0x1d751, 7978, 0, 1, 7978 },
+  { 0x1d752, 7979, 0, 1, 7979 },
+  { 0x1d753, 7980, 0, 1, 7980 },
+  { 0x1d754, 7981, 0, 1, 7981 },
+  { 0x1d755, 7982, 0, 1, 7982 },
+  { 0x1d756, 7983, 0, 1, 7983 },
+  { 0x1d757, 7984, 0, 1, 7984 },
+  { 0x1d758, 7985, 0, 1, 7985 },
+  { 0x1d759, 7986, 0, 1, 7986 },
+  { 0x1d75a, 7987, 0, 1, 7987 },
+  { 0x1d75b, 7988, 0, 1, 7988 },
+  { 0x1d75c, 7989, 0, 1, 7989 },
+  { 0x1d75d, 7990, 0, 1, 7990 },
+  { 0x1d75e, 7991, 0, 1, 7991 },
+  { 0x1d75f, 7992, 0, 1, 7992 },
+  { 0x1d760, 7993, 0, 1, 7993 },
+  { 0x1d761, 7994, 0, 1, 7994 },
+  { 0x1d762, 7995, 0, 1, 7995 },
+  { 0x1d763, 7996, 0, 1, 7996 },
+  { 0x1d764, 7997, 0, 1, 7997 },
+  { 0x1d765, 7998, 0, 1, 7998 },
+  { 0x1d766, 7999, 0, 1, 7999 },
+  { 0x1d767, 8000, 0, 1, 8000 },
+  { 0x1d768, 8001, 0, 1, 8001 },
+  { 0x1d769, 8002, 0, 1, 8002 },
+  { 0x1d76a, 8003, 0, 1, 8003 },
+  { 0x1d76b, 8004, 0, 1, 8004 },
+  { 0x1d76c, 8005, 0, 1, 8005 },
+  { 0x1d76d, 8006, 0, 1, 8006 },
+  { 0x1d76e, 8007, 0, 1, 8007 },
+  { 0x1d76f, 8008, 0, 1, 8008 },
+  { 0x1d770, 8009, 0, 1, 8009 },
+  { 0x1d771, 8010, 0, 1, 8010 },
+  { 0x1d772, 8011, 0, 1, 8011 },
+  { 0x1d773, 8012, 0, 1, 8012 },
+  { 0x1d774, 8013, 0, 1, 8013 },
+  { 0x1d775, 8014, 0, 1, 8014 },
+  { 0x1d776, 8015, 0, 1, 8015 },
+  { 0x1d777, 8016, 0, 1, 8016 },
+  { 0x1d778, 8017, 0, 1, 8017 },
+  { 0x1d779, 8018, 0, 1, 8018 },
+  { 0x1d77a, 8019, 0, 1, 8019 },
+  { 0x1d77b, 8020, 0, 1, 8020 },
+  { 0x1d77c, 8021, 0, 1, 8021 },
+  { 0x1d77d, 8022, 0, 1, 8022 },
+  { 0x1d77e, 8023, 0, 1, 8023 },
+  { 0x1d77f, 8024, 0, 1, 8024 },
+  { 0x1d780, 8025, 0, 1, 8025 },
+  { 0x1d781, 8026, 0, 1, 8026 },
+  { 0x1d782, 8027, 0, 1, 8027 },
+  { 0x1d783, 8028, 0, 1, 8028 },
+  { 0x1d784, 8029, 0, 1, 8029 },
+  { 0x1d785, 8030, 0, 1, 8030 },
+  { 0x1d786, 8031, 0, 1, 8031 },
+  { 0x1d787, 8032, 0, 1, 8032 },
+  { 0x1d788, 8033, 0, 1, 8033 },
+  { 0x1d789, 8034, 0, 1, 8034 },
+  { 0x1d78a, 8035, 0, 1, 8035 },
+  { 0x1d78b, 8036, 0, 1, 8036 },
+  { 0x1d78c, 8037, 0, 1, 8037 },
+  { 0x1d78d, 8038, 0, 1, 8038 },
+  { 0x1d78e, 8039, 0, 1, 8039 },
+  { 0x1d78f, 8040, 0, 1, 8040 },
+  { 0x1d790, 8041, 0, 1, 8041 },
+  { 0x1d791, 8042, 0, 1, 8042 },
+  { 0x1d792, 8043, 0, 1, 8043 },
+  { 0x1d793, 8044, 0, 1, 8044 },
+  { 0x1d794, 8045, 0, 1, 8045 },
+  { 0x1d795, 8046, 0, 1, 8046 },
+  { 0x1d796, 8047, 0, 1, 8047 },
+  { 0x1d797, 8048, 0, 1, 8048 },
+  { 0x1d798, 8049, 0, 1, 8049 },
+  { 0x1d799, 8050, 0, 1, 8050 },
+  { 0x1d79a, 8051, 0, 1, 8051 },
+  { 0x1d79b, 8052, 0, 1, 8052 },
+  { 0x1d79c, 8053, 0, 1, 8053 },
+  { 0x1d79d, 8054, 0, 1, 8054 },
+  { 0x1d79e, 8055, 0, 1, 8055 },
+  { 0x1d79f, 8056, 0, 1, 8056 },
+  { 0x1d7a0, 8057, 0, 1, 8057 },
+  { 0x1d7a1, 8058, 0, 1, 8058 },
+  { 0x1d7a2, 8059, 0, 1, 8059 },
+  { 0x1d7a3, 8060, 0, 1, 8060 },
+  { 0x1d7a4, 8061, 0, 1, 8061 },
+  { 0x1d7a5, 8062, 0, 1, 8062 },
+  { 0x1d7a6, 8063, 0, 1, 8063 },
+  { 0x1d7a7, 8064, 0, 1, 8064 },
+  { 0x1d7a8, 8065, 0, 1, 8065 },
+  { 0x1d7a9, 8066, 0, 1, 8066 },
+  { 0x1d7aa, 8067, 0, 1, 8067 },
+  { 0x1d7ab, 8068, 0, 1, 8068 },
+  { 0x1d7ac, 8069, 0, 1, 8069 },
+  { 0x1d7ad, 8070, 0, 1, 8070 },
+  { 0x1d7ae, 8071, 0, 1, 8071 },
+  { 0x1d7af, 8072, 0, 1, 8072 },
+  { 0x1d7b0, 8073, 0, 1, 8073 },
+  { 0x1d7b1, 8074, 0, 1, 8074 },
+  { 0x1d7b2, 8075, 0, 1, 8075 },
+  { 0x1d7b3, 8076, 0, 1, 8076 },
+  { 0x1d7b4, 8077, 0, 1, 8077 },
+  { 0x1d7b5, 8078, 0, 1, 8078 },
+  { 0x1d7b6, 8079, 0, 1, 8079 },
+  { 0x1d7b7, 8080, 0, 1, 8080 },
+  { 0x1d7b8, 8081, 0, 1, 8081 },
+  { 0x1d7b9, 8082, 0, 1, 8082 },
+  { 0x1d7ba, 8083, 0, 1, 8083 },
+  { 0x1d7bb, 8084, 0, 1, 8084 },
+  { 0x1d7bc, 8085, 0, 1, 8085 },
+  { 0x1d7bd, 8086, 0, 1, 8086 },
+  { 0x1d7be, 8087, 0, 1, 8087 },
+  { 0x1d7bf, 8088, 0, 1, 8088 },
+  { 0x1d7c0, 8089, 0, 1, 8089 },
+  { 0x1d7c1, 8090, 0, 1, 8090 },
+  { 0x1d7c2, 8091, 0, 1, 8091 },
+  { 0x1d7c3, 8092, 0, 1, 8092 },
+  { 0x1d7c4, 8093, 0, 1, 8093 },
+  { 0x1d7c5, 8094, 0, 1, 8094 },
+  { 0x1d7c6, 8095, 0, 1, 8095 },
+  { 0x1d7c7, 8096, 0, 1, 8096 },
+  { 0x1d7c8, 8097, 0, 1, 8097 },
+  { 0x1d7c9, 8098, 0, 1, 8098 },
+  { 0x1d7ca, 8099, 0, 1, 8099 },
+  { 0x1d7cb, 8100, 0, 1, 8100 },
+  { 0x1d7ce, 8101, 0, 1, 8101 },
+  { 0x1d7cf, 8102, 0, 1, 8102 },
+  { 0x1d7d0, 8103, 0, 1, 8103 },
+  { 0x1d7d1, 8104, 0, 1, 8104 },
+  { 0x1d7d2, 8105, 0, 1, 8105 },
+  { 0x1d7d3, 8106, 0, 1, 8106 },
+  { 0x1d7d4, 8107, 0, 1, 8107 },
+  { 0x1d7d5, 8108, 0, 1, 8108 },
+  { 0x1d7d6, 8109, 0, 1, 8109 },
+  { 0x1d7d7, 8110, 0, 1, 8110 },
+  { 0x1d7d8, 8111, 0, 1, 8111 },
+  { 0x1d7d9, 8112, 0, 1, 8112 },
+  { 0x1d7da, 8113, 0, 1, 8113 },
+  { 0x1d7db, 8114, 0, 1, 8114 },
+  { 0x1d7dc, 8115, 0, 1, 8115 },
+  { 0x1d7dd, 8116, 0, 1, 8116 },
+  { 0x1d7de, 8117, 0, 1, 8117 },
+  { 0x1d7df, 8118, 0, 1, 8118 },
+  { 0x1d7e0, 8119, 0, 1, 8119 },
+  { 0x1d7e1, 8120, 0, 1, 8120 },
+  { 0x1d7e2, 8121, 0, 1, 8121 },
+  { 0x1d7e3, 8122, 0, 1, 8122 },
+  { 0x1d7e4, 8123, 0, 1, 8123 },
+  { 0x1d7e5, 8124, 0, 1, 8124 },
+  { 0x1d7e6, 8125, 0, 1, 8125 },
+  { 0x1d7e7, 8126, 0, 1, 8126 },
+  { 0x1d7e8, 8127, 0, 1, 8127 },
+  { 0x1d7e9, 8128, 0, 1, 8128 },
+  { 0x1d7ea, 8129, 0, 1, 8129 },
+  { 0x1d7eb, 8130, 0, 1, 8130 },
+  { 0x1d7ec, 8131, 0, 1, 8131 },
+  { 0x1d7ed, 8132, 0, 1, 8132 },
+  { 0x1d7ee, 8133, 0, 1, 8133 },
+  { 0x1d7ef, 8134, 0, 1, 8134 },
+  { 0x1d7f0, 8135, 0, 1, 8135 },
+  { 0x1d7f1, 8136, 0, 1, 8136 },
+  { 0x1d7f2, 8137, 0, 1, 8137 },
+  { 0x1d7f3, 8138, 0, 1, 8138 },
+  { 0x1d7f4, 8139, 0, 1, 8139 },
+  { 0x1d7f5, 8140, 0, 1, 8140 },
+  { 0x1d7f6, 8141, 0, 1, 8141 },
+  { 0x1d7f7, 8142, 0, 1, 8142 },
+  { 0x1d7f8, 8143, 0, 1, 8143 },
+  { 0x1d7f9, 8144, 0, 1, 8144 },
+  { 0x1d7fa, 8145, 0, 1, 8145 },
+  { 0x1d7fb, 8146, 0, 1, 8146 },
+  { 0x1d7fc, 8147, 0, 1, 8147 },
+  { 0x1d7fd, 8148, 0, 1, 8148 },
+  { 0x1d7fe, 8149, 0, 1, 8149 },
+  { 0x1d7ff, 8150, 0, 1, 8150 },
+  { 0x1ee00, 8151, 0, 1, 8151 },
+  { 0x1ee01, 8152, 0, 1, 8152 },
+  { 0x1ee02, 8153, 0, 1, 8153 },
+  { 0x1ee03, 8154, 0, 1, 8154 },
+  { 0x1ee05, 8155, 0, 1, 8155 },
+  { 0x1ee06, 8156, 0, 1, 8156 },
+  { 0x1ee07, 8157, 0, 1, 8157 },
+  { 0x1ee08, 8158, 0, 1, 8158 },
+  { 0x1ee09, 8159, 0, 1, 8159 },
+  { 0x1ee0a, 8160, 0, 1, 8160 },
+  { 0x1ee0b, 8161, 0, 1, 8161 },
+  { 0x1ee0c, 8162, 0, 1, 8162 },
+  { 0x1ee0d, 8163, 0, 1, 8163 },
+  { 0x1ee0e, 8164, 0, 1, 8164 },
+  { 0x1ee0f, 8165, 0, 1, 8165 },
+  { 0x1ee10, 8166, 0, 1, 8166 },
+  { 0x1ee11, 8167, 0, 1, 8167 },
+  { 0x1ee12, 8168, 0, 1, 8168 },
+  { 0x1ee13, 8169, 0, 1, 8169 },
+  { 0x1ee14, 8170, 0, 1, 8170 },
+  { 0x1ee15, 8171, 0, 1, 8171 },
+  { 0x1ee16, 8172, 0, 1, 8172 },
+  { 0x1ee17, 8173, 0, 1, 8173 },
+  { 0x1ee18, 8174, 0, 1, 8174 },
+  { 0x1ee19, 8175, 0, 1, 8175 },
+  { 0x1ee1a, 8176, 0, 1, 8176 },
+  { 0x1ee1b, 8177, 0, 1, 8177 },
+  { 0x1ee1c, 8178, 0, 1, 8178 },
+  { 0x1ee1d, 8179, 0, 1, 8179 },
+  { 0x1ee1e, 8180, 0, 1, 8180 },
+  { 0x1ee1f, 8181, 0, 1, 8181 },
+  { 0x1ee21, 8182, 0, 1, 8182 },
+  { 0x1ee22, 8183, 0, 1, 8183 },
+  { 0x1ee24, 8184, 0, 1, 8184 },
+  { 0x1ee27, 8185, 0, 1, 8185 },
+  { 0x1ee29, 8186, 0, 1, 8186 },
+  { 0x1ee2a, 8187, 0, 1, 8187 },
+  { 0x1ee2b, 8188, 0, 1, 8188 },
+  { 0x1ee2c, 8189, 0, 1, 8189 },
+  { 0x1ee2d, 8190, 0, 1, 8190 },
+  { 0x1ee2e, 8191, 0, 1, 8191 },
+  { 0x1ee2f, 8192, 0, 1, 8192 },
+  { 0x1ee30, 8193, 0, 1, 8193 },
+  { 0x1ee31, 8194, 0, 1, 8194 },
+  { 0x1ee32, 8195, 0, 1, 8195 },
+  { 0x1ee34, 8196, 0, 1, 8196 },
+  { 0x1ee35, 8197, 0, 1, 8197 },
+  { 0x1ee36, 8198, 0, 1, 8198 },
+  { 0x1ee37, 8199, 0, 1, 8199 },
+  { 0x1ee39, 8200, 0, 1, 8200 },
+  { 0x1ee3b, 8201, 0, 1, 8201 },
+  { 0x1ee42, 8202, 0, 1, 8202 },
+  { 0x1ee47, 8203, 0, 1, 8203 },
+  { 0x1ee49, 8204, 0, 1, 8204 },
+  { 0x1ee4b, 8205, 0, 1, 8205 },
+  { 0x1ee4d, 8206, 0, 1, 8206 },
+  { 0x1ee4e, 8207, 0, 1, 8207 },
+  { 0x1ee4f, 8208, 0, 1, 8208 },
+  { 0x1ee51, 8209, 0, 1, 8209 },
+  { 0x1ee52, 8210, 0, 1, 8210 },
+  { 0x1ee54, 8211, 0, 1, 8211 },
+  { 0x1ee57, 8212, 0, 1, 8212 },
+  { 0x1ee59, 8213, 0, 1, 8213 },
+  { 0x1ee5b, 8214, 0, 1, 8214 },
+  { 0x1ee5d, 8215, 0, 1, 8215 },
+  { 0x1ee5f, 8216, 0, 1, 8216 },
+  { 0x1ee61, 8217, 0, 1, 8217 },
+  { 0x1ee62, 8218, 0, 1, 8218 },
+  { 0x1ee64, 8219, 0, 1, 8219 },
+  { 0x1ee67, 8220, 0, 1, 8220 },
+  { 0x1ee68, 8221, 0, 1, 8221 },
+  { 0x1ee69, 8222, 0, 1, 8222 },
+  { 0x1ee6a, 8223, 0, 1, 8223 },
+  { 0x1ee6c, 8224, 0, 1, 8224 },
+  { 0x1ee6d, 8225, 0, 1, 8225 },
+  { 0x1ee6e, 8226, 0, 1, 8226 },
+  { 0x1ee6f, 8227, 0, 1, 8227 },
+  { 0x1ee70, 8228, 0, 1, 8228 },
+  { 0x1ee71, 8229, 0, 1, 8229 },
+  { 0x1ee72, 8230, 0, 1, 8230 },
+  { 0x1ee74, 8231, 0, 1, 8231 },
+  { 0x1ee75, 8232, 0, 1, 8232 },
+  { 0x1ee76, 8233, 0, 1, 8233 },
+  { 0x1ee77, 8234, 0, 1, 8234 },
+  { 0x1ee79, 8235, 0, 1, 8235 },
+  { 0x1ee7a, 8236, 0, 1, 8236 },
+  { 0x1ee7b, 8237, 0, 1, 8237 },
+  { 0x1ee7c, 8238, 0, 1, 8238 },
+  { 0x1ee7e, 8239, 0, 1, 8239 },
+  { 0x1ee80, 8240, 0, 1, 8240 },
+  { 0x1ee81, 8241, 0, 1, 8241 },
+  { 0x1ee82, 8242, 0, 1, 8242 },
+  { 0x1ee83, 8243, 0, 1, 8243 },
+  { 0x1ee84, 8244, 0, 1, 8244 },
+  { 0x1ee85, 8245, 0, 1, 8245 },
+  { 0x1ee86, 8246, 0, 1, 8246 },
+  { 0x1ee87, 8247, 0, 1, 8247 },
+  { 0x1ee88, 8248, 0, 1, 8248 },
+  { 0x1ee89, 8249, 0, 1, 8249 },
+  { 0x1ee8b, 8250, 0, 1, 8250 },
+  { 0x1ee8c, 8251, 0, 1, 8251 },
+  { 0x1ee8d, 8252, 0, 1, 8252 },
+  { 0x1ee8e, 8253, 0, 1, 8253 },
+  { 0x1ee8f, 8254, 0, 1, 8254 },
+  { 0x1ee90, 8255, 0, 1, 8255 },
+  { 0x1ee91, 8256, 0, 1, 8256 },
+  { 0x1ee92, 8257, 0, 1, 8257 },
+  { 0x1ee93, 8258, 0, 1, 8258 },
+  { 0x1ee94, 8259, 0, 1, 8259 },
+  { 0x1ee95, 8260, 0, 1, 8260 },
+  { 0x1ee96, 8261, 0, 1, 8261 },
+  { 0x1ee97, 8262, 0, 1, 8262 },
+  { 0x1ee98, 8263, 0, 1, 8263 },
+  { 0x1ee99, 8264, 0, 1, 8264 },
+  { 0x1ee9a, 8265, 0, 1, 8265 },
+  { 0x1ee9b, 8266, 0, 1, 8266 },
+  { 0x1eea1, 8267, 0, 1, 8267 },
+  { 0x1eea2, 8268, 0, 1, 8268 },
+  { 0x1eea3, 8269, 0, 1, 8269 },
+  { 0x1eea5, 8270, 0, 1, 8270 },
+  { 0x1eea6, 8271, 0, 1, 8271 },
+  { 0x1eea7, 8272, 0, 1, 8272 },
+  { 0x1eea8, 8273, 0, 1, 8273 },
+  { 0x1eea9, 8274, 0, 1, 8274 },
+  { 0x1eeab, 8275, 0, 1, 8275 },
+  { 0x1eeac, 8276, 0, 1, 8276 },
+  { 0x1eead, 8277, 0, 1, 8277 },
+  { 0x1eeae, 8278, 0, 1, 8278 },
+  { 0x1eeaf, 8279, 0, 1, 8279 },
+  { 0x1eeb0, 8280, 0, 1, 8280 },
+  { 0x1eeb1, 8281, 0, 1, 8281 },
+  { 0x1eeb2, 8282, 0, 1, 8282 },
+  { 0x1eeb3, 8283, 0, 1, 8283 },
+  { 0x1eeb4, 8284, 0, 1, 8284 },
+  { 0x1eeb5, 8285, 0, 1, 8285 },
+  { 0x1eeb6, 8286, 0, 1, 8286 },
+  { 0x1eeb7, 8287, 0, 1, 8287 },
+  { 0x1eeb8, 8288, 0, 1, 8288 },
+  { 0x1eeb9, 8289, 0, 1, 8289 },
+  { 0x1eeba, 8290, 0, 1, 8290 },
+  { 0x1eebb, 8291, 0, 1, 8291 },
+  { 0x1f100, 8292, 0, 2, 8292 },
+  { 0x1f101, 8294, 0, 2, 8294 },
+  { 0x1f102, 8296, 0, 2, 8296 },
+  { 0x1f103, 8298, 0, 2, 8298 },
+  { 0x1f104, 8300, 0, 2, 8300 },
+  { 0x1f105, 8302, 0, 2, 8302 },
+  { 0x1f106, 8304, 0, 2, 8304 },
+  { 0x1f107, 8306, 0, 2, 8306 },
+  { 0x1f108, 8308, 0, 2, 8308 },
+  { 0x1f109, 8310, 0, 2, 8310 },
+  { 0x1f10a, 8312, 0, 2, 8312 },
+  { 0x1f110, 8314, 0, 3, 8314 },
+  { 0x1f111, 8317, 0, 3, 8317 },
+  { 0x1f112, 8320, 0, 3, 8320 },
+  { 0x1f113, 8323, 0, 3, 8323 },
+  { 0x1f114, 8326, 0, 3, 8326 },
+  { 0x1f115, 8329, 0, 3, 8329 },
+  { 0x1f116, 8332, 0, 3, 8332 },
+  { 0x1f117, 8335, 0, 3, 8335 },
+  { 0x1f118, 8338, 0, 3, 8338 },
+  { 0x1f119, 8341, 0, 3, 8341 },
+  { 0x1f11a, 8344, 0, 3, 8344 },
+  { 0x1f11b, 8347, 0, 3, 8347 },
+  { 0x1f11c, 8350, 0, 3, 8350 },
+  { 0x1f11d, 8353, 0, 3, 8353 },
+  { 0x1f11e, 8356, 0, 3, 8356 },
+  { 0x1f11f, 8359, 0, 3, 8359 },
+  { 0x1f120, 8362, 0, 3, 8362 },
+  { 0x1f121, 8365, 0, 3, 8365 },
+  { 0x1f122, 8368, 0, 3, 8368 },
+  { 0x1f123, 8371, 0, 3, 8371 },
+  { 0x1f124, 8374, 0, 3, 8374 },
+  { 0x1f125, 8377, 0, 3, 8377 },
+  { 0x1f126, 8380, 0, 3, 8380 },
+  { 0x1f127, 8383, 0, 3, 8383 },
+  { 0x1f128, 8386, 0, 3, 8386 },
+  { 0x1f129, 8389, 0, 3, 8389 },
+  { 0x1f12a, 8392, 0, 3, 8392 },
+  { 0x1f12b, 8395, 0, 1, 8395 },
+  { 0x1f12c, 8396, 0, 1, 8396 },
+  { 0x1f12d, 8397, 0, 2, 8397 },
+  { 0x1f12e, 8399, 0, 2, 8399 },
+  { 0x1f130, 8401, 0, 1, 8401 },
+  { 0x1f131, 8402, 0, 1, 8402 },
+  { 0x1f132, 8403, 0, 1, 8403 },
+  { 0x1f133, 8404, 0, 1, 8404 },
+  { 0x1f134, 8405, 0, 1, 8405 },
+  { 0x1f135, 8406, 0, 1, 8406 },
+  { 0x1f136, 8407, 0, 1, 8407 },
+  { 0x1f137, 8408, 0, 1, 8408 },
+  { 0x1f138, 8409, 0, 1, 8409 },
+  { 0x1f139, 8410, 0, 1, 8410 },
+  { 0x1f13a, 8411, 0, 1, 8411 },
+  { 0x1f13b, 8412, 0, 1, 8412 },
+  { 0x1f13c, 8413, 0, 1, 8413 },
+  { 0x1f13d, 8414, 0, 1, 8414 },
+  { 0x1f13e, 8415, 0, 1, 8415 },
+  { 0x1f13f, 8416, 0, 1, 8416 },
+  { 0x1f140, 8417, 0, 1, 8417 },
+  { 0x1f141, 8418, 0, 1, 8418 },
+  { 0x1f142, 8419, 0, 1, 8419 },
+  { 0x1f143, 8420, 0, 1, 8420 },
+  { 0x1f144, 8421, 0, 1, 8421 },
+  { 0x1f145, 8422, 0, 1, 8422 },
+  { 0x1f146, 8423, 0, 1, 8423 },
+  { 0x1f147, 8424, 0, 1, 8424 },
+  { 0x1f148, 8425, 0, 1, 8425 },
+  { 0x1f149, 8426, 0, 1, 8426 },
+  { 0x1f14a, 8427, 0, 2, 8427 },
+  { 0x1f14b, 8429, 0, 2, 8429 },
+  { 0x1f14c, 8431, 0, 2, 8431 },
+  { 0x1f14d, 8433, 0, 2, 8433 },
+  { 0x1f14e, 8435, 0, 3, 8435 },
+  { 0x1f14f, 8438, 0, 2, 8438 },
+  { 0x1f16a, 8440, 0, 2, 8440 },
+  { 0x1f16b, 8442, 0, 2, 8442 },
+  { 0x1f16c, 8444, 0, 2, 8444 },
+  { 0x1f190, 8446, 0, 2, 8446 },
+  { 0x1f200, 8448, 0, 2, 8448 },
+  { 0x1f201, 8450, 0, 2, 8450 },
+  { 0x1f202, 8452, 0, 1, 8452 },
+  { 0x1f210, 8453, 0, 1, 8453 },
+  { 0x1f211, 8454, 0, 1, 8454 },
+  { 0x1f212, 8455, 0, 1, 8455 },
+  { 0x1f213, 8456, 0, 2, 8456 },
+  { 0x1f214, 8458, 0, 1, 8458 },
+  { 0x1f215, 8459, 0, 1, 8459 },
+  { 0x1f216, 8460, 0, 1, 8460 },
+  { 0x1f217, 8461, 0, 1, 8461 },
+  { 0x1f218, 8462, 0, 1, 8462 },
+  { 0x1f219, 8463, 0, 1, 8463 },
+  { 0x1f21a, 8464, 0, 1, 8464 },
+  { 0x1f21b, 8465, 0, 1, 8465 },
+  { 0x1f21c, 8466, 0, 1, 8466 },
+  { 0x1f21d, 8467, 0, 1, 8467 },
+  { 0x1f21e, 8468, 0, 1, 8468 },
+  { 0x1f21f, 8469, 0, 1, 8469 },
+  { 0x1f220, 8470, 0, 1, 8470 },
+  { 0x1f221, 8471, 0, 1, 8471 },
+  { 0x1f222, 8472, 0, 1, 8472 },
+  { 0x1f223, 8473, 0, 1, 8473 },
+  { 0x1f224, 8474, 0, 1, 8474 },
+  { 0x1f225, 8475, 0, 1, 8475 },
+  { 0x1f226, 8476, 0, 1, 8476 },
+  { 0x1f227, 8477, 0, 1, 8477 },
+  { 0x1f228, 8478, 0, 1, 8478 },
+  { 0x1f229, 8479, 0, 1, 8479 },
+  { 0x1f22a, 8480, 0, 1, 8480 },
+  { 0x1f22b, 8481, 0, 1, 8481 },
+  { 0x1f22c, 8482, 0, 1, 8482 },
+  { 0x1f22d, 8483, 0, 1, 8483 },
+  { 0x1f22e, 8484, 0, 1, 8484 },
+  { 0x1f22f, 8485, 0, 1, 8485 },
+  { 0x1f230, 8486, 0, 1, 8486 },
+  { 0x1f231, 8487, 0, 1, 8487 },
+  { 0x1f232, 8488, 0, 1, 8488 },
+  { 0x1f233, 8489, 0, 1, 8489 },
+  { 0x1f234, 8490, 0, 1, 8490 },
+  { 0x1f235, 8491, 0, 1, 8491 },
+  { 0x1f236, 8492, 0, 1, 8492 },
+  { 0x1f237, 8493, 0, 1, 8493 },
+  { 0x1f238, 8494, 0, 1, 8494 },
+  { 0x1f239, 8495, 0, 1, 8495 },
+  { 0x1f23a, 8496, 0, 1, 8496 },
+  { 0x1f23b, 8497, 0, 1, 8497 },
+  { 0x1f240, 8498, 0, 3, 8498 },
+  { 0x1f241, 8501, 0, 3, 8501 },
+  { 0x1f242, 8504, 0, 3, 8504 },
+  { 0x1f243, 8507, 0, 3, 8507 },
+  { 0x1f244, 8510, 0, 3, 8510 },
+  { 0x1f245, 8513, 0, 3, 8513 },
+  { 0x1f246, 8516, 0, 3, 8516 },
+  { 0x1f247, 8519, 0, 3, 8519 },
+  { 0x1f248, 8522, 0, 3, 8522 },
+  { 0x1f250, 8525, 0, 1, 8525 },
+  { 0x1f251, 8526, 0, 1, 8526 },
+  { 0x1fbf0, 8527, 0, 1, 8527 },
+  { 0x1fbf1, 8528, 0, 1, 8528 },
+  { 0x1fbf2, 8529, 0, 1, 8529 },
+  { 0x1fbf3, 8530, 0, 1, 8530 },
+  { 0x1fbf4, 8531, 0, 1, 8531 },
+  { 0x1fbf5, 8532, 0, 1, 8532 },
+  { 0x1fbf6, 8533, 0, 1, 8533 },
+  { 0x1fbf7, 8534, 0, 1, 8534 },
+  { 0x1fbf8, 8535, 0, 1, 8535 },
+  { 0x1fbf9, 8536, 0, 1, 8536 },
+  { 0x2f800, 8537, 1, 1, 8537 },
+  { 0x2f801, 8538, 1, 1, 8538 },
+  { 0x2f802, 8539, 1, 1, 8539 },
+  { 0x2f803, 8540, 1, 1, 8540 },
+  { 0x2f804, 8541, 1, 1, 8541 },
+  { 0x2f805, 8542, 1, 1, 8542 },
+  { 0x2f806, 8543, 1, 1, 8543 },
+  { 0x2f807, 8544, 1, 1, 8544 },
+  { 0x2f808, 8545, 1, 1, 8545 },
+  { 0x2f809, 8546, 1, 1, 8546 },
+  { 0x2f80a, 8547, 1, 1, 8547 },
+  { 0x2f80b, 8548, 1, 1, 8548 },
+  { 0x2f80c, 8549, 1, 1, 8549 },
+  { 0x2f80d, 8550, 1, 1, 8550 },
+  { 0x2f80e, 8551, 1, 1, 8551 },
+  { 0x2f80f, 8552, 1, 1, 8552 },
+  { 0x2f810, 8553, 1, 1, 8553 },
+  { 0x2f811, 8554, 1, 1, 8554 },
+  { 0x2f812, 8555, 1, 1, 8555 },
+  { 0x2f813, 8556, 1, 1, 8556 },
+  { 0x2f814, 8557, 1, 1, 8557 },
+  { 0x2f815, 8558, 1, 1, 8558 },
+  { 0x2f816, 8559, 1, 1, 8559 },
+  { 0x2f817, 8560, 1, 1, 8560 },
+  { 0x2f818, 8561, 1, 1, 8561 },
+  { 0x2f819, 8562, 1, 1, 8562 },
+  { 0x2f81a, 8563, 1, 1, 8563 },
+  { 0x2f81b, 8564, 1, 1, 8564 },
+  { 0x2f81c, 8565, 1, 1, 8565 },
+  { 0x2f81d, 8566, 1, 1, 8566 },
+  { 0x2f81e, 8567, 1, 1, 8567 },
+  { 0x2f81f, 8568, 1, 1, 8568 },
+  { 0x2f820, 8569, 1, 1, 8569 },
+  { 0x2f821, 8570, 1, 1, 8570 },
+  { 0x2f822, 8571, 1, 1, 8571 },
+  { 0x2f823, 8572, 1, 1, 8572 },
+  { 0x2f824, 8573, 1, 1, 8573 },
+  { 0x2f825, 8574, 1, 1, 8574 },
+  { 0x2f826, 8575, 1, 1, 8575 },
+  { 0x2f827, 8576, 1, 1, 8576 },
+  { 0x2f828, 8577, 1, 1, 8577 },
+  { 0x2f829, 8578, 1, 1, 8578 },
+  { 0x2f82a, 8579, 1, 1, 8579 },
+  { 0x2f82b, 8580, 1, 1, 8580 },
+  { 0x2f82c, 8581, 1, 1, 8581 },
+  { 0x2f82d, 8582, 1, 1, 8582 },
+  { 0x2f82e, 8583, 1, 1, 8583 },
+  { 0x2f82f, 8584, 1, 1, 8584 },
+  { 0x2f830, 8585, 1, 1, 8585 },
+  { 0x2f831, 8586, 1, 1, 8586 },
+  { 0x2f832, 8587, 1, 1, 8587 },
+  { 0x2f833, 8588, 1, 1, 8588 },
+  { 0x2f834, 8589, 1, 1, 8589 },
+  { 0x2f835, 8590, 1, 1, 8590 },
+  { 0x2f836, 8591, 1, 1, 8591 },
+  { 0x2f837, 8592, 1, 1, 8592 },
+  { 0x2f838, 8593, 1, 1, 8593 },
+  { 0x2f839, 8594, 1, 1, 8594 },
+  { 0x2f83a, 8595, 1, 1, 8595 },
+  { 0x2f83b, 8596, 1, 1, 8596 },
+  { 0x2f83c, 8597, 1, 1, 8597 },
+  { 0x2f83d, 8598, 1, 1, 8598 },
+  { 0x2f83e, 8599, 1, 1, 8599 },
+  { 0x2f83f, 8600, 1, 1, 8600 },
+  { 0x2f840, 8601, 1, 1, 8601 },
+  { 0x2f841, 8602, 1, 1, 8602 },
+  { 0x2f842, 8603, 1, 1, 8603 },
+  { 0x2f843, 8604, 1, 1, 8604 },
+  { 0x2f844, 8605, 1, 1, 8605 },
+  { 0x2f845, 8606, 1, 1, 8606 },
+  { 0x2f846, 8607, 1, 1, 8607 },
+  { 0x2f847, 8608, 1, 1, 8608 },
+  { 0x2f848, 8609, 1, 1, 8609 },
+  { 0x2f849, 8610, 1, 1, 8610 },
+  { 0x2f84a, 8611, 1, 1, 8611 },
+  { 0x2f84b, 8612, 1, 1, 8612 },
+  { 0x2f84c, 8613, 1, 1, 8613 },
+  { 0x2f84d, 8614, 1, 1, 8614 },
+  { 0x2f84e, 8615, 1, 1, 8615 },
+  { 0x2f84f, 8616, 1, 1, 8616 },
+  { 0x2f850, 8617, 1, 1, 8617 },
+  { 0x2f851, 8618, 1, 1, 8618 },
+  { 0x2f852, 8619, 1, 1, 8619 },
+  { 0x2f853, 8620, 1, 1, 8620 },
+  { 0x2f854, 8621, 1, 1, 8621 },
+  { 0x2f855, 8622, 1, 1, 8622 },
+  { 0x2f856, 8623, 1, 1, 8623 },
+  { 0x2f857, 8624, 1, 1, 8624 },
+  { 0x2f858, 8625, 1, 1, 8625 },
+  { 0x2f859, 8626, 1, 1, 8626 },
+  { 0x2f85a, 8627, 1, 1, 8627 },
+  { 0x2f85b, 8628, 1, 1, 8628 },
+  { 0x2f85c, 8629, 1, 1, 8629 },
+  { 0x2f85d, 8630, 1, 1, 8630 },
+  { 0x2f85e, 8631, 1, 1, 8631 },
+  { 0x2f85f, 8632, 1, 1, 8632 },
+  { 0x2f860, 8633, 1, 1, 8633 },
+  { 0x2f861, 8634, 1, 1, 8634 },
+  { 0x2f862, 8635, 1, 1, 8635 },
+  { 0x2f863, 8636, 1, 1, 8636 },
+  { 0x2f864, 8637, 1, 1, 8637 },
+  { 0x2f865, 8638, 1, 1, 8638 },
+  { 0x2f866, 8639, 1, 1, 8639 },
+  { 0x2f867, 8640, 1, 1, 8640 },
+  { 0x2f868, 8641, 1, 1, 8641 },
+  { 0x2f869, 8642, 1, 1, 8642 },
+  { 0x2f86a, 8643, 1, 1, 8643 },
+  { 0x2f86b, 8644, 1, 1, 8644 },
+  { 0x2f86c, 8645, 1, 1, 8645 },
+  { 0x2f86d, 8646, 1, 1, 8646 },
+  { 0x2f86e, 8647, 1, 1, 8647 },
+  { 0x2f86f, 8648, 1, 1, 8648 },
+  { 0x2f870, 8649, 1, 1, 8649 },
+  { 0x2f871, 8650, 1, 1, 8650 },
+  { 0x2f872, 8651, 1, 1, 8651 },
+  { 0x2f873, 8652, 1, 1, 8652 },
+  { 0x2f874, 8653, 1, 1, 8653 },
+  { 0x2f875, 8654, 1, 1, 8654 },
+  { 0x2f876, 8655, 1, 1, 8655 },
+  { 0x2f877, 8656, 1, 1, 8656 },
+  { 0x2f878, 8657, 1, 1, 8657 },
+  { 0x2f879, 8658, 1, 1, 8658 },
+  { 0x2f87a, 8659, 1, 1, 8659 },
+  { 0x2f87b, 8660, 1, 1, 8660 },
+  { 0x2f87c, 8661, 1, 1, 8661 },
+  { 0x2f87d, 8662, 1, 1, 8662 },
+  { 0x2f87e, 8663, 1, 1, 8663 },
+  { 0x2f87f, 8664, 1, 1, 8664 },
+  { 0x2f880, 8665, 1, 1, 8665 },
+  { 0x2f881, 8666, 1, 1, 8666 },
+  { 0x2f882, 8667, 1, 1, 8667 },
+  { 0x2f883, 8668, 1, 1, 8668 },
+  { 0x2f884, 8669, 1, 1, 8669 },
+  { 0x2f885, 8670, 1, 1, 8670 },
+  { 0x2f886, 8671, 1, 1, 8671 },
+  { 0x2f887, 8672, 1, 1, 8672 },
+  { 0x2f888, 8673, 1, 1, 8673 },
+  { 0x2f889, 8674, 1, 1, 8674 },
+  { 0x2f88a, 8675, 1, 1, 8675 },
+  { 0x2f88b, 8676, 1, 1, 8676 },
+  { 0x2f88c, 8677, 1, 1, 8677 },
+  { 0x2f88d, 8678, 1, 1, 8678 },
+  { 0x2f88e, 8679, 1, 1, 8679 },
+  { 0x2f88f, 8680, 1, 1, 8680 },
+  { 0x2f890, 8681, 1, 1, 8681 },
+  { 0x2f891, 8682, 1, 1, 8682 },
+  { 0x2f892, 8683, 1, 1, 8683 },
+  { 0x2f893, 8684, 1, 1, 8684 },
+  { 0x2f894, 8685, 1, 1, 8685 },
+  { 0x2f895, 8686, 1, 1, 8686 },
+  { 0x2f896, 8687, 1, 1, 8687 },
+  { 0x2f897, 8688, 1, 1, 8688 },
+  { 0x2f898, 8689, 1, 1, 8689 },
+  { 0x2f899, 8690, 1, 1, 8690 },
+  { 0x2f89a, 8691, 1, 1, 8691 },
+  { 0x2f89b, 8692, 1, 1, 8692 },
+  { 0x2f89c, 8693, 1, 1, 8693 },
+  { 0x2f89d, 8694, 1, 1, 8694 },
+  { 0x2f89e, 8695, 1, 1, 8695 },
+  { 0x2f89f, 8696, 1, 1, 8696 },
+  { 0x2f8a0, 8697, 1, 1, 8697 },
+  { 0x2f8a1, 8698, 1, 1, 8698 },
+  { 0x2f8a2, 8699, 1, 1, 8699 },
+  { 0x2f8a3, 8700, 1, 1, 8700 },
+  { 0x2f8a4, 8701, 1, 1, 8701 },
+  { 0x2f8a5, 8702, 1, 1, 8702 },
+  { 0x2f8a6, 8703, 1, 1, 8703 },
+  { 0x2f8a7, 8704, 1, 1, 8704 },
+  { 0x2f8a8, 8705, 1, 1, 8705 },
+  { 0x2f8a9, 8706, 1, 1, 8706 },
+  { 0x2f8aa, 8707, 1, 1, 8707 },
+  { 0x2f8ab, 8708, 1, 1, 8708 },
+  { 0x2f8ac, 8709, 1, 1, 8709 },
+  { 0x2f8ad, 8710, 1, 1, 8710 },
+  { 0x2f8ae, 8711, 1, 1, 8711 },
+  { 0x2f8af, 8712, 1, 1, 8712 },
+  { 0x2f8b0, 8713, 1, 1, 8713 },
+  { 0x2f8b1, 8714, 1, 1, 8714 },
+  { 0x2f8b2, 8715, 1, 1, 8715 },
+  { 0x2f8b3, 8716, 1, 1, 8716 },
+  { 0x2f8b4, 8717, 1, 1, 8717 },
+  { 0x2f8b5, 8718, 1, 1, 8718 },
+  { 0x2f8b6, 8719, 1, 1, 8719 },
+  { 0x2f8b7, 8720, 1, 1, 8720 },
+  { 0x2f8b8, 8721, 1, 1, 8721 },
+  { 0x2f8b9, 8722, 1, 1, 8722 },
+  { 0x2f8ba, 8723, 1, 1, 8723 },
+  { 0x2f8bb, 8724, 1, 1, 8724 },
+  { 0x2f8bc, 8725, 1, 1, 8725 },
+  { 0x2f8bd, 8726, 1, 1, 8726 },
+  { 0x2f8be, 8727, 1, 1, 8727 },
+  { 0x2f8bf, 8728, 1, 1, 8728 },
+  { 0x2f8c0, 8729, 1, 1, 8729 },
+  { 0x2f8c1, 8730, 1, 1, 8730 },
+  { 0x2f8c2, 8731, 1, 1, 8731 },
+  { 0x2f8c3, 8732, 1, 1, 8732 },
+  { 0x2f8c4, 8733, 1, 1, 8733 },
+  { 0x2f8c5, 8734, 1, 1, 8734 },
+  { 0x2f8c6, 8735, 1, 1, 8735 },
+  { 0x2f8c7, 8736, 1, 1, 8736 },
+  { 0x2f8c8, 8737, 1, 1, 8737 },
+  { 0x2f8c9, 8738, 1, 1, 8738 },
+  { 0x2f8ca, 8739, 1, 1, 8739 },
+  { 0x2f8cb, 8740, 1, 1, 8740 },
+  { 0x2f8cc, 8741, 1, 1, 8741 },
+  { 0x2f8cd, 8742, 1, 1, 8742 },
+  { 0x2f8ce, 8743, 1, 1, 8743 },
+  { 0x2f8cf, 8744, 1, 1, 8744 },
+  { 0x2f8d0, 8745, 1, 1, 8745 },
+  { 0x2f8d1, 8746, 1, 1, 8746 },
+  { 0x2f8d2, 8747, 1, 1, 8747 },
+  { 0x2f8d3, 8748, 1, 1, 8748 },
+  { 0x2f8d4, 8749, 1, 1, 8749 },
+  { 0x2f8d5, 8750, 1, 1, 8750 },
+  { 0x2f8d6, 8751, 1, 1, 8751 },
+  { 0x2f8d7, 8752, 1, 1, 8752 },
+  { 0x2f8d8, 8753, 1, 1, 8753 },
+  { 0x2f8d9, 8754, 1, 1, 8754 },
+  { 0x2f8da, 8755, 1, 1, 8755 },
+  { 0x2f8db, 8756, 1, 1, 8756 },
+  { 0x2f8dc, 8757, 1, 1, 8757 },
+  { 0x2f8dd, 8758, 1, 1, 8758 },
+  { 0x2f8de, 8759, 1, 1, 8759 },
+  { 0x2f8df, 8760, 1, 1, 8760 },
+  { 0x2f8e0, 8761, 1, 1, 8761 },
+  { 0x2f8e1, 8762, 1, 1, 8762 },
+  { 0x2f8e2, 8763, 1, 1, 8763 },
+  { 0x2f8e3, 8764, 1, 1, 8764 },
+  { 0x2f8e4, 8765, 1, 1, 8765 },
+  { 0x2f8e5, 8766, 1, 1, 8766 },
+  { 0x2f8e6, 8767, 1, 1, 8767 },
+  { 0x2f8e7, 8768, 1, 1, 8768 },
+  { 0x2f8e8, 8769, 1, 1, 8769 },
+  { 0x2f8e9, 8770, 1, 1, 8770 },
+  { 0x2f8ea, 8771, 1, 1, 8771 },
+  { 0x2f8eb, 8772, 1, 1, 8772 },
+  { 0x2f8ec, 8773, 1, 1, 8773 },
+  { 0x2f8ed, 8774, 1, 1, 8774 },
+  { 0x2f8ee, 8775, 1, 1, 8775 },
+  { 0x2f8ef, 8776, 1, 1, 8776 },
+  { 0x2f8f0, 8777, 1, 1, 8777 },
+  { 0x2f8f1, 8778, 1, 1, 8778 },
+  { 0x2f8f2, 8779, 1, 1, 8779 },
+  { 0x2f8f3, 8780, 1, 1, 8780 },
+  { 0x2f8f4, 8781, 1, 1, 8781 },
+  { 0x2f8f5, 8782, 1, 1, 8782 },
+  { 0x2f8f6, 8783, 1, 1, 8783 },
+  { 0x2f8f7, 8784, 1, 1, 8784 },
+  { 0x2f8f8, 8785, 1, 1, 8785 },
+  { 0x2f8f9, 8786, 1, 1, 8786 },
+  { 0x2f8fa, 8787, 1, 1, 8787 },
+  { 0x2f8fb, 8788, 1, 1, 8788 },
+  { 0x2f8fc, 8789, 1, 1, 8789 },
+  { 0x2f8fd, 8790, 1, 1, 8790 },
+  { 0x2f8fe, 8791, 1, 1, 8791 },
+  { 0x2f8ff, 8792, 1, 1, 8792 },
+  { 0x2f900, 8793, 1, 1, 8793 },
+  { 0x2f901, 8794, 1, 1, 8794 },
+  { 0x2f902, 8795, 1, 1, 8795 },
+  { 0x2f903, 8796, 1, 1, 8796 },
+  { 0x2f904, 8797, 1, 1, 8797 },
+  { 0x2f905, 8798, 1, 1, 8798 },
+  { 0x2f906, 8799, 1, 1, 8799 },
+  { 0x2f907, 8800, 1, 1, 8800 },
+  { 0x2f908, 8801, 1, 1, 8801 },
+  { 0x2f909, 8802, 1, 1, 8802 },
+  { 0x2f90a, 8803, 1, 1, 8803 },
+  { 0x2f90b, 8804, 1, 1, 8804 },
+  { 0x2f90c, 8805, 1, 1, 8805 },
+  { 0x2f90d, 8806, 1, 1, 8806 },
+  { 0x2f90e, 8807, 1, 1, 8807 },
+  { 0x2f90f, 8808, 1, 1, 8808 },
+  { 0x2f910, 8809, 1, 1, 8809 },
+  { 0x2f911, 8810, 1, 1, 8810 },
+  { 0x2f912, 8811, 1, 1, 8811 },
+  { 0x2f913, 8812, 1, 1, 8812 },
+  { 0x2f914, 8813, 1, 1, 8813 },
+  { 0x2f915, 8814, 1, 1, 8814 },
+  { 0x2f916, 8815, 1, 1, 8815 },
+  { 0x2f917, 8816, 1, 1, 8816 },
+  { 0x2f918, 8817, 1, 1, 8817 },
+  { 0x2f919, 8818, 1, 1, 8818 },
+  { 0x2f91a, 8819, 1, 1, 8819 },
+  { 0x2f91b, 8820, 1, 1, 8820 },
+  { 0x2f91c, 8821, 1, 1, 8821 },
+  { 0x2f91d, 8822, 1, 1, 8822 },
+  { 0x2f91e, 8823, 1, 1, 8823 },
+  { 0x2f91f, 8824, 1, 1, 8824 },
+  { 0x2f920, 8825, 1, 1, 8825 },
+  { 0x2f921, 8826, 1, 1, 8826 },
+  { 0x2f922, 8827, 1, 1, 8827 },
+  { 0x2f923, 8828, 1, 1, 8828 },
+  { 0x2f924, 8829, 1, 1, 8829 },
+  { 0x2f925, 8830, 1, 1, 8830 },
+  { 0x2f926, 8831, 1, 1, 8831 },
+  { 0x2f927, 8832, 1, 1, 8832 },
+  { 0x2f928, 8833, 1, 1, 8833 },
+  { 0x2f929, 8834, 1, 1, 8834 },
+  { 0x2f92a, 8835, 1, 1, 8835 },
+  { 0x2f92b, 8836, 1, 1, 8836 },
+  { 0x2f92c, 8837, 1, 1, 8837 },
+  { 0x2f92d, 8838, 1, 1, 8838 },
+  { 0x2f92e, 8839, 1, 1, 8839 },
+  { 0x2f92f, 8840, 1, 1, 8840 },
+  { 0x2f930, 8841, 1, 1, 8841 },
+  { 0x2f931, 8842, 1, 1, 8842 },
+  { 0x2f932, 8843, 1, 1, 8843 },
+  { 0x2f933, 8844, 1, 1, 8844 },
+  { 0x2f934, 8845, 1, 1, 8845 },
+  { 0x2f935, 8846, 1, 1, 8846 },
+  { 0x2f936, 8847, 1, 1, 8847 },
+  { 0x2f937, 8848, 1, 1, 8848 },
+  { 0x2f938, 8849, 1, 1, 8849 },
+  { 0x2f939, 8850, 1, 1, 8850 },
+  { 0x2f93a, 8851, 1, 1, 8851 },
+  { 0x2f93b, 8852, 1, 1, 8852 },
+  { 0x2f93c, 8853, 1, 1, 8853 },
+  { 0x2f93d, 8854, 1, 1, 8854 },
+  { 0x2f93e, 8855, 1, 1, 8855 },
+  { 0x2f93f, 8856, 1, 1, 8856 },
+  { 0x2f940, 8857, 1, 1, 8857 },
+  { 0x2f941, 8858, 1, 1, 8858 },
+  { 0x2f942, 8859, 1, 1, 8859 },
+  { 0x2f943, 8860, 1, 1, 8860 },
+  { 0x2f944, 8861, 1, 1, 8861 },
+  { 0x2f945, 8862, 1, 1, 8862 },
+  { 0x2f946, 8863, 1, 1, 8863 },
+  { 0x2f947, 8864, 1, 1, 8864 },
+  { 0x2f948, 8865, 1, 1, 8865 },
+  { 0x2f949, 8866, 1, 1, 8866 },
+  { 0x2f94a, 8867, 1, 1, 8867 },
+  { 0x2f94b, 8868, 1, 1, 8868 },
+  { 0x2f94c, 8869, 1, 1, 8869 },
+  { 0x2f94d, 8870, 1, 1, 8870 },
+  { 0x2f94e, 8871, 1, 1, 8871 },
+  { 0x2f94f, 8872, 1, 1, 8872 },
+  { 0x2f950, 8873, 1, 1, 8873 },
+  { 0x2f951, 8874, 1, 1, 8874 },
+  { 0x2f952, 8875, 1, 1, 8875 },
+  { 0x2f953, 8876, 1, 1, 8876 },
+  { 0x2f954, 8877, 1, 1, 8877 },
+  { 0x2f955, 8878, 1, 1, 8878 },
+  { 0x2f956, 8879, 1, 1, 8879 },
+  { 0x2f957, 8880, 1, 1, 8880 },
+  { 0x2f958, 8881, 1, 1, 8881 },
+  { 0x2f959, 8882, 1, 1, 8882 },
+  { 0x2f95a, 8883, 1, 1, 8883 },
+  { 0x2f95b, 8884, 1, 1, 8884 },
+  { 0x2f95c, 8885, 1, 1, 8885 },
+  { 0x2f95d, 8886, 1, 1, 8886 },
+  { 0x2f95e, 8887, 1, 1, 8887 },
+  { 0x2f95f, 8888, 1, 1, 8888 },
+  { 0x2f960, 8889, 1, 1, 8889 },
+  { 0x2f961, 8890, 1, 1, 8890 },
+  { 0x2f962, 8891, 1, 1, 8891 },
+  { 0x2f963, 8892, 1, 1, 8892 },
+  { 0x2f964, 8893, 1, 1, 8893 },
+  { 0x2f965, 8894, 1, 1, 8894 },
+  { 0x2f966, 8895, 1, 1, 8895 },
+  { 0x2f967, 8896, 1, 1, 8896 },
+  { 0x2f968, 8897, 1, 1, 8897 },
+  { 0x2f969, 8898, 1, 1, 8898 },
+  { 0x2f96a, 8899, 1, 1, 8899 },
+  { 0x2f96b, 8900, 1, 1, 8900 },
+  { 0x2f96c, 8901, 1, 1, 8901 },
+  { 0x2f96d, 8902, 1, 1, 8902 },
+  { 0x2f96e, 8903, 1, 1, 8903 },
+  { 0x2f96f, 8904, 1, 1, 8904 },
+  { 0x2f970, 8905, 1, 1, 8905 },
+  { 0x2f971, 8906, 1, 1, 8906 },
+  { 0x2f972, 8907, 1, 1, 8907 },
+  { 0x2f973, 8908, 1, 1, 8908 },
+  { 0x2f974, 8909, 1, 1, 8909 },
+  { 0x2f975, 8910, 1, 1, 8910 },
+  { 0x2f976, 8911, 1, 1, 8911 },
+  { 0x2f977, 8912, 1, 1, 8912 },
+  { 0x2f978, 8913, 1, 1, 8913 },
+  { 0x2f979, 8914, 1, 1, 8914 },
+  { 0x2f97a, 8915, 1, 1, 8915 },
+  { 0x2f97b, 8916, 1, 1, 8916 },
+  { 0x2f97c, 8917, 1, 1, 8917 },
+  { 0x2f97d, 8918, 1, 1, 8918 },
+  { 0x2f97e, 8919, 1, 1, 8919 },
+  { 0x2f97f, 8920, 1, 1, 8920 },
+  { 0x2f980, 8921, 1, 1, 8921 },
+  { 0x2f981, 8922, 1, 1, 8922 },
+  { 0x2f982, 8923, 1, 1, 8923 },
+  { 0x2f983, 8924, 1, 1, 8924 },
+  { 0x2f984, 8925, 1, 1, 8925 },
+  { 0x2f985, 8926, 1, 1, 8926 },
+  { 0x2f986, 8927, 1, 1, 8927 },
+  { 0x2f987, 8928, 1, 1, 8928 },
+  { 0x2f988, 8929, 1, 1, 8929 },
+  { 0x2f989, 8930, 1, 1, 8930 },
+  { 0x2f98a, 8931, 1, 1, 8931 },
+  { 0x2f98b, 8932, 1, 1, 8932 },
+  { 0x2f98c, 8933, 1, 1, 8933 },
+  { 0x2f98d, 8934, 1, 1, 8934 },
+  { 0x2f98e, 8935, 1, 1, 8935 },
+  { 0x2f98f, 8936, 1, 1, 8936 },
+  { 0x2f990, 8937, 1, 1, 8937 },
+  { 0x2f991, 8938, 1, 1, 8938 },
+  { 0x2f992, 8939, 1, 1, 8939 },
+  { 0x2f993, 8940, 1, 1, 8940 },
+  { 0x2f994, 8941, 1, 1, 8941 },
+  { 0x2f995, 8942, 1, 1, 8942 },
+  { 0x2f996, 8943, 1, 1, 8943 },
+  { 0x2f997, 8944, 1, 1, 8944 },
+  { 0x2f998, 8945, 1, 1, 8945 },
+  { 0x2f999, 8946, 1, 1, 8946 },
+  { 0x2f99a, 8947, 1, 1, 8947 },
+  { 0x2f99b, 8948, 1, 1, 8948 },
+  { 0x2f99c, 8949, 1, 1, 8949 },
+  { 0x2f99d, 8950, 1, 1, 8950 },
+  { 0x2f99e, 8951, 1, 1, 8951 },
+  { 0x2f99f, 8952, 1, 1, 8952 },
+  { 0x2f9a0, 8953, 1, 1, 8953 },
+  { 0x2f9a1, 8954, 1, 1, 8954 },
+  { 0x2f9a2, 8955, 1, 1, 8955 },
+  { 0x2f9a3, 8956, 1, 1, 8956 },
+  { 0x2f9a4, 8957, 1, 1, 8957 },
+  { 0x2f9a5, 8958, 1, 1, 8958 },
+  { 0x2f9a6, 8959, 1, 1, 8959 },
+  { 0x2f9a7, 8960, 1, 1, 8960 },
+  { 0x2f9a8, 8961, 1, 1, 8961 },
+  { 0x2f9a9, 8962, 1, 1, 8962 },
+  { 0x2f9aa, 8963, 1, 1, 8963 },
+  { 0x2f9ab, 8964, 1, 1, 8964 },
+  { 0x2f9ac, 8965, 1, 1, 8965 },
+  { 0x2f9ad, 8966, 1, 1, 8966 },
+  { 0x2f9ae, 8967, 1, 1, 8967 },
+  { 0x2f9af, 8968, 1, 1, 8968 },
+  { 0x2f9b0, 8969, 1, 1, 8969 },
+  { 0x2f9b1, 8970, 1, 1, 8970 },
+  { 0x2f9b2, 8971, 1, 1, 8971 },
+  { 0x2f9b3, 8972, 1, 1, 8972 },
+  { 0x2f9b4, 8973, 1, 1, 8973 },
+  { 0x2f9b5, 8974, 1, 1, 8974 },
+  { 0x2f9b6, 8975, 1, 1, 8975 },
+  { 0x2f9b7, 8976, 1, 1, 8976 },
+  { 0x2f9b8, 8977, 1, 1, 8977 },
+  { 0x2f9b9, 8978, 1, 1, 8978 },
+  { 0x2f9ba, 8979, 1, 1, 8979 },
+  { 0x2f9bb, 8980, 1, 1, 8980 },
+  { 0x2f9bc, 8981, 1, 1, 8981 },
+  { 0x2f9bd, 8982, 1, 1, 8982 },
+  { 0x2f9be, 8983, 1, 1, 8983 },
+  { 0x2f9bf, 8984, 1, 1, 8984 },
+  { 0x2f9c0, 8985, 1, 1, 8985 },
+  { 0x2f9c1, 8986, 1, 1, 8986 },
+  { 0x2f9c2, 8987, 1, 1, 8987 },
+  { 0x2f9c3, 8988, 1, 1, 8988 },
+  { 0x2f9c4, 8989, 1, 1, 8989 },
+  { 0x2f9c5, 8990, 1, 1, 8990 },
+  { 0x2f9c6, 8991, 1, 1, 8991 },
+  { 0x2f9c7, 8992, 1, 1, 8992 },
+  { 0x2f9c8, 8993, 1, 1, 8993 },
+  { 0x2f9c9, 8994, 1, 1, 8994 },
+  { 0x2f9ca, 8995, 1, 1, 8995 },
+  { 0x2f9cb, 8996, 1, 1, 8996 },
+  { 0x2f9cc, 8997, 1, 1, 8997 },
+  { 0x2f9cd, 8998, 1, 1, 8998 },
+  { 0x2f9ce, 8999, 1, 1, 8999 },
+  { 0x2f9cf, 9000, 1, 1, 9000 },
+  { 0x2f9d0, 9001, 1, 1, 9001 },
+  { 0x2f9d1, 9002, 1, 1, 9002 },
+  { 0x2f9d2, 9003, 1, 1, 9003 },
+  { 0x2f9d3, 9004, 1, 1, 9004 },
+  { 0x2f9d4, 9005, 1, 1, 9005 },
+  { 0x2f9d5, 9006, 1, 1, 9006 },
+  { 0x2f9d6, 9007, 1, 1, 9007 },
+  { 0x2f9d7, 9008, 1, 1, 9008 },
+  { 0x2f9d8, 9009, 1, 1, 9009 },
+  { 0x2f9d9, 9010, 1, 1, 9010 },
+  { 0x2f9da, 9011, 1, 1, 9011 },
+  { 0x2f9db, 9012, 1, 1, 9012 },
+  { 0x2f9dc, 9013, 1, 1, 9013 },
+  { 0x2f9dd, 9014, 1, 1, 9014 },
+  { 0x2f9de, 9015, 1, 1, 9015 },
+  { 0x2f9df, 9016, 1, 1, 9016 },
+  { 0x2f9e0, 9017, 1, 1, 9017 },
+  { 0x2f9e1, 9018, 1, 1, 9018 },
+  { 0x2f9e2, 9019, 1, 1, 9019 },
+  { 0x2f9e3, 9020, 1, 1, 9020 },
+  { 0x2f9e4, 9021, 1, 1, 9021 },
+  { 0x2f9e5, 9022, 1, 1, 9022 },
+  { 0x2f9e6, 9023, 1, 1, 9023 },
+  { 0x2f9e7, 9024, 1, 1, 9024 },
+  { 0x2f9e8, 9025, 1, 1, 9025 },
+  { 0x2f9e9, 9026, 1, 1, 9026 },
+  { 0x2f9ea, 9027, 1, 1, 9027 },
+  { 0x2f9eb, 9028, 1, 1, 9028 },
+  { 0x2f9ec, 9029, 1, 1, 9029 },
+  { 0x2f9ed, 9030, 1, 1, 9030 },
+  { 0x2f9ee, 9031, 1, 1, 9031 },
+  { 0x2f9ef, 9032, 1, 1, 9032 },
+  { 0x2f9f0, 9033, 1, 1, 9033 },
+  { 0x2f9f1, 9034, 1, 1, 9034 },
+  { 0x2f9f2, 9035, 1, 1, 9035 },
+  { 0x2f9f3, 9036, 1, 1, 9036 },
+  { 0x2f9f4, 9037, 1, 1, 9037 },
+  { 0x2f9f5, 9038, 1, 1, 9038 },
+  { 0x2f9f6, 9039, 1, 1, 9039 },
+  { 0x2f9f7, 9040, 1, 1, 9040 },
+  { 0x2f9f8, 9041, 1, 1, 9041 },
+  { 0x2f9f9, 9042, 1, 1, 9042 },
+  { 0x2f9fa, 9043, 1, 1, 9043 },
+  { 0x2f9fb, 9044, 1, 1, 9044 },
+  { 0x2f9fc, 9045, 1, 1, 9045 },
+  { 0x2f9fd, 9046, 1, 1, 9046 },
+  { 0x2f9fe, 9047, 1, 1, 9047 },
+  { 0x2f9ff, 9048, 1, 1, 9048 },
+  { 0x2fa00, 9049, 1, 1, 9049 },
+  { 0x2fa01, 9050, 1, 1, 9050 },
+  { 0x2fa02, 9051, 1, 1, 9051 },
+  { 0x2fa03, 9052, 1, 1, 9052 },
+  { 0x2fa04, 9053, 1, 1, 9053 },
+  { 0x2fa05, 9054, 1, 1, 9054 },
+  { 0x2fa06, 9055, 1, 1, 9055 },
+  { 0x2fa07, 9056, 1, 1, 9056 },
+  { 0x2fa08, 9057, 1, 1, 9057 },
+  { 0x2fa09, 9058, 1, 1, 9058 },
+  { 0x2fa0a, 9059, 1, 1, 9059 },
+  { 0x2fa0b, 9060, 1, 1, 9060 },
+  { 0x2fa0c, 9061, 1, 1, 9061 },
+  { 0x2fa0d, 9062, 1, 1, 9062 },
+  { 0x2fa0e, 9063, 1, 1, 9063 },
+  { 0x2fa0f, 9064, 1, 1, 9064 },
+  { 0x2fa10, 9065, 1, 1, 9065 },
+  { 0x2fa11, 9066, 1, 1, 9066 },
+  { 0x2fa12, 9067, 1, 1, 9067 },
+  { 0x2fa13, 9068, 1, 1, 9068 },
+  { 0x2fa14, 9069, 1, 1, 9069 },
+  { 0x2fa15, 9070, 1, 1, 9070 },
+  { 0x2fa16, 9071, 1, 1, 9071 },
+  { 0x2fa17, 9072, 1, 1, 9072 },
+  { 0x2fa18, 9073, 1, 1, 9073 },
+  { 0x2fa19, 9074, 1, 1, 9074 },
+  { 0x2fa1a, 9075, 1, 1, 9075 },
+  { 0x2fa1b, 9076, 1, 1, 9076 },
+  { 0x2fa1c, 9077, 1, 1, 9077 },
+  { 0x2fa1d, 9078, 1, 1, 9078 }
+};
+
+const uint32_t toke_unicode_decomposition_pool[9079] = {
+  0x00020, 0x00020, 0x00308, 0x00061, 0x00020, 0x00304, 0x00032, 0x00033, 0x00020, 0x00301,
+  0x003bc, 0x00020, 0x00327, 0x00031, 0x0006f, 0x00031, 0x02044, 0x00034, 0x00031, 0x02044,
+  0x00032, 0x00033, 0x02044, 0x00034, 0x00041, 0x00300, 0x00041, 0x00301, 0x00041, 0x00302,
+  0x00041, 0x00303, 0x00041, 0x00308, 0x00041, 0x0030a, 0x00043, 0x00327, 0x00045, 0x00300,
+  0x00045, 0x00301, 0x00045, 0x00302, 0x00045, 0x00308, 0x00049, 0x00300, 0x00049, 0x00301,
+  0x00049, 0x00302, 0x00049, 0x00308, 0x0004e, 0x00303, 0x0004f, 0x00300, 0x0004f, 0x00301,
+  0x0004f, 0x00302, 0x0004f, 0x00303, 0x0004f, 0x00308, 0x00055, 0x00300, 0x00055, 0x00301,
+  0x00055, 0x00302, 0x00055, 0x00308, 0x00059, 0x00301, 0x00061, 0x00300, 0x00061, 0x00301,
+  0x00061, 0x00302, 0x00061, 0x00303, 0x00061, 0x00308, 0x00061, 0x0030a, 0x00063, 0x00327,
+  0x00065, 0x00300, 0x00065, 0x00301, 0x00065, 0x00302, 0x00065, 0x00308, 0x00069, 0x00300,
+  0x00069, 0x00301, 0x00069, 0x00302, 0x00069, 0x00308, 0x0006e, 0x00303, 0x0006f, 0x00300,
+  0x0006f, 0x00301, 0x0006f, 0x00302, 0x0006f, 0x00303, 0x0006f, 0x00308, 0x00075, 0x00300,
+  0x00075, 0x00301, 0x00075, 0x00302, 0x00075, 0x00308, 0x00079, 0x00301, 0x00079, 0x00308,
+  0x00041, 0x00304, 0x00061, 0x00304, 0x00041, 0x00306, 0x00061, 0x00306, 0x00041, 0x00328,
+  0x00061, 0x00328, 0x00043, 0x00301, 0x00063, 0x00301, 0x00043, 0x00302, 0x00063, 0x00302,
+  0x00043, 0x00307, 0x00063, 0x00307, 0x00043, 0x0030c, 0x00063, 0x0030c, 0x00044, 0x0030c,
+  0x00064, 0x0030c, 0x00045, 0x00304, 0x00065, 0x00304, 0x00045, 0x00306, 0x00065, 0x00306,
+  0x00045, 0x00307, 0x00065, 0x00307, 0x00045, 0x00328, 0x00065, 0x00328, 0x00045, 0x0030c,
+  0x00065, 0x0030c, 0x00047, 0x00302, 0x00067, 0x00302, 0x00047, 0x00306, 0x00067, 0x00306,
+  0x00047, 0x00307, 0x00067, 0x00307, 0x00047, 0x00327, 0x00067, 0x00327, 0x00048, 0x00302,
+  0x00068, 0x00302, 0x00049, 0x00303, 0x00069, 0x00303, 0x00049, 0x00304, 0x00069, 0x00304,
+  0x00049, 0x00306, 0x00069, 0x00306, 0x00049, 0x00328, 0x00069, 0x00328, 0x00049, 0x00307,
+  0x00049, 0x0004a, 0x00069, 0x0006a, 0x0004a, 0x00302, 0x0006a, 0x00302, 0x0004b, 0x00327,
+  0x0006b, 0x00327, 0x0004c, 0x00301, 0x0006c, 0x00301, 0x0004c, 0x00327, 0x0006c, 0x00327,
+  0x0004c, 0x0030c, 0x0006c, 0x0030c, 0x0004c, 0x000b7, 0x0006c, 0x000b7, 0x0004e, 0x00301,
+  0x0006e, 0x00301, 0x0004e, 0x00327, 0x0006e, 0x00327, 0x0004e, 0x0030c, 0x0006e, 0x0030c,
+  0x002bc, 0x0006e, 0x0004f, 0x00304, 0x0006f, 0x00304, 0x0004f, 0x00306, 0x0006f, 0x00306,
+  0x0004f, 0x0030b, 0x0006f, 0x0030b, 0x00052, 0x00301, 0x00072, 0x00301, 0x00052, 0x00327,
+  0x00072, 0x00327, 0x00052, 0x0030c, 0x00072, 0x0030c, 0x00053, 0x00301, 0x00073, 0x00301,
+  0x00053, 0x00302, 0x00073, 0x00302, 0x00053, 0x00327, 0x00073, 0x00327, 0x00053, 0x0030c,
+  0x00073, 0x0030c, 0x00054, 0x00327, 0x00074, 0x00327, 0x00054, 0x0030c, 0x00074, 0x0030c,
+  0x00055, 0x00303, 0x00075, 0x00303, 0x00055, 0x00304, 0x00075, 0x00304, 0x00055, 0x00306,
+  0x00075, 0x00306, 0x00055, 0x0030a, 0x00075, 0x0030a, 0x00055, 0x0030b, 0x00075, 0x0030b,
+  0x00055, 0x00328, 0x00075, 0x00328, 0x00057, 0x00302, 0x00077, 0x00302, 0x00059, 0x00302,
+  0x00079, 0x00302, 0x00059, 0x00308, 0x0005a, 0x00301, 0x0007a, 0x00301, 0x0005a, 0x00307,
+  0x0007a, 0x00307, 0x0005a, 0x0030c, 0x0007a, 0x0030c, 0x00073, 0x0004f, 0x0031b, 0x0006f,
+  0x0031b, 0x00055, 0x0031b, 0x00075, 0x0031b, 0x00044, 0x0005a, 0x0030c, 0x00044, 0x0007a,
+  0x0030c, 0x00064, 0x0007a, 0x0030c, 0x0004c, 0x0004a, 0x0004c, 0x0006a, 0x0006c, 0x0006a,
+  0x0004e, 0x0004a, 0x0004e, 0x0006a, 0x0006e, 0x0006a, 0x00041, 0x0030c, 0x00061, 0x0030c,
+  0x00049, 0x0030c, 0x00069, 0x0030c, 0x0004f, 0x0030c, 0x0006f, 0x0030c, 0x00055, 0x0030c,
+  0x00075, 0x0030c, 0x00055, 0x00308, 0x00304, 0x00075, 0x00308, 0x00304, 0x00055, 0x00308,
+  0x00301, 0x00075, 0x00308, 0x00301, 0x00055, 0x00308, 0x0030c, 0x00075, 0x00308, 0x0030c,
+  0x00055, 0x00308, 0x00300, 0x00075, 0x00308, 0x00300, 0x00041, 0x00308, 0x00304, 0x00061,
+  0x00308, 0x00304, 0x00041, 0x00307, 0x00304, 0x00061, 0x00307, 0x00304, 0x000c6, 0x00304,
+  0x000e6, 0x00304, 0x00047, 0x0030c, 0x00067, 0x0030c, 0x0004b, 0x0030c, 0x0006b, 0x0030c,
+  0x0004f, 0x00328, 0x0006f, 0x00328, 0x0004f, 0x00328, 0x00304, 0x0006f, 0x00328, 0x00304,
+  0x001b7, 0x0030c, 0x00292, 0x0030c, 0x0006a, 0x0030c, 0x00044, 0x0005a, 0x00044, 0x0007a,
+  0x00064, 0x0007a, 0x00047, 0x00301, 0x00067, 0x00301, 0x0004e, 0x00300, 0x0006e, 0x00300,
+  0x00041, 0x0030a, 0x00301, 0x00061, 0x0030a, 0x00301, 0x000c6, 0x00301, 0x000e6, 0x00301,
+  0x000d8, 0x00301, 0x000f8, 0x00301, 0x00041, 0x0030f, 0x00061, 0x0030f, 0x00041, 0x00311,
+  0x00061, 0x00311, 0x00045, 0x0030f, 0x00065, 0x0030f, 0x00045, 0x00311, 0x00065, 0x00311,
+  0x00049, 0x0030f, 0x00069, 0x0030f, 0x00049, 0x00311, 0x00069, 0x00311, 0x0004f, 0x0030f,
+  0x0006f, 0x0030f, 0x0004f, 0x00311, 0x0006f, 0x00311, 0x00052, 0x0030f, 0x00072, 0x0030f,
+  0x00052, 0x00311, 0x00072, 0x00311, 0x00055, 0x0030f, 0x00075, 0x0030f, 0x00055, 0x00311,
+  0x00075, 0x00311, 0x00053, 0x00326, 0x00073, 0x00326, 0x00054, 0x00326, 0x00074, 0x00326,
+  0x00048, 0x0030c, 0x00068, 0x0030c, 0x00041, 0x00307, 0x00061, 0x00307, 0x00045, 0x00327,
+  0x00065, 0x00327, 0x0004f, 0x00308, 0x00304, 0x0006f, 0x00308, 0x00304, 0x0004f, 0x00303,
+  0x00304, 0x0006f, 0x00303, 0x00304, 0x0004f, 0x00307, 0x0006f, 0x00307, 0x0004f, 0x00307,
+  0x00304, 0x0006f, 0x00307, 0x00304, 0x00059, 0x00304, 0x00079, 0x00304, 0x00068, 0x00266,
+  0x0006a, 0x00072, 0x00279, 0x0027b, 0x00281, 0x00077, 0x00079, 0x00020, 0x00306, 0x00020,
+  0x00307, 0x00020, 0x0030a, 0x00020, 0x00328, 0x00020, 0x00303, 0x00020, 0x0030b, 0x00263,
+  0x0006c, 0x00073, 0x00078, 0x00295, 0x00300, 0x00301, 0x00313, 0x00308, 0x00301, 0x002b9,
+  0x00020, 0x00345, 0x0003b, 0x00020, 0x00301, 0x000a8, 0x00301, 0x00020, 0x00308, 0x00301,
+  0x00391, 0x00301, 0x000b7, 0x00395, 0x00301, 0x00397, 0x00301, 0x00399, 0x00301, 0x0039f,
+  0x00301, 0x003a5, 0x00301, 0x003a9, 0x00301, 0x003b9, 0x00308, 0x00301, 0x00399, 0x00308,
+  0x003a5, 0x00308, 0x003b1, 0x00301, 0x003b5, 0x00301, 0x003b7, 0x00301, 0x003b9, 0x00301,
+  0x003c5, 0x00308, 0x00301, 0x003b9, 0x00308, 0x003c5, 0x00308, 0x003bf, 0x00301, 0x003c5,
+  0x00301, 0x003c9, 0x00301, 0x003b2, 0x003b8, 0x003a5, 0x003d2, 0x00301, 0x003a5, 0x00301,
+  0x003d2, 0x00308, 0x003a5, 0x00308, 0x003c6, 0x003c0, 0x003ba, 0x003c1, 0x003c2, 0x00398,
+  0x003b5, 0x003a3, 0x00415, 0x00300, 0x00415, 0x00308, 0x00413, 0x00301, 0x00406, 0x00308,
+  0x0041a, 0x00301, 0x00418, 0x00300, 0x00423, 0x00306, 0x00418, 0x00306, 0x00438, 0x00306,
+  0x00435, 0x00300, 0x00435, 0x00308, 0x00433, 0x00301, 0x00456, 0x00308, 0x0043a, 0x00301,
+  0x00438, 0x00300, 0x00443, 0x00306, 0x00474, 0x0030f, 0x00475, 0x0030f, 0x00416, 0x00306,
+  0x00436, 0x00306, 0x00410, 0x00306, 0x00430, 0x00306, 0x00410, 0x00308, 0x00430, 0x00308,
+  0x00415, 0x00306, 0x00435, 0x00306, 0x004d8, 0x00308, 0x004d9, 0x00308, 0x00416, 0x00308,
+  0x00436, 0x00308, 0x00417, 0x00308, 0x00437, 0x00308, 0x00418, 0x00304, 0x00438, 0x00304,
+  0x00418, 0x00308, 0x00438, 0x00308, 0x0041e, 0x00308, 0x0043e, 0x00308, 0x004e8, 0x00308,
+  0x004e9, 0x00308, 0x0042d, 0x00308, 0x0044d, 0x00308, 0x00423, 0x00304, 0x00443, 0x00304,
+  0x00423, 0x00308, 0x00443, 0x00308, 0x00423, 0x0030b, 0x00443, 0x0030b, 0x00427, 0x00308,
+  0x00447, 0x00308, 0x0042b, 0x00308, 0x0044b, 0x00308, 0x00565, 0x00582, 0x00627, 0x00653,
+  0x00627, 0x00654, 0x00648, 0x00654, 0x00627, 0x00655, 0x0064a, 0x00654, 0x00627, 0x00674,
+  0x00648, 0x00674, 0x006c7, 0x00674, 0x0064a, 0x00674, 0x006d5, 0x00654, 0x006c1, 0x00654,
+  0x006d2, 0x00654, 0x00928, 0x0093c, 0x00930, 0x0093c, 0x00933, 0x0093c, 0x00915, 0x0093c,
+  0x00916, 0x0093c, 0x00917, 0x0093c, 0x0091c, 0x0093c, 0x00921, 0x0093c, 0x00922, 0x0093c,
+  0x0092b, 0x0093c, 0x0092f, 0x0093c, 0x009c7, 0x009be, 0x009c7, 0x009d7, 0x009a1, 0x009bc,
+  0x009a2, 0x009bc, 0x009af, 0x009bc, 0x00a32, 0x00a3c, 0x00a38, 0x00a3c, 0x00a16, 0x00a3c,
+  0x00a17, 0x00a3c, 0x00a1c, 0x00a3c, 0x00a2b, 0x00a3c, 0x00b47, 0x00b56, 0x00b47, 0x00b3e,
+  0x00b47, 0x00b57, 0x00b21, 0x00b3c, 0x00b22, 0x00b3c, 0x00b92, 0x00bd7, 0x00bc6, 0x00bbe,
+  0x00bc7, 0x00bbe, 0x00bc6, 0x00bd7, 0x00c46, 0x00c56, 0x00cbf, 0x00cd5, 0x00cc6, 0x00cd5,
+  0x00cc6, 0x00cd6, 0x00cc6, 0x00cc2, 0x00cc6, 0x00cc2, 0x00cd5, 0x00d46, 0x00d3e, 0x00d47,
+  0x00d3e, 0x00d46, 0x00d57, 0x00dd9, 0x00dca, 0x00dd9, 0x00dcf, 0x00dd9, 0x00dcf, 0x00dca,
+  0x00dd9, 0x00ddf, 0x00e4d, 0x00e32, 0x00ecd, 0x00eb2, 0x00eab, 0x00e99, 0x00eab, 0x00ea1,
+  0x00f0b, 0x00f42, 0x00fb7, 0x00f4c, 0x00fb7, 0x00f51, 0x00fb7, 0x00f56, 0x00fb7, 0x00f5b,
+  0x00fb7, 0x00f40, 0x00fb5, 0x00f71, 0x00f72, 0x00f71, 0x00f74, 0x00fb2, 0x00f80, 0x00fb2,
+  0x00f71, 0x00f80, 0x00fb3, 0x00f80, 0x00fb3, 0x00f71, 0x00f80, 0x00f71, 0x00f80, 0x00f92,
+  0x00fb7, 0x00f9c, 0x00fb7, 0x00fa1, 0x00fb7, 0x00fa6, 0x00fb7, 0x00fab, 0x00fb7, 0x00f90,
+  0x00fb5, 0x01025, 0x0102e, 0x010dc, 0x01b05, 0x01b35, 0x01b07, 0x01b35, 0x01b09, 0x01b35,
+  0x01b0b, 0x01b35, 0x01b0d, 0x01b35, 0x01b11, 0x01b35, 0x01b3a, 0x01b35, 0x01b3c, 0x01b35,
+  0x01b3e, 0x01b35, 0x01b3f, 0x01b35, 0x01b42, 0x01b35, 0x00041, 0x000c6, 0x00042, 0x00044,
+  0x00045, 0x0018e, 0x00047, 0x00048, 0x00049, 0x0004a, 0x0004b, 0x0004c, 0x0004d, 0x0004e,
+  0x0004f, 0x00222, 0x00050, 0x00052, 0x00054, 0x00055, 0x00057, 0x00061, 0x00250, 0x00251,
+  0x01d02, 0x00062, 0x00064, 0x00065, 0x00259, 0x0025b, 0x0025c, 0x00067, 0x0006b, 0x0006d,
+  0x0014b, 0x0006f, 0x00254, 0x01d16, 0x01d17, 0x00070, 0x00074, 0x00075, 0x01d1d, 0x0026f,
+  0x00076, 0x01d25, 0x003b2, 0x003b3, 0x003b4, 0x003c6, 0x003c7, 0x00069, 0x00072, 0x00075,
+  0x00076, 0x003b2, 0x003b3, 0x003c1, 0x003c6, 0x003c7, 0x0043d, 0x00252, 0x00063, 0x00255,
+  0x000f0, 0x0025c, 0x00066, 0x0025f, 0x00261, 0x00265, 0x00268, 0x00269, 0x0026a, 0x01d7b,
+  0x0029d, 0x0026d, 0x01d85, 0x0029f, 0x00271, 0x00270, 0x00272, 0x00273, 0x00274, 0x00275,
+  0x00278, 0x00282, 0x00283, 0x001ab, 0x00289, 0x0028a, 0x01d1c, 0x0028b, 0x0028c, 0x0007a,
+  0x00290, 0x00291, 0x00292, 0x003b8, 0x00041, 0x00325, 0x00061, 0x00325, 0x00042, 0x00307,
+  0x00062, 0x00307, 0x00042, 0x00323, 0x00062, 0x00323, 0x00042, 0x00331, 0x00062, 0x00331,
+  0x00043, 0x00327, 0x00301, 0x00063, 0x00327, 0x00301, 0x00044, 0x00307, 0x00064, 0x00307,
+  0x00044, 0x00323, 0x00064, 0x00323, 0x00044, 0x00331, 0x00064, 0x00331, 0x00044, 0x00327,
+  0x00064, 0x00327, 0x00044, 0x0032d, 0x00064, 0x0032d, 0x00045, 0x00304, 0x00300, 0x00065,
+  0x00304, 0x00300, 0x00045, 0x00304, 0x00301, 0x00065, 0x00304, 0x00301, 0x00045, 0x0032d,
+  0x00065, 0x0032d, 0x00045, 0x00330, 0x00065, 0x00330, 0x00045, 0x00327, 0x00306, 0x00065,
+  0x00327, 0x00306, 0x00046, 0x00307, 0x00066, 0x00307, 0x00047, 0x00304, 0x00067, 0x00304,
+  0x00048, 0x00307, 0x00068, 0x00307, 0x00048, 0x00323, 0x00068, 0x00323, 0x00048, 0x00308,
+  0x00068, 0x00308, 0x00048, 0x00327, 0x00068, 0x00327, 0x00048, 0x0032e, 0x00068, 0x0032e,
+  0x00049, 0x00330, 0x00069, 0x00330, 0x00049, 0x00308, 0x00301, 0x00069, 0x00308, 0x00301,
+  0x0004b, 0x00301, 0x0006b, 0x00301, 0x0004b, 0x00323, 0x0006b, 0x00323, 0x0004b, 0x00331,
+  0x0006b, 0x00331, 0x0004c, 0x00323, 0x0006c, 0x00323, 0x0004c, 0x00323, 0x00304, 0x0006c,
+  0x00323, 0x00304, 0x0004c, 0x00331, 0x0006c, 0x00331, 0x0004c, 0x0032d, 0x0006c, 0x0032d,
+  0x0004d, 0x00301, 0x0006d, 0x00301, 0x0004d, 0x00307, 0x0006d, 0x00307, 0x0004d, 0x00323,
+  0x0006d, 0x00323, 0x0004e, 0x00307, 0x0006e, 0x00307, 0x0004e, 0x00323, 0x0006e, 0x00323,
+  0x0004e, 0x00331, 0x0006e, 0x00331, 0x0004e, 0x0032d, 0x0006e, 0x0032d, 0x0004f, 0x00303,
+  0x00301, 0x0006f, 0x00303, 0x00301, 0x0004f, 0x00303, 0x00308, 0x0006f, 0x00303, 0x00308,
+  0x0004f, 0x00304, 0x00300, 0x0006f, 0x00304, 0x00300, 0x0004f, 0x00304, 0x00301, 0x0006f,
+  0x00304, 0x00301, 0x00050, 0x00301, 0x00070, 0x00301, 0x00050, 0x00307, 0x00070, 0x00307,
+  0x00052, 0x00307, 0x00072, 0x00307, 0x00052, 0x00323, 0x00072, 0x00323, 0x00052, 0x00323,
+  0x00304, 0x00072, 0x00323, 0x00304, 0x00052, 0x00331, 0x00072, 0x00331, 0x00053, 0x00307,
+  0x00073, 0x00307, 0x00053, 0x00323, 0x00073, 0x00323, 0x00053, 0x00301, 0x00307, 0x00073,
+  0x00301, 0x00307, 0x00053, 0x0030c, 0x00307, 0x00073, 0x0030c, 0x00307, 0x00053, 0x00323,
+  0x00307, 0x00073, 0x00323, 0x00307, 0x00054, 0x00307, 0x00074, 0x00307, 0x00054, 0x00323,
+  0x00074, 0x00323, 0x00054, 0x00331, 0x00074, 0x00331, 0x00054, 0x0032d, 0x00074, 0x0032d,
+  0x00055, 0x00324, 0x00075, 0x00324, 0x00055, 0x00330, 0x00075, 0x00330, 0x00055, 0x0032d,
+  0x00075, 0x0032d, 0x00055, 0x00303, 0x00301, 0x00075, 0x00303, 0x00301, 0x00055, 0x00304,
+  0x00308, 0x00075, 0x00304, 0x00308, 0x00056, 0x00303, 0x00076, 0x00303, 0x00056, 0x00323,
+  0x00076, 0x00323, 0x00057, 0x00300, 0x00077, 0x00300, 0x00057, 0x00301, 0x00077, 0x00301,
+  0x00057, 0x00308, 0x00077, 0x00308, 0x00057, 0x00307, 0x00077, 0x00307, 0x00057, 0x00323,
+  0x00077, 0x00323, 0x00058, 0x00307, 0x00078, 0x00307, 0x00058, 0x00308, 0x00078, 0x00308,
+  0x00059, 0x00307, 0x00079, 0x00307, 0x0005a, 0x00302, 0x0007a, 0x00302, 0x0005a, 0x00323,
+  0x0007a, 0x00323, 0x0005a, 0x00331, 0x0007a, 0x00331, 0x00068, 0x00331, 0x00074, 0x00308,
+  0x00077, 0x0030a, 0x00079, 0x0030a, 0x00061, 0x002be, 0x0017f, 0x00307, 0x00073, 0x00307,
+  0x00041, 0x00323, 0x00061, 0x00323, 0x00041, 0x00309, 0x00061, 0x00309, 0x00041, 0x00302,
+  0x00301, 0x00061, 0x00302, 0x00301, 0x00041, 0x00302, 0x00300, 0x00061, 0x00302, 0x00300,
+  0x00041, 0x00302, 0x00309, 0x00061, 0x00302, 0x00309, 0x00041, 0x00302, 0x00303, 0x00061,
+  0x00302, 0x00303, 0x00041, 0x00323, 0x00302, 0x00061, 0x00323, 0x00302, 0x00041, 0x00306,
+  0x00301, 0x00061, 0x00306, 0x00301, 0x00041, 0x00306, 0x00300, 0x00061, 0x00306, 0x00300,
+  0x00041, 0x00306, 0x00309, 0x00061, 0x00306, 0x00309, 0x00041, 0x00306, 0x00303, 0x00061,
+  0x00306, 0x00303, 0x00041, 0x00323, 0x00306, 0x00061, 0x00323, 0x00306, 0x00045, 0x00323,
+  0x00065, 0x00323, 0x00045, 0x00309, 0x00065, 0x00309, 0x00045, 0x00303, 0x00065, 0x00303,
+  0x00045, 0x00302, 0x00301, 0x00065, 0x00302, 0x00301, 0x00045, 0x00302, 0x00300, 0x00065,
+  0x00302, 0x00300, 0x00045, 0x00302, 0x00309, 0x00065, 0x00302, 0x00309, 0x00045, 0x00302,
+  0x00303, 0x00065, 0x00302, 0x00303, 0x00045, 0x00323, 0x00302, 0x00065, 0x00323, 0x00302,
+  0x00049, 0x00309, 0x00069, 0x00309, 0x00049, 0x00323, 0x00069, 0x00323, 0x0004f, 0x00323,
+  0x0006f, 0x00323, 0x0004f, 0x00309, 0x0006f, 0x00309, 0x0004f, 0x00302, 0x00301, 0x0006f,
+  0x00302, 0x00301, 0x0004f, 0x00302, 0x00300, 0x0006f, 0x00302, 0x00300, 0x0004f, 0x00302,
+  0x00309, 0x0006f, 0x00302, 0x00309, 0x0004f, 0x00302, 0x00303, 0x0006f, 0x00302, 0x00303,
+  0x0004f, 0x00323, 0x00302, 0x0006f, 0x00323, 0x00302, 0x0004f, 0x0031b, 0x00301, 0x0006f,
+  0x0031b, 0x00301, 0x0004f, 0x0031b, 0x00300, 0x0006f, 0x0031b, 0x00300, 0x0004f, 0x0031b,
+  0x00309, 0x0006f, 0x0031b, 0x00309, 0x0004f, 0x0031b, 0x00303, 0x0006f, 0x0031b, 0x00303,
+  0x0004f, 0x0031b, 0x00323, 0x0006f, 0x0031b, 0x00323, 0x00055, 0x00323, 0x00075, 0x00323,
+  0x00055, 0x00309, 0x00075, 0x00309, 0x00055, 0x0031b, 0x00301, 0x00075, 0x0031b, 0x00301,
+  0x00055, 0x0031b, 0x00300, 0x00075, 0x0031b, 0x00300, 0x00055, 0x0031b, 0x00309, 0x00075,
+  0x0031b, 0x00309, 0x00055, 0x0031b, 0x00303, 0x00075, 0x0031b, 0x00303, 0x00055, 0x0031b,
+  0x00323, 0x00075, 0x0031b, 0x00323, 0x00059, 0x00300, 0x00079, 0x00300, 0x00059, 0x00323,
+  0x00079, 0x00323, 0x00059, 0x00309, 0x00079, 0x00309, 0x00059, 0x00303, 0x00079, 0x00303,
+  0x003b1, 0x00313, 0x003b1, 0x00314, 0x003b1, 0x00313, 0x00300, 0x003b1, 0x00314, 0x00300,
+  0x003b1, 0x00313, 0x00301, 0x003b1, 0x00314, 0x00301, 0x003b1, 0x00313, 0x00342, 0x003b1,
+  0x00314, 0x00342, 0x00391, 0x00313, 0x00391, 0x00314, 0x00391, 0x00313, 0x00300, 0x00391,
+  0x00314, 0x00300, 0x00391, 0x00313, 0x00301, 0x00391, 0x00314, 0x00301, 0x00391, 0x00313,
+  0x00342, 0x00391, 0x00314, 0x00342, 0x003b5, 0x00313, 0x003b5, 0x00314, 0x003b5, 0x00313,
+  0x00300, 0x003b5, 0x00314, 0x00300, 0x003b5, 0x00313, 0x00301, 0x003b5, 0x00314, 0x00301,
+  0x00395, 0x00313, 0x00395, 0x00314, 0x00395, 0x00313, 0x00300, 0x00395, 0x00314, 0x00300,
+  0x00395, 0x00313, 0x00301, 0x00395, 0x00314, 0x00301, 0x003b7, 0x00313, 0x003b7, 0x00314,
+  0x003b7, 0x00313, 0x00300, 0x003b7, 0x00314, 0x00300, 0x003b7, 0x00313, 0x00301, 0x003b7,
+  0x00314, 0x00301, 0x003b7, 0x00313, 0x00342, 0x003b7, 0x00314, 0x00342, 0x00397, 0x00313,
+  0x00397, 0x00314, 0x00397, 0x00313, 0x00300, 0x00397, 0x00314, 0x00300, 0x00397, 0x00313,
+  0x00301, 0x00397, 0x00314, 0x00301, 0x00397, 0x00313, 0x00342, 0x00397, 0x00314, 0x00342,
+  0x003b9, 0x00313, 0x003b9, 0x00314, 0x003b9, 0x00313, 0x00300, 0x003b9, 0x00314, 0x00300,
+  0x003b9, 0x00313, 0x00301, 0x003b9, 0x00314, 0x00301, 0x003b9, 0x00313, 0x00342, 0x003b9,
+  0x00314, 0x00342, 0x00399, 0x00313, 0x00399, 0x00314, 0x00399, 0x00313, 0x00300, 0x00399,
+  0x00314, 0x00300, 0x00399, 0x00313, 0x00301, 0x00399, 0x00314, 0x00301, 0x00399, 0x00313,
+  0x00342, 0x00399, 0x00314, 0x00342, 0x003bf, 0x00313, 0x003bf, 0x00314, 0x003bf, 0x00313,
+  0x00300, 0x003bf, 0x00314, 0x00300, 0x003bf, 0x00313, 0x00301, 0x003bf, 0x00314, 0x00301,
+  0x0039f, 0x00313, 0x0039f, 0x00314, 0x0039f, 0x00313, 0x00300, 0x0039f, 0x00314, 0x00300,
+  0x0039f, 0x00313, 0x00301, 0x0039f, 0x00314, 0x00301, 0x003c5, 0x00313, 0x003c5, 0x00314,
+  0x003c5, 0x00313, 0x00300, 0x003c5, 0x00314, 0x00300, 0x003c5, 0x00313, 0x00301, 0x003c5,
+  0x00314, 0x00301, 0x003c5, 0x00313, 0x00342, 0x003c5, 0x00314, 0x00342, 0x003a5, 0x00314,
+  0x003a5, 0x00314, 0x00300, 0x003a5, 0x00314, 0x00301, 0x003a5, 0x00314, 0x00342, 0x003c9,
+  0x00313, 0x003c9, 0x00314, 0x003c9, 0x00313, 0x00300, 0x003c9, 0x00314, 0x00300, 0x003c9,
+  0x00313, 0x00301, 0x003c9, 0x00314, 0x00301, 0x003c9, 0x00313, 0x00342, 0x003c9, 0x00314,
+  0x00342, 0x003a9, 0x00313, 0x003a9, 0x00314, 0x003a9, 0x00313, 0x00300, 0x003a9, 0x00314,
+  0x00300, 0x003a9, 0x00313, 0x00301, 0x003a9, 0x00314, 0x00301, 0x003a9, 0x00313, 0x00342,
+  0x003a9, 0x00314, 0x00342, 0x003b1, 0x00300, 0x003b1, 0x00301, 0x003b5, 0x00300, 0x003b5,
+  0x00301, 0x003b7, 0x00300, 0x003b7, 0x00301, 0x003b9, 0x00300, 0x003b9, 0x00301, 0x003bf,
+  0x00300, 0x003bf, 0x00301, 0x003c5, 0x00300, 0x003c5, 0x00301, 0x003c9, 0x00300, 0x003c9,
+  0x00301, 0x003b1, 0x00313, 0x00345, 0x003b1, 0x00314, 0x00345, 0x003b1, 0x00313, 0x00300,
+  0x00345, 0x003b1, 0x00314, 0x00300, 0x00345, 0x003b1, 0x00313, 0x00301, 0x00345, 0x003b1,
+  0x00314, 0x00301, 0x00345, 0x003b1, 0x00313, 0x00342, 0x00345, 0x003b1, 0x00314, 0x00342,
+  0x00345, 0x00391, 0x00313, 0x00345, 0x00391, 0x00314, 0x00345, 0x00391, 0x00313, 0x00300,
+  0x00345, 0x00391, 0x00314, 0x00300, 0x00345, 0x00391, 0x00313, 0x00301, 0x00345, 0x00391,
+  0x00314, 0x00301, 0x00345, 0x00391, 0x00313, 0x00342, 0x00345, 0x00391, 0x00314, 0x00342,
+  0x00345, 0x003b7, 0x00313, 0x00345, 0x003b7, 0x00314, 0x00345, 0x003b7, 0x00313, 0x00300,
+  0x00345, 0x003b7, 0x00314, 0x00300, 0x00345, 0x003b7, 0x00313, 0x00301, 0x00345, 0x003b7,
+  0x00314, 0x00301, 0x00345, 0x003b7, 0x00313, 0x00342, 0x00345, 0x003b7, 0x00314, 0x00342,
+  0x00345, 0x00397, 0x00313, 0x00345, 0x00397, 0x00314, 0x00345, 0x00397, 0x00313, 0x00300,
+  0x00345, 0x00397, 0x00314, 0x00300, 0x00345, 0x00397, 0x00313, 0x00301, 0x00345, 0x00397,
+  0x00314, 0x00301, 0x00345, 0x00397, 0x00313, 0x00342, 0x00345, 0x00397, 0x00314, 0x00342,
+  0x00345, 0x003c9, 0x00313, 0x00345, 0x003c9, 0x00314, 0x00345, 0x003c9, 0x00313, 0x00300,
+  0x00345, 0x003c9, 0x00314, 0x00300, 0x00345, 0x003c9, 0x00313, 0x00301, 0x00345, 0x003c9,
+  0x00314, 0x00301, 0x00345, 0x003c9, 0x00313, 0x00342, 0x00345, 0x003c9, 0x00314, 0x00342,
+  0x00345, 0x003a9, 0x00313, 0x00345, 0x003a9, 0x00314, 0x00345, 0x003a9, 0x00313, 0x00300,
+  0x00345, 0x003a9, 0x00314, 0x00300, 0x00345, 0x003a9, 0x00313, 0x00301, 0x00345, 0x003a9,
+  0x00314, 0x00301, 0x00345, 0x003a9, 0x00313, 0x00342, 0x00345, 0x003a9, 0x00314, 0x00342,
+  0x00345, 0x003b1, 0x00306, 0x003b1, 0x00304, 0x003b1, 0x00300, 0x00345, 0x003b1, 0x00345,
+  0x003b1, 0x00301, 0x00345, 0x003b1, 0x00342, 0x003b1, 0x00342, 0x00345, 0x00391, 0x00306,
+  0x00391, 0x00304, 0x00391, 0x00300, 0x00391, 0x00301, 0x00391, 0x00345, 0x00020, 0x00313,
+  0x003b9, 0x00020, 0x00313, 0x00020, 0x00342, 0x000a8, 0x00342, 0x00020, 0x00308, 0x00342,
+  0x003b7, 0x00300, 0x00345, 0x003b7, 0x00345, 0x003b7, 0x00301, 0x00345, 0x003b7, 0x00342,
+  0x003b7, 0x00342, 0x00345, 0x00395, 0x00300, 0x00395, 0x00301, 0x00397, 0x00300, 0x00397,
+  0x00301, 0x00397, 0x00345, 0x01fbf, 0x00300, 0x00020, 0x00313, 0x00300, 0x01fbf, 0x00301,
+  0x00020, 0x00313, 0x00301, 0x01fbf, 0x00342, 0x00020, 0x00313, 0x00342, 0x003b9, 0x00306,
+  0x003b9, 0x00304, 0x003b9, 0x00308, 0x00300, 0x003b9, 0x00308, 0x00301, 0x003b9, 0x00342,
+  0x003b9, 0x00308, 0x00342, 0x00399, 0x00306, 0x00399, 0x00304, 0x00399, 0x00300, 0x00399,
+  0x00301, 0x01ffe, 0x00300, 0x00020, 0x00314, 0x00300, 0x01ffe, 0x00301, 0x00020, 0x00314,
+  0x00301, 0x01ffe, 0x00342, 0x00020, 0x00314, 0x00342, 0x003c5, 0x00306, 0x003c5, 0x00304,
+  0x003c5, 0x00308, 0x00300, 0x003c5, 0x00308, 0x00301, 0x003c1, 0x00313, 0x003c1, 0x00314,
+  0x003c5, 0x00342, 0x003c5, 0x00308, 0x00342, 0x003a5, 0x00306, 0x003a5, 0x00304, 0x003a5,
+  0x00300, 0x003a5, 0x00301, 0x003a1, 0x00314, 0x000a8, 0x00300, 0x00020, 0x00308, 0x00300,
+  0x000a8, 0x00301, 0x00020, 0x00308, 0x00301, 0x00060, 0x003c9, 0x00300, 0x00345, 0x003c9,
+  0x00345, 0x003c9, 0x00301, 0x00345, 0x003c9, 0x00342, 0x003c9, 0x00342, 0x00345, 0x0039f,
+  0x00300, 0x0039f, 0x00301, 0x003a9, 0x00300, 0x003a9, 0x00301, 0x003a9, 0x00345, 0x000b4,
+  0x00020, 0x00301, 0x00020, 0x00314, 0x02002, 0x00020, 0x02003, 0x00020, 0x00020, 0x00020,
+  0x00020, 0x00020, 0x00020, 0x00020, 0x00020, 0x00020, 0x00020, 0x02010, 0x00020, 0x00333,
+  0x0002e, 0x0002e, 0x0002e, 0x0002e, 0x0002e, 0x0002e, 0x00020, 0x02032, 0x02032, 0x02032,
+  0x02032, 0x02032, 0x02035, 0x02035, 0x02035, 0x02035, 0x02035, 0x00021, 0x00021, 0x00020,
+  0x00305, 0x0003f, 0x0003f, 0x0003f, 0x00021, 0x00021, 0x0003f, 0x02032, 0x02032, 0x02032,
+  0x02032, 0x00020, 0x00030, 0x00069, 0x00034, 0x00035, 0x00036, 0x00037, 0x00038, 0x00039,
+  0x0002b, 0x02212, 0x0003d, 0x00028, 0x00029, 0x0006e, 0x00030, 0x00031, 0x00032, 0x00033,
+  0x00034, 0x00035, 0x00036, 0x00037, 0x00038, 0x00039, 0x0002b, 0x02212, 0x0003d, 0x00028,
+  0x00029, 0x00061, 0x00065, 0x0006f, 0x00078, 0x00259, 0x00068, 0x0006b, 0x0006c, 0x0006d,
+  0x0006e, 0x00070, 0x00073, 0x00074, 0x00052, 0x00073, 0x00061, 0x0002f, 0x00063, 0x00061,
+  0x0002f, 0x00073, 0x00043, 0x000b0, 0x00043, 0x00063, 0x0002f, 0x0006f, 0x00063, 0x0002f,
+  0x00075, 0x00190, 0x000b0, 0x00046, 0x00067, 0x00048, 0x00048, 0x00048, 0x00068, 0x00127,
+  0x00049, 0x00049, 0x0004c, 0x0006c, 0x0004e, 0x0004e, 0x0006f, 0x00050, 0x00051, 0x00052,
+  0x00052, 0x00052, 0x00053, 0x0004d, 0x00054, 0x00045, 0x0004c, 0x00054, 0x0004d, 0x0005a,
+  0x003a9, 0x0005a, 0x0004b, 0x00041, 0x0030a, 0x00042, 0x00043, 0x00065, 0x00045, 0x00046,
+  0x0004d, 0x0006f, 0x005d0, 0x005d1, 0x005d2, 0x005d3, 0x00069, 0x00046, 0x00041, 0x00058,
+  0x003c0, 0x003b3, 0x00393, 0x003a0, 0x02211, 0x00044, 0x00064, 0x00065, 0x00069, 0x0006a,
+  0x00031, 0x02044, 0x00037, 0x00031, 0x02044, 0x00039, 0x00031, 0x02044, 0x00031, 0x00030,
+  0x00031, 0x02044, 0x00033, 0x00032, 0x02044, 0x00033, 0x00031, 0x02044, 0x00035, 0x00032,
+  0x02044, 0x00035, 0x00033, 0x02044, 0x00035, 0x00034, 0x02044, 0x00035, 0x00031, 0x02044,
+  0x00036, 0x00035, 0x02044, 0x00036, 0x00031, 0x02044, 0x00038, 0x00033, 0x02044, 0x00038,
+  0x00035, 0x02044, 0x00038, 0x00037, 0x02044, 0x00038, 0x00031, 0x02044, 0x00049, 0x00049,
+  0x00049, 0x00049, 0x00049, 0x00049, 0x00049, 0x00056, 0x00056, 0x00056, 0x00049, 0x00056,
+  0x00049, 0x00049, 0x00056, 0x00049, 0x00049, 0x00049, 0x00049, 0x00058, 0x00058, 0x00058,
+  0x00049, 0x00058, 0x00049, 0x00049, 0x0004c, 0x00043, 0x00044, 0x0004d, 0x00069, 0x00069,
+  0x00069, 0x00069, 0x00069, 0x00069, 0x00069, 0x00076, 0x00076, 0x00076, 0x00069, 0x00076,
+  0x00069, 0x00069, 0x00076, 0x00069, 0x00069, 0x00069, 0x00069, 0x00078, 0x00078, 0x00078,
+  0x00069, 0x00078, 0x00069, 0x00069, 0x0006c, 0x00063, 0x00064, 0x0006d, 0x00030, 0x02044,
+  0x00033, 0x02190, 0x00338, 0x02192, 0x00338, 0x02194, 0x00338, 0x021d0, 0x00338, 0x021d4,
+  0x00338, 0x021d2, 0x00338, 0x02203, 0x00338, 0x02208, 0x00338, 0x0220b, 0x00338, 0x02223,
+  0x00338, 0x02225, 0x00338, 0x0222b, 0x0222b, 0x0222b, 0x0222b, 0x0222b, 0x0222e, 0x0222e,
+  0x0222e, 0x0222e, 0x0222e, 0x0223c, 0x00338, 0x02243, 0x00338, 0x02245, 0x00338, 0x02248,
+  0x00338, 0x0003d, 0x00338, 0x02261, 0x00338, 0x0224d, 0x00338, 0x0003c, 0x00338, 0x0003e,
+  0x00338, 0x02264, 0x00338, 0x02265, 0x00338, 0x02272, 0x00338, 0x02273, 0x00338, 0x02276,
+  0x00338, 0x02277, 0x00338, 0x0227a, 0x00338, 0x0227b, 0x00338, 0x02282, 0x00338, 0x02283,
+  0x00338, 0x02286, 0x00338, 0x02287, 0x00338, 0x022a2, 0x00338, 0x022a8, 0x00338, 0x022a9,
+  0x00338, 0x022ab, 0x00338, 0x0227c, 0x00338, 0x0227d, 0x00338, 0x02291, 0x00338, 0x02292,
+  0x00338, 0x022b2, 0x00338, 0x022b3, 0x00338, 0x022b4, 0x00338, 0x022b5, 0x00338, 0x03008,
+  0x03009, 0x00031, 0x00032, 0x00033, 0x00034, 0x00035, 0x00036, 0x00037, 0x00038, 0x00039,
+  0x00031, 0x00030, 0x00031, 0x00031, 0x00031, 0x00032, 0x00031, 0x00033, 0x00031, 0x00034,
+  0x00031, 0x00035, 0x00031, 0x00036, 0x00031, 0x00037, 0x00031, 0x00038, 0x00031, 0x00039,
+  0x00032, 0x00030, 0x00028, 0x00031, 0x00029, 0x00028, 0x00032, 0x00029, 0x00028, 0x00033,
+  0x00029, 0x00028, 0x00034, 0x00029, 0x00028, 0x00035, 0x00029, 0x00028, 0x00036, 0x00029,
+  0x00028, 0x00037, 0x00029, 0x00028, 0x00038, 0x00029, 0x00028, 0x00039, 0x00029, 0x00028,
+  0x00031, 0x00030, 0x00029, 0x00028, 0x00031, 0x00031, 0x00029, 0x00028, 0x00031, 0x00032,
+  0x00029, 0x00028, 0x00031, 0x00033, 0x00029, 0x00028, 0x00031, 0x00034, 0x00029, 0x00028,
+  0x00031, 0x00035, 0x00029, 0x00028, 0x00031, 0x00036, 0x00029, 0x00028, 0x00031, 0x00037,
+  0x00029, 0x00028, 0x00031, 0x00038, 0x00029, 0x00028, 0x00031, 0x00039, 0x00029, 0x00028,
+  0x00032, 0x00030, 0x00029, 0x00031, 0x0002e, 0x00032, 0x0002e, 0x00033, 0x0002e, 0x00034,
+  0x0002e, 0x00035, 0x0002e, 0x00036, 0x0002e, 0x00037, 0x0002e, 0x00038, 0x0002e, 0x00039,
+  0x0002e, 0x00031, 0x00030, 0x0002e, 0x00031, 0x00031, 0x0002e, 0x00031, 0x00032, 0x0002e,
+  0x00031, 0x00033, 0x0002e, 0x00031, 0x00034, 0x0002e, 0x00031, 0x00035, 0x0002e, 0x00031,
+  0x00036, 0x0002e, 0x00031, 0x00037, 0x0002e, 0x00031, 0x00038, 0x0002e, 0x00031, 0x00039,
+  0x0002e, 0x00032, 0x00030, 0x0002e, 0x00028, 0x00061, 0x00029, 0x00028, 0x00062, 0x00029,
+  0x00028, 0x00063, 0x00029, 0x00028, 0x00064, 0x00029, 0x00028, 0x00065, 0x00029, 0x00028,
+  0x00066, 0x00029, 0x00028, 0x00067, 0x00029, 0x00028, 0x00068, 0x00029, 0x00028, 0x00069,
+  0x00029, 0x00028, 0x0006a, 0x00029, 0x00028, 0x0006b, 0x00029, 0x00028, 0x0006c, 0x00029,
+  0x00028, 0x0006d, 0x00029, 0x00028, 0x0006e, 0x00029, 0x00028, 0x0006f, 0x00029, 0x00028,
+  0x00070, 0x00029, 0x00028, 0x00071, 0x00029, 0x00028, 0x00072, 0x00029, 0x00028, 0x00073,
+  0x00029, 0x00028, 0x00074, 0x00029, 0x00028, 0x00075, 0x00029, 0x00028, 0x00076, 0x00029,
+  0x00028, 0x00077, 0x00029, 0x00028, 0x00078, 0x00029, 0x00028, 0x00079, 0x00029, 0x00028,
+  0x0007a, 0x00029, 0x00041, 0x00042, 0x00043, 0x00044, 0x00045, 0x00046, 0x00047, 0x00048,
+  0x00049, 0x0004a, 0x0004b, 0x0004c, 0x0004d, 0x0004e, 0x0004f, 0x00050, 0x00051, 0x00052,
+  0x00053, 0x00054, 0x00055, 0x00056, 0x00057, 0x00058, 0x00059, 0x0005a, 0x00061, 0x00062,
+  0x00063, 0x00064, 0x00065, 0x00066, 0x00067, 0x00068, 0x00069, 0x0006a, 0x0006b, 0x0006c,
+  0x0006d, 0x0006e, 0x0006f, 0x00070, 0x00071, 0x00072, 0x00073, 0x00074, 0x00075, 0x00076,
+  0x00077, 0x00078, 0x00079, 0x0007a, 0x00030, 0x0222b, 0x0222b, 0x0222b, 0x0222b, 0x0003a,
+  0x0003a, 0x0003d, 0x0003d, 0x0003d, 0x0003d, 0x0003d, 0x0003d, 0x02add, 0x00338, 0x0006a,
+  0x00056, 0x02d61, 0x06bcd, 0x09f9f, 0x04e00, 0x04e28, 0x04e36, 0x04e3f, 0x04e59, 0x04e85,
+  0x04e8c, 0x04ea0, 0x04eba, 0x0513f, 0x05165, 0x0516b, 0x05182, 0x05196, 0x051ab, 0x051e0,
+  0x051f5, 0x05200, 0x0529b, 0x052f9, 0x05315, 0x0531a, 0x05338, 0x05341, 0x0535c, 0x05369,
+  0x05382, 0x053b6, 0x053c8, 0x053e3, 0x056d7, 0x0571f, 0x058eb, 0x05902, 0x0590a, 0x05915,
+  0x05927, 0x05973, 0x05b50, 0x05b80, 0x05bf8, 0x05c0f, 0x05c22, 0x05c38, 0x05c6e, 0x05c71,
+  0x05ddb, 0x05de5, 0x05df1, 0x05dfe, 0x05e72, 0x05e7a, 0x05e7f, 0x05ef4, 0x05efe, 0x05f0b,
+  0x05f13, 0x05f50, 0x05f61, 0x05f73, 0x05fc3, 0x06208, 0x06236, 0x0624b, 0x0652f, 0x06534,
+  0x06587, 0x06597, 0x065a4, 0x065b9, 0x065e0, 0x065e5, 0x066f0, 0x06708, 0x06728, 0x06b20,
+  0x06b62, 0x06b79, 0x06bb3, 0x06bcb, 0x06bd4, 0x06bdb, 0x06c0f, 0x06c14, 0x06c34, 0x0706b,
+  0x0722a, 0x07236, 0x0723b, 0x0723f, 0x07247, 0x07259, 0x0725b, 0x072ac, 0x07384, 0x07389,
+  0x074dc, 0x074e6, 0x07518, 0x0751f, 0x07528, 0x07530, 0x0758b, 0x07592, 0x07676, 0x0767d,
+  0x076ae, 0x076bf, 0x076ee, 0x077db, 0x077e2, 0x077f3, 0x0793a, 0x079b8, 0x079be, 0x07a74,
+  0x07acb, 0x07af9, 0x07c73, 0x07cf8, 0x07f36, 0x07f51, 0x07f8a, 0x07fbd, 0x08001, 0x0800c,
+  0x08012, 0x08033, 0x0807f, 0x08089, 0x081e3, 0x081ea, 0x081f3, 0x081fc, 0x0820c, 0x0821b,
+  0x0821f, 0x0826e, 0x08272, 0x08278, 0x0864d, 0x0866b, 0x08840, 0x0884c, 0x08863, 0x0897e,
+  0x0898b, 0x089d2, 0x08a00, 0x08c37, 0x08c46, 0x08c55, 0x08c78, 0x08c9d, 0x08d64, 0x08d70,
+  0x08db3, 0x08eab, 0x08eca, 0x08f9b, 0x08fb0, 0x08fb5, 0x09091, 0x09149, 0x091c6, 0x091cc,
+  0x091d1, 0x09577, 0x09580, 0x0961c, 0x096b6, 0x096b9, 0x096e8, 0x09751, 0x0975e, 0x09762,
+  0x09769, 0x097cb, 0x097ed, 0x097f3, 0x09801, 0x098a8, 0x098db, 0x098df, 0x09996, 0x09999,
+  0x099ac, 0x09aa8, 0x09ad8, 0x09adf, 0x09b25, 0x09b2f, 0x09b32, 0x09b3c, 0x09b5a, 0x09ce5,
+  0x09e75, 0x09e7f, 0x09ea5, 0x09ebb, 0x09ec3, 0x09ecd, 0x09ed1, 0x09ef9, 0x09efd, 0x09f0e,
+  0x09f13, 0x09f20, 0x09f3b, 0x09f4a, 0x09f52, 0x09f8d, 0x09f9c, 0x09fa0, 0x00020, 0x03012,
+  0x05341, 0x05344, 0x05345, 0x0304b, 0x03099, 0x0304d, 0x03099, 0x0304f, 0x03099, 0x03051,
+  0x03099, 0x03053, 0x03099, 0x03055, 0x03099, 0x03057, 0x03099, 0x03059, 0x03099, 0x0305b,
+  0x03099, 0x0305d, 0x03099, 0x0305f, 0x03099, 0x03061, 0x03099, 0x03064, 0x03099, 0x03066,
+  0x03099, 0x03068, 0x03099, 0x0306f, 0x03099, 0x0306f, 0x0309a, 0x03072, 0x03099, 0x03072,
+  0x0309a, 0x03075, 0x03099, 0x03075, 0x0309a, 0x03078, 0x03099, 0x03078, 0x0309a, 0x0307b,
+  0x03099, 0x0307b, 0x0309a, 0x03046, 0x03099, 0x00020, 0x03099, 0x00020, 0x0309a, 0x0309d,
+  0x03099, 0x03088, 0x0308a, 0x030ab, 0x03099, 0x030ad, 0x03099, 0x030af, 0x03099, 0x030b1,
+  0x03099, 0x030b3, 0x03099, 0x030b5, 0x03099, 0x030b7, 0x03099, 0x030b9, 0x03099, 0x030bb,
+  0x03099, 0x030bd, 0x03099, 0x030bf, 0x03099, 0x030c1, 0x03099, 0x030c4, 0x03099, 0x030c6,
+  0x03099, 0x030c8, 0x03099, 0x030cf, 0x03099, 0x030cf, 0x0309a, 0x030d2, 0x03099, 0x030d2,
+  0x0309a, 0x030d5, 0x03099, 0x030d5, 0x0309a, 0x030d8, 0x03099, 0x030d8, 0x0309a, 0x030db,
+  0x03099, 0x030db, 0x0309a, 0x030a6, 0x03099, 0x030ef, 0x03099, 0x030f0, 0x03099, 0x030f1,
+  0x03099, 0x030f2, 0x03099, 0x030fd, 0x03099, 0x030b3, 0x030c8, 0x01100, 0x01101, 0x011aa,
+  0x01102, 0x011ac, 0x011ad, 0x01103, 0x01104, 0x01105, 0x011b0, 0x011b1, 0x011b2, 0x011b3,
+  0x011b4, 0x011b5, 0x0111a, 0x01106, 0x01107, 0x01108, 0x01121, 0x01109, 0x0110a, 0x0110b,
+  0x0110c, 0x0110d, 0x0110e, 0x0110f, 0x01110, 0x01111, 0x01112, 0x01161, 0x01162, 0x01163,
+  0x01164, 0x01165, 0x01166, 0x01167, 0x01168, 0x01169, 0x0116a, 0x0116b, 0x0116c, 0x0116d,
+  0x0116e, 0x0116f, 0x01170, 0x01171, 0x01172, 0x01173, 0x01174, 0x01175, 0x01160, 0x01114,
+  0x01115, 0x011c7, 0x011c8, 0x011cc, 0x011ce, 0x011d3, 0x011d7, 0x011d9, 0x0111c, 0x011dd,
+  0x011df, 0x0111d, 0x0111e, 0x01120, 0x01122, 0x01123, 0x01127, 0x01129, 0x0112b, 0x0112c,
+  0x0112d, 0x0112e, 0x0112f, 0x01132, 0x01136, 0x01140, 0x01147, 0x0114c, 0x011f1, 0x011f2,
+  0x01157, 0x01158, 0x01159, 0x01184, 0x01185, 0x01188, 0x01191, 0x01192, 0x01194, 0x0119e,
+  0x011a1, 0x04e00, 0x04e8c, 0x04e09, 0x056db, 0x04e0a, 0x04e2d, 0x04e0b, 0x07532, 0x04e59,
+  0x04e19, 0x04e01, 0x05929, 0x05730, 0x04eba, 0x00028, 0x01100, 0x00029, 0x00028, 0x01102,
+  0x00029, 0x00028, 0x01103, 0x00029, 0x00028, 0x01105, 0x00029, 0x00028, 0x01106, 0x00029,
+  0x00028, 0x01107, 0x00029, 0x00028, 0x01109, 0x00029, 0x00028, 0x0110b, 0x00029, 0x00028,
+  0x0110c, 0x00029, 0x00028, 0x0110e, 0x00029, 0x00028, 0x0110f, 0x00029, 0x00028, 0x01110,
+  0x00029, 0x00028, 0x01111, 0x00029, 0x00028, 0x01112, 0x00029, 0x00028, 0x01100, 0x01161,
+  0x00029, 0x00028, 0x01102, 0x01161, 0x00029, 0x00028, 0x01103, 0x01161, 0x00029, 0x00028,
+  0x01105, 0x01161, 0x00029, 0x00028, 0x01106, 0x01161, 0x00029, 0x00028, 0x01107, 0x01161,
+  0x00029, 0x00028, 0x01109, 0x01161, 0x00029, 0x00028, 0x0110b, 0x01161, 0x00029, 0x00028,
+  0x0110c, 0x01161, 0x00029, 0x00028, 0x0110e, 0x01161, 0x00029, 0x00028, 0x0110f, 0x01161,
+  0x00029, 0x00028, 0x01110, 0x01161, 0x00029, 0x00028, 0x01111, 0x01161, 0x00029, 0x00028,
+  0x01112, 0x01161, 0x00029, 0x00028, 0x0110c, 0x0116e, 0x00029, 0x00028, 0x0110b, 0x01169,
+  0x0110c, 0x01165, 0x011ab, 0x00029, 0x00028, 0x0110b, 0x01169, 0x01112, 0x0116e, 0x00029,
+  0x00028, 0x04e00, 0x00029, 0x00028, 0x04e8c, 0x00029, 0x00028, 0x04e09, 0x00029, 0x00028,
+  0x056db, 0x00029, 0x00028, 0x04e94, 0x00029, 0x00028, 0x0516d, 0x00029, 0x00028, 0x04e03,
+  0x00029, 0x00028, 0x0516b, 0x00029, 0x00028, 0x04e5d, 0x00029, 0x00028, 0x05341, 0x00029,
+  0x00028, 0x06708, 0x00029, 0x00028, 0x0706b, 0x00029, 0x00028, 0x06c34, 0x00029, 0x00028,
+  0x06728, 0x00029, 0x00028, 0x091d1, 0x00029, 0x00028, 0x0571f, 0x00029, 0x00028, 0x065e5,
+  0x00029, 0x00028, 0x0682a, 0x00029, 0x00028, 0x06709, 0x00029, 0x00028, 0x0793e, 0x00029,
+  0x00028, 0x0540d, 0x00029, 0x00028, 0x07279, 0x00029, 0x00028, 0x08ca1, 0x00029, 0x00028,
+  0x0795d, 0x00029, 0x00028, 0x052b4, 0x00029, 0x00028, 0x04ee3, 0x00029, 0x00028, 0x0547c,
+  0x00029, 0x00028, 0x05b66, 0x00029, 0x00028, 0x076e3, 0x00029, 0x00028, 0x04f01, 0x00029,
+  0x00028, 0x08cc7, 0x00029, 0x00028, 0x05354, 0x00029, 0x00028, 0x0796d, 0x00029, 0x00028,
+  0x04f11, 0x00029, 0x00028, 0x081ea, 0x00029, 0x00028, 0x081f3, 0x00029, 0x0554f, 0x05e7c,
+  0x06587, 0x07b8f, 0x00050, 0x00054, 0x00045, 0x00032, 0x00031, 0x00032, 0x00032, 0x00032,
+  0x00033, 0x00032, 0x00034, 0x00032, 0x00035, 0x00032, 0x00036, 0x00032, 0x00037, 0x00032,
+  0x00038, 0x00032, 0x00039, 0x00033, 0x00030, 0x00033, 0x00031, 0x00033, 0x00032, 0x00033,
+  0x00033, 0x00033, 0x00034, 0x00033, 0x00035, 0x01100, 0x01102, 0x01103, 0x01105, 0x01106,
+  0x01107, 0x01109, 0x0110b, 0x0110c, 0x0110e, 0x0110f, 0x01110, 0x01111, 0x01112, 0x01100,
+  0x01161, 0x01102, 0x01161, 0x01103, 0x01161, 0x01105, 0x01161, 0x01106, 0x01161, 0x01107,
+  0x01161, 0x01109, 0x01161, 0x0110b, 0x01161, 0x0110c, 0x01161, 0x0110e, 0x01161, 0x0110f,
+  0x01161, 0x01110, 0x01161, 0x01111, 0x01161, 0x01112, 0x01161, 0x0110e, 0x01161, 0x011b7,
+  0x01100, 0x01169, 0x0110c, 0x0116e, 0x0110b, 0x01174, 0x0110b, 0x0116e, 0x04e00, 0x04e8c,
+  0x04e09, 0x056db, 0x04e94, 0x0516d, 0x04e03, 0x0516b, 0x04e5d, 0x05341, 0x06708, 0x0706b,
+  0x06c34, 0x06728, 0x091d1, 0x0571f, 0x065e5, 0x0682a, 0x06709, 0x0793e, 0x0540d, 0x07279,
+  0x08ca1, 0x0795d, 0x052b4, 0x079d8, 0x07537, 0x05973, 0x09069, 0x0512a, 0x05370, 0x06ce8,
+  0x09805, 0x04f11, 0x05199, 0x06b63, 0x04e0a, 0x04e2d, 0x04e0b, 0x05de6, 0x053f3, 0x0533b,
+  0x05b97, 0x05b66, 0x076e3, 0x04f01, 0x08cc7, 0x05354, 0x0591c, 0x00033, 0x00036, 0x00033,
+  0x00037, 0x00033, 0x00038, 0x00033, 0x00039, 0x00034, 0x00030, 0x00034, 0x00031, 0x00034,
+  0x00032, 0x00034, 0x00033, 0x00034, 0x00034, 0x00034, 0x00035, 0x00034, 0x00036, 0x00034,
+  0x00037, 0x00034, 0x00038, 0x00034, 0x00039, 0x00035, 0x00030, 0x00031, 0x06708, 0x00032,
+  0x06708, 0x00033, 0x06708, 0x00034, 0x06708, 0x00035, 0x06708, 0x00036, 0x06708, 0x00037,
+  0x06708, 0x00038, 0x06708, 0x00039, 0x06708, 0x00031, 0x00030, 0x06708, 0x00031, 0x00031,
+  0x06708, 0x00031, 0x00032, 0x06708, 0x00048, 0x00067, 0x00065, 0x00072, 0x00067, 0x00065,
+  0x00056, 0x0004c, 0x00054, 0x00044, 0x030a2, 0x030a4, 0x030a6, 0x030a8, 0x030aa, 0x030ab,
+  0x030ad, 0x030af, 0x030b1, 0x030b3, 0x030b5, 0x030b7, 0x030b9, 0x030bb, 0x030bd, 0x030bf,
+  0x030c1, 0x030c4, 0x030c6, 0x030c8, 0x030ca, 0x030cb, 0x030cc, 0x030cd, 0x030ce, 0x030cf,
+  0x030d2, 0x030d5, 0x030d8, 0x030db, 0x030de, 0x030df, 0x030e0, 0x030e1, 0x030e2, 0x030e4,
+  0x030e6, 0x030e8, 0x030e9, 0x030ea, 0x030eb, 0x030ec, 0x030ed, 0x030ef, 0x030f0, 0x030f1,
+  0x030f2, 0x04ee4, 0x0548c, 0x030a2, 0x030cf, 0x0309a, 0x030fc, 0x030c8, 0x030a2, 0x030eb,
+  0x030d5, 0x030a1, 0x030a2, 0x030f3, 0x030d8, 0x0309a, 0x030a2, 0x030a2, 0x030fc, 0x030eb,
+  0x030a4, 0x030cb, 0x030f3, 0x030af, 0x03099, 0x030a4, 0x030f3, 0x030c1, 0x030a6, 0x030a9,
+  0x030f3, 0x030a8, 0x030b9, 0x030af, 0x030fc, 0x030c8, 0x03099, 0x030a8, 0x030fc, 0x030ab,
+  0x030fc, 0x030aa, 0x030f3, 0x030b9, 0x030aa, 0x030fc, 0x030e0, 0x030ab, 0x030a4, 0x030ea,
+  0x030ab, 0x030e9, 0x030c3, 0x030c8, 0x030ab, 0x030ed, 0x030ea, 0x030fc, 0x030ab, 0x03099,
+  0x030ed, 0x030f3, 0x030ab, 0x03099, 0x030f3, 0x030de, 0x030ad, 0x03099, 0x030ab, 0x03099,
+  0x030ad, 0x03099, 0x030cb, 0x030fc, 0x030ad, 0x030e5, 0x030ea, 0x030fc, 0x030ad, 0x03099,
+  0x030eb, 0x030bf, 0x03099, 0x030fc, 0x030ad, 0x030ed, 0x030ad, 0x030ed, 0x030af, 0x03099,
+  0x030e9, 0x030e0, 0x030ad, 0x030ed, 0x030e1, 0x030fc, 0x030c8, 0x030eb, 0x030ad, 0x030ed,
+  0x030ef, 0x030c3, 0x030c8, 0x030af, 0x03099, 0x030e9, 0x030e0, 0x030af, 0x03099, 0x030e9,
+  0x030e0, 0x030c8, 0x030f3, 0x030af, 0x030eb, 0x030bb, 0x03099, 0x030a4, 0x030ed, 0x030af,
+  0x030ed, 0x030fc, 0x030cd, 0x030b1, 0x030fc, 0x030b9, 0x030b3, 0x030eb, 0x030ca, 0x030b3,
+  0x030fc, 0x030db, 0x0309a, 0x030b5, 0x030a4, 0x030af, 0x030eb, 0x030b5, 0x030f3, 0x030c1,
+  0x030fc, 0x030e0, 0x030b7, 0x030ea, 0x030f3, 0x030af, 0x03099, 0x030bb, 0x030f3, 0x030c1,
+  0x030bb, 0x030f3, 0x030c8, 0x030bf, 0x03099, 0x030fc, 0x030b9, 0x030c6, 0x03099, 0x030b7,
+  0x030c8, 0x03099, 0x030eb, 0x030c8, 0x030f3, 0x030ca, 0x030ce, 0x030ce, 0x030c3, 0x030c8,
+  0x030cf, 0x030a4, 0x030c4, 0x030cf, 0x0309a, 0x030fc, 0x030bb, 0x030f3, 0x030c8, 0x030cf,
+  0x0309a, 0x030fc, 0x030c4, 0x030cf, 0x03099, 0x030fc, 0x030ec, 0x030eb, 0x030d2, 0x0309a,
+  0x030a2, 0x030b9, 0x030c8, 0x030eb, 0x030d2, 0x0309a, 0x030af, 0x030eb, 0x030d2, 0x0309a,
+  0x030b3, 0x030d2, 0x03099, 0x030eb, 0x030d5, 0x030a1, 0x030e9, 0x030c3, 0x030c8, 0x03099,
+  0x030d5, 0x030a3, 0x030fc, 0x030c8, 0x030d5, 0x03099, 0x030c3, 0x030b7, 0x030a7, 0x030eb,
+  0x030d5, 0x030e9, 0x030f3, 0x030d8, 0x030af, 0x030bf, 0x030fc, 0x030eb, 0x030d8, 0x0309a,
+  0x030bd, 0x030d8, 0x0309a, 0x030cb, 0x030d2, 0x030d8, 0x030eb, 0x030c4, 0x030d8, 0x0309a,
+  0x030f3, 0x030b9, 0x030d8, 0x0309a, 0x030fc, 0x030b7, 0x03099, 0x030d8, 0x03099, 0x030fc,
+  0x030bf, 0x030db, 0x0309a, 0x030a4, 0x030f3, 0x030c8, 0x030db, 0x03099, 0x030eb, 0x030c8,
+  0x030db, 0x030f3, 0x030db, 0x0309a, 0x030f3, 0x030c8, 0x03099, 0x030db, 0x030fc, 0x030eb,
+  0x030db, 0x030fc, 0x030f3, 0x030de, 0x030a4, 0x030af, 0x030ed, 0x030de, 0x030a4, 0x030eb,
+  0x030de, 0x030c3, 0x030cf, 0x030de, 0x030eb, 0x030af, 0x030de, 0x030f3, 0x030b7, 0x030e7,
+  0x030f3, 0x030df, 0x030af, 0x030ed, 0x030f3, 0x030df, 0x030ea, 0x030df, 0x030ea, 0x030cf,
+  0x03099, 0x030fc, 0x030eb, 0x030e1, 0x030ab, 0x03099, 0x030e1, 0x030ab, 0x03099, 0x030c8,
+  0x030f3, 0x030e1, 0x030fc, 0x030c8, 0x030eb, 0x030e4, 0x030fc, 0x030c8, 0x03099, 0x030e4,
+  0x030fc, 0x030eb, 0x030e6, 0x030a2, 0x030f3, 0x030ea, 0x030c3, 0x030c8, 0x030eb, 0x030ea,
+  0x030e9, 0x030eb, 0x030d2, 0x0309a, 0x030fc, 0x030eb, 0x030fc, 0x030d5, 0x03099, 0x030eb,
+  0x030ec, 0x030e0, 0x030ec, 0x030f3, 0x030c8, 0x030b1, 0x03099, 0x030f3, 0x030ef, 0x030c3,
+  0x030c8, 0x00030, 0x070b9, 0x00031, 0x070b9, 0x00032, 0x070b9, 0x00033, 0x070b9, 0x00034,
+  0x070b9, 0x00035, 0x070b9, 0x00036, 0x070b9, 0x00037, 0x070b9, 0x00038, 0x070b9, 0x00039,
+  0x070b9, 0x00031, 0x00030, 0x070b9, 0x00031, 0x00031, 0x070b9, 0x00031, 0x00032, 0x070b9,
+  0x00031, 0x00033, 0x070b9, 0x00031, 0x00034, 0x070b9, 0x00031, 0x00035, 0x070b9, 0x00031,
+  0x00036, 0x070b9, 0x00031, 0x00037, 0x070b9, 0x00031, 0x00038, 0x070b9, 0x00031, 0x00039,
+  0x070b9, 0x00032, 0x00030, 0x070b9, 0x00032, 0x00031, 0x070b9, 0x00032, 0x00032, 0x070b9,
+  0x00032, 0x00033, 0x070b9, 0x00032, 0x00034, 0x070b9, 0x00068, 0x00050, 0x00061, 0x00064,
+  0x00061, 0x00041, 0x00055, 0x00062, 0x00061, 0x00072, 0x0006f, 0x00056, 0x00070, 0x00063,
+  0x00064, 0x0006d, 0x00064, 0x0006d, 0x00032, 0x00064, 0x0006d, 0x00033, 0x00049, 0x00055,
+  0x05e73, 0x06210, 0x0662d, 0x0548c, 0x05927, 0x06b63, 0x0660e, 0x06cbb, 0x0682a, 0x05f0f,
+  0x04f1a, 0x0793e, 0x00070, 0x00041, 0x0006e, 0x00041, 0x003bc, 0x00041, 0x0006d, 0x00041,
+  0x0006b, 0x00041, 0x0004b, 0x00042, 0x0004d, 0x00042, 0x00047, 0x00042, 0x00063, 0x00061,
+  0x0006c, 0x0006b, 0x00063, 0x00061, 0x0006c, 0x00070, 0x00046, 0x0006e, 0x00046, 0x003bc,
+  0x00046, 0x003bc, 0x00067, 0x0006d, 0x00067, 0x0006b, 0x00067, 0x00048, 0x0007a, 0x0006b,
+  0x00048, 0x0007a, 0x0004d, 0x00048, 0x0007a, 0x00047, 0x00048, 0x0007a, 0x00054, 0x00048,
+  0x0007a, 0x003bc, 0x0006c, 0x0006d, 0x0006c, 0x00064, 0x0006c, 0x0006b, 0x0006c, 0x00066,
+  0x0006d, 0x0006e, 0x0006d, 0x003bc, 0x0006d, 0x0006d, 0x0006d, 0x00063, 0x0006d, 0x0006b,
+  0x0006d, 0x0006d, 0x0006d, 0x00032, 0x00063, 0x0006d, 0x00032, 0x0006d, 0x00032, 0x0006b,
+  0x0006d, 0x00032, 0x0006d, 0x0006d, 0x00033, 0x00063, 0x0006d, 0x00033, 0x0006d, 0x00033,
+  0x0006b, 0x0006d, 0x00033, 0x0006d, 0x02215, 0x00073, 0x0006d, 0x02215, 0x00073, 0x00032,
+  0x00050, 0x00061, 0x0006b, 0x00050, 0x00061, 0x0004d, 0x00050, 0x00061, 0x00047, 0x00050,
+  0x00061, 0x00072, 0x00061, 0x00064, 0x00072, 0x00061, 0x00064, 0x02215, 0x00073, 0x00072,
+  0x00061, 0x00064, 0x02215, 0x00073, 0x00032, 0x00070, 0x00073, 0x0006e, 0x00073, 0x003bc,
+  0x00073, 0x0006d, 0x00073, 0x00070, 0x00056, 0x0006e, 0x00056, 0x003bc, 0x00056, 0x0006d,
+  0x00056, 0x0006b, 0x00056, 0x0004d, 0x00056, 0x00070, 0x00057, 0x0006e, 0x00057, 0x003bc,
+  0x00057, 0x0006d, 0x00057, 0x0006b, 0x00057, 0x0004d, 0x00057, 0x0006b, 0x003a9, 0x0004d,
+  0x003a9, 0x00061, 0x0002e, 0x0006d, 0x0002e, 0x00042, 0x00071, 0x00063, 0x00063, 0x00063,
+  0x00064, 0x00043, 0x02215, 0x0006b, 0x00067, 0x00043, 0x0006f, 0x0002e, 0x00064, 0x00042,
+  0x00047, 0x00079, 0x00068, 0x00061, 0x00048, 0x00050, 0x00069, 0x0006e, 0x0004b, 0x0004b,
+  0x0004b, 0x0004d, 0x0006b, 0x00074, 0x0006c, 0x0006d, 0x0006c, 0x0006e, 0x0006c, 0x0006f,
+  0x00067, 0x0006c, 0x00078, 0x0006d, 0x00062, 0x0006d, 0x00069, 0x0006c, 0x0006d, 0x0006f,
+  0x0006c, 0x00050, 0x00048, 0x00070, 0x0002e, 0x0006d, 0x0002e, 0x00050, 0x00050, 0x0004d,
+  0x00050, 0x00052, 0x00073, 0x00072, 0x00053, 0x00076, 0x00057, 0x00062, 0x00056, 0x02215,
+  0x0006d, 0x00041, 0x02215, 0x0006d, 0x00031, 0x065e5, 0x00032, 0x065e5, 0x00033, 0x065e5,
+  0x00034, 0x065e5, 0x00035, 0x065e5, 0x00036, 0x065e5, 0x00037, 0x065e5, 0x00038, 0x065e5,
+  0x00039, 0x065e5, 0x00031, 0x00030, 0x065e5, 0x00031, 0x00031, 0x065e5, 0x00031, 0x00032,
+  0x065e5, 0x00031, 0x00033, 0x065e5, 0x00031, 0x00034, 0x065e5, 0x00031, 0x00035, 0x065e5,
+  0x00031, 0x00036, 0x065e5, 0x00031, 0x00037, 0x065e5, 0x00031, 0x00038, 0x065e5, 0x00031,
+  0x00039, 0x065e5, 0x00032, 0x00030, 0x065e5, 0x00032, 0x00031, 0x065e5, 0x00032, 0x00032,
+  0x065e5, 0x00032, 0x00033, 0x065e5, 0x00032, 0x00034, 0x065e5, 0x00032, 0x00035, 0x065e5,
+  0x00032, 0x00036, 0x065e5, 0x00032, 0x00037, 0x065e5, 0x00032, 0x00038, 0x065e5, 0x00032,
+  0x00039, 0x065e5, 0x00033, 0x00030, 0x065e5, 0x00033, 0x00031, 0x065e5, 0x00067, 0x00061,
+  0x0006c, 0x0044a, 0x0044c, 0x0a76f, 0x00043, 0x00046, 0x00051, 0x00126, 0x00153, 0x0a727,
+  0x0ab37, 0x0026b, 0x0ab52, 0x0028d, 0x08c48, 0x066f4, 0x08eca, 0x08cc8, 0x06ed1, 0x04e32,
+  0x053e5, 0x09f9c, 0x09f9c, 0x05951, 0x091d1, 0x05587, 0x05948, 0x061f6, 0x07669, 0x07f85,
+  0x0863f, 0x087ba, 0x088f8, 0x0908f, 0x06a02, 0x06d1b, 0x070d9, 0x073de, 0x0843d, 0x0916a,
+  0x099f1, 0x04e82, 0x05375, 0x06b04, 0x0721b, 0x0862d, 0x09e1e, 0x05d50, 0x06feb, 0x085cd,
+  0x08964, 0x062c9, 0x081d8, 0x0881f, 0x05eca, 0x06717, 0x06d6a, 0x072fc, 0x090ce, 0x04f86,
+  0x051b7, 0x052de, 0x064c4, 0x06ad3, 0x07210, 0x076e7, 0x08001, 0x08606, 0x0865c, 0x08def,
+  0x09732, 0x09b6f, 0x09dfa, 0x0788c, 0x0797f, 0x07da0, 0x083c9, 0x09304, 0x09e7f, 0x08ad6,
+  0x058df, 0x05f04, 0x07c60, 0x0807e, 0x07262, 0x078ca, 0x08cc2, 0x096f7, 0x058d8, 0x05c62,
+  0x06a13, 0x06dda, 0x06f0f, 0x07d2f, 0x07e37, 0x0964b, 0x052d2, 0x0808b, 0x051dc, 0x051cc,
+  0x07a1c, 0x07dbe, 0x083f1, 0x09675, 0x08b80, 0x062cf, 0x06a02, 0x08afe, 0x04e39, 0x05be7,
+  0x06012, 0x07387, 0x07570, 0x05317, 0x078fb, 0x04fbf, 0x05fa9, 0x04e0d, 0x06ccc, 0x06578,
+  0x07d22, 0x053c3, 0x0585e, 0x07701, 0x08449, 0x08aaa, 0x06bba, 0x08fb0, 0x06c88, 0x062fe,
+  0x082e5, 0x063a0, 0x07565, 0x04eae, 0x05169, 0x051c9, 0x06881, 0x07ce7, 0x0826f, 0x08ad2,
+  0x091cf, 0x052f5, 0x05442, 0x05973, 0x05eec, 0x065c5, 0x06ffe, 0x0792a, 0x095ad, 0x09a6a,
+  0x09e97, 0x09ece, 0x0529b, 0x066c6, 0x06b77, 0x08f62, 0x05e74, 0x06190, 0x06200, 0x0649a,
+  0x06f23, 0x07149, 0x07489, 0x079ca, 0x07df4, 0x0806f, 0x08f26, 0x084ee, 0x09023, 0x0934a,
+  0x05217, 0x052a3, 0x054bd, 0x070c8, 0x088c2, 0x08aaa, 0x05ec9, 0x05ff5, 0x0637b, 0x06bae,
+  0x07c3e, 0x07375, 0x04ee4, 0x056f9, 0x05be7, 0x05dba, 0x0601c, 0x073b2, 0x07469, 0x07f9a,
+  0x08046, 0x09234, 0x096f6, 0x09748, 0x09818, 0x04f8b, 0x079ae, 0x091b4, 0x096b8, 0x060e1,
+  0x04e86, 0x050da, 0x05bee, 0x05c3f, 0x06599, 0x06a02, 0x071ce, 0x07642, 0x084fc, 0x0907c,
+  0x09f8d, 0x06688, 0x0962e, 0x05289, 0x0677b, 0x067f3, 0x06d41, 0x06e9c, 0x07409, 0x07559,
+  0x0786b, 0x07d10, 0x0985e, 0x0516d, 0x0622e, 0x09678, 0x0502b, 0x05d19, 0x06dea, 0x08f2a,
+  0x05f8b, 0x06144, 0x06817, 0x07387, 0x09686, 0x05229, 0x0540f, 0x05c65, 0x06613, 0x0674e,
+  0x068a8, 0x06ce5, 0x07406, 0x075e2, 0x07f79, 0x088cf, 0x088e1, 0x091cc, 0x096e2, 0x0533f,
+  0x06eba, 0x0541d, 0x071d0, 0x07498, 0x085fa, 0x096a3, 0x09c57, 0x09e9f, 0x06797, 0x06dcb,
+  0x081e8, 0x07acb, 0x07b20, 0x07c92, 0x072c0, 0x07099, 0x08b58, 0x04ec0, 0x08336, 0x0523a,
+  0x05207, 0x05ea6, 0x062d3, 0x07cd6, 0x05b85, 0x06d1e, 0x066b4, 0x08f3b, 0x0884c, 0x0964d,
+  0x0898b, 0x05ed3, 0x05140, 0x055c0, 0x0585a, 0x06674, 0x051de, 0x0732a, 0x076ca, 0x0793c,
+  0x0795e, 0x07965, 0x0798f, 0x09756, 0x07cbe, 0x07fbd, 0x08612, 0x08af8, 0x09038, 0x090fd,
+  0x098ef, 0x098fc, 0x09928, 0x09db4, 0x090de, 0x096b7, 0x04fae, 0x050e7, 0x0514d, 0x052c9,
+  0x052e4, 0x05351, 0x0559d, 0x05606, 0x05668, 0x05840, 0x058a8, 0x05c64, 0x05c6e, 0x06094,
+  0x06168, 0x0618e, 0x061f2, 0x0654f, 0x065e2, 0x06691, 0x06885, 0x06d77, 0x06e1a, 0x06f22,
+  0x0716e, 0x0722b, 0x07422, 0x07891, 0x0793e, 0x07949, 0x07948, 0x07950, 0x07956, 0x0795d,
+  0x0798d, 0x0798e, 0x07a40, 0x07a81, 0x07bc0, 0x07df4, 0x07e09, 0x07e41, 0x07f72, 0x08005,
+  0x081ed, 0x08279, 0x08279, 0x08457, 0x08910, 0x08996, 0x08b01, 0x08b39, 0x08cd3, 0x08d08,
+  0x08fb6, 0x09038, 0x096e3, 0x097ff, 0x0983b, 0x06075, 0x242ee, 0x08218, 0x04e26, 0x051b5,
+  0x05168, 0x04f80, 0x05145, 0x05180, 0x052c7, 0x052fa, 0x0559d, 0x05555, 0x05599, 0x055e2,
+  0x0585a, 0x058b3, 0x05944, 0x05954, 0x05a62, 0x05b28, 0x05ed2, 0x05ed9, 0x05f69, 0x05fad,
+  0x060d8, 0x0614e, 0x06108, 0x0618e, 0x06160, 0x061f2, 0x06234, 0x063c4, 0x0641c, 0x06452,
+  0x06556, 0x06674, 0x06717, 0x0671b, 0x06756, 0x06b79, 0x06bba, 0x06d41, 0x06edb, 0x06ecb,
+  0x06f22, 0x0701e, 0x0716e, 0x077a7, 0x07235, 0x072af, 0x0732a, 0x07471, 0x07506, 0x0753b,
+  0x0761d, 0x0761f, 0x076ca, 0x076db, 0x076f4, 0x0774a, 0x07740, 0x078cc, 0x07ab1, 0x07bc0,
+  0x07c7b, 0x07d5b, 0x07df4, 0x07f3e, 0x08005, 0x08352, 0x083ef, 0x08779, 0x08941, 0x08986,
+  0x08996, 0x08abf, 0x08af8, 0x08acb, 0x08b01, 0x08afe, 0x08aed, 0x08b39, 0x08b8a, 0x08d08,
+  0x08f38, 0x09072, 0x09199, 0x09276, 0x0967c, 0x096e3, 0x09756, 0x097db, 0x097ff, 0x0980b,
+  0x0983b, 0x09b12, 0x09f9c, 0x2284a, 0x22844, 0x233d5, 0x03b9d, 0x04018, 0x04039, 0x25249,
+  0x25cd0, 0x27ed3, 0x09f43, 0x09f8e, 0x00066, 0x00066, 0x00066, 0x00069, 0x00066, 0x0006c,
+  0x00066, 0x00066, 0x00069, 0x00066, 0x00066, 0x0006c, 0x00073, 0x00074, 0x00073, 0x00074,
+  0x00574, 0x00576, 0x00574, 0x00565, 0x00574, 0x0056b, 0x0057e, 0x00576, 0x00574, 0x0056d,
+  0x005d9, 0x005b4, 0x005f2, 0x005b7, 0x005e2, 0x005d0, 0x005d3, 0x005d4, 0x005db, 0x005dc,
+  0x005dd, 0x005e8, 0x005ea, 0x0002b, 0x005e9, 0x005c1, 0x005e9, 0x005c2, 0x005e9, 0x005bc,
+  0x005c1, 0x005e9, 0x005bc, 0x005c2, 0x005d0, 0x005b7, 0x005d0, 0x005b8, 0x005d0, 0x005bc,
+  0x005d1, 0x005bc, 0x005d2, 0x005bc, 0x005d3, 0x005bc, 0x005d4, 0x005bc, 0x005d5, 0x005bc,
+  0x005d6, 0x005bc, 0x005d8, 0x005bc, 0x005d9, 0x005bc, 0x005da, 0x005bc, 0x005db, 0x005bc,
+  0x005dc, 0x005bc, 0x005de, 0x005bc, 0x005e0, 0x005bc, 0x005e1, 0x005bc, 0x005e3, 0x005bc,
+  0x005e4, 0x005bc, 0x005e6, 0x005bc, 0x005e7, 0x005bc, 0x005e8, 0x005bc, 0x005e9, 0x005bc,
+  0x005ea, 0x005bc, 0x005d5, 0x005b9, 0x005d1, 0x005bf, 0x005db, 0x005bf, 0x005e4, 0x005bf,
+  0x005d0, 0x005dc, 0x00671, 0x00671, 0x0067b, 0x0067b, 0x0067b, 0x0067b, 0x0067e, 0x0067e,
+  0x0067e, 0x0067e, 0x00680, 0x00680, 0x00680, 0x00680, 0x0067a, 0x0067a, 0x0067a, 0x0067a,
+  0x0067f, 0x0067f, 0x0067f, 0x0067f, 0x00679, 0x00679, 0x00679, 0x00679, 0x006a4, 0x006a4,
+  0x006a4, 0x006a4, 0x006a6, 0x006a6, 0x006a6, 0x006a6, 0x00684, 0x00684, 0x00684, 0x00684,
+  0x00683, 0x00683, 0x00683, 0x00683, 0x00686, 0x00686, 0x00686, 0x00686, 0x00687, 0x00687,
+  0x00687, 0x00687, 0x0068d, 0x0068d, 0x0068c, 0x0068c, 0x0068e, 0x0068e, 0x00688, 0x00688,
+  0x00698, 0x00698, 0x00691, 0x00691, 0x006a9, 0x006a9, 0x006a9, 0x006a9, 0x006af, 0x006af,
+  0x006af, 0x006af, 0x006b3, 0x006b3, 0x006b3, 0x006b3, 0x006b1, 0x006b1, 0x006b1, 0x006b1,
+  0x006ba, 0x006ba, 0x006bb, 0x006bb, 0x006bb, 0x006bb, 0x006d5, 0x00654, 0x006d5, 0x00654,
+  0x006c1, 0x006c1, 0x006c1, 0x006c1, 0x006be, 0x006be, 0x006be, 0x006be, 0x006d2, 0x006d2,
+  0x006d2, 0x00654, 0x006d2, 0x00654, 0x006ad, 0x006ad, 0x006ad, 0x006ad, 0x006c7, 0x006c7,
+  0x006c6, 0x006c6, 0x006c8, 0x006c8, 0x006c7, 0x00674, 0x006cb, 0x006cb, 0x006c5, 0x006c5,
+  0x006c9, 0x006c9, 0x006d0, 0x006d0, 0x006d0, 0x006d0, 0x00649, 0x00649, 0x0064a, 0x00654,
+  0x00627, 0x0064a, 0x00654, 0x00627, 0x0064a, 0x00654, 0x006d5, 0x0064a, 0x00654, 0x006d5,
+  0x0064a, 0x00654, 0x00648, 0x0064a, 0x00654, 0x00648, 0x0064a, 0x00654, 0x006c7, 0x0064a,
+  0x00654, 0x006c7, 0x0064a, 0x00654, 0x006c6, 0x0064a, 0x00654, 0x006c6, 0x0064a, 0x00654,
+  0x006c8, 0x0064a, 0x00654, 0x006c8, 0x0064a, 0x00654, 0x006d0, 0x0064a, 0x00654, 0x006d0,
+  0x0064a, 0x00654, 0x006d0, 0x0064a, 0x00654, 0x00649, 0x0064a, 0x00654, 0x00649, 0x0064a,
+  0x00654, 0x00649, 0x006cc, 0x006cc, 0x006cc, 0x006cc, 0x0064a, 0x00654, 0x0062c, 0x0064a,
+  0x00654, 0x0062d, 0x0064a, 0x00654, 0x00645, 0x0064a, 0x00654, 0x00649, 0x0064a, 0x00654,
+  0x0064a, 0x00628, 0x0062c, 0x00628, 0x0062d, 0x00628, 0x0062e, 0x00628, 0x00645, 0x00628,
+  0x00649, 0x00628, 0x0064a, 0x0062a, 0x0062c, 0x0062a, 0x0062d, 0x0062a, 0x0062e, 0x0062a,
+  0x00645, 0x0062a, 0x00649, 0x0062a, 0x0064a, 0x0062b, 0x0062c, 0x0062b, 0x00645, 0x0062b,
+  0x00649, 0x0062b, 0x0064a, 0x0062c, 0x0062d, 0x0062c, 0x00645, 0x0062d, 0x0062c, 0x0062d,
+  0x00645, 0x0062e, 0x0062c, 0x0062e, 0x0062d, 0x0062e, 0x00645, 0x00633, 0x0062c, 0x00633,
+  0x0062d, 0x00633, 0x0062e, 0x00633, 0x00645, 0x00635, 0x0062d, 0x00635, 0x00645, 0x00636,
+  0x0062c, 0x00636, 0x0062d, 0x00636, 0x0062e, 0x00636, 0x00645, 0x00637, 0x0062d, 0x00637,
+  0x00645, 0x00638, 0x00645, 0x00639, 0x0062c, 0x00639, 0x00645, 0x0063a, 0x0062c, 0x0063a,
+  0x00645, 0x00641, 0x0062c, 0x00641, 0x0062d, 0x00641, 0x0062e, 0x00641, 0x00645, 0x00641,
+  0x00649, 0x00641, 0x0064a, 0x00642, 0x0062d, 0x00642, 0x00645, 0x00642, 0x00649, 0x00642,
+  0x0064a, 0x00643, 0x00627, 0x00643, 0x0062c, 0x00643, 0x0062d, 0x00643, 0x0062e, 0x00643,
+  0x00644, 0x00643, 0x00645, 0x00643, 0x00649, 0x00643, 0x0064a, 0x00644, 0x0062c, 0x00644,
+  0x0062d, 0x00644, 0x0062e, 0x00644, 0x00645, 0x00644, 0x00649, 0x00644, 0x0064a, 0x00645,
+  0x0062c, 0x00645, 0x0062d, 0x00645, 0x0062e, 0x00645, 0x00645, 0x00645, 0x00649, 0x00645,
+  0x0064a, 0x00646, 0x0062c, 0x00646, 0x0062d, 0x00646, 0x0062e, 0x00646, 0x00645, 0x00646,
+  0x00649, 0x00646, 0x0064a, 0x00647, 0x0062c, 0x00647, 0x00645, 0x00647, 0x00649, 0x00647,
+  0x0064a, 0x0064a, 0x0062c, 0x0064a, 0x0062d, 0x0064a, 0x0062e, 0x0064a, 0x00645, 0x0064a,
+  0x00649, 0x0064a, 0x0064a, 0x00630, 0x00670, 0x00631, 0x00670, 0x00649, 0x00670, 0x00020,
+  0x0064c, 0x00651, 0x00020, 0x0064d, 0x00651, 0x00020, 0x0064e, 0x00651, 0x00020, 0x0064f,
+  0x00651, 0x00020, 0x00650, 0x00651, 0x00020, 0x00651, 0x00670, 0x0064a, 0x00654, 0x00631,
+  0x0064a, 0x00654, 0x00632, 0x0064a, 0x00654, 0x00645, 0x0064a, 0x00654, 0x00646, 0x0064a,
+  0x00654, 0x00649, 0x0064a, 0x00654, 0x0064a, 0x00628, 0x00631, 0x00628, 0x00632, 0x00628,
+  0x00645, 0x00628, 0x00646, 0x00628, 0x00649, 0x00628, 0x0064a, 0x0062a, 0x00631, 0x0062a,
+  0x00632, 0x0062a, 0x00645, 0x0062a, 0x00646, 0x0062a, 0x00649, 0x0062a, 0x0064a, 0x0062b,
+  0x00631, 0x0062b, 0x00632, 0x0062b, 0x00645, 0x0062b, 0x00646, 0x0062b, 0x00649, 0x0062b,
+  0x0064a, 0x00641, 0x00649, 0x00641, 0x0064a, 0x00642, 0x00649, 0x00642, 0x0064a, 0x00643,
+  0x00627, 0x00643, 0x00644, 0x00643, 0x00645, 0x00643, 0x00649, 0x00643, 0x0064a, 0x00644,
+  0x00645, 0x00644, 0x00649, 0x00644, 0x0064a, 0x00645, 0x00627, 0x00645, 0x00645, 0x00646,
+  0x00631, 0x00646, 0x00632, 0x00646, 0x00645, 0x00646, 0x00646, 0x00646, 0x00649, 0x00646,
+  0x0064a, 0x00649, 0x00670, 0x0064a, 0x00631, 0x0064a, 0x00632, 0x0064a, 0x00645, 0x0064a,
+  0x00646, 0x0064a, 0x00649, 0x0064a, 0x0064a, 0x0064a, 0x00654, 0x0062c, 0x0064a, 0x00654,
+  0x0062d, 0x0064a, 0x00654, 0x0062e, 0x0064a, 0x00654, 0x00645, 0x0064a, 0x00654, 0x00647,
+  0x00628, 0x0062c, 0x00628, 0x0062d, 0x00628, 0x0062e, 0x00628, 0x00645, 0x00628, 0x00647,
+  0x0062a, 0x0062c, 0x0062a, 0x0062d, 0x0062a, 0x0062e, 0x0062a, 0x00645, 0x0062a, 0x00647,
+  0x0062b, 0x00645, 0x0062c, 0x0062d, 0x0062c, 0x00645, 0x0062d, 0x0062c, 0x0062d, 0x00645,
+  0x0062e, 0x0062c, 0x0062e, 0x00645, 0x00633, 0x0062c, 0x00633, 0x0062d, 0x00633, 0x0062e,
+  0x00633, 0x00645, 0x00635, 0x0062d, 0x00635, 0x0062e, 0x00635, 0x00645, 0x00636, 0x0062c,
+  0x00636, 0x0062d, 0x00636, 0x0062e, 0x00636, 0x00645, 0x00637, 0x0062d, 0x00638, 0x00645,
+  0x00639, 0x0062c, 0x00639, 0x00645, 0x0063a, 0x0062c, 0x0063a, 0x00645, 0x00641, 0x0062c,
+  0x00641, 0x0062d, 0x00641, 0x0062e, 0x00641, 0x00645, 0x00642, 0x0062d, 0x00642, 0x00645,
+  0x00643, 0x0062c, 0x00643, 0x0062d, 0x00643, 0x0062e, 0x00643, 0x00644, 0x00643, 0x00645,
+  0x00644, 0x0062c, 0x00644, 0x0062d, 0x00644, 0x0062e, 0x00644, 0x00645, 0x00644, 0x00647,
+  0x00645, 0x0062c, 0x00645, 0x0062d, 0x00645, 0x0062e, 0x00645, 0x00645, 0x00646, 0x0062c,
+  0x00646, 0x0062d, 0x00646, 0x0062e, 0x00646, 0x00645, 0x00646, 0x00647, 0x00647, 0x0062c,
+  0x00647, 0x00645, 0x00647, 0x00670, 0x0064a, 0x0062c, 0x0064a, 0x0062d, 0x0064a, 0x0062e,
+  0x0064a, 0x00645, 0x0064a, 0x00647, 0x0064a, 0x00654, 0x00645, 0x0064a, 0x00654, 0x00647,
+  0x00628, 0x00645, 0x00628, 0x00647, 0x0062a, 0x00645, 0x0062a, 0x00647, 0x0062b, 0x00645,
+  0x0062b, 0x00647, 0x00633, 0x00645, 0x00633, 0x00647, 0x00634, 0x00645, 0x00634, 0x00647,
+  0x00643, 0x00644, 0x00643, 0x00645, 0x00644, 0x00645, 0x00646, 0x00645, 0x00646, 0x00647,
+  0x0064a, 0x00645, 0x0064a, 0x00647, 0x00640, 0x0064e, 0x00651, 0x00640, 0x0064f, 0x00651,
+  0x00640, 0x00650, 0x00651, 0x00637, 0x00649, 0x00637, 0x0064a, 0x00639, 0x00649, 0x00639,
+  0x0064a, 0x0063a, 0x00649, 0x0063a, 0x0064a, 0x00633, 0x00649, 0x00633, 0x0064a, 0x00634,
+  0x00649, 0x00634, 0x0064a, 0x0062d, 0x00649, 0x0062d, 0x0064a, 0x0062c, 0x00649, 0x0062c,
+  0x0064a, 0x0062e, 0x00649, 0x0062e, 0x0064a, 0x00635, 0x00649, 0x00635, 0x0064a, 0x00636,
+  0x00649, 0x00636, 0x0064a, 0x00634, 0x0062c, 0x00634, 0x0062d, 0x00634, 0x0062e, 0x00634,
+  0x00645, 0x00634, 0x00631, 0x00633, 0x00631, 0x00635, 0x00631, 0x00636, 0x00631, 0x00637,
+  0x00649, 0x00637, 0x0064a, 0x00639, 0x00649, 0x00639, 0x0064a, 0x0063a, 0x00649, 0x0063a,
+  0x0064a, 0x00633, 0x00649, 0x00633, 0x0064a, 0x00634, 0x00649, 0x00634, 0x0064a, 0x0062d,
+  0x00649, 0x0062d, 0x0064a, 0x0062c, 0x00649, 0x0062c, 0x0064a, 0x0062e, 0x00649, 0x0062e,
+  0x0064a, 0x00635, 0x00649, 0x00635, 0x0064a, 0x00636, 0x00649, 0x00636, 0x0064a, 0x00634,
+  0x0062c, 0x00634, 0x0062d, 0x00634, 0x0062e, 0x00634, 0x00645, 0x00634, 0x00631, 0x00633,
+  0x00631, 0x00635, 0x00631, 0x00636, 0x00631, 0x00634, 0x0062c, 0x00634, 0x0062d, 0x00634,
+  0x0062e, 0x00634, 0x00645, 0x00633, 0x00647, 0x00634, 0x00647, 0x00637, 0x00645, 0x00633,
+  0x0062c, 0x00633, 0x0062d, 0x00633, 0x0062e, 0x00634, 0x0062c, 0x00634, 0x0062d, 0x00634,
+  0x0062e, 0x00637, 0x00645, 0x00638, 0x00645, 0x00627, 0x0064b, 0x00627, 0x0064b, 0x0062a,
+  0x0062c, 0x00645, 0x0062a, 0x0062d, 0x0062c, 0x0062a, 0x0062d, 0x0062c, 0x0062a, 0x0062d,
+  0x00645, 0x0062a, 0x0062e, 0x00645, 0x0062a, 0x00645, 0x0062c, 0x0062a, 0x00645, 0x0062d,
+  0x0062a, 0x00645, 0x0062e, 0x0062c, 0x00645, 0x0062d, 0x0062c, 0x00645, 0x0062d, 0x0062d,
+  0x00645, 0x0064a, 0x0062d, 0x00645, 0x00649, 0x00633, 0x0062d, 0x0062c, 0x00633, 0x0062c,
+  0x0062d, 0x00633, 0x0062c, 0x00649, 0x00633, 0x00645, 0x0062d, 0x00633, 0x00645, 0x0062d,
+  0x00633, 0x00645, 0x0062c, 0x00633, 0x00645, 0x00645, 0x00633, 0x00645, 0x00645, 0x00635,
+  0x0062d, 0x0062d, 0x00635, 0x0062d, 0x0062d, 0x00635, 0x00645, 0x00645, 0x00634, 0x0062d,
+  0x00645, 0x00634, 0x0062d, 0x00645, 0x00634, 0x0062c, 0x0064a, 0x00634, 0x00645, 0x0062e,
+  0x00634, 0x00645, 0x0062e, 0x00634, 0x00645, 0x00645, 0x00634, 0x00645, 0x00645, 0x00636,
+  0x0062d, 0x00649, 0x00636, 0x0062e, 0x00645, 0x00636, 0x0062e, 0x00645, 0x00637, 0x00645,
+  0x0062d, 0x00637, 0x00645, 0x0062d, 0x00637, 0x00645, 0x00645, 0x00637, 0x00645, 0x0064a,
+  0x00639, 0x0062c, 0x00645, 0x00639, 0x00645, 0x00645, 0x00639, 0x00645, 0x00645, 0x00639,
+  0x00645, 0x00649, 0x0063a, 0x00645, 0x00645, 0x0063a, 0x00645, 0x0064a, 0x0063a, 0x00645,
+  0x00649, 0x00641, 0x0062e, 0x00645, 0x00641, 0x0062e, 0x00645, 0x00642, 0x00645, 0x0062d,
+  0x00642, 0x00645, 0x00645, 0x00644, 0x0062d, 0x00645, 0x00644, 0x0062d, 0x0064a, 0x00644,
+  0x0062d, 0x00649, 0x00644, 0x0062c, 0x0062c, 0x00644, 0x0062c, 0x0062c, 0x00644, 0x0062e,
+  0x00645, 0x00644, 0x0062e, 0x00645, 0x00644, 0x00645, 0x0062d, 0x00644, 0x00645, 0x0062d,
+  0x00645, 0x0062d, 0x0062c, 0x00645, 0x0062d, 0x00645, 0x00645, 0x0062d, 0x0064a, 0x00645,
+  0x0062c, 0x0062d, 0x00645, 0x0062c, 0x00645, 0x00645, 0x0062e, 0x0062c, 0x00645, 0x0062e,
+  0x00645, 0x00645, 0x0062c, 0x0062e, 0x00647, 0x00645, 0x0062c, 0x00647, 0x00645, 0x00645,
+  0x00646, 0x0062d, 0x00645, 0x00646, 0x0062d, 0x00649, 0x00646, 0x0062c, 0x00645, 0x00646,
+  0x0062c, 0x00645, 0x00646, 0x0062c, 0x00649, 0x00646, 0x00645, 0x0064a, 0x00646, 0x00645,
+  0x00649, 0x0064a, 0x00645, 0x00645, 0x0064a, 0x00645, 0x00645, 0x00628, 0x0062e, 0x0064a,
+  0x0062a, 0x0062c, 0x0064a, 0x0062a, 0x0062c, 0x00649, 0x0062a, 0x0062e, 0x0064a, 0x0062a,
+  0x0062e, 0x00649, 0x0062a, 0x00645, 0x0064a, 0x0062a, 0x00645, 0x00649, 0x0062c, 0x00645,
+  0x0064a, 0x0062c, 0x0062d, 0x00649, 0x0062c, 0x00645, 0x00649, 0x00633, 0x0062e, 0x00649,
+  0x00635, 0x0062d, 0x0064a, 0x00634, 0x0062d, 0x0064a, 0x00636, 0x0062d, 0x0064a, 0x00644,
+  0x0062c, 0x0064a, 0x00644, 0x00645, 0x0064a, 0x0064a, 0x0062d, 0x0064a, 0x0064a, 0x0062c,
+  0x0064a, 0x0064a, 0x00645, 0x0064a, 0x00645, 0x00645, 0x0064a, 0x00642, 0x00645, 0x0064a,
+  0x00646, 0x0062d, 0x0064a, 0x00642, 0x00645, 0x0062d, 0x00644, 0x0062d, 0x00645, 0x00639,
+  0x00645, 0x0064a, 0x00643, 0x00645, 0x0064a, 0x00646, 0x0062c, 0x0062d, 0x00645, 0x0062e,
+  0x0064a, 0x00644, 0x0062c, 0x00645, 0x00643, 0x00645, 0x00645, 0x00644, 0x0062c, 0x00645,
+  0x00646, 0x0062c, 0x0062d, 0x0062c, 0x0062d, 0x0064a, 0x0062d, 0x0062c, 0x0064a, 0x00645,
+  0x0062c, 0x0064a, 0x00641, 0x00645, 0x0064a, 0x00628, 0x0062d, 0x0064a, 0x00643, 0x00645,
+  0x00645, 0x00639, 0x0062c, 0x00645, 0x00635, 0x00645, 0x00645, 0x00633, 0x0062e, 0x0064a,
+  0x00646, 0x0062c, 0x0064a, 0x00635, 0x00644, 0x006d2, 0x00642, 0x00644, 0x006d2, 0x00627,
+  0x00644, 0x00644, 0x00647, 0x00627, 0x00643, 0x00628, 0x00631, 0x00645, 0x0062d, 0x00645,
+  0x0062f, 0x00635, 0x00644, 0x00639, 0x00645, 0x00631, 0x00633, 0x00648, 0x00644, 0x00639,
+  0x00644, 0x0064a, 0x00647, 0x00648, 0x00633, 0x00644, 0x00645, 0x00635, 0x00644, 0x00649,
+  0x00635, 0x00644, 0x00649, 0x00020, 0x00627, 0x00644, 0x00644, 0x00647, 0x00020, 0x00639,
+  0x00644, 0x0064a, 0x00647, 0x00020, 0x00648, 0x00633, 0x00644, 0x00645, 0x0062c, 0x00644,
+  0x00020, 0x0062c, 0x00644, 0x00627, 0x00644, 0x00647, 0x00631, 0x006cc, 0x00627, 0x00644,
+  0x0002c, 0x03001, 0x03002, 0x0003a, 0x0003b, 0x00021, 0x0003f, 0x03016, 0x03017, 0x0002e,
+  0x0002e, 0x0002e, 0x0002e, 0x0002e, 0x02014, 0x02013, 0x0005f, 0x0005f, 0x00028, 0x00029,
+  0x0007b, 0x0007d, 0x03014, 0x03015, 0x03010, 0x03011, 0x0300a, 0x0300b, 0x03008, 0x03009,
+  0x0300c, 0x0300d, 0x0300e, 0x0300f, 0x0005b, 0x0005d, 0x00020, 0x00305, 0x00020, 0x00305,
+  0x00020, 0x00305, 0x00020, 0x00305, 0x0005f, 0x0005f, 0x0005f, 0x0002c, 0x03001, 0x0002e,
+  0x0003b, 0x0003a, 0x0003f, 0x00021, 0x02014, 0x00028, 0x00029, 0x0007b, 0x0007d, 0x03014,
+  0x03015, 0x00023, 0x00026, 0x0002a, 0x0002b, 0x0002d, 0x0003c, 0x0003e, 0x0003d, 0x0005c,
+  0x00024, 0x00025, 0x00040, 0x00020, 0x0064b, 0x00640, 0x0064b, 0x00020, 0x0064c, 0x00020,
+  0x0064d, 0x00020, 0x0064e, 0x00640, 0x0064e, 0x00020, 0x0064f, 0x00640, 0x0064f, 0x00020,
+  0x00650, 0x00640, 0x00650, 0x00020, 0x00651, 0x00640, 0x00651, 0x00020, 0x00652, 0x00640,
+  0x00652, 0x00621, 0x00627, 0x00653, 0x00627, 0x00653, 0x00627, 0x00654, 0x00627, 0x00654,
+  0x00648, 0x00654, 0x00648, 0x00654, 0x00627, 0x00655, 0x00627, 0x00655, 0x0064a, 0x00654,
+  0x0064a, 0x00654, 0x0064a, 0x00654, 0x0064a, 0x00654, 0x00627, 0x00627, 0x00628, 0x00628,
+  0x00628, 0x00628, 0x00629, 0x00629, 0x0062a, 0x0062a, 0x0062a, 0x0062a, 0x0062b, 0x0062b,
+  0x0062b, 0x0062b, 0x0062c, 0x0062c, 0x0062c, 0x0062c, 0x0062d, 0x0062d, 0x0062d, 0x0062d,
+  0x0062e, 0x0062e, 0x0062e, 0x0062e, 0x0062f, 0x0062f, 0x00630, 0x00630, 0x00631, 0x00631,
+  0x00632, 0x00632, 0x00633, 0x00633, 0x00633, 0x00633, 0x00634, 0x00634, 0x00634, 0x00634,
+  0x00635, 0x00635, 0x00635, 0x00635, 0x00636, 0x00636, 0x00636, 0x00636, 0x00637, 0x00637,
+  0x00637, 0x00637, 0x00638, 0x00638, 0x00638, 0x00638, 0x00639, 0x00639, 0x00639, 0x00639,
+  0x0063a, 0x0063a, 0x0063a, 0x0063a, 0x00641, 0x00641, 0x00641, 0x00641, 0x00642, 0x00642,
+  0x00642, 0x00642, 0x00643, 0x00643, 0x00643, 0x00643, 0x00644, 0x00644, 0x00644, 0x00644,
+  0x00645, 0x00645, 0x00645, 0x00645, 0x00646, 0x00646, 0x00646, 0x00646, 0x00647, 0x00647,
+  0x00647, 0x00647, 0x00648, 0x00648, 0x00649, 0x00649, 0x0064a, 0x0064a, 0x0064a, 0x0064a,
+  0x00644, 0x00627, 0x00653, 0x00644, 0x00627, 0x00653, 0x00644, 0x00627, 0x00654, 0x00644,
+  0x00627, 0x00654, 0x00644, 0x00627, 0x00655, 0x00644, 0x00627, 0x00655, 0x00644, 0x00627,
+  0x00644, 0x00627, 0x00021, 0x00022, 0x00023, 0x00024, 0x00025, 0x00026, 0x00027, 0x00028,
+  0x00029, 0x0002a, 0x0002b, 0x0002c, 0x0002d, 0x0002e, 0x0002f, 0x00030, 0x00031, 0x00032,
+  0x00033, 0x00034, 0x00035, 0x00036, 0x00037, 0x00038, 0x00039, 0x0003a, 0x0003b, 0x0003c,
+  0x0003d, 0x0003e, 0x0003f, 0x00040, 0x00041, 0x00042, 0x00043, 0x00044, 0x00045, 0x00046,
+  0x00047, 0x00048, 0x00049, 0x0004a, 0x0004b, 0x0004c, 0x0004d, 0x0004e, 0x0004f, 0x00050,
+  0x00051, 0x00052, 0x00053, 0x00054, 0x00055, 0x00056, 0x00057, 0x00058, 0x00059, 0x0005a,
+  0x0005b, 0x0005c, 0x0005d, 0x0005e, 0x0005f, 0x00060, 0x00061, 0x00062, 0x00063, 0x00064,
+  0x00065, 0x00066, 0x00067, 0x00068, 0x00069, 0x0006a, 0x0006b, 0x0006c, 0x0006d, 0x0006e,
+  0x0006f, 0x00070, 0x00071, 0x00072, 0x00073, 0x00074, 0x00075, 0x00076, 0x00077, 0x00078,
+  0x00079, 0x0007a, 0x0007b, 0x0007c, 0x0007d, 0x0007e, 0x02985, 0x02986, 0x03002, 0x0300c,
+  0x0300d, 0x03001, 0x030fb, 0x030f2, 0x030a1, 0x030a3, 0x030a5, 0x030a7, 0x030a9, 0x030e3,
+  0x030e5, 0x030e7, 0x030c3, 0x030fc, 0x030a2, 0x030a4, 0x030a6, 0x030a8, 0x030aa, 0x030ab,
+  0x030ad, 0x030af, 0x030b1, 0x030b3, 0x030b5, 0x030b7, 0x030b9, 0x030bb, 0x030bd, 0x030bf,
+  0x030c1, 0x030c4, 0x030c6, 0x030c8, 0x030ca, 0x030cb, 0x030cc, 0x030cd, 0x030ce, 0x030cf,
+  0x030d2, 0x030d5, 0x030d8, 0x030db, 0x030de, 0x030df, 0x030e0, 0x030e1, 0x030e2, 0x030e4,
+  0x030e6, 0x030e8, 0x030e9, 0x030ea, 0x030eb, 0x030ec, 0x030ed, 0x030ef, 0x030f3, 0x03099,
+  0x0309a, 0x01160, 0x01100, 0x01101, 0x011aa, 0x01102, 0x011ac, 0x011ad, 0x01103, 0x01104,
+  0x01105, 0x011b0, 0x011b1, 0x011b2, 0x011b3, 0x011b4, 0x011b5, 0x0111a, 0x01106, 0x01107,
+  0x01108, 0x01121, 0x01109, 0x0110a, 0x0110b, 0x0110c, 0x0110d, 0x0110e, 0x0110f, 0x01110,
+  0x01111, 0x01112, 0x01161, 0x01162, 0x01163, 0x01164, 0x01165, 0x01166, 0x01167, 0x01168,
+  0x01169, 0x0116a, 0x0116b, 0x0116c, 0x0116d, 0x0116e, 0x0116f, 0x01170, 0x01171, 0x01172,
+  0x01173, 0x01174, 0x01175, 0x000a2, 0x000a3, 0x000ac, 0x00020, 0x00304, 0x000a6, 0x000a5,
+  0x020a9, 0x02502, 0x02190, 0x02191, 0x02192, 0x02193, 0x025a0, 0x025cb, 0x002d0, 0x002d1,
+  0x000e6, 0x00299, 0x00253, 0x002a3, 0x0ab66, 0x002a5, 0x002a4, 0x00256, 0x00257, 0x01d91,
+  0x00258, 0x0025e, 0x002a9, 0x00264, 0x00262, 0x00260, 0x0029b, 0x00127, 0x0029c, 0x00267,
+  0x00284, 0x002aa, 0x002ab, 0x0026c, 0x1df04, 0x0a78e, 0x0026e, 0x1df05, 0x0028e, 0x1df06,
+  0x000f8, 0x00276, 0x00277, 0x00071, 0x0027a, 0x1df08, 0x0027d, 0x0027e, 0x00280, 0x002a8,
+  0x002a6, 0x0ab67, 0x002a7, 0x00288, 0x02c71, 0x0028f, 0x002a1, 0x002a2, 0x00298, 0x001c0,
+  0x001c1, 0x001c2, 0x1df0a, 0x1df1e, 0x11099, 0x110ba, 0x1109b, 0x110ba, 0x110a5, 0x110ba,
+  0x11131, 0x11127, 0x11132, 0x11127, 0x11347, 0x1133e, 0x11347, 0x11357, 0x114b9, 0x114ba,
+  0x114b9, 0x114b0, 0x114b9, 0x114bd, 0x115b8, 0x115af, 0x115b9, 0x115af, 0x11935, 0x11930,
+  0x1d157, 0x1d165, 0x1d158, 0x1d165, 0x1d158, 0x1d165, 0x1d16e, 0x1d158, 0x1d165, 0x1d16f,
+  0x1d158, 0x1d165, 0x1d170, 0x1d158, 0x1d165, 0x1d171, 0x1d158, 0x1d165, 0x1d172, 0x1d1b9,
+  0x1d165, 0x1d1ba, 0x1d165, 0x1d1b9, 0x1d165, 0x1d16e, 0x1d1ba, 0x1d165, 0x1d16e, 0x1d1b9,
+  0x1d165, 0x1d16f, 0x1d1ba, 0x1d165, 0x1d16f, 0x00041, 0x00042, 0x00043, 0x00044, 0x00045,
+  0x00046, 0x00047, 0x00048, 0x00049, 0x0004a, 0x0004b, 0x0004c, 0x0004d, 0x0004e, 0x0004f,
+  0x00050, 0x00051, 0x00052, 0x00053, 0x00054, 0x00055, 0x00056, 0x00057, 0x00058, 0x00059,
+  0x0005a, 0x00061, 0x00062, 0x00063, 0x00064, 0x00065, 0x00066, 0x00067, 0x00068, 0x00069,
+  0x0006a, 0x0006b, 0x0006c, 0x0006d, 0x0006e, 0x0006f, 0x00070, 0x00071, 0x00072, 0x00073,
+  0x00074, 0x00075, 0x00076, 0x00077, 0x00078, 0x00079, 0x0007a, 0x00041, 0x00042, 0x00043,
+  0x00044, 0x00045, 0x00046, 0x00047, 0x00048, 0x00049, 0x0004a, 0x0004b, 0x0004c, 0x0004d,
+  0x0004e, 0x0004f, 0x00050, 0x00051, 0x00052, 0x00053, 0x00054, 0x00055, 0x00056, 0x00057,
+  0x00058, 0x00059, 0x0005a, 0x00061, 0x00062, 0x00063, 0x00064, 0x00065, 0x00066, 0x00067,
+  0x00069, 0x0006a, 0x0006b, 0x0006c, 0x0006d, 0x0006e, 0x0006f, 0x00070, 0x00071, 0x00072,
+  0x00073, 0x00074, 0x00075, 0x00076, 0x00077, 0x00078, 0x00079, 0x0007a, 0x00041, 0x00042,
+  0x00043, 0x00044, 0x00045, 0x00046, 0x00047, 0x00048, 0x00049, 0x0004a, 0x0004b, 0x0004c,
+  0x0004d, 0x0004e, 0x0004f, 0x00050, 0x00051, 0x00052, 0x00053, 0x00054, 0x00055, 0x00056,
+  0x00057, 0x00058, 0x00059, 0x0005a, 0x00061, 0x00062, 0x00063, 0x00064, 0x00065, 0x00066,
+  0x00067, 0x00068, 0x00069, 0x0006a, 0x0006b, 0x0006c, 0x0006d, 0x0006e, 0x0006f, 0x00070,
+  0x00071, 0x00072, 0x00073, 0x00074, 0x00075, 0x00076, 0x00077, 0x00078, 0x00079, 0x0007a,
+  0x00041, 0x00043, 0x00044, 0x00047, 0x0004a, 0x0004b, 0x0004e, 0x0004f, 0x00050, 0x00051,
+  0x00053, 0x00054, 0x00055, 0x00056, 0x00057, 0x00058, 0x00059, 0x0005a, 0x00061, 0x00062,
+  0x00063, 0x00064, 0x00066, 0x00068, 0x00069, 0x0006a, 0x0006b, 0x0006c, 0x0006d, 0x0006e,
+  0x00070, 0x00071, 0x00072, 0x00073, 0x00074, 0x00075, 0x00076, 0x00077, 0x00078, 0x00079,
+  0x0007a, 0x00041, 0x00042, 0x00043, 0x00044, 0x00045, 0x00046, 0x00047, 0x00048, 0x00049,
+  0x0004a, 0x0004b, 0x0004c, 0x0004d, 0x0004e, 0x0004f, 0x00050, 0x00051, 0x00052, 0x00053,
+  0x00054, 0x00055, 0x00056, 0x00057, 0x00058, 0x00059, 0x0005a, 0x00061, 0x00062, 0x00063,
+  0x00064, 0x00065, 0x00066, 0x00067, 0x00068, 0x00069, 0x0006a, 0x0006b, 0x0006c, 0x0006d,
+  0x0006e, 0x0006f, 0x00070, 0x00071, 0x00072, 0x00073, 0x00074, 0x00075, 0x00076, 0x00077,
+  0x00078, 0x00079, 0x0007a, 0x00041, 0x00042, 0x00044, 0x00045, 0x00046, 0x00047, 0x0004a,
+  0x0004b, 0x0004c, 0x0004d, 0x0004e, 0x0004f, 0x00050, 0x00051, 0x00053, 0x00054, 0x00055,
+  0x00056, 0x00057, 0x00058, 0x00059, 0x00061, 0x00062, 0x00063, 0x00064, 0x00065, 0x00066,
+  0x00067, 0x00068, 0x00069, 0x0006a, 0x0006b, 0x0006c, 0x0006d, 0x0006e, 0x0006f, 0x00070,
+  0x00071, 0x00072, 0x00073, 0x00074, 0x00075, 0x00076, 0x00077, 0x00078, 0x00079, 0x0007a,
+  0x00041, 0x00042, 0x00044, 0x00045, 0x00046, 0x00047, 0x00049, 0x0004a, 0x0004b, 0x0004c,
+  0x0004d, 0x0004f, 0x00053, 0x00054, 0x00055, 0x00056, 0x00057, 0x00058, 0x00059, 0x00061,
+  0x00062, 0x00063, 0x00064, 0x00065, 0x00066, 0x00067, 0x00068, 0x00069, 0x0006a, 0x0006b,
+  0x0006c, 0x0006d, 0x0006e, 0x0006f, 0x00070, 0x00071, 0x00072, 0x00073, 0x00074, 0x00075,
+  0x00076, 0x00077, 0x00078, 0x00079, 0x0007a, 0x00041, 0x00042, 0x00043, 0x00044, 0x00045,
+  0x00046, 0x00047, 0x00048, 0x00049, 0x0004a, 0x0004b, 0x0004c, 0x0004d, 0x0004e, 0x0004f,
+  0x00050, 0x00051, 0x00052, 0x00053, 0x00054, 0x00055, 0x00056, 0x00057, 0x00058, 0x00059,
+  0x0005a, 0x00061, 0x00062, 0x00063, 0x00064, 0x00065, 0x00066, 0x00067, 0x00068, 0x00069,
+  0x0006a, 0x0006b, 0x0006c, 0x0006d, 0x0006e, 0x0006f, 0x00070, 0x00071, 0x00072, 0x00073,
+  0x00074, 0x00075, 0x00076, 0x00077, 0x00078, 0x00079, 0x0007a, 0x00041, 0x00042, 0x00043,
+  0x00044, 0x00045, 0x00046, 0x00047, 0x00048, 0x00049, 0x0004a, 0x0004b, 0x0004c, 0x0004d,
+  0x0004e, 0x0004f, 0x00050, 0x00051, 0x00052, 0x00053, 0x00054, 0x00055, 0x00056, 0x00057,
+  0x00058, 0x00059, 0x0005a, 0x00061, 0x00062, 0x00063, 0x00064, 0x00065, 0x00066, 0x00067,
+  0x00068, 0x00069, 0x0006a, 0x0006b, 0x0006c, 0x0006d, 0x0006e, 0x0006f, 0x00070, 0x00071,
+  0x00072, 0x00073, 0x00074, 0x00075, 0x00076, 0x00077, 0x00078, 0x00079, 0x0007a, 0x00041,
+  0x00042, 0x00043, 0x00044, 0x00045, 0x00046, 0x00047, 0x00048, 0x00049, 0x0004a, 0x0004b,
+  0x0004c, 0x0004d, 0x0004e, 0x0004f, 0x00050, 0x00051, 0x00052, 0x00053, 0x00054, 0x00055,
+  0x00056, 0x00057, 0x00058, 0x00059, 0x0005a, 0x00061, 0x00062, 0x00063, 0x00064, 0x00065,
+  0x00066, 0x00067, 0x00068, 0x00069, 0x0006a, 0x0006b, 0x0006c, 0x0006d, 0x0006e, 0x0006f,
+  0x00070, 0x00071, 0x00072, 0x00073, 0x00074, 0x00075, 0x00076, 0x00077, 0x00078, 0x00079,
+  0x0007a, 0x00041, 0x00042, 0x00043, 0x00044, 0x00045, 0x00046, 0x00047, 0x00048, 0x00049,
+  0x0004a, 0x0004b, 0x0004c, 0x0004d, 0x0004e, 0x0004f, 0x00050, 0x00051, 0x00052, 0x00053,
+  0x00054, 0x00055, 0x00056, 0x00057, 0x00058, 0x00059, 0x0005a, 0x00061, 0x00062, 0x00063,
+  0x00064, 0x00065, 0x00066, 0x00067, 0x00068, 0x00069, 0x0006a, 0x0006b, 0x0006c, 0x0006d,
+  0x0006e, 0x0006f, 0x00070, 0x00071, 0x00072, 0x00073, 0x00074, 0x00075, 0x00076, 0x00077,
+  0x00078, 0x00079, 0x0007a, 0x00041, 0x00042, 0x00043, 0x00044, 0x00045, 0x00046, 0x00047,
+  0x00048, 0x00049, 0x0004a, 0x0004b, 0x0004c, 0x0004d, 0x0004e, 0x0004f, 0x00050, 0x00051,
+  0x00052, 0x00053, 0x00054, 0x00055, 0x00056, 0x00057, 0x00058, 0x00059, 0x0005a, 0x00061,
+  0x00062, 0x00063, 0x00064, 0x00065, 0x00066, 0x00067, 0x00068, 0x00069, 0x0006a, 0x0006b,
+  0x0006c, 0x0006d, 0x0006e, 0x0006f, 0x00070, 0x00071, 0x00072, 0x00073, 0x00074, 0x00075,
+  0x00076, 0x00077, 0x00078, 0x00079, 0x0007a, 0x00041, 0x00042, 0x00043, 0x00044, 0x00045,
+  0x00046, 0x00047, 0x00048, 0x00049, 0x0004a, 0x0004b, 0x0004c, 0x0004d, 0x0004e, 0x0004f,
+  0x00050, 0x00051, 0x00052, 0x00053, 0x00054, 0x00055, 0x00056, 0x00057, 0x00058, 0x00059,
+  0x0005a, 0x00061, 0x00062, 0x00063, 0x00064, 0x00065, 0x00066, 0x00067, 0x00068, 0x00069,
+  0x0006a, 0x0006b, 0x0006c, 0x0006d, 0x0006e, 0x0006f, 0x00070, 0x00071, 0x00072, 0x00073,
+  0x00074, 0x00075, 0x00076, 0x00077, 0x00078, 0x00079, 0x0007a, 0x00131, 0x00237, 0x00391,
+  0x00392, 0x00393, 0x00394, 0x00395, 0x00396, 0x00397, 0x00398, 0x00399, 0x0039a, 0x0039b,
+  0x0039c, 0x0039d, 0x0039e, 0x0039f, 0x003a0, 0x003a1, 0x00398, 0x003a3, 0x003a4, 0x003a5,
+  0x003a6, 0x003a7, 0x003a8, 0x003a9, 0x02207, 0x003b1, 0x003b2, 0x003b3, 0x003b4, 0x003b5,
+  0x003b6, 0x003b7, 0x003b8, 0x003b9, 0x003ba, 0x003bb, 0x003bc, 0x003bd, 0x003be, 0x003bf,
+  0x003c0, 0x003c1, 0x003c2, 0x003c3, 0x003c4, 0x003c5, 0x003c6, 0x003c7, 0x003c8, 0x003c9,
+  0x02202, 0x003b5, 0x003b8, 0x003ba, 0x003c6, 0x003c1, 0x003c0, 0x00391, 0x00392, 0x00393,
+  0x00394, 0x00395, 0x00396, 0x00397, 0x00398, 0x00399, 0x0039a, 0x0039b, 0x0039c, 0x0039d,
+  0x0039e, 0x0039f, 0x003a0, 0x003a1, 0x00398, 0x003a3, 0x003a4, 0x003a5, 0x003a6, 0x003a7,
+  0x003a8, 0x003a9, 0x02207, 0x003b1, 0x003b2, 0x003b3, 0x003b4, 0x003b5, 0x003b6, 0x003b7,
+  0x003b8, 0x003b9, 0x003ba, 0x003bb, 0x003bc, 0x003bd, 0x003be, 0x003bf, 0x003c0, 0x003c1,
+  0x003c2, 0x003c3, 0x003c4, 0x003c5, 0x003c6, 0x003c7, 0x003c8, 0x003c9, 0x02202, 0x003b5,
+  0x003b8, 0x003ba, 0x003c6, 0x003c1, 0x003c0, 0x00391, 0x00392, 0x00393, 0x00394, 0x00395,
+  0x00396, 0x00397, 0x00398, 0x00399, 0x0039a, 0x0039b, 0x0039c, 0x0039d, 0x0039e, 0x0039f,
+  0x003a0, 0x003a1, 0x00398, 0x003a3, 0x003a4, 0x003a5, 0x003a6, 0x003a7, 0x003a8, 0x003a9,
+  0x02207, 0x003b1, 0x003b2, 0x003b3, 0x003b4, 0x003b5, 0x003b6, 0x003b7, 0x003b8, 0x003b9,
+  0x003ba, 0x003bb, 0x003bc, 0x003bd, 0x003be, 0x003bf, 0x003c0, 0x003c1, 0x003c2, 0x003c3,
+  0x003c4, 0x003c5, 0x003c6, 0x003c7, 0x003c8, 0x003c9, 0x02202, 0x003b5, 0x003b8, 0x003ba,
+  0x003c6, 0x003c1, 0x003c0, 0x00391, 0x00392, 0x00393, 0x00394, 0x00395, 0x00396, 0x00397,
+  0x00398, 0x00399, 0x0039a, 0x0039b, 0x0039c, 0x0039d, 0x0039e, 0x0039f, 0x003a0, 0x003a1,
+  0x00398, 0x003a3, 0x003a4, 0x003a5, 0x003a6, 0x003a7, 0x003a8, 0x003a9, 0x02207, 0x003b1,
+  0x003b2, 0x003b3, 0x003b4, 0x003b5, 0x003b6, 0x003b7, 0x003b8, 0x003b9, 0x003ba, 0x003bb,
+  0x003bc, 0x003bd, 0x003be, 0x003bf, 0x003c0, 0x003c1, 0x003c2, 0x003c3, 0x003c4, 0x003c5,
+  0x003c6, 0x003c7, 0x003c8, 0x003c9, 0x02202, 0x003b5, 0x003b8, 0x003ba, 0x003c6, 0x003c1,
+  0x003c0, 0x00391, 0x00392, 0x00393, 0x00394, 0x00395, 0x00396, 0x00397, 0x00398, 0x00399,
+  0x0039a, 0x0039b, 0x0039c, 0x0039d, 0x0039e, 0x0039f, 0x003a0, 0x003a1, 0x00398, 0x003a3,
+  0x003a4, 0x003a5, 0x003a6, 0x003a7, 0x003a8, 0x003a9, 0x02207, 0x003b1, 0x003b2, 0x003b3,
+  0x003b4, 0x003b5, 0x003b6, 0x003b7, 0x003b8, 0x003b9, 0x003ba, 0x003bb, 0x003bc, 0x003bd,
+  0x003be, 0x003bf, 0x003c0, 0x003c1, 0x003c2, 0x003c3, 0x003c4, 0x003c5, 0x003c6, 0x003c7,
+  0x003c8, 0x003c9, 0x02202, 0x003b5, 0x003b8, 0x003ba, 0x003c6, 0x003c1, 0x003c0, 0x003dc,
+  0x003dd, 0x00030, 0x00031, 0x00032, 0x00033, 0x00034, 0x00035, 0x00036, 0x00037, 0x00038,
+  0x00039, 0x00030, 0x00031, 0x00032, 0x00033, 0x00034, 0x00035, 0x00036, 0x00037, 0x00038,
+  0x00039, 0x00030, 0x00031, 0x00032, 0x00033, 0x00034, 0x00035, 0x00036, 0x00037, 0x00038,
+  0x00039, 0x00030, 0x00031, 0x00032, 0x00033, 0x00034, 0x00035, 0x00036, 0x00037, 0x00038,
+  0x00039, 0x00030, 0x00031, 0x00032, 0x00033, 0x00034, 0x00035, 0x00036, 0x00037, 0x00038,
+  0x00039, 0x00627, 0x00628, 0x0062c, 0x0062f, 0x00648, 0x00632, 0x0062d, 0x00637, 0x0064a,
+  0x00643, 0x00644, 0x00645, 0x00646, 0x00633, 0x00639, 0x00641, 0x00635, 0x00642, 0x00631,
+  0x00634, 0x0062a, 0x0062b, 0x0062e, 0x00630, 0x00636, 0x00638, 0x0063a, 0x0066e, 0x006ba,
+  0x006a1, 0x0066f, 0x00628, 0x0062c, 0x00647, 0x0062d, 0x0064a, 0x00643, 0x00644, 0x00645,
+  0x00646, 0x00633, 0x00639, 0x00641, 0x00635, 0x00642, 0x00634, 0x0062a, 0x0062b, 0x0062e,
+  0x00636, 0x0063a, 0x0062c, 0x0062d, 0x0064a, 0x00644, 0x00646, 0x00633, 0x00639, 0x00635,
+  0x00642, 0x00634, 0x0062e, 0x00636, 0x0063a, 0x006ba, 0x0066f, 0x00628, 0x0062c, 0x00647,
+  0x0062d, 0x00637, 0x0064a, 0x00643, 0x00645, 0x00646, 0x00633, 0x00639, 0x00641, 0x00635,
+  0x00642, 0x00634, 0x0062a, 0x0062b, 0x0062e, 0x00636, 0x00638, 0x0063a, 0x0066e, 0x006a1,
+  0x00627, 0x00628, 0x0062c, 0x0062f, 0x00647, 0x00648, 0x00632, 0x0062d, 0x00637, 0x0064a,
+  0x00644, 0x00645, 0x00646, 0x00633, 0x00639, 0x00641, 0x00635, 0x00642, 0x00631, 0x00634,
+  0x0062a, 0x0062b, 0x0062e, 0x00630, 0x00636, 0x00638, 0x0063a, 0x00628, 0x0062c, 0x0062f,
+  0x00648, 0x00632, 0x0062d, 0x00637, 0x0064a, 0x00644, 0x00645, 0x00646, 0x00633, 0x00639,
+  0x00641, 0x00635, 0x00642, 0x00631, 0x00634, 0x0062a, 0x0062b, 0x0062e, 0x00630, 0x00636,
+  0x00638, 0x0063a, 0x00030, 0x0002e, 0x00030, 0x0002c, 0x00031, 0x0002c, 0x00032, 0x0002c,
+  0x00033, 0x0002c, 0x00034, 0x0002c, 0x00035, 0x0002c, 0x00036, 0x0002c, 0x00037, 0x0002c,
+  0x00038, 0x0002c, 0x00039, 0x0002c, 0x00028, 0x00041, 0x00029, 0x00028, 0x00042, 0x00029,
+  0x00028, 0x00043, 0x00029, 0x00028, 0x00044, 0x00029, 0x00028, 0x00045, 0x00029, 0x00028,
+  0x00046, 0x00029, 0x00028, 0x00047, 0x00029, 0x00028, 0x00048, 0x00029, 0x00028, 0x00049,
+  0x00029, 0x00028, 0x0004a, 0x00029, 0x00028, 0x0004b, 0x00029, 0x00028, 0x0004c, 0x00029,
+  0x00028, 0x0004d, 0x00029, 0x00028, 0x0004e, 0x00029, 0x00028, 0x0004f, 0x00029, 0x00028,
+  0x00050, 0x00029, 0x00028, 0x00051, 0x00029, 0x00028, 0x00052, 0x00029, 0x00028, 0x00053,
+  0x00029, 0x00028, 0x00054, 0x00029, 0x00028, 0x00055, 0x00029, 0x00028, 0x00056, 0x00029,
+  0x00028, 0x00057, 0x00029, 0x00028, 0x00058, 0x00029, 0x00028, 0x00059, 0x00029, 0x00028,
+  0x0005a, 0x00029, 0x03014, 0x00053, 0x03015, 0x00043, 0x00052, 0x00043, 0x00044, 0x00057,
+  0x0005a, 0x00041, 0x00042, 0x00043, 0x00044, 0x00045, 0x00046, 0x00047, 0x00048, 0x00049,
+  0x0004a, 0x0004b, 0x0004c, 0x0004d, 0x0004e, 0x0004f, 0x00050, 0x00051, 0x00052, 0x00053,
+  0x00054, 0x00055, 0x00056, 0x00057, 0x00058, 0x00059, 0x0005a, 0x00048, 0x00056, 0x0004d,
+  0x00056, 0x00053, 0x00044, 0x00053, 0x00053, 0x00050, 0x00050, 0x00056, 0x00057, 0x00043,
+  0x0004d, 0x00043, 0x0004d, 0x00044, 0x0004d, 0x00052, 0x00044, 0x0004a, 0x0307b, 0x0304b,
+  0x030b3, 0x030b3, 0x030b5, 0x0624b, 0x05b57, 0x053cc, 0x030c6, 0x03099, 0x04e8c, 0x0591a,
+  0x089e3, 0x05929, 0x04ea4, 0x06620, 0x07121, 0x06599, 0x0524d, 0x05f8c, 0x0518d, 0x065b0,
+  0x0521d, 0x07d42, 0x0751f, 0x08ca9, 0x058f0, 0x05439, 0x06f14, 0x06295, 0x06355, 0x04e00,
+  0x04e09, 0x0904a, 0x05de6, 0x04e2d, 0x053f3, 0x06307, 0x08d70, 0x06253, 0x07981, 0x07a7a,
+  0x05408, 0x06e80, 0x06709, 0x06708, 0x07533, 0x05272, 0x055b6, 0x0914d, 0x03014, 0x0672c,
+  0x03015, 0x03014, 0x04e09, 0x03015, 0x03014, 0x04e8c, 0x03015, 0x03014, 0x05b89, 0x03015,
+  0x03014, 0x070b9, 0x03015, 0x03014, 0x06253, 0x03015, 0x03014, 0x076d7, 0x03015, 0x03014,
+  0x052dd, 0x03015, 0x03014, 0x06557, 0x03015, 0x05f97, 0x053ef, 0x00030, 0x00031, 0x00032,
+  0x00033, 0x00034, 0x00035, 0x00036, 0x00037, 0x00038, 0x00039, 0x04e3d, 0x04e38, 0x04e41,
+  0x20122, 0x04f60, 0x04fae, 0x04fbb, 0x05002, 0x0507a, 0x05099, 0x050e7, 0x050cf, 0x0349e,
+  0x2063a, 0x0514d, 0x05154, 0x05164, 0x05177, 0x2051c, 0x034b9, 0x05167, 0x0518d, 0x2054b,
+  0x05197, 0x051a4, 0x04ecc, 0x051ac, 0x051b5, 0x291df, 0x051f5, 0x05203, 0x034df, 0x0523b,
+  0x05246, 0x05272, 0x05277, 0x03515, 0x052c7, 0x052c9, 0x052e4, 0x052fa, 0x05305, 0x05306,
+  0x05317, 0x05349, 0x05351, 0x0535a, 0x05373, 0x0537d, 0x0537f, 0x0537f, 0x0537f, 0x20a2c,
+  0x07070, 0x053ca, 0x053df, 0x20b63, 0x053eb, 0x053f1, 0x05406, 0x0549e, 0x05438, 0x05448,
+  0x05468, 0x054a2, 0x054f6, 0x05510, 0x05553, 0x05563, 0x05584, 0x05584, 0x05599, 0x055ab,
+  0x055b3, 0x055c2, 0x05716, 0x05606, 0x05717, 0x05651, 0x05674, 0x05207, 0x058ee, 0x057ce,
+  0x057f4, 0x0580d, 0x0578b, 0x05832, 0x05831, 0x058ac, 0x214e4, 0x058f2, 0x058f7, 0x05906,
+  0x0591a, 0x05922, 0x05962, 0x216a8, 0x216ea, 0x059ec, 0x05a1b, 0x05a27, 0x059d8, 0x05a66,
+  0x036ee, 0x036fc, 0x05b08, 0x05b3e, 0x05b3e, 0x219c8, 0x05bc3, 0x05bd8, 0x05be7, 0x05bf3,
+  0x21b18, 0x05bff, 0x05c06, 0x05f53, 0x05c22, 0x03781, 0x05c60, 0x05c6e, 0x05cc0, 0x05c8d,
+  0x21de4, 0x05d43, 0x21de6, 0x05d6e, 0x05d6b, 0x05d7c, 0x05de1, 0x05de2, 0x0382f, 0x05dfd,
+  0x05e28, 0x05e3d, 0x05e69, 0x03862, 0x22183, 0x0387c, 0x05eb0, 0x05eb3, 0x05eb6, 0x05eca,
+  0x2a392, 0x05efe, 0x22331, 0x22331, 0x08201, 0x05f22, 0x05f22, 0x038c7, 0x232b8, 0x261da,
+  0x05f62, 0x05f6b, 0x038e3, 0x05f9a, 0x05fcd, 0x05fd7, 0x05ff9, 0x06081, 0x0393a, 0x0391c,
+  0x06094, 0x226d4, 0x060c7, 0x06148, 0x0614c, 0x0614e, 0x0614c, 0x0617a, 0x0618e, 0x061b2,
+  0x061a4, 0x061af, 0x061de, 0x061f2, 0x061f6, 0x06210, 0x0621b, 0x0625d, 0x062b1, 0x062d4,
+  0x06350, 0x22b0c, 0x0633d, 0x062fc, 0x06368, 0x06383, 0x063e4, 0x22bf1, 0x06422, 0x063c5,
+  0x063a9, 0x03a2e, 0x06469, 0x0647e, 0x0649d, 0x06477, 0x03a6c, 0x0654f, 0x0656c, 0x2300a,
+  0x065e3, 0x066f8, 0x06649, 0x03b19, 0x06691, 0x03b08, 0x03ae4, 0x05192, 0x05195, 0x06700,
+  0x0669c, 0x080ad, 0x043d9, 0x06717, 0x0671b, 0x06721, 0x0675e, 0x06753, 0x233c3, 0x03b49,
+  0x067fa, 0x06785, 0x06852, 0x06885, 0x2346d, 0x0688e, 0x0681f, 0x06914, 0x03b9d, 0x06942,
+  0x069a3, 0x069ea, 0x06aa8, 0x236a3, 0x06adb, 0x03c18, 0x06b21, 0x238a7, 0x06b54, 0x03c4e,
+  0x06b72, 0x06b9f, 0x06bba, 0x06bbb, 0x23a8d, 0x21d0b, 0x23afa, 0x06c4e, 0x23cbc, 0x06cbf,
+  0x06ccd, 0x06c67, 0x06d16, 0x06d3e, 0x06d77, 0x06d41, 0x06d69, 0x06d78, 0x06d85, 0x23d1e,
+  0x06d34, 0x06e2f, 0x06e6e, 0x03d33, 0x06ecb, 0x06ec7, 0x23ed1, 0x06df9, 0x06f6e, 0x23f5e,
+  0x23f8e, 0x06fc6, 0x07039, 0x0701e, 0x0701b, 0x03d96, 0x0704a, 0x0707d, 0x07077, 0x070ad,
+  0x20525, 0x07145, 0x24263, 0x0719c, 0x243ab, 0x07228, 0x07235, 0x07250, 0x24608, 0x07280,
+  0x07295, 0x24735, 0x24814, 0x0737a, 0x0738b, 0x03eac, 0x073a5, 0x03eb8, 0x03eb8, 0x07447,
+  0x0745c, 0x07471, 0x07485, 0x074ca, 0x03f1b, 0x07524, 0x24c36, 0x0753e, 0x24c92, 0x07570,
+  0x2219f, 0x07610, 0x24fa1, 0x24fb8, 0x25044, 0x03ffc, 0x04008, 0x076f4, 0x250f3, 0x250f2,
+  0x25119, 0x25133, 0x0771e, 0x0771f, 0x0771f, 0x0774a, 0x04039, 0x0778b, 0x04046, 0x04096,
+  0x2541d, 0x0784e, 0x0788c, 0x078cc, 0x040e3, 0x25626, 0x07956, 0x2569a, 0x256c5, 0x0798f,
+  0x079eb, 0x0412f, 0x07a40, 0x07a4a, 0x07a4f, 0x2597c, 0x25aa7, 0x25aa7, 0x07aee, 0x04202,
+  0x25bab, 0x07bc6, 0x07bc9, 0x04227, 0x25c80, 0x07cd2, 0x042a0, 0x07ce8, 0x07ce3, 0x07d00,
+  0x25f86, 0x07d63, 0x04301, 0x07dc7, 0x07e02, 0x07e45, 0x04334, 0x26228, 0x26247, 0x04359,
+  0x262d9, 0x07f7a, 0x2633e, 0x07f95, 0x07ffa, 0x08005, 0x264da, 0x26523, 0x08060, 0x265a8,
+  0x08070, 0x2335f, 0x043d5, 0x080b2, 0x08103, 0x0440b, 0x0813e, 0x05ab5, 0x267a7, 0x267b5,
+  0x23393, 0x2339c, 0x08201, 0x08204, 0x08f9e, 0x0446b, 0x08291, 0x0828b, 0x0829d, 0x052b3,
+  0x082b1, 0x082b3, 0x082bd, 0x082e6, 0x26b3c, 0x082e5, 0x0831d, 0x08363, 0x083ad, 0x08323,
+  0x083bd, 0x083e7, 0x08457, 0x08353, 0x083ca, 0x083cc, 0x083dc, 0x26c36, 0x26d6b, 0x26cd5,
+  0x0452b, 0x084f1, 0x084f3, 0x08516, 0x273ca, 0x08564, 0x26f2c, 0x0455d, 0x04561, 0x26fb1,
+  0x270d2, 0x0456b, 0x08650, 0x0865c, 0x08667, 0x08669, 0x086a9, 0x08688, 0x0870e, 0x086e2,
+  0x08779, 0x08728, 0x0876b, 0x08786, 0x045d7, 0x087e1, 0x08801, 0x045f9, 0x08860, 0x08863,
+  0x27667, 0x088d7, 0x088de, 0x04635, 0x088fa, 0x034bb, 0x278ae, 0x27966, 0x046be, 0x046c7,
+  0x08aa0, 0x08aed, 0x08b8a, 0x08c55, 0x27ca8, 0x08cab, 0x08cc1, 0x08d1b, 0x08d77, 0x27f2f,
+  0x20804, 0x08dcb, 0x08dbc, 0x08df0, 0x208de, 0x08ed4, 0x08f38, 0x285d2, 0x285ed, 0x09094,
+  0x090f1, 0x09111, 0x2872e, 0x0911b, 0x09238, 0x092d7, 0x092d8, 0x0927c, 0x093f9, 0x09415,
+  0x28bfa, 0x0958b, 0x04995, 0x095b7, 0x28d77, 0x049e6, 0x096c3, 0x05db2, 0x09723, 0x29145,
+  0x2921a, 0x04a6e, 0x04a76, 0x097e0, 0x2940a, 0x04ab2, 0x29496, 0x0980b, 0x0980b, 0x09829,
+  0x295b6, 0x098e2, 0x04b33, 0x09929, 0x099a7, 0x099c2, 0x099fe, 0x04bce, 0x29b30, 0x09b12,
+  0x09c40, 0x09cfd, 0x04cce, 0x04ced, 0x09d67, 0x2a0ce, 0x04cf8, 0x2a105, 0x2a20e, 0x2a291,
+  0x09ebb, 0x04d56, 0x09ef9, 0x09efe, 0x09f05, 0x09f0f, 0x09f16, 0x09f3b, 0x2a600
+};
+
+const struct toke_composition toke_unicode_compositions[941] = {
+  { 0x0003c, 0x00338, 0x0226e },
+  { 0x0003d, 0x00338, 0x02260 },
+  { 0x0003e, 0x00338, 0x0226f },
+  { 0x00041, 0x00300, 0x000c0 },
+  { 0x00041, 0x00301, 0x000c1 },
+  { 0x00041, 0x00302, 0x000c2 },
+  { 0x00041, 0x00303, 0x000c3 },
+  { 0x00041, 0x00304, 0x00100 },
+  { 0x00041, 0x00306, 0x00102 },
+  { 0x00041, 0x00307, 0x00226 },
+  { 0x00041, 0x00308, 0x000c4 },
+  { 0x00041, 0x00309, 0x01ea2 },
+  { 0x00041, 0x0030a, 0x000c5 },
+  { 0x00041, 0x0030c, 0x001cd },
+  { 0x00041, 0x0030f, 0x00200 },
+  { 0x00041, 0x00311, 0x00202 },
+  { 0x00041, 0x00323, 0x01ea0 },
+  { 0x00041, 0x00325, 0x01e00 },
+  { 0x00041, 0x00328, 0x00104 },
+  { 0x00042, 0x00307, 0x01e02 },
+  { 0x00042, 0x00323, 0x01e04 },
+  { 0x00042, 0x00331, 0x01e06 },
+  { 0x00043, 0x00301, 0x00106 },
+  { 0x00043, 0x00302, 0x00108 },
+  { 0x00043, 0x00307, 0x0010a },
+  { 0x00043, 0x0030c, 0x0010c },
+  { 0x00043, 0x00327, 0x000c7 },
+  { 0x00044, 0x00307, 0x01e0a },
+  { 0x00044, 0x0030c, 0x0010e },
+  { 0x00044, 0x00323, 0x01e0c },
+  { 0x00044, 0x00327, 0x01e10 },
+  { 0x00044, 0x0032d, 0x01e12 },
+  { 0x00044, 0x00331, 0x01e0e },
+  { 0x00045, 0x00300, 0x000c8 },
+  { 0x00045, 0x00301, 0x000c9 },
+  { 0x00045, 0x00302, 0x000ca },
+  { 0x00045, 0x00303, 0x01ebc },
+  { 0x00045, 0x00304, 0x00112 },
+  { 0x00045, 0x00306, 0x00114 },
+  { 0x00045, 0x00307, 0x00116 },
+  { 0x00045, 0x00308, 0x000cb },
+  { 0x00045, 0x00309, 0x01eba },
+  { 0x00045, 0x0030c, 0x0011a },
+  { 0x00045, 0x0030f, 0x00204 },
+  { 0x00045, 0x00311, 0x00206 },
+  { 0x00045, 0x00323, 0x01eb8 },
+  { 0x00045, 0x00327, 0x00228 },
+  { 0x00045, 0x00328, 0x00118 },
+  { 0x00045, 0x0032d, 0x01e18 },
+  { 0x00045, 0x00330, 0x01e1a },
+  { 0x00046, 0x00307, 0x01e1e },
+  { 0x00047, 0x00301, 0x001f4 },
+  { 0x00047, 0x00302, 0x0011c },
+  { 0x00047, 0x00304, 0x01e20 },
+  { 0x00047, 0x00306, 0x0011e },
+  { 0x00047, 0x00307, 0x00120 },
+  { 0x00047, 0x0030c, 0x001e6 },
+  { 0x00047, 0x00327, 0x00122 },
+  { 0x00048, 0x00302, 0x00124 },
+  { 0x00048, 0x00307, 0x01e22 },
+  { 0x00048, 0x00308, 0x01e26 },
+  { 0x00048, 0x0030c, 0x0021e },
+  { 0x00048, 0x00323, 0x01e24 },
+  { 0x00048, 0x00327, 0x01e28 },
+  { 0x00048, 0x0032e, 0x01e2a },
+  { 0x00049, 0x00300, 0x000cc },
+  { 0x00049, 0x00301, 0x000cd },
+  { 0x00049, 0x00302, 0x000ce },
+  { 0x00049, 0x00303, 0x00128 },
+  { 0x00049, 0x00304, 0x0012a },
+  { 0x00049, 0x00306, 0x0012c },
+  { 0x00049, 0x00307, 0x00130 },
+  { 0x00049, 0x00308, 0x000cf },
+  { 0x00049, 0x00309, 0x01ec8 },
+  { 0x00049, 0x0030c, 0x001cf },
+  { 0x00049, 0x0030f, 0x00208 },
+  { 0x00049, 0x00311, 0x0020a },
+  { 0x00049, 0x00323, 0x01eca },
+  { 0x00049, 0x00328, 0x0012e },
+  { 0x00049, 0x00330, 0x01e2c },
+  { 0x0004a, 0x00302, 0x00134 },
+  { 0x0004b, 0x00301, 0x01e30 },
+  { 0x0004b, 0x0030c, 0x001e8 },
+  { 0x0004b, 0x00323, 0x01e32 },
+  { 0x0004b, 0x00327, 0x00136 },
+  { 0x0004b, 0x00331, 0x01e34 },
+  { 0x0004c, 0x00301, 0x00139 },
+  { 0x0004c, 0x0030c, 0x0013d },
+  { 0x0004c, 0x00323, 0x01e36 },
+  { 0x0004c, 0x00327, 0x0013b },
+  { 0x0004c, 0x0032d, 0x01e3c },
+  { 0x0004c, 0x00331, 0x01e3a },
+  { 0x0004d, 0x00301, 0x01e3e },
+  { 0x0004d, 0x00307, 0x01e40 },
+  { 0x0004d, 0x00323, 0x01e42 },
+  { 0x0004e, 0x00300, 0x001f8 },
+  { 0x0004e, 0x00301, 0x00143 },
+  { 0x0004e, 0x00303, 0x000d1 },
+  { 0x0004e, 0x00307, 0x01e44 },
+  { 0x0004e, 0x0030c, 0x00147 },
+  { 0x0004e, 0x00323, 0x01e46 },
+  { 0x0004e, 0x00327, 0x00145 },
+  { 0x0004e, 0x0032d, 0x01e4a },
+  { 0x0004e, 0x00331, 0x01e48 },
+  { 0x0004f, 0x00300, 0x000d2 },
+  { 0x0004f, 0x00301, 0x000d3 },
+  { 0x0004f, 0x00302, 0x000d4 },
+  { 0x0004f, 0x00303, 0x000d5 },
+  { 0x0004f, 0x00304, 0x0014c },
+  { 0x0004f, 0x00306, 0x0014e },
+  { 0x0004f, 0x00307, 0x0022e },
+  { 0x0004f, 0x00308, 0x000d6 },
+  { 0x0004f, 0x00309, 0x01ece },
+  { 0x0004f, 0x0030b, 0x00150 },
+  { 0x0004f, 0x0030c, 0x001d1 },
+  { 0x0004f, 0x0030f, 0x0020c },
+  { 0x0004f, 0x00311, 0x0020e },
+  { 0x0004f, 0x0031b, 0x001a0 },
+  { 0x0004f, 0x00323, 0x01ecc },
+  { 0x0004f, 0x00328, 0x001ea },
+  { 0x00050, 0x00301, 0x01e54 },
+  { 0x00050, 0x00307, 0x01e56 },
+  { 0x00052, 0x00301, 0x00154 },
+  { 0x00052, 0x00307, 0x01e58 },
+  { 0x00052, 0x0030c, 0x00158 },
+  { 0x00052, 0x0030f, 0x00210 },
+  { 0x00052, 0x00311, 0x00212 },
+  { 0x00052, 0x00323, 0x01e5a },
+  { 0x00052, 0x00327, 0x00156 },
+  { 0x00052, 0x00331, 0x01e5e },
+  { 0x00053, 0x00301, 0x0015a },
+  { 0x00053, 0x00302, 0x0015c },
+  { 0x00053, 0x00307, 0x01e60 },
+  { 0x00053, 0x0030c, 0x00160 },
+  { 0x00053, 0x00323, 0x01e62 },
+  { 0x00053, 0x00326, 0x00218 },
+  { 0x00053, 0x00327, 0x0015e },
+  { 0x00054, 0x00307, 0x01e6a },
+  { 0x00054, 0x0030c, 0x00164 },
+  { 0x00054, 0x00323, 0x01e6c },
+  { 0x00054, 0x00326, 0x0021a },
+  { 0x00054, 0x00327, 0x00162 },
+  { 0x00054, 0x0032d, 0x01e70 },
+  { 0x00054, 0x00331, 0x01e6e },
+  { 0x00055, 0x00300, 0x000d9 },
+  { 0x00055, 0x00301, 0x000da },
+  { 0x00055, 0x00302, 0x000db },
+  { 0x00055, 0x00303, 0x00168 },
+  { 0x00055, 0x00304, 0x0016a },
+  { 0x00055, 0x00306, 0x0016c },
+  { 0x00055, 0x00308, 0x000dc },
+  { 0x00055, 0x00309, 0x01ee6 },
+  { 0x00055, 0x0030a, 0x0016e },
+  { 0x00055, 0x0030b, 0x00170 },
+  { 0x00055, 0x0030c, 0x001d3 },
+  { 0x00055, 0x0030f, 0x00214 },
+  { 0x00055, 0x00311, 0x00216 },
+  { 0x00055, 0x0031b, 0x001af },
+  { 0x00055, 0x00323, 0x01ee4 },
+  { 0x00055, 0x00324, 0x01e72 },
+  { 0x00055, 0x00328, 0x00172 },
+  { 0x00055, 0x0032d, 0x01e76 },
+  { 0x00055, 0x00330, 0x01e74 },
+  { 0x00056, 0x00303, 0x01e7c },
+  { 0x00056, 0x00323, 0x01e7e },
+  { 0x00057, 0x00300, 0x01e80 },
+  { 0x00057, 0x00301, 0x01e82 },
+  { 0x00057, 0x00302, 0x00174 },
+  { 0x00057, 0x00307, 0x01e86 },
+  { 0x00057, 0x00308, 0x01e84 },
+  { 0x00057, 0x00323, 0x01e88 },
+  { 0x00058, 0x00307, 0x01e8a },
+  { 0x00058, 0x00308, 0x01e8c },
+  { 0x00059, 0x00300, 0x01ef2 },
+  { 0x00059, 0x00301, 0x000dd },
+  { 0x00059, 0x00302, 0x00176 },
+  { 0x00059, 0x00303, 0x01ef8 },
+  { 0x00059, 0x00304, 0x00232 },
+  { 0x00059, 0x00307, 0x01e8e },
+  { 0x00059, 0x00308, 0x00178 },
+  { 0x00059, 0x00309, 0x01ef6 },
+  { 0x00059, 0x00323, 0x01ef4 },
+  { 0x0005a, 0x00301, 0x00179 },
+  { 0x0005a, 0x00302, 0x01e90 },
+  { 0x0005a, 0x00307, 0x0017b },
+  { 0x0005a, 0x0030c, 0x0017d },
+  { 0x0005a, 0x00323, 0x01e92 },
+  { 0x0005a, 0x00331, 0x01e94 },
+  { 0x00061, 0x00300, 0x000e0 },
+  { 0x00061, 0x00301, 0x000e1 },
+  { 0x00061, 0x00302, 0x000e2 },
+  { 0x00061, 0x00303, 0x000e3 },
+  { 0x00061, 0x00304, 0x00101 },
+  { 0x00061, 0x00306, 0x00103 },
+  { 0x00061, 0x00307, 0x00227 },
+  { 0x00061, 0x00308, 0x000e4 },
+  { 0x00061, 0x00309, 0x01ea3 },
+  { 0x00061, 0x0030a, 0x000e5 },
+  { 0x00061, 0x0030c, 0x001ce },
+  { 0x00061, 0x0030f, 0x00201 },
+  { 0x00061, 0x00311, 0x00203 },
+  { 0x00061, 0x00323, 0x01ea1 },
+  { 0x00061, 0x00325, 0x01e01 },
+  { 0x00061, 0x00328, 0x00105 },
+  { 0x00062, 0x00307, 0x01e03 },
+  { 0x00062, 0x00323, 0x01e05 },
+  { 0x00062, 0x00331, 0x01e07 },
+  { 0x00063, 0x00301, 0x00107 },
+  { 0x00063, 0x00302, 0x00109 },
+  { 0x00063, 0x00307, 0x0010b },
+  { 0x00063, 0x0030c, 0x0010d },
+  { 0x00063, 0x00327, 0x000e7 },
+  { 0x00064, 0x00307, 0x01e0b },
+  { 0x00064, 0x0030c, 0x0010f },
+  { 0x00064, 0x00323, 0x01e0d },
+  { 0x00064, 0x00327, 0x01e11 },
+  { 0x00064, 0x0032d, 0x01e13 },
+  { 0x00064, 0x00331, 0x01e0f },
+  { 0x00065, 0x00300, 0x000e8 },
+  { 0x00065, 0x00301, 0x000e9 },
+  { 0x00065, 0x00302, 0x000ea },
+  { 0x00065, 0x00303, 0x01ebd },
+  { 0x00065, 0x00304, 0x00113 },
+  { 0x00065, 0x00306, 0x00115 },
+  { 0x00065, 0x00307, 0x00117 },
+  { 0x00065, 0x00308, 0x000eb },
+  { 0x00065, 0x00309, 0x01ebb },
+  { 0x00065, 0x0030c, 0x0011b },
+  { 0x00065, 0x0030f, 0x00205 },
+  { 0x00065, 0x00311, 0x00207 },
+  { 0x00065, 0x00323, 0x01eb9 },
+  { 0x00065, 0x00327, 0x00229 },
+  { 0x00065, 0x00328, 0x00119 },
+  { 0x00065, 0x0032d, 0x01e19 },
+  { 0x00065, 0x00330, 0x01e1b },
+  { 0x00066, 0x00307, 0x01e1f },
+  { 0x00067, 0x00301, 0x001f5 },
+  { 0x00067, 0x00302, 0x0011d },
+  { 0x00067, 0x00304, 0x01e21 },
+  { 0x00067, 0x00306, 0x0011f },
+  { 0x00067, 0x00307, 0x00121 },
+  { 0x00067, 0x0030c, 0x001e7 },
+  { 0x00067, 0x00327, 0x00123 },
+  { 0x00068, 0x00302, 0x00125 },
+  { 0x00068, 0x00307, 0x01e23 },
+  { 0x00068, 0x00308, 0x01e27 },
+  { 0x00068, 0x0030c, 0x0021f },
+  { 0x00068, 0x00323, 0x01e25 },
+  { 0x00068, 0x00327, 0x01e29 },
+  { 0x00068, 0x0032e, 0x01e2b },
+  { 0x00068, 0x00331, 0x01e96 },
+  { 0x00069, 0x00300, 0x000ec },
+  { 0x00069, 0x00301, 0x000ed },
+  { 0x00069, 0x00302, 0x000ee },
+  { 0x00069, 0x00303, 0x00129 },
+  { 0x00069, 0x00304, 0x0012b },
+  { 0x00069, 0x00306, 0x0012d },
+  { 0x00069, 0x00308, 0x000ef },
+  { 0x00069, 0x00309, 0x01ec9 },
+  { 0x00069, 0x0030c, 0x001d0 },
+  { 0x00069, 0x0030f, 0x00209 },
+  { 0x00069, 0x00311, 0x0020b },
+  { 0x00069, 0x00323, 0x01ecb },
+  { 0x00069, 0x00328, 0x0012f },
+  { 0x00069, 0x00330, 0x01e2d },
+  { 0x0006a, 0x00302, 0x00135 },
+  { 0x0006a, 0x0030c, 0x001f0 },
+  { 0x0006b, 0x00301, 0x01e31 },
+  { 0x0006b, 0x0030c, 0x001e9 },
+  { 0x0006b, 0x00323, 0x01e33 },
+  { 0x0006b, 0x00327, 0x00137 },
+  { 0x0006b, 0x00331, 0x01e35 },
+  { 0x0006c, 0x00301, 0x0013a },
+  { 0x0006c, 0x0030c, 0x0013e },
+  { 0x0006c, 0x00323, 0x01e37 },
+  { 0x0006c, 0x00327, 0x0013c },
+  { 0x0006c, 0x0032d, 0x01e3d },
+  { 0x0006c, 0x00331, 0x01e3b },
+  { 0x0006d, 0x00301, 0x01e3f },
+  { 0x0006d, 0x00307, 0x01e41 },
+  { 0x0006d, 0x00323, 0x01e43 },
+  { 0x0006e, 0x00300, 0x001f9 },
+  { 0x0006e, 0x00301, 0x00144 },
+  { 0x0006e, 0x00303, 0x000f1 },
+  { 0x0006e, 0x00307, 0x01e45 },
+  { 0x0006e, 0x0030c, 0x00148 },
+  { 0x0006e, 0x00323, 0x01e47 },
+  { 0x0006e, 0x00327, 0x00146 },
+  { 0x0006e, 0x0032d, 0x01e4b },
+  { 0x0006e, 0x00331, 0x01e49 },
+  { 0x0006f, 0x00300, 0x000f2 },
+  { 0x0006f, 0x00301, 0x000f3 },
+  { 0x0006f, 0x00302, 0x000f4 },
+  { 0x0006f, 0x00303, 0x000f5 },
+  { 0x0006f, 0x00304, 0x0014d },
+  { 0x0006f, 0x00306, 0x0014f },
+  { 0x0006f, 0x00307, 0x0022f },
+  { 0x0006f, 0x00308, 0x000f6 },
+  { 0x0006f, 0x00309, 0x01ecf },
+  { 0x0006f, 0x0030b, 0x00151 },
+  { 0x0006f, 0x0030c, 0x001d2 },
+  { 0x0006f, 0x0030f, 0x0020d },
+  { 0x0006f, 0x00311, 0x0020f },
+  { 0x0006f, 0x0031b, 0x001a1 },
+  { 0x0006f, 0x00323, 0x01ecd },
+  { 0x0006f, 0x00328, 0x001eb },
+  { 0x00070, 0x00301, 0x01e55 },
+  { 0x00070, 0x00307, 0x01e57 },
+  { 0x00072, 0x00301, 0x00155 },
+  { 0x00072, 0x00307, 0x01e59 },
+  { 0x00072, 0x0030c, 0x00159 },
+  { 0x00072, 0x0030f, 0x00211 },
+  { 0x00072, 0x00311, 0x00213 },
+  { 0x00072, 0x00323, 0x01e5b },
+  { 0x00072, 0x00327, 0x00157 },
+  { 0x00072, 0x00331, 0x01e5f },
+  { 0x00073, 0x00301, 0x0015b },
+  { 0x00073, 0x00302, 0x0015d },
+  { 0x00073, 0x00307, 0x01e61 },
+  { 0x00073, 0x0030c, 0x00161 },
+  { 0x00073, 0x00323, 0x01e63 },
+  { 0x00073, 0x00326, 0x00219 },
+  { 0x00073, 0x00327, 0x0015f },
+  { 0x00074, 0x00307, 0x01e6b },
+  { 0x00074, 0x00308, 0x01e97 },
+  { 0x00074, 0x0030c, 0x00165 },
+  { 0x00074, 0x00323, 0x01e6d },
+  { 0x00074, 0x00326, 0x0021b },
+  { 0x00074, 0x00327, 0x00163 },
+  { 0x00074, 0x0032d, 0x01e71 },
+  { 0x00074, 0x00331, 0x01e6f },
+  { 0x00075, 0x00300, 0x000f9 },
+  { 0x00075, 0x00301, 0x000fa },
+  { 0x00075, 0x00302, 0x000fb },
+  { 0x00075, 0x00303, 0x00169 },
+  { 0x00075, 0x00304, 0x0016b },
+  { 0x00075, 0x00306, 0x0016d },
+  { 0x00075, 0x00308, 0x000fc },
+  { 0x00075, 0x00309, 0x01ee7 },
+  { 0x00075, 0x0030a, 0x0016f },
+  { 0x00075, 0x0030b, 0x00171 },
+  { 0x00075, 0x0030c, 0x001d4 },
+  { 0x00075, 0x0030f, 0x00215 },
+  { 0x00075, 0x00311, 0x00217 },
+  { 0x00075, 0x0031b, 0x001b0 },
+  { 0x00075, 0x00323, 0x01ee5 },
+  { 0x00075, 0x00324, 0x01e73 },
+  { 0x00075, 0x00328, 0x00173 },
+  { 0x00075, 0x0032d, 0x01e77 },
+  { 0x00075, 0x00330, 0x01e75 },
+  { 0x00076, 0x00303, 0x01e7d },
+  { 0x00076, 0x00323, 0x01e7f },
+  { 0x00077, 0x00300, 0x01e81 },
+  { 0x00077, 0x00301, 0x01e83 },
+  { 0x00077, 0x00302, 0x00175 },
+  { 0x00077, 0x00307, 0x01e87 },
+  { 0x00077, 0x00308, 0x01e85 },
+  { 0x00077, 0x0030a, 0x01e98 },
+  { 0x00077, 0x00323, 0x01e89 },
+  { 0x00078, 0x00307, 0x01e8b },
+  { 0x00078, 0x00308, 0x01e8d },
+  { 0x00079, 0x00300, 0x01ef3 },
+  { 0x00079, 0x00301, 0x000fd },
+  { 0x00079, 0x00302, 0x00177 },
+  { 0x00079, 0x00303, 0x01ef9 },
+  { 0x00079, 0x00304, 0x00233 },
+  { 0x00079, 0x00307, 0x01e8f },
+  { 0x00079, 0x00308, 0x000ff },
+  { 0x00079, 0x00309, 0x01ef7 },
+  { 0x00079, 0x0030a, 0x01e99 },
+  { 0x00079, 0x00323, 0x01ef5 },
+  { 0x0007a, 0x00301, 0x0017a },
+  { 0x0007a, 0x00302, 0x01e91 },
+  { 0x0007a, 0x00307, 0x0017c },
+  { 0x0007a, 0x0030c, 0x0017e },
+  { 0x0007a, 0x00323, 0x01e93 },
+  { 0x0007a, 0x00331, 0x01e95 },
+  { 0x000a8, 0x00300, 0x01fed },
+  { 0x000a8, 0x00301, 0x00385 },
+  { 0x000a8, 0x00342, 0x01fc1 },
+  { 0x000c2, 0x00300, 0x01ea6 },
+  { 0x000c2, 0x00301, 0x01ea4 },
+  { 0x000c2, 0x00303, 0x01eaa },
+  { 0x000c2, 0x00309, 0x01ea8 },
+  { 0x000c4, 0x00304, 0x001de },
+  { 0x000c5, 0x00301, 0x001fa },
+  { 0x000c6, 0x00301, 0x001fc },
+  { 0x000c6, 0x00304, 0x001e2 },
+  { 0x000c7, 0x00301, 0x01e08 },
+  { 0x000ca, 0x00300, 0x01ec0 },
+  { 0x000ca, 0x00301, 0x01ebe },
+  { 0x000ca, 0x00303, 0x01ec4 },
+  { 0x000ca, 0x00309, 0x01ec2 },
+  { 0x000cf, 0x00301, 0x01e2e },
+  { 0x000d4, 0x00300, 0x01ed2 },
+  { 0x000d4, 0x00301, 0x01ed0 },
+  { 0x000d4, 0x00303, 0x01ed6 },
+  { 0x000d4, 0x00309, 0x01ed4 },
+  { 0x000d5, 0x00301, 0x01e4c },
+  { 0x000d5, 0x00304, 0x0022c },
+  { 0x000d5, 0x00308, 0x01e4e },
+  { 0x000d6, 0x00304, 0x0022a },
+  { 0x000d8, 0x00301, 0x001fe },
+  { 0x000dc, 0x00300, 0x001db },
+  { 0x000dc, 0x00301, 0x001d7 },
+  { 0x000dc, 0x00304, 0x001d5 },
+  { 0x000dc, 0x0030c, 0x001d9 },
+  { 0x000e2, 0x00300, 0x01ea7 },
+  { 0x000e2, 0x00301, 0x01ea5 },
+  { 0x000e2, 0x00303, 0x01eab },
+  { 0x000e2, 0x00309, 0x01ea9 },
+  { 0x000e4, 0x00304, 0x001df },
+  { 0x000e5, 0x00301, 0x001fb },
+  { 0x000e6, 0x00301, 0x001fd },
+  { 0x000e6, 0x00304, 0x001e3 },
+  { 0x000e7, 0x00301, 0x01e09 },
+  { 0x000ea, 0x00300, 0x01ec1 },
+  { 0x000ea, 0x00301, 0x01ebf },
+  { 0x000ea, 0x00303, 0x01ec5 },
+  { 0x000ea, 0x00309, 0x01ec3 },
+  { 0x000ef, 0x00301, 0x01e2f },
+  { 0x000f4, 0x00300, 0x01ed3 },
+  { 0x000f4, 0x00301, 0x01ed1 },
+  { 0x000f4, 0x00303, 0x01ed7 },
+  { 0x000f4, 0x00309, 0x01ed5 },
+  { 0x000f5, 0x00301, 0x01e4d },
+  { 0x000f5, 0x00304, 0x0022d },
+  { 0x000f5, 0x00308, 0x01e4f },
+  { 0x000f6, 0x00304, 0x0022b },
+  { 0x000f8, 0x00301, 0x001ff },
+  { 0x000fc, 0x00300, 0x001dc },
+  { 0x000fc, 0x00301, 0x001d8 },
+  { 0x000fc, 0x00304, 0x001d6 },
+  { 0x000fc, 0x0030c, 0x001da },
+  { 0x00102, 0x00300, 0x01eb0 },
+  { 0x00102, 0x00301, 0x01eae },
+  { 0x00102, 0x00303, 0x01eb4 },
+  { 0x00102, 0x00309, 0x01eb2 },
+  { 0x00103, 0x00300, 0x01eb1 },
+  { 0x00103, 0x00301, 0x01eaf },
+  { 0x00103, 0x00303, 0x01eb5 },
+  { 0x00103, 0x00309, 0x01eb3 },
+  { 0x00112, 0x00300, 0x01e14 },
+  { 0x00112, 0x00301, 0x01e16 },
+  { 0x00113, 0x00300, 0x01e15 },
+  { 0x00113, 0x00301, 0x01e17 },
+  { 0x0014c, 0x00300, 0x01e50 },
+  { 0x0014c, 0x00301, 0x01e52 },
+  { 0x0014d, 0x00300, 0x01e51 },
+  { 0x0014d, 0x00301, 0x01e53 },
+  { 0x0015a, 0x00307, 0x01e64 },
+  { 0x0015b, 0x00307, 0x01e65 },
+  { 0x00160, 0x00307, 0x01e66 },
+  { 0x00161, 0x00307, 0x01e67 },
+  { 0x00168, 0x00301, 0x01e78 },
+  { 0x00169, 0x00301, 0x01e79 },
+  { 0x0016a, 0x00308, 0x01e7a },
+  { 0x0016b, 0x00308, 0x01e7b },
+  { 0x0017f, 0x00307, 0x01e9b },
+  { 0x001a0, 0x00300, 0x01edc },
+  { 0x001a0, 0x00301, 0x01eda },
+  { 0x001a0, 0x00303, 0x01ee0 },
+  { 0x001a0, 0x00309, 0x01ede },
+  { 0x001a0, 0x00323, 0x01ee2 },
+  { 0x001a1, 0x00300, 0x01edd },
+  { 0x001a1, 0x00301, 0x01edb },
+  { 0x001a1, 0x00303, 0x01ee1 },
+  { 0x001a1, 0x00309, 0x01edf },
+  { 0x001a1, 0x00323, 0x01ee3 },
+  { 0x001af, 0x00300, 0x01eea },
+  { 0x001af, 0x00301, 0x01ee8 },
+  { 0x001af, 0x00303, 0x01eee },
+  { 0x001af, 0x00309, 0x01eec },
+  { 0x001af, 0x00323, 0x01ef0 },
+  { 0x001b0, 0x00300, 0x01eeb },
+  { 0x001b0, 0x00301, 0x01ee9 },
+  { 0x001b0, 0x00303, 0x01eef },
+  { 0x001b0, 0x00309, 0x01eed },
+  { 0x001b0, 0x00323, 0x01ef1 },
+  { 0x001b7, 0x0030c, 0x001ee },
+  { 0x001ea, 0x00304, 0x001ec },
+  { 0x001eb, 0x00304, 0x001ed },
+  { 0x00226, 0x00304, 0x001e0 },
+  { 0x00227, 0x00304, 0x001e1 },
+  { 0x00228, 0x00306, 0x01e1c },
+  { 0x00229, 0x00306, 0x01e1d },
+  { 0x0022e, 0x00304, 0x00230 },
+  { 0x0022f, 0x00304, 0x00231 },
+  { 0x00292, 0x0030c, 0x001ef },
+  { 0x00391, 0x00300, 0x01fba },
+  { 0x00391, 0x00301, 0x00386 },
+  { 0x00391, 0x00304, 0x01fb9 },
+  { 0x00391, 0x00306, 0x01fb8 },
+  { 0x00391, 0x00313, 0x01f08 },
+  { 0x00391, 0x00314, 0x01f09 },
+  { 0x00391, 0x00345, 0x01fbc },
+  { 0x00395, 0x00300, 0x01fc8 },
+  { 0x00395, 0x00301, 0x00388 },
+  { 0x00395, 0x00313, 0x01f18 },
+  { 0x00395, 0x00314, 0x01f19 },
+  { 0x00397, 0x00300, 0x01fca },
+  { 0x00397, 0x00301, 0x00389 },
+  { 0x00397, 0x00313, 0x01f28 },
+  { 0x00397, 0x00314, 0x01f29 },
+  { 0x00397, 0x00345, 0x01fcc },
+  { 0x00399, 0x00300, 0x01fda },
+  { 0x00399, 0x00301, 0x0038a },
+  { 0x00399, 0x00304, 0x01fd9 },
+  { 0x00399, 0x00306, 0x01fd8 },
+  { 0x00399, 0x00308, 0x003aa },
+  { 0x00399, 0x00313, 0x01f38 },
+  { 0x00399, 0x00314, 0x01f39 },
+  { 0x0039f, 0x00300, 0x01ff8 },
+  { 0x0039f, 0x00301, 0x0038c },
+  { 0x0039f, 0x00313, 0x01f48 },
+  { 0x0039f, 0x00314, 0x01f49 },
+  { 0x003a1, 0x00314, 0x01fec },
+  { 0x003a5, 0x00300, 0x01fea },
+  { 0x003a5, 0x00301, 0x0038e },
+  { 0x003a5, 0x00304, 0x01fe9 },
+  { 0x003a5, 0x00306, 0x01fe8 },
+  { 0x003a5, 0x00308, 0x003ab },
+  { 0x003a5, 0x00314, 0x01f59 },
+  { 0x003a9, 0x00300, 0x01ffa },
+  { 0x003a9, 0x00301, 0x0038f },
+  { 0x003a9, 0x00313, 0x01f68 },
+  { 0x003a9, 0x00314, 0x01f69 },
+  { 0x003a9, 0x00345, 0x01ffc },
+  { 0x003ac, 0x00345, 0x01fb4 },
+  { 0x003ae, 0x00345, 0x01fc4 },
+  { 0x003b1, 0x00300, 0x01f70 },
+  { 0x003b1, 0x00301, 0x003ac },
+  { 0x003b1, 0x00304, 0x01fb1 },
+  { 0x003b1, 0x00306, 0x01fb0 },
+  { 0x003b1, 0x00313, 0x01f00 },
+  { 0x003b1, 0x00314, 0x01f01 },
+  { 0x003b1, 0x00342, 0x01fb6 },
+  { 0x003b1, 0x00345, 0x01fb3 },
+  { 0x003b5, 0x00300, 0x01f72 },
+  { 0x003b5, 0x00301, 0x003ad },
+  { 0x003b5, 0x00313, 0x01f10 },
+  { 0x003b5, 0x00314, 0x01f11 },
+  { 0x003b7, 0x00300, 0x01f74 },
+  { 0x003b7, 0x00301, 0x003ae },
+  { 0x003b7, 0x00313, 0x01f20 },
+  { 0x003b7, 0x00314, 0x01f21 },
+  { 0x003b7, 0x00342, 0x01fc6 },
+  { 0x003b7, 0x00345, 0x01fc3 },
+  { 0x003b9, 0x00300, 0x01f76 },
+  { 0x003b9, 0x00301, 0x003af },
+  { 0x003b9, 0x00304, 0x01fd1 },
+  { 0x003b9, 0x00306, 0x01fd0 },
+  { 0x003b9, 0x00308, 0x003ca },
+  { 0x003b9, 0x00313, 0x01f30 },
+  { 0x003b9, 0x00314, 0x01f31 },
+  { 0x003b9, 0x00342, 0x01fd6 },
+  { 0x003bf, 0x00300, 0x01f78 },
+  { 0x003bf, 0x00301, 0x003cc },
+  { 0x003bf, 0x00313, 0x01f40 },
+  { 0x003bf, 0x00314, 0x01f41 },
+  { 0x003c1, 0x00313, 0x01fe4 },
+  { 0x003c1, 0x00314, 0x01fe5 },
+  { 0x003c5, 0x00300, 0x01f7a },
+  { 0x003c5, 0x00301, 0x003cd },
+  { 0x003c5, 0x00304, 0x01fe1 },
+  { 0x003c5, 0x00306, 0x01fe0 },
+  { 0x003c5, 0x00308, 0x003cb },
+  { 0x003c5, 0x00313, 0x01f50 },
+  { 0x003c5, 0x00314, 0x01f51 },
+  { 0x003c5, 0x00342, 0x01fe6 },
+  { 0x003c9, 0x00300, 0x01f7c },
+  { 0x003c9, 0x00301, 0x003ce },
+  { 0x003c9, 0x00313, 0x01f60 },
+  { 0x003c9, 0x00314, 0x01f61 },
+  { 0x003c9, 0x00342, 0x01ff6 },
+  { 0x003c9, 0x00345, 0x01ff3 },
+  { 0x003ca, 0x00300, 0x01fd2 },
+  { 0x003ca, 0x00301, 0x00390 },
+  { 0x003ca, 0x00342, 0x01fd7 },
+  { 0x003cb, 0x00300, 0x01fe2 },
+  { 0x003cb, 0x00301, 0x003b0 },
+  { 0x003cb, 0x00342, 0x01fe7 },
+  { 0x003ce, 0x00345, 0x01ff4 },
+  { 0x003d2, 0x00301, 0x003d3 },
+  { 0x003d2, 0x00308, 0x003d4 },
+  { 0x00406, 0x00308, 0x00407 },
+  { 0x00410, 0x00306, 0x004d0 },
+  { 0x00410, 0x00308, 0x004d2 },
+  { 0x00413, 0x00301, 0x00403 },
+  { 0x00415, 0x00300, 0x00400 },
+  { 0x00415, 0x00306, 0x004d6 },
+  { 0x00415, 0x00308, 0x00401 },
+  { 0x00416, 0x00306, 0x004c1 },
+  { 0x00416, 0x00308, 0x004dc },
+  { 0x00417, 0x00308, 0x004de },
+  { 0x00418, 0x00300, 0x0040d },
+  { 0x00418, 0x00304, 0x004e2 },
+  { 0x00418, 0x00306, 0x00419 },
+  { 0x00418, 0x00308, 0x004e4 },
+  { 0x0041a, 0x00301, 0x0040c },
+  { 0x0041e, 0x00308, 0x004e6 },
+  { 0x00423, 0x00304, 0x004ee },
+  { 0x00423, 0x00306, 0x0040e },
+  { 0x00423, 0x00308, 0x004f0 },
+  { 0x00423, 0x0030b, 0x004f2 },
+  { 0x00427, 0x00308, 0x004f4 },
+  { 0x0042b, 0x00308, 0x004f8 },
+  { 0x0042d, 0x00308, 0x004ec },
+  { 0x00430, 0x00306, 0x004d1 },
+  { 0x00430, 0x00308, 0x004d3 },
+  { 0x00433, 0x00301, 0x00453 },
+  { 0x00435, 0x00300, 0x00450 },
+  { 0x00435, 0x00306, 0x004d7 },
+  { 0x00435, 0x00308, 0x00451 },
+  { 0x00436, 0x00306, 0x004c2 },
+  { 0x00436, 0x00308, 0x004dd },
+  { 0x00437, 0x00308, 0x004df },
+  { 0x00438, 0x00300, 0x0045d },
+  { 0x00438, 0x00304, 0x004e3 },
+  { 0x00438, 0x00306, 0x00439 },
+  { 0x00438, 0x00308, 0x004e5 },
+  { 0x0043a, 0x00301, 0x0045c },
+  { 0x0043e, 0x00308, 0x004e7 },
+  { 0x00443, 0x00304, 0x004ef },
+  { 0x00443, 0x00306, 0x0045e },
+  { 0x00443, 0x00308, 0x004f1 },
+  { 0x00443, 0x0030b, 0x004f3 },
+  { 0x00447, 0x00308, 0x004f5 },
+  { 0x0044b, 0x00308, 0x004f9 },
+  { 0x0044d, 0x00308, 0x004ed },
+  { 0x00456, 0x00308, 0x00457 },
+  { 0x00474, 0x0030f, 0x00476 },
+  { 0x00475, 0x0030f, 0x00477 },
+  { 0x004d8, 0x00308, 0x004da },
+  { 0x004d9, 0x00308, 0x004db },
+  { 0x004e8, 0x00308, 0x004ea },
+  { 0x004e9, 0x00308, 0x004eb },
+  { 0x00627, 0x00653, 0x00622 },
+  { 0x00627, 0x00654, 0x00623 },
+  { 0x00627, 0x00655, 0x00625 },
+  { 0x00648, 0x00654, 0x00624 },
+  { 0x0064a, 0x00654, 0x00626 },
+  { 0x006c1, 0x00654, 0x006c2 },
+  { 0x006d2, 0x00654, 0x006d3 },
+  { 0x006d5, 0x00654, 0x006c0 },
+  { 0x00928, 0x0093c, 0x00929 },
+  { 0x00930, 0x0093c, 0x00931 },
+  { 0x00933, 0x0093c, 0x00934 },
+  { 0x009c7, 0x009be, 0x009cb },
+  { 0x009c7, 0x009d7, 0x009cc },
+  { 0x00b47, 0x00b3e, 0x00b4b },
+  { 0x00b47, 0x00b56, 0x00b48 },
+  { 0x00b47, 0x00b57, 0x00b4c },
+  { 0x00b92, 0x00bd7, 0x00b94 },
+  { 0x00bc6, 0x00bbe, 0x00bca },
+  { 0x00bc6, 0x00bd7, 0x00bcc },
+  { 0x00bc7, 0x00bbe, 0x00bcb },
+  { 0x00c46, 0x00c56, 0x00c48 },
+  { 0x00cbf, 0x00cd5, 0x00cc0 },
+  { 0x00cc6, 0x00cc2, 0x00cca },
+  { 0x00cc6, 0x00cd5, 0x00cc7 },
+  { 0x00cc6, 0x00cd6, 0x00cc8 },
+  { 0x00cca, 0x00cd5, 0x00ccb },
+  { 0x00d46, 0x00d3e, 0x00d4a },
+  { 0x00d46, 0x00d57, 0x00d4c },
+  { 0x00d47, 0x00d3e, 0x00d4b },
+  { 0x00dd9, 0x00dca, 0x00dda },
+  { 0x00dd9, 0x00dcf, 0x00ddc },
+  { 0x00dd9, 0x00ddf, 0x00dde },
+  { 0x00ddc, 0x00dca, 0x00ddd },
+  { 0x01025, 0x0102e, 0x01026 },
+  { 0x01b05, 0x01b35, 0x01b06 },
+  { 0x01b07, 0x01b35, 0x01b08 },
+  { 0x01b09, 0x01b35, 0x01b0a },
+  { 0x01b0b, 0x01b35, 0x01b0c },
+  { 0x01b0d, 0x01b35, 0x01b0e },
+  { 0x01b11, 0x01b35, 0x01b12 },
+  { 0x01b3a, 0x01b35, 0x01b3b },
+  { 0x01b3c, 0x01b35, 0x01b3d },
+  { 0x01b3e, 0x01b35, 0x01b40 },
+  { 0x01b3f, 0x01b35, 0x01b41 },
+  { 0x01b42, 0x01b35, 0x01b43 },
+  { 0x01e36, 0x00304, 0x01e38 },
+  { 0x01e37, 0x00304, 0x01e39 },
+  { 0x01e5a, 0x00304, 0x01e5c },
+  { 0x01e5b, 0x00304, 0x01e5d },
+  { 0x01e62, 0x00307, 0x01e68 },
+  { 0x01e63, 0x00307, 0x01e69 },
+  { 0x01ea0, 0x00302, 0x01eac },
+  { 0x01ea0, 0x00306, 0x01eb6 },
+  { 0x01ea1, 0x00302, 0x01ead },
+  { 0x01ea1, 0x00306, 0x01eb7 },
+  { 0x01eb8, 0x00302, 0x01ec6 },
+  { 0x01eb9, 0x00302, 0x01ec7 },
+  { 0x01ecc, 0x00302, 0x01ed8 },
+  { 0x01ecd, 0x00302, 0x01ed9 },
+  { 0x01f00, 0x00300, 0x01f02 },
+  { 0x01f00, 0x00301, 0x01f04 },
+  { 0x01f00, 0x00342, 0x01f06 },
+  { 0x01f00, 0x00345, 0x01f80 },
+  { 0x01f01, 0x00300, 0x01f03 },
+  { 0x01f01, 0x00301, 0x01f05 },
+  { 0x01f01, 0x00342, 0x01f07 },
+  { 0x01f01, 0x00345, 0x01f81 },
+  { 0x01f02, 0x00345, 0x01f82 },
+  { 0x01f03, 0x00345, 0x01f83 },
+  { 0x01f04, 0x00345, 0x01f84 },
+  { 0x01f05, 0x00345, 0x01f85 },
+  { 0x01f06, 0x00345, 0x01f86 },
+  { 0x01f07, 0x00345, 0x01f87 },
+  { 0x01f08, 0x00300, 0x01f0a },
+  { 0x01f08, 0x00301, 0x01f0c },
+  { 0x01f08, 0x00342, 0x01f0e },
+  { 0x01f08, 0x00345, 0x01f88 },
+  { 0x01f09, 0x00300, 0x01f0b },
+  { 0x01f09, 0x00301, 0x01f0d },
+  { 0x01f09, 0x00342, 0x01f0f },
+  { 0x01f09, 0x00345, 0x01f89 },
+  { 0x01f0a, 0x00345, 0x01f8a },
+  { 0x01f0b, 0x00345, 0x01f8b },
+  { 0x01f0c, 0x00345, 0x01f8c },
+  { 0x01f0d, 0x00345, 0x01f8d },
+  { 0x01f0e, 0x00345, 0x01f8e },
+  { 0x01f0f, 0x00345, 0x01f8f },
+  { 0x01f10, 0x00300, 0x01f12 },
+  { 0x01f10, 0x00301, 0x01f14 },
+  { 0x01f11, 0x00300, 0x01f13 },
+  { 0x01f11, 0x00301, 0x01f15 },
+  { 0x01f18, 0x00300, 0x01f1a },
+  { 0x01f18, 0x00301, 0x01f1c },
+  { 0x01f19, 0x00300, 0x01f1b },
+  { 0x01f19, 0x00301, 0x01f1d },
+  { 0x01f20, 0x00300, 0x01f22 },
+  { 0x01f20, 0x00301, 0x01f24 },
+  { 0x01f20, 0x00342, 0x01f26 },
+  { 0x01f20, 0x00345, 0x01f90 },
+  { 0x01f21, 0x00300, 0x01f23 },
+  { 0x01f21, 0x00301, 0x01f25 },
+  { 0x01f21, 0x00342, 0x01f27 },
+  { 0x01f21, 0x00345, 0x01f91 },
+  { 0x01f22, 0x00345, 0x01f92 },
+  { 0x01f23, 0x00345, 0x01f93 },
+  { 0x01f24, 0x00345, 0x01f94 },
+  { 0x01f25, 0x00345, 0x01f95 },
+  { 0x01f26, 0x00345, 0x01f96 },
+  { 0x01f27, 0x00345, 0x01f97 },
+  { 0x01f28, 0x00300, 0x01f2a },
+  { 0x01f28, 0x00301, 0x01f2c },
+  { 0x01f28, 0x00342, 0x01f2e },
+  { 0x01f28, 0x00345, 0x01f98 },
+  { 0x01f29, 0x00300, 0x01f2b },
+  { 0x01f29, 0x00301, 0x01f2d },
+  { 0x01f29, 0x00342, 0x01f2f },
+  { 0x01f29, 0x00345, 0x01f99 },
+  { 0x01f2a, 0x00345, 0x01f9a },
+  { 0x01f2b, 0x00345, 0x01f9b },
+  { 0x01f2c, 0x00345, 0x01f9c },
+  { 0x01f2d, 0x00345, 0x01f9d },
+  { 0x01f2e, 0x00345, 0x01f9e },
+  { 0x01f2f, 0x00345, 0x01f9f },
+  { 0x01f30, 0x00300, 0x01f32 },
+  { 0x01f30, 0x00301, 0x01f34 },
+  { 0x01f30, 0x00342, 0x01f36 },
+  { 0x01f31, 0x00300, 0x01f33 },
+  { 0x01f31, 0x00301, 0x01f35 },
+  { 0x01f31, 0x00342, 0x01f37 },
+  { 0x01f38, 0x00300, 0x01f3a },
+  { 0x01f38, 0x00301, 0x01f3c },
+  { 0x01f38, 0x00342, 0x01f3e },
+  { 0x01f39, 0x00300, 0x01f3b },
+  { 0x01f39, 0x00301, 0x01f3d },
+  { 0x01f39, 0x00342, 0x01f3f },
+  { 0x01f40, 0x00300, 0x01f42 },
+  { 0x01f40, 0x00301, 0x01f44 },
+  { 0x01f41, 0x00300, 0x01f43 },
+  { 0x01f41, 0x00301, 0x01f45 },
+  { 0x01f48, 0x00300, 0x01f4a },
+  { 0x01f48, 0x00301, 0x01f4c },
+  { 0x01f49, 0x00300, 0x01f4b },
+  { 0x01f49, 0x00301, 0x01f4d },
+  { 0x01f50, 0x00300, 0x01f52 },
+  { 0x01f50, 0x00301, 0x01f54 },
+  { 0x01f50, 0x00342, 0x01f56 },
+  { 0x01f51, 0x00300, 0x01f53 },
+  { 0x01f51, 0x00301, 0x01f55 },
+  { 0x01f51, 0x00342, 0x01f57 },
+  { 0x01f59, 0x00300, 0x01f5b },
+  { 0x01f59, 0x00301, 0x01f5d },
+  { 0x01f59, 0x00342, 0x01f5f },
+  { 0x01f60, 0x00300, 0x01f62 },
+  { 0x01f60, 0x00301, 0x01f64 },
+  { 0x01f60, 0x00342, 0x01f66 },
+  { 0x01f60, 0x00345, 0x01fa0 },
+  { 0x01f61, 0x00300, 0x01f63 },
+  { 0x01f61, 0x00301, 0x01f65 },
+  { 0x01f61, 0x00342, 0x01f67 },
+  { 0x01f61, 0x00345, 0x01fa1 },
+  { 0x01f62, 0x00345, 0x01fa2 },
+  { 0x01f63, 0x00345, 0x01fa3 },
+  { 0x01f64, 0x00345, 0x01fa4 },
+  { 0x01f65, 0x00345, 0x01fa5 },
+  { 0x01f66, 0x00345, 0x01fa6 },
+  { 0x01f67, 0x00345, 0x01fa7 },
+  { 0x01f68, 0x00300, 0x01f6a },
+  { 0x01f68, 0x00301, 0x01f6c },
+  { 0x01f68, 0x00342, 0x01f6e },
+  { 0x01f68, 0x00345, 0x01fa8 },
+  { 0x01f69, 0x00300, 0x01f6b },
+  { 0x01f69, 0x00301, 0x01f6d },
+  { 0x01f69, 0x00342, 0x01f6f },
+  { 0x01f69, 0x00345, 0x01fa9 },
+  { 0x01f6a, 0x00345, 0x01faa },
+  { 0x01f6b, 0x00345, 0x01fab },
+  { 0x01f6c, 0x00345, 0x01fac },
+  { 0x01f6d, 0x00345, 0x01fad },
+  { 0x01f6e, 0x00345, 0x01fae },
+  { 0x01f6f, 0x00345, 0x01faf },
+  { 0x01f70, 0x00345, 0x01fb2 },
+  { 0x01f74, 0x00345, 0x01fc2 },
+  { 0x01f7c, 0x00345, 0x01ff2 },
+  { 0x01fb6, 0x00345, 0x01fb7 },
+  { 0x01fbf, 0x00300, 0x01fcd },
+  { 0x01fbf, 0x00301, 0x01fce },
+  { 0x01fbf, 0x00342, 0x01fcf },
+  { 0x01fc6, 0x00345, 0x01fc7 },
+  { 0x01ff6, 0x00345, 0x01ff7 },
+  { 0x01ffe, 0x00300, 0x01fdd },
+  { 0x01ffe, 0x00301, 0x01fde },
+  { 0x01ffe, 0x00342, 0x01fdf },
+  { 0x02190, 0x00338, 0x0219a },
+  { 0x02192, 0x00338, 0x0219b },
+  { 0x02194, 0x00338, 0x021ae },
+  { 0x021d0, 0x00338, 0x021cd },
+  { 0x021d2, 0x00338, 0x021cf },
+  { 0x021d4, 0x00338, 0x021ce },
+  { 0x02203, 0x00338, 0x02204 },
+  { 0x02208, 0x00338, 0x02209 },
+  { 0x0220b, 0x00338, 0x0220c },
+  { 0x02223, 0x00338, 0x02224 },
+  { 0x02225, 0x00338, 0x02226 },
+  { 0x0223c, 0x00338, 0x02241 },
+  { 0x02243, 0x00338, 0x02244 },
+  { 0x02245, 0x00338, 0x02247 },
+  { 0x02248, 0x00338, 0x02249 },
+  { 0x0224d, 0x00338, 0x0226d },
+  { 0x02261, 0x00338, 0x02262 },
+  { 0x02264, 0x00338, 0x02270 },
+  { 0x02265, 0x00338, 0x02271 },
+  { 0x02272, 0x00338, 0x02274 },
+  { 0x02273, 0x00338, 0x02275 },
+  { 0x02276, 0x00338, 0x02278 },
+  { 0x02277, 0x00338, 0x02279 },
+  { 0x0227a, 0x00338, 0x02280 },
+  { 0x0227b, 0x00338, 0x02281 },
+  { 0x0227c, 0x00338, 0x022e0 },
+  { 0x0227d, 0x00338, 0x022e1 },
+  { 0x02282, 0x00338, 0x02284 },
+  { 0x02283, 0x00338, 0x02285 },
+  { 0x02286, 0x00338, 0x02288 },
+  { 0x02287, 0x00338, 0x02289 },
+  { 0x02291, 0x00338, 0x022e2 },
+  { 0x02292, 0x00338, 0x022e3 },
+  { 0x022a2, 0x00338, 0x022ac },
+  { 0x022a8, 0x00338, 0x022ad },
+  { 0x022a9, 0x00338, 0x022ae },
+  { 0x022ab, 0x00338, 0x022af },
+  { 0x022b2, 0x00338, 0x022ea },
+  { 0x022b3, 0x00338, 0x022eb },
+  { 0x022b4, 0x00338, 0x022ec },
+  { 0x022b5, 0x00338, 0x022ed },
+  { 0x03046, 0x03099, 0x03094 },
+  { 0x0304b, 0x03099, 0x0304c },
+  { 0x0304d, 0x03099, 0x0304e },
+  { 0x0304f, 0x03099, 0x03050 },
+  { 0x03051, 0x03099, 0x03052 },
+  { 0x03053, 0x03099, 0x03054 },
+  { 0x03055, 0x03099, 0x03056 },
+  { 0x03057, 0x03099, 0x03058 },
+  { 0x03059, 0x03099, 0x0305a },
+  { 0x0305b, 0x03099, 0x0305c },
+  { 0x0305d, 0x03099, 0x0305e },
+  { 0x0305f, 0x03099, 0x03060 },
+  { 0x03061, 0x03099, 0x03062 },
+  { 0x03064, 0x03099, 0x03065 },
+  { 0x03066, 0x03099, 0x03067 },
+  { 0x03068, 0x03099, 0x03069 },
+  { 0x0306f, 0x03099, 0x03070 },
+  { 0x0306f, 0x0309a, 0x03071 },
+  { 0x03072, 0x03099, 0x03073 },
+  { 0x03072, 0x0309a, 0x03074 },
+  { 0x03075, 0x03099, 0x03076 },
+  { 0x03075, 0x0309a, 0x03077 },
+  { 0x03078, 0x03099, 0x03079 },
+  { 0x03078, 0x0309a, 0x0307a },
+  { 0x0307b, 0x03099, 0x0307c },
+  { 0x0307b, 0x0309a, 0x0307d },
+  { 0x0309d, 0x03099, 0x0309e },
+  { 0x030a6, 0x03099, 0x030f4 },
+  { 0x030ab, 0x03099, 0x030ac },
+  { 0x030ad, 0x03099, 0x030ae },
+  { 0x030af, 0x03099, 0x030b0 },
+  { 0x030b1, 0x03099, 0x030b2 },
+  { 0x030b3, 0x03099, 0x030b4 },
+  { 0x030b5, 0x03099, 0x030b6 },
+  { 0x030b7, 0x03099, 0x030b8 },
+  { 0x030b9, 0x03099, 0x030ba },
+  { 0x030bb, 0x03099, 0x030bc },
+  { 0x030bd, 0x03099, 0x030be },
+  { 0x030bf, 0x03099, 0x030c0 },
+  { 0x030c1, 0x03099, 0x030c2 },
+  { 0x030c4, 0x03099, 0x030c5 },
+  { 0x030c6, 0x03099, 0x030c7 },
+  { 0x030c8, 0x03099, 0x030c9 },
+  { 0x030cf, 0x03099, 0x030d0 },
+  { 0x030cf, 0x0309a, 0x030d1 },
+  { 0x030d2, 0x03099, 0x030d3 },
+  { 0x030d2, 0x0309a, 0x030d4 },
+  { 0x030d5, 0x03099, 0x030d6 },
+  { 0x030d5, 0x0309a, 0x030d7 },
+  { 0x030d8, 0x03099, 0x030d9 },
+  { 0x030d8, 0x0309a, 0x030da },
+  { 0x030db, 0x03099, 0x030dc },
+  { 0x030db, 0x0309a, 0x030dd },
+  { 0x030ef, 0x03099, 0x030f7 },
+  { 0x030f0, 0x03099, 0x030f8 },
+  { 0x030f1, 0x03099, 0x030f9 },
+  { 0x030f2, 0x03099, 0x030fa },
+  { 0x030fd, 0x03099, 0x030fe },
+  { 0x11099, 0x110ba, 0x1109a },
+  { 0x1109b, 0x110ba, 0x1109c },
+  { 0x110a5, 0x110ba, 0x110ab },
+  { 0x11131, 0x11127, 0x1112e },
+  { 0x11132, 0x11127, 0x1112f },
+  { 0x11347, 0x1133e, 0x1134b },
+  { 0x11347, 0x11357, 0x1134c },
+  { 0x114b9, 0x114b0, 0x114bc },
+  { 0x114b9, 0x114ba, 0x114bb },
+  { 0x114b9, 0x114bd, 0x114be },
+  { 0x115b8, 0x115af, 0x115ba },
+  { 0x115b9, 0x115af, 0x115bb },
+  { 0x11935, 0x11930, 0x11938 }
+};
+
+const uint16_t toke_unicode_fold_stage1[979] = {
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000a, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x000b, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x000c, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x000d, 0x0005, 0x0005,
+  0x000e, 0x000f, 0x0010, 0x0011, 0x0005, 0x0005, 0x0012, 0x0013, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0014, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0015, 0x0016, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0017, 0x0018, 0x0019, 0x001a,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x001b, 0x001c, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x001d, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x001e, 0x001f, 0x0020, 0x0021, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0022, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0023, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0024, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0025
+};
+
+const uint8_t toke_unicode_fold_stage2[4864] = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+  0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+  0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x00, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x00, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b,
+  0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x28, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x22,
+  0x00, 0x56, 0x3b, 0x00, 0x3b, 0x00, 0x53, 0x3b, 0x00, 0x52, 0x52, 0x3b, 0x00, 0x00, 0x4d, 0x50,
+  0x51, 0x3b, 0x00, 0x52, 0x54, 0x00, 0x57, 0x55, 0x3b, 0x00, 0x00, 0x00, 0x57, 0x58, 0x00, 0x59,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x5b, 0x3b, 0x00, 0x5b, 0x00, 0x00, 0x3b, 0x00, 0x5b, 0x3b,
+  0x00, 0x5a, 0x5a, 0x3b, 0x00, 0x3b, 0x00, 0x5c, 0x3b, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x3c, 0x3b, 0x00, 0x3c, 0x3b, 0x00, 0x3c, 0x3b, 0x00, 0x3b, 0x00, 0x3b,
+  0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x00, 0x3c, 0x3b, 0x00, 0x3b, 0x00, 0x2b, 0x31, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x25, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x24, 0x00, 0x00,
+  0x00, 0x3b, 0x00, 0x23, 0x4b, 0x4c, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x00, 0x44, 0x44, 0x44, 0x00, 0x4a, 0x00, 0x49, 0x49,
+  0x00, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+  0x42, 0x42, 0x00, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d,
+  0x34, 0x35, 0x00, 0x00, 0x00, 0x37, 0x36, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x32, 0x33, 0x00, 0x00, 0x2f, 0x2e, 0x00, 0x3b, 0x00, 0x3a, 0x3b, 0x00, 0x00, 0x25, 0x25, 0x25,
+  0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e,
+  0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+  0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3e, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x00, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+  0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+  0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f,
+  0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f,
+  0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x00, 0x00,
+  0x19, 0x1a, 0x1b, 0x1d, 0x1d, 0x1c, 0x1e, 0x1f, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21,
+  0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21,
+  0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x00, 0x00, 0x21, 0x21, 0x21,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x16, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x39, 0x00, 0x39, 0x00, 0x39,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x39, 0x2d, 0x2d, 0x38, 0x00, 0x18, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x2c, 0x2c, 0x2c, 0x38, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x39, 0x2a, 0x2a, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x39, 0x29, 0x29, 0x3a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x26, 0x27, 0x27, 0x38, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x14, 0x15, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+  0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+  0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x12, 0x20, 0x13, 0x00, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x10, 0x11, 0x0e,
+  0x0f, 0x00, 0x3b, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x0d,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x00,
+  0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x00, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x0c, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x07, 0x00, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x03, 0x01, 0x02, 0x05, 0x03, 0x00,
+  0x09, 0x06, 0x08, 0x5e, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00,
+  0x3b, 0x00, 0x3b, 0x00, 0x33, 0x04, 0x0b, 0x3b, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+  0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+  0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+  0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+  0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+  0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47,
+  0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47,
+  0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47,
+  0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47,
+  0x47, 0x47, 0x47, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x00, 0x46, 0x46, 0x46, 0x46,
+  0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x00, 0x46, 0x46, 0x46, 0x46,
+  0x46, 0x46, 0x46, 0x00, 0x46, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
+  0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
+  0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
+  0x4a, 0x4a, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+  0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+  0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+  0x43, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+const int32_t toke_unicode_fold_deltas[97] = {
+  0,
+  -42319,
+  -42315,
+  -42308,
+  -42307,
+  -42305,
+  -42282,
+  -42280,
+  -42261,
+  -42258,
+  -38864,
+  -35384,
+  -35332,
+  -10815,
+  -10783,
+  -10782,
+  -10780,
+  -10749,
+  -10743,
+  -10727,
+  -8383,
+  -8262,
+  -7615,
+  -7517,
+  -7173,
+  -6222,
+  -6221,
+  -6212,
+  -6211,
+  -6210,
+  -6204,
+  -6180,
+  -3814,
+  -3008,
+  -268,
+  -195,
+  -163,
+  -130,
+  -128,
+  -126,
+  -121,
+  -112,
+  -100,
+  -97,
+  -86,
+  -74,
+  -64,
+  -60,
+  -58,
+  -56,
+  -54,
+  -48,
+  -30,
+  -25,
+  -22,
+  -15,
+  -9,
+  -8,
+  -7,
+  1,
+  2,
+  8,
+  15,
+  16,
+  26,
+  28,
+  32,
+  34,
+  37,
+  38,
+  39,
+  40,
+  48,
+  63,
+  64,
+  69,
+  71,
+  79,
+  80,
+  116,
+  202,
+  203,
+  205,
+  206,
+  207,
+  209,
+  210,
+  211,
+  213,
+  214,
+  217,
+  218,
+  219,
+  775,
+  928,
+  7264,
+  35267
+};
+
+const uint8_t toke_unicode_fold_leads[32] = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xe3, 0x3f, 0x00, 0x06, 0x84, 0x01, 0x00
+};
+
+const struct toke_unicode_block_range toke_unicode_blocks[317] = {
+  { 0x00000, 0x0007f, "BASIC_LATIN" },
+  { 0x00080, 0x000ff, "LATIN_1_SUPPLEMENT" },
+  { 0x00100, 0x0017f, "LATIN_EXTENDED_A" },
+  { 0x00180, 0x0024f, "LATIN_EXTENDED_B" },
+  { 0x00250, 0x002af, "IPA_EXTENSIONS" },
+  { 0x002b0, 0x002ff, "SPACING_MODIFIER_LETTERS" },
+  { 0x00300, 0x0036f, "COMBINING_DIACRITICAL_MARKS" },
+  { 0x00370, 0x003ff, "GREEK_AND_COPTIC" },
+  { 0x00400, 0x004ff, "CYRILLIC" },
+  { 0x00500, 0x0052f, "CYRILLIC_SUPPLEMENT" },
+  { 0x00530, 0x0058f, "ARMENIAN" },
+  { 0x00590, 0x005ff, "HEBREW" },
+  { 0x00600, 0x006ff, "ARABIC" },
+  { 0x00700, 0x0074f, "SYRIAC" },
+  { 0x00750, 0x0077f, "ARABIC_SUPPLEMENT" },
+  { 0x00780, 0x007bf, "THAANA" },
+  { 0x007c0, 0x007ff, "NKO" },
+  { 0x00800, 0x0083f, "SAMARITAN" },
+  { 0x00840, 0x0085f, "MANDAIC" },
+  { 0x00860, 0x0086f, "SYRIAC_SUPPLEMENT" },
+  { 0x00870, 0x0089f, "ARABIC_EXTENDED_B" },
+  { 0x008a0, 0x008ff, "ARABIC_EXTENDED_A" },
+  { 0x00900, 0x0097f, "DEVANAGARI" },
+  { 0x00980, 0x009ff, "BENGALI" },
+  { 0x00a00, 0x00a7f, "GURMUKHI" },
+  { 0x00a80, 0x00aff, "GUJARATI" },
+  { 0x00b00, 0x00b7f, "ORIYA" },
+  { 0x00b80, 0x00bff, "TAMIL" },
+  { 0x00c00, 0x00c7f, "TELUGU" },
+  { 0x00c80, 0x00cff, "KANNADA" },
+  { 0x00d00, 0x00d7f, "MALAYALAM" },
+  { 0x00d80, 0x00dff, "SINHALA" },
+  { 0x00e00, 0x00e7f, "THAI" },
+  { 0x00e80, 0x00eff, "LAO" },
+  { 0x00f00, 0x00fff, "TIBETAN" },
+  { 0x01000, 0x0109f, "MYANMAR" },
+  { 0x010a0, 0x010ff, "GEORGIAN" },
+  { 0x01100, 0x011ff, "HANGUL_JAMO" },
+  { 0x01200, 0x0137f, "ETHIOPIC" },
+  { 0x01380, 0x0139f, "ETHIOPIC_SUPPLEMENT" },
+  { 0x013a0, 0x013ff, "CHEROKEE" },
+  { 0x01400, 0x0167f, "UNIFIED_CANADIAN_ABORIGINAL_SYLLABICS" },
+  { 0x01680, 0x0169f, "OGHAM" },
+  { 0x016a0, 0x016ff, "RUNIC" },
+  { 0x01700, 0x0171f, "TAGALOG" },
+  { 0x01720, 0x0173f, "HANUNOO" },
+  { 0x01740, 0x0175f, "BUHID" },
+  { 0x01760, 0x0177f, "TAGBANWA" },
+  { 0x01780, 0x017ff, "KHMER" },
+  { 0x01800, 0x018af, "MONGOLIAN" },
+  { 0x018b0, 0x018ff, "UNIFIED_CANADIAN_ABORIGINAL_SYLLABICS_EXTENDED" },
+  { 0x01900, 0x0194f, "LIMBU" },
+  { 0x01950, 0x0197f, "TAI_LE" },
+  { 0x01980, 0x019df, "NEW_TAI_LUE" },
+  { 0x019e0, 0x019ff, "KHMER_SYMBOLS" },
+  { 0x01a00, 0x01a1f, "BUGINESE" },
+  { 0x01a20, 0x01aaf, "TAI_THAM" },
+  { 0x01ab0, 0x01aff, "COMBINING_DIACRITICAL_MARKS_EXTENDED" },
+  { 0x01b00, 0x01b7f, "BALINESE" },
+  { 0x01b80, 0x01bbf, "SUNDANESE" },
+  { 0x01bc0, 0x01bff, "BATAK" },
+  { 0x01c00, 0x01c4f, "LEPCHA" },
+  { 0x01c50, 0x01c7f, "OL_CHIKI" },
+  { 0x01c80, 0x01c8f, "CYRILLIC_EXTENDED_C" },
+  { 0x01c90, 0x01cbf, "GEORGIAN_EXTENDED" },
+  { 0x01cc0, 0x01ccf, "SUNDANESE_SUPPLEMENT" },
+  { 0x01cd0, 0x01cff, "VEDIC_EXTENSIONS" },
+  { 0x01d00, 0x01d7f, "PHONETIC_EXTENSIONS" },
+  { 0x01d80, 0x01dbf, "PHONETIC_EXTENSIONS_SUPPLEMENT" },
+  { 0x01dc0, 0x01dff, "COMBINING_DIACRITICAL_MARKS_SUPPLEMENT" },
+  { 0x01e00, 0x01eff, "LATIN_EXTENDED_ADDITIONAL" },
+  { 0x01f00, 0x01fff, "GREEK_EXTENDED" },
+  { 0x02000, 0x0206f, "GENERAL_PUNCTUATION" },
+  { 0x02070, 0x0209f, "SUPERSCRIPTS_AND_SUBSCRIPTS" },
+  { 0x020a0, 0x020cf, "CURRENCY_SYMBOLS" },
+  { 0x020d0, 0x020ff, "COMBINING_DIACRITICAL_MARKS_FOR_SYMBOLS" },
+  { 0x02100, 0x0214f, "LETTERLIKE_SYMBOLS" },
+  { 0x02150, 0x0218f, "NUMBER_FORMS" },
+  { 0x02190, 0x021ff, "ARROWS" },
+  { 0x02200, 0x022ff, "MATHEMATICAL_OPERATORS" },
+  { 0x02300, 0x023ff, "MISCELLANEOUS_TECHNICAL" },
+  { 0x02400, 0x0243f, "CONTROL_PICTURES" },
+  { 0x02440, 0x0245f, "OPTICAL_CHARACTER_RECOGNITION" },
+  { 0x02460, 0x024ff, "ENCLOSED_ALPHANUMERICS" },
+  { 0x02500, 0x0257f, "BOX_DRAWING" },
+  { 0x02580, 0x0259f, "BLOCK_ELEMENTS" },
+  { 0x025a0, 0x025ff, "GEOMETRIC_SHAPES" },
+  { 0x02600, 0x026ff, "MISCELLANEOUS_SYMBOLS" },
+  { 0x02700, 0x027bf, "DINGBATS" },
+  { 0x027c0, 0x027ef, "MISCELLANEOUS_MATHEMATICAL_SYMBOLS_A" },
+  { 0x027f0, 0x027ff, "SUPPLEMENTAL_ARROWS_A" },
+  { 0x02800, 0x028ff, "BRAILLE_PATTERNS" },
+  { 0x02900, 0x0297f, "SUPPLEMENTAL_ARROWS_B" },
+  { 0x02980, 0x029ff, "MISCELLANEOUS_MATHEMATICAL_SYMBOLS_B" },
+  { 0x02a00, 0x02aff, "SUPPLEMENTAL_MATHEMATICAL_OPERATORS" },
+  { 0x02b00, 0x02bff, "MISCELLANEOUS_SYMBOLS_AND_ARROWS" },
+  { 0x02c00, 0x02c5f, "GLAGOLITIC" },
+  { 0x02c60, 0x02c7f, "LATIN_EXTENDED_C" },
+  { 0x02c80, 0x02cff, "COPTIC" },
+  { 0x02d00, 0x02d2f, "GEORGIAN_SUPPLEMENT" },
+  { 0x02d30, 0x02d7f, "TIFINAGH" },
+  { 0x02d80, 0x02ddf, "ETHIOPIC_EXTENDED" },
+  { 0x02de0, 0x02dff, "CYRILLIC_EXTENDED_A" },
+  { 0x02e00, 0x02e7f, "SUPPLEMENTAL_PUNCTUATION" },
+  { 0x02e80, 0x02eff, "CJK_RADICALS_SUPPLEMENT" },
+  { 0x02f00, 0x02fdf, "KANGXI_RADICALS" },
+  { 0x02ff0, 0x02fff, "IDEOGRAPHIC_DESCRIPTION_CHARACTERS" },
+  { 0x03000, 0x0303f, "CJK_SYMBOLS_AND_PUNCTUATION" },
+  { 0x03040, 0x0309f, "HIRAGANA" },
+  { 0x030a0, 0x030ff, "KATAKANA" },
+  { 0x03100, 0x0312f, "BOPOMOFO" },
+  { 0x03130, 0x0318f, "HANGUL_COMPATIBILITY_JAMO" },
+  { 0x03190, 0x0319f, "KANBUN" },
+  { 0x031a0, 0x031bf, "BOPOMOFO_EXTENDED" },
+  { 0x031c0, 0x031ef, "CJK_STROKES" },
+  { 0x031f0, 0x031ff, "KATAKANA_PHONETIC_EXTENSIONS" },
+  { 0x03200, 0x032ff, "ENCLOSED_CJK_LETTERS_AND_MONTHS" },
+  { 0x03300, 0x033ff, "CJK_COMPATIBILITY" },
+  { 0x03400, 0x04dbf, "CJK_UNIFIED_IDEOGRAPHS_EXTENSION_A" },
+  { 0x04dc0, 0x04dff, "YIJING_HEXAGRAM_SYMBOLS" },
+  { 0x04e00, 0x09fff, "CJK_UNIFIED_IDEOGRAPHS" },
+  { 0x0a000, 0x0a48f, "YI_SYLLABLES" },
+  { 0x0a490, 0x0a4cf, "YI_RADICALS" },
+  { 0x0a4d0, 0x0a4ff, "LISU" },
+  { 0x0a500, 0x0a63f, "VAI" },
+  { 0x0a640, 0x0a69f, "CYRILLIC_EXTENDED_B" },
+  { 0x0a6a0, 0x0a6ff, "BAMUM" },
+  { 0x0a700, 0x0a71f, "MODIFIER_TONE_LETTERS" },
+  { 0x0a720, 0x0a7ff, "LATIN_EXTENDED_D" },
+  { 0x0a800, 0x0a82f, "SYLOTI_NAGRI" },
+  { 0x0a830, 0x0a83f, "COMMON_INDIC_NUMBER_FORMS" },
+  { 0x0a840, 0x0a87f, "PHAGS_PA" },
+  { 0x0a880, 0x0a8df, "SAURASHTRA" },
+  { 0x0a8e0, 0x0a8ff, "DEVANAGARI_EXTENDED" },
+  { 0x0a900, 0x0a92f, "KAYAH_LI" },
+  { 0x0a930, 0x0a95f, "REJANG" },
+  { 0x0a960, 0x0a97f, "HANGUL_JAMO_EXTENDED_A" },
+  { 0x0a980, 0x0a9df, "JAVANESE" },
+  { 0x0a9e0, 0x0a9ff, "MYANMAR_EXTENDED_B" },
+  { 0x0aa00, 0x0aa5f, "CHAM" },
+  { 0x0aa60, 0x0aa7f, "MYANMAR_EXTENDED_A" },
+  { 0x0aa80, 0x0aadf, "TAI_VIET" },
+  { 0x0aae0, 0x0aaff, "MEETEI_MAYEK_EXTENSIONS" },
+  { 0x0ab00, 0x0ab2f, "ETHIOPIC_EXTENDED_A" },
+  { 0x0ab30, 0x0ab6f, "LATIN_EXTENDED_E" },
+  { 0x0ab70, 0x0abbf, "CHEROKEE_SUPPLEMENT" },
+  { 0x0abc0, 0x0abff, "MEETEI_MAYEK" },
+  { 0x0ac00, 0x0d7af, "HANGUL_SYLLABLES" },
+  { 0x0d7b0, 0x0d7ff, "HANGUL_JAMO_EXTENDED_B" },
+  { 0x0e000, 0x0f8ff, "PRIVATE_USE_AREA" },
+  { 0x0f900, 0x0faff, "CJK_COMPATIBILITY_IDEOGRAPHS" },
+  { 0x0fb00, 0x0fb4f, "ALPHABETIC_PRESENTATION_FORMS" },
+  { 0x0fb50, 0x0fdff, "ARABIC_PRESENTATION_FORMS_A" },
+  { 0x0fe00, 0x0fe0f, "VARIATION_SELECTORS" },
+  { 0x0fe10, 0x0fe1f, "VERTICAL_FORMS" },
+  { 0x0fe20, 0x0fe2f, "COMBINING_HALF_MARKS" },
+  { 0x0fe30, 0x0fe4f, "CJK_COMPATIBILITY_FORMS" },
+  { 0x0fe50, 0x0fe6f, "SMALL_FORM_VARIANTS" },
+  { 0x0fe70, 0x0feff, "ARABIC_PRESENTATION_FORMS_B" },
+  { 0x0ff00, 0x0ffef, "HALFWIDTH_AND_FULLWIDTH_FORMS" },
+  { 0x0fff0, 0x0ffff, "SPECIALS" },
+  { 0x10000, 0x1007f, "LINEAR_B_SYLLABARY" },
+  { 0x10080, 0x100ff, "LINEAR_B_IDEOGRAMS" },
+  { 0x10100, 0x1013f, "AEGEAN_NUMBERS" },
+  { 0x10140, 0x1018f, "ANCIENT_GREEK_NUMBERS" },
+  { 0x10190, 0x101cf, "ANCIENT_SYMBOLS" },
+  { 0x101d0, 0x101ff, "PHAISTOS_DISC" },
+  { 0x10280, 0x1029f, "LYCIAN" },
+  { 0x102a0, 0x102df, "CARIAN" },
+  { 0x102e0, 0x102ff, "COPTIC_EPACT_NUMBERS" },
+  { 0x10300, 0x1032f, "OLD_ITALIC" },
+  { 0x10330, 0x1034f, "GOTHIC" },
+  { 0x10350, 0x1037f, "OLD_PERMIC" },
+  { 0x10380, 0x1039f, "UGARITIC" },
+  { 0x103a0, 0x103df, "OLD_PERSIAN" },
+  { 0x10400, 0x1044f, "DESERET" },
+  { 0x10450, 0x1047f, "SHAVIAN" },
+  { 0x10480, 0x104af, "OSMANYA" },
+  { 0x104b0, 0x104ff, "OSAGE" },
+  { 0x10500, 0x1052f, "ELBASAN" },
+  { 0x10530, 0x1056f, "CAUCASIAN_ALBANIAN" },
+  { 0x10570, 0x105bf, "VITHKUQI" },
+  { 0x10600, 0x1077f, "LINEAR_A" },
+  { 0x10780, 0x107bf, "LATIN_EXTENDED_F" },
+  { 0x10800, 0x1083f, "CYPRIOT_SYLLABARY" },
+  { 0x10840, 0x1085f, "IMPERIAL_ARAMAIC" },
+  { 0x10860, 0x1087f, "PALMYRENE" },
+  { 0x10880, 0x108af, "NABATAEAN" },
+  { 0x108e0, 0x108ff, "HATRAN" },
+  { 0x10900, 0x1091f, "PHOENICIAN" },
+  { 0x10920, 0x1093f, "LYDIAN" },
+  { 0x10980, 0x1099f, "MEROITIC_HIEROGLYPHS" },
+  { 0x109a0, 0x109ff, "MEROITIC_CURSIVE" },
+  { 0x10a00, 0x10a5f, "KHAROSHTHI" },
+  { 0x10a60, 0x10a7f, "OLD_SOUTH_ARABIAN" },
+  { 0x10a80, 0x10a9f, "OLD_NORTH_ARABIAN" },
+  { 0x10ac0, 0x10aff, "MANICHAEAN" },
+  { 0x10b00, 0x10b3f, "AVESTAN" },
+  { 0x10b40, 0x10b5f, "INSCRIPTIONAL_PARTHIAN" },
+  { 0x10b60, 0x10b7f, "INSCRIPTIONAL_PAHLAVI" },
+  { 0x10b80, 0x10baf, "PSALTER_PAHLAVI" },
+  { 0x10c00, 0x10c4f, "OLD_TURKIC" },
+  { 0x10c80, 0x10cff, "OLD_HUNGARIAN" },
+  { 0x10d00, 0x10d3f, "HANIFI_ROHINGYA" },
+  { 0x10e60, 0x10e7f, "RUMI_NUMERAL_SYMBOLS" },
+  { 0x10e80, 0x10ebf, "YEZIDI" },
+  { 0x10f00, 0x10f2f, "OLD_SOGDIAN" },
+  { 0x10f30, 0x10f6f, "SOGDIAN" },
+  { 0x10f70, 0x10faf, "OLD_UYGHUR" },
+  { 0x10fb0, 0x10fdf, "CHORASMIAN" },
+  { 0x10fe0, 0x10fff, "ELYMAIC" },
+  { 0x11000, 0x1107f, "BRAHMI" },
+  { 0x11080, 0x110cf, "KAITHI" },
+  { 0x110d0, 0x110ff, "SORA_SOMPENG" },
+  { 0x11100, 0x1114f, "CHAKMA" },
+  { 0x11150, 0x1117f, "MAHAJANI" },
+  { 0x11180, 0x111df, "SHARADA" },
+  { 0x111e0, 0x111ff, "SINHALA_ARCHAIC_NUMBERS" },
+  { 0x11200, 0x1124f, "KHOJKI" },
+  { 0x11280, 0x112af, "MULTANI" },
+  { 0x112b0, 0x112ff, "KHUDAWADI" },
+  { 0x11300, 0x1137f, "GRANTHA" },
+  { 0x11400, 0x1147f, "NEWA" },
+  { 0x11480, 0x114df, "TIRHUTA" },
+  { 0x11580, 0x115ff, "SIDDHAM" },
+  { 0x11600, 0x1165f, "MODI" },
+  { 0x11660, 0x1167f, "MONGOLIAN_SUPPLEMENT" },
+  { 0x11680, 0x116cf, "TAKRI" },
+  { 0x11700, 0x1174f, "AHOM" },
+  { 0x11800, 0x1184f, "DOGRA" },
+  { 0x118a0, 0x118ff, "WARANG_CITI" },
+  { 0x11900, 0x1195f, "DIVES_AKURU" },
+  { 0x119a0, 0x119ff, "NANDINAGARI" },
+  { 0x11a00, 0x11a4f, "ZANABAZAR_SQUARE" },
+  { 0x11a50, 0x11aaf, "SOYOMBO" },
+  { 0x11ab0, 0x11abf, "UNIFIED_CANADIAN_ABORIGINAL_SYLLABICS_EXTENDED_A" },
+  { 0x11ac0, 0x11aff, "PAU_CIN_HAU" },
+  { 0x11c00, 0x11c6f, "BHAIKSUKI" },
+  { 0x11c70, 0x11cbf, "MARCHEN" },
+  { 0x11d00, 0x11d5f, "MASARAM_GONDI" },
+  { 0x11d60, 0x11daf, "GUNJALA_GONDI" },
+  { 0x11ee0, 0x11eff, "MAKASAR" },
+  { 0x11fb0, 0x11fbf, "LISU_SUPPLEMENT" },
+  { 0x11fc0, 0x11fff, "TAMIL_SUPPLEMENT" },
+  { 0x12000, 0x123ff, "CUNEIFORM" },
+  { 0x12400, 0x1247f, "CUNEIFORM_NUMBERS_AND_PUNCTUATION" },
+  { 0x12480, 0x1254f, "EARLY_DYNASTIC_CUNEIFORM" },
+  { 0x12f90, 0x12fff, "CYPRO_MINOAN" },
+  { 0x13000, 0x1342f, "EGYPTIAN_HIEROGLYPHS" },
+  { 0x13430, 0x1343f, "EGYPTIAN_HIEROGLYPH_FORMAT_CONTROLS" },
+  { 0x14400, 0x1467f, "ANATOLIAN_HIEROGLYPHS" },
+  { 0x16800, 0x16a3f, "BAMUM_SUPPLEMENT" },
+  { 0x16a40, 0x16a6f, "MRO" },
+  { 0x16a70, 0x16acf, "TANGSA" },
+  { 0x16ad0, 0x16aff, "BASSA_VAH" },
+  { 0x16b00, 0x16b8f, "PAHAWH_HMONG" },
+  { 0x16e40, 0x16e9f, "MEDEFAIDRIN" },
+  { 0x16f00, 0x16f9f, "MIAO" },
+  { 0x16fe0, 0x16fff, "IDEOGRAPHIC_SYMBOLS_AND_PUNCTUATION" },
+  { 0x17000, 0x187ff, "TANGUT" },
+  { 0x18800, 0x18aff, "TANGUT_COMPONENTS" },
+  { 0x18b00, 0x18cff, "KHITAN_SMALL_SCRIPT" },
+  { 0x18d00, 0x18d7f, "TANGUT_SUPPLEMENT" },
+  { 0x1aff0, 0x1afff, "KANA_EXTENDED_B" },
+  { 0x1b000, 0x1b0ff, "KANA_SUPPLEMENT" },
+  { 0x1b100, 0x1b12f, "KANA_EXTENDED_A" },
+  { 0x1b130, 0x1b16f, "SMALL_KANA_EXTENSION" },
+  { 0x1b170, 0x1b2ff, "NUSHU" },
+  { 0x1bc00, 0x1bc9f, "DUPLOYAN" },
+  { 0x1bca0, 0x1bcaf, "SHORTHAND_FORMAT_CONTROLS" },
+  { 0x1cf00, 0x1cfcf, "ZNAMENNY_MUSICAL_NOTATION" },
+  { 0x1d000, 0x1d0ff, "BYZANTINE_MUSICAL_SYMBOLS" },
+  { 0x1d100, 0x1d1ff, "MUSICAL_SYMBOLS" },
+  { 0x1d200, 0x1d24f, "ANCIENT_GREEK_MUSICAL_NOTATION" },
+  { 0x1d2e0, 0x1d2ff, "MAYAN_NUMERALS" },
+  { 0x1d300, 0x1d35f, "TAI_XUAN_JING_SYMBOLS" },
+  { 0x1d360, 0x1d37f, "COUNTING_ROD_NUMERALS" },
+  { 0x1d400, 0x1d7ff, "MATHEMATICAL_ALPHANUMERIC_SYMBOLS" },
+  { 0x1d800, 0x1daaf, "SUTTON_SIGNWRITING" },
+  { 0x1df00, 0x1dfff, "LATIN_EXTENDED_G" },
+  { 0x1e000, 0x1e02f, "GLAGOLITIC_SUPPLEMENT" },
+  { 0x1e100, 0x1e14f, "NYIAKENG_PUACHUE_HMONG" },
+  { 0x1e290, 0x1e2bf, "TOTO" },
+  { 0x1e2c0, 0x1e2ff, "WANCHO" },
+  { 0x1e7e0, 0x1e7ff, "ETHIOPIC_EXTENDED_B" },
+  { 0x1e800, 0x1e8df, "MENDE_KIKAKUI" },
+  { 0x1e900, 0x1e95f, "ADLAM" },
+  { 0x1ec70, 0x1ecbf, "INDIC_SIYAQ_NUMBERS" },
+  { 0x1ed00, 0x1ed4f, "OTTOMAN_SIYAQ_NUMBERS" },
+  { 0x1ee00, 0x1eeff, "ARABIC_MATHEMATICAL_ALPHABETIC_SYMBOLS" },
+  { 0x1f000, 0x1f02f, "MAHJONG_TILES" },
+  { 0x1f030, 0x1f09f, "DOMINO_TILES" },
+  { 0x1f0a0, 0x1f0ff, "PLAYING_CARDS" },
+  { 0x1f100, 0x1f1ff, "ENCLOSED_ALPHANUMERIC_SUPPLEMENT" },
+  { 0x1f200, 0x1f2ff, "ENCLOSED_IDEOGRAPHIC_SUPPLEMENT" },
+  { 0x1f300, 0x1f5ff, "MISCELLANEOUS_SYMBOLS_AND_PICTOGRAPHS" },
+  { 0x1f600, 0x1f64f, "EMOTICONS" },
+  { 0x1f650, 0x1f67f, "ORNAMENTAL_DINGBATS" },
+  { 0x1f680, 0x1f6ff, "TRANSPORT_AND_MAP_SYMBOLS" },
+  { 0x1f700, 0x1f77f, "ALCHEMICAL_SYMBOLS" },
+  { 0x1f780, 0x1f7ff, "GEOMETRIC_SHAPES_EXTENDED" },
+  { 0x1f800, 0x1f8ff, "SUPPLEMENTAL_ARROWS_C" },
+  { 0x1f900, 0x1f9ff, "SUPPLEMENTAL_SYMBOLS_AND_PICTOGRAPHS" },
+  { 0x1fa00, 0x1fa6f, "CHESS_SYMBOLS" },
+  { 0x1fa70, 0x1faff, "SYMBOLS_AND_PICTOGRAPHS_EXTENDED_A" },
+  { 0x1fb00, 0x1fbff, "SYMBOLS_FOR_LEGACY_COMPUTING" },
+  { 0x20000, 0x2a6df, "CJK_UNIFIED_IDEOGRAPHS_EXTENSION_B" },
+  { 0x2a700, 0x2b73f, "CJK_UNIFIED_IDEOGRAPHS_EXTENSION_C" },
+  { 0x2b740, 0x2b81f, "CJK_UNIFIED_IDEOGRAPHS_EXTENSION_D" },
+  { 0x2b820, 0x2ceaf, "CJK_UNIFIED_IDEOGRAPHS_EXTENSION_E" },
+  { 0x2ceb0, 0x2ebef, "CJK_UNIFIED_IDEOGRAPHS_EXTENSION_F" },
+  { 0x2f800, 0x2fa1f, "CJK_COMPATIBILITY_IDEOGRAPHS_SUPPLEMENT" },
+  { 0x30000, 0x3134f, "CJK_UNIFIED_IDEOGRAPHS_EXTENSION_G" },
+  { 0xe0000, 0xe007f, "TAGS" },
+  { 0xe0100, 0xe01ef, "VARIATION_SELECTORS_SUPPLEMENT" },
+  { 0xf0000, 0xfffff, "SUPPLEMENTARY_PRIVATE_USE_AREA_A" },
+  { 0x100000, 0x10ffff, "SUPPLEMENTARY_PRIVATE_USE_AREA_B" }
+};
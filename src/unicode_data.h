@@ -0,0 +1,141 @@
+/* Generated by scripts/generate_unicode_tables.py from Unicode 14.0.0. Do not edit. */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define TOKE_UNICODE_VERSION "14.0.0"
+
+/**
+ * @brief Property bits of each codepoint, found with @ref toke_unicode_props.
+ * */
+#define TOKE_UNICODE_CCC_MASK 0x00ff
+#define TOKE_UNICODE_NFC_QC_NO 0x0100
+#define TOKE_UNICODE_NFC_QC_MAYBE 0x0200
+#define TOKE_UNICODE_NFKC_QC_NO 0x0400
+#define TOKE_UNICODE_NFKC_QC_MAYBE 0x0800
+#define TOKE_UNICODE_HAS_CANONICAL 0x1000
+#define TOKE_UNICODE_HAS_COMPAT 0x2000
+
+#define TOKE_UNICODE_PROPS_SHIFT 5
+
+/**
+ * @brief The most that normalizing can multiply the UTF-8 length of a text by.
+ * */
+#define TOKE_UNICODE_NFC_MAX_EXPANSION 3
+#define TOKE_UNICODE_NFKC_MAX_EXPANSION 11
+
+/**
+ * @brief Codepoints at and above this have no properties.
+ * */
+#define TOKE_UNICODE_PROPS_LIMIT 0x2fa20
+
+struct toke_decomposition
+{
+  uint32_t codepoint;
+
+  uint16_t canonical_offset;
+
+  uint8_t canonical_size;
+
+  uint8_t compat_size;
+
+  uint16_t compat_offset;
+};
+
+struct toke_unicode_block_range
+{
+  uint32_t first;
+
+  uint32_t last;
+
+  const char* name;
+};
+
+struct toke_composition
+{
+  uint32_t first;
+
+  uint32_t second;
+
+  uint32_t composite;
+};
+
+#define TOKE_UNICODE_FOLD_SHIFT 7
+
+/**
+ * @brief Codepoints at and above this have no case folding.
+ * */
+#define TOKE_UNICODE_FOLD_LIMIT 0x1e980
+
+extern const uint16_t toke_unicode_props_stage1[6097];
+
+extern const uint16_t toke_unicode_props_stage2[8928];
+
+/**
+ * @brief Full canonical and compatibility decompositions, sorted by codepoint. Hangul syllables are decomposed
+ *        algorithmically and are not listed.
+ * */
+extern const struct toke_decomposition toke_unicode_decompositions[5795];
+
+#define TOKE_UNICODE_DECOMPOSITION_COUNT 5795
+
+extern const uint32_t toke_unicode_decomposition_pool[9079];
+
+/**
+ * @brief Primary composites, sorted by their first and second codepoints.
+ * */
+extern const struct toke_composition toke_unicode_compositions[941];
+
+#define TOKE_UNICODE_COMPOSITION_COUNT 941
+
+extern const uint16_t toke_unicode_fold_stage1[979];
+
+/**
+ * @brief Indices into @ref toke_unicode_fold_deltas. Index zero is the empty delta.
+ * */
+extern const uint8_t toke_unicode_fold_stage2[4864];
+
+extern const int32_t toke_unicode_fold_deltas[97];
+
+/**
+ * @brief A bit for each byte that leads the UTF-8 form of a codepoint with a case folding.
+ * */
+extern const uint8_t toke_unicode_fold_leads[32];
+
+/**
+ * @brief The codepoints and name of each @ref toke_unicode_block, indexed by the block.
+ * */
+extern const struct toke_unicode_block_range toke_unicode_blocks[317];
+
+static inline uint16_t
+toke_unicode_props(const uint32_t codepoint)
+{
+  if (codepoint >= TOKE_UNICODE_PROPS_LIMIT) {
+    return 0;
+  }
+
+  const uint32_t block = toke_unicode_props_stage1[codepoint >> TOKE_UNICODE_PROPS_SHIFT];
+
+  return toke_unicode_props_stage2[(block << TOKE_UNICODE_PROPS_SHIFT) |
+                                   (codepoint & ((1u << TOKE_UNICODE_PROPS_SHIFT) - 1))];
+}
+
+/**
+ * @brief Gets the simple case folding of a codepoint, which is never longer in UTF-8 than the codepoint itself.
+ * */
+static inline uint32_t
+toke_unicode_fold(const uint32_t codepoint)
+{
+  if (codepoint >= TOKE_UNICODE_FOLD_LIMIT) {
+    return codepoint;
+  }
+
+  const uint32_t block = toke_unicode_fold_stage1[codepoint >> TOKE_UNICODE_FOLD_SHIFT];
+
+  const uint8_t index =
+    toke_unicode_fold_stage2[(block << TOKE_UNICODE_FOLD_SHIFT) | (codepoint & ((1u << TOKE_UNICODE_FOLD_SHIFT) - 1))];
+
+  return (uint32_t)((int32_t)codepoint + toke_unicode_fold_deltas[index]);
+}
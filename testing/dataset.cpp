@@ -0,0 +1,1067 @@
+#include <gtest/gtest.h>
+
+#include <toke/train/dataset.h>
+
+#include "helpers.h"
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace {
+
+using namespace toke_testing;
+
+struct WalkResult final
+{
+  std::mutex lock;
+
+  std::vector<std::string> files;
+
+  /**
+   * @brief The chunks of each file, by their offset.
+   * */
+  std::vector<std::map<std::size_t, std::string>> chunks;
+
+  std::atomic<bool> busy[4]{};
+
+  std::atomic<bool> overlapped{ false };
+
+  std::atomic<bool> bad_thread{ false };
+};
+
+void
+recordFile(void* user_data,
+           const uint8_t* text,
+           const std::size_t text_size,
+           const std::size_t file_index,
+           const std::size_t offset,
+           const std::size_t thread_index)
+{
+  auto* result = static_cast<WalkResult*>(user_data);
+
+  if (thread_index >= 4) {
+    result->bad_thread = true;
+    return;
+  }
+
+  if (result->busy[thread_index].exchange(true)) {
+    result->overlapped = true;
+  }
+
+  {
+    std::lock_guard<std::mutex> guard(result->lock);
+    if (result->files.size() <= file_index) {
+      result->files.resize(file_index + 1);
+      result->chunks.resize(file_index + 1);
+    }
+    auto& file = result->files[file_index];
+    file.resize(std::max(file.size(), offset + text_size));
+    file.replace(offset, text_size, reinterpret_cast<const char*>(text), text_size);
+    result->chunks[file_index][offset].assign(reinterpret_cast<const char*>(text), text_size);
+  }
+
+  result->busy[thread_index] = false;
+}
+
+/**
+ * @brief Makes an archive with files of many sizes, including one larger than the buffers of a compressed walk.
+ * */
+[[nodiscard]] auto
+makeMixedTar(std::vector<std::string>& expected) -> std::string
+{
+  std::vector<TarEntry> entries;
+
+  entries.push_back(TarEntry{ "dir/", "", '5' });
+
+  for (int i = 0; i < 100; i++) {
+    std::string data;
+    const auto size = (i == 50) ? (10u * 1024u * 1024u) : static_cast<std::size_t>((i * 997) % 20000);
+    while (data.size() < size) {
+      data += "file " + std::to_string(i) + " at " + std::to_string(data.size()) + "\n";
+    }
+    entries.push_back(TarEntry{ "dir/file_" + std::to_string(i) + ".txt", data });
+    expected.push_back(data);
+  }
+
+  return makeTar(entries);
+}
+
+/**
+ * @brief Splits a file into chunks the way the walk does, keyed by their offsets.
+ * */
+[[nodiscard]] auto
+splitChunks(const std::string& text, const std::size_t chunk_size, const char delimiter)
+  -> std::map<std::size_t, std::string>
+{
+  std::map<std::size_t, std::string> chunks;
+
+  std::size_t offset = 0;
+
+  do {
+    auto end = text.size();
+    if ((text.size() - offset) > chunk_size) {
+      const auto next = text.find(delimiter, offset + chunk_size);
+      end = (next == std::string::npos) ? text.size() : (next + 1);
+    }
+    chunks[offset] = text.substr(offset, end - offset);
+    offset = end;
+  } while (offset < text.size());
+
+  return chunks;
+}
+
+void
+checkCompressedWalk(const std::string& name, const std::string& compressed, const std::vector<std::string>& expected)
+{
+  const auto path = testing::TempDir() + name;
+  writeFile(path, compressed);
+
+  auto dataset = makeDataset();
+  ASSERT_EQ(toke_dataset_open(dataset.get(), path.c_str()), TOKE_ERROR_NONE);
+
+  // compressed archives can only be read in order
+  EXPECT_EQ(toke_dataset_size(dataset.get()), 0);
+
+  toke_dataset_set_chunking(dataset.get(), 100000, '\n');
+
+  WalkResult result;
+  ASSERT_EQ(toke_dataset_walk(dataset.get(), 4, &result, recordFile), TOKE_ERROR_NONE);
+
+  EXPECT_FALSE(result.bad_thread);
+  EXPECT_FALSE(result.overlapped);
+  EXPECT_EQ(result.files, expected);
+
+  // the large file was split into chunks, at the same places as if it had been read whole, even though it was
+  // decompressed a block at a time
+  EXPECT_GT(result.chunks.at(50).size(), 1);
+  for (std::size_t i = 0; i < expected.size(); i++) {
+    EXPECT_EQ(result.chunks.at(i), splitChunks(expected[i], 100000, '\n')) << i;
+  }
+
+  // without chunking, the large file is walked whole
+  toke_dataset_set_chunking(dataset.get(), 0, '\n');
+
+  WalkResult whole_result;
+  ASSERT_EQ(toke_dataset_walk(dataset.get(), 4, &whole_result, recordFile), TOKE_ERROR_NONE);
+  EXPECT_EQ(whole_result.files, expected);
+  EXPECT_EQ(whole_result.chunks.at(50).size(), 1);
+
+  // a cut off archive fails the walk, but not before the files ahead of the cut have been walked
+  writeFile(path, compressed.substr(0, compressed.size() / 2));
+  ASSERT_EQ(toke_dataset_open(dataset.get(), path.c_str()), TOKE_ERROR_NONE);
+
+  WalkResult cut_result;
+  EXPECT_EQ(toke_dataset_walk(dataset.get(), 4, &cut_result, recordFile), TOKE_ERROR_FILE_IO);
+  EXPECT_FALSE(cut_result.files.empty());
+
+  std::remove(path.c_str());
+}
+
+/**
+ * @brief Makes JSON lines with records of many sizes, some escaped, and one larger than the buffers of a compressed
+ *        walk.
+ * */
+[[nodiscard]] auto
+makeJsonl(std::vector<std::string>& expected) -> std::string
+{
+  std::string jsonl;
+
+  for (int i = 0; i < 2000; i++) {
+    std::string text;
+    const auto size = (i == 1000) ? (10u * 1024u * 1024u) : static_cast<std::size_t>((i * 997) % 20000);
+    while (text.size() < size) {
+      text += "record " + std::to_string(i) + " at " + std::to_string(text.size()) + ((i % 3) ? " " : "\n");
+    }
+
+    std::string escaped;
+    for (const char c : text) {
+      escaped += (c == '\n') ? std::string("\\n") : std::string(1, c);
+    }
+
+    jsonl += R"({"id": )" + std::to_string(i) + R"(, "text": ")" + escaped + "\"}\n";
+    expected.push_back(text);
+  }
+
+  return jsonl;
+}
+
+void
+checkCompressedJsonl(const std::string& name, const std::string& compressed, const std::vector<std::string>& expected)
+{
+  const auto path = testing::TempDir() + name;
+  writeFile(path, compressed);
+
+  auto dataset = makeDataset();
+  ASSERT_EQ(toke_dataset_open(dataset.get(), path.c_str()), TOKE_ERROR_NONE);
+
+  WalkResult result;
+  ASSERT_EQ(toke_dataset_walk(dataset.get(), 4, &result, recordFile), TOKE_ERROR_NONE);
+
+  EXPECT_FALSE(result.bad_thread);
+  EXPECT_FALSE(result.overlapped);
+  EXPECT_EQ(result.files, expected);
+
+  std::remove(path.c_str());
+}
+
+/**
+ * @brief Gets the indices of the files that a walk visited, in order.
+ * */
+[[nodiscard]] auto
+walkedIndices(const WalkResult& result) -> std::vector<std::size_t>
+{
+  std::vector<std::size_t> indices;
+  for (std::size_t i = 0; i < result.chunks.size(); i++) {
+    if (!result.chunks[i].empty()) {
+      indices.push_back(i);
+    }
+  }
+  return indices;
+}
+
+struct Histogram final
+{
+  std::array<std::size_t, 256> counts;
+
+  std::size_t num_texts;
+
+  std::vector<std::size_t>* owned;
+};
+
+struct ReduceCalls final
+{
+  std::atomic<int> inits{ 0 };
+
+  std::atomic<int> merges{ 0 };
+
+  std::atomic<int> finalizes{ 0 };
+
+  int fail_init_at{ -1 };
+};
+
+auto
+initHistogram(void* user_data, void* state, const std::size_t thread_index) -> toke_error_z
+{
+  auto* calls = static_cast<ReduceCalls*>(user_data);
+  if (static_cast<int>(thread_index) == calls->fail_init_at) {
+    return TOKE_ERROR_MEMORY_ALLOCATION;
+  }
+  calls->inits++;
+  // something to release, so that a missed finalize leaks
+  static_cast<Histogram*>(state)->owned = new std::vector<std::size_t>(1);
+  return TOKE_ERROR_NONE;
+}
+
+void
+walkHistogram(void*,
+              void* state,
+              const uint8_t* text,
+              const std::size_t text_size,
+              const std::size_t,
+              const std::size_t)
+{
+  auto* histogram = static_cast<Histogram*>(state);
+  for (std::size_t i = 0; i < text_size; i++) {
+    histogram->counts[text[i]]++;
+  }
+  histogram->num_texts++;
+}
+
+auto
+mergeHistogram(void* user_data, void* target, void* source) -> toke_error_z
+{
+  static_cast<ReduceCalls*>(user_data)->merges++;
+  auto* to = static_cast<Histogram*>(target);
+  const auto* from = static_cast<const Histogram*>(source);
+  for (std::size_t i = 0; i < 256; i++) {
+    to->counts[i] += from->counts[i];
+  }
+  to->num_texts += from->num_texts;
+  return TOKE_ERROR_NONE;
+}
+
+void
+finalizeHistogram(void* user_data, void* state)
+{
+  static_cast<ReduceCalls*>(user_data)->finalizes++;
+  delete static_cast<Histogram*>(state)->owned;
+}
+
+/**
+ * @brief Which texts of a walk lie in the dataset's mapping, by file index.
+ * */
+struct ContainsResult final
+{
+  const toke_dataset_z* dataset;
+
+  std::mutex lock;
+
+  std::map<std::size_t, bool> contained;
+};
+
+void
+recordContains(void* user_data,
+               const uint8_t* text,
+               const std::size_t text_size,
+               const std::size_t file_index,
+               std::size_t,
+               std::size_t)
+{
+  auto* result = static_cast<ContainsResult*>(user_data);
+  const bool contained = toke_dataset_contains(result->dataset, text, text_size) != 0;
+  std::lock_guard<std::mutex> guard(result->lock);
+  result->contained[file_index] = contained;
+}
+
+[[nodiscard]] auto
+walkContains(const toke_dataset_z* dataset) -> std::map<std::size_t, bool>
+{
+  ContainsResult result;
+  result.dataset = dataset;
+  EXPECT_EQ(toke_dataset_walk(dataset, 4, &result, recordContains), TOKE_ERROR_NONE);
+  return result.contained;
+}
+
+} // namespace
+
+TEST(Dataset, Walk)
+{
+  std::vector<TarEntry> entries;
+  std::vector<std::string> expected;
+
+  entries.push_back(TarEntry{ "dir/", "", '5' });
+
+  for (int i = 0; i < 64; i++) {
+    // sizes on and around the block boundary, including an empty file
+    const auto size = static_cast<std::size_t>((i * 97) % 1500);
+    std::string data(size, static_cast<char>('a' + (i % 26)));
+    entries.push_back(TarEntry{ "dir/file_" + std::to_string(i) + ".txt", data, (i == 7) ? '\0' : '0' });
+    expected.push_back(data);
+  }
+
+  const auto path = testing::TempDir() + "walk.tar";
+  writeFile(path, makeTar(entries));
+
+  auto dataset = makeDataset();
+  ASSERT_EQ(toke_dataset_open(dataset.get(), path.c_str()), TOKE_ERROR_NONE);
+
+  WalkResult result;
+  ASSERT_EQ(toke_dataset_walk(dataset.get(), 4, &result, recordFile), TOKE_ERROR_NONE);
+
+  EXPECT_FALSE(result.bad_thread);
+  EXPECT_FALSE(result.overlapped);
+  EXPECT_EQ(result.files, expected);
+
+  std::remove((path + ".idx").c_str());
+  std::remove(path.c_str());
+}
+
+TEST(Dataset, WalkChunks)
+{
+  std::string lines;
+  for (int i = 0; i < 1000; i++) {
+    lines += "line number " + std::to_string(i) + "\n";
+  }
+
+  const std::string unbroken(5000, 'x');
+
+  const std::string small = "small\n";
+
+  const auto path = testing::TempDir() + "chunks.tar";
+  writeFile(path,
+            makeTar({ TarEntry{ "lines.txt", lines },
+                      TarEntry{ "unbroken.txt", unbroken },
+                      TarEntry{ "small.txt", small } }));
+
+  auto dataset = makeDataset();
+  ASSERT_EQ(toke_dataset_open(dataset.get(), path.c_str()), TOKE_ERROR_NONE);
+
+  toke_dataset_set_chunking(dataset.get(), 1000, '\n');
+
+  WalkResult result;
+  ASSERT_EQ(toke_dataset_walk(dataset.get(), 4, &result, recordFile), TOKE_ERROR_NONE);
+
+  EXPECT_FALSE(result.bad_thread);
+  EXPECT_FALSE(result.overlapped);
+  EXPECT_EQ(result.files, (std::vector<std::string>{ lines, unbroken, small }));
+
+  const auto& line_chunks = result.chunks.at(0);
+  EXPECT_GT(line_chunks.size(), 10);
+  for (const auto& [offset, chunk] : line_chunks) {
+    EXPECT_EQ(chunk.back(), '\n');
+    if ((offset + chunk.size()) < lines.size()) {
+      EXPECT_GE(chunk.size(), 1000);
+    }
+  }
+
+  EXPECT_EQ(result.chunks.at(1).size(), 1);
+  EXPECT_EQ(result.chunks.at(2).size(), 1);
+
+  std::remove((path + ".idx").c_str());
+  std::remove(path.c_str());
+}
+
+TEST(Dataset, WalkReadahead)
+{
+  std::vector<TarEntry> entries;
+  std::vector<std::string> expected;
+
+  for (int i = 0; i < 32; i++) {
+    std::string data;
+    while (data.size() < static_cast<std::size_t>(i * 1000)) {
+      data += "file " + std::to_string(i) + " line " + std::to_string(data.size()) + "\n";
+    }
+    entries.push_back(TarEntry{ "file_" + std::to_string(i) + ".txt", data });
+    expected.push_back(data);
+  }
+
+  const auto path = testing::TempDir() + "readahead.tar";
+  writeFile(path, makeTar(entries));
+
+  auto dataset = makeDataset();
+  ASSERT_EQ(toke_dataset_open(dataset.get(), path.c_str()), TOKE_ERROR_NONE);
+
+  // a window smaller than most files, so that pages are released while their neighbors are still being walked
+  toke_dataset_set_readahead(dataset.get(), 4096);
+  toke_dataset_set_chunking(dataset.get(), 2000, '\n');
+
+  for (int pass = 0; pass < 2; pass++) {
+    WalkResult result;
+    ASSERT_EQ(toke_dataset_walk(dataset.get(), 4, &result, recordFile), TOKE_ERROR_NONE);
+    EXPECT_FALSE(result.overlapped);
+    EXPECT_EQ(result.files, expected);
+  }
+
+  std::remove((path + ".idx").c_str());
+  std::remove(path.c_str());
+}
+
+TEST(Dataset, OpenMalformed)
+{
+  auto tar = makeTar({ TarEntry{ "a.txt", std::string(600, 'a') }, TarEntry{ "b.txt", std::string(2000, 'b') } });
+
+  // cut the archive in the middle of the second file
+  tar.resize(512 * 4);
+
+  const auto path = testing::TempDir() + "malformed.tar";
+  writeFile(path, tar);
+
+  auto dataset = makeDataset();
+  EXPECT_EQ(toke_dataset_open(dataset.get(), path.c_str()), TOKE_ERROR_FILE_IO);
+
+  std::remove(path.c_str());
+}
+
+TEST(Dataset, Index)
+{
+  const auto path = testing::TempDir() + "index.tar";
+  const auto index_path = path + ".idx";
+
+  std::remove(index_path.c_str());
+
+  const auto tar =
+    makeTar({ TarEntry{ "a.txt", "first" }, TarEntry{ "dir/", "", '5' }, TarEntry{ "b.txt", "second" } });
+
+  writeFile(path, tar);
+
+  const auto getFile = [](const toke_dataset_z* dataset, const std::size_t index) -> std::string {
+    std::size_t size{};
+    const auto* data = toke_dataset_get(dataset, index, &size);
+    return data ? std::string(reinterpret_cast<const char*>(data), size) : std::string("(null)");
+  };
+
+  {
+    auto dataset = makeDataset();
+    ASSERT_EQ(toke_dataset_open(dataset.get(), path.c_str()), TOKE_ERROR_NONE);
+    ASSERT_EQ(toke_dataset_size(dataset.get()), 2);
+    EXPECT_EQ(getFile(dataset.get(), 0), "first");
+    EXPECT_EQ(getFile(dataset.get(), 1), "second");
+    EXPECT_EQ(getFile(dataset.get(), 2), "(null)");
+  }
+
+  std::FILE* index_file = std::fopen(index_path.c_str(), "rb");
+  ASSERT_NE(index_file, nullptr);
+  std::fclose(index_file);
+
+  struct stat archive_stat{};
+  ASSERT_EQ(stat(path.c_str(), &archive_stat), 0);
+
+  // sets the modification time of the archive back to that of the original, give or take some nanoseconds
+  const auto restoreTime = [&](const long nanoseconds) {
+    struct timespec times[2] = { archive_stat.st_atim, archive_stat.st_mtim };
+    times[1].tv_nsec = (times[1].tv_nsec + nanoseconds) % 1000000000L;
+    ASSERT_EQ(utimensat(AT_FDCWD, path.c_str(), times, 0), 0);
+  };
+
+  // Reopening reads the index instead of the headers, which is checked by breaking the headers without changing the
+  // size or modification time of the archive.
+  {
+    auto broken = tar;
+    broken[257] = 'x';
+    writeFile(path, broken);
+    restoreTime(0);
+  }
+
+  {
+    auto dataset = makeDataset();
+    ASSERT_EQ(toke_dataset_open(dataset.get(), path.c_str()), TOKE_ERROR_NONE);
+    ASSERT_EQ(toke_dataset_size(dataset.get()), 2);
+    EXPECT_EQ(getFile(dataset.get(), 1), "second");
+  }
+
+  // an archive of the same size, rewritten within the same second, is told apart by the nanoseconds
+  writeFile(path,
+            makeTar({ TarEntry{ "c.txt", "the third" }, TarEntry{ "dir/", "", '5' }, TarEntry{ "d.txt", "fourth" } }));
+  restoreTime(1);
+
+  {
+    auto dataset = makeDataset();
+    ASSERT_EQ(toke_dataset_open(dataset.get(), path.c_str()), TOKE_ERROR_NONE);
+    ASSERT_EQ(toke_dataset_size(dataset.get()), 2);
+    EXPECT_EQ(getFile(dataset.get(), 0), "the third");
+  }
+
+  // and one put in its place with the same size and time is told apart by its inode
+  ASSERT_EQ(stat(path.c_str(), &archive_stat), 0);
+  writeFile(path + ".new",
+            makeTar({ TarEntry{ "e.txt", "the fifth file" }, TarEntry{ "dir/", "", '5' }, TarEntry{ "f.txt", "6" } }));
+  ASSERT_EQ(std::rename((path + ".new").c_str(), path.c_str()), 0);
+  restoreTime(0);
+
+  {
+    auto dataset = makeDataset();
+    ASSERT_EQ(toke_dataset_open(dataset.get(), path.c_str()), TOKE_ERROR_NONE);
+    ASSERT_EQ(toke_dataset_size(dataset.get()), 2);
+    EXPECT_EQ(getFile(dataset.get(), 0), "the fifth file");
+  }
+
+  // an index of an older archive is rebuilt
+  writeFile(path, makeTar({ TarEntry{ "c.txt", "third" } }));
+
+  {
+    auto dataset = makeDataset();
+    ASSERT_EQ(toke_dataset_open(dataset.get(), path.c_str()), TOKE_ERROR_NONE);
+    ASSERT_EQ(toke_dataset_size(dataset.get()), 1);
+    EXPECT_EQ(getFile(dataset.get(), 0), "third");
+  }
+
+  // the index is written through temporary files of its own, none of which are left behind
+  DIR* dir = opendir(testing::TempDir().c_str());
+  ASSERT_NE(dir, nullptr);
+  const auto prefix = std::string("index.tar.idx.");
+  while (const auto* entry = readdir(dir)) {
+    EXPECT_NE(std::string(entry->d_name).compare(0, prefix.size(), prefix), 0) << entry->d_name;
+  }
+  closedir(dir);
+
+  std::remove(index_path.c_str());
+  std::remove(path.c_str());
+}
+
+#if TOKE_HAVE_ZLIB
+
+TEST(Dataset, WalkGzip)
+{
+  std::vector<std::string> expected;
+  const auto tar = makeMixedTar(expected);
+
+  checkCompressedWalk("mixed.tar.gz", gzip(tar), expected);
+
+  // several gzip members in a row, as written by parallel compressors
+  const auto half = (tar.size() / 2) - ((tar.size() / 2) % 512);
+  checkCompressedWalk("members.tar.gz", gzip(tar.substr(0, half)) + gzip(tar.substr(half)), expected);
+
+}
+
+TEST(Dataset, WalkCompressedHugeSize)
+{
+  auto tar = makeTar({ TarEntry{ "a.txt", "first\n" }, TarEntry{ "b.txt", std::string(1000, 'b') } });
+
+  // the size of the second file says 8 GiB (in octal), then in base 256 so large it can't be rounded up to blocks
+  const std::string sizes[] = { std::string("77777777777", 12), std::string("\x80\0\0\0", 4) + std::string(8, '\xff') };
+
+  for (const auto& size : sizes) {
+    auto corrupt = tar;
+    corrupt.replace(512 * 2 + 124, 12, size);
+
+    const auto path = testing::TempDir() + "huge.tar.gz";
+    writeFile(path, gzip(corrupt));
+
+    auto dataset = makeDataset();
+    ASSERT_EQ(toke_dataset_open(dataset.get(), path.c_str()), TOKE_ERROR_NONE);
+
+    for (const std::size_t chunk_size : { 0, 100 }) {
+      toke_dataset_set_chunking(dataset.get(), chunk_size, '\n');
+
+      // the stream ends long before the size, which fails the walk rather than allocating the size
+      WalkResult result;
+      EXPECT_EQ(toke_dataset_walk(dataset.get(), 4, &result, recordFile), TOKE_ERROR_FILE_IO);
+      EXPECT_EQ(result.files.at(0), "first\n");
+    }
+
+    std::remove(path.c_str());
+  }
+}
+
+#endif
+
+#if TOKE_HAVE_ZSTD
+
+TEST(Dataset, WalkZstd)
+{
+  std::vector<std::string> expected;
+  const auto tar = makeMixedTar(expected);
+
+  checkCompressedWalk("mixed.tar.zst", zstd(tar), expected);
+}
+
+#endif
+
+TEST(Dataset, WalkJsonl)
+{
+  const std::string jsonl = R"({"text": "plain"}
+{"id": 1, "meta": {"text": "nested", "list": [1, "}", {"a": null}]}, "text": "after \"nested\" values"}
+
+   
+{"id": 4}
+{"text": "tab\tnewline\nslash\/ é 😀 lone \udc00 end"}
+{"text": 5}
+{"te\u0078t": "escaped key", "body": "custom"}
+{}
+{"text": ""})";
+
+  const auto path = testing::TempDir() + "walk.jsonl";
+  writeFile(path, jsonl);
+
+  auto dataset = makeDataset();
+  ASSERT_EQ(toke_dataset_open(dataset.get(), path.c_str()), TOKE_ERROR_NONE);
+
+  // only archives are indexed
+  EXPECT_EQ(toke_dataset_size(dataset.get()), 0);
+
+  // small runs, so that several threads get some lines
+  toke_dataset_set_chunking(dataset.get(), 16, '\n');
+
+  WalkResult result;
+  ASSERT_EQ(toke_dataset_walk(dataset.get(), 4, &result, recordFile), TOKE_ERROR_NONE);
+
+  EXPECT_FALSE(result.bad_thread);
+  EXPECT_FALSE(result.overlapped);
+  ASSERT_EQ(result.files.size(), 10);
+  EXPECT_EQ(result.files[0], "plain");
+  EXPECT_EQ(result.files[1], "after \"nested\" values");
+  EXPECT_EQ(result.files[5], "tab\tnewline\nslash/ \xc3\xa9 \xf0\x9f\x98\x80 lone \xef\xbf\xbd end");
+  EXPECT_EQ(result.files[7], "escaped key");
+  EXPECT_EQ(result.files[9], "");
+
+  // blank lines, records without the field and records where it isn't a string are skipped, but still numbered
+  for (const std::size_t skipped : { 2, 3, 4, 6, 8 }) {
+    EXPECT_TRUE(result.chunks[skipped].empty()) << skipped;
+  }
+  EXPECT_EQ(result.chunks[9].size(), 1);
+
+  ASSERT_EQ(toke_dataset_set_jsonl_field(dataset.get(), "body"), TOKE_ERROR_NONE);
+
+  WalkResult custom_result;
+  ASSERT_EQ(toke_dataset_walk(dataset.get(), 4, &custom_result, recordFile), TOKE_ERROR_NONE);
+  ASSERT_EQ(custom_result.files.size(), 8);
+  EXPECT_EQ(custom_result.files[7], "custom");
+
+  std::remove(path.c_str());
+}
+
+TEST(Dataset, WalkDedup)
+{
+  const std::vector<std::string> texts = { "a", "b", "a", "longer text", "b", "a", "", "", "longer text!" };
+
+  std::string jsonl;
+  for (const auto& text : texts) {
+    jsonl += "{\"text\": \"" + text + "\"}\n";
+  }
+
+  const auto path = testing::TempDir() + "dedup.jsonl";
+  writeFile(path, jsonl);
+
+  auto dataset = makeDataset();
+  ASSERT_EQ(toke_dataset_open(dataset.get(), path.c_str()), TOKE_ERROR_NONE);
+
+  toke_dataset_set_chunking(dataset.get(), 16, '\n');
+
+  std::unique_ptr<toke_dedup_z, void (*)(toke_dedup_z*)> dedup(toke_dedup_new(), toke_dedup_delete);
+  toke_dataset_set_dedup(dataset.get(), dedup.get());
+
+  WalkResult result;
+  ASSERT_EQ(toke_dataset_walk(dataset.get(), 4, &result, recordFile), TOKE_ERROR_NONE);
+
+  // one copy of each text is walked, though which one depends on the threads
+  std::map<std::string, std::size_t> walked;
+  for (std::size_t i = 0; i < result.chunks.size(); i++) {
+    for (const auto& chunk : result.chunks[i]) {
+      EXPECT_EQ(chunk.second, texts[i]);
+      walked[chunk.second]++;
+    }
+  }
+
+  EXPECT_EQ(walked.size(), 5);
+  for (const auto& text : walked) {
+    EXPECT_EQ(text.second, 1) << text.first;
+  }
+
+  EXPECT_EQ(toke_dedup_num_unique(dedup.get()), 5);
+  EXPECT_EQ(toke_dedup_num_duplicates(dedup.get()), 4);
+  EXPECT_EQ(toke_dedup_duplicate_bytes(dedup.get()), 3);
+
+  // the set remembers the first walk, so a second one skips everything
+  WalkResult second_result;
+  ASSERT_EQ(toke_dataset_walk(dataset.get(), 4, &second_result, recordFile), TOKE_ERROR_NONE);
+  EXPECT_TRUE(second_result.files.empty());
+  EXPECT_EQ(toke_dedup_num_duplicates(dedup.get()), 4 + texts.size());
+
+  std::remove(path.c_str());
+}
+
+TEST(Dataset, WalkJsonlMalformed)
+{
+  const auto path = testing::TempDir() + "malformed.jsonl";
+
+  const char* malformed[] = { "{\"text\": \"a\"}\nnot an object\n", "{\"text\": \"unterminated}\n", "{\"text\" \"a\"}\n" };
+
+  for (const char* jsonl : malformed) {
+
+    writeFile(path, jsonl);
+
+    auto dataset = makeDataset();
+    ASSERT_EQ(toke_dataset_open(dataset.get(), path.c_str()), TOKE_ERROR_NONE);
+
+    WalkResult result;
+    EXPECT_EQ(toke_dataset_walk(dataset.get(), 4, &result, recordFile), TOKE_ERROR_FILE_IO) << jsonl;
+  }
+
+  // a bad line early on, in runs of a few lines each
+  std::string jsonl;
+  for (int i = 0; i < 1000; i++) {
+    jsonl += (i == 10) ? std::string("not an object\n") : R"({"text": "record )" + std::to_string(i) + "\"}\n";
+  }
+
+  writeFile(path, jsonl);
+
+  auto dataset = makeDataset();
+  ASSERT_EQ(toke_dataset_open(dataset.get(), path.c_str()), TOKE_ERROR_NONE);
+
+  toke_dataset_set_chunking(dataset.get(), 100, '\n');
+
+  // with one thread, the runs are walked in order, and none is started after the one with the bad line
+  WalkResult result;
+  EXPECT_EQ(toke_dataset_walk(dataset.get(), 1, &result, recordFile), TOKE_ERROR_FILE_IO);
+  EXPECT_GE(result.files.size(), 10);
+  EXPECT_LT(result.files.size(), 20);
+
+  std::remove(path.c_str());
+}
+
+#if TOKE_HAVE_ZLIB
+
+TEST(Dataset, WalkJsonlGzip)
+{
+  std::vector<std::string> expected;
+  const auto jsonl = makeJsonl(expected);
+
+  checkCompressedJsonl("records.jsonl.gz", gzip(jsonl), expected);
+
+  // JSON lines are read to the end of the stream, so they show that zeros after the last member end it quietly, but
+  // anything else after the zeros is still an error
+  checkCompressedJsonl("padded.jsonl.gz", gzip(jsonl) + std::string(10000, '\0'), expected);
+
+  const auto path = testing::TempDir() + "trailing.jsonl.gz";
+  writeFile(path, gzip(jsonl) + std::string(100, '\0') + "trailing");
+
+  auto dataset = makeDataset();
+  ASSERT_EQ(toke_dataset_open(dataset.get(), path.c_str()), TOKE_ERROR_NONE);
+
+  WalkResult result;
+  EXPECT_EQ(toke_dataset_walk(dataset.get(), 4, &result, recordFile), TOKE_ERROR_FILE_IO);
+
+  std::remove(path.c_str());
+}
+
+#endif
+
+#if TOKE_HAVE_ZSTD
+
+TEST(Dataset, WalkJsonlZstd)
+{
+  std::vector<std::string> expected;
+  checkCompressedJsonl("records.jsonl.zst", zstd(makeJsonl(expected)), expected);
+}
+
+#endif
+
+TEST(Dataset, WalkDirectory)
+{
+  const auto root = testing::TempDir() + "walk_dir";
+  ASSERT_EQ(mkdir(root.c_str(), 0755), 0);
+  ASSERT_EQ(mkdir((root + "/a").c_str(), 0755), 0);
+  ASSERT_EQ(mkdir((root + "/a/b").c_str(), 0755), 0);
+
+  // in the order that the paths sort in
+  const std::vector<std::pair<std::string, std::string>> files = {
+    { "/a.txt", "top level" },
+    { "/a/b/deep.txt", "two levels down" },
+    { "/a/empty.txt", "" },
+    { "/a/z.txt", std::string(300000, 'z') },
+    { "/b.txt", "last" },
+  };
+
+  for (const auto& file : files) {
+    writeFile(root + file.first, file.second);
+  }
+
+  auto dataset = makeDataset();
+  ASSERT_EQ(toke_dataset_open(dataset.get(), root.c_str()), TOKE_ERROR_NONE);
+
+  toke_dataset_set_chunking(dataset.get(), 100000, 'z');
+
+  WalkResult result;
+  ASSERT_EQ(toke_dataset_walk(dataset.get(), 4, &result, recordFile), TOKE_ERROR_NONE);
+
+  EXPECT_FALSE(result.bad_thread);
+  EXPECT_FALSE(result.overlapped);
+  ASSERT_EQ(result.files.size(), files.size());
+  for (std::size_t i = 0; i < files.size(); i++) {
+    EXPECT_EQ(result.files[i], files[i].second) << files[i].first;
+  }
+  EXPECT_EQ(result.chunks[3].size(), 3);
+
+  for (auto it = files.rbegin(); it != files.rend(); ++it) {
+    std::remove((root + it->first).c_str());
+  }
+  rmdir((root + "/a/b").c_str());
+  rmdir((root + "/a").c_str());
+  rmdir(root.c_str());
+}
+
+TEST(Dataset, WalkContains)
+{
+  const auto tar_path = testing::TempDir() + "contains.tar";
+  writeFile(tar_path, makeTar({ TarEntry{ "a.txt", "first" }, TarEntry{ "b.txt", std::string(5000, 'b') } }));
+
+  auto dataset = makeDataset();
+  ASSERT_EQ(toke_dataset_open(dataset.get(), tar_path.c_str()), TOKE_ERROR_NONE);
+  EXPECT_EQ(walkContains(dataset.get()), (std::map<std::size_t, bool>{ { 0, true }, { 1, true } }));
+
+  // a text that runs past the end of the mapping, or is somewhere else entirely, isn't in it
+  std::size_t size{};
+  const auto* last = toke_dataset_get(dataset.get(), 1, &size);
+  EXPECT_NE(toke_dataset_contains(dataset.get(), last, size), 0);
+  EXPECT_EQ(toke_dataset_contains(dataset.get(), last, 1024 * 1024), 0);
+  const std::string elsewhere = "first";
+  EXPECT_EQ(toke_dataset_contains(dataset.get(), reinterpret_cast<const uint8_t*>(elsewhere.data()), 5), 0);
+
+  // escaped records are unescaped into a buffer of their own
+  const auto jsonl_path = testing::TempDir() + "contains.jsonl";
+  writeFile(jsonl_path, "{\"text\": \"plain\"}\n{\"text\": \"esc\\naped\"}\n");
+  ASSERT_EQ(toke_dataset_open(dataset.get(), jsonl_path.c_str()), TOKE_ERROR_NONE);
+  EXPECT_EQ(walkContains(dataset.get()), (std::map<std::size_t, bool>{ { 0, true }, { 1, false } }));
+
+  // each file of a directory is unmapped once it has been walked
+  const auto root = testing::TempDir() + "contains_dir";
+  ASSERT_EQ(mkdir(root.c_str(), 0755), 0);
+  writeFile(root + "/a.txt", "first");
+  ASSERT_EQ(toke_dataset_open(dataset.get(), root.c_str()), TOKE_ERROR_NONE);
+  EXPECT_EQ(walkContains(dataset.get()), (std::map<std::size_t, bool>{ { 0, false } }));
+
+#if TOKE_HAVE_ZLIB
+  const auto gzip_path = testing::TempDir() + "contains.jsonl.gz";
+  writeFile(gzip_path, gzip("{\"text\": \"plain\"}\n"));
+  ASSERT_EQ(toke_dataset_open(dataset.get(), gzip_path.c_str()), TOKE_ERROR_NONE);
+  EXPECT_EQ(walkContains(dataset.get()), (std::map<std::size_t, bool>{ { 0, false } }));
+  std::remove(gzip_path.c_str());
+#endif
+
+  std::remove((root + "/a.txt").c_str());
+  rmdir(root.c_str());
+  std::remove(jsonl_path.c_str());
+  std::remove((tar_path + ".idx").c_str());
+  std::remove(tar_path.c_str());
+}
+
+TEST(Dataset, WalkSample)
+{
+  std::vector<TarEntry> entries;
+  std::vector<std::string> expected;
+  std::string jsonl;
+
+  for (int i = 0; i < 500; i++) {
+    const std::string data = "file " + std::to_string(i) + std::string(static_cast<std::size_t>(i % 7), '!');
+    entries.push_back(TarEntry{ "file_" + std::to_string(i) + ".txt", data });
+    expected.push_back(data);
+    jsonl += R"({"text": ")" + data + "\"}\n";
+  }
+
+  const auto tar = makeTar(entries);
+  const auto tar_path = testing::TempDir() + "sample.tar";
+  const auto jsonl_path = testing::TempDir() + "sample.jsonl";
+  writeFile(tar_path, tar);
+  writeFile(jsonl_path, jsonl);
+
+  auto dataset = makeDataset();
+  ASSERT_EQ(toke_dataset_open(dataset.get(), tar_path.c_str()), TOKE_ERROR_NONE);
+
+  toke_dataset_set_sampling(dataset.get(), 0.25, 0, 7);
+
+  WalkResult result;
+  ASSERT_EQ(toke_dataset_walk(dataset.get(), 4, &result, recordFile), TOKE_ERROR_NONE);
+
+  const auto picked = walkedIndices(result);
+  EXPECT_GT(picked.size(), 75);
+  EXPECT_LT(picked.size(), 175);
+  for (const auto i : picked) {
+    EXPECT_EQ(result.files[i], expected[i]) << i;
+  }
+
+  // the same seed picks the same files, whatever the number of threads
+  WalkResult single_result;
+  ASSERT_EQ(toke_dataset_walk(dataset.get(), 1, &single_result, recordFile), TOKE_ERROR_NONE);
+  EXPECT_EQ(walkedIndices(single_result), picked);
+
+  // and whatever the format
+  auto jsonl_dataset = makeDataset();
+  ASSERT_EQ(toke_dataset_open(jsonl_dataset.get(), jsonl_path.c_str()), TOKE_ERROR_NONE);
+  toke_dataset_set_sampling(jsonl_dataset.get(), 0.25, 0, 7);
+  toke_dataset_set_chunking(jsonl_dataset.get(), 256, '\n');
+
+  WalkResult jsonl_result;
+  ASSERT_EQ(toke_dataset_walk(jsonl_dataset.get(), 4, &jsonl_result, recordFile), TOKE_ERROR_NONE);
+  EXPECT_EQ(walkedIndices(jsonl_result), picked);
+
+#if TOKE_HAVE_ZLIB
+  const auto gzip_path = testing::TempDir() + "sample.tar.gz";
+  writeFile(gzip_path, gzip(tar));
+
+  auto gzip_dataset = makeDataset();
+  ASSERT_EQ(toke_dataset_open(gzip_dataset.get(), gzip_path.c_str()), TOKE_ERROR_NONE);
+  toke_dataset_set_sampling(gzip_dataset.get(), 0.25, 0, 7);
+
+  WalkResult gzip_result;
+  ASSERT_EQ(toke_dataset_walk(gzip_dataset.get(), 4, &gzip_result, recordFile), TOKE_ERROR_NONE);
+  EXPECT_EQ(walkedIndices(gzip_result), picked);
+
+  std::remove(gzip_path.c_str());
+#endif
+
+  toke_dataset_set_sampling(dataset.get(), 0.25, 0, 8);
+
+  WalkResult other_result;
+  ASSERT_EQ(toke_dataset_walk(dataset.get(), 4, &other_result, recordFile), TOKE_ERROR_NONE);
+  EXPECT_NE(walkedIndices(other_result), picked);
+
+  // a budget walks the picked files in order until they reach it
+  toke_dataset_set_sampling(dataset.get(), 0.25, 100, 7);
+
+  WalkResult budget_result;
+  ASSERT_EQ(toke_dataset_walk(dataset.get(), 4, &budget_result, recordFile), TOKE_ERROR_NONE);
+
+  const auto budget_picked = walkedIndices(budget_result);
+  ASSERT_FALSE(budget_picked.empty());
+  EXPECT_TRUE(std::equal(budget_picked.begin(), budget_picked.end(), picked.begin()));
+
+  std::size_t picked_bytes = 0;
+  for (const auto i : budget_picked) {
+    EXPECT_LT(picked_bytes, 100) << i;
+    picked_bytes += expected[i].size();
+  }
+  EXPECT_GE(picked_bytes, 100);
+
+  // for JSON lines, the budget counts whole lines
+  toke_dataset_set_sampling(jsonl_dataset.get(), 1.0, 1000, 0);
+
+  WalkResult jsonl_budget_result;
+  ASSERT_EQ(toke_dataset_walk(jsonl_dataset.get(), 4, &jsonl_budget_result, recordFile), TOKE_ERROR_NONE);
+
+  std::size_t line_bytes = 0;
+  std::size_t num_lines = 0;
+  while (line_bytes < 1000) {
+    // the terminator of the literal stands in for the newline
+    line_bytes += expected[num_lines].size() + sizeof(R"({"text": ""})");
+    num_lines++;
+  }
+  EXPECT_EQ(walkedIndices(jsonl_budget_result).size(), num_lines);
+
+  // nothing is picked with a fraction of zero
+  toke_dataset_set_sampling(dataset.get(), 0.0, 0, 7);
+
+  WalkResult empty_result;
+  ASSERT_EQ(toke_dataset_walk(dataset.get(), 4, &empty_result, recordFile), TOKE_ERROR_NONE);
+  EXPECT_TRUE(empty_result.files.empty());
+
+  std::remove(tar_path.c_str());
+  std::remove(jsonl_path.c_str());
+}
+
+TEST(Dataset, WalkReduce)
+{
+  std::vector<std::string> expected;
+  const auto tar = makeMixedTar(expected);
+
+  const auto path = testing::TempDir() + "reduce.tar";
+  writeFile(path, tar);
+
+  auto dataset = makeDataset();
+  ASSERT_EQ(toke_dataset_open(dataset.get(), path.c_str()), TOKE_ERROR_NONE);
+
+  toke_dataset_set_chunking(dataset.get(), 100000, '\n');
+
+  Histogram expected_histogram{};
+  for (const auto& text : expected) {
+    for (const char c : text) {
+      expected_histogram.counts[static_cast<unsigned char>(c)]++;
+    }
+  }
+
+  toke_dataset_reducer_z reducer{};
+  reducer.state_size = sizeof(Histogram);
+  reducer.init = initHistogram;
+  reducer.walk = walkHistogram;
+  reducer.merge = mergeHistogram;
+  reducer.finalize = finalizeHistogram;
+
+  for (const std::size_t max_threads : { 1, 3, 4 }) {
+
+    ReduceCalls calls;
+    Histogram histogram{};
+    ASSERT_EQ(toke_dataset_walk_reduce(dataset.get(), max_threads, &reducer, &calls, &histogram), TOKE_ERROR_NONE);
+
+    EXPECT_EQ(histogram.counts, expected_histogram.counts) << max_threads;
+    EXPECT_GE(histogram.num_texts, expected.size());
+
+    // one state for each thread, each merged once, and the last into the result
+    EXPECT_EQ(calls.inits, static_cast<int>(max_threads));
+    EXPECT_EQ(calls.merges, static_cast<int>(max_threads));
+    EXPECT_EQ(calls.finalizes, static_cast<int>(max_threads));
+  }
+
+  // a failed set up stops the walk, and releases the states that were set up
+  ReduceCalls failing_calls;
+  failing_calls.fail_init_at = 2;
+  Histogram histogram{};
+  EXPECT_EQ(toke_dataset_walk_reduce(dataset.get(), 4, &reducer, &failing_calls, &histogram),
+            TOKE_ERROR_MEMORY_ALLOCATION);
+  EXPECT_EQ(histogram.num_texts, 0);
+  EXPECT_EQ(failing_calls.merges, 0);
+  EXPECT_EQ(failing_calls.finalizes, failing_calls.inits);
+
+  std::remove(path.c_str());
+}
@@ -1,8 +1,15 @@
 #include <gtest/gtest.h>
 
+#include <toke/cpu.h>
 #include <toke/cxx_api.hpp>
+#include <toke/decoder.h>
+#include <toke/model.h>
 
 #include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
 
 namespace {
 
@@ -28,3 +35,82 @@ TEST(Decoder, DecodeWithComplexVocab)
   auto result = decoder->decode(reinterpret_cast<const std::uint16_t*>("\x01\x00\x00\x00\x02\x00"), 3);
   EXPECT_EQ(result, "a\nb");
 }
+
+TEST(Decoder, DecodeAtEveryCpuLevel)
+{
+  const std::string longToken(40, 'x');
+
+  const auto vocab = "a\n" + std::string(31, 'b') + "\n" + longToken + "\n";
+
+  const std::uint16_t tokens[] = { 1, 0, 2, 7, 0, 2, 1 };
+
+  const auto expected = std::string(31, 'b') + "a" + longToken + "\x7f" + "a" + longToken + std::string(31, 'b');
+
+  const toke_cpu_level_z levels[] = {
+    TOKE_CPU_LEVEL_SCALAR, TOKE_CPU_LEVEL_SSE2, TOKE_CPU_LEVEL_AVX2, TOKE_CPU_LEVEL_AVX512
+  };
+
+  const auto defaultLevel = toke_cpu_level();
+
+  auto decoder = toke::Decoder::create();
+  decoder->parseVocab(vocab);
+
+  for (const auto level : levels) {
+    toke_cpu_set_level(level);
+    EXPECT_EQ(decoder->decode(tokens, sizeof(tokens) / sizeof(tokens[0])), expected) << "level: " << level;
+  }
+
+  toke_cpu_set_level(defaultLevel);
+}
+
+TEST(Decoder, FromModel)
+{
+  std::unique_ptr<toke_model_z, void (*)(toke_model_z*)> model(toke_model_new(), toke_model_delete);
+  for (const std::string token : { "b", "aa", "a" }) {
+    ASSERT_EQ(toke_model_add_token(model.get(), reinterpret_cast<const uint8_t*>(token.data()), token.size()),
+              TOKE_ERROR_NONE);
+  }
+
+  std::unique_ptr<toke_decoder_z, void (*)(toke_decoder_z*)> decoder(toke_decoder_new(), toke_decoder_delete);
+  ASSERT_EQ(toke_decoder_parse_vocab(decoder.get(), "x\ny\nz\nw", 7), TOKE_ERROR_NONE);
+
+  // the model replaces the vocab that was there before
+  ASSERT_EQ(toke_decoder_from_model(decoder.get(), model.get()), TOKE_ERROR_NONE);
+
+  const std::uint16_t tokens[] = { 1, 2, 0, 3 };
+  std::size_t length = 0;
+  std::unique_ptr<char, void (*)(void*)> text(toke_decode(decoder.get(), tokens, 4, &length), std::free);
+  EXPECT_EQ(std::string(text.get(), length), "aaba\x7f");
+}
+
+TEST(Decoder, FromLargeModel)
+{
+  // more tokens than 16-bit IDs can reach, each of them three bytes
+  std::vector<std::string> tokens;
+  for (int i = 0; i < 70000; i++) {
+    tokens.push_back({ static_cast<char>('a' + (i / 4096)), static_cast<char>(i / 64 % 64 + '0'),
+                       static_cast<char>(i % 64 + '0') });
+  }
+
+  std::vector<const uint8_t*> data;
+  std::vector<std::size_t> sizes;
+  for (const auto& token : tokens) {
+    data.push_back(reinterpret_cast<const uint8_t*>(token.data()));
+    sizes.push_back(token.size());
+  }
+
+  std::unique_ptr<toke_model_z, void (*)(toke_model_z*)> model(toke_model_new(), toke_model_delete);
+  ASSERT_EQ(toke_model_add_tokens(model.get(), data.data(), sizes.data(), tokens.size()), TOKE_ERROR_NONE);
+  ASSERT_EQ(toke_model_size(model.get()), tokens.size());
+
+  std::unique_ptr<toke_decoder_z, void (*)(toke_decoder_z*)> decoder(toke_decoder_new(), toke_decoder_delete);
+  ASSERT_EQ(toke_decoder_from_model(decoder.get(), model.get()), TOKE_ERROR_NONE);
+
+  // the last ID is left for unknown tokens, as the encoder leaves it
+  const std::uint16_t ids[] = { 0, 65533, 65534, 65535 };
+  std::size_t length = 0;
+  std::unique_ptr<char, void (*)(void*)> text(toke_decode(decoder.get(), ids, 4, &length), std::free);
+  EXPECT_EQ(std::string(text.get(), length),
+            std::string(reinterpret_cast<const char*>(toke_model_get_def(model.get(), 0)), 3) +
+              std::string(reinterpret_cast<const char*>(toke_model_get_def(model.get(), 65533)), 3) + "\x7f\x7f");
+}
@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+
+#include <toke/train/dedup.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace {
+
+using DedupPtr = std::unique_ptr<toke_dedup_z, void (*)(toke_dedup_z*)>;
+
+[[nodiscard]] auto
+makeDedup() -> DedupPtr
+{
+  return DedupPtr(toke_dedup_new(), toke_dedup_delete);
+}
+
+[[nodiscard]] auto
+insert(toke_dedup_z* dedup, const std::string& text) -> int
+{
+  int is_new = -1;
+  EXPECT_EQ(toke_dedup_insert(dedup, reinterpret_cast<const uint8_t*>(text.data()), text.size(), &is_new),
+            TOKE_ERROR_NONE);
+  return is_new;
+}
+
+} // namespace
+
+TEST(Dedup, Insert)
+{
+  auto dedup = makeDedup();
+
+  EXPECT_TRUE(insert(dedup.get(), "abc"));
+  EXPECT_FALSE(insert(dedup.get(), "abc"));
+  EXPECT_TRUE(insert(dedup.get(), "abd"));
+  EXPECT_TRUE(insert(dedup.get(), ""));
+  EXPECT_FALSE(insert(dedup.get(), ""));
+
+  // every tail length, on both sides of the 16 byte blocks
+  const std::string long_text = "the quick brown fox jumps over the lazy dog, twice over";
+  for (std::size_t i = 1; i <= long_text.size(); i++) {
+    EXPECT_TRUE(insert(dedup.get(), long_text.substr(0, i))) << i;
+  }
+
+  EXPECT_EQ(toke_dedup_num_unique(dedup.get()), 3 + long_text.size());
+  EXPECT_EQ(toke_dedup_num_duplicates(dedup.get()), 2);
+  EXPECT_EQ(toke_dedup_duplicate_bytes(dedup.get()), 3);
+
+  toke_dedup_clear(dedup.get());
+
+  EXPECT_EQ(toke_dedup_num_unique(dedup.get()), 0);
+  EXPECT_EQ(toke_dedup_num_duplicates(dedup.get()), 0);
+  EXPECT_TRUE(insert(dedup.get(), "abc"));
+}
+
+TEST(Dedup, Grow)
+{
+  auto dedup = makeDedup();
+
+  // enough that every stripe grows several times
+  constexpr std::size_t count = 1000000;
+
+#pragma omp parallel for num_threads(4)
+  for (std::size_t i = 0; i < count; i++) {
+    const std::string text = std::to_string(i % (count / 2));
+    int is_new = 0;
+    toke_dedup_insert(dedup.get(), reinterpret_cast<const uint8_t*>(text.data()), text.size(), &is_new);
+  }
+
+  EXPECT_EQ(toke_dedup_num_unique(dedup.get()), count / 2);
+  EXPECT_EQ(toke_dedup_num_duplicates(dedup.get()), count / 2);
+}
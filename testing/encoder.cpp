@@ -1,6 +1,11 @@
 #include <gtest/gtest.h>
 
 #include <toke/cxx_api.hpp>
+#include <toke/encoder.h>
+
+#include <cstdlib>
+#include <memory>
+#include <string>
 
 namespace {
 
@@ -61,4 +66,43 @@ TEST(Encoder, ParseVocabWithEmptyFilter)
   ASSERT_EQ(tokens.size(), 2);
   EXPECT_EQ(tokens[0], 1);
   EXPECT_EQ(tokens[1], 0);
-}
\ No newline at end of file
+}
+
+TEST(Encoder, EncodeInplace)
+{
+  std::unique_ptr<toke_encoder_z, void (*)(toke_encoder_z*)> encoder(toke_encoder_new(), toke_encoder_delete);
+  ASSERT_EQ(toke_encoder_parse_vocab(encoder.get(), vocabWithDirectives, sizeof(vocabWithDirectives) - 1),
+            TOKE_ERROR_NONE);
+
+  std::string text = "AaB";
+  std::size_t length = 0;
+  std::unique_ptr<uint16_t, void (*)(void*)> tokens(
+    toke_encode_inplace(encoder.get(), text.data(), text.size(), &length), std::free);
+  ASSERT_EQ(length, 2);
+  EXPECT_EQ(tokens.get()[0], 2);
+  EXPECT_EQ(tokens.get()[1], 1);
+}
+
+TEST(Encoder, FromModel)
+{
+  std::unique_ptr<toke_model_z, void (*)(toke_model_z*)> model(toke_model_new(), toke_model_delete);
+  for (const std::string token : { "b", "aa", "a" }) {
+    ASSERT_EQ(toke_model_add_token(model.get(), reinterpret_cast<const uint8_t*>(token.data()), token.size()),
+              TOKE_ERROR_NONE);
+  }
+
+  std::unique_ptr<toke_encoder_z, void (*)(toke_encoder_z*)> encoder(toke_encoder_new(), toke_encoder_delete);
+  ASSERT_EQ(toke_encoder_parse_vocab(encoder.get(), vocabPlain, sizeof(vocabPlain) - 1), TOKE_ERROR_NONE);
+
+  // the model replaces the vocab that was there before
+  ASSERT_EQ(toke_encoder_from_model(encoder.get(), model.get()), TOKE_ERROR_NONE);
+
+  std::string text = "aabc";
+  std::size_t length = 0;
+  std::unique_ptr<uint16_t, void (*)(void*)> tokens(
+    toke_encode(encoder.get(), text.data(), text.size(), &length), std::free);
+  ASSERT_EQ(length, 3);
+  EXPECT_EQ(tokens.get()[0], 1);
+  EXPECT_EQ(tokens.get()[1], 2);
+  EXPECT_EQ(tokens.get()[2], 65535);
+}
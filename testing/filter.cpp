@@ -1,6 +1,309 @@
 #include <gtest/gtest.h>
 
+#include <toke/cpu.h>
 #include <toke/cxx_api.hpp>
+#include <toke/normalizer.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief A byte at a time implementation of the filter rules, used to check the optimized normalizer against.
+ * */
+[[nodiscard]] auto
+referenceFilter(const std::string& input, const int flags) -> std::string
+{
+  const bool normalizeLines = flags & 0x01;
+  const bool normalizeTabs = flags & 0x02;
+  const bool restrictedAscii = flags & 0x04;
+  const bool lowercase = flags & 0x08;
+  const bool unicodeSubstitutes = flags & 0x10;
+
+  const std::string substitutions[][2] = {
+    { "\xe2\x80\x94", "-" }, { "\xe2\x80\x93", "-" }, { "\xe2\x80\x90", "-" }, { "\xe2\x80\x91", "-" },
+    { "\xe2\x80\x9c", "\"" }, { "\xe2\x80\x9d", "\"" }, { "\xe2\x80\xb3", "\"" }, { "\xe2\x80\x98", "'" },
+    { "\xe2\x80\x99", "'" }, { "\xe2\x80\xb2", "'" }, { "\xe2\x80\xa2", "*" }, { "\xe2\x80\xa3", "*" }
+  };
+
+  std::string output;
+
+  std::size_t i = 0;
+
+  while (i < input.size()) {
+
+    const auto c = static_cast<unsigned char>(input[i]);
+
+    std::size_t size = 1;
+    if ((c >> 5) == 0x06) {
+      size = 2;
+    } else if ((c >> 4) == 0x0e) {
+      size = 3;
+    } else if ((c >> 3) == 0x1e) {
+      size = 4;
+    }
+    size = std::min(size, input.size() - i);
+
+    if (normalizeLines && (c == '\r')) {
+      output.push_back('\n');
+      i += ((i + 1) < input.size() && (input[i + 1] == '\n')) ? 2 : 1;
+      continue;
+    }
+
+    if (normalizeTabs && (c == '\t')) {
+      output.push_back(' ');
+      i++;
+      continue;
+    }
+
+    if (unicodeSubstitutes && (size > 1)) {
+      bool found = false;
+      for (const auto& sub : substitutions) {
+        if (input.compare(i, size, sub[0]) == 0) {
+          output += sub[1];
+          found = true;
+          break;
+        }
+      }
+      if (found) {
+        i += size;
+        continue;
+      }
+    }
+
+    const bool allowed = ((c >= ' ') && (c <= '~')) || (c == '\r') || (c == '\n') || (c == '\t');
+    if (restrictedAscii && !allowed) {
+      output.push_back('\x7f');
+      i += size;
+      continue;
+    }
+
+    if (lowercase && (c >= 'A') && (c <= 'Z')) {
+      output.push_back(static_cast<char>(c + 32));
+      i++;
+      continue;
+    }
+
+    output.append(input, i, size);
+    i += size;
+  }
+
+  return output;
+}
+
+[[nodiscard]] auto
+makeConfig(const int flags) -> std::string
+{
+  const char* keys[] = { "normalize_lines", "normalize_tabs", "restricted_ascii", "lowercase", "unicode_substitutes" };
+
+  std::string config;
+
+  for (int i = 0; i < 5; i++) {
+    if (!config.empty()) {
+      config += ',';
+    }
+    config += keys[i];
+    config += (flags & (1 << i)) ? "=true" : "=false";
+  }
+
+  return config;
+}
+
+/**
+ * @brief Generates mostly ASCII text, with the occasional byte that needs special handling.
+ * */
+[[nodiscard]] auto
+makeRandomText(std::mt19937& rng, const std::size_t size) -> std::string
+{
+  const char* specials[] = { "\r", "\n", "\r\n", "\t", "\x01", "\x7f", "\xe2\x80\x94", "\xe2\x80\x99",
+                             "\xc3\xa9", "\xe2\x82\xac", "\xf0\x9f\x98\x80", "\xe2", "\xff", "\x80" };
+
+  std::uniform_int_distribution<int> printable(' ', '~');
+  std::uniform_int_distribution<int> percent(0, 99);
+  std::uniform_int_distribution<std::size_t> special(0, sizeof(specials) / sizeof(specials[0]) - 1);
+
+  std::string text;
+
+  while (text.size() < size) {
+    if (percent(rng) < 3) {
+      text += specials[special(rng)];
+    } else {
+      text.push_back(static_cast<char>(printable(rng)));
+    }
+  }
+
+  return text;
+}
+
+/**
+ * @brief Reads a field of NormalizationTest.txt, which is a sequence of hexadecimal codepoints, into UTF-8.
+ * */
+[[nodiscard]] auto
+parseCodepoints(const std::string& field) -> std::string
+{
+  std::istringstream stream(field);
+
+  std::string text;
+
+  unsigned long codepoint = 0;
+
+  while (stream >> std::hex >> codepoint) {
+    if (codepoint < 0x80) {
+      text.push_back(static_cast<char>(codepoint));
+    } else if (codepoint < 0x800) {
+      text.push_back(static_cast<char>(0xc0 | (codepoint >> 6)));
+      text.push_back(static_cast<char>(0x80 | (codepoint & 0x3f)));
+    } else if (codepoint < 0x10000) {
+      text.push_back(static_cast<char>(0xe0 | (codepoint >> 12)));
+      text.push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3f)));
+      text.push_back(static_cast<char>(0x80 | (codepoint & 0x3f)));
+    } else {
+      text.push_back(static_cast<char>(0xf0 | (codepoint >> 18)));
+      text.push_back(static_cast<char>(0x80 | ((codepoint >> 12) & 0x3f)));
+      text.push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3f)));
+      text.push_back(static_cast<char>(0x80 | (codepoint & 0x3f)));
+    }
+  }
+
+  return text;
+}
+
+/**
+ * @brief Reads the cases of testing/data/normalization_test.txt, which is in the format of NormalizationTest.txt: the
+ *        source and its NFC, NFD, NFKC and NFKD forms, followed by the line they were read from.
+ * */
+[[nodiscard]] auto
+readNormalizationCases() -> std::vector<std::array<std::string, 6>>
+{
+  // a table derived from the same Unicode version as the normalizer's tables
+  std::ifstream file(TOKE_TEST_DATA_DIR "/normalization_test.txt");
+
+  std::vector<std::array<std::string, 6>> cases;
+
+  std::string line;
+
+  while (std::getline(file, line)) {
+
+    if (line.empty() || (line[0] == '#') || (line[0] == '@')) {
+      continue;
+    }
+
+    std::array<std::string, 6> c;
+    std::istringstream fields(line);
+    std::string field;
+    for (std::size_t i = 0; (i < 5) && std::getline(fields, field, ';'); i++) {
+      c[i] = parseCodepoints(field);
+    }
+    c[5] = line;
+
+    cases.push_back(std::move(c));
+  }
+
+  return cases;
+}
+
+[[nodiscard]] auto
+makeNormalizer(const std::string& config) -> std::unique_ptr<toke_normalizer_z, void (*)(toke_normalizer_z*)>
+{
+  std::unique_ptr<toke_normalizer_z, void (*)(toke_normalizer_z*)> normalizer(toke_normalizer_new(),
+                                                                              toke_normalizer_delete);
+  EXPECT_EQ(toke_normalizer_parse_config(normalizer.get(), config.data(), config.size()), TOKE_ERROR_NONE);
+  return normalizer;
+}
+
+[[nodiscard]] auto
+normalize(toke_normalizer_z* normalizer, const std::string& text) -> std::string
+{
+  std::size_t length = 0;
+  std::unique_ptr<char, void (*)(void*)> output(toke_normalize(normalizer, text.data(), text.size(), &length),
+                                                std::free);
+  return std::string(output.get(), length);
+}
+
+/**
+ * @brief Feeds the text to a stream in chunks that end at the given offsets, checking that the stream never holds
+ *        more than a segment back.
+ * */
+[[nodiscard]] auto
+streamNormalizeAt(toke_normalizer_z* normalizer, const std::string& input, const std::vector<std::size_t>& splits)
+  -> std::string
+{
+  std::unique_ptr<toke_normalizer_stream_z, void (*)(toke_normalizer_stream_z*)> stream(
+    toke_normalizer_stream_new(normalizer), toke_normalizer_stream_delete);
+
+  // a segment, a truncated codepoint and a held byte, all expanded as much as NFKC can
+  const std::size_t maxHeld = (((4 * 31) + 3) * 11) + 4;
+
+  std::string output;
+
+  std::size_t offset = 0;
+
+  for (std::size_t i = 0; i <= splits.size(); i++) {
+    const auto end = (i < splits.size()) ? splits[i] : input.size();
+    std::string buffer(toke_normalizer_stream_bound(stream.get(), end - offset), '\0');
+    std::size_t outLength = 0;
+    EXPECT_EQ(toke_normalizer_stream_feed(
+                stream.get(), input.data() + offset, end - offset, buffer.data(), buffer.size(), &outLength),
+              TOKE_ERROR_NONE);
+    output.append(buffer, 0, outLength);
+    EXPECT_LE(toke_normalizer_stream_bound(stream.get(), 0), maxHeld);
+    offset = end;
+  }
+
+  std::string buffer(toke_normalizer_stream_bound(stream.get(), 0), '\0');
+  std::size_t outLength = 0;
+  EXPECT_EQ(toke_normalizer_stream_finish(stream.get(), buffer.data(), buffer.size(), &outLength), TOKE_ERROR_NONE);
+  output.append(buffer, 0, outLength);
+
+  return output;
+}
+
+/**
+ * @brief Splits the text into random chunks, feeding each one to a stream.
+ * */
+[[nodiscard]] auto
+streamNormalize(toke_normalizer_z* normalizer, const std::string& input, std::mt19937& rng) -> std::string
+{
+  std::unique_ptr<toke_normalizer_stream_z, void (*)(toke_normalizer_stream_z*)> stream(
+    toke_normalizer_stream_new(normalizer), toke_normalizer_stream_delete);
+
+  std::uniform_int_distribution<std::size_t> chunkSizes(0, 8);
+
+  std::string output;
+
+  std::size_t offset = 0;
+
+  while (offset < input.size()) {
+    const auto chunkSize = std::min(chunkSizes(rng), input.size() - offset);
+    std::string buffer(toke_normalizer_stream_bound(stream.get(), chunkSize), '\0');
+    std::size_t outLength = 0;
+    const auto err = toke_normalizer_stream_feed(
+      stream.get(), input.data() + offset, chunkSize, buffer.data(), buffer.size(), &outLength);
+    EXPECT_EQ(err, TOKE_ERROR_NONE);
+    output.append(buffer, 0, outLength);
+    offset += chunkSize;
+  }
+
+  std::string buffer(toke_normalizer_stream_bound(stream.get(), 0), '\0');
+  std::size_t outLength = 0;
+  const auto err = toke_normalizer_stream_finish(stream.get(), buffer.data(), buffer.size(), &outLength);
+  EXPECT_EQ(err, TOKE_ERROR_NONE);
+  output.append(buffer, 0, outLength);
+
+  return output;
+}
+
+} // namespace
 
 TEST(Filter, NormalizeLines)
 {
@@ -142,3 +445,374 @@ TEST(Filter, UnicodeSubstitutions)
     EXPECT_EQ(output, "* *");
   }
 }
+
+TEST(Filter, TruncatedSequence)
+{
+  // the input ends part way through an em dash
+  constexpr char testVector[] = "a\xe2\x80";
+
+  const auto filter = toke::Filter::create();
+  filter->parseConfig("unicode_substitutes=true");
+  const auto output = filter->filter(testVector);
+  EXPECT_EQ(output, testVector);
+}
+
+TEST(Filter, MatchesReference)
+{
+  const toke_cpu_level_z levels[] = {
+    TOKE_CPU_LEVEL_SCALAR, TOKE_CPU_LEVEL_SSE2, TOKE_CPU_LEVEL_AVX2, TOKE_CPU_LEVEL_AVX512
+  };
+
+  const auto defaultLevel = toke_cpu_level();
+
+  for (const auto level : levels) {
+
+    // levels the CPU doesn't support fall back to a lower one, which is still worth checking
+    toke_cpu_set_level(level);
+
+    std::mt19937 rng(1234);
+
+    std::uniform_int_distribution<std::size_t> sizes(0, 300);
+
+    for (int flags = 0; flags < 32; flags++) {
+
+      const auto filter = toke::Filter::create();
+      filter->parseConfig(makeConfig(flags));
+
+      for (int i = 0; i < 200; i++) {
+        const auto input = makeRandomText(rng, sizes(rng));
+        EXPECT_EQ(filter->filter(input), referenceFilter(input, flags))
+          << "config: " << makeConfig(flags) << ", level: " << level;
+      }
+    }
+  }
+
+  toke_cpu_set_level(defaultLevel);
+}
+
+TEST(Filter, Nfc)
+{
+  // e + combining acute, A + ring above + combining dot below, Hangul jamo
+  constexpr char testVector[] = "e\xcc\x81 A\xcc\x8a\xcc\xa3 \xe1\x84\x80\xe1\x85\xa1";
+
+  {
+    const auto filter = toke::Filter::create();
+    filter->parseConfig("nfc=false");
+    const auto output = filter->filter(testVector);
+    EXPECT_EQ(output, testVector);
+  }
+
+  {
+    const auto filter = toke::Filter::create();
+    filter->parseConfig("nfc=true");
+    const auto output = filter->filter(testVector);
+    EXPECT_EQ(output, "\xc3\xa9 \xe1\xba\xa0\xcc\x8a \xea\xb0\x80");
+  }
+
+  {
+    // already normalized text, and compatibility characters, are left alone
+    constexpr char normalized[] = "caf\xc3\xa9 \xef\xac\x81";
+    const auto filter = toke::Filter::create();
+    filter->parseConfig("nfc=true");
+    const auto output = filter->filter(normalized);
+    EXPECT_EQ(output, normalized);
+  }
+}
+
+TEST(Filter, Nfkc)
+{
+  // fi ligature, full width A, e + combining acute
+  constexpr char testVector[] = "\xef\xac\x81 \xef\xbc\xa1 e\xcc\x81";
+
+  const auto filter = toke::Filter::create();
+  filter->parseConfig("nfkc=true,lowercase=true");
+  const auto output = filter->filter(testVector);
+  EXPECT_EQ(output, "fi a \xc3\xa9");
+}
+
+TEST(Filter, NormalizationConformance)
+{
+  const auto cases = readNormalizationCases();
+  ASSERT_GT(cases.size(), 10000u);
+
+  const auto nfc = makeNormalizer("nfc=true");
+  const auto nfkc = makeNormalizer("nfkc=true");
+
+  for (const auto& c : cases) {
+
+    // the invariants that NormalizationTest.txt lists for NFC and NFKC
+    EXPECT_EQ(normalize(nfc.get(), c[0]), c[1]) << c[5];
+    EXPECT_EQ(normalize(nfc.get(), c[1]), c[1]) << c[5];
+    EXPECT_EQ(normalize(nfc.get(), c[2]), c[1]) << c[5];
+    EXPECT_EQ(normalize(nfc.get(), c[3]), c[3]) << c[5];
+    EXPECT_EQ(normalize(nfc.get(), c[4]), c[3]) << c[5];
+
+    for (std::size_t i = 0; i < 5; i++) {
+      EXPECT_EQ(normalize(nfkc.get(), c[i]), c[3]) << c[5];
+    }
+  }
+}
+
+TEST(Filter, LowercaseUnicode)
+{
+  // Cyrillic "ПРИВЕТ", Greek "ΣΟΦΙΑ", Latin "ÀÉÎ", Kelvin sign
+  constexpr char testVector[] = "\xd0\x9f\xd0\xa0\xd0\x98\xd0\x92\xd0\x95\xd0\xa2 "
+                                "\xce\xa3\xce\x9f\xce\xa6\xce\x99\xce\x91 "
+                                "\xc3\x80\xc3\x89\xc3\x8e "
+                                "\xe2\x84\xaa";
+
+  {
+    const auto filter = toke::Filter::create();
+    filter->parseConfig("lowercase=false");
+    const auto output = filter->filter(testVector);
+    EXPECT_EQ(output, testVector);
+  }
+
+  {
+    const auto filter = toke::Filter::create();
+    filter->parseConfig("lowercase=true");
+    const auto output = filter->filter(testVector);
+    EXPECT_EQ(output,
+              "\xd0\xbf\xd1\x80\xd0\xb8\xd0\xb2\xd0\xb5\xd1\x82 "
+              "\xcf\x83\xce\xbf\xcf\x86\xce\xb9\xce\xb1 "
+              "\xc3\xa0\xc3\xa9\xc3\xae "
+              "k");
+  }
+
+  {
+    // restricted ASCII still takes priority over lowercasing
+    const auto filter = toke::Filter::create();
+    filter->parseConfig("lowercase=true,restricted_ascii=true");
+    const auto output = filter->filter("A\xc3\x80");
+    EXPECT_EQ(output, "a\x7f");
+  }
+}
+
+TEST(Filter, Stream)
+{
+  // combining marks, Hangul jamo, compatibility characters and capitals that fold, to split across chunks
+  const char* unicode[] = { "\xcc\x81", "\xcc\xa3", "\xe1\x84\x80", "\xe1\x85\xa1", "\xef\xac\x81", "\xef\xb7\xba",
+                            "\xc3\x80", "\xce\xa3" };
+
+  const char* forms[] = { "", ",nfc=true", ",nfkc=true" };
+
+  std::mt19937 rng(4321);
+
+  std::uniform_int_distribution<std::size_t> sizes(0, 200);
+  std::uniform_int_distribution<std::size_t> unicodeIndex(0, sizeof(unicode) / sizeof(unicode[0]) - 1);
+
+  for (const auto* form : forms) {
+
+    for (int flags = 0; flags < 32; flags++) {
+
+      std::unique_ptr<toke_normalizer_z, void (*)(toke_normalizer_z*)> normalizer(toke_normalizer_new(),
+                                                                                  toke_normalizer_delete);
+
+      const auto config = makeConfig(flags) + form;
+      ASSERT_EQ(toke_normalizer_parse_config(normalizer.get(), config.data(), config.size()), TOKE_ERROR_NONE);
+
+      for (int i = 0; i < 50; i++) {
+
+        auto input = makeRandomText(rng, sizes(rng));
+        for (std::size_t j = 0; j < input.size(); j += 7) {
+          input.insert(j, unicode[unicodeIndex(rng)]);
+        }
+
+        std::size_t length = 0;
+        std::unique_ptr<char, void (*)(void*)> expected(
+          toke_normalize(normalizer.get(), input.data(), input.size(), &length), std::free);
+
+        EXPECT_EQ(streamNormalize(normalizer.get(), input, rng), std::string(expected.get(), length))
+          << "config: " << config;
+      }
+    }
+  }
+}
+
+TEST(Filter, StreamSplits)
+{
+  // every source of the conformance cases in a row, which is about 80 kilobytes of marks, jamo and compatibility
+  // characters that interact across the cases
+  std::string text;
+  for (const auto& c : readNormalizationCases()) {
+    text += c[0];
+  }
+  ASSERT_GT(text.size(), 50000u);
+
+  std::mt19937 rng(3141);
+
+  for (const auto* config : { "nfc=true", "nfkc=true", "nfkc=true,lowercase=true,normalize_lines=true" }) {
+
+    const auto normalizer = makeNormalizer(config);
+
+    const auto expected = normalize(normalizer.get(), text);
+
+    // split anywhere, including inside UTF-8 sequences and runs of marks, in chunks of all sizes
+    for (const std::size_t maxChunk : { 1, 7, 100, 5000 }) {
+      std::uniform_int_distribution<std::size_t> chunkSizes(1, maxChunk);
+      std::vector<std::size_t> splits;
+      for (std::size_t offset = chunkSizes(rng); offset < text.size(); offset += chunkSizes(rng)) {
+        splits.push_back(offset);
+      }
+      EXPECT_EQ(streamNormalizeAt(normalizer.get(), text, splits), expected) << config << ", " << maxChunk;
+    }
+
+    // a single split at every offset of the first few kilobytes
+    const auto prefix = text.substr(0, 4096);
+    const auto expectedPrefix = normalize(normalizer.get(), prefix);
+    for (std::size_t split = 0; split <= prefix.size(); split++) {
+      ASSERT_EQ(streamNormalizeAt(normalizer.get(), prefix, { split }), expectedPrefix) << config << ", " << split;
+    }
+  }
+}
+
+TEST(Filter, StreamSafe)
+{
+  // a long run of combining marks, with classes out of order, is cut into segments rather than held back whole
+  const char* marks[] = { "\xcc\x81", "\xcc\xa3", "\xcc\x88", "\xcd\x85", "\xcc\xb8" };
+
+  std::mt19937 rng(2718);
+
+  std::uniform_int_distribution<std::size_t> markIndex(0, sizeof(marks) / sizeof(marks[0]) - 1);
+
+  std::string text = "a";
+  for (int i = 0; i < 20000; i++) {
+    text += marks[markIndex(rng)];
+  }
+  text += "e\xcc\x81";
+
+  for (const auto* config : { "nfc=true", "nfkc=true" }) {
+
+    const auto normalizer = makeNormalizer(config);
+
+    const auto expected = normalize(normalizer.get(), text);
+
+    EXPECT_EQ(expected.substr(expected.size() - 2), "\xc3\xa9");
+
+    std::uniform_int_distribution<std::size_t> chunkSizes(1, 64);
+    std::vector<std::size_t> splits;
+    for (std::size_t offset = chunkSizes(rng); offset < text.size(); offset += chunkSizes(rng)) {
+      splits.push_back(offset);
+    }
+    EXPECT_EQ(streamNormalizeAt(normalizer.get(), text, splits), expected) << config;
+  }
+}
+
+TEST(Filter, StreamBufferSize)
+{
+  std::unique_ptr<toke_normalizer_z, void (*)(toke_normalizer_z*)> normalizer(toke_normalizer_new(),
+                                                                              toke_normalizer_delete);
+
+  std::unique_ptr<toke_normalizer_stream_z, void (*)(toke_normalizer_stream_z*)> stream(
+    toke_normalizer_stream_new(normalizer.get()), toke_normalizer_stream_delete);
+
+  char output[4];
+  std::size_t length = 0;
+  EXPECT_EQ(toke_normalizer_stream_feed(stream.get(), "abcdef", 6, output, sizeof(output), &length),
+            TOKE_ERROR_BUFFER_SIZE);
+}
+
+TEST(Filter, Inplace)
+{
+  const char* forms[] = { "", ",nfc=true", ",nfkc=true" };
+
+  std::mt19937 rng(5678);
+
+  std::uniform_int_distribution<std::size_t> sizes(0, 200);
+
+  for (const auto* form : forms) {
+
+    for (int flags = 0; flags < 32; flags++) {
+
+      std::unique_ptr<toke_normalizer_z, void (*)(toke_normalizer_z*)> normalizer(toke_normalizer_new(),
+                                                                                  toke_normalizer_delete);
+
+      const auto config = makeConfig(flags) + form;
+      ASSERT_EQ(toke_normalizer_parse_config(normalizer.get(), config.data(), config.size()), TOKE_ERROR_NONE);
+
+      for (int i = 0; i < 50; i++) {
+
+        // A + combining ring above composes into a shorter sequence, so NFC and NFKC never grow this text
+        auto input = makeRandomText(rng, sizes(rng));
+        for (std::size_t j = 0; j < input.size(); j += 11) {
+          input.insert(j, "A\xcc\x8a");
+        }
+
+        std::size_t expectedLength = 0;
+        std::unique_ptr<char, void (*)(void*)> expected(
+          toke_normalize(normalizer.get(), input.data(), input.size(), &expectedLength), std::free);
+
+        std::size_t length = 0;
+        ASSERT_EQ(toke_normalize_inplace(normalizer.get(), input.data(), input.size(), &length), TOKE_ERROR_NONE);
+
+        EXPECT_EQ(input.substr(0, length), std::string(expected.get(), expectedLength)) << "config: " << config;
+      }
+    }
+  }
+}
+
+TEST(Filter, InplaceGrowth)
+{
+  std::unique_ptr<toke_normalizer_z, void (*)(toke_normalizer_z*)> normalizer(toke_normalizer_new(),
+                                                                              toke_normalizer_delete);
+
+  const std::string config = "nfkc=true";
+  ASSERT_EQ(toke_normalizer_parse_config(normalizer.get(), config.data(), config.size()), TOKE_ERROR_NONE);
+
+  // the Arabic ligature grows from three bytes to 33 under NFKC
+  std::string text = "a\xef\xb7\xba";
+  const auto original = text;
+
+  std::size_t length = 0;
+  EXPECT_EQ(toke_normalize_inplace(normalizer.get(), text.data(), text.size(), &length), TOKE_ERROR_BUFFER_SIZE);
+  EXPECT_EQ(text, original);
+}
+
+TEST(Filter, CustomSubstitutions)
+{
+  {
+    // ellipsis, no-break space, soft hyphen
+    const auto filter = toke::Filter::create();
+    filter->parseConfig("substitute=U+2026:U+002E U+002E U+002E,substitute=U+00A0:U+0020,substitute=U+00AD:");
+    const auto output = filter->filter("a\xe2\x80\xa6 b\xc2\xa0"
+                                       "c\xc2\xad"
+                                       "d");
+    EXPECT_EQ(output, "a... b cd");
+  }
+
+  {
+    // mappings declared in the config override the default ones
+    const auto filter = toke::Filter::create();
+    filter->parseConfig("unicode_substitutes=true,substitute=U+2014:U+002D U+002D");
+    const auto output = filter->filter("\xe2\x80\x94 \xe2\x80\x93");
+    EXPECT_EQ(output, "-- -");
+  }
+
+  {
+    // every letter in Latin Extended-A, which needs a bigger table than the default one
+    std::string config;
+    std::string input;
+    for (unsigned int c = 0x100; c < 0x180; c++) {
+      char mapping[32];
+      std::snprintf(mapping, sizeof(mapping), "substitute=U+%04X:U+0078,", c);
+      config += mapping;
+      input += static_cast<char>(0xc0 | (c >> 6));
+      input += static_cast<char>(0x80 | (c & 0x3f));
+    }
+    const auto filter = toke::Filter::create();
+    filter->parseConfig(config);
+    EXPECT_EQ(filter->filter(input), std::string(0x80, 'x'));
+  }
+
+  {
+    // replacements that are longer than the codepoint, ASCII codepoints and missing replacements are rejected
+    const char* invalid[] = { "substitute=U+00E9:U+0065 U+0301", "substitute=U+0041:U+0061", "substitute=U+2026",
+                              "substitute=U+2026:U+002E  U+002E", "substitute=U+D800:", "substitute" };
+    for (const auto* config : invalid) {
+      std::unique_ptr<toke_normalizer_z, void (*)(toke_normalizer_z*)> normalizer(toke_normalizer_new(),
+                                                                                  toke_normalizer_delete);
+      EXPECT_EQ(toke_normalizer_parse_config(normalizer.get(), config, std::strlen(config)), TOKE_ERROR_FILTER_SYNTAX)
+        << config;
+    }
+  }
+}
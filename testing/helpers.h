@@ -0,0 +1,160 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <toke/train/dataset.h>
+
+#if TOKE_HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+#if TOKE_HAVE_ZSTD
+#include <zstd.h>
+#endif
+
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Fixtures shared by the tests of the training library, which build datasets on disk to walk.
+ * */
+namespace toke_testing {
+
+using DatasetPtr = std::unique_ptr<toke_dataset_z, void (*)(toke_dataset_z*)>;
+
+[[nodiscard]] inline auto
+makeDataset() -> DatasetPtr
+{
+  return DatasetPtr(toke_dataset_new(), toke_dataset_delete);
+}
+
+[[nodiscard]] inline auto
+readFile(const std::string& path) -> std::string
+{
+  std::string data;
+  std::FILE* file = std::fopen(path.c_str(), "rb");
+  if (!file) {
+    return data;
+  }
+  char buffer[4096];
+  std::size_t size = 0;
+  while ((size = std::fread(buffer, 1, sizeof(buffer), file)) > 0) {
+    data.append(buffer, size);
+  }
+  std::fclose(file);
+  return data;
+}
+
+inline void
+writeFile(const std::string& path, const std::string& data)
+{
+  std::FILE* file = std::fopen(path.c_str(), "wb");
+  ASSERT_NE(file, nullptr);
+  std::fwrite(data.data(), 1, data.size(), file);
+  std::fclose(file);
+}
+
+[[nodiscard]] inline auto
+fileExists(const std::string& path) -> bool
+{
+  std::FILE* file = std::fopen(path.c_str(), "rb");
+  if (file) {
+    std::fclose(file);
+  }
+  return file != nullptr;
+}
+
+struct TarEntry final
+{
+  std::string name;
+
+  std::string data;
+
+  char type{ '0' };
+};
+
+[[nodiscard]] inline auto
+makeTarHeader(const TarEntry& entry) -> std::string
+{
+  std::string header(512, '\0');
+  std::memcpy(&header[0], entry.name.data(), entry.name.size());
+  std::snprintf(&header[100], 8, "%07o", 0644);
+  std::snprintf(&header[124], 12, "%011llo", static_cast<unsigned long long>(entry.data.size()));
+  header[156] = entry.type;
+  std::memcpy(&header[257], "ustar\0" "00", 8);
+
+  // the checksum is summed with its own field set to spaces
+  std::memset(&header[148], ' ', 8);
+  unsigned int checksum = 0;
+  for (const auto c : header) {
+    checksum += static_cast<unsigned char>(c);
+  }
+  std::snprintf(&header[148], 8, "%06o", checksum);
+
+  return header;
+}
+
+[[nodiscard]] inline auto
+makeTar(const std::vector<TarEntry>& entries) -> std::string
+{
+  std::string tar;
+
+  for (const auto& entry : entries) {
+    tar += makeTarHeader(entry);
+    tar += entry.data;
+    tar.append((512 - (entry.data.size() % 512)) % 512, '\0');
+  }
+
+  tar.append(1024, '\0');
+
+  return tar;
+}
+
+#if TOKE_HAVE_ZLIB
+
+[[nodiscard]] inline auto
+gzip(const std::string& data) -> std::string
+{
+  z_stream stream{};
+  // a window of 15 bits, plus 16 to write a gzip header instead of a zlib one
+  EXPECT_EQ(deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY), Z_OK);
+
+  std::string result(deflateBound(&stream, data.size()), '\0');
+
+  stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+  stream.avail_in = static_cast<uInt>(data.size());
+  stream.next_out = reinterpret_cast<Bytef*>(&result[0]);
+  stream.avail_out = static_cast<uInt>(result.size());
+
+  EXPECT_EQ(deflate(&stream, Z_FINISH), Z_STREAM_END);
+
+  result.resize(stream.total_out);
+
+  deflateEnd(&stream);
+
+  return result;
+}
+
+#endif
+
+#if TOKE_HAVE_ZSTD
+
+[[nodiscard]] inline auto
+zstd(const std::string& data) -> std::string
+{
+  std::string result(ZSTD_compressBound(data.size()), '\0');
+
+  const auto size = ZSTD_compress(&result[0], result.size(), data.data(), data.size(), 3);
+  EXPECT_FALSE(ZSTD_isError(size));
+
+  result.resize(size);
+
+  return result;
+}
+
+#endif
+
+} // namespace toke_testing
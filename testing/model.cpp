@@ -0,0 +1,351 @@
+#include <gtest/gtest.h>
+
+#include <toke/decoder.h>
+#include <toke/encoder.h>
+#include <toke/model.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace {
+
+using ModelPtr = std::unique_ptr<toke_model_z, void (*)(toke_model_z*)>;
+
+[[nodiscard]] auto
+makeModel() -> ModelPtr
+{
+  return ModelPtr(toke_model_new(), toke_model_delete);
+}
+
+[[nodiscard]] auto
+getTokens(const toke_model_z* model) -> std::vector<std::string>
+{
+  std::vector<std::string> tokens;
+
+  for (std::size_t i = 0; i < toke_model_size(model); i++) {
+    const auto* data = reinterpret_cast<const char*>(toke_model_get_def(model, i));
+    tokens.emplace_back(data, toke_model_get_size(model, i));
+  }
+
+  return tokens;
+}
+
+[[nodiscard]] auto
+makeRandomTokens(std::mt19937& rng, const std::size_t count) -> std::vector<std::string>
+{
+  std::uniform_int_distribution<std::size_t> sizes(0, 4);
+  std::uniform_int_distribution<int> bytes('a', 'f');
+
+  std::vector<std::string> tokens(count);
+
+  for (auto& token : tokens) {
+    token.resize(sizes(rng));
+    for (auto& c : token) {
+      c = static_cast<char>(bytes(rng));
+    }
+  }
+
+  return tokens;
+}
+
+} // namespace
+
+TEST(Model, AddToken)
+{
+  std::mt19937 rng(42);
+
+  const auto tokens = makeRandomTokens(rng, 2000);
+
+  auto model = makeModel();
+
+  for (const auto& token : tokens) {
+    ASSERT_EQ(toke_model_add_token(model.get(), reinterpret_cast<const uint8_t*>(token.data()), token.size()),
+              TOKE_ERROR_NONE);
+  }
+
+  const std::set<std::string> expected(tokens.begin(), tokens.end());
+
+  EXPECT_EQ(getTokens(model.get()), std::vector<std::string>(expected.begin(), expected.end()));
+}
+
+TEST(Model, AddTokens)
+{
+  std::mt19937 rng(43);
+
+  auto model = makeModel();
+
+  std::set<std::string> expected;
+
+  // several batches, which overlap each other and the tokens already in the model
+  for (int batch = 0; batch < 4; batch++) {
+
+    const auto tokens = makeRandomTokens(rng, 500);
+
+    std::vector<const uint8_t*> data;
+    std::vector<std::size_t> sizes;
+
+    for (const auto& token : tokens) {
+      data.push_back(reinterpret_cast<const uint8_t*>(token.data()));
+      sizes.push_back(token.size());
+      expected.insert(token);
+    }
+
+    ASSERT_EQ(toke_model_add_tokens(model.get(), data.data(), sizes.data(), tokens.size()), TOKE_ERROR_NONE);
+
+    EXPECT_EQ(getTokens(model.get()), std::vector<std::string>(expected.begin(), expected.end()));
+  }
+}
+
+TEST(Model, AddUnicodeBlock)
+{
+  auto model = makeModel();
+
+  ASSERT_EQ(toke_model_add_unicode_block(model.get(), TOKE_UNICODE_BLOCK_GENERAL_PUNCTUATION), TOKE_ERROR_NONE);
+  ASSERT_EQ(toke_model_add_unicode_block(model.get(), TOKE_UNICODE_BLOCK_BASIC_LATIN), TOKE_ERROR_NONE);
+  ASSERT_EQ(toke_model_add_unicode_block(model.get(), TOKE_UNICODE_BLOCK_BASIC_LATIN), TOKE_ERROR_NONE);
+
+  const auto tokens = getTokens(model.get());
+
+  ASSERT_EQ(tokens.size(), 0x80 + 0x70);
+  EXPECT_TRUE(std::is_sorted(tokens.begin(), tokens.end()));
+  EXPECT_EQ(tokens[0], std::string(1, '\0'));
+  EXPECT_EQ(tokens[0x80], "\xe2\x80\x80");
+}
+
+TEST(Model, AddCodepointRange)
+{
+  auto model = makeModel();
+
+  // the range covers the surrogates, which are skipped
+  ASSERT_EQ(toke_model_add_codepoint_range(model.get(), 0xD000, 0xEFFF), TOKE_ERROR_NONE);
+  EXPECT_EQ(toke_model_size(model.get()), 0x2000 - 0x800);
+
+  ASSERT_EQ(toke_model_add_unicode_block(model.get(), TOKE_UNICODE_BLOCK_CJK_UNIFIED_IDEOGRAPHS), TOKE_ERROR_NONE);
+  EXPECT_EQ(toke_model_size(model.get()), 0x2000 - 0x800 + 0x5200);
+
+  const auto tokens = getTokens(model.get());
+  EXPECT_TRUE(std::is_sorted(tokens.begin(), tokens.end()));
+  EXPECT_EQ(tokens[0], "\xe4\xb8\x80");
+
+  EXPECT_EQ(toke_model_add_codepoint_range(model.get(), 0x20, 0x10), TOKE_ERROR_INVALID_UNICODE);
+  EXPECT_EQ(toke_model_add_codepoint_range(model.get(), 0x10FFFF, 0x110000), TOKE_ERROR_INVALID_UNICODE);
+  EXPECT_EQ(toke_model_add_unicode_block(model.get(), static_cast<toke_unicode_block_z>(TOKE_UNICODE_BLOCK_COUNT)),
+            TOKE_ERROR_INVALID_UNICODE);
+
+  EXPECT_STREQ(toke_unicode_block_name(TOKE_UNICODE_BLOCK_BASIC_LATIN), "BASIC_LATIN");
+  EXPECT_STREQ(toke_unicode_block_name(TOKE_UNICODE_BLOCK_CJK_UNIFIED_IDEOGRAPHS), "CJK_UNIFIED_IDEOGRAPHS");
+  EXPECT_EQ(toke_unicode_block_name(static_cast<toke_unicode_block_z>(TOKE_UNICODE_BLOCK_COUNT)), nullptr);
+}
+
+TEST(Model, SaveAndLoad)
+{
+  std::mt19937 rng(44);
+
+  const auto tokens = makeRandomTokens(rng, 1000);
+
+  auto model = makeModel();
+
+  for (const auto& token : tokens) {
+    ASSERT_EQ(toke_model_add_token(model.get(), reinterpret_cast<const uint8_t*>(token.data()), token.size()),
+              TOKE_ERROR_NONE);
+  }
+
+  const auto path = testing::TempDir() + "model.bin";
+
+  ASSERT_EQ(toke_model_save(model.get(), path.c_str()), TOKE_ERROR_NONE);
+
+  auto loaded = makeModel();
+  ASSERT_EQ(toke_model_load(loaded.get(), path.c_str()), TOKE_ERROR_NONE);
+
+  auto expected = getTokens(model.get());
+  EXPECT_EQ(getTokens(loaded.get()), expected);
+
+  // definitions read from the file are null terminated, like the ones in memory
+  EXPECT_EQ(toke_model_get_def(loaded.get(), 1)[toke_model_get_size(loaded.get(), 1)], 0);
+
+  // a loaded model can still be changed
+  const std::string extra = "zzz";
+  ASSERT_EQ(toke_model_add_token(loaded.get(), reinterpret_cast<const uint8_t*>(extra.data()), extra.size()),
+            TOKE_ERROR_NONE);
+  expected.push_back(extra);
+  EXPECT_EQ(getTokens(loaded.get()), expected);
+
+  std::remove(path.c_str());
+}
+
+TEST(Model, SaveOverLoaded)
+{
+  std::mt19937 rng(45);
+
+  const auto tokens = makeRandomTokens(rng, 5000);
+
+  auto model = makeModel();
+
+  for (const auto& token : tokens) {
+    ASSERT_EQ(toke_model_add_token(model.get(), reinterpret_cast<const uint8_t*>(token.data()), token.size()),
+              TOKE_ERROR_NONE);
+  }
+
+  const auto path = testing::TempDir() + "checkpoint_model.bin";
+  ASSERT_EQ(toke_model_save(model.get(), path.c_str()), TOKE_ERROR_NONE);
+
+  auto loaded = makeModel();
+  ASSERT_EQ(toke_model_load(loaded.get(), path.c_str()), TOKE_ERROR_NONE);
+
+  auto expected = getTokens(model.get());
+
+  // the loaded model reads its tokens from the file it is being saved over, both unchanged and after a change
+  ASSERT_EQ(toke_model_save(loaded.get(), path.c_str()), TOKE_ERROR_NONE);
+  EXPECT_EQ(getTokens(loaded.get()), expected);
+
+  const std::string extra = "zzz";
+  ASSERT_EQ(toke_model_add_token(loaded.get(), reinterpret_cast<const uint8_t*>(extra.data()), extra.size()),
+            TOKE_ERROR_NONE);
+  expected.push_back(extra);
+  ASSERT_EQ(toke_model_save(loaded.get(), path.c_str()), TOKE_ERROR_NONE);
+  EXPECT_EQ(getTokens(loaded.get()), expected);
+
+  auto reloaded = makeModel();
+  ASSERT_EQ(toke_model_load(reloaded.get(), path.c_str()), TOKE_ERROR_NONE);
+  EXPECT_EQ(getTokens(reloaded.get()), expected);
+
+  // a save that can't be written leaves nothing behind
+  EXPECT_EQ(toke_model_save(loaded.get(), (testing::TempDir() + "missing/model.bin").c_str()), TOKE_ERROR_FILE_IO);
+
+  std::remove(path.c_str());
+}
+
+TEST(Model, LoadInvalid)
+{
+  const auto path = testing::TempDir() + "invalid_model.bin";
+
+  {
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    ASSERT_NE(file, nullptr);
+    const char text[] = "this is not a model file, it is just text";
+    std::fwrite(text, 1, sizeof(text), file);
+    std::fclose(file);
+  }
+
+  auto model = makeModel();
+  EXPECT_EQ(toke_model_load(model.get(), path.c_str()), TOKE_ERROR_MODEL_FORMAT);
+  EXPECT_EQ(toke_model_load(model.get(), (path + ".missing").c_str()), TOKE_ERROR_FILE_NOT_FOUND);
+
+  std::remove(path.c_str());
+}
+
+TEST(Model, LoadCorrupt)
+{
+  auto model = makeModel();
+  for (const std::string token : { "a", "bb", "ccc" }) {
+    ASSERT_EQ(toke_model_add_token(model.get(), reinterpret_cast<const uint8_t*>(token.data()), token.size()),
+              TOKE_ERROR_NONE);
+  }
+
+  const auto path = testing::TempDir() + "corrupt_model.bin";
+  ASSERT_EQ(toke_model_save(model.get(), path.c_str()), TOKE_ERROR_NONE);
+
+  std::string original;
+  {
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    ASSERT_NE(file, nullptr);
+    char buffer[256];
+    for (std::size_t n = 0; (n = std::fread(buffer, 1, sizeof(buffer), file)) > 0;) {
+      original.append(buffer, n);
+    }
+    std::fclose(file);
+  }
+
+  // a 32 byte header, four offsets (0, 2, 5, 9) and the pool "a\0bb\0ccc\0"
+  ASSERT_EQ(original.size(), 32u + (4 * 8) + 9);
+
+  const auto writePatched = [&](const std::size_t position, const std::string& bytes) {
+    auto patched = original;
+    patched.replace(position, bytes.size(), bytes);
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    std::fwrite(patched.data(), 1, patched.size(), file);
+    std::fclose(file);
+  };
+
+  const auto loadPatched = [&](const std::size_t position, const std::string& bytes) -> toke_error_z {
+    writePatched(position, bytes);
+    auto loaded = makeModel();
+    return toke_model_load(loaded.get(), path.c_str());
+  };
+
+  // Loading only checks what it can without reading every token, so a token that is malformed loads, but reads as
+  // null, and fails the first change and anything that reads every token.
+  const auto checkMalformed = [&](const std::size_t position, const std::string& bytes, const std::size_t index) {
+    writePatched(position, bytes);
+    auto loaded = makeModel();
+    ASSERT_EQ(toke_model_load(loaded.get(), path.c_str()), TOKE_ERROR_NONE);
+    EXPECT_EQ(toke_model_get_def(loaded.get(), index), nullptr);
+    EXPECT_EQ(toke_model_get_size(loaded.get(), index), 0);
+    EXPECT_EQ(toke_model_save(loaded.get(), (path + ".copy").c_str()), TOKE_ERROR_MODEL_FORMAT);
+    std::unique_ptr<toke_encoder_z, void (*)(toke_encoder_z*)> encoder(toke_encoder_new(), toke_encoder_delete);
+    EXPECT_EQ(toke_encoder_from_model(encoder.get(), loaded.get()), TOKE_ERROR_MODEL_FORMAT);
+    std::unique_ptr<toke_decoder_z, void (*)(toke_decoder_z*)> decoder(toke_decoder_new(), toke_decoder_delete);
+    EXPECT_EQ(toke_decoder_from_model(decoder.get(), loaded.get()), TOKE_ERROR_MODEL_FORMAT);
+    const std::string extra = "d";
+    EXPECT_EQ(toke_model_add_token(loaded.get(), reinterpret_cast<const uint8_t*>(extra.data()), extra.size()),
+              TOKE_ERROR_MODEL_FORMAT);
+    // the failed change leaves the model reading from the file
+    EXPECT_EQ(toke_model_size(loaded.get()), 3);
+    EXPECT_EQ(toke_model_get_def(loaded.get(), index), nullptr);
+  };
+
+  const auto offset = [](const std::uint64_t value) -> std::string {
+    return std::string(reinterpret_cast<const char*>(&value), sizeof(value));
+  };
+
+  EXPECT_EQ(loadPatched(0, ""), TOKE_ERROR_NONE);
+
+  // offsets that go backwards, or repeat, would give a definition a size below zero
+  checkMalformed(32 + 8, offset(6), 0);
+  checkMalformed(32 + 16, offset(2), 1);
+  checkMalformed(32 + 8, offset(0), 0);
+
+  // a definition that isn't terminated would be read past its end
+  checkMalformed(64 + 4, "x", 1);
+
+  // an offset that still increases, but ends a definition somewhere other than at its terminator
+  checkMalformed(32 + 8, offset(3), 0);
+
+  // the end of the pool and the last offset are checked on load
+  EXPECT_EQ(loadPatched(64 + 8, "x"), TOKE_ERROR_MODEL_FORMAT);
+  EXPECT_EQ(loadPatched(32 + 24, offset(8)), TOKE_ERROR_MODEL_FORMAT);
+
+  // tokens out of order read fine, but would break the binary search of an insertion, so the first change fails
+  for (const std::string token : { "c", "z" }) {
+    writePatched(64, token);
+    auto loaded = makeModel();
+    ASSERT_EQ(toke_model_load(loaded.get(), path.c_str()), TOKE_ERROR_NONE);
+    EXPECT_EQ(getTokens(loaded.get()), (std::vector<std::string>{ token, "bb", "ccc" }));
+    const std::string extra = "a";
+    EXPECT_EQ(toke_model_add_token(loaded.get(), reinterpret_cast<const uint8_t*>(extra.data()), extra.size()),
+              TOKE_ERROR_MODEL_FORMAT);
+  }
+
+  // a token that repeats the one before it is rejected on the first change too
+  {
+    auto patched = original;
+    patched.replace(32, 4 * sizeof(std::uint64_t), offset(0) + offset(2) + offset(4) + offset(9));
+    patched.replace(64, 9, std::string("a\0a\0ccc\0", 9));
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    std::fwrite(patched.data(), 1, patched.size(), file);
+    std::fclose(file);
+    auto loaded = makeModel();
+    ASSERT_EQ(toke_model_load(loaded.get(), path.c_str()), TOKE_ERROR_NONE);
+    const std::string extra = "b";
+    EXPECT_EQ(toke_model_add_token(loaded.get(), reinterpret_cast<const uint8_t*>(extra.data()), extra.size()),
+              TOKE_ERROR_MODEL_FORMAT);
+  }
+
+  std::remove(path.c_str());
+}
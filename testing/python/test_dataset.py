@@ -0,0 +1,143 @@
+import collections
+import json
+import tarfile
+
+import pytest
+
+import toke
+
+
+def write_jsonl(path, texts):
+    path.write_text(''.join(json.dumps({'text': text}) + '\n' for text in texts), encoding='utf-8')
+    dataset = toke.train.Dataset()
+    dataset.open(str(path))
+    return dataset
+
+
+def make_texts():
+    # more texts than a thread hands over at once, and one too large to be batched at all
+    texts = ['text %d é中\U0001f600' % i for i in range(1000)]
+    texts.append('x' * (2 * 1024 * 1024))
+    texts.append('')
+    return texts
+
+
+def test_count(tmp_path):
+    texts = make_texts()
+    dataset = write_jsonl(tmp_path / 'dataset.jsonl', texts)
+    for max_threads in (1, 4):
+        counts = dataset.count(max_threads=max_threads)
+        assert counts['documents'] == len(texts)
+        assert counts['bytes'] == sum(len(text.encode('utf-8')) for text in texts)
+        assert counts['codepoints'] == sum(len(text) for text in texts)
+
+
+def test_codepoint_histogram(tmp_path):
+    texts = make_texts()
+    dataset = write_jsonl(tmp_path / 'dataset.jsonl', texts)
+    expected = collections.Counter()
+    for text in texts:
+        expected.update(ord(c) for c in text)
+    assert dataset.codepoint_histogram(max_threads=4) == dict(expected)
+
+
+def test_codepoint_histogram_invalid_utf8(tmp_path):
+    path = tmp_path / 'dataset.tar'
+    member = tmp_path / 'member.txt'
+    member.write_bytes(b'a\xffb')
+    with tarfile.open(str(path), 'w', format=tarfile.USTAR_FORMAT) as tar:
+        tar.add(str(member), arcname='member.txt')
+    dataset = toke.train.Dataset()
+    dataset.open(str(path))
+    assert len(dataset) == 1
+    assert dataset[0] == b'a\xffb'
+    assert dataset.codepoint_histogram() == {ord('a'): 1, ord('b'): 1, 0xfffd: 1}
+
+
+def test_walk(tmp_path):
+    texts = make_texts()
+    dataset = write_jsonl(tmp_path / 'dataset.jsonl', texts)
+    for max_threads in (1, 4):
+        seen = {}
+
+        def callback(view, file_index, offset):
+            assert offset == 0
+            assert file_index not in seen
+            seen[file_index] = bytes(view).decode('utf-8')
+
+        dataset.walk(callback, max_threads=max_threads)
+        assert seen == dict(enumerate(texts))
+
+
+def test_walk_mapped_and_copied(tmp_path):
+    # the texts of an uncompressed tar stay in the mapping, while escaped JSON records are copied into the batches,
+    # so this mixes both in every batch
+    texts = ['plain %d' % i if i % 2 else 'escaped\n%d' % i for i in range(1000)]
+    jsonl = tmp_path / 'dataset.jsonl'
+    jsonl.write_text(''.join(json.dumps({'text': text}) + '\n' for text in texts), encoding='utf-8')
+
+    path = tmp_path / 'dataset.tar'
+    with tarfile.open(str(path), 'w', format=tarfile.USTAR_FORMAT) as tar:
+        for i, text in enumerate(texts[:300]):
+            member = tmp_path / 'member.txt'
+            member.write_bytes(text.encode('utf-8'))
+            tar.add(str(member), arcname='member_%d.txt' % i)
+
+    for filename, expected in ((jsonl, texts), (path, texts[:300])):
+        dataset = toke.train.Dataset()
+        dataset.open(str(filename))
+        seen = {}
+
+        def callback(view, file_index, offset):
+            seen[file_index] = bytes(view).decode('utf-8')
+
+        dataset.walk(callback, max_threads=4)
+        assert seen == dict(enumerate(expected))
+
+
+def test_walk_releases_views(tmp_path):
+    dataset = write_jsonl(tmp_path / 'dataset.jsonl', ['abc', 'def'])
+    views = []
+    dataset.walk(lambda view, file_index, offset: views.append(view), max_threads=2)
+    assert len(views) == 2
+    for view in views:
+        with pytest.raises(ValueError):
+            bytes(view)
+
+
+def test_walk_raises(tmp_path):
+    dataset = write_jsonl(tmp_path / 'dataset.jsonl', make_texts())
+    calls = []
+
+    def callback(view, file_index, offset):
+        calls.append(file_index)
+        raise KeyError(file_index)
+
+    with pytest.raises(KeyError):
+        dataset.walk(callback, max_threads=4)
+    # the walk skips the callable once it has raised
+    assert len(calls) == 1
+
+
+def test_change_while_walking(tmp_path):
+    path = tmp_path / 'dataset.jsonl'
+    dataset = write_jsonl(path, ['abc', 'def'])
+    changes = [
+        lambda: dataset.open(str(path)),
+        lambda: dataset.set_chunking(16),
+        lambda: dataset.set_readahead(0),
+        lambda: dataset.set_jsonl_field('body'),
+        lambda: dataset.set_sampling(0.5),
+        lambda: dataset.set_dedup(None),
+    ]
+    for change in changes:
+
+        def callback(view, file_index, offset):
+            change()
+
+        with pytest.raises(RuntimeError, match='being walked'):
+            dataset.walk(callback)
+
+    # the dataset can be changed again once the walks are done
+    dataset.set_chunking(16)
+    assert dataset.count()['documents'] == 2
@@ -0,0 +1,49 @@
+import numpy as np
+
+import toke
+
+
+def make_model(tokens):
+    model = toke.Model()
+    model.add_tokens(tokens)
+    return model
+
+
+def test_decode_text_vocab():
+    decoder = toke.Decoder()
+    decoder.parse_vocab('aa\nb\n \n')
+    # IDs past the vocab decode as DEL
+    assert decoder.decode(np.array([1, 0xffff, 2, 0], dtype=np.uint16)) == 'b\x7f aa'
+
+
+def test_decode_from_model():
+    model = make_model(['hello', 'world', ' ', 'h', 'e', 'l', 'o', 'w', 'r', 'd'])
+    encoder = toke.Encoder.from_model(model)
+    decoder = toke.Decoder.from_model(model)
+    tokens = encoder.encode('hello world')
+    assert len(tokens) == 3
+    assert decoder.decode(tokens) == 'hello world'
+
+
+def test_decode_takes_lists():
+    model = make_model(['a', 'b'])
+    decoder = toke.Decoder.from_model(model)
+    assert decoder.decode([1, 0, 1]) == 'bab'
+    assert decoder.decode([]) == ''
+
+
+def test_decode_from_model_replaces_vocab():
+    decoder = toke.Decoder()
+    decoder.parse_vocab('x\ny\nz\n')
+    decoder = toke.Decoder.from_model(make_model(['b', 'aa', 'a']))
+    # the model is kept sorted, so the IDs follow the order of the definitions
+    assert decoder.decode([1, 2, 0, 3]) == 'aaba\x7f'
+
+
+def test_decode_from_saved_model(tmp_path):
+    path = str(tmp_path / 'model.bin')
+    make_model(['the', ' ', 'cat']).save(path)
+    model = toke.Model()
+    model.load(path)
+    decoder = toke.Decoder.from_model(model)
+    assert decoder.decode([2, 0, 1]) == 'the cat'
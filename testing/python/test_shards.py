@@ -0,0 +1,91 @@
+import gc
+import json
+
+import numpy as np
+import pytest
+
+import toke
+
+
+def make_encoder():
+    encoder = toke.Encoder()
+    encoder.parse_vocab('a\nb\nc\nab\nabc\n')
+    return encoder
+
+
+def write_shards(tmp_path, texts, max_tokens=64):
+    dataset_path = tmp_path / 'dataset.jsonl'
+    dataset_path.write_text(''.join(json.dumps({'text': text}) + '\n' for text in texts))
+    dataset = toke.train.Dataset()
+    dataset.open(str(dataset_path))
+    writer = toke.train.ShardWriter()
+    writer.set_max_tokens(max_tokens)
+    writer.set_ordered(True)
+    prefix = str(tmp_path / 'shards')
+    writer.write(dataset, make_encoder(), prefix, max_threads=2)
+    return prefix
+
+
+def make_texts():
+    return ['abc' * (i % 7) + 'ab' * (i % 3) + 'c' for i in range(40)]
+
+
+def test_read_documents(tmp_path):
+    texts = make_texts()
+    shards = toke.train.TokenShards(write_shards(tmp_path, texts))
+    encoder = make_encoder()
+    assert len(shards) == len(texts)
+    assert shards.num_shards > 1
+    for i, text in enumerate(texts):
+        assert list(shards[i]) == list(encoder.encode(text))
+        assert list(shards.document(i)) == list(shards[i])
+    assert sum(len(shards.shard(i)) for i in range(shards.num_shards)) == shards.num_tokens
+    with pytest.raises(IndexError):
+        shards[len(texts)]
+    with pytest.raises(IndexError):
+        shards.window(0, len(shards.shard(0)), 1)
+
+
+def test_views_are_read_only(tmp_path):
+    shards = toke.train.TokenShards(write_shards(tmp_path, make_texts()))
+    view = shards.shard(0)
+    assert not view.flags.writeable
+    # the shards are mapped read-only, so numpy must not let the view be written through
+    with pytest.raises(ValueError):
+        view.flags.writeable = True
+
+
+def test_views_outlive_shards(tmp_path):
+    texts = make_texts()
+    shards = toke.train.TokenShards(write_shards(tmp_path, texts))
+    expected = [list(shards[i]) for i in range(len(shards))]
+    views = [shards[i] for i in range(len(shards))]
+    window = shards.window(0, 1, 4)
+    expected_window = list(window)
+    # the views hold the shards open, so dropping every other reference must not unmap them
+    del shards
+    gc.collect()
+    assert [list(view) for view in views] == expected
+    assert list(window) == expected_window
+
+
+def test_sampler_outlives_shards(tmp_path):
+    shards = toke.train.TokenShards(write_shards(tmp_path, make_texts()))
+    copies = shards.sampler(batch_size=4, window_size=8, seed=1)
+    views = shards.sampler(batch_size=4, window_size=8, seed=1)
+    del shards
+    gc.collect()
+    for _ in range(3):
+        batch = next(copies)
+        assert batch.shape == (4, 8)
+        assert batch.dtype == np.uint16
+        drawn = views.next_views()
+        assert [list(row) for row in batch] == [list(view) for view in drawn]
+    assert copies.rng_state == views.rng_state
+
+
+def test_sampler_rejects_large_windows(tmp_path):
+    shards = toke.train.TokenShards(write_shards(tmp_path, make_texts()))
+    sampler = shards.sampler(batch_size=1, window_size=shards.num_tokens + 1)
+    with pytest.raises(ValueError):
+        next(sampler)
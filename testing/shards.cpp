@@ -0,0 +1,462 @@
+#include <gtest/gtest.h>
+
+#include <toke/encoder.h>
+#include <toke/train/dataset.h>
+#include <toke/train/dedup.h>
+#include <toke/train/shards.h>
+
+#include "helpers.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr char vocab[] = R"(a
+b
+c
+ab
+abc
+
+)";
+
+using namespace toke_testing;
+
+using EncoderPtr = std::unique_ptr<toke_encoder_z, void (*)(toke_encoder_z*)>;
+
+using WriterPtr = std::unique_ptr<toke_shard_writer_z, void (*)(toke_shard_writer_z*)>;
+
+using ShardsPtr = std::unique_ptr<toke_token_shards_z, void (*)(toke_token_shards_z*)>;
+
+[[nodiscard]] auto
+shardPath(const std::string& prefix, const std::size_t index) -> std::string
+{
+  char suffix[32];
+  std::snprintf(suffix, sizeof(suffix), "-%05zu.bin", index);
+  return prefix + suffix;
+}
+
+struct Document final
+{
+  std::uint64_t file_index;
+  std::uint64_t offset;
+  std::uint64_t shard;
+  std::uint64_t start;
+  std::uint64_t num_tokens;
+};
+
+/**
+ * @brief The contents of a shard index, read by following the layout that the writer documents.
+ * */
+struct ShardIndex final
+{
+  std::uint64_t num_tokens{};
+
+  std::vector<std::uint64_t> shard_tokens;
+
+  std::vector<Document> documents;
+};
+
+[[nodiscard]] auto
+readIndex(const std::string& prefix, ShardIndex& index) -> bool
+{
+  const auto data = readFile(prefix + ".idx");
+
+  // magic, version, byte order, then the number of shards, documents and tokens
+  const std::size_t header_size = 8 + 4 + 4 + 3 * 8;
+  if ((data.size() < header_size) || (data.compare(0, 8, "TOKESHRD") != 0)) {
+    return false;
+  }
+
+  std::uint64_t counts[3];
+  std::memcpy(counts, data.data() + 16, sizeof(counts));
+
+  if (data.size() != (header_size + (counts[0] * 8) + (counts[1] * sizeof(Document)))) {
+    return false;
+  }
+
+  index.num_tokens = counts[2];
+  index.shard_tokens.resize(counts[0]);
+  index.documents.resize(counts[1]);
+  std::memcpy(index.shard_tokens.data(), data.data() + header_size, counts[0] * 8);
+  std::memcpy(index.documents.data(), data.data() + header_size + (counts[0] * 8), counts[1] * sizeof(Document));
+
+  return true;
+}
+
+[[nodiscard]] auto
+makeJsonl(std::vector<std::string>& texts) -> std::string
+{
+  std::string jsonl;
+
+  for (int i = 0; i < 300; i++) {
+    std::string text;
+    const auto size = static_cast<std::size_t>((i * 37) % 160);
+    for (std::size_t j = 0; j < size; j++) {
+      text += "abc dabcab "[(i + (j * 7)) % 11];
+    }
+    jsonl += "{\"text\": \"" + text + "\"}\n";
+    texts.push_back(text);
+  }
+
+  return jsonl;
+}
+
+[[nodiscard]] auto
+encode(toke_encoder_z* encoder, const std::string& text) -> std::vector<std::uint16_t>
+{
+  if (text.empty()) {
+    return {};
+  }
+  std::size_t size = 0;
+  auto* tokens = toke_encode(encoder, text.data(), text.size(), &size);
+  std::vector<std::uint16_t> result(tokens, tokens + size);
+  std::free(tokens);
+  return result;
+}
+
+void
+checkShards(const toke_shard_order_z order, const bool ordered)
+{
+  std::vector<std::string> texts;
+
+  const auto dataset_path = testing::TempDir() + "shards.jsonl";
+  writeFile(dataset_path, makeJsonl(texts));
+
+  auto dataset = makeDataset();
+  ASSERT_EQ(toke_dataset_open(dataset.get(), dataset_path.c_str()), TOKE_ERROR_NONE);
+
+  // small runs of lines, so that the documents are encoded out of order
+  toke_dataset_set_chunking(dataset.get(), 64, '\n');
+
+  EncoderPtr encoder(toke_encoder_new(), toke_encoder_delete);
+  ASSERT_EQ(toke_encoder_parse_vocab(encoder.get(), vocab, sizeof(vocab) - 1), TOKE_ERROR_NONE);
+
+  WriterPtr writer(toke_shard_writer_new(), toke_shard_writer_delete);
+  toke_shard_writer_set_max_tokens(writer.get(), 500);
+  toke_shard_writer_set_order(writer.get(), order);
+
+  const auto prefix = testing::TempDir() + "shards";
+  ASSERT_EQ(toke_shard_writer_write(writer.get(), dataset.get(), encoder.get(), prefix.c_str(), 4), TOKE_ERROR_NONE);
+
+  ShardIndex index;
+  ASSERT_TRUE(readIndex(prefix, index));
+
+  EXPECT_EQ(toke_shard_writer_num_shards(writer.get()), index.shard_tokens.size());
+  EXPECT_EQ(toke_shard_writer_num_documents(writer.get()), texts.size());
+  EXPECT_EQ(toke_shard_writer_num_tokens(writer.get()), index.num_tokens);
+  ASSERT_EQ(index.documents.size(), texts.size());
+  EXPECT_GT(index.shard_tokens.size(), 1);
+
+  std::vector<std::string> shards;
+  std::uint64_t num_tokens = 0;
+  for (std::size_t i = 0; i < index.shard_tokens.size(); i++) {
+    shards.push_back(readFile(shardPath(prefix, i)));
+    EXPECT_EQ(shards.back().size(), index.shard_tokens[i] * 2);
+    EXPECT_LE(index.shard_tokens[i], 500);
+    num_tokens += index.shard_tokens[i];
+  }
+  EXPECT_EQ(num_tokens, index.num_tokens);
+
+  if (ordered) {
+    for (std::size_t i = 0; i < index.documents.size(); i++) {
+      EXPECT_EQ(index.documents[i].file_index, i);
+    }
+  }
+
+  // every shard is filled up by the documents in it, one after the other
+  std::vector<std::uint64_t> shard_ends(shards.size());
+
+  std::vector<bool> seen(texts.size());
+
+  for (const auto& document : index.documents) {
+
+    ASSERT_LT(document.file_index, texts.size());
+    ASSERT_LT(document.shard, shards.size());
+    EXPECT_FALSE(seen[document.file_index]);
+    seen[document.file_index] = true;
+
+    EXPECT_EQ(document.offset, 0);
+    EXPECT_EQ(document.start, shard_ends[document.shard]);
+    shard_ends[document.shard] += document.num_tokens;
+
+    std::vector<std::uint16_t> tokens(document.num_tokens);
+    std::memcpy(tokens.data(), shards[document.shard].data() + (document.start * 2), document.num_tokens * 2);
+    EXPECT_EQ(tokens, encode(encoder.get(), texts[document.file_index])) << document.file_index;
+  }
+
+  for (std::size_t i = 0; i < shards.size(); i++) {
+    EXPECT_EQ(shard_ends[i], index.shard_tokens[i]);
+  }
+
+  // the temporary files of an ordered write are gone
+  EXPECT_FALSE(fileExists(prefix + "-00000.tmp"));
+
+  for (std::size_t i = 0; i < shards.size(); i++) {
+    std::remove(shardPath(prefix, i).c_str());
+  }
+  std::remove((prefix + ".idx").c_str());
+  std::remove(dataset_path.c_str());
+}
+
+} // namespace
+
+TEST(Shards, WriteOrdered)
+{
+  checkShards(TOKE_SHARD_ORDERED, true);
+}
+
+TEST(Shards, WriteUnordered)
+{
+  checkShards(TOKE_SHARD_UNORDERED, false);
+}
+
+TEST(Shards, WriteEmpty)
+{
+  const auto dataset_path = testing::TempDir() + "empty.jsonl";
+  writeFile(dataset_path, "{\"id\": 1}\n");
+
+  auto dataset = makeDataset();
+  ASSERT_EQ(toke_dataset_open(dataset.get(), dataset_path.c_str()), TOKE_ERROR_NONE);
+
+  EncoderPtr encoder(toke_encoder_new(), toke_encoder_delete);
+  WriterPtr writer(toke_shard_writer_new(), toke_shard_writer_delete);
+
+  const auto prefix = testing::TempDir() + "empty_shards";
+  ASSERT_EQ(toke_shard_writer_write(writer.get(), dataset.get(), encoder.get(), prefix.c_str(), 2), TOKE_ERROR_NONE);
+
+  ShardIndex index;
+  ASSERT_TRUE(readIndex(prefix, index));
+  EXPECT_TRUE(index.shard_tokens.empty());
+  EXPECT_TRUE(index.documents.empty());
+
+  std::remove((prefix + ".idx").c_str());
+  std::remove(dataset_path.c_str());
+}
+
+TEST(Shards, WriteFewerShards)
+{
+  std::vector<TarEntry> entries;
+  for (int i = 0; i < 30; i++) {
+    entries.push_back(TarEntry{ "file_" + std::to_string(i) + ".txt", "abc ab c abc" });
+  }
+
+  const auto dataset_path = testing::TempDir() + "fewer.tar";
+  writeFile(dataset_path, makeTar(entries));
+
+  auto dataset = makeDataset();
+  ASSERT_EQ(toke_dataset_open(dataset.get(), dataset_path.c_str()), TOKE_ERROR_NONE);
+
+  EncoderPtr encoder(toke_encoder_new(), toke_encoder_delete);
+  ASSERT_EQ(toke_encoder_parse_vocab(encoder.get(), vocab, sizeof(vocab) - 1), TOKE_ERROR_NONE);
+
+  WriterPtr writer(toke_shard_writer_new(), toke_shard_writer_delete);
+  toke_shard_writer_set_max_tokens(writer.get(), 20);
+
+  const auto prefix = testing::TempDir() + "fewer_shards";
+  ASSERT_EQ(toke_shard_writer_write(writer.get(), dataset.get(), encoder.get(), prefix.c_str(), 2), TOKE_ERROR_NONE);
+
+  const auto many = toke_shard_writer_num_shards(writer.get());
+  ASSERT_GT(many, 2);
+  EXPECT_TRUE(fileExists(shardPath(prefix, many - 1)));
+
+  // the same prefix again, with room for everything in one shard
+  toke_shard_writer_set_max_tokens(writer.get(), 1000);
+  ASSERT_EQ(toke_shard_writer_write(writer.get(), dataset.get(), encoder.get(), prefix.c_str(), 2), TOKE_ERROR_NONE);
+  ASSERT_EQ(toke_shard_writer_num_shards(writer.get()), 1);
+
+  EXPECT_TRUE(fileExists(shardPath(prefix, 0)));
+  for (std::size_t i = 1; i < many; i++) {
+    EXPECT_FALSE(fileExists(shardPath(prefix, i))) << i;
+  }
+
+  ShardIndex index;
+  ASSERT_TRUE(readIndex(prefix, index));
+  EXPECT_EQ(index.shard_tokens.size(), 1);
+  EXPECT_EQ(index.documents.size(), entries.size());
+
+  std::remove(shardPath(prefix, 0).c_str());
+  std::remove((prefix + ".idx").c_str());
+  std::remove((dataset_path + ".idx").c_str());
+  std::remove(dataset_path.c_str());
+}
+
+TEST(Shards, WriteOrderedDedup)
+{
+  // fifty distinct texts, each repeated four times across the dataset
+  std::string jsonl;
+  std::vector<std::string> texts;
+  for (int i = 0; i < 200; i++) {
+    const auto k = static_cast<std::size_t>(i % 50);
+    texts.push_back(std::string(k + 1, 'a') + " " + std::string((k % 7) + 1, 'c') + "b");
+    jsonl += "{\"text\": \"" + texts.back() + "\"}\n";
+  }
+
+  const auto dataset_path = testing::TempDir() + "dedup_shards.jsonl";
+  writeFile(dataset_path, jsonl);
+
+  auto dataset = makeDataset();
+  ASSERT_EQ(toke_dataset_open(dataset.get(), dataset_path.c_str()), TOKE_ERROR_NONE);
+
+  // small runs of lines, so that later copies are often walked before the first ones
+  toke_dataset_set_chunking(dataset.get(), 32, '\n');
+
+  std::unique_ptr<toke_dedup_z, void (*)(toke_dedup_z*)> dedup(toke_dedup_new(), toke_dedup_delete);
+  toke_dataset_set_dedup(dataset.get(), dedup.get());
+
+  EncoderPtr encoder(toke_encoder_new(), toke_encoder_delete);
+  ASSERT_EQ(toke_encoder_parse_vocab(encoder.get(), vocab, sizeof(vocab) - 1), TOKE_ERROR_NONE);
+
+  WriterPtr writer(toke_shard_writer_new(), toke_shard_writer_delete);
+  toke_shard_writer_set_order(writer.get(), TOKE_SHARD_ORDERED);
+
+  const auto prefix = testing::TempDir() + "dedup_shards";
+
+  for (int pass = 0; pass < 3; pass++) {
+
+    toke_dedup_clear(dedup.get());
+
+    ASSERT_EQ(toke_shard_writer_write(writer.get(), dataset.get(), encoder.get(), prefix.c_str(), 4),
+              TOKE_ERROR_NONE);
+
+    EXPECT_EQ(toke_dedup_num_unique(dedup.get()), 50);
+    EXPECT_EQ(toke_dedup_num_duplicates(dedup.get()), 150);
+
+    // the copy that is kept is always the first one in the dataset, whichever thread got to it
+    ShardIndex index;
+    ASSERT_TRUE(readIndex(prefix, index));
+    ASSERT_EQ(index.documents.size(), 50);
+    EXPECT_EQ(toke_shard_writer_num_documents(writer.get()), 50);
+    for (std::size_t i = 0; i < index.documents.size(); i++) {
+      EXPECT_EQ(index.documents[i].file_index, i) << pass;
+      EXPECT_EQ(index.documents[i].num_tokens, encode(encoder.get(), texts[i]).size());
+    }
+  }
+
+  std::remove(shardPath(prefix, 0).c_str());
+  std::remove((prefix + ".idx").c_str());
+  std::remove(dataset_path.c_str());
+}
+
+TEST(Shards, WriteFailure)
+{
+  const auto dataset_path = testing::TempDir() + "failure.jsonl";
+  writeFile(dataset_path, "{\"text\": \"abc\"}\n");
+
+  auto dataset = makeDataset();
+  ASSERT_EQ(toke_dataset_open(dataset.get(), dataset_path.c_str()), TOKE_ERROR_NONE);
+
+  EncoderPtr encoder(toke_encoder_new(), toke_encoder_delete);
+  WriterPtr writer(toke_shard_writer_new(), toke_shard_writer_delete);
+
+  // a prefix in a directory that doesn't exist
+  const auto prefix = testing::TempDir() + "missing/shards";
+
+  for (const auto order : { TOKE_SHARD_ORDERED, TOKE_SHARD_UNORDERED }) {
+    toke_shard_writer_set_order(writer.get(), order);
+    EXPECT_EQ(toke_shard_writer_write(writer.get(), dataset.get(), encoder.get(), prefix.c_str(), 2),
+              TOKE_ERROR_FILE_IO);
+  }
+
+  std::remove(dataset_path.c_str());
+}
+
+TEST(Shards, Read)
+{
+  std::vector<std::string> texts;
+
+  const auto dataset_path = testing::TempDir() + "read.jsonl";
+  writeFile(dataset_path, makeJsonl(texts));
+
+  auto dataset = makeDataset();
+  ASSERT_EQ(toke_dataset_open(dataset.get(), dataset_path.c_str()), TOKE_ERROR_NONE);
+
+  EncoderPtr encoder(toke_encoder_new(), toke_encoder_delete);
+  ASSERT_EQ(toke_encoder_parse_vocab(encoder.get(), vocab, sizeof(vocab) - 1), TOKE_ERROR_NONE);
+
+  WriterPtr writer(toke_shard_writer_new(), toke_shard_writer_delete);
+  toke_shard_writer_set_max_tokens(writer.get(), 500);
+
+  const auto prefix = testing::TempDir() + "read_shards";
+  ASSERT_EQ(toke_shard_writer_write(writer.get(), dataset.get(), encoder.get(), prefix.c_str(), 4), TOKE_ERROR_NONE);
+
+  ShardsPtr shards(toke_token_shards_new(), toke_token_shards_delete);
+  ASSERT_EQ(toke_token_shards_open(shards.get(), prefix.c_str()), TOKE_ERROR_NONE);
+
+  const auto num_shards = toke_token_shards_num_shards(shards.get());
+  EXPECT_EQ(num_shards, toke_shard_writer_num_shards(writer.get()));
+  EXPECT_EQ(toke_token_shards_num_tokens(shards.get()), toke_shard_writer_num_tokens(writer.get()));
+  ASSERT_EQ(toke_token_shards_num_documents(shards.get()), texts.size());
+
+  for (std::size_t i = 0; i < texts.size(); i++) {
+    std::size_t num_tokens = 0;
+    std::size_t file_index = 0;
+    std::size_t offset = 1;
+    const auto* tokens = toke_token_shards_get_document(shards.get(), i, &num_tokens, &file_index, &offset);
+    EXPECT_EQ(std::vector<std::uint16_t>(tokens, tokens + num_tokens), encode(encoder.get(), texts[i])) << i;
+    EXPECT_EQ(file_index, i);
+    EXPECT_EQ(offset, 0);
+  }
+
+  std::size_t num_tokens = 0;
+  EXPECT_EQ(toke_token_shards_get_document(shards.get(), texts.size(), &num_tokens, nullptr, nullptr), nullptr);
+  EXPECT_EQ(toke_token_shards_get_shard(shards.get(), num_shards, &num_tokens), nullptr);
+
+  std::vector<std::uint16_t> all_tokens;
+  std::size_t num_windows = 0;
+  for (std::size_t i = 0; i < num_shards; i++) {
+    const auto* tokens = toke_token_shards_get_shard(shards.get(), i, &num_tokens);
+    all_tokens.insert(all_tokens.end(), tokens, tokens + num_tokens);
+    num_windows += (num_tokens >= 65) ? (num_tokens - 64) : 0;
+  }
+  EXPECT_EQ(toke_token_shards_num_windows(shards.get(), 65), num_windows);
+
+  // the same seed draws the same windows, each a slice of a single shard
+  std::vector<std::uint16_t> windows(100 * 65);
+  std::vector<std::uint64_t> starts(100);
+  std::uint64_t rng = 1234;
+  ASSERT_EQ(toke_token_shards_sample(shards.get(), 65, 100, &rng, windows.data(), starts.data()), TOKE_ERROR_NONE);
+
+  std::vector<std::uint16_t> again(windows.size());
+  std::uint64_t again_rng = 1234;
+  ASSERT_EQ(toke_token_shards_sample(shards.get(), 65, 100, &again_rng, again.data(), nullptr), TOKE_ERROR_NONE);
+  EXPECT_EQ(windows, again);
+  EXPECT_EQ(rng, again_rng);
+
+  for (std::size_t i = 0; i < starts.size(); i++) {
+    ASSERT_LE(starts[i] + 65, all_tokens.size());
+    const auto window = windows.begin() + static_cast<std::ptrdiff_t>(i * 65);
+    EXPECT_TRUE(std::equal(window, window + 65, all_tokens.begin() + static_cast<std::ptrdiff_t>(starts[i])));
+  }
+
+  EXPECT_EQ(toke_token_shards_sample(shards.get(), 501, 1, &rng, windows.data(), nullptr), TOKE_ERROR_BUFFER_SIZE);
+
+  // a shard that doesn't match the index
+  const auto last_shard = shardPath(prefix, num_shards - 1);
+  const auto last_shard_data = readFile(last_shard);
+  writeFile(last_shard, last_shard_data.substr(2));
+  EXPECT_EQ(toke_token_shards_open(shards.get(), prefix.c_str()), TOKE_ERROR_SHARD_FORMAT);
+  EXPECT_EQ(toke_token_shards_num_documents(shards.get()), 0);
+
+  for (std::size_t i = 0; i < num_shards; i++) {
+    std::remove(shardPath(prefix, i).c_str());
+  }
+
+  EXPECT_EQ(toke_token_shards_open(shards.get(), prefix.c_str()), TOKE_ERROR_FILE_NOT_FOUND);
+
+  // an index that was cut off
+  const auto index_data = readFile(prefix + ".idx");
+  writeFile(prefix + ".idx", index_data.substr(0, index_data.size() - 1));
+  EXPECT_EQ(toke_token_shards_open(shards.get(), prefix.c_str()), TOKE_ERROR_SHARD_FORMAT);
+
+  std::remove((prefix + ".idx").c_str());
+  EXPECT_EQ(toke_token_shards_open(shards.get(), prefix.c_str()), TOKE_ERROR_FILE_NOT_FOUND);
+
+  std::remove(dataset_path.c_str());
+}